@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compile time benchmark for RAJA::kernel.
+//
+// The cost measured is building this file: it instantiates deep loop nests,
+// statement lists of many lambdas and tiled nests, num_copies times each
+// with different lambdas, like an application with many kernels. The
+// benchmark-kernel-compile-time target rebuilds it and prints the time,
+//
+//   make benchmark-kernel-compile-time
+//
+// and the size of the object file tracks the code generated. Running the
+// executable only checks the kernels compute what they should.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "RAJA/RAJA.hpp"
+
+constexpr int num_copies = 8;
+
+using nest5_policy = RAJA::KernelPolicy<
+    RAJA::statement::For<4, RAJA::seq_exec,
+      RAJA::statement::For<3, RAJA::seq_exec,
+        RAJA::statement::For<2, RAJA::seq_exec,
+          RAJA::statement::For<1, RAJA::seq_exec,
+            RAJA::statement::For<0, RAJA::seq_exec,
+              RAJA::statement::Lambda<0>>>>>>>;
+
+using lambdas_policy = RAJA::KernelPolicy<
+    RAJA::statement::For<1, RAJA::seq_exec,
+      RAJA::statement::Lambda<0>,
+      RAJA::statement::For<0, RAJA::seq_exec,
+        RAJA::statement::Lambda<1>,
+        RAJA::statement::Lambda<2>,
+        RAJA::statement::Lambda<3>,
+        RAJA::statement::Lambda<4>,
+        RAJA::statement::Lambda<5>,
+        RAJA::statement::Lambda<6>,
+        RAJA::statement::Lambda<7>>,
+      RAJA::statement::Lambda<8>>>;
+
+using tiled_policy = RAJA::KernelPolicy<
+    RAJA::statement::Tile<2, RAJA::tile_fixed<4>, RAJA::seq_exec,
+      RAJA::statement::Tile<1, RAJA::tile_fixed<4>, RAJA::seq_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<4>, RAJA::seq_exec,
+          RAJA::statement::For<2, RAJA::seq_exec,
+            RAJA::statement::For<1, RAJA::seq_exec,
+              RAJA::statement::For<0, RAJA::seq_exec,
+                RAJA::statement::Lambda<0>>>>>>>>;
+
+//
+// Each value of I is a different set of kernels in the object file.
+//
+template <camp::idx_t I>
+long run_kernels(int n)
+{
+  using range = RAJA::TypedRangeSegment<int>;
+  long sum = 0;
+
+  RAJA::kernel<nest5_policy>(
+      RAJA::make_tuple(range(0, n), range(0, n), range(0, n), range(0, n),
+                       range(0, n)),
+      [&](int i, int j, int k, int l, int m) { sum += i + j + k + l + m + I; });
+
+  RAJA::kernel<lambdas_policy>(
+      RAJA::make_tuple(range(0, n), range(0, n)),
+      [&](int, int j) { sum += j + I; },
+      [&](int i, int) { sum += i; },
+      [&](int i, int) { sum += 2 * i; },
+      [&](int i, int) { sum += 3 * i; },
+      [&](int i, int) { sum += 4 * i; },
+      [&](int i, int) { sum += 5 * i; },
+      [&](int i, int) { sum += 6 * i; },
+      [&](int i, int) { sum += 7 * i; },
+      [&](int, int j) { sum -= j; });
+
+  RAJA::kernel<tiled_policy>(
+      RAJA::make_tuple(range(0, n), range(0, n), range(0, n)),
+      [&](int i, int j, int k) { sum += i * j + k + I; });
+
+  return sum;
+}
+
+template <camp::idx_t... Is>
+long run_all(camp::idx_seq<Is...>, int n)
+{
+  long sums[] = {run_kernels<Is>(n)...};
+  long sum = 0;
+  for (long s : sums) {
+    sum += s;
+  }
+  return sum;
+}
+
+//
+// The sum the kernels of run_kernels<I> compute, from plain loops.
+//
+long expected_sum(int I, int n)
+{
+  long sum = 0;
+  long n4 = long(n) * n * n * n;
+  long tri = long(n) * (n - 1) / 2;
+
+  // five nested loops, each index summed n^4 times
+  sum += 5 * tri * n4 + long(I) * n4 * n;
+
+  // the lambdas kernel, Lambda<8> cancels Lambda<0> but for I
+  sum += long(I) * n;
+  sum += long(1 + 2 + 3 + 4 + 5 + 6 + 7) * tri * n;
+
+  // the tiled kernel
+  sum += tri * tri * n + tri * n * n + long(I) * n * n * n;
+
+  return sum;
+}
+
+int main(int argc, char** argv)
+{
+  int n = 6;
+  if (argc > 1) {
+    n = std::max(1, std::atoi(argv[1]));
+  }
+
+  long sum = run_all(camp::make_idx_seq_t<num_copies>{}, n);
+
+  long expected = 0;
+  for (int I = 0; I < num_copies; ++I) {
+    expected += expected_sum(I, n);
+  }
+
+  std::cout << "kernels computed " << sum << ", expected " << expected
+            << std::endl;
+
+  return (sum == expected) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
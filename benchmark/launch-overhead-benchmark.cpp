@@ -0,0 +1,377 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Dispatch cost of back-to-back forall, kernel, launch and WorkGroup
+/// calls with an empty body (range 0) or a tiny one (range 1 > 0).
+///
+/// Every call is timed twice: until it returns to the host, reported as
+/// enqueue_us, and until the device has finished it, reported as wait_us.
+/// For synchronous policies enqueue_us holds the whole kernel; for
+/// asynchronous policies it is the cost to enqueue and wait_us is the
+/// device time the host did not overlap.
+///
+/// forall is also run with a NoPlugins parameter, which compiles the plugin
+/// calls out, and with KernelName and Reduce parameters.
+///
+
+#include <chrono>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+namespace
+{
+
+constexpr int block_size = 256;
+
+using clock_type = std::chrono::steady_clock;
+
+//
+// Allocator of pinned host memory for the WorkGroup storage.
+//
+template < typename Resource >
+struct PinnedAllocator
+{
+  template < typename T >
+  struct std_allocator
+  {
+    using value_type = T;
+
+    std_allocator() = default;
+
+    template < typename U >
+    std_allocator(std_allocator<U> const&) noexcept { }
+
+    value_type* allocate(size_t num)
+    {
+      if (num > std::numeric_limits<size_t>::max() / sizeof(value_type)) {
+        throw std::bad_alloc();
+      }
+      value_type* ptr = Resource::get_default().template allocate<value_type>(
+          num, camp::resources::MemoryAccess::Pinned);
+      if (!ptr) {
+        throw std::bad_alloc();
+      }
+      return ptr;
+    }
+
+    void deallocate(value_type* ptr, size_t) noexcept
+    {
+      Resource::get_default().deallocate(ptr,
+                                         camp::resources::MemoryAccess::Pinned);
+    }
+
+    template <typename U>
+    friend inline bool operator==(std_allocator const&, std_allocator<U> const&)
+    {
+      return true;
+    }
+
+    template <typename U>
+    friend inline bool operator!=(std_allocator const& lhs, std_allocator<U> const& rhs)
+    {
+      return !(lhs == rhs);
+    }
+  };
+};
+
+//
+// Policies of each back-end, sync or async.
+//
+struct Host
+{
+  using resource = camp::resources::Host;
+
+  using exec_policy = RAJA::seq_exec;
+  using reduce_policy = RAJA::seq_reduce;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::seq_work,
+                               RAJA::ordered,
+                               RAJA::ragged_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { }
+};
+
+#if defined(RAJA_ENABLE_CUDA)
+template < bool Async >
+struct Cuda
+{
+  using resource = camp::resources::Cuda;
+
+  using exec_policy = RAJA::cuda_exec<block_size, Async>;
+  using reduce_policy = RAJA::cuda_reduce;
+
+  using kernel_body =
+      RAJA::statement::For<0, RAJA::cuda_global_thread_x,
+        RAJA::statement::Lambda<0>
+      >;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        typename std::conditional<Async,
+          RAJA::statement::CudaKernelFixedAsync<block_size, kernel_body>,
+          RAJA::statement::CudaKernelFixed<block_size, kernel_body>>::type
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<Async>>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::cuda_global_thread_x>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::cuda_work<block_size, Async>,
+                               RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+                               RAJA::constant_stride_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { RAJA::synchronize<RAJA::cuda_synchronize>(); }
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template < bool Async >
+struct Hip
+{
+  using resource = camp::resources::Hip;
+
+  using exec_policy = RAJA::hip_exec<block_size, Async>;
+  using reduce_policy = RAJA::hip_reduce;
+
+  using kernel_body =
+      RAJA::statement::For<0, RAJA::hip_global_thread_x,
+        RAJA::statement::Lambda<0>
+      >;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        typename std::conditional<Async,
+          RAJA::statement::HipKernelFixedAsync<block_size, kernel_body>,
+          RAJA::statement::HipKernelFixed<block_size, kernel_body>>::type
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<Async>>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::hip_global_thread_x>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::hip_work<block_size, Async>,
+                               RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average,
+                               RAJA::constant_stride_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { RAJA::synchronize<RAJA::hip_synchronize>(); }
+};
+#endif
+
+//
+// Runs dispatch() once per benchmark iteration and splits the time of each
+// call into the time to return and the time to synchronize.
+//
+template < typename Backend, typename Dispatch >
+void time_dispatch(benchmark::State& state, Dispatch&& dispatch)
+{
+  using us = std::chrono::duration<double, std::micro>;
+  double enqueue = 0.0;
+  double wait = 0.0;
+
+  for (auto _ : state) {
+    const clock_type::time_point start = clock_type::now();
+    dispatch();
+    const clock_type::time_point enqueued = clock_type::now();
+    Backend::synchronize();
+    const clock_type::time_point done = clock_type::now();
+
+    enqueue += us(enqueued - start).count();
+    wait += us(done - enqueued).count();
+  }
+
+  state.counters["enqueue_us"] =
+      benchmark::Counter(enqueue, benchmark::Counter::kAvgIterations);
+  state.counters["wait_us"] =
+      benchmark::Counter(wait, benchmark::Counter::kAvgIterations);
+}
+
+//
+// Data touched by the tiny kernels, range(0) doubles on the back-end.
+//
+template < typename Backend >
+struct Data
+{
+  explicit Data(int len_in)
+    : len(len_in)
+    , res(Backend::resource::get_default())
+    , ptr(len > 0 ? res.template allocate<double>(len) : nullptr)
+  { }
+
+  ~Data() { if (ptr != nullptr) res.deallocate(ptr); }
+
+  Data(Data const&) = delete;
+  Data& operator=(Data const&) = delete;
+
+  int len;
+  typename Backend::resource res;
+  double* ptr;
+};
+
+//
+// The device lambdas are made outside the lambdas passed to time_dispatch,
+// since nvcc does not allow extended lambdas inside other lambdas.
+//
+template < typename Backend >
+void forall_plain(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  auto body = [=] RAJA_HOST_DEVICE (int i) { a[i] += 1.0; };
+
+  time_dispatch<Backend>(state, [&]() {
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, data.len),
+      body);
+  });
+}
+
+template < typename Backend >
+void forall_no_plugins(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  auto body = [=] RAJA_HOST_DEVICE (int i) { a[i] += 1.0; };
+
+  time_dispatch<Backend>(state, [&]() {
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, data.len),
+      RAJA::expt::NoPlugins(),
+      body);
+  });
+}
+
+template < typename Backend >
+void forall_kernel_name(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  auto body = [=] RAJA_HOST_DEVICE (int i) { a[i] += 1.0; };
+
+  time_dispatch<Backend>(state, [&]() {
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, data.len),
+      RAJA::expt::KernelName("launch-overhead"),
+      body);
+  });
+}
+
+// expt::Reduce always waits for its result, so wait_us stays near zero
+template < typename Backend >
+void forall_reduce(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  auto body = [=] RAJA_HOST_DEVICE (int i, double& s) { s += a[i]; };
+
+  time_dispatch<Backend>(state, [&]() {
+    double sum = 0.0;
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, data.len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      body);
+    benchmark::DoNotOptimize(sum);
+  });
+}
+
+template < typename Backend >
+void kernel_plain(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  auto body = [=] RAJA_HOST_DEVICE (int i) { a[i] += 1.0; };
+
+  time_dispatch<Backend>(state, [&]() {
+    RAJA::kernel<typename Backend::kernel_policy>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, data.len)),
+      body);
+  });
+}
+
+template < typename Backend >
+void launch_plain(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  const int len = data.len;
+  const int teams = len > 0 ? (len + block_size - 1) / block_size : 1;
+  auto body = [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+    RAJA::loop<typename Backend::loop_policy>(ctx, RAJA::TypedRangeSegment<int>(0, len),
+      [&] (int i) { a[i] += 1.0; });
+  };
+
+  time_dispatch<Backend>(state, [&]() {
+    RAJA::launch<typename Backend::launch_policy>(
+      RAJA::LaunchParams(RAJA::Teams(teams), RAJA::Threads(block_size)),
+      body);
+  });
+}
+
+// a WorkGroup of one loop, so the cost of enqueue, instantiate and run
+template < typename Backend >
+void workgroup_one_loop(benchmark::State& state)
+{
+  Data<Backend> data(static_cast<int>(state.range(0)));
+  double* a = data.ptr;
+  auto body = [=] RAJA_HOST_DEVICE (int i) { a[i] += 1.0; };
+
+  using allocator = typename PinnedAllocator<typename Backend::resource>::template std_allocator<char>;
+  using workpool = RAJA::WorkPool<typename Backend::workgroup_policy,
+                                  int, RAJA::xargs<>, allocator>;
+
+  workpool pool(allocator{});
+  pool.reserve(1, 1024);
+
+  time_dispatch<Backend>(state, [&]() {
+    pool.enqueue(RAJA::TypedRangeSegment<int>(0, data.len), body);
+    auto group = pool.instantiate();
+    auto site = group.run();
+  });
+}
+
+} // namespace
+
+//
+// Registration of the benchmarks of one back-end.
+//
+#define RAJA_LAUNCH_OVERHEAD(BACKEND)                                         \
+  BENCHMARK_TEMPLATE(forall_plain, BACKEND)->Arg(0)->Arg(256);                \
+  BENCHMARK_TEMPLATE(forall_no_plugins, BACKEND)->Arg(0)->Arg(256);           \
+  BENCHMARK_TEMPLATE(forall_kernel_name, BACKEND)->Arg(0)->Arg(256);          \
+  BENCHMARK_TEMPLATE(forall_reduce, BACKEND)->Arg(0)->Arg(256);               \
+  BENCHMARK_TEMPLATE(kernel_plain, BACKEND)->Arg(0)->Arg(256);                \
+  BENCHMARK_TEMPLATE(launch_plain, BACKEND)->Arg(0)->Arg(256);                \
+  BENCHMARK_TEMPLATE(workgroup_one_loop, BACKEND)->Arg(0)->Arg(256)
+
+RAJA_LAUNCH_OVERHEAD(Host);
+
+#if defined(RAJA_ENABLE_CUDA)
+RAJA_LAUNCH_OVERHEAD(Cuda<false>);
+RAJA_LAUNCH_OVERHEAD(Cuda<true>);
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+RAJA_LAUNCH_OVERHEAD(Hip<false>);
+RAJA_LAUNCH_OVERHEAD(Hip<true>);
+#endif
+
+BENCHMARK_MAIN();
@@ -19,6 +19,7 @@
 #define VARIANT_C_VIEWS              1
 #define VARIANT_RAJA_SEQ             1
 #define VARIANT_RAJA_SEQ_ARGS        1
+#define VARIANT_RAJA_SEQ_UNROLL      1
 #define VARIANT_RAJA_TEAMS_SEQ       1
 #define VARIANT_RAJA_VECTOR          1
 #define VARIANT_RAJA_MATRIX          1
@@ -37,6 +38,7 @@
 
 #if defined(RAJA_ENABLE_HIP)
 #define RAJA_HIP_KERNEL              1
+#define VARIANT_HIP_TEAMS            1
 #define RAJA_HIP_KERNEL_SHMEM        1
 #endif
 
@@ -49,10 +51,12 @@ extern "C" {
               double *, int * ldc);
 }
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <cmath>
+#include <string>
 #include <vector>
 
 #include "RAJA/RAJA.hpp"
@@ -91,6 +95,18 @@ extern "C" {
  *  are turned off so the example code runs much faster. If you want 
  *  to verify the results are correct, define the 'DEBUG_LTIMES' macro
  *  below or turn on checking for individual variants.
+ *
+ *  The problem size is set on the command line:
+ *
+ *    ltimes.exe [--m moments] [--d directions] [--g groups] [--z zones]
+ *               [--iter iterations] [--peak-gflops host,device]
+ *
+ *  Each variant reports its run time, GFLOP/s and GB/s, where the bytes are
+ *  the minimum traffic of L, psi and phi per iteration, and the fraction of
+ *  the roofline bound min(peak GFLOP/s, arithmetic intensity * bandwidth).
+ *  The bandwidth of the host and of the GPU is measured with a STREAM triad
+ *  at startup. The peak GFLOP/s is not measured, it is only part of the
+ *  bound when given with --peak-gflops.
  */
 
 
@@ -122,56 +138,216 @@ void checkResult(PHIVIEW_T& phi, LVIEW_T& L, PSIVIEW_T& psi,
                  const int num_z);
 
 
+//
+// Command line options
+//
+struct LTimesOptions {
+#ifdef DEBUG_LTIMES
+  // use a decreased number of zones since this will take a lot longer
+  // and we're not really measuring performance here
+  int num_z = 32;
+  int num_iter = 1;
+#else
+  int num_z = 32*65536;
+  int num_iter = 10;
+#endif
+  int num_m = 25;
+  int num_g = 160;
+  int num_d = 80;
+  double host_peak_gflops = 0.0;
+  double device_peak_gflops = 0.0;
+};
+
+LTimesOptions parseOptions(int argc, char** argv)
+{
+  LTimesOptions opts;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    const char* val = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (val == nullptr || arg == "--help") {
+      std::cout << "usage: " << argv[0]
+                << " [--m moments] [--d directions] [--g groups] [--z zones]"
+                   " [--iter iterations] [--peak-gflops host,device]\n";
+      std::exit(arg == "--help" ? 0 : 1);
+    }
+    if (arg == "--m") {
+      opts.num_m = std::atoi(val);
+    } else if (arg == "--d") {
+      opts.num_d = std::atoi(val);
+    } else if (arg == "--g") {
+      opts.num_g = std::atoi(val);
+    } else if (arg == "--z") {
+      opts.num_z = std::atoi(val);
+    } else if (arg == "--iter") {
+      opts.num_iter = std::atoi(val);
+    } else if (arg == "--peak-gflops") {
+      opts.host_peak_gflops = std::atof(val);
+      const char* comma = std::strchr(val, ',');
+      opts.device_peak_gflops = comma ? std::atof(comma + 1) : 0.0;
+    } else {
+      std::cout << "unknown option " << arg << "\n";
+      std::exit(1);
+    }
+    ++i;
+  }
+  return opts;
+}
 
-int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
+//
+// Roofline of a platform, the measured STREAM triad bandwidth and the peak
+// flop rate if given
+//
+struct Roofline {
+  double gbytes_per_sec;
+  double peak_gflops;
+};
+
+//
+// Best of several STREAM triads a[i] = b[i] + s*c[i] with EXEC_POL on
+// arrays of n doubles, in GB/s
+//
+template <typename EXEC_POL>
+double streamTriad(double* a, double* b, double* c, long n,
+                   void (*sync)())
 {
-  std::cout << "\n\nRAJA LTIMES example...\n\n";
+  const double s = 3.0;
+  RAJA::TypedRangeSegment<long> range(0, n);
+  RAJA::forall<EXEC_POL>(range, [=] RAJA_HOST_DEVICE (long i) {
+    a[i] = 0.0; b[i] = 1.0; c[i] = 2.0;
+  });
+  sync();
+
+  double best = 0.0;
+  for (int rep = 0; rep < 5; ++rep) {
+    RAJA::Timer timer;
+    timer.start();
+    RAJA::forall<EXEC_POL>(range, [=] RAJA_HOST_DEVICE (long i) {
+      a[i] = b[i] + s * c[i];
+    });
+    sync();
+    timer.stop();
+    best = std::max(best, 3.0 * sizeof(double) * n / timer.elapsed() / 1.0e9);
+  }
+  return best;
+}
 
-//----------------------------------------------------------------------------//
-// Define array dimensions, allocate arrays, define Layouts and Views, etc.
-  // Note: rand()/RAND_MAX is always zero, but forces the compiler to not
-  // optimize out these values as compile time constants
-  const int num_m = 25 + (rand()/RAND_MAX);
-  const int num_g = 160 + (rand()/RAND_MAX);
-  const int num_d = 80 + (rand()/RAND_MAX);
+void hostSync() {}
 
-#ifdef DEBUG_LTIMES
-  const int num_iter = 1 ; //+ (rand()/RAND_MAX);;
-  // use a decreased number of zones since this will take a lot longer
-  // and we're not really measuring performance here
-  const long num_z = 32 + (rand()/RAND_MAX);
+Roofline measureHostRoofline(double peak_gflops)
+{
+  const long n = 1L << 25;
+  std::vector<double> a(n), b(n), c(n);
+#if defined(RAJA_ENABLE_OPENMP)
+  using EXEC_POL = RAJA::omp_parallel_for_exec;
 #else
-  const int num_iter = 10 + (rand()/RAND_MAX);
-  const int num_z = 32*65536 + (rand()/RAND_MAX);
+  using EXEC_POL = RAJA::loop_exec;
+#endif
+  return Roofline{streamTriad<EXEC_POL>(a.data(), b.data(), c.data(), n,
+                                        hostSync),
+                  peak_gflops};
+}
+
+#if defined(RAJA_ENABLE_CUDA)
+void cudaSync() { cudaErrchk( cudaDeviceSynchronize() ); }
+
+Roofline measureDeviceRoofline(double peak_gflops)
+{
+  const long n = 1L << 26;
+  double* d = nullptr;
+  cudaErrchk( cudaMalloc( (void**)&d, 3 * n * sizeof(double) ) );
+  double bw = streamTriad<RAJA::cuda_exec<256>>(d, d + n, d + 2*n, n,
+                                               cudaSync);
+  cudaErrchk( cudaFree( d ) );
+  return Roofline{bw, peak_gflops};
+}
+#elif defined(RAJA_ENABLE_HIP)
+void hipSync() { hipErrchk( hipDeviceSynchronize() ); }
 
+Roofline measureDeviceRoofline(double peak_gflops)
+{
+  const long n = 1L << 26;
+  double* d = nullptr;
+  hipErrchk( hipMalloc( (void**)&d, 3 * n * sizeof(double) ) );
+  double bw = streamTriad<RAJA::hip_exec<256>>(d, d + n, d + 2*n, n,
+                                              hipSync);
+  hipErrchk( hipFree( d ) );
+  return Roofline{bw, peak_gflops};
+}
 #endif
 
+//
+// Print the run time, rates and fraction of the roofline bound of a variant
+//
+void reportVariant(const char* name, double t,
+                   double total_flops, double total_bytes,
+                   Roofline const& roof)
+{
+  const double gflops = total_flops / t / 1.0e9;
+  const double gbytes = total_bytes / t / 1.0e9;
+  double bound = total_flops / total_bytes * roof.gbytes_per_sec;
+  if (roof.peak_gflops > 0.0) {
+    bound = std::min(bound, roof.peak_gflops);
+  }
+  std::cout << "  " << name << " run time (sec.): " << t
+            << ", GFLOPS/sec: " << gflops
+            << ", GB/sec: " << gbytes
+            << ", % of roofline: " << 100.0 * gflops / bound << std::endl;
+}
+
+
+
+int main(int argc, char **argv)
+{
+  std::cout << "\n\nRAJA LTIMES example...\n\n";
 
+//----------------------------------------------------------------------------//
+// Define array dimensions, allocate arrays, define Layouts and Views, etc.
+  const LTimesOptions opts = parseOptions(argc, argv);
+  const int num_m = opts.num_m;
+  const int num_g = opts.num_g;
+  const int num_d = opts.num_d;
+  const int num_z = opts.num_z;
+  const int num_iter = opts.num_iter;
 
-  double total_flops = 2.0*num_g*num_z*num_d*num_m*num_iter*1000.0;
+  double total_flops = 2.0*num_g*num_z*num_d*num_m*num_iter;
+
+  // each iteration reads L and psi and reads and writes phi at least once
+  double total_bytes = sizeof(double) * num_iter *
+      (double(num_m)*num_d + double(num_d)*num_g*num_z +
+       2.0*num_m*num_g*num_z);
 
   std::cout << "num_m = " << num_m << ", num_g = " << num_g <<
-               ", num_d = " << num_d << ", num_z = " << num_z << "\n\n";
+               ", num_d = " << num_d << ", num_z = " << num_z <<
+               ", num_iter = " << num_iter << "\n\n";
 
   std::cout << "total flops:  " << (long)total_flops << "\n";
+  std::cout << "total bytes:  " << (long)total_bytes << "\n";
+
+  const Roofline host_roof = measureHostRoofline(opts.host_peak_gflops);
+  std::cout << "host STREAM triad GB/sec: " << host_roof.gbytes_per_sec << "\n";
+#if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
+  const Roofline device_roof = measureDeviceRoofline(opts.device_peak_gflops);
+  std::cout << "device STREAM triad GB/sec: " << device_roof.gbytes_per_sec
+            << "\n";
+#endif
 
-  const long L_size   = num_m * num_d;
-  const long psi_size = num_d * num_g * num_z;
-  const long phi_size = num_m * num_g * num_z;
+  const long L_size   = long(num_m) * num_d;
+  const long psi_size = long(num_d) * num_g * num_z;
+  const long phi_size = long(num_m) * num_g * num_z;
 
-  std::vector<double> L_vec(num_m * num_d);
-  std::vector<double> psi_vec(num_d * num_g * num_z);
-  std::vector<double> phi_vec(num_m * num_g * num_z);
+  std::vector<double> L_vec(L_size);
+  std::vector<double> psi_vec(psi_size);
+  std::vector<double> phi_vec(phi_size);
 
   double* L_data   = &L_vec[0];
   double* psi_data = &psi_vec[0];
   double* phi_data = &phi_vec[0];
 
-  for (int i = 0; i < L_size; ++i) {
+  for (long i = 0; i < L_size; ++i) {
     L_data[i] = i+1;
   }
 
-  for (int i = 0; i < psi_size; ++i) {
+  for (long i = 0; i < psi_size; ++i) {
     psi_data[i] = 2*i+1;
   }
 
@@ -213,10 +389,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   }
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  C-version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("C-version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 }
 #endif
@@ -269,10 +443,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   }
 
   timer.stop(); 
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  C-version of LTimes run time (with Views) (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("C-version of LTimes (with Views)", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 
 #if defined(DEBUG_LTIMES)
@@ -342,10 +514,79 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA sequential version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA sequential version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
+
+
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+#if VARIANT_RAJA_SEQ_UNROLL
+{
+  std::cout << "\n Running RAJA sequential unrolled version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  // 
+  // L(m, d) : 1 -> d is stride-1 dimension 
+  using LView = TypedView<double, Layout<2, int, 0>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension 
+  using PsiView = TypedView<double, Layout<3, int, 0>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension 
+  using PhiView = TypedView<double, Layout<3, int, 0>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{1, 0}};
+  LView L(L_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{2, 1, 0}};
+  PsiView psi(psi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{2, 1, 0}};
+  PhiView phi(phi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+  using EXECPOL = 
+    RAJA::KernelPolicy<
+      statement::For<2, loop_exec,  // g
+        statement::For<3, loop_exec,  // z
+         statement::ForUnroll<0, 5,  // m, num_m is a multiple of 5
+           statement::For<1, simd_exec,  // d
+               statement::Lambda<0>
+             >
+           >
+         >
+       >
+     >;
+
+  auto segments = RAJA::make_tuple(RAJA::TypedRangeSegment<IM>(0, num_m),
+                                   RAJA::TypedRangeSegment<ID>(0, num_d),
+                                   RAJA::TypedRangeSegment<IG>(0, num_g),
+                                   RAJA::TypedRangeSegment<IZ>(0, num_z));
+
+  RAJA::Timer timer;
+  timer.start();
+
+  for (int iter = 0;iter < num_iter;++ iter)
+  RAJA::kernel<EXECPOL>( segments,
+    [=] (IM m, ID d, IG g, IZ z) {
+       phi(m, g, z) += L(m, d) * psi(d, g, z);
+    }
+  );
+
+  timer.stop();
+  reportVariant("RAJA sequential unrolled version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 
 #if defined(DEBUG_LTIMES)
@@ -415,10 +656,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA sequential ARGS version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA sequential ARGS version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 
 #if defined(DEBUG_LTIMES)
@@ -489,10 +728,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   } // iter
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA Teams sequential version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA Teams sequential version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 
 #if defined(DEBUG_LTIMES)
@@ -574,10 +811,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA vectorized version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA vectorized version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
   RAJA::tensor_stats::printVectorStats();
@@ -669,10 +904,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   }
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA column-major matrix version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA column-major matrix version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
   RAJA::tensor_stats::printVectorStats();
@@ -757,10 +990,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
     }
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA row-major matrix version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA row-major matrix version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 #ifdef RAJA_ENABLE_VECTOR_STATS
   RAJA::tensor_stats::printVectorStats();
@@ -969,10 +1200,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA sequential shmem version of LTimes run time (sec.): "
-            << t <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA sequential shmem version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 
 #if defined(DEBUG_LTIMES)
@@ -1060,10 +1289,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA OpenMP version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA OpenMP version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, host_roof);
 
 
 #if defined(DEBUG_LTIMES)
@@ -1151,10 +1378,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   cudaErrchk( cudaDeviceSynchronize() );
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA CUDA version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA CUDA version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
 
 
   cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
@@ -1240,7 +1465,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   for (int iter = 0;iter < num_iter;++ iter){
     RAJA::launch<pol_launch>(
         RAJA::ExecPlace::DEVICE,
-        RAJA::LaunchParams(RAJA::Teams(160, 1, 1),
+        RAJA::LaunchParams(RAJA::Teams(num_g, 1, 1),
                               RAJA::Threads(8, 64, 1)),
         [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx)
     {
@@ -1268,10 +1493,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   cudaErrchk( cudaDeviceSynchronize() );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA CUDA Teams version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA CUDA Teams version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
 
 
   cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
@@ -1418,10 +1641,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   cudaErrchk( cudaDeviceSynchronize() );
 
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA CUDA Teams+Matrix version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA CUDA Teams+Matrix version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
 
 
   cudaErrchk( cudaMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
@@ -1658,10 +1879,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   cudaDeviceSynchronize();
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA CUDA + shmem version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA CUDA + shmem version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
 
 
 
@@ -1763,10 +1982,121 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   hipErrchk( hipDeviceSynchronize() );
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA HIP version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA HIP version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
+
+  hipErrchk( hipMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
+                          hipMemcpyDeviceToHost ) );
+
+  hipErrchk( hipFree( dL_data ) );
+  hipErrchk( hipFree( dpsi_data ) );
+  hipErrchk( hipFree( dphi_data ) );
+
+  // Reset data in Views to CPU data
+  L.set_data(L_data);
+  psi.set_data(psi_data);
+  phi.set_data(phi_data);
+
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+#if VARIANT_HIP_TEAMS
+{
+  std::cout << "\n Running RAJA HIP Teams version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  double* dL_data   = nullptr;
+  double* dpsi_data = nullptr;
+  double* dphi_data = nullptr;
+
+  hipErrchk( hipMalloc( (void**)&dL_data, L_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dL_data, L_data, L_size * sizeof(double),
+                         hipMemcpyHostToDevice ) );
+  hipErrchk( hipMalloc( (void**)&dpsi_data, psi_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dpsi_data, psi_data, psi_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+  hipErrchk( hipMalloc( (void**)&dphi_data, phi_size * sizeof(double) ) );
+  hipErrchk( hipMemcpy( dphi_data, phi_data, phi_size * sizeof(double),
+                          hipMemcpyHostToDevice ) );
+
+
+  using pol_launch = RAJA::LaunchPolicy<RAJA::seq_launch_t, RAJA::hip_launch_t<true, 512> >;
+  using pol_g = RAJA::LoopPolicy<RAJA::loop_exec, hip_block_x_loop>;
+  using pol_z = RAJA::LoopPolicy<RAJA::loop_exec, hip_thread_y_loop>;
+  using pol_m = RAJA::LoopPolicy<RAJA::loop_exec, hip_thread_x_loop>;
+  using pol_d = RAJA::LoopPolicy<RAJA::loop_exec, RAJA::loop_exec>;
+
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension
+  using PsiView = TypedView<double, Layout<3, int, 2>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension
+  using PhiView = TypedView<double, Layout<3, int, 2>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(dL_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{0, 1, 2}};
+  PsiView psi(dpsi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{0, 1, 2}};
+  PhiView phi(dphi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+
+  RAJA::Timer timer;
+  hipErrchk( hipDeviceSynchronize() );
+  timer.start();
+
+
+  for (int iter = 0;iter < num_iter;++ iter){
+    RAJA::launch<pol_launch>(
+        RAJA::ExecPlace::DEVICE,
+        RAJA::LaunchParams(RAJA::Teams(num_g, 1, 1),
+                              RAJA::Threads(8, 64, 1)),
+        [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx)
+    {
+      RAJA::loop<pol_g>(ctx, RAJA::TypedRangeSegment<IG>(0, num_g), [&](IG g){
+        RAJA::loop<pol_z>(ctx, RAJA::TypedRangeSegment<IZ>(0, num_z), [&](IZ z){
+          RAJA::loop<pol_m>(ctx, RAJA::TypedRangeSegment<IM>(0, num_m), [&](IM m){
+
+            double acc = phi(m, g, z);
+
+            RAJA::loop<pol_d>(ctx, RAJA::TypedRangeSegment<ID>(0, num_d), [&](ID d){
+
+              acc += L(m, d) * psi(d, g, z);
+
+
+            });
+
+            phi(m,g,z) = acc;
+          });
+        });
+      });
+
+    });
+
+  }
+  hipErrchk( hipDeviceSynchronize() );
+
+  timer.stop();
+  reportVariant("RAJA HIP Teams version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
+
 
   hipErrchk( hipMemcpy( phi_data, dphi_data, phi_size * sizeof(double),
                           hipMemcpyDeviceToHost ) );
@@ -1786,6 +2116,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 }
 #endif
 
+
 //----------------------------------------------------------------------------//
 
 #if RAJA_HIP_KERNEL_SHMEM
@@ -2002,10 +2333,8 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   hipDeviceSynchronize();
   timer.stop();
-  double t = timer.elapsed();
-  double gflop_rate = total_flops / t / 1.0e9;
-  std::cout << "  RAJA HIP + shmem version of LTimes run time (sec.): "
-            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+  reportVariant("RAJA HIP + shmem version of LTimes", timer.elapsed(),
+                total_flops, total_bytes, device_roof);
 
 
 
@@ -0,0 +1,559 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Micro-benchmarks of the RAJA patterns on every enabled back-end:
+///
+///   - launch latency of an empty forall
+///   - streaming triad
+///   - ReduceSum against expt::Reduce
+///   - atomicAdd with a varying number of contended addresses
+///   - inclusive scan and sort
+///   - many small loops as separate foralls against one fused WorkGroup
+///   - overhead of an empty kernel and launch against forall
+///   - shared memory tiles indexed through a runtime Layout against a
+///     static_view, whose index math is constant
+///
+/// The benchmark target runs with --benchmark_out_format=json, so each run
+/// leaves raja-microbench.json behind to compare releases with
+/// tools/compare.py of Google Benchmark.
+///
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+namespace
+{
+
+constexpr int block_size = 256;
+
+//
+// Allocator of pinned host memory for the WorkGroup storage.
+//
+template < typename Resource >
+struct PinnedAllocator
+{
+  template < typename T >
+  struct std_allocator
+  {
+    using value_type = T;
+
+    std_allocator() = default;
+
+    template < typename U >
+    std_allocator(std_allocator<U> const&) noexcept { }
+
+    value_type* allocate(size_t num)
+    {
+      if (num > std::numeric_limits<size_t>::max() / sizeof(value_type)) {
+        throw std::bad_alloc();
+      }
+      value_type* ptr = Resource::get_default().template allocate<value_type>(
+          num, camp::resources::MemoryAccess::Pinned);
+      if (!ptr) {
+        throw std::bad_alloc();
+      }
+      return ptr;
+    }
+
+    void deallocate(value_type* ptr, size_t) noexcept
+    {
+      Resource::get_default().deallocate(ptr,
+                                         camp::resources::MemoryAccess::Pinned);
+    }
+
+    template <typename U>
+    friend inline bool operator==(std_allocator const&, std_allocator<U> const&)
+    {
+      return true;
+    }
+
+    template <typename U>
+    friend inline bool operator!=(std_allocator const& lhs, std_allocator<U> const& rhs)
+    {
+      return !(lhs == rhs);
+    }
+  };
+};
+
+//
+// Policies of each back-end.
+//
+struct Sequential
+{
+  using resource = camp::resources::Host;
+
+  using exec_policy = RAJA::seq_exec;
+  using reduce_policy = RAJA::seq_reduce;
+  using atomic_policy = RAJA::seq_atomic;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::seq_exec>;
+  using team_policy = RAJA::LoopPolicy<RAJA::seq_exec>;
+  using thread_policy = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::seq_work,
+                               RAJA::ordered,
+                               RAJA::ragged_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { }
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+struct OpenMP
+{
+  using resource = camp::resources::Host;
+
+  using exec_policy = RAJA::omp_parallel_for_exec;
+  using reduce_policy = RAJA::omp_reduce;
+  using atomic_policy = RAJA::omp_atomic;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::omp_launch_t>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::omp_for_exec>;
+  using team_policy = RAJA::LoopPolicy<RAJA::omp_for_exec>;
+  using thread_policy = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::omp_work,
+                               RAJA::ordered,
+                               RAJA::ragged_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { }
+};
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+struct Cuda
+{
+  using resource = camp::resources::Cuda;
+
+  using exec_policy = RAJA::cuda_exec<block_size>;
+  using reduce_policy = RAJA::cuda_reduce;
+  using atomic_policy = RAJA::cuda_atomic;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        RAJA::statement::CudaKernelFixed<block_size,
+          RAJA::statement::For<0, RAJA::cuda_global_thread_x,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::cuda_launch_t<false>>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::cuda_global_thread_x>;
+  using team_policy = RAJA::LoopPolicy<RAJA::cuda_block_x_direct>;
+  using thread_policy = RAJA::LoopPolicy<RAJA::cuda_thread_x_loop>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::cuda_work<block_size>,
+                               RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+                               RAJA::constant_stride_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { RAJA::synchronize<RAJA::cuda_synchronize>(); }
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+struct Hip
+{
+  using resource = camp::resources::Hip;
+
+  using exec_policy = RAJA::hip_exec<block_size>;
+  using reduce_policy = RAJA::hip_reduce;
+  using atomic_policy = RAJA::hip_atomic;
+
+  using kernel_policy =
+      RAJA::KernelPolicy<
+        RAJA::statement::HipKernelFixed<block_size,
+          RAJA::statement::For<0, RAJA::hip_global_thread_x,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >;
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::hip_launch_t<false>>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::hip_global_thread_x>;
+  using team_policy = RAJA::LoopPolicy<RAJA::hip_block_x_direct>;
+  using thread_policy = RAJA::LoopPolicy<RAJA::hip_thread_x_loop>;
+
+  using workgroup_policy = RAJA::WorkGroupPolicy<
+                               RAJA::hip_work<block_size>,
+                               RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average,
+                               RAJA::constant_stride_array_of_objects,
+                               RAJA::indirect_function_call_dispatch>;
+
+  static void synchronize() { RAJA::synchronize<RAJA::hip_synchronize>(); }
+};
+#endif
+
+//
+// Memory of a back-end, freed at the end of a benchmark.
+//
+template < typename Backend, typename T >
+struct Array
+{
+  explicit Array(int len)
+    : res(Backend::resource::get_default())
+    , ptr(res.template allocate<T>(len))
+  { }
+
+  ~Array() { res.deallocate(ptr); }
+
+  Array(Array const&) = delete;
+  Array& operator=(Array const&) = delete;
+
+  typename Backend::resource res;
+  T* ptr;
+};
+
+template < typename Backend, typename T >
+void fill(T* ptr, int len, T value)
+{
+  RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+    [=] RAJA_HOST_DEVICE (int i) { ptr[i] = value; });
+}
+
+//
+// Benchmarks.
+//
+template < typename Backend >
+void forall_empty(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+
+  for (auto _ : state) {
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+      [=] RAJA_HOST_DEVICE (int) { });
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+template < typename Backend >
+void triad(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Array<Backend, double> a(len), b(len), c(len);
+  double* pa = a.ptr;
+  double* pb = b.ptr;
+  double* pc = c.ptr;
+  fill<Backend>(pb, len, 1.0);
+  fill<Backend>(pc, len, 2.0);
+  const double scalar = 3.0;
+
+  for (auto _ : state) {
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+      [=] RAJA_HOST_DEVICE (int i) { pa[i] = pb[i] + scalar * pc[i]; });
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * len * sizeof(double));
+}
+
+template < typename Backend >
+void reduce_sum(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Array<Backend, double> a(len);
+  double* pa = a.ptr;
+  fill<Backend>(pa, len, 1.0);
+
+  for (auto _ : state) {
+    RAJA::ReduceSum<typename Backend::reduce_policy, double> sum(0.0);
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+      [=] RAJA_HOST_DEVICE (int i) { sum += pa[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  state.SetBytesProcessed(state.iterations() * len * sizeof(double));
+}
+
+template < typename Backend >
+void reduce_expt(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Array<Backend, double> a(len);
+  double* pa = a.ptr;
+  fill<Backend>(pa, len, 1.0);
+
+  for (auto _ : state) {
+    double sum = 0.0;
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=] RAJA_HOST_DEVICE (int i, double& s) { s += pa[i]; });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * len * sizeof(double));
+}
+
+// range(1) is the number of addresses the atomics are spread over
+template < typename Backend >
+void atomic_add(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  const int bins = static_cast<int>(state.range(1));
+  Array<Backend, double> counts(bins);
+  double* pcounts = counts.ptr;
+  fill<Backend>(pcounts, bins, 0.0);
+
+  for (auto _ : state) {
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+      [=] RAJA_HOST_DEVICE (int i) {
+        RAJA::atomicAdd<typename Backend::atomic_policy>(&pcounts[i % bins], 1.0);
+      });
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+template < typename Backend >
+void scan(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Array<Backend, int> in(len), out(len);
+  fill<Backend>(in.ptr, len, 1);
+
+  for (auto _ : state) {
+    RAJA::inclusive_scan<typename Backend::exec_policy>(
+        RAJA::make_span(in.ptr, len), RAJA::make_span(out.ptr, len));
+    Backend::synchronize();
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+template < typename Backend >
+void sort(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Array<Backend, int> keys(len);
+  int* pkeys = keys.ptr;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+      [=] RAJA_HOST_DEVICE (int i) { pkeys[i] = (i * 7919) % len; });
+    Backend::synchronize();
+    state.ResumeTiming();
+
+    RAJA::sort<typename Backend::exec_policy>(RAJA::make_span(pkeys, len));
+    Backend::synchronize();
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+// range(1) small loops of range(0) iterations each run as separate foralls
+template < typename Backend >
+void small_loops_forall(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  const int loops = static_cast<int>(state.range(1));
+  Array<Backend, double> a(len * loops);
+  double* pa = a.ptr;
+
+  for (auto _ : state) {
+    for (int l = 0; l < loops; ++l) {
+      double* pl = pa + l * len;
+      RAJA::forall<typename Backend::exec_policy>(RAJA::TypedRangeSegment<int>(0, len),
+        [=] RAJA_HOST_DEVICE (int i) { pl[i] = i; });
+    }
+    Backend::synchronize();
+  }
+  state.SetItemsProcessed(state.iterations() * len * loops);
+}
+
+// the same loops fused into one WorkGroup
+template < typename Backend >
+void small_loops_workgroup(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  const int loops = static_cast<int>(state.range(1));
+  Array<Backend, double> a(len * loops);
+  double* pa = a.ptr;
+
+  using allocator = typename PinnedAllocator<typename Backend::resource>::template std_allocator<char>;
+  using workpool = RAJA::WorkPool<typename Backend::workgroup_policy,
+                                  int, RAJA::xargs<>, allocator>;
+
+  workpool pool(allocator{});
+  pool.reserve(loops, 1024ull*1024ull);
+
+  for (auto _ : state) {
+    for (int l = 0; l < loops; ++l) {
+      double* pl = pa + l * len;
+      pool.enqueue(RAJA::TypedRangeSegment<int>(0, len),
+        [=] RAJA_HOST_DEVICE (int i) { pl[i] = i; });
+    }
+    auto group = pool.instantiate();
+    auto site = group.run();
+    Backend::synchronize();
+  }
+  state.SetItemsProcessed(state.iterations() * len * loops);
+}
+
+template < typename Backend >
+void kernel_empty(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+
+  for (auto _ : state) {
+    RAJA::kernel<typename Backend::kernel_policy>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, len)),
+      [=] RAJA_HOST_DEVICE (int) { });
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+template < typename Backend >
+void launch_empty(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  const int teams = (len + block_size - 1) / block_size;
+
+  for (auto _ : state) {
+    RAJA::launch<typename Backend::launch_policy>(
+      RAJA::LaunchParams(RAJA::Teams(teams), RAJA::Threads(block_size)),
+      [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+        RAJA::loop<typename Backend::loop_policy>(ctx, RAJA::TypedRangeSegment<int>(0, len),
+          [&] (int) { });
+      });
+  }
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+// transpose range(0) rows of tile_size x tile_size blocks, one block per
+// team through a shared memory tile indexed by the View TileMaker makes
+constexpr int tile_size = 32;
+
+template < typename Backend, typename TileMaker >
+void tile_transpose(benchmark::State& state)
+{
+  const int rows = static_cast<int>(state.range(0));
+  const int teams = (rows + tile_size - 1) / tile_size;
+  const int len = teams * tile_size * tile_size;
+  Array<Backend, double> a(len), b(len);
+  double* pa = a.ptr;
+  double* pb = b.ptr;
+  fill<Backend>(pa, len, 1.0);
+
+  const size_t shmem = tile_size * tile_size * sizeof(double);
+
+  for (auto _ : state) {
+    RAJA::launch<typename Backend::launch_policy>(
+      RAJA::LaunchParams(RAJA::Teams(teams), RAJA::Threads(block_size), shmem),
+      [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+        RAJA::loop<typename Backend::team_policy>(ctx, RAJA::TypedRangeSegment<int>(0, teams),
+          [&] (int t) {
+            auto tile = TileMaker::make(ctx);
+            const double* in = pa + t * tile_size * tile_size;
+            double* out = pb + t * tile_size * tile_size;
+            RAJA::loop<typename Backend::thread_policy>(ctx, RAJA::TypedRangeSegment<int>(0, tile_size * tile_size),
+              [&] (int i) {
+                tile(i / tile_size, i % tile_size) = in[i];
+              });
+            ctx.teamSync();
+            RAJA::loop<typename Backend::thread_policy>(ctx, RAJA::TypedRangeSegment<int>(0, tile_size * tile_size),
+              [&] (int i) {
+                out[i] = tile(i % tile_size, i / tile_size);
+              });
+            ctx.teamSync();
+            ctx.releaseSharedMemory();
+          });
+      });
+    Backend::synchronize();
+  }
+  state.SetBytesProcessed(state.iterations() * len * 2 * sizeof(double));
+}
+
+// tile with runtime strides held in the View
+struct LayoutTile
+{
+  RAJA_HOST_DEVICE static RAJA::View<double, RAJA::Layout<2>> make(RAJA::LaunchContext& ctx)
+  {
+    return RAJA::View<double, RAJA::Layout<2>>(
+        ctx.getSharedMemory<double>(tile_size * tile_size), tile_size, tile_size);
+  }
+};
+
+// tile with strides of the layout type
+struct StaticTile
+{
+  RAJA_HOST_DEVICE static auto make(RAJA::LaunchContext& ctx)
+  {
+    return RAJA::expt::static_view<double, RAJA::PERM_IJ, tile_size, tile_size>(ctx);
+  }
+};
+
+template < typename Backend >
+void tile_transpose_layout(benchmark::State& state)
+{
+  tile_transpose<Backend, LayoutTile>(state);
+}
+
+template < typename Backend >
+void tile_transpose_static(benchmark::State& state)
+{
+  tile_transpose<Backend, StaticTile>(state);
+}
+
+} // namespace
+
+//
+// Registration of the benchmarks of one back-end.
+//
+#define RAJA_MICROBENCH(BACKEND)                                              \
+  BENCHMARK_TEMPLATE(forall_empty, BACKEND)->Arg(1)->Arg(1 << 10);            \
+  BENCHMARK_TEMPLATE(triad, BACKEND)->RangeMultiplier(16)->Range(1 << 10, 1 << 24); \
+  BENCHMARK_TEMPLATE(reduce_sum, BACKEND)->RangeMultiplier(16)->Range(1 << 10, 1 << 24); \
+  BENCHMARK_TEMPLATE(reduce_expt, BACKEND)->RangeMultiplier(16)->Range(1 << 10, 1 << 24); \
+  BENCHMARK_TEMPLATE(atomic_add, BACKEND)->Args({1 << 20, 1})                 \
+                                         ->Args({1 << 20, 64})                \
+                                         ->Args({1 << 20, 1 << 12});          \
+  BENCHMARK_TEMPLATE(scan, BACKEND)->RangeMultiplier(16)->Range(1 << 10, 1 << 22); \
+  BENCHMARK_TEMPLATE(sort, BACKEND)->RangeMultiplier(16)->Range(1 << 10, 1 << 22); \
+  BENCHMARK_TEMPLATE(small_loops_forall, BACKEND)->Args({256, 64})            \
+                                                 ->Args({4096, 64});          \
+  BENCHMARK_TEMPLATE(small_loops_workgroup, BACKEND)->Args({256, 64})         \
+                                                    ->Args({4096, 64});       \
+  BENCHMARK_TEMPLATE(kernel_empty, BACKEND)->Arg(1)->Arg(1 << 10);            \
+  BENCHMARK_TEMPLATE(launch_empty, BACKEND)->Arg(1)->Arg(1 << 10);            \
+  BENCHMARK_TEMPLATE(tile_transpose_layout, BACKEND)->Arg(1 << 14);           \
+  BENCHMARK_TEMPLATE(tile_transpose_static, BACKEND)->Arg(1 << 14)
+
+RAJA_MICROBENCH(Sequential);
+
+#if defined(RAJA_ENABLE_OPENMP)
+RAJA_MICROBENCH(OpenMP);
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+RAJA_MICROBENCH(Cuda);
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+RAJA_MICROBENCH(Hip);
+#endif
+
+BENCHMARK_MAIN();
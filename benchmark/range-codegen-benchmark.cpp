@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Host forall over a TypedRangeSegment against the same plain C loop.
+///
+/// Host policies lower ranges to a counted integer loop and convert to the
+/// index type of the segment only to call the body, so each forall should
+/// run as fast as the C loop it is compared with, with int indices and
+/// with a strongly typed index (RAJA_INDEX_VALUE_T). A forall that is much
+/// slower than its C loop was not vectorized; build this file with the
+/// vectorization report of the compiler, e.g. -fopt-info-vec with GCC or
+/// -Rpass=loop-vectorize with clang, to see which loops were.
+///
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+namespace
+{
+
+RAJA_INDEX_VALUE_T(StrongIdx, int, "StrongIdx");
+
+struct Data
+{
+  explicit Data(int len) : x(len, 1.0), y(len, 2.0) { }
+
+  std::vector<double> x;
+  std::vector<double> y;
+};
+
+void c_loop(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Data d(len);
+  const double* RAJA_RESTRICT x = d.x.data();
+  double* RAJA_RESTRICT y = d.y.data();
+  const double a = 0.5;
+
+  for (auto _ : state) {
+    for (int i = 0; i < len; ++i) {
+      y[i] += a * x[i];
+    }
+    benchmark::DoNotOptimize(y);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * len * sizeof(double));
+}
+
+void c_loop_simd(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Data d(len);
+  const double* RAJA_RESTRICT x = d.x.data();
+  double* RAJA_RESTRICT y = d.y.data();
+  const double a = 0.5;
+
+  for (auto _ : state) {
+    RAJA_SIMD
+    for (int i = 0; i < len; ++i) {
+      y[i] += a * x[i];
+    }
+    benchmark::DoNotOptimize(y);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * len * sizeof(double));
+}
+
+template < typename Policy >
+void forall_int(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Data d(len);
+  const double* RAJA_RESTRICT x = d.x.data();
+  double* RAJA_RESTRICT y = d.y.data();
+  const double a = 0.5;
+
+  for (auto _ : state) {
+    RAJA::forall<Policy>(RAJA::TypedRangeSegment<int>(0, len),
+      [=] (int i) { y[i] += a * x[i]; });
+    benchmark::DoNotOptimize(y);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * len * sizeof(double));
+}
+
+template < typename Policy >
+void forall_strong(benchmark::State& state)
+{
+  const int len = static_cast<int>(state.range(0));
+  Data d(len);
+  const double* RAJA_RESTRICT x = d.x.data();
+  double* RAJA_RESTRICT y = d.y.data();
+  const double a = 0.5;
+
+  for (auto _ : state) {
+    RAJA::forall<Policy>(RAJA::TypedRangeSegment<StrongIdx>(0, len),
+      [=] (StrongIdx i) { y[*i] += a * x[*i]; });
+    benchmark::DoNotOptimize(y);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * len * sizeof(double));
+}
+
+} // namespace
+
+// loop_exec leaves vectorization to the compiler like the plain C loop,
+// simd_exec and seq_exec_restrict assert independent iterations like
+// RAJA_SIMD does
+BENCHMARK(c_loop)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(c_loop_simd)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(forall_int, RAJA::loop_exec)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(forall_strong, RAJA::loop_exec)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(forall_int, RAJA::simd_exec)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(forall_strong, RAJA::simd_exec)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(forall_int, RAJA::seq_exec_restrict)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(forall_strong, RAJA::seq_exec_restrict)->Arg(1 << 12)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
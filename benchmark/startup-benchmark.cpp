@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Startup time benchmark.
+//
+// Launches many distinct kernel instantiations once, then again, and reports
+// the time of the first and of the repeated launches. With eager module
+// loading all kernels are loaded before main, so the first launches cost
+// about as much as the repeated ones; with CUDA_MODULE_LOADING=LAZY the load
+// of each kernel moves to its first launch and the time before main shrinks.
+// Run the benchmark with both settings to compare, eg.
+//
+//   time CUDA_MODULE_LOADING=EAGER ./benchmark-startup
+//   time CUDA_MODULE_LOADING=LAZY  ./benchmark-startup
+//
+
+#include <cstdlib>
+#include <iostream>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/Timer.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+using forall_policy = RAJA::cuda_exec<256>;
+using kernel_policy = RAJA::KernelPolicy<
+    RAJA::statement::CudaKernelOcc<
+      RAJA::statement::Tile<0, RAJA::tile_fixed<256>, RAJA::cuda_block_x_loop,
+        RAJA::statement::For<0, RAJA::cuda_thread_x_direct,
+          RAJA::statement::Lambda<0>>>>>;
+using resource = RAJA::resources::Cuda;
+#elif defined(RAJA_ENABLE_HIP)
+using forall_policy = RAJA::hip_exec<256>;
+using kernel_policy = RAJA::KernelPolicy<
+    RAJA::statement::HipKernelOcc<
+      RAJA::statement::Tile<0, RAJA::tile_fixed<256>, RAJA::hip_block_x_loop,
+        RAJA::statement::For<0, RAJA::hip_thread_x_direct,
+          RAJA::statement::Lambda<0>>>>>;
+using resource = RAJA::resources::Hip;
+#else
+using forall_policy = RAJA::seq_exec;
+using kernel_policy = RAJA::KernelPolicy<
+    RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>;
+using resource = RAJA::resources::Host;
+#endif
+
+constexpr int num_kernels = 64;
+
+//
+// Each value of I is a different kernel in the binary.
+//
+template <int I>
+void run_forall(double* a, int n)
+{
+  RAJA::forall<forall_policy>(RAJA::TypedRangeSegment<int>(0, n),
+    [=] RAJA_HOST_DEVICE (int i) {
+      a[i] += I;
+  });
+}
+
+template <int I>
+void run_kernel(double* a, int n)
+{
+  RAJA::kernel<kernel_policy>(
+    RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, n)),
+    [=] RAJA_HOST_DEVICE (int i) {
+      a[i] -= I;
+  });
+}
+
+template <camp::idx_t... I>
+void run_all(double* a, int n, camp::idx_seq<I...>)
+{
+  camp::sink((run_forall<I>(a, n), 0)...);
+  camp::sink((run_kernel<I>(a, n), 0)...);
+}
+
+int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
+{
+  std::cout << "\n\nRAJA startup benchmark...\n\n";
+
+  const char* loading = std::getenv("CUDA_MODULE_LOADING");
+  std::cout << "CUDA_MODULE_LOADING = " << (loading ? loading : "(unset)")
+            << "\n";
+  std::cout << "distinct kernels    = " << 2 * num_kernels << "\n\n";
+
+  const int n = 1024 + (rand()/RAND_MAX);
+
+  RAJA::ChronoTimer timer;
+
+  //
+  // Creating the resource and allocating initializes the runtime
+  //
+  timer.start();
+  resource res = resource::get_default();
+  double* a = res.allocate<double>(n);
+  res.memset(a, 0, n * sizeof(double));
+  res.wait();
+  timer.stop();
+  std::cout << "runtime init:      " << timer.elapsed() << " s\n";
+  timer.reset();
+
+  timer.start();
+  run_all(a, n, camp::make_idx_seq_t<num_kernels>{});
+  res.wait();
+  timer.stop();
+  std::cout << "first launches:    " << timer.elapsed() << " s\n";
+  const double first = timer.elapsed();
+  timer.reset();
+
+  timer.start();
+  run_all(a, n, camp::make_idx_seq_t<num_kernels>{});
+  res.wait();
+  timer.stop();
+  std::cout << "repeated launches: " << timer.elapsed() << " s\n";
+  std::cout << "first launch cost: "
+            << (first - timer.elapsed()) / (2 * num_kernels)
+            << " s per kernel\n";
+
+  res.deallocate(a);
+
+  std::cout << "\n DONE!...\n";
+
+  return 0;
+}
@@ -172,24 +172,36 @@ macro(raja_add_test)
 endmacro(raja_add_test)
 
 macro(raja_add_reproducer)
-  set(options )
+  set(options TEST)
   set(singleValueArgs NAME)
-  set(multiValueArgs SOURCES DEPENDS_ON)
+  set(multiValueArgs SOURCES DEPENDS_ON ARGS)
 
   cmake_parse_arguments(arg
     "${options}" "${singleValueArgs}" "${multiValueArgs}" ${ARGN})
 
+  set(original_reproducer_name ${arg_NAME})
+  set(original_reproducer_test ${arg_TEST})
+  set(original_reproducer_args ${arg_ARGS})
+
   raja_add_executable(
     NAME ${arg_NAME}.exe
     SOURCES ${arg_SOURCES}
     DEPENDS_ON ${arg_DEPENDS_ON}
     REPRODUCER On)
+
+  # reproducers that check their result, e.g. against a baseline, also run
+  # as tests
+  if (${original_reproducer_test})
+    blt_add_test(
+      NAME ${original_reproducer_name}
+      COMMAND ${TEST_DRIVER} ${original_reproducer_name} ${original_reproducer_args})
+  endif ()
 endmacro(raja_add_reproducer)
 
 macro(raja_add_benchmark)
   set(options )
   set(singleValueArgs NAME)
-  set(multiValueArgs SOURCES DEPENDS_ON)
+  set(multiValueArgs SOURCES DEPENDS_ON ARGS)
 
   cmake_parse_arguments(arg
     "${options}" "${singleValueArgs}" "${multiValueArgs}" ${ARGN})
@@ -204,5 +216,5 @@ macro(raja_add_benchmark)
 
   blt_add_benchmark(
     NAME ${arg_NAME}
-    COMMAND ${TEST_DRIVER} ${arg_NAME})
+    COMMAND ${TEST_DRIVER} ${arg_NAME} ${arg_ARGS})
 endmacro(raja_add_benchmark)
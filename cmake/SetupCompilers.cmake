@@ -61,6 +61,10 @@ if (RAJA_ENABLE_CUDA)
       endif()
     endif()
   endif()
+
+  if (RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM)
+    set(CMAKE_CUDA_SEPARABLE_COMPILATION On)
+  endif()
 endif()
 # end RAJA_ENABLE_CUDA section
 
@@ -29,6 +29,21 @@ if (RAJA_ENABLE_TBB)
   endif()
 endif ()
 
+if (RAJA_ENABLE_POOL)
+  find_package(Threads REQUIRED)
+  message(STATUS "Thread pool Enabled")
+endif ()
+
+if (RAJA_ENABLE_STDEXEC)
+  find_package(stdexec)
+  if (stdexec_FOUND)
+    message(STATUS "stdexec Enabled")
+  else()
+    message(WARNING "stdexec NOT FOUND")
+    set(RAJA_ENABLE_STDEXEC Off CACHE BOOL "" FORCE)
+  endif()
+endif ()
+
 if (RAJA_ENABLE_CUDA)
   if (RAJA_ENABLE_EXTERNAL_CUB STREQUAL "VersionDependent")
     if (CUDA_VERSION_STRING VERSION_GREATER_EQUAL "11.0")
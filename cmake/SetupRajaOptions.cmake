@@ -12,12 +12,16 @@ option(RAJA_ENABLE_NV_TOOLS_EXT "Build with NV_TOOLS_EXT support" Off)
 option(RAJA_ENABLE_ROCTX "Build with ENABLE_ROCTX support" Off)
 
 option(RAJA_ENABLE_TBB "Build TBB support" Off)
+option(RAJA_ENABLE_POOL "Build persistent thread pool support" Off)
+option(RAJA_ENABLE_STDEXEC "Build std::execution sender adapters with stdexec" Off)
 option(RAJA_ENABLE_TARGET_OPENMP "Build OpenMP on target device support" Off)
 option(RAJA_ENABLE_SYCL "Build SYCL support" Off)
 
 option(RAJA_ENABLE_VECTORIZATION "Build experimental vectorization support" On)
 
 option(RAJA_ENABLE_REPRODUCERS "Build issue reproducers" Off)
+set(RAJA_PERF_REPRODUCER_BASELINE "" CACHE FILEPATH "Baseline JSON of times the performance reproducers compare against, empty to only report times")
+set(RAJA_PERF_REPRODUCER_THRESHOLD 1.2 CACHE STRING "Performance reproducers fail when slower than this many times their baseline")
 
 option(RAJA_ENABLE_EXERCISES "Build exercises " On)
 option(RAJA_ENABLE_WARNINGS "Enable warnings as errors for CI" Off)
@@ -26,12 +30,26 @@ option(RAJA_ENABLE_FORCEINLINE_RECURSIVE "Enable Forceinline recursive (only sup
 
 option(RAJA_DEPRECATED_TESTS "Test deprecated features" Off)
 option(RAJA_ENABLE_BOUNDS_CHECK "Enable bounds checking in RAJA::Views/Layouts" Off)
+option(RAJA_ENABLE_BOUNDS_CHECK_SAMPLED "Enable sampled bounds checking in RAJA::Views/Layouts that records violations instead of aborting" Off)
+set(RAJA_BOUNDS_CHECK_SAMPLE_RATE 64 CACHE STRING "Sampled bounds checks run in one of this many host launches or device threads, a power of 2")
 option(RAJA_TEST_EXHAUSTIVE "Build RAJA exhaustive tests" Off)
 option(RAJA_TEST_OPENMP_TARGET_SUBSET "Build subset of RAJA OpenMP target tests when it is enabled" On)
 option(RAJA_ENABLE_RUNTIME_PLUGINS "Enable support for loading plugins at runtime" Off)
+option(RAJA_ENABLE_PROFILER_PLUGIN "Enable the built-in plugin that times RAJA kernels" Off)
+option(RAJA_ENABLE_TRACE_PLUGIN "Enable the built-in plugin that marks RAJA kernels with trace ranges" Off)
+option(RAJA_ENABLE_COUNTER_PLUGIN "Enable the built-in plugin that reads hardware counters around host kernels" Off)
+option(RAJA_ENABLE_BATCHED_PLUGINS "Enable the built-in plugin that runs batched plugins on a background thread" Off)
+option(RAJA_DISABLE_PLUGINS "Compile plugin calls out of every RAJA pattern" Off)
+option(RAJA_ENABLE_METRICS "Enable the runtime metrics registry and its counters in RAJA internals" Off)
 option(RAJA_ALLOW_INCONSISTENT_OPTIONS "Enable inconsistent values for ENABLE_X and RAJA_ENABLE_X options" Off)
 
 option(RAJA_ENABLE_DESUL_ATOMICS "Enable support of desul atomics" Off)
+option(RAJA_ENABLE_SLAB_MEMPOOL "Use size class slab pools for device and pinned memory pools" Off)
+option(RAJA_ENABLE_PREBUILT "Compile common reducers, memory pools, scans and sorts into the RAJA library" Off)
+option(RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM "Start RAJA::expt::ChildForall loops with CUDA dynamic parallelism tail launches, requires CUDA 12 and relocatable device code" Off)
+option(RAJA_ENABLE_STREAM_ORDERED_ALLOC "Allocate gpu scan and sort temporaries with cudaMallocAsync/hipMallocAsync" Off)
+set(RAJA_CUDA_STAGED_BODY_BYTES 0 CACHE STRING "CUDA forall loop bodies of at least this many bytes are passed to kernels by a pointer to a cached device copy, 0 to pass every body as a kernel parameter")
+set(RAJA_WARN_BODY_BYTES 0 CACHE STRING "Warn at compile time about forall loop bodies of at least this many bytes, 0 for no warnings")
 set(DESUL_ENABLE_TESTS Off CACHE BOOL "")
 
 set(TEST_DRIVER "" CACHE STRING "driver used to wrap test commands")
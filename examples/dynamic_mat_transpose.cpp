@@ -39,6 +39,7 @@
  *    - Basic usage of 'RAJA::launch' abstractions for nested loops
  *    - Hierachial parallism
  *    - Dynamic shared memory
+ *    - Bank conflict free padding of shared memory tiles
  *
  * If CUDA is enabled, CUDA unified memory is used.
  */
@@ -318,7 +319,9 @@ int main(int argc, char *argv[])
 #endif
 
 
-  constexpr size_t dynamic_shared_mem_size = TILE_DIM * TILE_DIM * sizeof(int);
+  // padded so the column reads of the tile do not conflict in shared memory banks
+  constexpr size_t dynamic_shared_mem_size =
+      RAJA::expt::shared_array_size<int, 2>({TILE_DIM, TILE_DIM});
 
   RAJA::launch<launch_policy>
     (select_cpu_or_gpu,
@@ -331,11 +334,9 @@ int main(int argc, char *argv[])
     RAJA::loop<outer1>(ctx, RAJA::RangeSegment(0, outer_Dimr), [&] (int by){
         RAJA::loop<outer0>(ctx, RAJA::RangeSegment(0, outer_Dimc), [&] (int bx){
 
-            //Request memory from shared memory pool
-            int * tile_ptr = ctx.getSharedMemory<int>(TILE_DIM * TILE_DIM);
-
-            //Use RAJA View for simplified indexing
-            RAJA::View<int, RAJA::Layout<2>> Tile(tile_ptr, TILE_DIM, TILE_DIM);
+            //Request a padded tile from the shared memory pool
+            //as a RAJA View for simplified indexing
+            auto Tile = RAJA::expt::shared_array<int, 2>(ctx, {TILE_DIM, TILE_DIM});
 
             RAJA::loop<inner1>(ctx, RAJA::RangeSegment(0, TILE_DIM), [&] (int ty){
               RAJA::loop<inner0>(ctx, RAJA::RangeSegment(0, TILE_DIM), [&] (int tx){
@@ -34,16 +34,17 @@
  * ordering is now used.
  *
  * The scheme is implemented by treating the grid as
- * a checker board and storing the indices of red and
- * black cells in RAJA list segments. The segments are
- * then stored in a RAJA typed index set.
+ * a checker board. The red and black cells are strided
+ * boxes of the grid, so the RAJA typed index set holding
+ * them computes the cell indices instead of storing them.
  *
  * ----[RAJA Concepts]---------------
  * - Forall loop
  * - RAJA Reduction
  * - RAJA::omp_collapse_nowait_exec
- * - RAJA::ListSegment
+ * - RAJA::BoxStrideSegment
  * - RAJA::TypedIndexSet
+ * - RAJA::buildMulticolorIndexSet
  */
 
 /*
@@ -65,8 +66,7 @@ struct grid_s {
 */
 double solution(double x, double y);
 void computeErr(double *I, grid_s grid);
-RAJA::TypedIndexSet<RAJA::ListSegment> 
-  gsColorPolicy(int N, camp::resources::Resource res);
+RAJA::TypedIndexSet<RAJA::BoxStrideSegment> gsColorPolicy(int N);
 
 int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 {
@@ -104,7 +104,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   memset(I, 0, NN * sizeof(double));
 
-  RAJA::TypedIndexSet<RAJA::ListSegment> colorSet = gsColorPolicy(N, resource);
+  RAJA::TypedIndexSet<RAJA::BoxStrideSegment> colorSet = gsColorPolicy(N);
 
   memset(I, 0, NN * sizeof(double));
 
@@ -169,48 +169,19 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 }
 
 //
-//  This function will loop over the red and black cells of a grid
-//  and store the index in a buffer. The buffers will then be used
-//  to generate RAJA ListSegments and populate a RAJA Static Index
-//  Set.
-
-RAJA::TypedIndexSet<RAJA::ListSegment> 
-  gsColorPolicy(int N, camp::resources::Resource res)
+//  This function colors the interior cells of the grid red and black,
+//  as a checker board, and returns a RAJA typed index set holding the
+//  strided boxes of cells of each color, the black cells first.
+//
+RAJA::TypedIndexSet<RAJA::BoxStrideSegment> gsColorPolicy(int N)
 {
-  RAJA::TypedIndexSet<RAJA::ListSegment> colorSet;
-
-  int redN = static_cast<int>( std::ceil( static_cast<double>(N * N / 2) ) );
-  int blkN = static_cast<int>( std::floor( static_cast<double>(N * N / 2) ) );
-  RAJA::Index_type *Red = new RAJA::Index_type[redN];
-  RAJA::Index_type *Blk = new RAJA::Index_type[blkN];
-
-  int ib = 0;
-  int ir = 0;
-
-  bool isRed = true;
+  RAJA::TypedIndexSet<RAJA::BoxStrideSegment> colorSet;
 
-  for (int n = 1; n <= N; ++n) {
-    
-    for (int m = 1; m <= N; ++m) {
-      
-      RAJA::Index_type id = n * (N + 2) + m;
-      if (isRed) {
-        Red[ib] = id;
-        ib++;
-      } else {
-        Blk[ir] = id;
-        ir++;
-      }
-      isRed = !isRed;
-    }
-
-  }
+  RAJA::Index_type begin[] = {1, 1};
+  RAJA::Index_type end[] = {N + 1, N + 1};
+  RAJA::Index_type extent[] = {N + 2, N + 2};
 
-  // Create Index
-  colorSet.push_back(RAJA::ListSegment(Blk, blkN, res));
-  colorSet.push_back(RAJA::ListSegment(Red, redN, res));
-  delete[] Blk;
-  delete[] Red;
+  RAJA::buildMulticolorIndexSet(colorSet, 2, 2, begin, end, extent);
 
   return colorSet;
 }
@@ -29,6 +29,8 @@
 #include "RAJA/config.hpp"
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/CompensatedSum.hpp"
+#include "RAJA/util/DeterministicSum.hpp"
 #include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/camp_aliases.hpp"
 #include "RAJA/util/macros.hpp"
@@ -74,6 +76,10 @@
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_POOL)
+#include "RAJA/policy/pool.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -98,7 +104,10 @@
     #include "RAJA/policy/desul.hpp"
 #endif
 
+#include "RAJA/policy/prebuilt.hpp"
+
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetView.hpp"
 
 //
 // Strongly typed index class
@@ -112,18 +121,30 @@
 //
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
+#include "RAJA/pattern/sender.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
+#include "RAJA/policy/AdaptiveMultiPolicy.hpp"
+#include "RAJA/policy/MultiDevice.hpp"
+#include "RAJA/policy/FaultTolerance.hpp"
 
 
 //
 // Multidimensional layouts and views
 //
 #include "RAJA/util/Layout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
 #include "RAJA/util/View.hpp"
+#include "RAJA/util/ResidentMultiView.hpp"
+#include "RAJA/util/PrivatizedView.hpp"
+#include "RAJA/util/SoAView.hpp"
+#include "RAJA/util/Prefetch.hpp"
+#include "RAJA/util/ScratchBuffer.hpp"
+#include "RAJA/util/StagingPool.hpp"
 
 
 //
@@ -141,6 +162,18 @@
 //
 #include "RAJA/pattern/atomic.hpp"
 
+//
+// Team helpers for launch kernels
+//
+#include "RAJA/pattern/launch/async_copy.hpp"
+#include "RAJA/pattern/launch/child_forall.hpp"
+#include "RAJA/pattern/launch/collectives.hpp"
+#include "RAJA/pattern/launch/histogram.hpp"
+#include "RAJA/pattern/launch/launch_batch.hpp"
+#include "RAJA/pattern/launch/shared_array.hpp"
+#include "RAJA/pattern/launch/team_shared.hpp"
+#include "RAJA/pattern/launch/team_timer.hpp"
+
 //
 // Shared memory view patterns
 //
@@ -155,12 +188,15 @@
 // sort algorithms
 //
 #include "RAJA/util/sort.hpp"
+#include "RAJA/util/simd_sort.hpp"
 
 //
-// WorkPool, WorkGroup, WorkSite objects
+// WorkPool, WorkGroup, WorkSite, WorkQueue objects
 //
 #include "RAJA/policy/WorkGroup.hpp"
 #include "RAJA/pattern/WorkGroup.hpp"
+#include "RAJA/pattern/HaloExchanger.hpp"
+#include "RAJA/pattern/WorkQueue.hpp"
 
 //
 // Reduction objects
@@ -172,6 +208,7 @@
 // Synchronization
 //
 #include "RAJA/pattern/synchronize.hpp"
+#include "RAJA/util/AwaitableEvent.hpp"
 
 //
 //////////////////////////////////////////////////////////////////////
@@ -190,12 +227,25 @@
 #include "RAJA/index/IndexSetBuilders.hpp"
 
 #include "RAJA/pattern/scan.hpp"
-
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
+#include "RAJA/pattern/compact.hpp"
+#include "RAJA/pattern/sweep.hpp"
+#include "RAJA/pattern/temporal_block.hpp"
+#include "RAJA/pattern/spmv.hpp"
+#include "RAJA/index/SegmentBuilders.hpp"
+#include "RAJA/pattern/forall_fused.hpp"
+#include "RAJA/pattern/forall_overlap.hpp"
+#include "RAJA/pattern/stencil_forall.hpp"
+#include "RAJA/pattern/forall_ragged.hpp"
+#include "RAJA/pattern/forall_streamed.hpp"
+#include "RAJA/pattern/lazy.hpp"
+
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS) || defined(RAJA_ENABLE_PROFILER_PLUGIN)
 #include "RAJA/util/PluginLinker.hpp"
 #endif
 
 #include "RAJA/pattern/sort.hpp"
+#include "RAJA/pattern/sort_low_memory.hpp"
+#include "RAJA/index/SegmentReorder.hpp"
 
 namespace RAJA {
 namespace expt{}
@@ -0,0 +1,566 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining bitmask segment classes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BitmaskSegment_HPP
+#define RAJA_BitmaskSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of set bits in x
+RAJA_HOST_DEVICE RAJA_INLINE int popcount64(uint64_t x)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __popcll(x);
+#elif defined(__GNUC__)
+  return __builtin_popcountll(x);
+#else
+  int count = 0;
+  for (; x != 0; x &= x - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+//! position of the lowest set bit of x, x must not be 0
+RAJA_HOST_DEVICE RAJA_INLINE int ctz64(uint64_t x)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __ffsll(static_cast<long long>(x)) - 1;
+#elif defined(__GNUC__)
+  return __builtin_ctzll(x);
+#else
+  int pos = 0;
+  for (; (x & uint64_t(1)) == 0; x >>= 1) {
+    ++pos;
+  }
+  return pos;
+#endif
+}
+
+//! position of set bit number r, counting from the lowest, in x
+RAJA_HOST_DEVICE RAJA_INLINE int select64(uint64_t x, int r)
+{
+  // skip whole bytes, then clear the remaining lower set bits
+  int base = 0;
+  for (int c = popcount64(x & 0xff); r >= c; c = popcount64(x & 0xff)) {
+    r -= c;
+    x >>= 8;
+    base += 8;
+  }
+  for (; r > 0; --r) {
+    x &= x - 1;
+  }
+  return base + ctz64(x);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBitmaskSegment
+ *
+ * \brief  Segment class representing a set of indices by a bitmask over the
+ *         range of indices from its smallest to its largest index.
+ *
+ * The segment stores one bit per index in that range, plus a count of the
+ * set bits before each block of 256 bits and the block that holds each
+ * 256th index.  For a mask of moderate density this is one or two orders of
+ * magnitude less data than a ListSegment, so loops that are bound by
+ * reading their indices run correspondingly faster.
+ *
+ * The indices are visited in increasing order, and repeated indices are
+ * visited once.  Sequential loops visit them by scanning the bits of each
+ * word with count trailing zeros.  Other execution policies access index i
+ * directly, by finding its block from the counts and then its bit in the
+ * block's words.
+ *
+ * Usage:
+ *
+ *   A common C-style loop traversal pattern would be:
+ *
+ * \verbatim
+ *
+ *   const T* indices = ...;
+ *   for (T i = 0; i < len; ++i) {
+ *      // loop body -- use indices[i] as index value
+ *   }
+ *
+ * \endverbatim
+ *
+ *   A TypedBitmaskSegment would be used with a RAJA forall execution
+ *   template as:
+ *
+ * \verbatim
+ *
+ *   TypedBitmaskSegment<T> seg(indices, len, resource);
+ *
+ *   forall<exec_pol>(seg, [=] (T i) {
+ *      // loop body -- use i as index value
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedBitmaskSegment
+{
+public:
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Decodes index i of the segment from its bitmask
+  struct accessor {
+    const uint64_t* words;
+    const Index_type* block_counts;
+    const Index_type* block_of;
+    Index_type first;
+    Index_type num_blocks;
+    Index_type num_block_of;
+
+    RAJA_HOST_DEVICE value_type operator()(Index_type i) const
+    {
+      // the block holding index i is between the blocks holding the
+      // 256th indices around it
+      Index_type e = i >> s_block_of_shift;
+      Index_type lo = block_of[e];
+      Index_type hi = (e + 1 < num_block_of) ? block_of[e + 1] : num_blocks - 1;
+      while (lo < hi) {
+        Index_type mid = (lo + hi + 1) / 2;
+        if (block_counts[mid] <= i) {
+          lo = mid;
+        } else {
+          hi = mid - 1;
+        }
+      }
+
+      Index_type r = i - block_counts[lo];
+      Index_type w = lo * s_block_words;
+      for (int c = detail::popcount64(words[w]); r >= c;
+           c = detail::popcount64(words[w])) {
+        r -= c;
+        ++w;
+      }
+
+      return static_cast<value_type>(
+          first + w * 64 + detail::select64(words[w], static_cast<int>(r)));
+    }
+  };
+
+  //! The underlying iterator type
+  using iterator = Iterators::decoding_iterator<accessor, value_type>;
+
+  //! number of 64 bit words per block of set bit counts
+  static constexpr Index_type s_block_words = 4;
+
+  //! one block lookup entry per 2^s_block_of_shift indices
+  static constexpr int s_block_of_shift = 8;
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a bitmask segment from given array with specified length
+   *        and use given camp resource to allocate the segment data.
+   *
+   * \param values array of indices defining iteration space of segment
+   * \param length number of indices
+   * \param resource camp resource defining memory space where segment data
+   *        live
+   *
+   * The segment holds the distinct values, in increasing order.
+   */
+  TypedBitmaskSegment(const value_type* values,
+                      Index_type length,
+                      camp::resources::Resource resource)
+  {
+    initIndexData(values, length, resource);
+  }
+
+  /*!
+   * \brief Construct a bitmask segment from given container of indices.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where segment data
+   *        live
+   *
+   * The given container must provide methods begin(), end(), and size().
+   *
+   * Constructor assumes container data lives in host memory space.
+   */
+  template <typename Container>
+  TypedBitmaskSegment(const Container& container,
+                      camp::resources::Resource resource)
+  {
+    initIndexData(container.begin(),
+                  static_cast<Index_type>(container.size()),
+                  resource);
+  }
+
+  //! Disable compiler generated constructor
+  TypedBitmaskSegment() = delete;
+
+  //! Copy constructor for bitmask segment
+  //  As this may be called from a lambda in a
+  //  RAJA method we perform a shallow copy
+  RAJA_HOST_DEVICE TypedBitmaskSegment(const TypedBitmaskSegment& other)
+      : m_resource(nullptr),
+        m_owned(Unowned),
+        m_words(other.m_words),
+        m_block_counts(other.m_block_counts),
+        m_block_of(other.m_block_of),
+        m_first(other.m_first),
+        m_num_blocks(other.m_num_blocks),
+        m_num_block_of(other.m_num_block_of),
+        m_size(other.m_size)
+  {
+  }
+
+  //! Copy assignment for bitmask segment
+  //  As this may be called from a lambda in a
+  //  RAJA method we perform a shallow copy
+  RAJA_HOST_DEVICE TypedBitmaskSegment& operator=(
+      const TypedBitmaskSegment& other)
+  {
+    if (this != &other) {
+      clear();
+      m_words = other.m_words;
+      m_block_counts = other.m_block_counts;
+      m_block_of = other.m_block_of;
+      m_first = other.m_first;
+      m_num_blocks = other.m_num_blocks;
+      m_num_block_of = other.m_num_block_of;
+      m_size = other.m_size;
+    }
+    return *this;
+  }
+
+  //! Move constructor for bitmask segment
+  RAJA_HOST_DEVICE TypedBitmaskSegment(TypedBitmaskSegment&& rhs)
+      : TypedBitmaskSegment(static_cast<const TypedBitmaskSegment&>(rhs))
+  {
+    m_resource = rhs.m_resource;
+    m_owned = rhs.m_owned;
+    rhs.m_resource = nullptr;
+    rhs.m_owned = Unowned;
+    rhs.clear();
+  }
+
+  //! Bitmask segment destructor
+  RAJA_HOST_DEVICE ~TypedBitmaskSegment() { clear(); }
+
+  //! Clear method to be called
+  RAJA_HOST_DEVICE void clear()
+  {
+#if !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    if (m_words != nullptr && m_owned == Owned) {
+      m_resource->deallocate(m_words);
+      m_resource->deallocate(m_block_counts);
+      m_resource->deallocate(m_block_of);
+      delete m_resource;
+    }
+#endif
+    m_resource = nullptr;
+    m_owned = Unowned;
+    m_words = nullptr;
+    m_block_counts = nullptr;
+    m_block_of = nullptr;
+    m_first = 0;
+    m_num_blocks = 0;
+    m_num_block_of = 0;
+    m_size = 0;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const { return iterator(get_accessor(), 0); }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(get_accessor(), m_size);
+  }
+
+  /*!
+   * \brief Get size of this segment (number of indices)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get ownership of segment data (Owned/Unowned)
+   */
+  RAJA_HOST_DEVICE IndexOwnership getIndexOwnership() const { return m_owned; }
+
+  /*!
+   * \brief Number of bytes of segment data
+   */
+  RAJA_HOST_DEVICE size_t getStorageBytes() const
+  {
+    return sizeof(uint64_t) * m_num_blocks * s_block_words +
+           sizeof(Index_type) * (m_num_blocks + m_num_block_of);
+  }
+
+  /*!
+   * \brief Call body(index) for each index of the segment, in order.
+   *
+   * Walks the set bits of each word, so the segment data must live in host
+   * memory space.
+   */
+  template <typename Body>
+  void for_each_index(Body&& body) const
+  {
+    Index_type num_words = m_num_blocks * s_block_words;
+    for (Index_type w = 0; w < num_words; ++w) {
+      for (uint64_t bits = m_words[w]; bits != 0; bits &= bits - 1) {
+        body(static_cast<value_type>(m_first + w * 64 +
+                                     detail::ctz64(bits)));
+      }
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments have the same indices, else false
+   *
+   * Method assumes data in both segments live in host memory space.
+   */
+  bool operator==(const TypedBitmaskSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    for (Index_type i = 0; i < m_size; ++i) {
+      if (begin()[i] != other.begin()[i]) return false;
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  bool operator!=(const TypedBitmaskSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedBitmaskSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_owned, other.m_owned);
+    camp::safe_swap(m_words, other.m_words);
+    camp::safe_swap(m_block_counts, other.m_block_counts);
+    camp::safe_swap(m_block_of, other.m_block_of);
+    camp::safe_swap(m_first, other.m_first);
+    camp::safe_swap(m_num_blocks, other.m_num_blocks);
+    camp::safe_swap(m_num_block_of, other.m_num_block_of);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+private:
+  RAJA_HOST_DEVICE accessor get_accessor() const
+  {
+    return accessor{m_words,
+                    m_block_counts,
+                    m_block_of,
+                    m_first,
+                    m_num_blocks,
+                    m_num_block_of};
+  }
+
+  //
+  // Build the bitmask and block tables on the host and copy them to the
+  // memory space of the resource.
+  //
+  template <typename Iter>
+  void initIndexData(Iter values,
+                     Index_type len,
+                     camp::resources::Resource resource_)
+  {
+    if (len <= 0) {
+      return;
+    }
+
+    Index_type lo = static_cast<Index_type>(stripIndexType(values[0]));
+    Index_type hi = lo;
+    for (Index_type i = 1; i < len; ++i) {
+      Index_type v = static_cast<Index_type>(stripIndexType(values[i]));
+      lo = (v < lo) ? v : lo;
+      hi = (v > hi) ? v : hi;
+    }
+
+    m_first = lo;
+    Index_type num_words = (hi - lo) / 64 + 1;
+    m_num_blocks = (num_words + s_block_words - 1) / s_block_words;
+    num_words = m_num_blocks * s_block_words;
+
+    camp::resources::Resource host_res{camp::resources::Host()};
+
+    uint64_t* words = host_res.allocate<uint64_t>(num_words);
+    for (Index_type w = 0; w < num_words; ++w) {
+      words[w] = 0;
+    }
+    for (Index_type i = 0; i < len; ++i) {
+      Index_type bit = static_cast<Index_type>(stripIndexType(values[i])) - lo;
+      words[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+
+    Index_type* block_counts = host_res.allocate<Index_type>(m_num_blocks);
+    m_size = 0;
+    for (Index_type b = 0; b < m_num_blocks; ++b) {
+      block_counts[b] = m_size;
+      for (Index_type w = b * s_block_words; w < (b + 1) * s_block_words;
+           ++w) {
+        m_size += detail::popcount64(words[w]);
+      }
+    }
+
+    m_num_block_of = ((m_size - 1) >> s_block_of_shift) + 1;
+    Index_type* block_of = host_res.allocate<Index_type>(m_num_block_of);
+    Index_type e = 0;
+    for (Index_type b = 0; b < m_num_blocks; ++b) {
+      Index_type block_end =
+          (b + 1 < m_num_blocks) ? block_counts[b + 1] : m_size;
+      while (e < m_num_block_of && (e << s_block_of_shift) < block_end) {
+        block_of[e++] = b;
+      }
+    }
+
+    m_resource = new camp::resources::Resource(resource_);
+    m_owned = Owned;
+    m_words = m_resource->allocate<uint64_t>(num_words);
+    m_block_counts = m_resource->allocate<Index_type>(m_num_blocks);
+    m_block_of = m_resource->allocate<Index_type>(m_num_block_of);
+    m_resource->memcpy(m_words, words, sizeof(uint64_t) * num_words);
+    m_resource->memcpy(m_block_counts,
+                       block_counts,
+                       sizeof(Index_type) * m_num_blocks);
+    m_resource->memcpy(m_block_of,
+                       block_of,
+                       sizeof(Index_type) * m_num_block_of);
+
+    host_res.deallocate(words);
+    host_res.deallocate(block_counts);
+    host_res.deallocate(block_of);
+  }
+
+
+  // Copy of camp resource passed to ctor
+  camp::resources::Resource* m_resource = nullptr;
+
+  // Ownership flag to guide data management
+  IndexOwnership m_owned = Unowned;
+
+  // One bit per index from m_first, padded to whole blocks
+  uint64_t* m_words = nullptr;
+
+  // Number of indices before each block of s_block_words words
+  Index_type* m_block_counts = nullptr;
+
+  // Block holding every 2^s_block_of_shift-th index
+  Index_type* m_block_of = nullptr;
+
+  // Smallest index, the index of bit 0
+  Index_type m_first = 0;
+
+  Index_type m_num_blocks = 0;
+
+  Index_type m_num_block_of = 0;
+
+  // Number of indices
+  Index_type m_size = 0;
+};
+
+template <typename StorageT>
+constexpr Index_type TypedBitmaskSegment<StorageT>::s_block_words;
+template <typename StorageT>
+constexpr int TypedBitmaskSegment<StorageT>::s_block_of_shift;
+
+//! Alias for A TypedBitmaskSegment<Index_type>
+using BitmaskSegment = TypedBitmaskSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename StorageT>
+struct is_compressed_segment<TypedBitmaskSegment<StorageT>> : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBitmaskSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedBitmaskSegment<StorageT>& a,
+                      RAJA::TypedBitmaskSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,247 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the multi-dimensional box segment.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BoxSegment_HPP
+#define RAJA_BoxSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBoxSegment
+ *
+ * \brief  Segment class representing the product of DIM stride-1 ranges,
+ *         for forall loops with a loop body taking DIM indices.
+ *
+ * The backend picks how the points are mapped to threads: sequential
+ * policies walk the box in tiles, other policies flatten it into one range,
+ * as an OpenMP collapse clause would, and recover the indices with fast
+ * division. The last dimension is the fastest in both cases.
+ *
+ * Usage:
+ *
+ *   A common C-style loop traversal pattern would be:
+ *
+ * \verbatim
+ *
+ *   for (T i = ibegin; i < iend; ++i) {
+ *     for (T j = jbegin; j < jend; ++j) {
+ *       for (T k = kbegin; k < kend; ++k) {
+ *         // loop body -- use i, j, k as index values
+ *       }
+ *     }
+ *   }
+ *
+ * \endverbatim
+ *
+ *   A TypedBoxSegment would be used with a RAJA forall execution template
+ *   as:
+ *
+ * \verbatim
+ *
+ *   TypedBoxSegment<3, T> box(TypedRangeSegment<T>(ibegin, iend),
+ *                             TypedRangeSegment<T>(jbegin, jend),
+ *                             TypedRangeSegment<T>(kbegin, kend));
+ *
+ *   forall<exec_pol>(box, [=] (T i, T j, T k) {
+ *      // loop body -- use i, j, k as index values
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <int DIM, typename StorageT = Index_type>
+class TypedBoxSegment
+{
+  static_assert(DIM >= 1 && DIM <= 3, "TypedBoxSegment has 1 to 3 dimensions");
+
+public:
+
+  //! Number of dimensions
+  static constexpr int num_dims = DIM;
+
+  //! Tile size of the dimensions other than the last, which is not tiled
+  static constexpr Index_type default_tile_size = 16;
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type of each index
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //@}
+
+  //@{
+  //!   @name Constructors, destructor, and copy assignment.
+
+  /*!
+   * \brief Construct a box segment from one range segment per dimension
+   */
+  template <typename... Ranges,
+            typename = concepts::enable_if<
+                std::integral_constant<bool, sizeof...(Ranges) == DIM>,
+                std::is_convertible<Ranges const&,
+                                    TypedRangeSegment<StorageT>>...>>
+  TypedBoxSegment(Ranges const&... ranges)
+  {
+    TypedRangeSegment<StorageT> const r[] = {ranges...};
+    for (int d = 0; d < DIM; ++d) {
+      m_begin[d] = static_cast<Index_type>(stripIndexType(*r[d].begin()));
+      m_extent[d] = static_cast<Index_type>(r[d].size());
+      m_tile_size[d] = d < DIM - 1 ? default_tile_size : m_extent[d];
+    }
+  }
+
+  //! Disable compiler generated constructor
+  TypedBoxSegment() = delete;
+
+  //! Defaulted copy constructor
+  TypedBoxSegment(TypedBoxSegment const&) = default;
+
+  //! Defaulted copy assignment operator
+  TypedBoxSegment& operator=(TypedBoxSegment const&) = default;
+
+  //! Defaulted destructor
+  ~TypedBoxSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get number of points of this segment
+   */
+  RAJA_HOST_DEVICE Index_type size() const
+  {
+    Index_type size = 1;
+    for (int d = 0; d < DIM; ++d) {
+      size *= m_extent[d];
+    }
+    return size;
+  }
+
+  /*!
+   * \brief Get first index of dimension d
+   */
+  RAJA_HOST_DEVICE Index_type getBegin(int d) const { return m_begin[d]; }
+
+  /*!
+   * \brief Get number of indices of dimension d
+   */
+  RAJA_HOST_DEVICE Index_type getExtent(int d) const { return m_extent[d]; }
+
+  /*!
+   * \brief Get tile size of dimension d used by sequential policies
+   */
+  RAJA_HOST_DEVICE Index_type getTileSize(int d) const
+  {
+    return m_tile_size[d];
+  }
+
+  /*!
+   * \brief Set tile size of dimension d used by sequential policies
+   */
+  void setTileSize(int d, Index_type tile_size)
+  {
+    m_tile_size[d] = tile_size > 0 ? tile_size : 1;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if the ranges of all dimensions match, else false
+   */
+  RAJA_HOST_DEVICE bool operator==(TypedBoxSegment const& o) const
+  {
+    for (int d = 0; d < DIM; ++d) {
+      if (m_begin[d] != o.m_begin[d] || m_extent[d] != o.m_extent[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  RAJA_HOST_DEVICE bool operator!=(TypedBoxSegment const& o) const
+  {
+    return !(operator==(o));
+  }
+
+  //@}
+
+private:
+  // First index of each dimension
+  Index_type m_begin[DIM];
+
+  // Number of indices of each dimension
+  Index_type m_extent[DIM];
+
+  // Tile size of each dimension for sequential policies
+  Index_type m_tile_size[DIM];
+};
+
+template <int DIM, typename StorageT>
+constexpr int TypedBoxSegment<DIM, StorageT>::num_dims;
+
+template <int DIM, typename StorageT>
+constexpr Index_type TypedBoxSegment<DIM, StorageT>::default_tile_size;
+
+//! Alias for TypedBoxSegment<DIM, Index_type>
+template <int DIM>
+using BoxSegment = TypedBoxSegment<DIM, Index_type>;
+
+namespace type_traits
+{
+
+//! True for multi-dimensional box segments
+template <typename T>
+struct is_box_segment : std::false_type {
+};
+
+template <int DIM, typename StorageT>
+struct is_box_segment<TypedBoxSegment<DIM, StorageT>> : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,294 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the strided box segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BoxStrideSegment_HPP
+#define RAJA_BoxStrideSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "camp/helpers.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedBoxStrideSegment
+ *
+ * \brief  Segment class representing the points of a box of up to three
+ *         dimensions, taken with a positive stride in each dimension, as
+ *         linear indices of a row-major array.
+ *
+ * Index i of the segment is computed from i, so the segment stores no
+ * index data and can be used with any execution policy. The points are
+ * visited with the last dimension fastest.
+ *
+ * Usage:
+ *
+ *   A common C-style loop traversal pattern would be:
+ *
+ * \verbatim
+ *
+ *   for (T j = jbegin; j < jend; j += jstride) {
+ *     for (T i = ibegin; i < iend; i += istride) {
+ *       T id = j * nx + i;
+ *       // loop body -- use id as index value
+ *     }
+ *   }
+ *
+ * \endverbatim
+ *
+ *   A TypedBoxStrideSegment would be used with a RAJA forall execution
+ *   template as:
+ *
+ * \verbatim
+ *
+ *   TypedBoxStrideSegment<T> seg({{jbegin, ibegin}},
+ *                                {{jend, iend}},
+ *                                {{jstride, istride}},
+ *                                {{nx, 1}});
+ *
+ *   forall<exec_pol>(seg, [=] (T id) {
+ *      // loop body -- use id as index value
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedBoxStrideSegment
+{
+public:
+
+  //! Most dimensions of a box
+  static constexpr int max_dims = 3;
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Computes index i of the segment from the position of its point
+  struct accessor {
+    Index_type first;
+    Index_type count[max_dims];
+    Index_type step[max_dims];
+    int num_dims;
+
+    RAJA_HOST_DEVICE value_type operator()(Index_type i) const
+    {
+      Index_type value = first;
+      for (int d = num_dims - 1; d > 0; --d) {
+        value += (i % count[d]) * step[d];
+        i /= count[d];
+      }
+      return static_cast<value_type>(value + i * step[0]);
+    }
+  };
+
+  //! The underlying iterator type
+  using iterator = Iterators::decoding_iterator<accessor, value_type>;
+
+  //@}
+
+  //@{
+  //!   @name Constructors, destructor, and copy assignment.
+
+  /*!
+   * \brief Construct a segment for the points begin + n * stride below end
+   *        in each of num_dims dimensions.
+   *
+   * \param num_dims number of dimensions, 1 to max_dims
+   * \param begin first coordinate in each dimension
+   * \param end end coordinate (exclusive) in each dimension
+   * \param stride positive stride in each dimension
+   * \param array_stride distance between linear indices of neighboring
+   *        points of the array in each dimension
+   */
+  RAJA_HOST_DEVICE TypedBoxStrideSegment(int num_dims,
+                                         const Index_type* begin,
+                                         const Index_type* end,
+                                         const Index_type* stride,
+                                         const Index_type* array_stride)
+  {
+    m_acc.first = 0;
+    m_acc.num_dims = num_dims;
+    m_size = 1;
+    for (int d = 0; d < max_dims; ++d) {
+      if (d < num_dims) {
+        Index_type count = RAJA_DIVIDE_CEILING_INT(end[d] - begin[d],
+                                                   stride[d]);
+        m_acc.count[d] = count > 0 ? count : 0;
+        m_acc.step[d] = stride[d] * array_stride[d];
+        m_acc.first += begin[d] * array_stride[d];
+        m_size *= m_acc.count[d];
+      } else {
+        m_acc.count[d] = 1;
+        m_acc.step[d] = 0;
+      }
+    }
+  }
+
+  /*!
+   * \brief Construct a segment for the points begin + n * stride below end
+   *        in each of DIM dimensions.
+   */
+  template <size_t DIM>
+  TypedBoxStrideSegment(std::array<Index_type, DIM> const& begin,
+                        std::array<Index_type, DIM> const& end,
+                        std::array<Index_type, DIM> const& stride,
+                        std::array<Index_type, DIM> const& array_stride)
+      : TypedBoxStrideSegment(static_cast<int>(DIM),
+                              begin.data(),
+                              end.data(),
+                              stride.data(),
+                              array_stride.data())
+  {
+    static_assert(DIM >= 1 && DIM <= max_dims,
+                  "TypedBoxStrideSegment has 1 to 3 dimensions");
+  }
+
+  //! Disable compiler generated constructor
+  TypedBoxStrideSegment() = delete;
+
+  //! Defaulted copy constructor
+  TypedBoxStrideSegment(TypedBoxStrideSegment const&) = default;
+
+  //! Defaulted copy assignment operator
+  TypedBoxStrideSegment& operator=(TypedBoxStrideSegment const&) = default;
+
+  //! Defaulted destructor
+  ~TypedBoxStrideSegment() = default;
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const { return iterator(m_acc, 0); }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const { return iterator(m_acc, m_size); }
+
+  /*!
+   * \brief Get size of this segment (number of points)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get number of dimensions of the box
+   */
+  RAJA_HOST_DEVICE int getNumDims() const { return m_acc.num_dims; }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments visit the same indices in the same
+   *         order, else false
+   */
+  RAJA_HOST_DEVICE bool operator==(TypedBoxStrideSegment const& o) const
+  {
+    if (m_size != o.m_size || m_acc.num_dims != o.m_acc.num_dims) {
+      return false;
+    }
+    if (m_size == 0) {
+      return true;
+    }
+    if (m_acc.first != o.m_acc.first) {
+      return false;
+    }
+    for (int d = 0; d < m_acc.num_dims; ++d) {
+      if (m_acc.count[d] != o.m_acc.count[d] ||
+          m_acc.step[d] != o.m_acc.step[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  RAJA_HOST_DEVICE bool operator!=(TypedBoxStrideSegment const& o) const
+  {
+    return !(operator==(o));
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedBoxStrideSegment& other)
+  {
+    camp::safe_swap(m_acc, other.m_acc);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+private:
+  // Linear index of the first point, and count and step of each dimension
+  accessor m_acc;
+
+  // Number of points
+  Index_type m_size;
+};
+
+template <typename StorageT>
+constexpr int TypedBoxStrideSegment<StorageT>::max_dims;
+
+//! Alias for TypedBoxStrideSegment<Index_type>
+using BoxStrideSegment = TypedBoxStrideSegment<Index_type>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedBoxStrideSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedBoxStrideSegment<StorageT>& a,
+                      RAJA::TypedBoxStrideSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
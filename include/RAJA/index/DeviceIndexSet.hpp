@@ -0,0 +1,182 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an index set with a device-resident
+ *          segment table.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_DeviceIndexSet_HPP
+#define RAJA_DeviceIndexSet_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+
+#include "RAJA/pattern/detail/fused_segments.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedDeviceIndexSet
+ *
+ * \brief  Index set whose segment table is built once and kept in the
+ *         memory of a camp resource, for fused segment iteration policies.
+ *
+ * Running an index set with ExecPolicy<cuda_segit_fused, ...> or
+ * ExecPolicy<hip_segit_fused, ...> builds a table of segment descriptors on
+ * the host and copies it to the device on every forall. A
+ * TypedDeviceIndexSet keeps the table resident, one per block size used,
+ * so later loops over the same segments launch one kernel with no host
+ * work or copies.
+ *
+ * The descriptors point into the segments of the index set, which must
+ * outlive this object and must not change while it is used. The tables
+ * are built lazily and are not thread-safe to build concurrently.
+ *
+ * Usage:
+ *
+ * \verbatim
+ *
+ *   TypedIndexSet<RangeSegment, ListSegment> iset;
+ *   ...
+ *   TypedDeviceIndexSet<RangeSegment, ListSegment> resident(iset, cuda_res);
+ *
+ *   for (int step = 0; step < nsteps; ++step) {
+ *     forall<ExecPolicy<cuda_segit_fused, cuda_exec<256>>>(resident,
+ *       [=] RAJA_DEVICE (Index_type i) {
+ *         // loop body
+ *     });
+ *   }
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename... SegmentTypes>
+class TypedDeviceIndexSet
+{
+public:
+  //! The index set type whose segments are described
+  using index_set_type = TypedIndexSet<SegmentTypes...>;
+
+  //! The value type of the segments
+  using value_type = typename index_set_type::value_type;
+
+  //! The table type used in kernels
+  using table_type = detail::FusedSegmentTable<SegmentTypes...>;
+
+  //! A resident table for one block size
+  struct Entry {
+    Index_type block_size;
+    Index_type num_blocks;
+    char* data;
+    table_type table;
+  };
+
+  /*!
+   * \brief Describe the segments of iset, allocating tables with resource.
+   */
+  TypedDeviceIndexSet(index_set_type const& iset,
+                      camp::resources::Resource resource)
+      : m_iset(&iset), m_resource(resource)
+  {
+  }
+
+  //! Tables are owned, so copies are not allowed
+  TypedDeviceIndexSet(TypedDeviceIndexSet const&) = delete;
+  TypedDeviceIndexSet& operator=(TypedDeviceIndexSet const&) = delete;
+
+  //! Free the resident tables
+  ~TypedDeviceIndexSet() { clear(); }
+
+  //! Free the resident tables, they are rebuilt when next used
+  void clear()
+  {
+    for (Entry& e : m_entries) {
+      if (e.data != nullptr) {
+        m_resource.deallocate(e.data);
+      }
+    }
+    m_entries.clear();
+  }
+
+  /*!
+   * \brief Get the resident table for blocks of block_size threads,
+   *        building and copying it to the resource on first use.
+   */
+  Entry getTable(Index_type block_size) const
+  {
+    for (Entry const& e : m_entries) {
+      if (e.block_size == block_size) {
+        return e;
+      }
+    }
+
+    detail::FusedSegmentTableBuilder<SegmentTypes...> builder(*m_iset,
+                                                              block_size);
+    Entry e;
+    e.block_size = block_size;
+    e.num_blocks = builder.num_blocks();
+    e.data = nullptr;
+    if (builder.bytes() > 0) {
+      e.data = m_resource.allocate<char>(builder.bytes());
+      m_resource.memcpy(e.data, builder.data(), builder.bytes());
+      m_resource.wait();
+    }
+    e.table = builder.table(e.data);
+    m_entries.push_back(e);
+    return e;
+  }
+
+  //! Get the described index set
+  index_set_type const& getIndexSet() const { return *m_iset; }
+
+  //! Return the number of segments
+  size_t getNumSegments() const { return m_iset->getNumSegments(); }
+
+  //! Return the number of indices in all segments
+  size_t getLength() const { return m_iset->getLength(); }
+
+private:
+  index_set_type const* m_iset;
+
+  mutable camp::resources::Resource m_resource;
+
+  mutable std::vector<Entry> m_entries;
+};
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_device_index_set
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedDeviceIndexSet,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
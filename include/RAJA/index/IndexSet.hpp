@@ -20,8 +20,11 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/index/BitmaskSegment.hpp"
+#include "RAJA/index/BoxStrideSegment.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/index/RunLengthSegment.hpp"
 
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
@@ -37,6 +40,13 @@ namespace RAJA
 enum PushEnd { PUSH_FRONT, PUSH_BACK };
 enum PushCopy { PUSH_COPY, PUSH_NOCOPY };
 
+//! Number of segments an index set holds without allocating
+constexpr size_t IndexSetInlineSegments = 8;
+
+//! Vector holding one entry per segment of an index set
+template <typename T>
+using IndexSetVec = RAJA::RAJAVec<T, std::allocator<T>, IndexSetInlineSegments>;
+
 template <typename... TALL>
 class TypedIndexSet;
 
@@ -111,6 +121,17 @@ public:
     owner.resize(num, 0);
   }
 
+  //! Move-constructor for index set, taking ownership of owned segments
+  RAJA_INLINE
+  TypedIndexSet(TypedIndexSet<T0, TREST...> &&c)
+      : PARENT(std::move((PARENT &)c)),
+        data(std::move(c.data)),
+        owner(std::move(c.owner)),
+        m_seg_interval_begin(std::move(c.m_seg_interval_begin)),
+        m_seg_interval_end(std::move(c.m_seg_interval_end))
+  {
+  }
+
   //! Copy-assignment operator for index set
   TypedIndexSet<T0, TREST...> &operator=(const TypedIndexSet<T0, TREST...> &rhs)
   {
@@ -121,6 +142,16 @@ public:
     return *this;
   }
 
+  //! Move-assignment operator for index set
+  TypedIndexSet<T0, TREST...> &operator=(TypedIndexSet<T0, TREST...> &&rhs)
+  {
+    if (&rhs != this) {
+      TypedIndexSet<T0, TREST...> moved(std::move(rhs));
+      this->swap(moved);
+    }
+    return *this;
+  }
+
   //! Destroy index set including all index set segments.
   RAJA_INLINE ~TypedIndexSet()
   {
@@ -142,6 +173,8 @@ public:
     using std::swap;
     swap(data, other.data);
     swap(owner, other.owner);
+    swap(m_seg_interval_begin, other.m_seg_interval_begin);
+    swap(m_seg_interval_end, other.m_seg_interval_end);
   }
 
   ///
@@ -431,7 +464,9 @@ public:
   /// segments in this TypedIndexSet with ids in the interval [begin, end).
   ///
   /// This TypedIndexSet will not change and the created "slice" into it
-  /// will not own any of its segments.
+  /// will not own any of its segments. Slices of up to
+  /// IndexSetInlineSegments segments are built without heap allocation
+  /// and are moved, not copied, out of the createSlice methods.
   ///
   TypedIndexSet<T0, TREST...> createSlice(int begin, int end)
   {
@@ -509,37 +544,37 @@ public:
 
 protected:
   //! Returns the mapping of  segment_index -> segment_type
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentTypes()
   {
     return PARENT::getSegmentTypes();
   }
 
   //! Returns the mapping of  segment_index -> segment_type
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentTypes() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentTypes() const
   {
     return PARENT::getSegmentTypes();
   }
 
   //! Returns the mapping of  segment_index -> segment_offset
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentOffsets()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentOffsets()
   {
     return PARENT::getSegmentOffsets();
   }
 
   //! Returns the mapping of  segment_index -> segment_offset
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentOffsets() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentOffsets() const
   {
     return PARENT::getSegmentOffsets();
   }
 
   //! Returns the icount of segments
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentIcounts()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentIcounts()
   {
     return PARENT::getSegmentIcounts();
   }
 
   //! Returns the icount of segments
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentIcounts() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentIcounts() const
   {
     return PARENT::getSegmentIcounts();
   }
@@ -574,10 +609,10 @@ public:
 
 private:
   //! vector of TypedIndexSet data objects of type T0
-  RAJA::RAJAVec<T0 *> data;
+  RAJA::IndexSetVec<T0 *> data;
 
   //! vector indicating which segments are owned by the TypedIndexSet
-  RAJA::RAJAVec<Index_type> owner;
+  RAJA::IndexSetVec<Index_type> owner;
 
   //! vector holding user defined begin segment intervals
   RAJA::RAJAVec<Index_type> m_seg_interval_begin;
@@ -611,6 +646,20 @@ public:
     m_len = c.m_len;
   }
 
+  //! Move-constructor.
+  RAJA_INLINE
+  TypedIndexSet(TypedIndexSet &&c)
+      : segment_types(std::move(c.segment_types)),
+        segment_offsets(std::move(c.segment_offsets)),
+        segment_icounts(std::move(c.segment_icounts)),
+        m_len(c.m_len)
+  {
+    c.m_len = 0;
+  }
+
+  //! Copy-assignment operator.
+  TypedIndexSet &operator=(TypedIndexSet const &) = default;
+
   //! Swap function for copy-and-swap idiom (deep copy).
   void swap(TypedIndexSet &other)
   {
@@ -640,32 +689,32 @@ protected:
   {
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentTypes()
   {
     return segment_types;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentTypes() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentTypes() const
   {
     return segment_types;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentOffsets()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentOffsets()
   {
     return segment_offsets;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentOffsets() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentOffsets() const
   {
     return segment_offsets;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentIcounts()
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> &getSegmentIcounts()
   {
     return segment_icounts;
   }
 
-  RAJA_INLINE RAJA::RAJAVec<Index_type> const &getSegmentIcounts() const
+  RAJA_INLINE RAJA::IndexSetVec<Index_type> const &getSegmentIcounts() const
   {
     return segment_icounts;
   }
@@ -743,14 +792,14 @@ public:
 
 private:
   //! Vector of segment types:    seg_index -> seg_type
-  RAJA::RAJAVec<Index_type> segment_types;
+  RAJA::IndexSetVec<Index_type> segment_types;
 
   //! offsets into each segment vector:    seg_index -> seg_offset
   //! used as segment_data[seg_type][seg_offset]
-  RAJA::RAJAVec<Index_type> segment_offsets;
+  RAJA::IndexSetVec<Index_type> segment_offsets;
 
   //! the icount of each segment
-  RAJA::RAJAVec<Index_type> segment_icounts;
+  RAJA::IndexSetVec<Index_type> segment_icounts;
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
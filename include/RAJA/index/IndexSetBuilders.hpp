@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/index/BoxStrideSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
@@ -61,6 +62,44 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
     RAJA::Index_type range_min_length,
     RAJA::Index_type range_align);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with Range, RangeStride, and List segments,
+ *        as needed, from given array of indices.
+ *
+ *        Each run of at least range_min_length indices with a constant
+ *        non-zero stride becomes a range segment, or a range stride segment
+ *        for strides other than one. The indices between those runs are
+ *        put in list segments. Segments are appended in the order of the
+ *        input array, so iterating over the index set visits the indices
+ *        in the same order.
+ *
+ *        The input array is scanned in parallel when RAJA is built with
+ *        OpenMP. The remaining work is proportional to the number of
+ *        runs, not the number of indices.
+ *
+ *  \param iset reference to index set generated. Method assumes index set
+ *         is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param indices_in pointer to start of input array of indices.
+ *  \param length size of input index array.
+ *  \param range_min_length min length of any range or range stride segment
+ *         in index set (at least 2).
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildIndexSetHybrid(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length);
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +165,126 @@ void buildLockFreeColorIndexset(
     RAJA::Index_type* elemPermutation = nullptr,
     RAJA::Index_type* ielemPermutation = nullptr);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a lock-free "color" index set containing range and list
+ *        segments, coloring the entities in parallel.
+ *
+ *        Same as buildLockFreeColorIndexset, but the coloring is computed
+ *        with OpenMP threads, when RAJA is built with OpenMP. Each round of
+ *        the coloring picks the uncolored entities that have a higher
+ *        priority, a hash of the entity id, than all of their uncolored
+ *        neighbors, and gives each the smallest color its neighbors do not
+ *        have. The colors may differ from those of the serial coloring.
+ *        Within a color, entities are in increasing order.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *
+ ******************************************************************************
+ */
+void buildLockFreeColorIndexsetParallel(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    RAJA::Index_type* elemPermutation = nullptr,
+    RAJA::Index_type* ielemPermutation = nullptr);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with one list segment per color, so that
+ *        no two entities in a segment share a range entity.
+ *
+ *        The entities are colored in parallel as in
+ *        buildLockFreeColorIndexsetParallel. Iterating over the index set
+ *        with a sequential segment iteration policy and a parallel segment
+ *        execution policy, on the CPU or a GPU, lets a loop scatter to the
+ *        range entities, e.g. sum zone values to nodes, without atomics.
+ *        Within a segment, entities are in increasing order.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ * \param domainToRange numRangePerDomain range entity ids for each entity.
+ * \param numEntity number of entities to color.
+ * \param numRangePerDomain number of range entities of each entity.
+ * \param numEntityRange number of range entities.
+ *
+ ******************************************************************************
+ */
+void buildColoredIndexSet(
+    RAJA::TypedIndexSet<RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set of strided box segments that colors the
+ *        cells of a box of a row-major array with num_colors colors.
+ *
+ *        Cell (x_0, ..., x_{num_dims-1}) has color
+ *        (x_0 + ... + x_{num_dims-1}) mod num_colors, so with two colors
+ *        the box is a red-black checkerboard. No two cells of a color are
+ *        neighbors along a dimension, so a Gauss-Seidel smoother with a
+ *        nearest-neighbor stencil can update the cells of a color in
+ *        parallel. The indices are computed from the box, the index set
+ *        holds no index arrays.
+ *
+ *        Each color is num_colors^(num_dims - 1) segments, which may be
+ *        empty, and the colors are appended in order. Iterating over the
+ *        index set with a sequential segment iteration policy runs the
+ *        colors one after the other.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param num_colors number of colors.
+ * \param num_dims number of dimensions of the box, 1 to 3.
+ * \param begin first coordinate of the box in each dimension.
+ * \param end end coordinate (exclusive) of the box in each dimension.
+ * \param extent extent of the array in each dimension, the last dimension
+ *        having stride one.
+ *
+ * \return number of segments of each color.
+ *
+ * \verbatim
+ *
+ *   // interior cells of an (N+2) x (N+2) grid, in red and black
+ *   RAJA::TypedIndexSet<RAJA::BoxStrideSegment> colors;
+ *   RAJA::Index_type begin[] = {1, 1};
+ *   RAJA::Index_type end[] = {N + 1, N + 1};
+ *   RAJA::Index_type extent[] = {N + 2, N + 2};
+ *   RAJA::buildMulticolorIndexSet(colors, 2, 2, begin, end, extent);
+ *
+ *   RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit,
+ *                                 RAJA::omp_parallel_for_exec>>(
+ *       colors, [=](RAJA::Index_type id) { ... });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+RAJA::Index_type RAJASHAREDDLL_API buildMulticolorIndexSet(
+    RAJA::TypedIndexSet<RAJA::BoxStrideSegment>& iset,
+    int num_colors,
+    int num_dims,
+    const RAJA::Index_type* begin,
+    const RAJA::Index_type* end,
+    const RAJA::Index_type* extent);
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
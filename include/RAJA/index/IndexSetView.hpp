@@ -0,0 +1,199 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a non-owning view of index set segments.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_IndexSetView_HPP
+#define RAJA_IndexSetView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/index/IndexSet.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedIndexSetView
+ *
+ * \brief  Non-owning view of the segments [begin, end) of a TypedIndexSet.
+ *
+ * A view holds a pointer to the index set and the ids of its first and last
+ * segments, so it is trivially copyable and creating or copying it never
+ * allocates or copies segments or index data. The index set must outlive
+ * the view. Views are executed with the same ExecPolicy<seg_it, seg_exec>
+ * policies as index sets; segment ids and icounts are relative to the
+ * first segment of the view.
+ *
+ * Usage:
+ *
+ * \verbatim
+ *
+ *   TypedIndexSet<RangeSegment, ListSegment> iset;
+ *   ...
+ *   auto part = make_index_set_view(iset, 2, 6);
+ *
+ *   forall<ExecPolicy<seq_segit, exec_pol>>(part, [=] (Index_type i) {
+ *      // loop body -- indices of segments 2 to 5 of iset
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename... SegmentTypes>
+class TypedIndexSetView
+{
+public:
+  //! The index set type this is a view of
+  using index_set_type = TypedIndexSet<SegmentTypes...>;
+
+  //! The value type of the segments
+  using value_type = typename index_set_type::value_type;
+
+  //! Iterator over the segment ids of the view
+  using iterator = Iterators::numeric_iterator<Index_type>;
+
+  //! View of all segments of an index set
+  TypedIndexSetView(index_set_type const& iset)
+      : TypedIndexSetView(iset, 0, static_cast<int>(iset.getNumSegments()))
+  {
+  }
+
+  //! View of the segments [begin, end) of an index set, clipped to its size
+  TypedIndexSetView(index_set_type const& iset, int begin, int end)
+      : m_iset(&iset)
+  {
+    int num_seg = static_cast<int>(iset.getNumSegments());
+    m_begin = begin < 0 ? 0 : (begin > num_seg ? num_seg : begin);
+    m_end = end < m_begin ? m_begin : (end > num_seg ? num_seg : end);
+    m_icount_begin = startingIcount(m_begin);
+    m_icount_end = startingIcount(m_end);
+  }
+
+  //! Return a view of the segments [begin, end) of this view
+  TypedIndexSetView slice(int begin, int end) const
+  {
+    begin = begin < 0 ? 0 : begin;
+    return TypedIndexSetView(*m_iset,
+                             m_begin + begin,
+                             end < m_end - m_begin ? m_begin + end : m_end);
+  }
+
+  //! Return the number of segments in the view
+  size_t getNumSegments() const { return static_cast<size_t>(m_end - m_begin); }
+
+  //! Return the number of indices in the segments of the view
+  size_t getLength() const
+  {
+    return static_cast<size_t>(m_icount_end - m_icount_begin);
+  }
+
+  //! Return the number of indices before segment segid of the view
+  int getStartingIcount(int segid) const
+  {
+    return static_cast<int>(
+        m_iset->getStartingIcount(m_begin + segid) - m_icount_begin);
+  }
+
+  //! Return the segment segid of the view
+  template <typename P0>
+  P0 const& getSegment(size_t segid) const
+  {
+    return m_iset->template getSegment<P0>(m_begin + segid);
+  }
+
+  //! Call body with segment segid of the view, followed by args
+  template <typename BODY, typename... ARGS>
+  RAJA_INLINE void segmentCall(size_t segid, BODY&& body, ARGS&&... args) const
+  {
+    m_iset->segmentCall(m_begin + segid,
+                        std::forward<BODY>(body),
+                        std::forward<ARGS>(args)...);
+  }
+
+  //! Get an iterator to the end.
+  iterator end() const { return iterator(getNumSegments()); }
+
+  //! Get an iterator to the beginning.
+  iterator begin() const { return iterator(0); }
+
+  //! Return the number of segments in the view.
+  Index_type size() const { return getNumSegments(); }
+
+private:
+  //! Number of indices before segment segid of the index set
+  Index_type startingIcount(int segid) const
+  {
+    return segid < static_cast<int>(m_iset->getNumSegments())
+               ? static_cast<Index_type>(m_iset->getStartingIcount(segid))
+               : static_cast<Index_type>(m_iset->getLength());
+  }
+
+  //! The viewed index set
+  index_set_type const* m_iset;
+
+  //! First segment of the view
+  int m_begin;
+
+  //! End segment of the view
+  int m_end;
+
+  //! Number of indices before the first and end segments of the view
+  Index_type m_icount_begin;
+  Index_type m_icount_end;
+};
+
+//! Make a view of the segments [begin, end) of an index set
+template <typename... SegmentTypes>
+RAJA_INLINE TypedIndexSetView<SegmentTypes...> make_index_set_view(
+    TypedIndexSet<SegmentTypes...> const& iset,
+    int begin,
+    int end)
+{
+  return TypedIndexSetView<SegmentTypes...>(iset, begin, end);
+}
+
+//! Make a view of all segments of an index set
+template <typename... SegmentTypes>
+RAJA_INLINE TypedIndexSetView<SegmentTypes...> make_index_set_view(
+    TypedIndexSet<SegmentTypes...> const& iset)
+{
+  return TypedIndexSetView<SegmentTypes...>(iset);
+}
+
+namespace type_traits
+{
+
+template <typename T>
+struct is_index_set_view
+    : ::RAJA::type_traits::SpecializationOf<RAJA::TypedIndexSetView,
+                                            typename std::decay<T>::type> {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -168,6 +168,32 @@ public:
     }
   }
 
+  /*!
+   * \brief Make a list segment that takes ownership of index data allocated
+   *        with the given camp resource, without copying it.
+   *
+   * \param values array of indices allocated with resource
+   * \param length number of indices
+   * \param resource camp resource used to allocate values
+   *
+   * The array is deallocated with the resource when the segment is
+   * destroyed. Unlike the constructors, this does not access the index data
+   * on the host, so it may be used with indices computed on a device.
+   */
+  static TypedListSegment adopt(value_type* values,
+                                Index_type length,
+                                camp::resources::Resource resource)
+  {
+    TypedListSegment seg(values, length, resource, Unowned);
+    if (seg.m_data != nullptr) {
+      seg.m_resource = new camp::resources::Resource(resource);
+      seg.m_owned = Owned;
+    } else if (values != nullptr) {
+      resource.deallocate(values);
+    }
+    return seg;
+  }
+
   //! Disable compiler generated constructor
   TypedListSegment() = delete;
 
@@ -267,6 +293,24 @@ public:
    */
   RAJA_HOST_DEVICE IndexOwnership getIndexOwnership() const { return m_owned; }
 
+  /*!
+   * \brief Get a list segment viewing the indices [begin, begin + length)
+   *        of this segment, clipped to its size, without copying them.
+   *
+   * The returned segment does not own its index data, so this segment
+   * must outlive it.
+   */
+  RAJA_HOST_DEVICE TypedListSegment slice(Index_type begin,
+                                          Index_type length) const
+  {
+    TypedListSegment seg(*this);
+    begin = begin < 0 ? 0 : (begin > m_size ? m_size : begin);
+    seg.m_data = m_data + begin;
+    seg.m_size = length < m_size - begin ? (length < 0 ? 0 : length)
+                                         : m_size - begin;
+    return seg;
+  }
+
   //@}
 
   //@{
@@ -0,0 +1,475 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining run-length segment classes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RunLengthSegment_HPP
+#define RAJA_RunLengthSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedRunLengthSegment
+ *
+ * \brief  Segment class representing a list of indices as runs of
+ *         consecutive indices, each stored as its first index and the
+ *         position of that index in the list.
+ *
+ * Index lists made of long stretches of consecutive indices, such as the
+ * cells of a mesh region, take two values per run instead of one per index.
+ * The segment also stores the run holding each 256th index so that any
+ * index can be found with a short binary search.
+ *
+ * The indices are visited in the order of the given list.  Sequential loops
+ * visit them run by run.  Other execution policies access index i directly.
+ *
+ * Usage:
+ *
+ *   A common C-style loop traversal pattern would be:
+ *
+ * \verbatim
+ *
+ *   const T* indices = ...;
+ *   for (T i = 0; i < len; ++i) {
+ *      // loop body -- use indices[i] as index value
+ *   }
+ *
+ * \endverbatim
+ *
+ *   A TypedRunLengthSegment would be used with a RAJA forall execution
+ *   template as:
+ *
+ * \verbatim
+ *
+ *   TypedRunLengthSegment<T> seg(indices, len, resource);
+ *
+ *   forall<exec_pol>(seg, [=] (T i) {
+ *      // loop body -- use i as index value
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename StorageT>
+class TypedRunLengthSegment
+{
+public:
+
+  //@{
+  //!   @name Types used in implementation based on template parameter.
+
+  //! The underlying value type for index storage
+  using value_type = StorageT;
+
+  //! Expose underlying index type for consistency with other segment types
+  using IndexType = StorageT;
+
+  //! Decodes index i of the segment from its runs
+  struct accessor {
+    const Index_type* starts;
+    const Index_type* offsets;
+    const Index_type* run_of;
+    Index_type num_runs;
+    Index_type num_run_of;
+
+    RAJA_HOST_DEVICE value_type operator()(Index_type i) const
+    {
+      // the run holding index i is between the runs holding the 256th
+      // indices around it
+      Index_type e = i >> s_run_of_shift;
+      Index_type lo = run_of[e];
+      Index_type hi = (e + 1 < num_run_of) ? run_of[e + 1] : num_runs - 1;
+      while (lo < hi) {
+        Index_type mid = (lo + hi + 1) / 2;
+        if (offsets[mid] <= i) {
+          lo = mid;
+        } else {
+          hi = mid - 1;
+        }
+      }
+      return static_cast<value_type>(starts[lo] + (i - offsets[lo]));
+    }
+  };
+
+  //! The underlying iterator type
+  using iterator = Iterators::decoding_iterator<accessor, value_type>;
+
+  //! one run lookup entry per 2^s_run_of_shift indices
+  static constexpr int s_run_of_shift = 8;
+
+  //@}
+
+  //@{
+  //!   @name Constructors and destructor.
+
+  /*!
+   * \brief Construct a run-length segment from given array with specified
+   *        length and use given camp resource to allocate the segment data.
+   *
+   * \param values array of indices defining iteration space of segment
+   * \param length number of indices
+   * \param resource camp resource defining memory space where segment data
+   *        live
+   */
+  TypedRunLengthSegment(const value_type* values,
+                        Index_type length,
+                        camp::resources::Resource resource)
+  {
+    initIndexData(values, length, resource);
+  }
+
+  /*!
+   * \brief Construct a run-length segment from given container of indices.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where segment data
+   *        live
+   *
+   * The given container must provide methods begin(), end(), and size().
+   *
+   * Constructor assumes container data lives in host memory space.
+   */
+  template <typename Container>
+  TypedRunLengthSegment(const Container& container,
+                        camp::resources::Resource resource)
+  {
+    initIndexData(container.begin(),
+                  static_cast<Index_type>(container.size()),
+                  resource);
+  }
+
+  //! Disable compiler generated constructor
+  TypedRunLengthSegment() = delete;
+
+  //! Copy constructor for run-length segment
+  //  As this may be called from a lambda in a
+  //  RAJA method we perform a shallow copy
+  RAJA_HOST_DEVICE TypedRunLengthSegment(const TypedRunLengthSegment& other)
+      : m_resource(nullptr),
+        m_owned(Unowned),
+        m_starts(other.m_starts),
+        m_offsets(other.m_offsets),
+        m_run_of(other.m_run_of),
+        m_num_runs(other.m_num_runs),
+        m_num_run_of(other.m_num_run_of),
+        m_size(other.m_size)
+  {
+  }
+
+  //! Copy assignment for run-length segment
+  //  As this may be called from a lambda in a
+  //  RAJA method we perform a shallow copy
+  RAJA_HOST_DEVICE TypedRunLengthSegment& operator=(
+      const TypedRunLengthSegment& other)
+  {
+    if (this != &other) {
+      clear();
+      m_starts = other.m_starts;
+      m_offsets = other.m_offsets;
+      m_run_of = other.m_run_of;
+      m_num_runs = other.m_num_runs;
+      m_num_run_of = other.m_num_run_of;
+      m_size = other.m_size;
+    }
+    return *this;
+  }
+
+  //! Move constructor for run-length segment
+  RAJA_HOST_DEVICE TypedRunLengthSegment(TypedRunLengthSegment&& rhs)
+      : TypedRunLengthSegment(static_cast<const TypedRunLengthSegment&>(rhs))
+  {
+    m_resource = rhs.m_resource;
+    m_owned = rhs.m_owned;
+    rhs.m_resource = nullptr;
+    rhs.m_owned = Unowned;
+    rhs.clear();
+  }
+
+  //! Run-length segment destructor
+  RAJA_HOST_DEVICE ~TypedRunLengthSegment() { clear(); }
+
+  //! Clear method to be called
+  RAJA_HOST_DEVICE void clear()
+  {
+#if !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    if (m_starts != nullptr && m_owned == Owned) {
+      m_resource->deallocate(m_starts);
+      m_resource->deallocate(m_offsets);
+      m_resource->deallocate(m_run_of);
+      delete m_resource;
+    }
+#endif
+    m_resource = nullptr;
+    m_owned = Unowned;
+    m_starts = nullptr;
+    m_offsets = nullptr;
+    m_run_of = nullptr;
+    m_num_runs = 0;
+    m_num_run_of = 0;
+    m_size = 0;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Accessor methods
+
+  /*!
+   * \brief Get iterator to the beginning of this segment
+   */
+  RAJA_HOST_DEVICE iterator begin() const { return iterator(get_accessor(), 0); }
+
+  /*!
+   * \brief Get iterator to the end of this segment
+   */
+  RAJA_HOST_DEVICE iterator end() const
+  {
+    return iterator(get_accessor(), m_size);
+  }
+
+  /*!
+   * \brief Get size of this segment (number of indices)
+   */
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  /*!
+   * \brief Get number of runs of consecutive indices in this segment
+   */
+  RAJA_HOST_DEVICE Index_type getNumRuns() const { return m_num_runs; }
+
+  /*!
+   * \brief Get ownership of segment data (Owned/Unowned)
+   */
+  RAJA_HOST_DEVICE IndexOwnership getIndexOwnership() const { return m_owned; }
+
+  /*!
+   * \brief Number of bytes of segment data
+   */
+  RAJA_HOST_DEVICE size_t getStorageBytes() const
+  {
+    return sizeof(Index_type) * (2 * m_num_runs + 1 + m_num_run_of);
+  }
+
+  /*!
+   * \brief Call body(index) for each index of the segment, in order.
+   *
+   * Walks the runs, so the segment data must live in host memory space.
+   */
+  template <typename Body>
+  void for_each_index(Body&& body) const
+  {
+    for (Index_type r = 0; r < m_num_runs; ++r) {
+      Index_type start = m_starts[r];
+      Index_type len = m_offsets[r + 1] - m_offsets[r];
+      for (Index_type i = 0; i < len; ++i) {
+        body(static_cast<value_type>(start + i));
+      }
+    }
+  }
+
+  //@}
+
+  //@{
+  //!   @name Segment comparison methods
+
+  /*!
+   * \brief Compare this segment to another for equality
+   *
+   * \return true if both segments have the same runs, else false
+   *
+   * Method assumes data in both segments live in host memory space.
+   */
+  bool operator==(const TypedRunLengthSegment& other) const
+  {
+    if (m_num_runs != other.m_num_runs || m_size != other.m_size) {
+      return false;
+    }
+    for (Index_type r = 0; r < m_num_runs; ++r) {
+      if (m_starts[r] != other.m_starts[r] ||
+          m_offsets[r] != other.m_offsets[r]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Compare this segment to another for inequality
+   */
+  bool operator!=(const TypedRunLengthSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+  //@}
+
+  /*!
+   * \brief Swap this segment with another
+   */
+  RAJA_HOST_DEVICE void swap(TypedRunLengthSegment& other)
+  {
+    camp::safe_swap(m_resource, other.m_resource);
+    camp::safe_swap(m_owned, other.m_owned);
+    camp::safe_swap(m_starts, other.m_starts);
+    camp::safe_swap(m_offsets, other.m_offsets);
+    camp::safe_swap(m_run_of, other.m_run_of);
+    camp::safe_swap(m_num_runs, other.m_num_runs);
+    camp::safe_swap(m_num_run_of, other.m_num_run_of);
+    camp::safe_swap(m_size, other.m_size);
+  }
+
+private:
+  RAJA_HOST_DEVICE accessor get_accessor() const
+  {
+    return accessor{m_starts, m_offsets, m_run_of, m_num_runs, m_num_run_of};
+  }
+
+  //
+  // Build the runs and lookup table on the host and copy them to the
+  // memory space of the resource.
+  //
+  template <typename Iter>
+  void initIndexData(Iter values,
+                     Index_type len,
+                     camp::resources::Resource resource_)
+  {
+    if (len <= 0) {
+      return;
+    }
+
+    m_num_runs = 1;
+    for (Index_type i = 1; i < len; ++i) {
+      if (static_cast<Index_type>(stripIndexType(values[i])) !=
+          static_cast<Index_type>(stripIndexType(values[i - 1])) + 1) {
+        ++m_num_runs;
+      }
+    }
+
+    camp::resources::Resource host_res{camp::resources::Host()};
+
+    Index_type* starts = host_res.allocate<Index_type>(m_num_runs);
+    Index_type* offsets = host_res.allocate<Index_type>(m_num_runs + 1);
+    Index_type r = 0;
+    for (Index_type i = 0; i < len; ++i) {
+      Index_type v = static_cast<Index_type>(stripIndexType(values[i]));
+      if (i == 0 ||
+          v != static_cast<Index_type>(stripIndexType(values[i - 1])) + 1) {
+        starts[r] = v;
+        offsets[r] = i;
+        ++r;
+      }
+    }
+    offsets[m_num_runs] = len;
+    m_size = len;
+
+    m_num_run_of = ((len - 1) >> s_run_of_shift) + 1;
+    Index_type* run_of = host_res.allocate<Index_type>(m_num_run_of);
+    Index_type e = 0;
+    for (r = 0; r < m_num_runs; ++r) {
+      while (e < m_num_run_of && (e << s_run_of_shift) < offsets[r + 1]) {
+        run_of[e++] = r;
+      }
+    }
+
+    m_resource = new camp::resources::Resource(resource_);
+    m_owned = Owned;
+    m_starts = m_resource->allocate<Index_type>(m_num_runs);
+    m_offsets = m_resource->allocate<Index_type>(m_num_runs + 1);
+    m_run_of = m_resource->allocate<Index_type>(m_num_run_of);
+    m_resource->memcpy(m_starts, starts, sizeof(Index_type) * m_num_runs);
+    m_resource->memcpy(m_offsets,
+                       offsets,
+                       sizeof(Index_type) * (m_num_runs + 1));
+    m_resource->memcpy(m_run_of, run_of, sizeof(Index_type) * m_num_run_of);
+
+    host_res.deallocate(starts);
+    host_res.deallocate(offsets);
+    host_res.deallocate(run_of);
+  }
+
+
+  // Copy of camp resource passed to ctor
+  camp::resources::Resource* m_resource = nullptr;
+
+  // Ownership flag to guide data management
+  IndexOwnership m_owned = Unowned;
+
+  // First index of each run
+  Index_type* m_starts = nullptr;
+
+  // Position of the first index of each run, followed by the segment size
+  Index_type* m_offsets = nullptr;
+
+  // Run holding every 2^s_run_of_shift-th index
+  Index_type* m_run_of = nullptr;
+
+  Index_type m_num_runs = 0;
+
+  Index_type m_num_run_of = 0;
+
+  // Number of indices
+  Index_type m_size = 0;
+};
+
+template <typename StorageT>
+constexpr int TypedRunLengthSegment<StorageT>::s_run_of_shift;
+
+//! Alias for A TypedRunLengthSegment<Index_type>
+using RunLengthSegment = TypedRunLengthSegment<Index_type>;
+
+namespace type_traits
+{
+
+template <typename StorageT>
+struct is_compressed_segment<TypedRunLengthSegment<StorageT>>
+    : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! Specialization of std::swap for TypedRunLengthSegment
+template <typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedRunLengthSegment<StorageT>& a,
+                      RAJA::TypedRunLengthSegment<StorageT>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,150 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for segment builder method templates that build
+ *          segment index data in the memory space of an execution policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SegmentBuilders_HPP
+#define RAJA_SegmentBuilders_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/compact.hpp"
+
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Build a list segment of the indices of a range for which a
+ *        predicate is true, using the given execution policy.
+ *
+ *        The indices are selected with RAJA::copy_if in the memory space of
+ *        the resource, so for GPU policies the predicate runs on the device
+ *        and the segment index data never touch the host; only the number of
+ *        selected indices is copied back. This lets index sets be rebuilt
+ *        from device data, e.g. after a mesh changes, without moving that
+ *        data to the host.
+ *
+ *  \param res resource of the execution policy; the segment index data are
+ *         allocated with it.
+ *  \param range range of candidate indices.
+ *  \param pred unary predicate on an index, callable in the execution
+ *         policy's memory space.
+ *
+ *  \return List segment that owns its index data, holding the selected
+ *          indices in increasing order.
+ *
+ *  Usage:
+ *
+ * \verbatim
+ *   RAJA::resources::Cuda res;
+ *   double* d_material = ...;  // device data
+ *
+ *   auto seg = RAJA::make_list_segment_if<RAJA::cuda_exec<256>>(
+ *       res, RAJA::TypedRangeSegment<int>(0, N),
+ *       [=] RAJA_DEVICE (int i) { return d_material[i] > 0.5; });
+ *
+ *   iset.push_back(std::move(seg));
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy,
+          typename Res,
+          typename StorageT,
+          typename DiffT,
+          typename Predicate>
+concepts::enable_if_t<TypedListSegment<StorageT>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+make_list_segment_if(Res res,
+                     TypedRangeSegment<StorageT, DiffT> const& range,
+                     Predicate pred)
+{
+  using value_type = StorageT;
+
+  camp::resources::Resource work_res{res};
+
+  const Index_type len = static_cast<Index_type>(range.size());
+  if (len <= 0) {
+    return TypedListSegment<value_type>(nullptr, 0, work_res);
+  }
+
+  value_type* selected = work_res.allocate<value_type>(len);
+  Index_type* d_num_selected = work_res.allocate<Index_type>(1);
+
+  ::RAJA::policy_by_value_interface::copy_if(ExecPolicy(),
+                                            res,
+                                            range,
+                                            make_span(selected, len),
+                                            d_num_selected,
+                                            pred);
+
+  Index_type num_selected = 0;
+  work_res.memcpy(&num_selected, d_num_selected, sizeof(Index_type));
+  work_res.wait();
+  work_res.deallocate(d_num_selected);
+
+  // move the selected indices to an array of the right size so the segment
+  // does not hold on to the space of the whole range
+  value_type* indices = nullptr;
+  if (num_selected > 0 && num_selected < len) {
+    indices = work_res.allocate<value_type>(num_selected);
+    work_res.memcpy(indices, selected, sizeof(value_type) * num_selected);
+    work_res.wait();
+    work_res.deallocate(selected);
+  } else if (num_selected == len) {
+    indices = selected;
+  } else {
+    work_res.deallocate(selected);
+  }
+
+  return TypedListSegment<value_type>::adopt(indices, num_selected, work_res);
+}
+
+/*!
+ * \brief Build a list segment of the indices of a range for which a
+ *        predicate is true, using the default resource of the execution
+ *        policy.
+ */
+template <typename ExecPolicy,
+          typename StorageT,
+          typename DiffT,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<TypedListSegment<StorageT>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+make_list_segment_if(TypedRangeSegment<StorageT, DiffT> const& range,
+                     Predicate pred)
+{
+  return make_list_segment_if<ExecPolicy>(Res::get_default(), range, pred);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
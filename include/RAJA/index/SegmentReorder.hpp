@@ -0,0 +1,465 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for methods that reorder the indices of list segments
+ *          to improve the locality of the data they access.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SegmentReorder_HPP
+#define RAJA_SegmentReorder_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/pattern/reduce.hpp"
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Transposed Hilbert index of a point with NDims coordinates of
+ *        Bits bits each, as in J. Skilling, "Programming the Hilbert curve",
+ *        AIP Conf. Proc. 707 (2004).
+ */
+template <int NDims, int Bits>
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t hilbert_key(uint32_t (&X)[NDims])
+{
+  constexpr uint32_t M = uint32_t(1) << (Bits - 1);
+
+  // inverse undo
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+    for (int i = 0; i < NDims; ++i) {
+      if (X[i] & Q) {
+        X[0] ^= P;
+      } else {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < NDims; ++i) {
+    X[i] ^= X[i - 1];
+  }
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    if (X[NDims - 1] & Q) {
+      t ^= Q - 1;
+    }
+  }
+  for (int i = 0; i < NDims; ++i) {
+    X[i] ^= t;
+  }
+
+  // interleave the bits of the transposed index
+  uint64_t key = 0;
+  for (int b = Bits - 1; b >= 0; --b) {
+    for (int i = 0; i < NDims; ++i) {
+      key = (key << 1) | ((X[i] >> b) & uint32_t(1));
+    }
+  }
+  return key;
+}
+
+//! bits per coordinate of the 2D and 3D Hilbert keys
+constexpr int hilbert_bits_2d = 31;
+constexpr int hilbert_bits_3d = 21;
+
+/*!
+ * \brief Returns a list segment with the indices of seg in the order given
+ *        by order, a device array of positions in seg, and copies order
+ *        to permutation if it is not null.
+ */
+template <typename ExecPolicy, typename Res, typename StorageT>
+TypedListSegment<StorageT> gather_segment(Res res,
+                                          TypedListSegment<StorageT> const& seg,
+                                          const Index_type* order,
+                                          Index_type* permutation)
+{
+  camp::resources::Resource work_res{res};
+
+  const Index_type len = seg.size();
+  const StorageT* values = seg.begin();
+  StorageT* reordered = work_res.allocate<StorageT>(len);
+
+  forall<ExecPolicy>(res,
+                     TypedRangeSegment<Index_type>(0, len),
+                     [=] RAJA_HOST_DEVICE(Index_type k) {
+                       reordered[k] = values[order[k]];
+                       if (permutation != nullptr) {
+                         permutation[k] = order[k];
+                       }
+                     });
+  work_res.wait();
+
+  return TypedListSegment<StorageT>::adopt(reordered, len, work_res);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Index of the 2D point (x, y) along a Hilbert curve, for
+ *        coordinates of up to 31 bits.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t hilbert_key(uint32_t x, uint32_t y)
+{
+  uint32_t X[2] = {x, y};
+  return detail::hilbert_key<2, detail::hilbert_bits_2d>(X);
+}
+
+/*!
+ * \brief Index of the 3D point (x, y, z) along a Hilbert curve, for
+ *        coordinates of up to 21 bits.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t hilbert_key(uint32_t x,
+                                                  uint32_t y,
+                                                  uint32_t z)
+{
+  uint32_t X[3] = {x, y, z};
+  return detail::hilbert_key<3, detail::hilbert_bits_3d>(X);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Reorder the indices of a list segment in increasing order of a key
+ *        computed from each index, using the given execution policy.
+ *
+ *        The keys are computed and sorted, with RAJA::stable_sort_pairs, in
+ *        the memory space of the resource, so indices with equal keys keep
+ *        their order.
+ *
+ *  \param res resource of the execution policy; the reordered segment is
+ *         allocated with it.
+ *  \param seg list segment to reorder.
+ *  \param key callable in the execution policy's memory space, returning
+ *         an unsigned 64-bit key for an index of seg.
+ *  \param permutation if not null, array of seg.size() entries in the
+ *         memory space of the resource; entry k is set to the position in
+ *         seg of index k of the returned segment, so data stored in segment
+ *         order can be permuted with new_data[k] = old_data[permutation[k]].
+ *
+ *  \return List segment that owns its index data.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Res, typename StorageT, typename Key>
+concepts::enable_if_t<TypedListSegment<StorageT>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+reorder_by_key(Res res,
+               TypedListSegment<StorageT> const& seg,
+               Key key,
+               Index_type* permutation = nullptr)
+{
+  camp::resources::Resource work_res{res};
+
+  const Index_type len = seg.size();
+  if (len <= 0) {
+    return TypedListSegment<StorageT>(nullptr, 0, work_res);
+  }
+
+  const StorageT* values = seg.begin();
+  uint64_t* keys = work_res.allocate<uint64_t>(len);
+  Index_type* order = work_res.allocate<Index_type>(len);
+
+  forall<ExecPolicy>(res,
+                     TypedRangeSegment<Index_type>(0, len),
+                     [=] RAJA_HOST_DEVICE(Index_type k) {
+                       keys[k] = static_cast<uint64_t>(key(values[k]));
+                       order[k] = k;
+                     });
+
+  stable_sort_pairs<ExecPolicy>(res,
+                                make_span(keys, len),
+                                make_span(order, len));
+
+  TypedListSegment<StorageT> reordered =
+      detail::gather_segment<ExecPolicy>(res, seg, order, permutation);
+
+  work_res.deallocate(order);
+  work_res.deallocate(keys);
+
+  return reordered;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Reorder the indices of a list segment along a Hilbert
+ *        space-filling curve through the points of the indices, so that
+ *        consecutive indices are close in space.
+ *
+ *        The bounding box of the points is found with a reduction, each
+ *        coordinate is scaled to the bits of the curve in the box, and the
+ *        indices are sorted by their Hilbert keys as in reorder_by_key.
+ *
+ *  \param res resource of the execution policy.
+ *  \param seg list segment to reorder.
+ *  \param x, y, z coordinates of the point of each index, indexed by the
+ *         indices of seg, in the memory space of the resource. z may be
+ *         null for 2D points.
+ *  \param permutation see reorder_by_key.
+ *
+ *  Usage:
+ *
+ * \verbatim
+ *   // zone centers on the device, zones is a list segment of zone ids
+ *   auto ordered = RAJA::reorder_hilbert<RAJA::cuda_exec<256>>(
+ *       res, zones, d_xc, d_yc, d_zc, d_perm);
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Res, typename StorageT, typename Real>
+concepts::enable_if_t<TypedListSegment<StorageT>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+reorder_hilbert(Res res,
+                TypedListSegment<StorageT> const& seg,
+                const Real* x,
+                const Real* y,
+                const Real* z,
+                Index_type* permutation = nullptr)
+{
+  const Index_type len = seg.size();
+  if (len <= 0) {
+    return TypedListSegment<StorageT>(nullptr, 0, camp::resources::Resource{res});
+  }
+
+  const StorageT* values = seg.begin();
+  const bool is3d = (z != nullptr);
+
+  Real lo[3];
+  Real hi[3];
+  {
+    Real xmin = std::numeric_limits<Real>::max();
+    Real ymin = xmin;
+    Real zmin = xmin;
+    Real xmax = std::numeric_limits<Real>::lowest();
+    Real ymax = xmax;
+    Real zmax = xmax;
+    forall<ExecPolicy>(
+        res,
+        TypedRangeSegment<Index_type>(0, len),
+        expt::Reduce<operators::minimum>(&xmin),
+        expt::Reduce<operators::minimum>(&ymin),
+        expt::Reduce<operators::minimum>(&zmin),
+        expt::Reduce<operators::maximum>(&xmax),
+        expt::Reduce<operators::maximum>(&ymax),
+        expt::Reduce<operators::maximum>(&zmax),
+        [=] RAJA_HOST_DEVICE(Index_type k,
+                             Real& xmin_,
+                             Real& ymin_,
+                             Real& zmin_,
+                             Real& xmax_,
+                             Real& ymax_,
+                             Real& zmax_) {
+          const StorageT i = values[k];
+          const Real zi = is3d ? z[i] : Real(0);
+          xmin_ = RAJA_MIN(xmin_, x[i]);
+          ymin_ = RAJA_MIN(ymin_, y[i]);
+          zmin_ = RAJA_MIN(zmin_, zi);
+          xmax_ = RAJA_MAX(xmax_, x[i]);
+          ymax_ = RAJA_MAX(ymax_, y[i]);
+          zmax_ = RAJA_MAX(zmax_, zi);
+        });
+    lo[0] = xmin;
+    lo[1] = ymin;
+    lo[2] = zmin;
+    hi[0] = xmax;
+    hi[1] = ymax;
+    hi[2] = zmax;
+  }
+
+  const int bits = is3d ? detail::hilbert_bits_3d : detail::hilbert_bits_2d;
+  const double cells = static_cast<double>((uint64_t(1) << bits) - 1);
+  double scale[3];
+  for (int d = 0; d < 3; ++d) {
+    const double extent = static_cast<double>(hi[d] - lo[d]);
+    scale[d] = (extent > 0.0) ? cells / extent : 0.0;
+  }
+
+  const double x0 = lo[0], y0 = lo[1], z0 = lo[2];
+  const double sx = scale[0], sy = scale[1], sz = scale[2];
+
+  return reorder_by_key<ExecPolicy>(
+      res,
+      seg,
+      [=] RAJA_HOST_DEVICE(StorageT i) {
+        const uint32_t ix =
+            static_cast<uint32_t>((static_cast<double>(x[i]) - x0) * sx);
+        const uint32_t iy =
+            static_cast<uint32_t>((static_cast<double>(y[i]) - y0) * sy);
+        if (is3d) {
+          const uint32_t iz =
+              static_cast<uint32_t>((static_cast<double>(z[i]) - z0) * sz);
+          return hilbert_key(ix, iy, iz);
+        }
+        return hilbert_key(ix, iy);
+      },
+      permutation);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Reorder the indices of a list segment with the reverse
+ *        Cuthill-McKee ordering of the graph they form, so that indices
+ *        that are neighbors in the graph are close in the segment.
+ *
+ *        The graph is given as a compressed adjacency list on the host,
+ *        e.g. zones and the zones they share a face with; edges to indices
+ *        that are not in seg are ignored. Each connected part is ordered
+ *        by a breadth first search from one of its indices of lowest
+ *        degree, visiting the neighbors of an index in increasing order of
+ *        degree, and the order is then reversed.
+ *
+ *        The search runs on the host, so the index data of seg are copied
+ *        to the host when they live elsewhere; the reordered segment is
+ *        gathered with the execution policy.
+ *
+ *  \param res resource of the execution policy.
+ *  \param seg list segment to reorder.
+ *  \param adj_offsets host array; the neighbors of index i are
+ *         adj[adj_offsets[i]] ... adj[adj_offsets[i+1]-1]. It must have an
+ *         entry past each index of seg.
+ *  \param adj host array of neighbor indices.
+ *  \param permutation see reorder_by_key.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Res, typename StorageT>
+concepts::enable_if_t<TypedListSegment<StorageT>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+reorder_rcm(Res res,
+            TypedListSegment<StorageT> const& seg,
+            const Index_type* adj_offsets,
+            const Index_type* adj,
+            Index_type* permutation = nullptr)
+{
+  camp::resources::Resource work_res{res};
+
+  const Index_type len = seg.size();
+  if (len <= 0) {
+    return TypedListSegment<StorageT>(nullptr, 0, work_res);
+  }
+
+  std::vector<StorageT> values(len);
+  work_res.memcpy(values.data(), seg.begin(), len * sizeof(StorageT));
+  work_res.wait();
+
+  // position in seg of each index, -1 for indices not in seg
+  const StorageT max_value = *std::max_element(values.begin(), values.end());
+  std::vector<Index_type> position(static_cast<size_t>(max_value) + 1, -1);
+  for (Index_type k = 0; k < len; ++k) {
+    position[values[k]] = k;
+  }
+
+  std::vector<Index_type> degree(len, 0);
+  for (Index_type k = 0; k < len; ++k) {
+    for (Index_type e = adj_offsets[values[k]]; e < adj_offsets[values[k] + 1];
+         ++e) {
+      const Index_type n = adj[e];
+      if (n >= 0 && n <= static_cast<Index_type>(max_value) &&
+          position[n] >= 0) {
+        ++degree[k];
+      }
+    }
+  }
+
+  // candidate start positions, in increasing order of degree
+  std::vector<Index_type> starts(len);
+  for (Index_type k = 0; k < len; ++k) {
+    starts[k] = k;
+  }
+  std::stable_sort(starts.begin(), starts.end(), [&](Index_type a, Index_type b) {
+    return degree[a] < degree[b];
+  });
+
+  std::vector<Index_type> order;
+  order.reserve(len);
+  std::vector<char> visited(len, 0);
+  std::vector<Index_type> neighbors;
+
+  for (Index_type start : starts) {
+    if (visited[start]) continue;
+
+    visited[start] = 1;
+    order.push_back(start);
+
+    for (size_t head = order.size() - 1; head < order.size(); ++head) {
+      const StorageT i = values[order[head]];
+
+      neighbors.clear();
+      for (Index_type e = adj_offsets[i]; e < adj_offsets[i + 1]; ++e) {
+        const Index_type n = adj[e];
+        if (n < 0 || n > static_cast<Index_type>(max_value)) continue;
+        const Index_type k = position[n];
+        if (k >= 0 && !visited[k]) {
+          visited[k] = 1;
+          neighbors.push_back(k);
+        }
+      }
+      std::stable_sort(neighbors.begin(),
+                       neighbors.end(),
+                       [&](Index_type a, Index_type b) {
+                         return degree[a] < degree[b];
+                       });
+      order.insert(order.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+
+  Index_type* d_order = work_res.allocate<Index_type>(len);
+  work_res.memcpy(d_order, order.data(), len * sizeof(Index_type));
+
+  TypedListSegment<StorageT> reordered =
+      detail::gather_segment<ExecPolicy>(res, seg, d_order, permutation);
+
+  work_res.deallocate(d_order);
+
+  return reordered;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
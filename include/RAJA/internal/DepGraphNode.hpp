@@ -78,13 +78,16 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency, returns true if this satisfied the
+  /// last unsatisfied dependency so the caller may launch this task.
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    int val = m_semaphore_value.load();
+    while (val > 0 &&
+           !m_semaphore_value.compare_exchange_weak(val, val - 1)) {
     }
+    return val == 1;
   }
 
   ///
@@ -418,6 +418,134 @@ private:
   DifferenceType stride = 1;
 };
 
+/*!
+ * Random access iterator over the positions of a segment whose indices are
+ * decoded on access: dereferencing the iterator at position pos returns
+ * accessor(pos).  Accessor is a small copyable object that refers to the
+ * segment's data, so the iterator can be used in device code when the data
+ * is in device accessible memory.
+ */
+template <typename Accessor,
+          typename Type = Index_type,
+          typename DifferenceType = Index_type>
+class decoding_iterator
+{
+public:
+  using value_type = Type;
+  using difference_type = DifferenceType;
+  using pointer = value_type*;
+  using reference = value_type;
+  using iterator_category = std::random_access_iterator_tag;
+
+  constexpr decoding_iterator() noexcept = default;
+  constexpr decoding_iterator(const decoding_iterator&) noexcept = default;
+  constexpr decoding_iterator(decoding_iterator&&) noexcept = default;
+  decoding_iterator& operator=(const decoding_iterator&) noexcept = default;
+  decoding_iterator& operator=(decoding_iterator&&) noexcept = default;
+
+  RAJA_HOST_DEVICE constexpr decoding_iterator(Accessor const& acc,
+                                               DifferenceType pos_)
+      : accessor(acc), pos(pos_)
+  {
+  }
+
+  RAJA_HOST_DEVICE inline bool operator==(const decoding_iterator& rhs) const
+  {
+    return pos == rhs.pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator!=(const decoding_iterator& rhs) const
+  {
+    return pos != rhs.pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator>(const decoding_iterator& rhs) const
+  {
+    return pos > rhs.pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator<(const decoding_iterator& rhs) const
+  {
+    return pos < rhs.pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator>=(const decoding_iterator& rhs) const
+  {
+    return pos >= rhs.pos;
+  }
+  RAJA_HOST_DEVICE inline bool operator<=(const decoding_iterator& rhs) const
+  {
+    return pos <= rhs.pos;
+  }
+
+  RAJA_HOST_DEVICE inline decoding_iterator& operator++()
+  {
+    ++pos;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline decoding_iterator& operator--()
+  {
+    --pos;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline decoding_iterator operator++(int)
+  {
+    decoding_iterator tmp(*this);
+    ++pos;
+    return tmp;
+  }
+  RAJA_HOST_DEVICE inline decoding_iterator operator--(int)
+  {
+    decoding_iterator tmp(*this);
+    --pos;
+    return tmp;
+  }
+
+  RAJA_HOST_DEVICE inline decoding_iterator& operator+=(
+      const difference_type& rhs)
+  {
+    pos += rhs;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline decoding_iterator& operator-=(
+      const difference_type& rhs)
+  {
+    pos -= rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE inline difference_type operator-(
+      const decoding_iterator& rhs) const
+  {
+    return pos - rhs.pos;
+  }
+  RAJA_HOST_DEVICE inline decoding_iterator operator+(
+      const difference_type& rhs) const
+  {
+    return decoding_iterator(accessor, pos + rhs);
+  }
+  RAJA_HOST_DEVICE inline decoding_iterator operator-(
+      const difference_type& rhs) const
+  {
+    return decoding_iterator(accessor, pos - rhs);
+  }
+  RAJA_HOST_DEVICE friend inline decoding_iterator operator+(
+      difference_type lhs,
+      const decoding_iterator& rhs)
+  {
+    return decoding_iterator(rhs.accessor, lhs + rhs.pos);
+  }
+
+  RAJA_HOST_DEVICE inline value_type operator*() const
+  {
+    return accessor(pos);
+  }
+  RAJA_HOST_DEVICE inline value_type operator[](difference_type rhs) const
+  {
+    return accessor(pos + rhs);
+  }
+
+private:
+  Accessor accessor{};
+  DifferenceType pos = 0;
+};
+
 
 }  // namespace Iterators
 
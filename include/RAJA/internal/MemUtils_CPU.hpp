@@ -22,11 +22,27 @@
 #include "RAJA/config.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 #if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__) || \
     defined(__MINGW32__) || defined(__BORLANDC__)
 #define RAJA_PLATFORM_WINDOWS
@@ -92,6 +108,255 @@ inline void free_aligned(void* ptr)
 #endif
 }
 
+
+///
+/// Size of a virtual memory page, the granularity of first touch placement.
+///
+inline size_t get_page_size()
+{
+#if defined(_SC_PAGESIZE)
+  long page_size = sysconf(_SC_PAGESIZE);
+  if (page_size > 0) {
+    return static_cast<size_t>(page_size);
+  }
+#endif
+  return 4096;
+}
+
+namespace detail
+{
+
+///
+/// Size in bytes of the level 1, 2 or 3 data cache reported by the OS for
+/// cpu 0, 0 if it is not reported.
+///
+inline size_t query_cache_size(int level)
+{
+#if defined(__linux__)
+  const std::string dir("/sys/devices/system/cpu/cpu0/cache/index");
+  for (int index = 0; index < 16; ++index) {
+    std::ifstream level_file(dir + std::to_string(index) + "/level");
+    int cache_level = 0;
+    if (!(level_file >> cache_level)) {
+      break;
+    }
+    std::ifstream type_file(dir + std::to_string(index) + "/type");
+    std::string type;
+    type_file >> type;
+    if (cache_level != level || type == "Instruction") {
+      continue;
+    }
+    std::ifstream size_file(dir + std::to_string(index) + "/size");
+    size_t size = 0;
+    char unit = '\0';
+    if (size_file >> size) {
+      if (size_file >> unit) {
+        if (unit == 'K') size *= 1024;
+        if (unit == 'M') size *= 1024 * 1024;
+      }
+      return size;
+    }
+  }
+#endif
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && \
+    defined(_SC_LEVEL3_CACHE_SIZE)
+  long size = sysconf(level == 1   ? _SC_LEVEL1_DCACHE_SIZE
+                      : level == 2 ? _SC_LEVEL2_CACHE_SIZE
+                                   : _SC_LEVEL3_CACHE_SIZE);
+  if (size > 0) {
+    return static_cast<size_t>(size);
+  }
+#endif
+  return 0;
+}
+
+}  // namespace detail
+
+///
+/// Size in bytes of the level 1, 2 or 3 data cache.
+///
+/// The sizes are read once, from the environment variables
+/// RAJA_L1_CACHE_SIZE, RAJA_L2_CACHE_SIZE and RAJA_L3_CACHE_SIZE when they
+/// are set, and otherwise from the OS. Levels the OS does not report are
+/// taken to be 32KiB, 1MiB and 32MiB.
+///
+inline size_t get_cache_size(int level)
+{
+  struct cache_sizes {
+    size_t size[3];
+
+    cache_sizes()
+    {
+      const char* env_names[3] = {"RAJA_L1_CACHE_SIZE",
+                                  "RAJA_L2_CACHE_SIZE",
+                                  "RAJA_L3_CACHE_SIZE"};
+      const size_t defaults[3] = {size_t(32) * 1024,
+                                  size_t(1024) * 1024,
+                                  size_t(32) * 1024 * 1024};
+      for (int l = 0; l < 3; ++l) {
+        size[l] = 0;
+        if (const char* env = std::getenv(env_names[l])) {
+          long long env_size = std::atoll(env);
+          size[l] = (env_size > 0) ? static_cast<size_t>(env_size) : 0;
+        }
+        if (size[l] == 0) {
+          size[l] = detail::query_cache_size(l + 1);
+        }
+        if (size[l] == 0) {
+          size[l] = defaults[l];
+        }
+      }
+    }
+  };
+  static const cache_sizes sizes;
+
+  int l = (level < 1) ? 0 : (level > 3) ? 2 : level - 1;
+  return sizes.size[l];
+}
+
+///
+/// NUMA domain of the cpu the calling thread runs on, 0 if unknown.
+///
+inline int get_numa_domain()
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return 0;
+}
+
+/*!
+ * \brief  Map from the chunks of a static partition to NUMA domains.
+ *
+ *          Chunk t is the contiguous range [chunk_begin[t], chunk_end[t]) of
+ *          elements owned by omp thread t under schedule(static), and
+ *          domain[t] is the NUMA domain that thread first touched its pages
+ *          from. OpenMP assigns the same chunks to the same threads for any
+ *          schedule(static) loop with the same trip count and number of
+ *          threads, so an omp_parallel_for_static_exec loop over the same
+ *          elements runs each chunk on memory local to its domain as long as
+ *          the threads stay bound (e.g. OMP_PROC_BIND=close).
+ */
+struct FirstTouchMap {
+  std::vector<Index_type> chunk_begin;
+  std::vector<Index_type> chunk_end;
+  std::vector<int> domain;
+
+  int num_chunks() const { return static_cast<int>(domain.size()); }
+
+  ///
+  /// Chunk that owns element i, -1 if i is outside every chunk.
+  ///
+  int chunk_of(Index_type i) const
+  {
+    for (int t = 0; t < num_chunks(); ++t) {
+      if (chunk_begin[t] <= i && i < chunk_end[t]) {
+        return t;
+      }
+    }
+    return -1;
+  }
+
+  ///
+  /// NUMA domain holding element i, -1 if i is outside every chunk.
+  ///
+  int domain_of(Index_type i) const
+  {
+    int t = chunk_of(i);
+    return (t < 0) ? -1 : domain[t];
+  }
+};
+
+///
+/// Touch the pages of an array of nbytes/elem_size elements with the omp
+/// thread that owns them under schedule(static), the partition used by
+/// omp_parallel_for_static_exec. Each page is written by the thread owning
+/// the element its first byte lies in, so under a first touch policy the
+/// page is placed in that thread's NUMA domain. The contents of the touched
+/// bytes are overwritten. If map is not null it is filled with the chunk of
+/// each thread and the domain it ran on.
+///
+inline void first_touch_static(void* ptr,
+                               size_t nbytes,
+                               size_t elem_size = 1,
+                               FirstTouchMap* map = nullptr)
+{
+  char* bytes = static_cast<char*>(ptr);
+  const std::uintptr_t page_size = get_page_size();
+  const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(bytes);
+  const Index_type len = static_cast<Index_type>(nbytes / elem_size);
+
+  int num_chunks = 1;
+#if defined(RAJA_ENABLE_OPENMP)
+  num_chunks = omp_get_max_threads();
+#endif
+  if (map) {
+    map->chunk_begin.assign(num_chunks, 0);
+    map->chunk_end.assign(num_chunks, 0);
+    map->domain.assign(num_chunks, 0);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+  {
+    int tid = 0;
+#if defined(RAJA_ENABLE_OPENMP)
+    tid = omp_get_thread_num();
+#endif
+    Index_type begin = len;
+    Index_type end = 0;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(static) nowait
+#endif
+    for (Index_type i = 0; i < len; ++i) {
+      std::uintptr_t elem = base + static_cast<std::uintptr_t>(i) * elem_size;
+      // the array may not start on a page boundary
+      if (i == 0) {
+        bytes[0] = 0;
+      }
+      std::uintptr_t page = (elem + page_size - 1) / page_size * page_size;
+      for (; page < elem + elem_size; page += page_size) {
+        bytes[page - base] = 0;
+      }
+      if (i < begin) begin = i;
+      end = i + 1;
+    }
+
+    if (map && tid < num_chunks) {
+      map->chunk_begin[tid] = (begin < end) ? begin : 0;
+      map->chunk_end[tid] = end;
+      map->domain[tid] = get_numa_domain();
+    }
+  }
+
+  // trailing bytes that do not make up a whole element
+  for (size_t b = static_cast<size_t>(len) * elem_size; b < nbytes; ++b) {
+    bytes[b] = 0;
+  }
+}
+
+///
+/// Allocate page aligned storage for len objects of type T and first touch
+/// it with first_touch_static so each page lands in the NUMA domain of the
+/// omp thread that owns it in an omp_parallel_for_static_exec loop over
+/// [0, len). The storage is uninitialized, free it with free_aligned.
+///
+template <typename T>
+inline T* allocate_first_touch(size_t len, FirstTouchMap* map = nullptr)
+{
+  void* ptr = allocate_aligned(get_page_size(), len * sizeof(T));
+  if (ptr) {
+    first_touch_static(ptr, len * sizeof(T), sizeof(T), map);
+  }
+  return static_cast<T*>(ptr);
+}
+
 ///
 /// Deleter function object for memory allocated with allocate_aligned
 ///
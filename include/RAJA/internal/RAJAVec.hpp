@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
@@ -31,6 +32,36 @@
 namespace RAJA
 {
 
+namespace detail
+{
+
+//! Storage for the first N items of a RAJAVec
+template <typename T, std::size_t N>
+struct RAJAVecInlineBuffer
+{
+  T* inline_data()
+  {
+    return reinterpret_cast<T*>(m_inline_items);
+  }
+
+  const T* inline_data() const
+  {
+    return reinterpret_cast<const T*>(m_inline_items);
+  }
+
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline_items[N];
+};
+
+template <typename T>
+struct RAJAVecInlineBuffer<T, 0>
+{
+  T* inline_data() { return nullptr; }
+
+  const T* inline_data() const { return nullptr; }
+};
+
+}  // namespace detail
+
 /*!
  ******************************************************************************
  *
@@ -45,12 +76,18 @@ namespace RAJA
  *               Template type should support standard semantics for
  *               copy, swap, etc.
  *
+ *               Up to InlineCapacity items are stored in the vector object
+ *               itself, so small vectors do not allocate. Items stored
+ *               inline are moved, not stolen, by move and swap operations.
+ *
  *               Note that this class has no exception safety guarantees.
  *
  ******************************************************************************
  */
-template <typename T, typename Allocator = std::allocator<T> >
-class RAJAVec
+template <typename T,
+          typename Allocator = std::allocator<T>,
+          std::size_t InlineCapacity = 0>
+class RAJAVec : private detail::RAJAVecInlineBuffer<T, InlineCapacity>
 {
   using allocator_traits_type = std::allocator_traits<Allocator>;
   using propagate_on_container_copy_assignment =
@@ -76,7 +113,10 @@ public:
   ///
   explicit RAJAVec(size_type init_cap = 0,
                    const allocator_type& a = allocator_type())
-      : m_data(nullptr), m_allocator(a), m_capacity(0), m_size(0)
+      : m_data(this->inline_data()),
+        m_allocator(a),
+        m_capacity(InlineCapacity),
+        m_size(0)
   {
     reserve(init_cap);
   }
@@ -85,9 +125,9 @@ public:
   /// Copy ctor for vector.
   ///
   RAJAVec(const RAJAVec& other)
-      : m_data(nullptr),
+      : m_data(this->inline_data()),
         m_allocator(allocator_traits_type::select_on_container_copy_construction(other.m_allocator)),
-        m_capacity(0),
+        m_capacity(InlineCapacity),
         m_size(0)
   {
     reserve(other.size());
@@ -98,14 +138,12 @@ public:
   /// Move ctor for vector.
   ///
   RAJAVec(RAJAVec&& other)
-      : m_data(other.m_data),
+      : m_data(this->inline_data()),
         m_allocator(std::move(other.m_allocator)),
-        m_capacity(other.m_capacity),
-        m_size(other.m_size)
+        m_capacity(InlineCapacity),
+        m_size(0)
   {
-    other.m_data = nullptr;
-    other.m_capacity = 0;
-    other.m_size = 0;
+    take_storage(other);
   }
 
   ///
@@ -341,14 +379,8 @@ private:
     clear();
     shrink_to_fit();
 
-    m_data = rhs.m_data;
     m_allocator = std::move(rhs.m_allocator);
-    m_capacity = rhs.m_capacity;
-    m_size = rhs.m_size;
-
-    rhs.m_data = nullptr;
-    rhs.m_capacity = 0;
-    rhs.m_size = 0;
+    take_storage(rhs);
   }
 
   ///
@@ -361,13 +393,7 @@ private:
       clear();
       shrink_to_fit();
 
-      m_data = rhs.m_data;
-      m_capacity = rhs.m_capacity;
-      m_size = rhs.m_size;
-
-      rhs.m_data = nullptr;
-      rhs.m_capacity = 0;
-      rhs.m_size = 0;
+      take_storage(rhs);
     } else {
       reserve(rhs.size());
       if (size() < rhs.size()) {
@@ -386,10 +412,8 @@ private:
   void swap_private(RAJAVec& other, std::true_type)
   {
     using std::swap;
-    swap(m_data,      other.m_data);
+    swap_storage(other);
     swap(m_allocator, other.m_allocator);
-    swap(m_capacity,  other.m_capacity);
-    swap(m_size,      other.m_size);
   }
 
   ///
@@ -397,10 +421,54 @@ private:
   ///
   void swap_private(RAJAVec& other, std::false_type)
   {
-    using std::swap;
-    swap(m_data,      other.m_data);
-    swap(m_capacity,  other.m_capacity);
-    swap(m_size,      other.m_size);
+    swap_storage(other);
+  }
+
+  ///
+  /// Swap the items of two vectors, exchanging allocated buffers and moving
+  /// items stored inline.
+  ///
+  void swap_storage(RAJAVec& other)
+  {
+    if (!is_inline() && !other.is_inline()) {
+      using std::swap;
+      swap(m_data,      other.m_data);
+      swap(m_capacity,  other.m_capacity);
+      swap(m_size,      other.m_size);
+    } else {
+      RAJAVec tmp(0, m_allocator);
+      tmp.take_storage(*this);
+      take_storage(other);
+      other.take_storage(tmp);
+    }
+  }
+
+  ///
+  /// Return true if the items are stored in the vector object.
+  ///
+  bool is_inline() const
+  {
+    return InlineCapacity > 0 && m_data == this->inline_data();
+  }
+
+  ///
+  /// Take the items of other, leaving it empty.
+  /// NOTE: assumes this vector is empty and uses its inline storage
+  ///
+  void take_storage(RAJAVec& other)
+  {
+    if (other.is_inline()) {
+      move_construct_items_back(other.size(), other.data());
+      other.clear();
+    } else {
+      m_data = other.m_data;
+      m_capacity = other.m_capacity;
+      m_size = other.m_size;
+
+      other.m_data = other.inline_data();
+      other.m_capacity = InlineCapacity;
+      other.m_size = 0;
+    }
   }
 
   //
@@ -536,14 +604,21 @@ private:
   }
 
   //
-  // Reallocate to change capacity to next_cap.
+  // Reallocate to change capacity to next_cap, using the inline storage
+  // when next_cap fits in it.
   // NOTE: assumes next_cap >= size()
   //
   void change_cap(size_type next_cap)
   {
-    pointer tdata = nullptr;
-    if (next_cap != 0) {
+    pointer tdata = this->inline_data();
+    if (next_cap > InlineCapacity) {
       tdata = allocator_traits_type::allocate(m_allocator, next_cap);
+    } else {
+      next_cap = InlineCapacity;
+    }
+
+    if (tdata == m_data) {
+      return;
     }
 
     if (m_data) {
@@ -551,7 +626,9 @@ private:
         allocator_traits_type::construct(m_allocator, tdata+i, std::move(m_data[i]));
         allocator_traits_type::destroy(m_allocator, m_data+i);
       }
-      allocator_traits_type::deallocate(m_allocator, m_data, m_capacity);
+      if (!is_inline()) {
+        allocator_traits_type::deallocate(m_allocator, m_data, m_capacity);
+      }
     }
 
     m_data = tdata;
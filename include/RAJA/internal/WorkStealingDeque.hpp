@@ -0,0 +1,164 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a fixed capacity work-stealing deque
+ *          used to schedule nodes in a task dependency graph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_WorkStealingDeque_HPP
+#define RAJA_WorkStealingDeque_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Chase-Lev work-stealing deque with a fixed capacity.
+ *
+ *         The owning thread pushes and pops at the bottom, other threads
+ *         steal from the top. The capacity is fixed at construction, which
+ *         is sufficient when the total number of pushes is bounded, e.g.
+ *         by the number of nodes in a task graph.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class WorkStealingDeque
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WorkStealingDeque requires a trivially copyable type");
+
+public:
+  ///
+  /// Construct an empty deque that holds at least capacity items.
+  ///
+  explicit WorkStealingDeque(std::ptrdiff_t capacity)
+      : m_mask(round_up_pow2(capacity) - 1),
+        m_items(new std::atomic<T>[m_mask + 1]),
+        m_top(0),
+        m_bottom(0)
+  {
+  }
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  ///
+  /// Push an item onto the bottom of the deque, only called by the owner.
+  /// Returns false if the deque is full.
+  ///
+  bool push(T item)
+  {
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t t = m_top.load(std::memory_order_acquire);
+    if (b - t > m_mask) {
+      return false;
+    }
+    m_items[b & m_mask].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  ///
+  /// Pop an item from the bottom of the deque, only called by the owner.
+  /// Returns false if the deque is empty.
+  ///
+  bool pop(T& item)
+  {
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t t = m_top.load(std::memory_order_relaxed);
+
+    bool found = false;
+    if (t <= b) {
+      item = m_items[b & m_mask].load(std::memory_order_relaxed);
+      found = true;
+      if (t == b) {
+        // last item, race with thieves
+        found = m_top.compare_exchange_strong(t,
+                                              t + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+      }
+    } else {
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return found;
+  }
+
+  ///
+  /// Steal an item from the top of the deque, may be called by any thread.
+  /// Returns false if the deque is empty or the steal lost a race.
+  ///
+  bool steal(T& item)
+  {
+    std::ptrdiff_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_acquire);
+
+    if (t < b) {
+      item = m_items[t & m_mask].load(std::memory_order_relaxed);
+      return m_top.compare_exchange_strong(t,
+                                           t + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+  ///
+  /// Approximate number of items in the deque.
+  ///
+  std::ptrdiff_t size() const
+  {
+    std::ptrdiff_t b = m_bottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t t = m_top.load(std::memory_order_relaxed);
+    return (b > t) ? b - t : 0;
+  }
+
+  ///
+  /// Capacity of the deque.
+  ///
+  std::ptrdiff_t capacity() const { return m_mask + 1; }
+
+private:
+  static std::ptrdiff_t round_up_pow2(std::ptrdiff_t n)
+  {
+    std::ptrdiff_t p = 1;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  std::ptrdiff_t m_mask;
+  std::unique_ptr<std::atomic<T>[]> m_items;
+  std::atomic<std::ptrdiff_t> m_top;
+  std::atomic<std::ptrdiff_t> m_bottom;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
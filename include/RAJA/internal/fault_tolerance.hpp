@@ -15,6 +15,11 @@
  *          signal handler that sets a global variable, fault_type,
  *          when a fault occurs. fault_type must be initialized to zero.
  *
+ *          The RAJA::ft_exec policy in RAJA/policy/FaultTolerance.hpp
+ *          checkpoints the outputs of each chunk of a loop and reruns
+ *          only the chunk that faulted, so it does not need idempotent
+ *          loop bodies.
+ *
  ******************************************************************************
  */
 
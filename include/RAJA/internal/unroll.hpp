@@ -0,0 +1,74 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with helpers for compile-time loop unrolling.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_internal_unroll_HPP
+#define RAJA_internal_unroll_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*!
+ * Calls body(i0+I) for each I in the sequence, in order.
+ *
+ * The calls are expanded at compile time, so the compiler sees straight
+ * line code with constant offsets instead of a loop.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename IdxType, typename Body, camp::idx_t... I>
+RAJA_HOST_DEVICE RAJA_INLINE void unroll_sequence(IdxType i0,
+                                                  Body &&body,
+                                                  camp::idx_seq<I...>)
+{
+  // the braced initializer list guarantees left to right evaluation
+  int expand[] = {0, (body(static_cast<IdxType>(i0 + IdxType(I))), 0)...};
+  RAJA_UNUSED_VAR(expand);
+}
+
+/*!
+ * Calls body(i) for each i in [0, len), with the loop unrolled by N.
+ *
+ * Blocks of N calls are expanded at compile time and any remaining
+ * len % N calls are made by a plain loop, so when len == N the whole loop
+ * is expanded.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <camp::idx_t N, typename IdxType, typename Body>
+RAJA_HOST_DEVICE RAJA_INLINE void unroll_loop(IdxType len, Body &&body)
+{
+  static_assert(N > 0, "unroll factor must be positive");
+
+  IdxType i = 0;
+  for (; i + IdxType(N) <= len; i += IdxType(N)) {
+    unroll_sequence(i, body, camp::make_idx_seq_t<N>{});
+  }
+  for (; i < len; ++i) {
+    body(i);
+  }
+}
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif
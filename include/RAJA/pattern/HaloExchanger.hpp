@@ -0,0 +1,372 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA HaloExchanger, which packs and unpacks
+ *          halo messages with WorkGroup.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_HaloExchanger_HPP
+#define RAJA_PATTERN_HaloExchanger_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/WorkGroup.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * Loop body copying the halo values of one variable into a message buffer.
+ * A null list packs the contiguous values starting at var.
+ */
+template <typename T, typename INDEX_T>
+struct HaloPacker {
+  T* buffer;
+  T const* var;
+  INDEX_T const* list;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(INDEX_T i) const
+  {
+    buffer[i] = var[list ? list[i] : i];
+  }
+};
+
+/*!
+ * Loop body copying the values of one variable out of a message buffer into
+ * its halo. A null list unpacks to the contiguous values starting at var.
+ */
+template <typename T, typename INDEX_T>
+struct HaloUnpacker {
+  T* var;
+  T const* buffer;
+  INDEX_T const* list;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(INDEX_T i) const
+  {
+    var[list ? list[i] : i] = buffer[i];
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Packs and unpacks the halo messages of a set of variables.
+ *
+ * Neighbors are added with the indices of the variable values sent to them
+ * (pack list) and received from them (unpack list). The message of a
+ * neighbor holds the packed values of each variable in turn. Lists made of
+ * long runs of consecutive indices are stored as runs and copied without
+ * indirection, other lists are copied once to memory of the resource.
+ *
+ * The message buffers are allocated once, in one block of memory of the
+ * resource each for sends and receives, and the loops of all neighbors and
+ * variables are enqueued once into a WorkGroup. Each pack or unpack is then
+ * a single run of that WorkGroup, e.g. one kernel launch with cuda_work,
+ * into and out of buffers that can be passed to GPU-aware MPI directly.
+ *
+ *   using exchanger = RAJA::expt::HaloExchanger<workgroup_policy, double,
+ *                                               int, pinned_allocator<char>>;
+ *   exchanger halo(res, pinned_allocator<char>{});
+ *   for (double* var : vars) halo.add_variable(var);
+ *   for (int n = 0; n < num_neighbors; ++n) {
+ *     halo.add_neighbor(pack_lists[n], unpack_lists[n]);
+ *   }
+ *
+ *   halo.pack(res);
+ *   res.wait();
+ *   // MPI_Isend(halo.send_buffer(n), halo.send_size(n), ...) and
+ *   // MPI_Irecv(halo.recv_buffer(n), halo.recv_size(n), ...) for each n
+ *   halo.unpack(res);
+ *
+ * With direct_dispatch the dispatch policy of WORKGROUP_POLICY_T must list
+ * the segment_type and the pack_body_type and unpack_body_type loop bodies.
+ *
+ ******************************************************************************
+ */
+template <typename WORKGROUP_POLICY_T,
+          typename T,
+          typename INDEX_T = int,
+          typename ALLOCATOR_T = std::allocator<char>>
+class HaloExchanger
+{
+public:
+  using value_type = T;
+  using index_type = INDEX_T;
+  using segment_type = TypedRangeSegment<INDEX_T>;
+  using pack_body_type = HaloPacker<T, INDEX_T>;
+  using unpack_body_type = HaloUnpacker<T, INDEX_T>;
+
+  using workpool_type = WorkPool<WORKGROUP_POLICY_T, INDEX_T, xargs<>, ALLOCATOR_T>;
+  using workgroup_type = WorkGroup<WORKGROUP_POLICY_T, INDEX_T, xargs<>, ALLOCATOR_T>;
+  using worksite_type = WorkSite<WORKGROUP_POLICY_T, INDEX_T, xargs<>, ALLOCATOR_T>;
+  using resource_type = typename workpool_type::resource_type;
+
+  //! lists with runs of at least this average length are stored as runs
+  static constexpr size_t min_average_run_length = 32;
+
+  explicit HaloExchanger(resource_type r = resource_type::get_default(),
+                         ALLOCATOR_T const& aloc = ALLOCATOR_T{})
+    : m_res(r)
+    , m_aloc(aloc)
+  { }
+
+  HaloExchanger(HaloExchanger const&) = delete;
+  HaloExchanger& operator=(HaloExchanger const&) = delete;
+
+  ~HaloExchanger()
+  {
+    release();
+  }
+
+  //! add a variable to the messages, returns its number
+  int add_variable(T* var)
+  {
+    release();
+    m_vars.push_back(var);
+    return static_cast<int>(m_vars.size()) - 1;
+  }
+
+  /*!
+   * Add a neighbor with host arrays of the indices of the values sent to and
+   * received from it, returns its number.
+   */
+  int add_neighbor(INDEX_T const* pack_list, size_t pack_len,
+                   INDEX_T const* unpack_list, size_t unpack_len)
+  {
+    release();
+    m_neighbors.emplace_back();
+    neighbor& nbr = m_neighbors.back();
+    nbr.send.indices.assign(pack_list, pack_list + pack_len);
+    nbr.recv.indices.assign(unpack_list, unpack_list + unpack_len);
+    return static_cast<int>(m_neighbors.size()) - 1;
+  }
+
+  int add_neighbor(std::vector<INDEX_T> const& pack_list,
+                   std::vector<INDEX_T> const& unpack_list)
+  {
+    return add_neighbor(pack_list.data(), pack_list.size(),
+                        unpack_list.data(), unpack_list.size());
+  }
+
+  size_t num_variables() const { return m_vars.size(); }
+
+  size_t num_neighbors() const { return m_neighbors.size(); }
+
+  /*!
+   * Allocate the buffers and lists and enqueue the pack and unpack loops.
+   * Called by the first pack or unpack after a variable or neighbor is
+   * added, call it earlier to get the buffer pointers before that.
+   */
+  void setup()
+  {
+    if (m_pack_group) { return; }
+
+    size_t send_total = 0;
+    size_t recv_total = 0;
+    for (neighbor& nbr : m_neighbors) {
+      nbr.send.offset = send_total;
+      nbr.recv.offset = recv_total;
+      send_total += m_vars.size() * nbr.send.indices.size();
+      recv_total += m_vars.size() * nbr.recv.indices.size();
+      setup_list(nbr.send);
+      setup_list(nbr.recv);
+    }
+
+    m_send_buffer = m_res.template allocate<T>(send_total);
+    m_recv_buffer = m_res.template allocate<T>(recv_total);
+    // the lists are copied from host memory
+    m_res.wait();
+
+    workpool_type pack_pool(m_aloc);
+    workpool_type unpack_pool(m_aloc);
+
+    for (neighbor& nbr : m_neighbors) {
+      T* send = m_send_buffer + nbr.send.offset;
+      T* recv = m_recv_buffer + nbr.recv.offset;
+      for (T* var : m_vars) {
+        enqueue_list(nbr.send, [&](INDEX_T len, INDEX_T buffer_offset,
+                                   INDEX_T var_offset, INDEX_T const* list) {
+          pack_pool.enqueue(segment_type(0, len),
+                            pack_body_type{send + buffer_offset,
+                                           var + var_offset,
+                                           list});
+        });
+        enqueue_list(nbr.recv, [&](INDEX_T len, INDEX_T buffer_offset,
+                                   INDEX_T var_offset, INDEX_T const* list) {
+          unpack_pool.enqueue(segment_type(0, len),
+                              unpack_body_type{var + var_offset,
+                                               recv + buffer_offset,
+                                               list});
+        });
+        send += nbr.send.indices.size();
+        recv += nbr.recv.indices.size();
+      }
+    }
+
+    m_pack_group.reset(new workgroup_type(pack_pool.instantiate()));
+    m_unpack_group.reset(new workgroup_type(unpack_pool.instantiate()));
+  }
+
+  //! pack the halo values of all variables into the send buffers
+  resources::EventProxy<resource_type> pack(resource_type r)
+  {
+    setup();
+    m_pack_site.reset(new worksite_type(m_pack_group->run(r)));
+    return resources::EventProxy<resource_type>(r);
+  }
+
+  resources::EventProxy<resource_type> pack() { return pack(m_res); }
+
+  //! unpack the receive buffers into the halo values of all variables
+  resources::EventProxy<resource_type> unpack(resource_type r)
+  {
+    setup();
+    m_unpack_site.reset(new worksite_type(m_unpack_group->run(r)));
+    return resources::EventProxy<resource_type>(r);
+  }
+
+  resources::EventProxy<resource_type> unpack() { return unpack(m_res); }
+
+  //! the message sent to neighbor n, in memory of the resource
+  T* send_buffer(int n) const { return m_send_buffer + m_neighbors[n].send.offset; }
+
+  //! the message received from neighbor n, in memory of the resource
+  T* recv_buffer(int n) const { return m_recv_buffer + m_neighbors[n].recv.offset; }
+
+  //! the number of values sent to neighbor n
+  size_t send_size(int n) const
+  {
+    return m_vars.size() * m_neighbors[n].send.indices.size();
+  }
+
+  //! the number of values received from neighbor n
+  size_t recv_size(int n) const
+  {
+    return m_vars.size() * m_neighbors[n].recv.indices.size();
+  }
+
+private:
+  struct index_run {
+    INDEX_T first;
+    INDEX_T begin;
+    INDEX_T end;
+  };
+
+  struct message_list {
+    std::vector<INDEX_T> indices;
+    std::vector<index_run> runs;
+    INDEX_T* list = nullptr;
+    size_t offset = 0;
+  };
+
+  struct neighbor {
+    message_list send;
+    message_list recv;
+  };
+
+  resource_type m_res;
+  ALLOCATOR_T m_aloc;
+
+  std::vector<T*> m_vars;
+  std::vector<neighbor> m_neighbors;
+
+  T* m_send_buffer = nullptr;
+  T* m_recv_buffer = nullptr;
+
+  std::unique_ptr<workgroup_type> m_pack_group;
+  std::unique_ptr<workgroup_type> m_unpack_group;
+  std::unique_ptr<worksite_type> m_pack_site;
+  std::unique_ptr<worksite_type> m_unpack_site;
+
+  //! store the list as runs, or copy it to memory of the resource
+  void setup_list(message_list& ml)
+  {
+    ml.runs.clear();
+    const size_t len = ml.indices.size();
+    for (size_t i = 0; i < len; ++i) {
+      if (i == 0 || ml.indices[i] != ml.indices[i - 1] + 1) {
+        ml.runs.push_back(index_run{ml.indices[i],
+                                    static_cast<INDEX_T>(i),
+                                    static_cast<INDEX_T>(i)});
+      }
+      ml.runs.back().end = static_cast<INDEX_T>(i + 1);
+    }
+    if (ml.runs.size() * min_average_run_length > len) {
+      ml.runs.clear();
+      ml.list = m_res.template allocate<INDEX_T>(len);
+      m_res.memcpy(ml.list, ml.indices.data(), len * sizeof(INDEX_T));
+    }
+  }
+
+  /*!
+   * Call enqueue(len, buffer_offset, var_offset, list) for each loop of a
+   * message list of one variable, a list is copied in one loop and each run
+   * in a loop without list.
+   */
+  template <typename Enqueue>
+  static void enqueue_list(message_list const& ml, Enqueue&& enqueue)
+  {
+    if (ml.list) {
+      enqueue(static_cast<INDEX_T>(ml.indices.size()), INDEX_T(0), INDEX_T(0),
+              ml.list);
+    } else {
+      for (index_run const& run : ml.runs) {
+        enqueue(run.end - run.begin, run.begin, run.first, nullptr);
+      }
+    }
+  }
+
+  void release_list(message_list& ml)
+  {
+    if (ml.list) {
+      m_res.deallocate(ml.list);
+      ml.list = nullptr;
+    }
+  }
+
+  //! free the buffers and loops, they are set up again on next use
+  void release()
+  {
+    if (!m_pack_group) { return; }
+    m_res.wait();
+    m_pack_site.reset();
+    m_unpack_site.reset();
+    m_pack_group.reset();
+    m_unpack_group.reset();
+    for (neighbor& nbr : m_neighbors) {
+      release_list(nbr.send);
+      release_list(nbr.recv);
+    }
+    m_res.deallocate(m_send_buffer);
+    m_res.deallocate(m_recv_buffer);
+    m_send_buffer = nullptr;
+    m_recv_buffer = nullptr;
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -22,8 +22,10 @@
 
 #include "RAJA/pattern/WorkGroup/WorkStorage.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
+#include "RAJA/pattern/WorkGroup/WorkGraph.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/metrics.hpp"
 #include "RAJA/util/plugins.hpp"
 
 namespace RAJA
@@ -130,6 +132,9 @@ struct WorkPool {
  * data. Because the WorkGroup owns a collection of loops it must not be
  * destroyed before that collection of loops has finished running. The
  * WorkGroup can be used to run its collection of loops multiple times.
+ * On resources that support it the WorkGroup can instead capture a run with
+ * instantiate_graph, creating a WorkSite that replays the captured run
+ * without repeating the host side setup of the run.
  *
  * Usage example:
  *
@@ -139,6 +144,10 @@ struct WorkPool {
 
    WorkSite<WorkGroup_policy, Index_type, xargs<>, Allocator> site = group.run();
 
+   WorkSite<WorkGroup_policy, Index_type, xargs<>, Allocator> graph_site = group.instantiate_graph(r);
+
+   graph_site.replay();
+
  * \endverbatim
  *
  ******************************************************************************
@@ -352,6 +361,13 @@ public:
     return run(r, std::move(args)...);
   }
 
+  ///
+  /// capture a run on r with the given args into a graph without executing it
+  /// the returned WorkSite executes the captured run each time replay is called
+  /// note that the args are fixed at capture time
+  ///
+  inline worksite_type instantiate_graph(resource_type r, Args...);
+
   void clear()
   {
     // storage is about to be destroyed
@@ -423,6 +439,18 @@ public:
     return m_resource;
   }
 
+  ///
+  /// launch the run captured by WorkGroup::instantiate_graph again
+  /// the WorkGroup that created this WorkSite must still exist
+  ///
+  void replay()
+  {
+    static_assert(graph_type::supported,
+        "WorkSite: replay is not supported by this resource type");
+    m_graph.replay(m_resource,
+        RAJA::launch_is<exec_policy, RAJA::Launch::async>::value);
+  }
+
   void clear()
   {
     // resources is about to be released
@@ -435,13 +463,22 @@ public:
   }
 
 private:
+  using graph_type = detail::WorkGraph<resource_type>;
+
   per_run_storage m_run_storage;
   resource_type m_resource;
+  graph_type m_graph;
 
   explicit WorkSite(resource_type r, per_run_storage&& run_storage)
     : m_run_storage(std::move(run_storage))
     , m_resource(r)
   { }
+
+  WorkSite(resource_type r, per_run_storage&& run_storage, graph_type&& graph)
+    : m_run_storage(std::move(run_storage))
+    , m_resource(r)
+    , m_graph(std::move(graph))
+  { }
 };
 
 
@@ -496,6 +533,10 @@ WorkGroup<
                           ALLOCATOR_T>::resource_type r,
                       Args... args)
 {
+  RAJA_METRICS_ADD("workgroup.runs", 1);
+  RAJA_METRICS_ADD("workgroup.loops", m_storage.size());
+  RAJA_METRICS_ADD("workgroup.storage_bytes", m_storage.storage_size());
+
   util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
   util::callPreLaunchPlugins(context);
 
@@ -507,6 +548,51 @@ WorkGroup<
   return site;
 }
 
+template <typename EXEC_POLICY_T,
+          typename ORDER_POLICY_T,
+          typename STORAGE_POLICY_T,
+          typename DISPATCH_POLICY_T,
+          typename INDEX_T,
+          typename ... Args,
+          typename ALLOCATOR_T>
+inline
+typename WorkGroup<
+    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
+    INDEX_T,
+    xargs<Args...>,
+    ALLOCATOR_T>::worksite_type
+WorkGroup<
+    WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
+    INDEX_T,
+    xargs<Args...>,
+    ALLOCATOR_T>::instantiate_graph(typename WorkGroup<
+                          WorkGroupPolicy<EXEC_POLICY_T, ORDER_POLICY_T, STORAGE_POLICY_T, DISPATCH_POLICY_T>,
+                          INDEX_T,
+                          xargs<Args...>,
+                          ALLOCATOR_T>::resource_type r,
+                      Args... args)
+{
+  using graph_type = detail::WorkGraph<resource_type>;
+  static_assert(graph_type::supported,
+      "WorkGroup: instantiate_graph is not supported by this resource type");
+
+  util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
+  util::callPreLaunchPlugins(context);
+
+  graph_type graph;
+
+  // capture the run into the graph then move the graph and any per run
+  // storage into worksite
+  auto run_storage = graph.capture(r, [&]() {
+    return m_runner.run(m_storage, r, std::forward<Args>(args)...);
+  });
+  worksite_type site(r, std::move(run_storage), std::move(graph));
+
+  util::callPostLaunchPlugins(context);
+
+  return site;
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -56,7 +56,8 @@ struct DispatcherVoidConstPtrWrapper
 
 
 constexpr bool dispatcher_use_host_invoke(Platform platform) {
-  return !(platform == Platform::cuda || platform == Platform::hip);
+  return !(platform == Platform::cuda || platform == Platform::hip ||
+           platform == Platform::sycl);
 }
 
 // Transforms one dispatch policy into another by creating a dispatch policy
@@ -537,6 +538,10 @@ struct Dispatcher<platform, ::RAJA::direct_dispatch<T>, DispatcherID, CallArgs..
 /*!
  * Version of Dispatcher that does direct dispatch to multiple callable types.
  * It implements the interface with callable objects.
+ * The callable is selected by comparing the id with the id of each type in
+ * turn, the comparisons stop at the matching type and the last type needs no
+ * comparison, so the compiler sees a switch over the id and can inline the
+ * call operator of each type.
  */
 template < typename T0, typename T1, typename ... TNs,
            Platform platform, typename DispatcherID, typename ... CallArgs >
@@ -565,11 +570,26 @@ struct Dispatcher<platform, ::RAJA::direct_dispatch<T0, T1, TNs...>,
     }
 
   private:
-    template < int ... id_types, typename ... Ts >
-    void impl_helper(camp::int_seq<int, id_types...>, camp::list<Ts...>,
+    template < int id_type0, int id_type1, int ... id_types,
+               typename U0, typename U1, typename ... Us >
+    void impl_helper(camp::int_seq<int, id_type0, id_type1, id_types...>,
+              camp::list<U0, U1, Us...>,
               void_ptr_wrapper dest, void_ptr_wrapper src) const
     {
-      camp::sink(((id_types == id) ? (impl<Ts>(dest, src), 0) : 0)...);
+      if (id_type0 == id) {
+        impl<U0>(dest, src);
+      } else {
+        impl_helper(camp::int_seq<int, id_type1, id_types...>{},
+                    camp::list<U1, Us...>{},
+                    dest, src);
+      }
+    }
+    ///
+    template < int id_type0, typename U0 >
+    void impl_helper(camp::int_seq<int, id_type0>, camp::list<U0>,
+              void_ptr_wrapper dest, void_ptr_wrapper src) const
+    {
+      impl<U0>(dest, src);
     }
 
     template < typename T >
@@ -595,11 +615,26 @@ struct Dispatcher<platform, ::RAJA::direct_dispatch<T0, T1, TNs...>,
     }
 
   private:
-    template < int ... id_types, typename ... Ts >
-    void impl_helper(camp::int_seq<int, id_types...>, camp::list<Ts...>,
+    template < int id_type0, int id_type1, int ... id_types,
+               typename U0, typename U1, typename ... Us >
+    void impl_helper(camp::int_seq<int, id_type0, id_type1, id_types...>,
+              camp::list<U0, U1, Us...>,
+              void_cptr_wrapper obj, CallArgs... args) const
+    {
+      if (id_type0 == id) {
+        impl<U0>(obj, std::forward<CallArgs>(args)...);
+      } else {
+        impl_helper(camp::int_seq<int, id_type1, id_types...>{},
+                    camp::list<U1, Us...>{},
+                    obj, std::forward<CallArgs>(args)...);
+      }
+    }
+    ///
+    template < int id_type0, typename U0 >
+    void impl_helper(camp::int_seq<int, id_type0>, camp::list<U0>,
               void_cptr_wrapper obj, CallArgs... args) const
     {
-      camp::sink(((id_types == id) ? (impl<Ts>(obj, std::forward<CallArgs>(args)...), 0) : 0)...);
+      impl<U0>(obj, std::forward<CallArgs>(args)...);
     }
 
     template < typename T >
@@ -619,11 +654,26 @@ struct Dispatcher<platform, ::RAJA::direct_dispatch<T0, T1, TNs...>,
     }
 
   private:
-    template < int ... id_types, typename ... Ts >
-    RAJA_DEVICE void impl_helper(camp::int_seq<int, id_types...>, camp::list<Ts...>,
+    template < int id_type0, int id_type1, int ... id_types,
+               typename U0, typename U1, typename ... Us >
+    RAJA_DEVICE void impl_helper(camp::int_seq<int, id_type0, id_type1, id_types...>,
+              camp::list<U0, U1, Us...>,
               void_cptr_wrapper obj, CallArgs... args) const
     {
-      camp::sink(((id_types == id) ? (impl<Ts>(obj, std::forward<CallArgs>(args)...), 0) : 0)...);
+      if (id_type0 == id) {
+        impl<U0>(obj, std::forward<CallArgs>(args)...);
+      } else {
+        impl_helper(camp::int_seq<int, id_type1, id_types...>{},
+                    camp::list<U1, Us...>{},
+                    obj, std::forward<CallArgs>(args)...);
+      }
+    }
+    ///
+    template < int id_type0, typename U0 >
+    RAJA_DEVICE void impl_helper(camp::int_seq<int, id_type0>, camp::list<U0>,
+              void_cptr_wrapper obj, CallArgs... args) const
+    {
+      impl<U0>(obj, std::forward<CallArgs>(args)...);
     }
 
     template < typename T >
@@ -650,11 +700,26 @@ struct Dispatcher<platform, ::RAJA::direct_dispatch<T0, T1, TNs...>,
     }
 
   private:
-    template < int ... id_types, typename ... Ts >
-    void impl_helper(camp::int_seq<int, id_types...>, camp::list<Ts...>,
+    template < int id_type0, int id_type1, int ... id_types,
+               typename U0, typename U1, typename ... Us >
+    void impl_helper(camp::int_seq<int, id_type0, id_type1, id_types...>,
+              camp::list<U0, U1, Us...>,
+              void_ptr_wrapper obj) const
+    {
+      if (id_type0 == id) {
+        impl<U0>(obj);
+      } else {
+        impl_helper(camp::int_seq<int, id_type1, id_types...>{},
+                    camp::list<U1, Us...>{},
+                    obj);
+      }
+    }
+    ///
+    template < int id_type0, typename U0 >
+    void impl_helper(camp::int_seq<int, id_type0>, camp::list<U0>,
               void_ptr_wrapper obj) const
     {
-      camp::sink(((id_types == id) ? (impl<Ts>(obj), 0) : 0)...);
+      impl<U0>(obj);
     }
 
     template < typename T >
@@ -0,0 +1,48 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA WorkGraph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_WORKGROUP_WorkGraph_HPP
+#define RAJA_PATTERN_WORKGROUP_WorkGraph_HPP
+
+#include "RAJA/config.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * A captured run of a WorkGroup that can be replayed on a resource of type
+ * RESOURCE_T without repeating the host side setup of the run.
+ *
+ * This generic version is used by resources that have no way to capture
+ * work and so does not support capture or replay. Backends that support
+ * capture specialize this class template and set supported to true.
+ */
+template < typename RESOURCE_T >
+struct WorkGraph
+{
+  static constexpr bool supported = false;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
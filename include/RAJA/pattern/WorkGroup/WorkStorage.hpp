@@ -1041,6 +1041,396 @@ private:
   }
 };
 
+// arena of loop storage arrays shared by a WorkStorage and the WorkStorages
+// it is moved into, arrays released by one WorkStorage are kept and reused by
+// the next WorkStorage that needs storage instead of being deallocated
+template < typename ALLOCATOR_T >
+class WorkStorageArena
+{
+  using allocator_traits_type = std::allocator_traits<ALLOCATOR_T>;
+public:
+  using allocator_type = ALLOCATOR_T;
+  using size_type = std::size_t;
+
+private:
+  // struct used in arrays vector to retain pointer and allocation size
+  struct array_and_size
+  {
+    char* ptr;
+    size_type size;
+  };
+
+public:
+
+  explicit WorkStorageArena(allocator_type const& aloc)
+    : m_arrays(0, aloc)
+    , m_aloc(aloc)
+  { }
+
+  WorkStorageArena(WorkStorageArena const&) = delete;
+  WorkStorageArena& operator=(WorkStorageArena const&) = delete;
+
+  allocator_type const& get_allocator() const
+  {
+    return m_aloc;
+  }
+
+  // get an array of at least array_size bytes, reuses a released array if
+  // one is large enough and deallocates released arrays that are too small
+  // returns the pointer and the size of the array in bytes
+  array_and_size acquire(size_type array_size)
+  {
+    while (!m_arrays.empty()) {
+      array_and_size array = m_arrays.back();
+      m_arrays.pop_back();
+      if (array.size >= array_size) {
+        return array;
+      }
+      allocator_traits_type::deallocate(m_aloc, array.ptr, array.size);
+    }
+    return array_and_size{allocator_traits_type::allocate(m_aloc, array_size),
+                          array_size};
+  }
+
+  // keep an array acquired from this arena for reuse
+  void release(char* ptr, size_type array_size)
+  {
+    m_arrays.emplace_back(array_and_size{ptr, array_size});
+  }
+
+  // deallocate all of the released arrays
+  void clear()
+  {
+    while (!m_arrays.empty()) {
+      array_and_size array = m_arrays.back();
+      m_arrays.pop_back();
+      allocator_traits_type::deallocate(m_aloc, array.ptr, array.size);
+    }
+    m_arrays.shrink_to_fit();
+  }
+
+  ~WorkStorageArena()
+  {
+    clear();
+  }
+
+private:
+  RAJAVec<array_and_size, typename allocator_traits_type::template rebind_alloc<array_and_size>> m_arrays;
+  allocator_type m_aloc;
+};
+
+template < typename ALLOCATOR_T, typename Dispatcher_T >
+class WorkStorage<RAJA::persistent_ragged_array_of_objects, ALLOCATOR_T, Dispatcher_T>
+{
+  using allocator_traits_type = std::allocator_traits<ALLOCATOR_T>;
+  using propagate_on_container_copy_assignment =
+      typename allocator_traits_type::propagate_on_container_copy_assignment;
+  using propagate_on_container_move_assignment =
+      typename allocator_traits_type::propagate_on_container_move_assignment;
+  using propagate_on_container_swap            =
+      typename allocator_traits_type::propagate_on_container_swap;
+  static_assert(std::is_same<typename allocator_traits_type::value_type, char>::value,
+      "WorkStorage expects an allocator for 'char's.");
+public:
+  using storage_policy = RAJA::persistent_ragged_array_of_objects;
+  using dispatcher_type = Dispatcher_T;
+
+  template < typename holder >
+  using true_value_type = WorkStruct<sizeof(holder), dispatcher_type>;
+
+  using value_type = GenericWorkStruct<dispatcher_type>;
+  using allocator_type = ALLOCATOR_T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+private:
+  using arena_type = WorkStorageArena<allocator_type>;
+
+public:
+
+  // iterator base class for accessing stored WorkStructs outside of the container
+  struct const_iterator_base
+  {
+    using value_type = const typename WorkStorage::value_type;
+    using pointer = typename WorkStorage::const_pointer;
+    using reference = typename WorkStorage::const_reference;
+    using difference_type = typename WorkStorage::difference_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    const_iterator_base(const char* array_begin, const size_type* offset_iter)
+      : m_array_begin(array_begin)
+      , m_offset_iter(offset_iter)
+    { }
+
+    RAJA_HOST_DEVICE reference operator*() const
+    {
+      return *reinterpret_cast<pointer>(
+          m_array_begin + *m_offset_iter);
+    }
+
+    RAJA_HOST_DEVICE const_iterator_base& operator+=(difference_type n)
+    {
+      m_offset_iter += n;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE friend inline difference_type operator-(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_offset_iter - rhs_iter.m_offset_iter;
+    }
+
+    RAJA_HOST_DEVICE friend inline bool operator==(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_offset_iter == rhs_iter.m_offset_iter;
+    }
+
+    RAJA_HOST_DEVICE friend inline bool operator<(
+        const_iterator_base const& lhs_iter, const_iterator_base const& rhs_iter)
+    {
+      return lhs_iter.m_offset_iter < rhs_iter.m_offset_iter;
+    }
+
+  private:
+    const char* m_array_begin;
+    const size_type* m_offset_iter;
+  };
+
+  using const_iterator = random_access_iterator<const_iterator_base>;
+
+
+  explicit WorkStorage(allocator_type const& aloc)
+    : m_offsets(0, aloc)
+    , m_arena(std::make_shared<arena_type>(aloc))
+  { }
+
+  WorkStorage(WorkStorage const&) = delete;
+  WorkStorage& operator=(WorkStorage const&) = delete;
+
+  // the moved from storage keeps sharing the arena so the array may be
+  // reused by the moved from storage after this storage releases it
+  WorkStorage(WorkStorage&& rhs)
+    : m_offsets(std::move(rhs.m_offsets))
+    , m_array_begin(rhs.m_array_begin)
+    , m_array_end(rhs.m_array_end)
+    , m_array_cap(rhs.m_array_cap)
+    , m_arena(rhs.m_arena)
+  {
+    rhs.m_array_begin = nullptr;
+    rhs.m_array_end = nullptr;
+    rhs.m_array_cap = nullptr;
+  }
+
+  WorkStorage& operator=(WorkStorage&& rhs)
+  {
+    if (this != &rhs) {
+      move_assign_private(std::move(rhs), propagate_on_container_move_assignment{});
+    }
+    return *this;
+  }
+
+  // reserve space for num_loops in the array of offsets
+  // and space for loop_storage_size bytes of loop storage
+  void reserve(size_type num_loops, size_type loop_storage_size)
+  {
+    m_offsets.reserve(num_loops);
+    array_reserve(loop_storage_size);
+  }
+
+  // number of loops stored
+  size_type size() const
+  {
+    return m_offsets.size();
+  }
+
+  const_iterator begin() const
+  {
+    return const_iterator(m_array_begin, m_offsets.begin());
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(m_array_begin, m_offsets.end());
+  }
+
+  // number of bytes used for storage of loops
+  size_type storage_size() const
+  {
+    return m_array_end - m_array_begin;
+  }
+
+  template < typename holder, typename ... holder_ctor_args >
+  void emplace(const dispatcher_type* dispatcher, holder_ctor_args&&... ctor_args)
+  {
+    size_type value_offset = storage_size();
+    size_type value_size   = create_value<holder>(value_offset,
+        dispatcher, std::forward<holder_ctor_args>(ctor_args)...);
+    m_offsets.emplace_back(value_offset);
+    m_array_end += value_size;
+  }
+
+  // destroy loops and release storage to the arena for reuse
+  void clear()
+  {
+    array_clear();
+    if (m_array_begin != nullptr) {
+      m_arena->release(m_array_begin, storage_capacity());
+      m_array_begin = nullptr;
+      m_array_end   = nullptr;
+      m_array_cap   = nullptr;
+    }
+  }
+
+  ~WorkStorage()
+  {
+    clear();
+  }
+
+private:
+  RAJAVec<size_type, typename allocator_traits_type::template rebind_alloc<size_type>> m_offsets;
+  char* m_array_begin = nullptr;
+  char* m_array_end   = nullptr;
+  char* m_array_cap   = nullptr;
+  std::shared_ptr<arena_type> m_arena;
+
+  // move assignment if allocator propagates on move assignment
+  void move_assign_private(WorkStorage&& rhs, std::true_type)
+  {
+    clear();
+
+    m_offsets     = std::move(rhs.m_offsets);
+    m_array_begin = rhs.m_array_begin;
+    m_array_end   = rhs.m_array_end  ;
+    m_array_cap   = rhs.m_array_cap  ;
+    m_arena       = rhs.m_arena;
+
+    rhs.m_array_begin = nullptr;
+    rhs.m_array_end   = nullptr;
+    rhs.m_array_cap   = nullptr;
+  }
+
+  // move assignment if allocator does not propagate on move assignment
+  void move_assign_private(WorkStorage&& rhs, std::false_type)
+  {
+    clear();
+    if (m_arena->get_allocator() == rhs.m_arena->get_allocator()) {
+
+      m_offsets     = std::move(rhs.m_offsets);
+      m_array_begin = rhs.m_array_begin;
+      m_array_end   = rhs.m_array_end  ;
+      m_array_cap   = rhs.m_array_cap  ;
+      m_arena       = rhs.m_arena;
+
+      rhs.m_array_begin = nullptr;
+      rhs.m_array_end   = nullptr;
+      rhs.m_array_cap   = nullptr;
+    } else {
+      array_reserve(rhs.storage_size());
+
+      for (size_type i = 0; i < rhs.size(); ++i) {
+        m_array_end = m_array_begin + rhs.m_offsets[i];
+        move_destroy_value(m_array_end, rhs.m_array_begin + rhs.m_offsets[i]);
+        m_offsets.emplace_back(rhs.m_offsets[i]);
+      }
+      m_array_end = m_array_begin + rhs.storage_size();
+      rhs.m_array_end = rhs.m_array_begin;
+      rhs.m_offsets.clear();
+      rhs.clear();
+    }
+  }
+
+  // get loop storage capacity, used and unused in bytes
+  size_type storage_capacity() const
+  {
+    return m_array_cap - m_array_begin;
+  }
+
+  // get unused loop storage capacity in bytes
+  size_type storage_unused() const
+  {
+    return m_array_cap - m_array_end;
+  }
+
+  // reserve space for loop_storage_size bytes of loop storage
+  // using an array from the arena
+  void array_reserve(size_type loop_storage_size)
+  {
+    if (loop_storage_size > storage_capacity()) {
+
+      auto new_array = m_arena->acquire(loop_storage_size);
+      char* new_array_begin = new_array.ptr;
+      char* new_array_end   = new_array_begin + storage_size();
+      char* new_array_cap   = new_array_begin + new_array.size;
+
+      for (size_type i = 0; i < size(); ++i) {
+        move_destroy_value(new_array_begin + m_offsets[i],
+                             m_array_begin + m_offsets[i]);
+      }
+
+      if (m_array_begin != nullptr) {
+        m_arena->release(m_array_begin, storage_capacity());
+      }
+
+      m_array_begin = new_array_begin;
+      m_array_end   = new_array_end  ;
+      m_array_cap   = new_array_cap  ;
+    }
+  }
+
+  // destroy loop objects (does not release array storage)
+  void array_clear()
+  {
+    while (!m_offsets.empty()) {
+      destroy_value(m_offsets.back());
+      m_array_end = m_array_begin + m_offsets.back();
+      m_offsets.pop_back();
+    }
+    m_offsets.shrink_to_fit();
+  }
+
+  // ensure there is enough storage to hold the next loop body at value offset
+  // and store the loop body
+  template < typename holder, typename ... holder_ctor_args >
+  size_type create_value(size_type value_offset,
+                         const dispatcher_type* dispatcher,
+                         holder_ctor_args&&... ctor_args)
+  {
+    const size_type value_size = sizeof(true_value_type<holder>);
+
+    if (value_size > storage_unused()) {
+      array_reserve(std::max(storage_size() + value_size, 2*storage_capacity()));
+    }
+
+    pointer value_ptr = reinterpret_cast<pointer>(m_array_begin + value_offset);
+
+    value_type::template construct<holder>(
+        value_ptr, dispatcher, std::forward<holder_ctor_args>(ctor_args)...);
+
+    return value_size;
+  }
+
+  // move construct the loop body into value from other, and destroy the
+  // loop body in other
+  void move_destroy_value(char* value_ptr, char* other_value_ptr)
+  {
+    value_type::move_destroy(reinterpret_cast<pointer>(value_ptr),
+                             reinterpret_cast<pointer>(other_value_ptr));
+  }
+
+  // destroy the loop body at value offset
+  void destroy_value(size_type value_offset)
+  {
+    pointer value_ptr =
+        reinterpret_cast<pointer>(m_array_begin + value_offset);
+    value_type::destroy(value_ptr);
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
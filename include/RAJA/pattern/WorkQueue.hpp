@@ -0,0 +1,298 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing WorkQueue, a queue of heterogeneous
+ *          work items run by a persistent kernel whose items can push more
+ *          items.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_WorkQueue_HPP
+#define RAJA_pattern_WorkQueue_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/WorkGroup/Dispatcher.hpp"
+#include "RAJA/pattern/WorkGroup/WorkStruct.hpp"
+#include "RAJA/policy/WorkGroup.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! DispatcherID of the work queue dispatchers
+struct WorkQueueID {
+};
+
+//! counters of a work queue, they only grow during a run
+struct WorkQueueCounters {
+  unsigned long long taken;
+  unsigned long long pushed;
+  unsigned long long done;
+};
+
+template <typename... Items>
+struct work_queue_max_size;
+///
+template <>
+struct work_queue_max_size<> : std::integral_constant<size_t, 1> {
+};
+///
+template <typename Item, typename... Items>
+struct work_queue_max_size<Item, Items...>
+    : std::integral_constant<size_t,
+                             (sizeof(Item) > work_queue_max_size<Items...>::value)
+                                 ? sizeof(Item)
+                                 : work_queue_max_size<Items...>::value> {
+};
+
+//! index of Item in Items, which is the id direct_dispatch gives Item
+template <typename Item, typename... Items>
+struct work_queue_item_id;
+///
+template <typename Item>
+struct work_queue_item_id<Item> {
+  static_assert(!std::is_same<Item, Item>::value,
+                "Item must be one of the WorkQueue item types");
+};
+///
+template <typename Item, typename... Items>
+struct work_queue_item_id<Item, Item, Items...>
+    : std::integral_constant<int, 0> {
+};
+///
+template <typename Item, typename Other, typename... Items>
+struct work_queue_item_id<Item, Other, Items...>
+    : std::integral_constant<int, 1 + work_queue_item_id<Item, Items...>::value> {
+};
+
+// direct_dispatch of a single type has no id
+template <typename Invoker>
+RAJA_HOST_DEVICE constexpr Invoker make_work_queue_invoker(
+    int, std::integral_constant<size_t, 1>)
+{
+  return Invoker{};
+}
+///
+template <typename Invoker, size_t N>
+RAJA_HOST_DEVICE constexpr Invoker make_work_queue_invoker(
+    int id, std::integral_constant<size_t, N>)
+{
+  return Invoker{id};
+}
+
+//! order the writes of an item before the flag that publishes it
+RAJA_HOST_DEVICE RAJA_INLINE void work_queue_fence()
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  __threadfence();
+#elif !defined(__SYCL_DEVICE_ONLY__)
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Handle the work items of a WorkQueue are called with.
+ *
+ * Items call push to add more items to the queue, and may use thread and
+ * num_threads to share their work among the threads that run them.
+ */
+template <Platform platform, typename... Items>
+class WorkQueueContext
+{
+public:
+  using dispatcher_type =
+      ::RAJA::detail::Dispatcher<platform,
+                                 ::RAJA::direct_dispatch<Items...>,
+                                 detail::WorkQueueID,
+                                 WorkQueueContext>;
+  using slot_type =
+      ::RAJA::detail::WorkStruct<detail::work_queue_max_size<Items...>::value,
+                                 dispatcher_type>;
+
+  RAJA_HOST_DEVICE
+  WorkQueueContext(slot_type* slots,
+                   unsigned int* ready,
+                   detail::WorkQueueCounters* counters,
+                   size_t capacity,
+                   int thread = 0,
+                   int num_threads = 1)
+      : m_slots(slots),
+        m_ready(ready),
+        m_counters(counters),
+        m_capacity(capacity),
+        m_thread(thread),
+        m_num_threads(num_threads)
+  {
+  }
+
+  //! index of the calling thread among the threads running the item
+  RAJA_HOST_DEVICE int thread() const { return m_thread; }
+
+  //! number of threads running the item
+  RAJA_HOST_DEVICE int num_threads() const { return m_num_threads; }
+
+  //! add item to the queue, pushing more than capacity items is an error
+  template <typename Item>
+  RAJA_HOST_DEVICE void push(Item const& item) const
+  {
+    static_assert(std::is_trivially_copyable<Item>::value,
+                  "WorkQueue items are copied to and from device memory");
+
+    const unsigned long long i =
+        ::RAJA::atomicAdd<::RAJA::auto_atomic>(&m_counters->pushed, 1ull);
+    if (i >= m_capacity) {
+      RAJA_ABORT_OR_THROW("WorkQueue is full");
+    }
+
+    slot_type* slot = &m_slots[i];
+    slot->dispatcher = nullptr;
+    slot->invoke = detail::make_work_queue_invoker<
+        typename dispatcher_type::invoker_type>(
+        detail::work_queue_item_id<Item, Items...>::value,
+        std::integral_constant<size_t, sizeof...(Items)>{});
+    new (&slot->obj) Item(item);
+
+    detail::work_queue_fence();
+    ::RAJA::atomicExchange<::RAJA::auto_atomic>(&m_ready[i], 1u);
+  }
+
+private:
+  slot_type* m_slots;
+  unsigned int* m_ready;
+  detail::WorkQueueCounters* m_counters;
+  size_t m_capacity;
+  int m_thread;
+  int m_num_threads;
+};
+
+/*!
+ * \brief Queue of work items run by a persistent kernel, for irregular work
+ * like neighbor list builds or adaptive quadrature that forall can not
+ * balance.
+ *
+ * Items are trivially copyable callables of one of the types Items, called
+ * with a WorkQueueContext through the direct_dispatch Dispatcher of
+ * WorkGroup, and may push more items. enqueue adds items from the host
+ * before run(res), which runs items until every item pushed has finished.
+ * The queue holds capacity items per run.
+ *
+ *  - With cuda_exec and hip_exec policies run enqueues a persistent kernel
+ *    on res. Each block takes the next item in turn and all threads of the
+ *    block call it. The kernel exits once no item is running, so no more
+ *    can be pushed.
+ *  - With host policies run calls the items in order on the host.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   struct Interval {
+ *     double a, b;
+ *     double* total;
+ *     template <typename Context>
+ *     RAJA_HOST_DEVICE void operator()(Context const& ctx) const {
+ *       if (ctx.thread() != 0) return;
+ *       double m = 0.5 * (a + b);
+ *       if (error(a, b) > tol) {
+ *         ctx.push(Interval{a, m, total});
+ *         ctx.push(Interval{m, b, total});
+ *       } else {
+ *         RAJA::atomicAdd<RAJA::cuda_atomic>(total, simpson(a, b));
+ *       }
+ *     }
+ *   };
+ *
+ *   RAJA::expt::WorkQueue<RAJA::cuda_exec<256>, Interval> queue(1 << 20);
+ *   queue.enqueue(Interval{0.0, 1.0, total});
+ *   queue.run(res);
+ *
+ * \endverbatim
+ */
+template <typename EXEC_POLICY, typename... Items>
+class WorkQueue
+{
+public:
+  using context_type = WorkQueueContext<Platform::host, Items...>;
+  using slot_type = typename context_type::slot_type;
+
+  static_assert(sizeof...(Items) > 0, "WorkQueue needs an item type");
+
+  explicit WorkQueue(size_t capacity)
+      : m_slots(capacity), m_ready(capacity, 0u), m_capacity(capacity)
+  {
+  }
+
+  WorkQueue(WorkQueue const&) = delete;
+  WorkQueue& operator=(WorkQueue const&) = delete;
+
+  //! add item to the queue before the next run
+  template <typename Item>
+  void enqueue(Item const& item)
+  {
+    context().push(item);
+  }
+
+  //! number of items the next run starts with
+  size_t size() const { return static_cast<size_t>(m_counters.pushed); }
+
+  //! run the items in order, and the items they push, on the host
+  template <typename Res>
+  resources::EventProxy<Res> run(Res res)
+  {
+    context_type ctx = context();
+    while (m_counters.taken < m_counters.pushed) {
+      const unsigned long long i = m_counters.taken++;
+      slot_type::host_call(&m_slots[i], ctx);
+      ++m_counters.done;
+    }
+    m_counters = detail::WorkQueueCounters{0, 0, 0};
+    std::fill(m_ready.begin(), m_ready.end(), 0u);
+    return resources::EventProxy<Res>(res);
+  }
+
+private:
+  context_type context()
+  {
+    return context_type(m_slots.data(), m_ready.data(), &m_counters,
+                        m_capacity);
+  }
+
+  std::vector<slot_type> m_slots;
+  std::vector<unsigned int> m_ready;
+  detail::WorkQueueCounters m_counters{0, 0, 0};
+  size_t m_capacity;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -274,6 +274,45 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc, T compare, T value)
   return RAJA::atomicCAS(Policy{}, acc, compare, value);
 }
 
+
+namespace detail
+{
+
+/*!
+ * Atomic policy used by atomicReserve with Policy, the gpu policies
+ * specialize this to use their warp aggregated policies so that the threads
+ * in a warp reserving from the same counter perform a single atomic.
+ */
+template <typename Policy>
+struct atomic_reserve_policy {
+  using type = Policy;
+};
+
+}  // namespace detail
+
+/*!
+ * @brief Atomic reserve, reserves count items of a shared buffer
+ * @param counter Pointer to the number of items reserved in the buffer
+ * @param count Number of items to reserve
+ * @return Returns the offset of the first item reserved by this call.
+ *   The items from the returned offset to the offset + count are not reserved
+ *   by any other call on counter.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicReserve(Policy, T volatile *counter, T count)
+{
+  return RAJA::atomicAdd(typename detail::atomic_reserve_policy<Policy>::type{},
+                         counter, count);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicReserve(T volatile *counter, T count)
+{
+  return RAJA::atomicReserve(Policy{}, counter, count);
+}
+
 /*!
  * \brief Atomic wrapper object
  *
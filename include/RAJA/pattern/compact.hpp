@@ -0,0 +1,515 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  copy if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[out] num_selected Pointer or Random-Access Iterator to the location
+*the number of selected items is written to
+* \param[in] pred unary predicate that selects items
+*
+* Copies the items of in for which pred is true to the front of out,
+* keeping their order. The number of selected items is written to
+* num_selected, which must be accessible in the memory space of the
+* execution policy.
+*
+* \note{The range of in must be separate from out}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        Res r,
+        InContainer&& in,
+        OutContainer&& out,
+        CountIter num_selected,
+        Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  return impl::compact::copy_if(r, std::forward<ExecPolicy>(p),
+                                begin(in), end(in), begin(out),
+                                num_selected, pred);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename CountIter,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        InContainer&& in,
+        OutContainer&& out,
+        CountIter num_selected,
+        Predicate pred)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      num_selected,
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data, the same size
+*as in
+* \param[out] num_selected Pointer or Random-Access Iterator to the location
+*the number of selected items is written to
+* \param[in] pred unary predicate that selects items
+*
+* Copies the items of in for which pred is true to the front of out,
+* keeping their order, and the other items to the back of out in reverse
+* order. The number of selected items is written to num_selected, which
+* must be accessible in the memory space of the execution policy.
+*
+* \note{The range of in must be separate from out}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+partition(ExecPolicy&& p,
+          Res r,
+          InContainer&& in,
+          OutContainer&& out,
+          CountIter num_selected,
+          Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  return impl::compact::partition(r, std::forward<ExecPolicy>(p),
+                                  begin(in), end(in), begin(out),
+                                  num_selected, pred);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename CountIter,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+partition(ExecPolicy&& p,
+          InContainer&& in,
+          OutContainer&& out,
+          CountIter num_selected,
+          Predicate pred)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      num_selected,
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[out] num_selected Pointer or Random-Access Iterator to the location
+*the number of unique items is written to
+* \param[in] eq binary function that compares items for equality
+*
+* Copies the first item of each run of consecutive equal items of in to the
+* front of out, keeping their order. The number of unique items is written
+* to num_selected, which must be accessible in the memory space of the
+* execution policy.
+*
+* \note{The range of in must be separate from out}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename CountIter,
+          typename Compare = operators::equal_to<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+unique(ExecPolicy&& p,
+       Res r,
+       InContainer&& in,
+       OutContainer&& out,
+       CountIter num_selected,
+       Compare eq = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  return impl::compact::unique(r, std::forward<ExecPolicy>(p),
+                               begin(in), end(in), begin(out),
+                               num_selected, eq);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename CountIter,
+          typename Compare = operators::equal_to<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+unique(ExecPolicy&& p,
+       InContainer&& in,
+       OutContainer&& out,
+       CountIter num_selected,
+       Compare eq = Compare{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      num_selected,
+      eq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of keys
+* \param[in] values Random-Access Container of values, one per key
+* \param[out] out_keys Random-Access Container for the key of each segment
+* \param[out] out_values Random-Access Container for the reduced value of
+*each segment
+* \param[out] num_segments Pointer or Random-Access Iterator to the location
+*the number of segments is written to
+* \param[in] op binary function that reduces the values of a segment
+*
+* Reduces the values of each run of consecutive equal keys, the segments,
+* with op. The key and reduced value of each segment are written to the
+* front of out_keys and out_values, keeping their order. The number of
+* segments is written to num_segments, which must be accessible in the
+* memory space of the execution policy.
+*
+* op must be associative but need not be commutative, the values of a
+* segment are combined in order. No backend uses atomics, so repeated runs
+* with the same policy give the same results.
+*
+* \note{The ranges of keys and values must be separate from out_keys and
+* out_values}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValueContainer,
+          typename OutKeyContainer,
+          typename OutValueContainer,
+          typename CountIter,
+          typename BinaryOp = operators::plus<RAJA::detail::ContainerVal<ValueContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValueContainer>,
+                      type_traits::is_range<OutKeyContainer>,
+                      type_traits::is_range<OutValueContainer>>
+reduce_by_key(ExecPolicy&& p,
+              Res r,
+              KeyContainer&& keys,
+              ValueContainer&& values,
+              OutKeyContainer&& out_keys,
+              OutValueContainer&& out_values,
+              CountIter num_segments,
+              BinaryOp op = BinaryOp{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<ValueContainer>;
+  static_assert(type_traits::is_binary_function<BinaryOp, T, T, T>::value,
+                "BinaryOp must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValueContainer>::value,
+                "ValueContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutKeyContainer>::value,
+                "OutKeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutValueContainer>::value,
+                "OutValueContainer must model RandomAccessRange");
+  return impl::compact::reduce_by_key(r, std::forward<ExecPolicy>(p),
+                                      begin(keys), end(keys), begin(values),
+                                      begin(out_keys), begin(out_values),
+                                      num_segments, op);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValueContainer,
+          typename OutKeyContainer,
+          typename OutValueContainer,
+          typename CountIter,
+          typename BinaryOp = operators::plus<RAJA::detail::ContainerVal<ValueContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValueContainer>,
+                      type_traits::is_range<OutKeyContainer>,
+                      type_traits::is_range<OutValueContainer>>
+reduce_by_key(ExecPolicy&& p,
+              KeyContainer&& keys,
+              ValueContainer&& values,
+              OutKeyContainer&& out_keys,
+              OutValueContainer&& out_values,
+              CountIter num_segments,
+              BinaryOp op = BinaryOp{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValueContainer>(values),
+      std::forward<OutKeyContainer>(out_keys),
+      std::forward<OutValueContainer>(out_values),
+      num_segments,
+      op);
+}
+
+}  // end inline namespace policy_by_value_interface
+
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * copy_if
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+copy_if(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+copy_if(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::copy_if(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partition
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partition(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+partition(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * unique
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+unique(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+unique(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::unique(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * reduce_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+reduce_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+reduce_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::reduce_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -19,6 +19,12 @@
 #ifndef RAJA_PATTERN_DETAIL_FORALL_HPP
 #define RAJA_PATTERN_DETAIL_FORALL_HPP
 
+#include <type_traits>
+
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/util/macros.hpp"
+
 #define RAJA_EXTRACT_BED_SUFFIXED(CONTAINER, SUFFIX) \
   using std::begin;                                  \
   using std::end;                                    \
@@ -29,4 +35,80 @@
 
 #define RAJA_EXTRACT_BED_IT(CONTAINER) RAJA_EXTRACT_BED_SUFFIXED(CONTAINER, _it)
 
+// Like RAJA_EXTRACT_BED_IT for host loops that only use begin_it[i] or
+// *(begin_it + i), with the iterators of contiguous ranges lowered to a
+// plain integer by RAJA::detail::loop_begin
+#define RAJA_EXTRACT_BED_LOOP_IT(CONTAINER)                 \
+  RAJA_EXTRACT_BED_SUFFIXED(CONTAINER, _seg);               \
+  auto begin_it = ::RAJA::detail::loop_begin(begin_seg);    \
+  auto distance_it = distance_seg
+
+namespace RAJA
+{
+namespace type_traits
+{
+
+/*!
+ * True for segments whose indices are decoded from a compressed form.
+ * These provide for_each_index(body), which visits the indices in order
+ * faster than decoding each one through the segment iterators, and is
+ * used by sequential execution policies.
+ */
+template <typename T>
+struct is_compressed_segment : std::false_type {
+};
+
+}  // namespace type_traits
+
+namespace detail
+{
+
+/*!
+ * Begin of a host loop over a TypedRangeSegment. Index i of the loop is
+ * first + i computed on the underlying integer type, which is converted to
+ * the strong index type only when passed to the body, so compilers see a
+ * counted integer loop they can vectorize like a plain C loop.
+ */
+template <typename Type, typename DifferenceType>
+struct contiguous_loop_begin {
+  using value_type = Type;
+  using stripped_value_type = strip_index_type_t<Type>;
+
+  stripped_value_type first;
+
+  RAJA_HOST_DEVICE constexpr value_type operator[](DifferenceType i) const
+  {
+    return value_type(static_cast<stripped_value_type>(first + stripIndexType(i)));
+  }
+
+  RAJA_HOST_DEVICE constexpr contiguous_loop_begin operator+(
+      DifferenceType i) const
+  {
+    return contiguous_loop_begin{static_cast<stripped_value_type>(first + stripIndexType(i))};
+  }
+
+  RAJA_HOST_DEVICE constexpr value_type operator*() const
+  {
+    return value_type(first);
+  }
+};
+
+//! Iterators of other segments are used as they are
+template <typename Iterator>
+RAJA_INLINE Iterator loop_begin(Iterator const& begin)
+{
+  return begin;
+}
+
+template <typename Type, typename DifferenceType, typename PointerType>
+RAJA_INLINE contiguous_loop_begin<Type, DifferenceType> loop_begin(
+    Iterators::numeric_iterator<Type, DifferenceType, PointerType> const&
+        begin)
+{
+  return contiguous_loop_begin<Type, DifferenceType>{stripIndexType(*begin)};
+}
+
+}  // namespace detail
+}  // namespace RAJA
+
 #endif /* RAJA_PATTERN_DETAIL_FORALL_HPP */
@@ -0,0 +1,297 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the segment table used to run all the segments
+ *          of an index set in a single device kernel launch.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_fused_segments_HPP
+#define RAJA_pattern_detail_fused_segments_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! position of T in Types...
+template <typename T, typename... Types>
+struct fused_type_index;
+
+template <typename T, typename... Rest>
+struct fused_type_index<T, T, Rest...> : std::integral_constant<int, 0> {
+};
+
+template <typename T, typename U, typename... Rest>
+struct fused_type_index<T, U, Rest...>
+    : std::integral_constant<int, 1 + fused_type_index<T, Rest...>::value> {
+};
+
+/*!
+ * \brief Descriptor of one segment of a fused index set: where its
+ *        iteration starts and how many indices it has.
+ */
+template <typename Iterator>
+struct FusedSegment {
+  Iterator begin;
+  Index_type length;
+};
+
+/*!
+ * \brief Device view of the segments of an index set, used to run all of
+ *        them in one kernel.
+ *
+ * Each segment gets ceil(length / block_size) consecutive blocks of the
+ * grid; block_starts[s] is the first block of segment s and
+ * block_starts[num_segments] is the number of blocks.  A block finds its
+ * segment with a binary search of block_starts, then the segment type
+ * selects, at compile time, the array of descriptors of that type, as the
+ * WorkGroup runners select a loop body without virtual calls.
+ */
+template <typename... SegmentTypes>
+struct FusedSegmentTable {
+  template <typename SegmentType>
+  using iterator = typename camp::decay<SegmentType>::iterator;
+
+  const Index_type* block_starts = nullptr;
+  const int* segment_types = nullptr;
+  const Index_type* segment_indices = nullptr;
+  camp::tuple<const FusedSegment<iterator<SegmentTypes>>*...> segments;
+  Index_type num_segments = 0;
+
+  //! calls body on the index of thread in block, if it has one
+  template <typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE void run(Body& body,
+                                        Index_type block,
+                                        Index_type thread,
+                                        Index_type block_size) const
+  {
+    // last segment starting at or before block, this skips empty segments
+    Index_type lo = 0;
+    Index_type hi = num_segments - 1;
+    while (lo < hi) {
+      Index_type mid = (lo + hi + 1) / 2;
+      if (block_starts[mid] <= block) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+
+    Index_type ii = (block - block_starts[lo]) * block_size + thread;
+    run_segment(camp::make_idx_seq_t<sizeof...(SegmentTypes)>{},
+                body,
+                segment_types[lo],
+                segment_indices[lo],
+                ii);
+  }
+
+private:
+  template <camp::idx_t... Types, typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE void run_segment(camp::idx_seq<Types...>,
+                                                Body& body,
+                                                int type,
+                                                Index_type index,
+                                                Index_type ii) const
+  {
+    camp::sink(
+        (type == static_cast<int>(Types) ? run_type<Types>(body, index, ii)
+                                         : 0)...);
+  }
+
+  template <camp::idx_t Type, typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE int run_type(Body& body,
+                                            Index_type index,
+                                            Index_type ii) const
+  {
+    auto const& seg = camp::get<Type>(segments)[index];
+    if (ii < seg.length) {
+      body(seg.begin[ii]);
+    }
+    return 0;
+  }
+};
+
+/*!
+ * \brief Builds the segment table of an index set on the host.
+ *
+ * All the arrays of the table are packed into one buffer, so the table
+ * takes one allocation and one copy to the device.  The table used in a
+ * kernel points into the device copy of that buffer, see table().
+ */
+template <typename... SegmentTypes>
+class FusedSegmentTableBuilder
+{
+  using Table = FusedSegmentTable<SegmentTypes...>;
+
+  template <typename SegmentType>
+  using descriptor = FusedSegment<typename Table::template iterator<SegmentType>>;
+
+  struct Recorder {
+    FusedSegmentTableBuilder* builder;
+
+    template <typename SegmentType>
+    void operator()(SegmentType const& seg) const
+    {
+      builder->record(seg);
+    }
+  };
+
+public:
+  FusedSegmentTableBuilder(TypedIndexSet<SegmentTypes...> const& iset,
+                           Index_type block_size)
+      : m_block_size(block_size)
+  {
+    const Index_type num_seg = static_cast<Index_type>(iset.getNumSegments());
+
+    m_block_starts.reserve(num_seg + 1);
+    m_segment_types.reserve(num_seg);
+    m_segment_indices.reserve(num_seg);
+    m_block_starts.push_back(0);
+
+    for (Index_type isi = 0; isi < num_seg; ++isi) {
+      iset.segmentCall(isi, Recorder{this});
+    }
+
+    pack(camp::make_idx_seq_t<sizeof...(SegmentTypes)>{});
+  }
+
+  //! number of blocks needed to run all the segments
+  Index_type num_blocks() const { return m_block_starts.back(); }
+
+  //! size in bytes of the packed table
+  size_t bytes() const { return m_bytes; }
+
+  //! packed table, to be copied to the device
+  const void* data() const { return m_buffer.data(); }
+
+  //! table pointing into base, a copy of data()
+  Table table(void* base) const
+  {
+    return make_table(camp::make_idx_seq_t<sizeof...(SegmentTypes)>{},
+                      static_cast<char*>(base));
+  }
+
+private:
+  template <typename SegmentType>
+  void record(SegmentType const& seg)
+  {
+    constexpr int type = fused_type_index<SegmentType, SegmentTypes...>::value;
+    auto& descs = camp::get<type>(m_segments);
+
+    const Index_type len =
+        static_cast<Index_type>(std::distance(std::begin(seg), std::end(seg)));
+
+    m_segment_types.push_back(type);
+    m_segment_indices.push_back(static_cast<Index_type>(descs.size()));
+    descs.push_back(descriptor<SegmentType>{std::begin(seg), len});
+    m_block_starts.push_back(m_block_starts.back() +
+                             (len + m_block_size - 1) / m_block_size);
+  }
+
+  static size_t align(size_t offset)
+  {
+    constexpr size_t a = alignof(std::max_align_t);
+    return (offset + a - 1) / a * a;
+  }
+
+  template <typename T>
+  size_t place(size_t& offset, std::vector<T> const& v)
+  {
+    size_t at = align(offset);
+    offset = at + v.size() * sizeof(T);
+    return at;
+  }
+
+  template <typename T>
+  void copy(size_t at, std::vector<T> const& v)
+  {
+    if (!v.empty()) {
+      std::memcpy(reinterpret_cast<char*>(m_buffer.data()) + at,
+                  v.data(),
+                  v.size() * sizeof(T));
+    }
+  }
+
+  template <camp::idx_t... Types>
+  void pack(camp::idx_seq<Types...>)
+  {
+    size_t offset = 0;
+    m_block_starts_at = place(offset, m_block_starts);
+    m_segment_types_at = place(offset, m_segment_types);
+    m_segment_indices_at = place(offset, m_segment_indices);
+    camp::sink(
+        (m_segments_at[Types] = place(offset, camp::get<Types>(m_segments)))...);
+    m_bytes = align(offset);
+
+    m_buffer.resize((m_bytes + sizeof(std::max_align_t) - 1) /
+                    sizeof(std::max_align_t));
+    copy(m_block_starts_at, m_block_starts);
+    copy(m_segment_types_at, m_segment_types);
+    copy(m_segment_indices_at, m_segment_indices);
+    camp::sink((copy(m_segments_at[Types], camp::get<Types>(m_segments)), 0)...);
+  }
+
+  template <camp::idx_t... Types>
+  Table make_table(camp::idx_seq<Types...>, char* base) const
+  {
+    Table table;
+    table.block_starts =
+        reinterpret_cast<const Index_type*>(base + m_block_starts_at);
+    table.segment_types =
+        reinterpret_cast<const int*>(base + m_segment_types_at);
+    table.segment_indices =
+        reinterpret_cast<const Index_type*>(base + m_segment_indices_at);
+    table.segments = camp::make_tuple(
+        reinterpret_cast<const descriptor<SegmentTypes>*>(
+            base + m_segments_at[Types])...);
+    table.num_segments = static_cast<Index_type>(m_segment_types.size());
+    return table;
+  }
+
+  Index_type m_block_size;
+
+  std::vector<Index_type> m_block_starts;
+  std::vector<int> m_segment_types;
+  std::vector<Index_type> m_segment_indices;
+  camp::tuple<std::vector<descriptor<SegmentTypes>>...> m_segments;
+
+  size_t m_block_starts_at = 0;
+  size_t m_segment_types_at = 0;
+  size_t m_segment_indices_at = 0;
+  size_t m_segments_at[sizeof...(SegmentTypes)] = {};
+  size_t m_bytes = 0;
+
+  std::vector<std::max_align_t> m_buffer;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
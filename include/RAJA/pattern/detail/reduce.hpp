@@ -19,6 +19,7 @@
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/metrics.hpp"
 #include "RAJA/util/types.hpp"
 
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
@@ -192,13 +193,17 @@ public:
 
   RAJA_SUPPRESS_HD_WARN
   RAJA_HOST_DEVICE
-  BaseReduce() : c{T(), Reduce::identity()} {}
+  BaseReduce() : c{T(), Reduce::identity()}
+  {
+    RAJA_METRICS_ADD("reduce.reducers", 1);
+  }
 
   RAJA_SUPPRESS_HD_WARN
   RAJA_HOST_DEVICE
   BaseReduce(T init_val, T identity_ = Reduce::identity())
       : c{init_val, identity_}
   {
+    RAJA_METRICS_ADD("reduce.reducers", 1);
   }
 
   RAJA_SUPPRESS_HD_WARN
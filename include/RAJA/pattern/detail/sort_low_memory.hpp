@@ -0,0 +1,201 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the implementation of RAJA sort_low_memory,
+*          a sort whose extra memory is bounded by a chunk size.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_sort_low_memory_HPP
+#define RAJA_pattern_detail_sort_low_memory_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! reverse the len items starting at first, one swap per iterate
+template <typename Iter>
+struct SortLowMemoryReverse {
+  Iter first;
+  Index_type len;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type t) const
+  {
+    auto tmp = first[t];
+    first[t] = first[len - 1 - t];
+    first[len - 1 - t] = tmp;
+  }
+};
+
+/*!
+ * \brief Number of items of a that are among the first k items of the merge
+ *        of the sorted ranges a and b, written to *out by a single iterate.
+ */
+template <typename Iter, typename Compare>
+struct SortLowMemorySplit {
+  Iter a;
+  Index_type la;
+  Iter b;
+  Index_type lb;
+  Index_type k;
+  Compare comp;
+  Index_type* out;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type) const
+  {
+    Index_type lo = k > lb ? k - lb : 0;
+    Index_type hi = k < la ? k : la;
+    while (lo < hi) {
+      const Index_type mid = lo + (hi - lo) / 2;
+      if (!comp(b[k - mid - 1], a[mid])) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    *out = lo;
+  }
+};
+
+/*!
+ * \brief Sort with extra memory bounded by chunk items, see
+ *        RAJA::sort_low_memory.
+ *
+ * Chunks of chunk items are sorted with RAJA::sort, whose extra memory is
+ * proportional to the range it sorts. Adjacent sorted runs are then merged
+ * in place bottom up. A merge splits the output at its middle along the
+ * merge path, rotates the tail of the first run past the head of the
+ * second with three in place reversals, and merges the two halves the same
+ * way. Merges of at most chunk items are sorted with RAJA::sort.
+ */
+template <typename ExecPolicy, typename Res, typename Iter, typename Compare>
+class SortLowMemory
+{
+public:
+  SortLowMemory(Res r, Iter first, Index_type chunk, Compare comp)
+      : m_res(r), m_first(first), m_chunk(chunk), m_comp(comp)
+  {
+    m_split = camp::resources::Resource{m_res}.template allocate<Index_type>(1);
+  }
+
+  SortLowMemory(SortLowMemory const&) = delete;
+  SortLowMemory& operator=(SortLowMemory const&) = delete;
+
+  ~SortLowMemory()
+  {
+    m_res.wait();
+    camp::resources::Resource{m_res}.deallocate(m_split);
+  }
+
+  void sort(Index_type n)
+  {
+    for (Index_type lo = 0; lo < n; lo += m_chunk) {
+      sort_range(lo, std::min(lo + m_chunk, n));
+    }
+    for (Index_type width = m_chunk; width < n; width *= 2) {
+      for (Index_type lo = 0; lo + width < n; lo += 2 * width) {
+        merge(lo, lo + width, std::min(lo + 2 * width, n));
+      }
+    }
+  }
+
+private:
+  void sort_range(Index_type lo, Index_type hi)
+  {
+    ::RAJA::sort<ExecPolicy>(
+        m_res, ::RAJA::make_span(m_first + lo, hi - lo), m_comp);
+  }
+
+  void reverse(Index_type lo, Index_type hi)
+  {
+    if (hi - lo > 1) {
+      ::RAJA::forall<ExecPolicy>(
+          m_res,
+          TypedRangeSegment<Index_type>(0, (hi - lo) / 2),
+          SortLowMemoryReverse<Iter>{m_first + lo, hi - lo});
+    }
+  }
+
+  //! [lo, mid) [mid, hi) -> [mid, hi) [lo, mid)
+  void rotate(Index_type lo, Index_type mid, Index_type hi)
+  {
+    if (lo < mid && mid < hi) {
+      reverse(lo, mid);
+      reverse(mid, hi);
+      reverse(lo, hi);
+    }
+  }
+
+  //! merge the sorted runs [lo, mid) and [mid, hi)
+  void merge(Index_type lo, Index_type mid, Index_type hi)
+  {
+    if (lo == mid || mid == hi) {
+      return;
+    }
+    if (hi - lo <= m_chunk) {
+      sort_range(lo, hi);
+      return;
+    }
+
+    const Index_type la = mid - lo;
+    const Index_type lb = hi - mid;
+    const Index_type k = (hi - lo) / 2;
+    ::RAJA::forall<ExecPolicy>(
+        m_res,
+        TypedRangeSegment<Index_type>(0, 1),
+        SortLowMemorySplit<Iter, Compare>{
+            m_first + lo, la, m_first + mid, lb, k, m_comp, m_split});
+    Index_type i = 0;
+    m_res.memcpy(&i, m_split, sizeof(Index_type));
+    m_res.wait();
+    const Index_type j = k - i;
+
+    // [lo, lo+i) [lo+i, mid) [mid, mid+j) [mid+j, hi)
+    //   -> [lo, lo+i) [mid, mid+j) [lo+i, mid) [mid+j, hi)
+    rotate(lo + i, mid, mid + j);
+    merge(lo, lo + i, lo + k);
+    merge(lo + k, lo + k + (la - i), hi);
+  }
+
+  Res m_res;
+  Iter m_first;
+  Index_type m_chunk;
+  Compare m_comp;
+  Index_type* m_split = nullptr;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
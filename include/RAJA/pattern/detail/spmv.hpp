@@ -0,0 +1,237 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the sparse matrix types of RAJA spmv.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_spmv_HPP
+#define RAJA_pattern_detail_spmv_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(RAJA_ENABLE_VECTORIZATION)
+#include "RAJA/pattern/tensor.hpp"
+#endif
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief View of a sparse matrix in compressed sparse row (CSR) format.
+ *
+ * The nonzeros of row r are values[k] in column col_idx[k] for k in
+ * [row_ptr[r], row_ptr[r+1]). The arrays are not owned and must be
+ * accessible by the policy spmv runs with; nnz is kept in the view so it
+ * can be read without reading row_ptr.
+ */
+template <typename T, typename IndexType = Index_type>
+struct CSRView {
+  using value_type = T;
+  using index_type = IndexType;
+
+  IndexType num_rows;
+  IndexType num_cols;
+  IndexType nnz;
+  IndexType const* row_ptr;
+  IndexType const* col_idx;
+  T const* values;
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Chunk height of SellMatrix, the rows of a chunk are the lanes of a
+ *        SIMD register of T when vectorization is enabled.
+ */
+template <typename T>
+struct sell_chunk_size {
+#if defined(RAJA_ENABLE_VECTORIZATION)
+  using register_type = RAJA::expt::Register<T, RAJA::expt::default_register>;
+  static constexpr camp::idx_t value = register_type::s_num_elem;
+#else
+  static constexpr camp::idx_t value = 8;
+#endif
+};
+
+//! dot product of row r of A with x
+template <typename T, typename IndexType>
+RAJA_HOST_DEVICE RAJA_INLINE T csr_row_dot(CSRView<T, IndexType> const& A,
+                                           T const* x,
+                                           IndexType r)
+{
+  T sum = T(0);
+  for (IndexType k = A.row_ptr[r]; k < A.row_ptr[r + 1]; ++k) {
+    sum += A.values[k] * x[A.col_idx[k]];
+  }
+  return sum;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Host sparse matrix in SELL-C-sigma format, for SIMD spmv on CPUs.
+ *
+ * Rows are sorted by length within windows of sigma rows, then grouped into
+ * chunks of C rows. The nonzeros of a chunk are stored column by column,
+ * C values per column, padded with zeros to its longest row, so spmv loads
+ * the values of the C rows of a chunk as one SIMD register and gathers x.
+ * C is the number of lanes of the default tensor register of T when
+ * vectorization is enabled.
+ *
+ *     RAJA::expt::SellMatrix<double> S(A, 256);
+ *     RAJA::expt::spmv<RAJA::omp_parallel_for_exec>(S, x, y);
+ */
+template <typename T, typename IndexType = Index_type>
+class SellMatrix
+{
+public:
+  using value_type = T;
+  using index_type = IndexType;
+#if defined(RAJA_ENABLE_VECTORIZATION)
+  using register_type = typename detail::sell_chunk_size<T>::register_type;
+  // gathers take offsets in the integer register of the value register
+  using column_type =
+      typename register_type::int_vector_type::element_type;
+#else
+  using column_type = IndexType;
+#endif
+
+  static constexpr IndexType chunk_size =
+      static_cast<IndexType>(detail::sell_chunk_size<T>::value);
+
+  //! convert A, whose arrays are in host memory, sorting windows of sigma rows
+  explicit SellMatrix(CSRView<T, IndexType> const& A, IndexType sigma = 1)
+      : m_num_rows(A.num_rows),
+        m_num_cols(A.num_cols),
+        m_num_chunks((A.num_rows + chunk_size - 1) / chunk_size),
+        m_perm(static_cast<size_t>(m_num_chunks * chunk_size)),
+        m_chunk_ptr(static_cast<size_t>(m_num_chunks + 1)),
+        m_chunk_len(static_cast<size_t>(m_num_chunks))
+  {
+    if (sigma < 1) {
+      sigma = 1;
+    }
+
+    auto row_len = [&](IndexType r) {
+      return r < m_num_rows ? A.row_ptr[r + 1] - A.row_ptr[r] : IndexType(0);
+    };
+
+    // padding rows past the end of A have no nonzeros
+    std::iota(m_perm.begin(), m_perm.end(), IndexType(0));
+    for (IndexType w = 0; w < m_num_rows; w += sigma) {
+      auto first = m_perm.begin() + w;
+      auto last = m_perm.begin() + std::min(w + sigma, m_num_rows);
+      std::stable_sort(first, last, [&](IndexType a, IndexType b) {
+        return row_len(a) > row_len(b);
+      });
+    }
+
+    m_chunk_ptr[0] = 0;
+    for (IndexType c = 0; c < m_num_chunks; ++c) {
+      IndexType len = 0;
+      for (IndexType l = 0; l < chunk_size; ++l) {
+        len = std::max(len, row_len(m_perm[c * chunk_size + l]));
+      }
+      m_chunk_len[c] = len;
+      m_chunk_ptr[c + 1] = m_chunk_ptr[c] + len * chunk_size;
+    }
+
+    m_values.assign(static_cast<size_t>(m_chunk_ptr[m_num_chunks]), T(0));
+    m_cols.assign(static_cast<size_t>(m_chunk_ptr[m_num_chunks]),
+                  column_type(0));
+    for (IndexType c = 0; c < m_num_chunks; ++c) {
+      for (IndexType l = 0; l < chunk_size; ++l) {
+        const IndexType r = m_perm[c * chunk_size + l];
+        const IndexType len = row_len(r);
+        for (IndexType j = 0; j < len; ++j) {
+          const IndexType k = A.row_ptr[r] + j;
+          const IndexType s = m_chunk_ptr[c] + j * chunk_size + l;
+          m_values[s] = A.values[k];
+          m_cols[s] = static_cast<column_type>(A.col_idx[k]);
+        }
+      }
+    }
+  }
+
+  IndexType num_rows() const { return m_num_rows; }
+  IndexType num_cols() const { return m_num_cols; }
+  IndexType num_chunks() const { return m_num_chunks; }
+
+  //! stored values including padding, over the nonzeros of A
+  size_t storage_size() const { return m_values.size(); }
+
+  //! y[r] = (A x)[r] for the rows r of chunk c
+  RAJA_INLINE void multiply_chunk(IndexType c, T const* x, T* y) const
+  {
+    const T* vals = m_values.data() + m_chunk_ptr[c];
+    const column_type* cols = m_cols.data() + m_chunk_ptr[c];
+    const IndexType* rows = m_perm.data() + c * chunk_size;
+    T sum[chunk_size];
+
+#if defined(RAJA_ENABLE_VECTORIZATION)
+    register_type acc(T(0));
+    for (IndexType j = 0; j < m_chunk_len[c]; ++j) {
+      typename register_type::int_vector_type offsets;
+      offsets.load_packed(cols + j * chunk_size);
+      register_type a, xv;
+      a.load_packed(vals + j * chunk_size);
+      xv.gather(x, offsets);
+      acc = a.multiply_add(xv, acc);
+    }
+    acc.store_packed(sum);
+#else
+    for (IndexType l = 0; l < chunk_size; ++l) {
+      sum[l] = T(0);
+    }
+    for (IndexType j = 0; j < m_chunk_len[c]; ++j) {
+      RAJA_SIMD
+      for (IndexType l = 0; l < chunk_size; ++l) {
+        sum[l] += vals[j * chunk_size + l] * x[cols[j * chunk_size + l]];
+      }
+    }
+#endif
+
+    for (IndexType l = 0; l < chunk_size; ++l) {
+      if (rows[l] < m_num_rows) {
+        y[rows[l]] = sum[l];
+      }
+    }
+  }
+
+private:
+  IndexType m_num_rows;
+  IndexType m_num_cols;
+  IndexType m_num_chunks;
+  std::vector<IndexType> m_perm;
+  std::vector<IndexType> m_chunk_ptr;
+  std::vector<IndexType> m_chunk_len;
+  std::vector<T> m_values;
+  std::vector<column_type> m_cols;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,288 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the tile space of RAJA tiled sweeps.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_sweep_HPP
+#define RAJA_pattern_detail_sweep_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief The cells of a 2D or 3D sweep and the tiles they are split into.
+ *
+ *     RAJA::expt::SweepTiles<2> tiles{{nx, ny}, {tx, ty}};
+ *
+ * Tiles at the end of a dimension may be smaller than tile_size.
+ */
+template <int DIM>
+struct SweepTiles {
+  static_assert(DIM == 2 || DIM == 3, "Sweeps are 2D or 3D");
+
+  //! number of cells in each dimension
+  Index_type extent[DIM];
+  //! number of cells of a tile in each dimension
+  Index_type tile_size[DIM];
+};
+
+/*!
+ * \brief The direction of a sweep in each dimension, +1 sweeps from cell 0
+ *        up and -1 from the last cell down.
+ *
+ * A cell depends on its upstream neighbor in each dimension, the cell one
+ * step against the direction, as in a discrete ordinates transport sweep.
+ */
+template <int DIM>
+struct SweepDirection {
+  static_assert(DIM == 2 || DIM == 3, "Sweeps are 2D or 3D");
+
+  int dir[DIM];
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Tile space of a sweep.
+ *
+ * Tiles and cells are numbered along the sweep ("sweep space"), so the
+ * upstream neighbors of a tile or cell have smaller coordinates, and are
+ * mapped to the cell indices of the user when the body is called.
+ *
+ * Tiles are handed out in wavefront order, by increasing sum of their tile
+ * coordinates, so the tiles a tile waits on were handed out before it. A
+ * worker only ever waits on tiles that are running or done and a sweep can
+ * not deadlock, whatever the number of workers that are resident at once.
+ */
+template <int DIM>
+struct SweepSpace {
+
+  Index_type extent[DIM];
+  Index_type tile_size[DIM];
+  Index_type num_tiles[DIM];
+  int dir[DIM];
+
+  SweepSpace(SweepTiles<DIM> const& tiles, SweepDirection<DIM> const& dirs)
+  {
+    for (int d = 0; d < DIM; ++d) {
+      extent[d] = tiles.extent[d] > 0 ? tiles.extent[d] : 0;
+      tile_size[d] = tiles.tile_size[d] > 0 ? tiles.tile_size[d] : 1;
+      num_tiles[d] = RAJA_DIVIDE_CEILING_INT(extent[d], tile_size[d]);
+      dir[d] = dirs.dir[d] < 0 ? -1 : 1;
+    }
+  }
+
+  RAJA_HOST_DEVICE Index_type total_tiles() const
+  {
+    Index_type total = 1;
+    for (int d = 0; d < DIM; ++d) {
+      total *= num_tiles[d];
+    }
+    return total;
+  }
+
+  //! linear index of tile t, the last dimension runs fastest
+  RAJA_HOST_DEVICE Index_type linear(Index_type const (&t)[DIM]) const
+  {
+    Index_type lin = 0;
+    for (int d = 0; d < DIM; ++d) {
+      lin = lin * num_tiles[d] + t[d];
+    }
+    return lin;
+  }
+
+  //! number of tiles t is waiting on
+  RAJA_HOST_DEVICE int num_upstream(Index_type const (&t)[DIM]) const
+  {
+    int num = 0;
+    for (int d = 0; d < DIM; ++d) {
+      num += (t[d] > 0) ? 1 : 0;
+    }
+    return num;
+  }
+
+  //! number of cells of tile coordinate td in dimension d
+  RAJA_HOST_DEVICE Index_type tile_extent(int d, Index_type td) const
+  {
+    Index_type rest = extent[d] - td * tile_size[d];
+    return rest < tile_size[d] ? rest : tile_size[d];
+  }
+
+  //! number of tiles of the last two dimensions with coordinate sum h
+  RAJA_HOST_DEVICE Index_type plane_count_2d(Index_type h) const
+  {
+    Index_type n0 = num_tiles[DIM - 2];
+    Index_type n1 = num_tiles[DIM - 1];
+    Index_type lo = h - (n1 - 1) > 0 ? h - (n1 - 1) : 0;
+    Index_type hi = h < n0 - 1 ? h : n0 - 1;
+    return hi >= lo ? hi - lo + 1 : 0;
+  }
+
+  //! number of tiles with coordinate sum h
+  RAJA_HOST_DEVICE Index_type plane_count(Index_type h) const
+  {
+    if (DIM == 2) {
+      return plane_count_2d(h);
+    }
+    Index_type count = 0;
+    for (Index_type t0 = 0; t0 < num_tiles[0] && t0 <= h; ++t0) {
+      count += plane_count_2d(h - t0);
+    }
+    return count;
+  }
+
+  //! the tile handed out with ticket, in wavefront order
+  RAJA_HOST_DEVICE void decode(Index_type ticket, Index_type (&t)[DIM]) const
+  {
+    // find the wavefront of the ticket
+    Index_type h = 0;
+    for (Index_type count = plane_count(h); ticket >= count;
+         count = plane_count(h)) {
+      ticket -= count;
+      ++h;
+    }
+
+    // in 3D find the first coordinate
+    if (DIM == 3) {
+      for (Index_type t0 = 0;; ++t0) {
+        Index_type count = plane_count_2d(h - t0);
+        if (ticket < count) {
+          t[0] = t0;
+          h -= t0;
+          break;
+        }
+        ticket -= count;
+      }
+    }
+
+    Index_type n1 = num_tiles[DIM - 1];
+    Index_type lo = h - (n1 - 1) > 0 ? h - (n1 - 1) : 0;
+    t[DIM - 2] = lo + ticket;
+    t[DIM - 1] = h - t[DIM - 2];
+  }
+
+  //! cell index of the user for sweep space coordinate s in dimension d
+  RAJA_HOST_DEVICE Index_type cell(int d, Index_type s) const
+  {
+    return dir[d] > 0 ? s : extent[d] - 1 - s;
+  }
+
+  template <typename Body, camp::idx_t... I>
+  RAJA_HOST_DEVICE RAJA_INLINE void invoke(Body const& body,
+                                           Index_type const (&s)[DIM],
+                                           camp::idx_seq<I...>) const
+  {
+    body(cell(I, s[I])...);
+  }
+
+  //! call body for the cell at sweep space coordinates s
+  template <typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE void invoke(Body const& body,
+                                           Index_type const (&s)[DIM]) const
+  {
+    invoke(body, s, camp::make_idx_seq_t<DIM>{});
+  }
+
+  /*!
+   * Call body for the cells of tile t in lexicographic order of sweep
+   * space, which follows the dependencies of the cells.
+   */
+  template <typename Body>
+  RAJA_INLINE void for_each_cell(Index_type const (&t)[DIM],
+                                 Body const& body) const
+  {
+    Index_type len[DIM];
+    Index_type size = 1;
+    for (int d = 0; d < DIM; ++d) {
+      len[d] = tile_extent(d, t[d]);
+      size *= len[d];
+    }
+
+    Index_type s[DIM];
+    for (Index_type k = 0; k < size; ++k) {
+      Index_type rest = k;
+      for (int d = DIM - 1; d >= 0; --d) {
+        s[d] = t[d] * tile_size[d] + rest % len[d];
+        rest /= len[d];
+      }
+      invoke(body, s);
+    }
+  }
+
+  //! number of cell wavefronts of tile t
+  RAJA_HOST_DEVICE Index_type tile_planes(Index_type const (&t)[DIM]) const
+  {
+    Index_type planes = 1;
+    for (int d = 0; d < DIM; ++d) {
+      planes += tile_extent(d, t[d]) - 1;
+    }
+    return planes;
+  }
+
+  //! number of cells of tile t in the dimensions after the first
+  RAJA_HOST_DEVICE Index_type tile_inner_size(Index_type const (&t)[DIM]) const
+  {
+    Index_type size = 1;
+    for (int d = 1; d < DIM; ++d) {
+      size *= tile_extent(d, t[d]);
+    }
+    return size;
+  }
+
+  /*!
+   * Call body for cell k of the dimensions after the first of tile t, if
+   * it lies on cell wavefront h of the tile. The cells of a wavefront do
+   * not depend on each other, so GPU threads run them concurrently.
+   */
+  template <typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE void invoke_on_plane(Index_type const (&t)[DIM],
+                                                    Index_type h,
+                                                    Index_type k,
+                                                    Body const& body) const
+  {
+    Index_type s[DIM];
+    Index_type sum = 0;
+    for (int d = DIM - 1; d >= 1; --d) {
+      Index_type len = tile_extent(d, t[d]);
+      Index_type c = k % len;
+      k /= len;
+      sum += c;
+      s[d] = t[d] * tile_size[d] + c;
+    }
+    Index_type c0 = h - sum;
+    if (c0 >= 0 && c0 < tile_extent(0, t[0])) {
+      s[0] = t[0] * tile_size[0] + c0;
+      invoke(body, s);
+    }
+  }
+};
+
+}  // namespace detail
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
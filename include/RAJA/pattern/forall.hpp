@@ -57,20 +57,27 @@
 #include <functional>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 #include "RAJA/internal/Iterators.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/policy/MultiPolicy.hpp"
 
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/DeviceIndexSet.hpp"
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetView.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/util/Autotuner.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/FastDivmod.hpp"
 #include "RAJA/util/Span.hpp"
+#include "RAJA/util/Timer.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/sequential/forall.hpp"
@@ -119,6 +126,164 @@ struct icount_adapter {
   }
 };
 
+/// Adapter running the body of a box forall for one index of the
+/// flattened box, the last dimension fastest
+template <int DIM, typename StorageT, typename Body>
+struct box_adapter {
+  typename std::decay<Body>::type body;
+  Index_type begin[DIM];
+  FastDivmod<Index_type> extent[DIM];
+
+  box_adapter(TypedBoxSegment<DIM, StorageT> const& box,
+              typename std::decay<Body>::type const& b)
+      : body{b}
+  {
+    for (int d = 0; d < DIM; ++d) {
+      begin[d] = box.getBegin(d);
+      extent[d] = FastDivmod<Index_type>(box.getExtent(d));
+    }
+  }
+
+  RAJA_SUPPRESS_HD_WARN
+  template <typename T, typename... Args>
+  RAJA_HOST_DEVICE void operator()(T const& i, Args&&... args) const
+  {
+    Index_type idx[DIM];
+    Index_type n = static_cast<Index_type>(i);
+    for (int d = DIM - 1; d > 0; --d) {
+      Index_type q;
+      extent[d].divmod(n, q, idx[d]);
+      n = q;
+    }
+    idx[0] = n;
+    call(idx, camp::make_idx_seq_t<DIM>{}, std::forward<Args>(args)...);
+  }
+
+  RAJA_SUPPRESS_HD_WARN
+  template <camp::idx_t... Dims, typename... Args>
+  RAJA_HOST_DEVICE void call(Index_type const* idx,
+                             camp::idx_seq<Dims...>,
+                             Args&&... args) const
+  {
+    body(static_cast<StorageT>(begin[Dims] + idx[Dims])...,
+         std::forward<Args>(args)...);
+  }
+};
+
+/// Calls the body of a box forall with the last DIM of the indices i, j, k
+template <typename StorageT, typename ForallParams, typename Body>
+RAJA_INLINE void box_invoke(std::integral_constant<int, 3>,
+                            ForallParams& f_params,
+                            Body& body,
+                            Index_type i,
+                            Index_type j,
+                            Index_type k)
+{
+  expt::invoke_body(f_params,
+                    body,
+                    static_cast<StorageT>(i),
+                    static_cast<StorageT>(j),
+                    static_cast<StorageT>(k));
+}
+
+template <typename StorageT, typename ForallParams, typename Body>
+RAJA_INLINE void box_invoke(std::integral_constant<int, 2>,
+                            ForallParams& f_params,
+                            Body& body,
+                            Index_type,
+                            Index_type j,
+                            Index_type k)
+{
+  expt::invoke_body(f_params,
+                    body,
+                    static_cast<StorageT>(j),
+                    static_cast<StorageT>(k));
+}
+
+template <typename StorageT, typename ForallParams, typename Body>
+RAJA_INLINE void box_invoke(std::integral_constant<int, 1>,
+                            ForallParams& f_params,
+                            Body& body,
+                            Index_type,
+                            Index_type,
+                            Index_type k)
+{
+  expt::invoke_body(f_params, body, static_cast<StorageT>(k));
+}
+
+/// Runs a box forall on the host in tiles of the box, the points of a tile
+/// in order with the last dimension fastest
+template <int DIM, typename StorageT, typename Body, typename ForallParams>
+RAJA_INLINE void forall_box_tiled(TypedBoxSegment<DIM, StorageT> const& box,
+                                  Body&& body,
+                                  ForallParams& f_params)
+{
+  // dimensions padded in front to three
+  Index_type lo[3], ext[3], tile[3];
+  for (int d = 0; d < 3; ++d) {
+    int bd = d - (3 - DIM);
+    lo[d] = bd < 0 ? 0 : box.getBegin(bd);
+    ext[d] = bd < 0 ? 1 : box.getExtent(bd);
+    tile[d] = bd < 0 ? 1 : box.getTileSize(bd);
+  }
+
+  for (Index_type t0 = 0; t0 < ext[0]; t0 += tile[0]) {
+    Index_type e0 = t0 + tile[0] < ext[0] ? t0 + tile[0] : ext[0];
+    for (Index_type t1 = 0; t1 < ext[1]; t1 += tile[1]) {
+      Index_type e1 = t1 + tile[1] < ext[1] ? t1 + tile[1] : ext[1];
+      for (Index_type t2 = 0; t2 < ext[2]; t2 += tile[2]) {
+        Index_type e2 = t2 + tile[2] < ext[2] ? t2 + tile[2] : ext[2];
+        for (Index_type i = t0; i < e0; ++i) {
+          for (Index_type j = t1; j < e1; ++j) {
+            for (Index_type k = t2; k < e2; ++k) {
+              box_invoke<StorageT>(std::integral_constant<int, DIM>{},
+                                   f_params,
+                                   body,
+                                   lo[0] + i,
+                                   lo[1] + j,
+                                   lo[2] + k);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * Loop bodies of at least RAJA_WARN_BODY_BYTES bytes get a compile time
+ * warning naming the body type, as GPU policies copy the whole body to the
+ * kernel parameters of every launch. Capturing fewer or smaller objects, or
+ * staging large bodies with RAJA_CUDA_STAGED_BODY_BYTES, avoids the copy.
+ */
+template <typename Body>
+RAJA_INLINE concepts::enable_if<std::integral_constant<
+    bool,
+    !(RAJA_WARN_BODY_BYTES > 0 &&
+      sizeof(Body) >= size_t(RAJA_WARN_BODY_BYTES))>>
+check_body_bytes()
+{
+}
+
+template <typename Body>
+RAJA_DEPRECATE("loop body is at least RAJA_WARN_BODY_BYTES bytes, see the "
+               "body type in the instantiation")
+RAJA_INLINE concepts::enable_if<std::integral_constant<
+    bool,
+    (RAJA_WARN_BODY_BYTES > 0 &&
+     sizeof(Body) >= size_t(RAJA_WARN_BODY_BYTES))>>
+check_body_bytes()
+{
+}
+
+//! true for policies that run a box forall in tiles on the host
+template <typename Pol>
+struct is_box_tiled_policy
+    : concepts::any_of<type_traits::is_sequential_policy<Pol>,
+                       type_traits::is_loop_policy<Pol>,
+                       type_traits::is_simd_policy<Pol>> {
+};
+
 struct CallForall {
   template <typename T, typename ExecPol, typename Body, typename Res, typename ForallParams>
   RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&, ExecPol, Body, Res, ForallParams) const;
@@ -183,6 +348,68 @@ forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 }
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a box segment, in tiles with sequential policies
+ *
+ ******************************************************************************
+ */
+template <typename Res,
+          typename ExecutionPolicy,
+          int DIM,
+          typename StorageT,
+          typename LoopBody,
+          typename ForallParams>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    detail::is_box_tiled_policy<camp::decay<ExecutionPolicy>>>
+forall(Res r,
+       ExecutionPolicy&&,
+       TypedBoxSegment<DIM, StorageT> const& box,
+       LoopBody&& loop_body,
+       ForallParams&& f_params)
+{
+  expt::ParamMultiplexer::init<seq_exec>(f_params);
+
+  detail::forall_box_tiled(box, loop_body, f_params);
+
+  expt::ParamMultiplexer::resolve<seq_exec>(f_params);
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a box segment flattened into one range, as with an
+ *        OpenMP collapse clause, with other policies
+ *
+ ******************************************************************************
+ */
+template <typename Res,
+          typename ExecutionPolicy,
+          int DIM,
+          typename StorageT,
+          typename LoopBody,
+          typename ForallParams>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<detail::is_box_tiled_policy<camp::decay<ExecutionPolicy>>>>
+forall(Res r,
+       ExecutionPolicy&& p,
+       TypedBoxSegment<DIM, StorageT> const& box,
+       LoopBody&& loop_body,
+       ForallParams&& f_params)
+{
+  detail::box_adapter<DIM, StorageT, LoopBody> adapted(box, loop_body);
+  RAJA_FORCEINLINE_RECURSIVE
+  return forall_impl(r,
+                     std::forward<ExecutionPolicy>(p),
+                     TypedRangeSegment<Index_type>(0, box.size()),
+                     adapted,
+                     std::forward<ForallParams>(f_params));
+}
+
 /*!
  ******************************************************************************
  *
@@ -237,6 +464,9 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res r,
                                                 LoopBody loop_body,
                                                 ForallParams f_params)
 {
+  static_assert(!type_traits::is_fused_segit_policy<SegmentIterPolicy>::value,
+                "forall_Icount does not support fused segment iteration");
+
   // no need for icount variant here
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
@@ -256,12 +486,14 @@ template <typename Res,
           typename LoopBody,
           typename... SegmentTypes,
           typename ForallParams>
-RAJA_INLINE resources::EventProxy<Res> forall(Res r,
-                                         ExecPolicy<SegmentIterPolicy,
-                                         SegmentExecPolicy>,
-                                         const TypedIndexSet<SegmentTypes...>& iset,
-                                         LoopBody loop_body,
-                                         ForallParams f_params)
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_fused_segit_policy<SegmentIterPolicy>>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const TypedIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body,
+       ForallParams f_params)
 {
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
@@ -270,6 +502,114 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res r,
   return RAJA::resources::EventProxy<Res>(r);
 }
 
+/*!
+ * \brief Execute the segments of an index set view, the view is captured
+ *        by value in place of a copy of the index set.
+ */
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes,
+          typename ForallParams>
+RAJA_INLINE resources::EventProxy<Res> forall(
+    Res r,
+    ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+    const TypedIndexSetView<SegmentTypes...>& view,
+    LoopBody loop_body,
+    ForallParams f_params)
+{
+  static_assert(!type_traits::is_fused_segit_policy<SegmentIterPolicy>::value,
+                "index set views do not support fused segment iteration");
+
+  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+  wrap::forall(segIterRes, SegmentIterPolicy(), view, [=, &r](int segID) {
+    view.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), loop_body, r, f_params);
+  });
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody,
+          typename ForallParams>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res r,
+                                                ExecPolicy<SegmentIterPolicy,
+                                                SegmentExecPolicy>,
+                                                const TypedIndexSetView<SegmentTypes...>& view,
+                                                LoopBody loop_body,
+                                                ForallParams f_params)
+{
+  static_assert(!type_traits::is_fused_segit_policy<SegmentIterPolicy>::value,
+                "forall_Icount does not support fused segment iteration");
+
+  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+  wrap::forall(segIterRes, SegmentIterPolicy(), view, [=, &r](int segID) {
+    view.segmentCall(segID,
+                     detail::CallForallIcount(view.getStartingIcount(segID)),
+                     SegmentExecPolicy(),
+                     loop_body,
+                     r,
+                     f_params);
+  });
+  return RAJA::resources::EventProxy<Res>(r);
+}
+
+/*!
+ * \brief Execute all the segments of an index set in one launch with a
+ *        fused segment iteration policy, the backend implements it.
+ */
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes,
+          typename ForallParams>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_fused_segit_policy<SegmentIterPolicy>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const TypedIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body,
+       ForallParams f_params)
+{
+  return forall_impl(r,
+                     ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>(),
+                     iset,
+                     loop_body,
+                     f_params);
+}
+
+/*!
+ * \brief Execute all the segments of an index set with a resident segment
+ *        table in one launch, the backend implements it.
+ */
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes,
+          typename ForallParams>
+RAJA_INLINE resources::EventProxy<Res> forall(
+    Res r,
+    ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+    const TypedDeviceIndexSet<SegmentTypes...>& diset,
+    LoopBody loop_body,
+    ForallParams f_params)
+{
+  static_assert(type_traits::is_fused_segit_policy<SegmentIterPolicy>::value,
+                "device index sets require a fused segment iteration policy");
+
+  return forall_impl(r,
+                     ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>(),
+                     diset,
+                     loop_body,
+                     f_params);
+}
+
 }  // end namespace wrap
 
 
@@ -300,32 +640,37 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                                                      IdxSet&& c,
                                                      Params&&... params)
 {
-  static_assert(type_traits::is_index_set<IdxSet>::value,
+  static_assert(type_traits::is_index_set<IdxSet>::value ||
+                    type_traits::is_index_set_view<IdxSet>::value ||
+                    type_traits::is_device_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
   auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
+  ::RAJA::detail::check_body_bytes<camp::decay<decltype(loop_body)>>();
   //expt::check_forall_optional_args(loop_body, f_params);
 
+  using PluginHooks = util::detail::PluginHooks<
+      expt::plugins_enabled<camp::decay<decltype(f_params)>>::value>;
+
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+  PluginHooks::preCapture(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = PluginHooks::capture(loop_body);
 
-  util::callPostCapturePlugins(context);
+  PluginHooks::postCapture(context);
 
-  util::callPreLaunchPlugins(context);
+  PluginHooks::preLaunch(context);
 
   RAJA::resources::EventProxy<Res> e = wrap::forall_Icount(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<IdxSet>(c),
-      std::move(body),
+      std::forward<decltype(body)>(body),
       f_params);
 
-  util::callPostLaunchPlugins(context);
+  PluginHooks::postLaunch(context);
   return e;
 }
 template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
@@ -355,32 +700,48 @@ RAJA_INLINE concepts::enable_if_t<
     type_traits::is_indexset_policy<ExecutionPolicy>>
 forall(ExecutionPolicy&& p, Res r, IdxSet&& c, Params&&... params)
 {
-  static_assert(type_traits::is_index_set<IdxSet>::value,
+  static_assert(type_traits::is_index_set<IdxSet>::value ||
+                    type_traits::is_index_set_view<IdxSet>::value ||
+                    type_traits::is_device_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
   auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
+  ::RAJA::detail::check_body_bytes<camp::decay<decltype(loop_body)>>();
   expt::check_forall_optional_args(loop_body, f_params);
 
+  using PluginHooks = util::detail::PluginHooks<
+      expt::plugins_enabled<camp::decay<decltype(f_params)>>::value>;
+
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+  if (PluginHooks::enabled) {
+    context.kernel_name = expt::get_kernel_name(f_params);
+    context.num_iterations = static_cast<long long>(c.getLength());
+    context.body_bytes = sizeof(camp::decay<decltype(loop_body)>);
+    context.stream = resources::get_native_stream(r);
+    context.bytes = expt::get_bytes_moved(f_params);
+    if (expt::has_reducers<camp::decay<decltype(f_params)>>::value) {
+      context.kind = util::LaunchKind::parallel_reduce;
+    }
+  }
+  PluginHooks::preCapture(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = PluginHooks::capture(loop_body);
 
-  util::callPostCapturePlugins(context);
+  PluginHooks::postCapture(context);
 
-  util::callPreLaunchPlugins(context);
+  typename PluginHooks::active_context_type active_context{context};
+  PluginHooks::preLaunch(context);
 
   resources::EventProxy<Res> e = wrap::forall(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<IdxSet>(c),
-      std::move(body),
+      std::forward<decltype(body)>(body),
       f_params);
 
-  util::callPostLaunchPlugins(context);
+  PluginHooks::postLaunch(context);
   return e;
 }
 template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
@@ -454,27 +815,30 @@ forall_Icount(ExecutionPolicy&& p,
 
   auto f_params = expt::make_forall_param_pack(std::forward<FirstParam>(first), std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<FirstParam>(first), std::forward<Params>(params)...);
+  ::RAJA::detail::check_body_bytes<camp::decay<decltype(loop_body)>>();
   //expt::check_forall_optional_args(loop_body, f_params);
 
+  using PluginHooks = util::detail::PluginHooks<
+      expt::plugins_enabled<camp::decay<decltype(f_params)>>::value>;
+
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+  PluginHooks::preCapture(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = PluginHooks::capture(loop_body);
 
-  util::callPostCapturePlugins(context);
+  PluginHooks::postCapture(context);
 
-  util::callPreLaunchPlugins(context);
+  PluginHooks::preLaunch(context);
 
   resources::EventProxy<Res> e = wrap::forall_Icount(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<Container>(c),
       icount,
-      std::move(body),
+      std::forward<decltype(body)>(body),
       f_params);
 
-  util::callPostLaunchPlugins(context);
+  PluginHooks::postLaunch(context);
   return e;
 }
 template <typename ExecutionPolicy,
@@ -522,26 +886,40 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, Params&&... params)
 
   auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
+  ::RAJA::detail::check_body_bytes<camp::decay<decltype(loop_body)>>();
   expt::check_forall_optional_args(loop_body, f_params);
 
+  using PluginHooks = util::detail::PluginHooks<
+      expt::plugins_enabled<camp::decay<decltype(f_params)>>::value>;
+
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
-  util::callPreCapturePlugins(context);
+  if (PluginHooks::enabled) {
+    context.kernel_name = expt::get_kernel_name(f_params);
+    context.num_iterations = static_cast<long long>(std::distance(std::begin(c), std::end(c)));
+    context.body_bytes = sizeof(camp::decay<decltype(loop_body)>);
+    context.stream = resources::get_native_stream(r);
+    context.bytes = expt::get_bytes_moved(f_params);
+    if (expt::has_reducers<camp::decay<decltype(f_params)>>::value) {
+      context.kind = util::LaunchKind::parallel_reduce;
+    }
+  }
+  PluginHooks::preCapture(context);
 
-  using RAJA::util::trigger_updates_before;
-  auto body = trigger_updates_before(loop_body);
+  auto&& body = PluginHooks::capture(loop_body);
 
-  util::callPostCapturePlugins(context);
+  PluginHooks::postCapture(context);
 
-  util::callPreLaunchPlugins(context);
+  typename PluginHooks::active_context_type active_context{context};
+  PluginHooks::preLaunch(context);
 
   resources::EventProxy<Res> e =  wrap::forall(
       r,
       std::forward<ExecutionPolicy>(p),
       std::forward<Container>(c),
-      std::move(body),
+      std::forward<decltype(body)>(body),
       f_params);
 
-  util::callPostLaunchPlugins(context);
+  PluginHooks::postLaunch(context);
   return e;
 }
 
@@ -562,6 +940,84 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
       std::forward<LoopBody>(loop_body));
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Dispatch over a box segment with a value-based policy, the loop
+ *        body taking one index per dimension of the box
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          int DIM,
+          typename StorageT,
+          typename... Params>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>>
+forall(ExecutionPolicy&& p,
+       Res r,
+       TypedBoxSegment<DIM, StorageT> const& box,
+       Params&&... params)
+{
+  auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
+  auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
+  ::RAJA::detail::check_body_bytes<camp::decay<decltype(loop_body)>>();
+
+  using PluginHooks = util::detail::PluginHooks<
+      expt::plugins_enabled<camp::decay<decltype(f_params)>>::value>;
+
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (PluginHooks::enabled) {
+    context.kernel_name = expt::get_kernel_name(f_params);
+    context.num_iterations = static_cast<long long>(box.size());
+    context.body_bytes = sizeof(camp::decay<decltype(loop_body)>);
+    context.stream = resources::get_native_stream(r);
+    context.bytes = expt::get_bytes_moved(f_params);
+    if (expt::has_reducers<camp::decay<decltype(f_params)>>::value) {
+      context.kind = util::LaunchKind::parallel_reduce;
+    }
+  }
+  PluginHooks::preCapture(context);
+
+  auto&& body = PluginHooks::capture(loop_body);
+
+  PluginHooks::postCapture(context);
+
+  typename PluginHooks::active_context_type active_context{context};
+  PluginHooks::preLaunch(context);
+
+  resources::EventProxy<Res> e = wrap::forall(
+      r,
+      std::forward<ExecutionPolicy>(p),
+      box,
+      std::forward<decltype(body)>(body),
+      f_params);
+
+  PluginHooks::postLaunch(context);
+  return e;
+}
+
+template <typename ExecutionPolicy, int DIM, typename StorageT, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>>
+forall(ExecutionPolicy&& p,
+       TypedBoxSegment<DIM, StorageT> const& box,
+       LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      box,
+      std::forward<LoopBody>(loop_body));
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -586,6 +1042,76 @@ forall(Res r, Args&&... args)
       ExecutionPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief forall on resource r after the events in deps complete.
+ *
+ * The wait is enqueued on r, so with GPU resources the host does not
+ * block; the returned event proxy can in turn be given to depends_on.
+ */
+template <typename ExecutionPolicy, typename Res, size_t N, typename... Args>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>, type_traits::is_resource<Res>>
+forall(Res r, resources::Dependencies<N> deps, Args&&... args)
+{
+  deps.enqueue(r);
+  return ::RAJA::policy_by_value_interface::forall(
+      ExecutionPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Run a forall for each segment of a container of segments, each on
+ *        the next resource of a pool, and join them on resource join.
+ *
+ * The loops start after the work already enqueued on join and the work
+ * enqueued on join afterwards starts after all of them, so this behaves
+ * like running the loops in order on join, except that with GPU resources
+ * independent small loops can run concurrently on different streams.  The
+ * returned event proxy, on join, completes when all the loops complete.
+ *
+ * \verbatim
+ *   RAJA::resources::StreamPool<RAJA::resources::Cuda> pool(4);
+ *   std::vector<RAJA::TypedListSegment<int>> materials = ...;
+ *
+ *   RAJA::forall_concurrent<RAJA::cuda_exec_async<256>>(
+ *       pool, res, materials, [=] RAJA_DEVICE (int i) { ... });
+ * \endverbatim
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Segments,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_resource<Res>>
+forall_concurrent(resources::StreamPool<Res>& pool,
+                  Res join,
+                  Segments const& segments,
+                  LoopBody const& loop_body)
+{
+  using std::begin;
+  using std::end;
+
+  resources::Event start = join.get_event();
+
+  std::vector<Res> used;
+  used.reserve(pool.size());
+
+  for (auto it = begin(segments); it != end(segments); ++it) {
+    Res& r = pool.get();
+    if (used.size() < pool.size()) {
+      r.wait_for(&start);
+      used.push_back(r);
+    }
+    ::RAJA::policy_by_value_interface::forall(
+        ExecutionPolicy(), r, *it, loop_body);
+  }
+
+  for (Res& r : used) {
+    resources::Event done = r.get_event();
+    join.wait_for(&done);
+  }
+
+  return resources::EventProxy<Res>(join);
+}
+
 /*!
  * \brief Conversion from template-based policy to value-based policy for
  * forall_Icount
@@ -683,6 +1209,19 @@ namespace expt
       return dynamic_helper<IDX-1, POLICY_LIST>::invoke_forall(r, pol, seg, body);
     }
 
+    template<typename SEGMENT, typename BODY>
+    static void invoke_forall_sync(const int pol, SEGMENT const &seg, BODY const &body)
+    {
+      if(IDX==pol){
+        using t_pol = typename camp::at<POLICY_LIST,camp::num<IDX>>::type;
+        auto r = resources::get_resource<t_pol>::type::get_default();
+        RAJA::forall<t_pol>(r, seg, body);
+        r.wait();
+        return;
+      }
+      dynamic_helper<IDX-1, POLICY_LIST>::invoke_forall_sync(pol, seg, body);
+    }
+
   };
 
   template<typename POLICY_LIST>
@@ -716,6 +1255,20 @@ namespace expt
       return {r};
     }
 
+    template<typename SEGMENT, typename BODY>
+    static void
+    invoke_forall_sync(const int pol, SEGMENT const &seg, BODY const &body)
+    {
+      if(0==pol){
+        using t_pol = typename camp::at<POLICY_LIST,camp::num<0>>::type;
+        auto r = resources::get_resource<t_pol>::type::get_default();
+        RAJA::forall<t_pol>(r, seg, body);
+        r.wait();
+        return;
+      }
+      RAJA_ABORT_OR_THROW("Policy enum not supported ");
+    }
+
   };
 
   template<typename POLICY_LIST, typename SEGMENT, typename BODY>
@@ -741,9 +1294,49 @@ namespace expt
       RAJA_ABORT_OR_THROW("Policy value out of range");
     }
 
+    // make the device of a resource from device_select current
+    resources::DeviceScope device_scope(r);
+
     return dynamic_helper<N-1, POLICY_LIST>::invoke_forall(r, pol, seg, body);
   }
 
+  /*!
+   * Runs the forall with the policy in POLICY_LIST that Autotuner::get()
+   * found fastest for this kernel name and iteration count bucket.
+   *
+   * While a kernel is being tuned each invocation runs the next candidate,
+   * waits for it to complete and records its time, so the first
+   * num_trials*size(POLICY_LIST) invocations of each kernel are synchronous.
+   * Every invocation runs the body over the whole segment, whichever policy
+   * it picks, so the body must give the same result under every candidate.
+   */
+  template<typename POLICY_LIST, typename SEGMENT, typename BODY>
+  void tuned_forall(const char *name, SEGMENT const &seg, BODY const &body)
+  {
+    constexpr int N = camp::size<POLICY_LIST>::value;
+    static_assert(N > 0, "RAJA policy list must not be empty");
+
+    using std::begin;
+    using std::end;
+    Index_type size = static_cast<Index_type>(std::distance(begin(seg), end(seg)));
+
+    Autotuner &tuner = Autotuner::get();
+    bool timing = false;
+    int pol = tuner.select(name, size, N, timing);
+
+    if(!timing) {
+      dynamic_helper<N-1, POLICY_LIST>::invoke_forall(pol, seg, body);
+      return;
+    }
+
+    RAJA::Timer timer;
+    timer.start();
+    dynamic_helper<N-1, POLICY_LIST>::invoke_forall_sync(pol, seg, body);
+    timer.stop();
+
+    tuner.record(name, size, N, pol, timer.elapsed());
+  }
+
 }  // namespace expt
 
 
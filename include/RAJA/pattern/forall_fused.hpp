@@ -0,0 +1,234 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA fused forall declarations.
+*
+*          forall_fused runs several independent loops, each given as a
+*          segment and a loop body, with one execution of the policy. GPU
+*          policies run all of the loops in a single kernel launch, other
+*          policies run the loops one after the other.
+*
+*          Usage example:
+*
+*          RAJA::forall_fused<RAJA::cuda_exec<256>>(
+*              RAJA::TypedRangeSegment<int>(0, N), [=] RAJA_DEVICE (int i) {
+*                a[i] = 0;
+*              },
+*              RAJA::TypedRangeSegment<int>(0, M), [=] RAJA_DEVICE (int j) {
+*                b[j] = c[j];
+*              });
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_fused_HPP
+#define RAJA_forall_fused_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace impl
+{
+namespace fused
+{
+
+/*!
+        \brief run the loops one after the other, used by policies that do not
+   implement fused execution
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Segments,
+          typename Bodies,
+          camp::idx_t... Is>
+RAJA_INLINE
+resources::EventProxy<Res>
+forall_fused(
+    Res r,
+    const ExecPolicy &,
+    Segments& segs,
+    Bodies& bodies,
+    camp::idx_seq<Is...>)
+{
+  int unused[] = {0, (RAJA::wrap::forall(r,
+                                         ExecPolicy(),
+                                         camp::get<Is>(segs),
+                                         camp::get<Is>(bodies)), 0)...};
+  RAJA_UNUSED_VAR(unused);
+
+  return resources::EventProxy<Res>(r);
+}
+
+}  // namespace fused
+}  // namespace impl
+
+
+namespace detail
+{
+
+//! make a tuple of the segments from the segment, loop body argument pairs
+template <typename Args, camp::idx_t... Is>
+RAJA_INLINE auto fused_segments(Args& args, camp::idx_seq<Is...>)
+    -> camp::tuple<camp::decay<decltype(camp::get<2 * Is>(args))>...>
+{
+  return camp::make_tuple(camp::get<2 * Is>(args)...);
+}
+
+//! make a tuple of references to the loop bodies from the segment, loop
+//! body argument pairs
+template <typename Args, camp::idx_t... Is>
+RAJA_INLINE auto fused_bodies(Args& args, camp::idx_seq<Is...>)
+    -> decltype(camp::forward_as_tuple(camp::get<2 * Is + 1>(args)...))
+{
+  return camp::forward_as_tuple(camp::get<2 * Is + 1>(args)...);
+}
+
+//! capture the loop bodies and run the fused loops with plugins
+template <typename ExecPolicy,
+          typename Res,
+          typename Segments,
+          typename Bodies,
+          camp::idx_t... Is>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_loops(
+    ExecPolicy&& p,
+    Res r,
+    Segments& segs,
+    Bodies& bodies,
+    camp::idx_seq<Is...> loop_seq)
+{
+  util::PluginContext context{util::make_context<camp::decay<ExecPolicy>>()};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto captured_bodies =
+      camp::make_tuple(trigger_updates_before(camp::get<Is>(bodies))...);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = impl::fused::forall_fused(
+      r, std::forward<ExecPolicy>(p), segs, captured_bodies, loop_seq);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+
+}  // namespace detail
+
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  fused forall execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] r Resource the loops run on
+* \param[in] args Pairs of a segment and the loop body run over the segment
+*
+* Runs each loop body over its segment. The loops must be independent of
+* each other as their iterations may run in any order relative to each other.
+* GPU policies run all of the loops in one kernel launch with the blocks of
+* the grid split between the loops, other policies run the loops one after
+* the other.
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+forall_fused(ExecPolicy&& p, Res r, Args&&... args)
+{
+  static_assert(sizeof...(Args) > 0 && sizeof...(Args) % 2 == 0,
+                "forall_fused takes one or more pairs of a segment and a loop body");
+  using loop_seq = camp::make_idx_seq_t<sizeof...(Args) / 2>;
+
+  auto fused_args = camp::forward_as_tuple(std::forward<Args>(args)...);
+
+  auto segs = detail::fused_segments(fused_args, loop_seq{});
+  auto bodies = detail::fused_bodies(fused_args, loop_seq{});
+
+  return detail::forall_fused_loops(
+      std::forward<ExecPolicy>(p), r, segs, bodies, loop_seq{});
+}
+///
+template <typename ExecPolicy,
+          typename Arg,
+          typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      concepts::negate<type_traits::is_resource<camp::decay<Arg>>>>
+forall_fused(ExecPolicy&& p, Arg&& arg, Args&&... args)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall_fused(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Arg>(arg),
+      std::forward<Args>(args)...);
+}
+
+}  // end inline namespace policy_by_value_interface
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * forall_fused
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+forall_fused(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall_fused(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+forall_fused(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::forall_fused(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
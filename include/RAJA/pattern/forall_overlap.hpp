@@ -0,0 +1,206 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA forall_overlap declarations.
+*
+*          forall_overlap runs a loop body over the interior of a domain
+*          while the host waits for halo communication, then over the
+*          boundary that needs the halo.
+*
+*          Usage example:
+*
+*          auto segs = RAJA::make_overlap_segments(layout, 1, res);
+*          // post MPI_Irecv and MPI_Isend
+*          RAJA::forall_overlap<RAJA::cuda_exec_async<256>>(
+*              res, segs.interior, segs.boundary,
+*              [=] RAJA_DEVICE (int i) { ... },
+*              [&]() { MPI_Waitall(...); });
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_overlap_HPP
+#define RAJA_forall_overlap_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief The owned points of a domain split into the interior, that does
+ *        not read halo values, and the boundary, that does.
+ *
+ * The segments hold linear indices of the layout they were made from.
+ */
+template <typename IdxLin>
+struct OverlapSegments {
+  TypedListSegment<IdxLin> interior;
+  TypedListSegment<IdxLin> boundary;
+};
+
+/*!
+ * \brief Split the points of an OffsetLayout with a halo of halo_width
+ *        points on every side into interior and boundary segments.
+ *
+ * The owned points are the points of the layout that are not in the halo.
+ * Owned points within halo_width of the halo, which a stencil of radius
+ * halo_width reads halo values for, make up the boundary segment and the
+ * other owned points the interior segment. The index data of the segments
+ * lives in the memory of res.
+ */
+template <size_t n_dims, typename IdxLin>
+OverlapSegments<IdxLin> make_overlap_segments(
+    OffsetLayout<n_dims, IdxLin> const& layout,
+    IdxLin halo_width,
+    camp::resources::Resource res)
+{
+  std::vector<IdxLin> interior;
+  std::vector<IdxLin> boundary;
+
+  IdxLin begin[n_dims];
+  IdxLin end[n_dims];
+  IdxLin idx[n_dims];
+  bool empty = false;
+  for (size_t d = 0; d < n_dims; ++d) {
+    begin[d] = layout.offsets[d] + halo_width;
+    end[d] = layout.offsets[d] + layout.base_.sizes[d] - halo_width;
+    idx[d] = begin[d];
+    empty = empty || !(begin[d] < end[d]);
+  }
+
+  // visit the owned points in the order of the last dimension fastest
+  while (!empty) {
+    IdxLin lin = 0;
+    bool on_boundary = false;
+    for (size_t d = 0; d < n_dims; ++d) {
+      lin += (idx[d] - layout.offsets[d]) * layout.base_.strides[d];
+      on_boundary = on_boundary || idx[d] < begin[d] + halo_width ||
+                    idx[d] >= end[d] - halo_width;
+    }
+    (on_boundary ? boundary : interior).push_back(lin);
+
+    size_t d = n_dims;
+    while (d > 0 && ++idx[d - 1] == end[d - 1]) {
+      idx[d - 1] = begin[d - 1];
+      --d;
+    }
+    empty = (d == 0);
+  }
+
+  return OverlapSegments<IdxLin>{TypedListSegment<IdxLin>(interior, res),
+                                 TypedListSegment<IdxLin>(boundary, res)};
+}
+
+/*!
+******************************************************************************
+*
+* \brief  forall with communication overlapped by interior computation
+*
+* \param[in] r Resource the interior runs on
+* \param[in] interior Segment of the points that do not read the halo
+* \param[in] boundary Segment of the points that read the halo
+* \param[in] body Loop body run over both segments
+* \param[in] wait_fn Host function completing the halo communication
+*
+* Launches the body over the interior on r, then calls wait_fn on the host,
+* then launches the body over the boundary on a second resource of the same
+* type. The boundary starts after the work enqueued on r before the call
+* and r waits for the boundary, so the returned event covers both loops.
+*
+* The interior only overlaps wait_fn with policies that return before the
+* loop is done, e.g. cuda_exec_async and hip_exec_async. With other policies
+* the three steps run one after the other.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InteriorSegment,
+          typename BoundarySegment,
+          typename LoopBody,
+          typename WaitFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+forall_overlap(Res r,
+               InteriorSegment&& interior,
+               BoundarySegment&& boundary,
+               LoopBody&& body,
+               WaitFn&& wait_fn)
+{
+  // a new resource of a GPU type uses another stream from the pool
+  Res boundary_res{};
+
+  auto before = r.get_event();
+  boundary_res.wait_for(&before);
+
+  ::RAJA::forall<ExecPolicy>(r, std::forward<InteriorSegment>(interior), body);
+
+  wait_fn();
+
+  ::RAJA::forall<ExecPolicy>(boundary_res,
+                             std::forward<BoundarySegment>(boundary),
+                             body);
+
+  auto after = boundary_res.get_event();
+  r.wait_for(&after);
+
+  return resources::EventProxy<Res>(r);
+}
+///
+template <typename ExecPolicy,
+          typename InteriorSegment,
+          typename BoundarySegment,
+          typename LoopBody,
+          typename WaitFn,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      concepts::negate<type_traits::is_resource<camp::decay<InteriorSegment>>>>
+forall_overlap(InteriorSegment&& interior,
+               BoundarySegment&& boundary,
+               LoopBody&& body,
+               WaitFn&& wait_fn)
+{
+  Res r = Res::get_default();
+  return ::RAJA::forall_overlap<ExecPolicy>(
+      r,
+      std::forward<InteriorSegment>(interior),
+      std::forward<BoundarySegment>(boundary),
+      std::forward<LoopBody>(body),
+      std::forward<WaitFn>(wait_fn));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
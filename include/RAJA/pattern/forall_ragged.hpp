@@ -0,0 +1,183 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA forall_ragged declarations.
+*
+*          forall_ragged runs a loop body over every (outer, inner) pair of
+*          a nested loop whose inner length varies with the outer index,
+*          as one flat range so each iterate is the same amount of work.
+*
+*          Usage example:
+*
+*          // corner_offsets[z] is the first corner of zone z, and
+*          // corner_offsets[num_zones] the number of corners
+*          RAJA::forall_ragged<RAJA::cuda_exec<256>>(
+*              RAJA::make_span(corner_offsets, num_zones + 1),
+*              [=] RAJA_DEVICE (int z, int c) { ... });
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_ragged_HPP
+#define RAJA_forall_ragged_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Outer index of flat index i, the last o in [0, num_outer) with
+ *        offsets[o] <= i, so outer items with no inner items are skipped.
+ */
+template <typename IndexType>
+RAJA_HOST_DEVICE RAJA_INLINE IndexType ragged_outer_index(
+    IndexType const* offsets,
+    IndexType num_outer,
+    IndexType i)
+{
+  // first o in [0, num_outer] with offsets[o] > i
+  IndexType lo = 0;
+  IndexType hi = num_outer;
+  while (lo < hi) {
+    const IndexType mid = lo + (hi - lo) / 2;
+    if (offsets[mid + 1] <= i) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief Loop body over the flat range of forall_ragged, recovers the outer
+ *        and inner index of each flat index and calls body with them.
+ */
+template <typename IndexType, typename LoopBody>
+struct RaggedBody {
+  IndexType const* offsets;
+  IndexType num_outer;
+  LoopBody body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(IndexType i) const
+  {
+    const IndexType o = ragged_outer_index(offsets, num_outer, i);
+    body(o, static_cast<IndexType>(i - offsets[o]));
+  }
+};
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  forall over a nested loop with a variable inner length
+*
+* \param[in] r Resource the loop runs on
+* \param[in] offsets Contiguous Random-Access Container of num_outer + 1
+*ascending offsets, outer index o has inner indices [0, offsets[o+1] -
+*offsets[o])
+* \param[in] body Loop body called as body(outer, inner)
+*
+* Runs body over the flat range [offsets[0], offsets[num_outer]) with
+* ExecPolicy, recovering the outer index of each iterate by a binary search
+* of offsets. Every iterate is one inner item, so long and short inner
+* loops are spread evenly over threads instead of a thread running each
+* outer item. The offsets are the exclusive scan of the inner lengths, e.g.
+* from RAJA::exclusive_scan, and must be accessible with ExecPolicy. The
+* first and last offsets are copied to the host to size the range, which
+* waits for the work enqueued on r.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename OffsetContainer,
+          typename LoopBody>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<OffsetContainer>>
+forall_ragged(Res r, OffsetContainer&& offsets, LoopBody&& body)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using IndexType =
+      camp::decay<RAJA::detail::ContainerVal<OffsetContainer>>;
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+  static_assert(std::is_integral<IndexType>::value,
+                "forall_ragged offsets must be integers");
+
+  const IndexType num_outer =
+      static_cast<IndexType>(distance(begin(offsets), end(offsets))) - 1;
+  if (num_outer <= 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  IndexType const* first = &*begin(offsets);
+
+  IndexType bounds[2];
+  r.memcpy(&bounds[0], first, sizeof(IndexType));
+  r.memcpy(&bounds[1], first + num_outer, sizeof(IndexType));
+  r.wait();
+
+  using body_type = detail::RaggedBody<IndexType, camp::decay<LoopBody>>;
+  return ::RAJA::forall<ExecPolicy>(
+      r,
+      TypedRangeSegment<IndexType>(bounds[0], bounds[1]),
+      body_type{first, num_outer, std::forward<LoopBody>(body)});
+}
+///
+template <typename ExecPolicy,
+          typename OffsetContainer,
+          typename LoopBody,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      concepts::negate<type_traits::is_resource<camp::decay<OffsetContainer>>>>
+forall_ragged(OffsetContainer&& offsets, LoopBody&& body)
+{
+  Res r = Res::get_default();
+  return ::RAJA::forall_ragged<ExecPolicy>(
+      r,
+      std::forward<OffsetContainer>(offsets),
+      std::forward<LoopBody>(body));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,244 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA forall_streamed declarations.
+*
+*          forall_streamed runs a loop body over host data, e.g. a memory
+*          mapped file, that is larger than the memory of the device, by
+*          streaming it through the device a chunk at a time. The copies of
+*          each chunk to and from the device overlap the loops over other
+*          chunks on the other resources of a pool.
+*
+*          Usage example:
+*
+*          std::vector<RAJA::resources::Cuda> pool(3);
+*          double* x = (double*)mmap(..., N * sizeof(double), ...);
+*          RAJA::forall_streamed<RAJA::cuda_exec_async<256>>(
+*              pool, x, N, chunk,
+*              [=] RAJA_DEVICE (RAJA::Index_type i, double& xi) { ... });
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_streamed_HPP
+#define RAJA_forall_streamed_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Kind of host memory forall_streamed copies from and to.
+ *
+ * Copies from pageable memory, which includes memory mapped files, are not
+ * asynchronous on GPUs, so Pageable data is staged through pinned buffers
+ * on the host. Pinned data is copied directly.
+ */
+enum class StreamedHost { Pageable, Pinned };
+
+namespace detail
+{
+
+/*!
+ * \brief Loop body over the device buffer of a chunk, calls body with the
+ *        index in the host data and the item of the buffer.
+ */
+template <typename T, typename LoopBody>
+struct StreamedBody {
+  T* buffer;
+  Index_type offset;
+  LoopBody body;
+
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type i) const
+  {
+    body(offset + i, buffer[i]);
+  }
+};
+
+/*!
+ * \brief Stream data through the device buffers of depth resources, see
+ *        RAJA::forall_streamed.
+ *
+ * Chunk c runs on resource c % depth, which copies it to its device buffer,
+ * runs the loop and copies it back, so a buffer is reused only after the
+ * work enqueued before on the same resource. With staging, the host copies
+ * chunk c into the pinned buffer of its resource after waiting for chunk
+ * c - depth on that resource and copying its results out.
+ */
+template <typename ExecPolicy, typename Res, typename T, typename LoopBody>
+void streamed_forall_pipeline(Res* res,
+                              size_t depth,
+                              T* data,
+                              Index_type N,
+                              Index_type chunk,
+                              StreamedHost host,
+                              LoopBody const& body)
+{
+  const bool staged = host == StreamedHost::Pageable;
+  std::vector<T*> device(depth, nullptr);
+  std::vector<T*> stage(depth, nullptr);
+  // chunk whose results are in the pinned buffer of each resource
+  std::vector<Index_type> pending_lo(depth, 0);
+  std::vector<Index_type> pending_len(depth, 0);
+
+  for (size_t s = 0; s < depth; ++s) {
+    camp::resources::Resource mem{res[s]};
+    device[s] = mem.template allocate<T>(chunk);
+    if (staged) {
+      stage[s] = mem.template allocate<T>(
+          chunk, camp::resources::MemoryAccess::Pinned);
+    }
+  }
+
+  auto write_back = [&](size_t s) {
+    res[s].wait();
+    if (pending_len[s] > 0) {
+      std::memcpy(data + pending_lo[s],
+                  stage[s],
+                  sizeof(T) * static_cast<size_t>(pending_len[s]));
+      pending_len[s] = 0;
+    }
+  };
+
+  size_t s = 0;
+  for (Index_type lo = 0; lo < N; lo += chunk) {
+    const Index_type len = std::min(chunk, N - lo);
+    const size_t bytes = sizeof(T) * static_cast<size_t>(len);
+    T* from = data + lo;
+    if (staged) {
+      write_back(s);
+      std::memcpy(stage[s], from, bytes);
+      from = stage[s];
+    }
+
+    res[s].memcpy(device[s], from, bytes);
+    ::RAJA::forall<ExecPolicy>(res[s],
+                               TypedRangeSegment<Index_type>(0, len),
+                               StreamedBody<T, LoopBody>{device[s], lo, body});
+    res[s].memcpy(from, device[s], bytes);
+
+    if (staged) {
+      pending_lo[s] = lo;
+      pending_len[s] = len;
+    }
+    s = (s + 1) % depth;
+  }
+
+  for (size_t t = 0; t < depth; ++t) {
+    write_back(t);
+    camp::resources::Resource mem{res[t]};
+    mem.deallocate(device[t]);
+    if (staged) {
+      mem.deallocate(stage[t], camp::resources::MemoryAccess::Pinned);
+    }
+  }
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  forall over host data streamed through the device in chunks
+*
+* \param[in] res_pool Contiguous Random-Access Container of resources, one
+*device buffer of chunk items is allocated on each
+* \param[in] data Host pointer to N items, e.g. a memory mapped file
+* \param[in] N Number of items
+* \param[in] chunk Number of items copied to the device at a time
+* \param[in] body Loop body called as body(i, item), where item is the copy
+*on the device of data[i] and is copied back to data[i] after the loop
+* \param[in] host Kind of memory data points to
+*
+* The chunks are handed to the resources of the pool in turn, so with two
+* or three resources the copies of a chunk overlap the loops over the
+* others, and at most size of pool * chunk items are on the device at once.
+* The copies overlap the loops only with asynchronous policies. The call
+* returns once the results are in data. With host resources the loop runs
+* over data directly.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ResContainer,
+          typename T,
+          typename LoopBody>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<ResContainer>>
+forall_streamed(ResContainer&& res_pool,
+                T* data,
+                Index_type N,
+                Index_type chunk,
+                LoopBody&& body,
+                StreamedHost host = StreamedHost::Pageable)
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using Res = camp::decay<RAJA::detail::ContainerVal<ResContainer>>;
+  static_assert(type_traits::is_random_access_range<ResContainer>::value,
+                "ResContainer must model RandomAccessRange");
+  static_assert(type_traits::is_resource<Res>::value,
+                "forall_streamed res_pool must hold resources");
+
+  const size_t depth =
+      static_cast<size_t>(distance(begin(res_pool), end(res_pool)));
+  if (depth == 0) {
+    RAJA_ABORT_OR_THROW("forall_streamed needs at least one resource");
+  }
+  if (N <= 0) {
+    return;
+  }
+  Res* res = &*begin(res_pool);
+  using body_type = camp::decay<LoopBody>;
+
+  if (std::is_same<Res, resources::Host>::value) {
+    ::RAJA::forall<ExecPolicy>(
+        res[0],
+        TypedRangeSegment<Index_type>(0, N),
+        detail::StreamedBody<T, body_type>{data, 0, body});
+    res[0].wait();
+    return;
+  }
+
+  detail::streamed_forall_pipeline<ExecPolicy>(
+      res, depth, data, N, (chunk > 0 && chunk < N) ? chunk : N, host,
+      static_cast<body_type const&>(body));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
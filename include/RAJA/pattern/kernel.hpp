@@ -200,12 +200,15 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 #include "RAJA/pattern/kernel/Conditional.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/pattern/kernel/ForICount.hpp"
+#include "RAJA/pattern/kernel/ForUnroll.hpp"
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
+#include "RAJA/pattern/kernel/PermutedFor.hpp"
 #include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/Region.hpp"
+#include "RAJA/pattern/kernel/Sequence.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
 
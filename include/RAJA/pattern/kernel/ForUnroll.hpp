@@ -0,0 +1,101 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the unrolled loop statement and executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_ForUnroll_HPP
+#define RAJA_pattern_kernel_ForUnroll_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/internal/unroll.hpp"
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements a sequential loop unrolled by
+ * UnrollFactor.
+ * Assigns the loop iterate to argument ArgumentId
+ *
+ * The enclosed statements are expanded UnrollFactor times at compile time.
+ * When the segment length equals UnrollFactor the loop is fully unrolled,
+ * otherwise the iterations past the last full block run in a plain loop.
+ * This is meant for short fixed-size loops, such as the moment or group
+ * loops of a transport sweep.
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t UnrollFactor,
+          typename... EnclosedStmts>
+struct ForUnroll : public internal::ForList,
+                   public internal::ForTraitBase<ArgumentId, seq_exec>,
+                   public internal::Statement<seq_exec, EnclosedStmts...> {
+
+  static_assert(UnrollFactor > 0, "ForUnroll UnrollFactor must be positive");
+
+  using execution_policy_t = seq_exec;
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+
+/*!
+ * A generic RAJA::kernel executor for statement::ForUnroll
+ *
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t UnrollFactor,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::ForUnroll<ArgumentId, UnrollFactor, EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    ForWrapper<ArgumentId, Data, NewTypes, EnclosedStmts...> for_wrapper(data);
+
+    auto len = segment_length<ArgumentId>(data);
+
+    unroll_loop<UnrollFactor>(len, for_wrapper);
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_ForUnroll_HPP */
@@ -194,6 +194,99 @@ struct StatementExecutor<
 };
 
 
+/*!
+ * Sets the segment types of all of the arguments Ids from the Data.
+ */
+template <typename Types, typename Data, camp::idx_t... Ids>
+struct SetSegmentTypesFromDataHelper {
+  using type = Types;
+};
+
+template <typename Types, typename Data, camp::idx_t Id, camp::idx_t... Ids>
+struct SetSegmentTypesFromDataHelper<Types, Data, Id, Ids...> {
+  using type = typename SetSegmentTypesFromDataHelper<
+      setSegmentTypeFromData<Types, Id, Data>,
+      Data,
+      Ids...>::type;
+};
+
+template <typename Types, typename Data, camp::idx_t... Ids>
+using setSegmentTypesFromData =
+    typename SetSegmentTypesFromDataHelper<Types, Data, Ids...>::type;
+
+
+/*!
+ * The iterates of the arguments Args of a hyperplane, flattened into one
+ * index with the last argument running fastest. Used by the GPU wavefront
+ * executors to spread the points of each hyperplane over the whole grid.
+ */
+template <camp::idx_t... Args>
+struct HyperplaneOffsets;
+
+template <>
+struct HyperplaneOffsets<> {
+
+  //! number of flattened iterates
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type size(Data const &)
+  {
+    return 1;
+  }
+
+  //! sum of the largest iterate of each argument
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type max_sum(Data const &)
+  {
+    return 0;
+  }
+
+  //! assign the iterates of flattened index k, returns their sum
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type assign(Data &, Index_type)
+  {
+    return 0;
+  }
+};
+
+template <camp::idx_t Arg, camp::idx_t... Args>
+struct HyperplaneOffsets<Arg, Args...> {
+
+  using rest_t = HyperplaneOffsets<Args...>;
+
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type length(Data const &data)
+  {
+    return static_cast<Index_type>(
+        stripIndexType(segment_length<Arg>(data)));
+  }
+
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type size(Data const &data)
+  {
+    return length(data) * rest_t::size(data);
+  }
+
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type max_sum(Data const &data)
+  {
+    return length(data) - 1 + rest_t::max_sum(data);
+  }
+
+  template <typename Data>
+  static RAJA_HOST_DEVICE RAJA_INLINE Index_type assign(Data &data,
+                                                        Index_type k)
+  {
+    using offset_t =
+        camp::tuple_element_t<Arg, typename camp::decay<Data>::offset_tuple_t>;
+
+    Index_type rest_size = rest_t::size(data);
+    Index_type i = k / rest_size;
+    data.template assign_offset<Arg>(static_cast<offset_t>(i));
+    return i + rest_t::assign(data, k % rest_size);
+  }
+};
+
+
 }  // end namespace internal
 
 }  // end namespace RAJA
@@ -58,6 +58,21 @@ struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts
 namespace internal
 {
 
+/*!
+ * Number of elements of type T allocated for a cpu_tile_mem array of NumElem
+ * elements, rounded up to whole DATA_ALIGN blocks so vector loads and stores
+ * at the end of the tile stay within the array.
+ */
+template<typename T>
+constexpr camp::idx_t cpu_tile_mem_elems(camp::idx_t NumElem)
+{
+  return (sizeof(T) >= size_t(RAJA::DATA_ALIGN) || RAJA::DATA_ALIGN % sizeof(T) != 0)
+             ? NumElem
+             : (NumElem + camp::idx_t(RAJA::DATA_ALIGN / sizeof(T)) - 1) /
+                   camp::idx_t(RAJA::DATA_ALIGN / sizeof(T)) *
+                   camp::idx_t(RAJA::DATA_ALIGN / sizeof(T));
+}
+
 //Statement executor to initalize RAJA local array
 template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
 struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
@@ -76,24 +91,20 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
   {
     using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::value_type;
 
-    // Initialize memory
-#ifdef RAJA_COMPILER_MSVC
-    // MSVC doesn't like taking a pointer to stack allocated data?!?!
-    varType *ptr = new varType[camp::get<Pos>(data.param_tuple).size()];
-    camp::get<Pos>(data.param_tuple).set_data(ptr);
-#else
-    varType Array[camp::get<Pos>(data.param_tuple).size()];
+    // Initialize memory, the size is a constant of the static layout so
+    // the array has a fixed place in the stack frame. It is aligned and
+    // padded to DATA_ALIGN so simd loops over the tile use aligned, full
+    // width vector loads and stores.
+    constexpr camp::idx_t NumElem = camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::layout_type::s_size;
+
+    alignas(varType) alignas(RAJA::DATA_ALIGN) varType Array[cpu_tile_mem_elems<varType>(NumElem)];
     camp::get<Pos>(data.param_tuple).set_data(&Array[0]);
-#endif
 
     // Initialize others and execute
     exec_expanded<others...>(data);
 
     // Cleanup and return
     camp::get<Pos>(data.param_tuple).set_data(nullptr);
-#ifdef RAJA_COMPILER_MSVC
-    delete[] ptr;
-#endif
   }
   
 
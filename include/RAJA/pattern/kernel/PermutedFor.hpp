@@ -0,0 +1,240 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for a loop nest whose order is chosen at run time.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_PermutedFor_HPP
+#define RAJA_pattern_kernel_PermutedFor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that implements a nest of loops over the
+ * arguments in ArgList, in an order chosen at run time.
+ *
+ * Every order of the loops is instantiated, and the one run is given by
+ * the kernel parameter ParamId, the rank of the order in lexicographic
+ * order of the positions in ArgList. Rank 0 nests the loops as listed,
+ * and RAJA::layout_loop_rank gives the rank that runs the stride one
+ * dimension of a layout innermost. The outermost loop uses ExecPolicy and
+ * the inner loops seq_exec.
+ *
+ * For example:
+ * PermutedFor<0, ArgList<0, 1, 2>, omp_parallel_for_exec, Lambda<0>>
+ * with param 5 runs For<2, omp_parallel_for_exec, For<1, seq_exec,
+ * For<0, seq_exec, Lambda<0>>>>.
+ */
+template <camp::idx_t ParamId,
+          typename ArgList,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct PermutedFor
+    : public internal::Statement<ExecPolicy, EnclosedStmts...> {
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+//! most loops a PermutedFor nests, it instantiates max! orders
+constexpr camp::idx_t max_permuted_loops = 4;
+
+RAJA_HOST_DEVICE constexpr camp::idx_t permutation_count(camp::idx_t n)
+{
+  return n <= 1 ? 1 : n * permutation_count(n - 1);
+}
+
+/*!
+ * Position of the element at pos of the rank-th permutation of n
+ * elements, in lexicographic order.
+ */
+RAJA_HOST_DEVICE constexpr camp::idx_t permutation_at(camp::idx_t n,
+                                                      camp::idx_t rank,
+                                                      camp::idx_t pos)
+{
+  bool used[max_permuted_loops] = {};
+  camp::idx_t value = 0;
+  for (camp::idx_t p = 0; p <= pos; ++p) {
+    camp::idx_t const count = permutation_count(n - 1 - p);
+    camp::idx_t k = rank / count;
+    rank = rank % count;
+    for (value = 0; used[value] || k > 0; ++value) {
+      if (!used[value]) --k;
+    }
+    used[value] = true;
+  }
+  return value;
+}
+
+//! For loops over the arguments of Order, outermost first
+template <typename ExecPolicy, typename Order, typename... EnclosedStmts>
+struct PermutedNest;
+
+template <typename ExecPolicy, camp::idx_t Arg, typename... EnclosedStmts>
+struct PermutedNest<ExecPolicy, camp::idx_seq<Arg>, EnclosedStmts...> {
+  using type = statement::For<Arg, ExecPolicy, EnclosedStmts...>;
+};
+
+template <typename ExecPolicy,
+          camp::idx_t Arg,
+          camp::idx_t Next,
+          camp::idx_t... Rest,
+          typename... EnclosedStmts>
+struct PermutedNest<ExecPolicy,
+                    camp::idx_seq<Arg, Next, Rest...>,
+                    EnclosedStmts...> {
+  using type = statement::For<
+      Arg,
+      ExecPolicy,
+      typename PermutedNest<seq_exec,
+                            camp::idx_seq<Next, Rest...>,
+                            EnclosedStmts...>::type>;
+};
+
+template <typename Args, camp::idx_t Rank, typename Positions>
+struct PermutedOrder;
+
+template <camp::idx_t... Args, camp::idx_t Rank, camp::idx_t... Positions>
+struct PermutedOrder<camp::idx_seq<Args...>,
+                     Rank,
+                     camp::idx_seq<Positions...>> {
+  using type = camp::idx_seq<camp::seq_at<
+      permutation_at(sizeof...(Args), Rank, Positions),
+      camp::idx_seq<Args...>>::value...>;
+};
+
+/*!
+ * Executor for statement::PermutedFor, runs the nest of the rank in the
+ * kernel parameter ParamId.
+ */
+template <camp::idx_t ParamId,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::PermutedFor<ParamId,
+                                                camp::idx_seq<Args...>,
+                                                ExecPolicy,
+                                                EnclosedStmts...>,
+                         Types> {
+
+  static constexpr camp::idx_t num_loops = sizeof...(Args);
+
+  static_assert(num_loops >= 1 && num_loops <= max_permuted_loops,
+                "PermutedFor nests 1 to max_permuted_loops loops");
+
+  template <camp::idx_t Rank>
+  using nest_t = typename PermutedNest<
+      ExecPolicy,
+      typename PermutedOrder<camp::idx_seq<Args...>,
+                             Rank,
+                             camp::make_idx_seq_t<num_loops>>::type,
+      EnclosedStmts...>::type;
+
+  template <typename Data, camp::idx_t... Ranks>
+  static RAJA_INLINE void exec_rank(Data &&data,
+                                    camp::idx_t rank,
+                                    camp::idx_seq<Ranks...>)
+  {
+    int seq[] = {0,
+                 (rank == Ranks ? (execute_statement_list<
+                                       camp::list<nest_t<Ranks>>,
+                                       Types>(data),
+                                   0)
+                                : 0)...};
+    RAJA_UNUSED_VAR(seq);
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    camp::idx_t const rank =
+        static_cast<camp::idx_t>(camp::get<ParamId>(data.param_tuple));
+
+    exec_rank(data,
+              rank,
+              camp::make_idx_seq_t<permutation_count(num_loops)>{});
+  }
+};
+
+}  // namespace internal
+
+/*!
+ * Lexicographic rank of order, a permutation of 0 to N-1, as used by the
+ * parameter of statement::PermutedFor.
+ */
+template <size_t N>
+RAJA_INLINE camp::idx_t permutation_rank(
+    std::array<camp::idx_t, N> const &order)
+{
+  camp::idx_t rank = 0;
+  for (size_t p = 0; p < N; ++p) {
+    camp::idx_t smaller = 0;
+    for (size_t q = p + 1; q < N; ++q) {
+      if (order[q] < order[p]) ++smaller;
+    }
+    rank += smaller * internal::permutation_count(camp::idx_t(N - 1 - p));
+  }
+  return rank;
+}
+
+/*!
+ * Dimensions of layout from the largest stride to the smallest, the loop
+ * order that runs the stride one dimension innermost.
+ */
+template <typename Layout>
+RAJA_INLINE std::array<camp::idx_t, Layout::n_dims> layout_loop_order(
+    Layout const &layout)
+{
+  std::array<camp::idx_t, Layout::n_dims> order;
+  for (size_t d = 0; d < Layout::n_dims; ++d) {
+    order[d] = camp::idx_t(d);
+  }
+  std::stable_sort(order.begin(),
+                   order.end(),
+                   [&](camp::idx_t a, camp::idx_t b) {
+                     return layout.strides[a] > layout.strides[b];
+                   });
+  return order;
+}
+
+/*!
+ * Parameter of a statement::PermutedFor whose ArgList lists the arguments
+ * indexing the dimensions of layout, so the loop over the stride one
+ * dimension is innermost.
+ */
+template <typename Layout>
+RAJA_INLINE camp::idx_t layout_loop_rank(Layout const &layout)
+{
+  return permutation_rank(layout_loop_order(layout));
+}
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_PermutedFor_HPP */
@@ -28,6 +28,20 @@
 namespace RAJA
 {
 
+namespace internal
+{
+
+//! true for a RAJA::ParamList of param ids
+template <typename T>
+struct is_param_list : std::false_type {
+};
+
+template <camp::idx_t... ParamIds>
+struct is_param_list<camp::idx_seq<ParamIds...>> : std::true_type {
+};
+
+}  // end namespace internal
+
 namespace statement
 {
 
@@ -37,6 +51,10 @@ namespace statement
  * This reduces a value down to a "root" thread, and then only executes
  * the enclosed statements on the thread which contains the reduced value.
  *
+ * ParamId may also be a RAJA::ParamList< #, ... > to reduce several params
+ * with the same operator, on GPUs in one shared memory pass per block, so
+ * the enclosed statements combine all of them once per block.
+ *
  */
 template <typename ReducePolicy,
           template <typename...> class ReduceOperator,
@@ -44,9 +62,10 @@ template <typename ReducePolicy,
           typename... EnclosedStmts>
 struct Reduce : public internal::Statement<camp::nil, EnclosedStmts...> {
 
-  static_assert(std::is_base_of<internal::ParamBase, ParamId>::value,
+  static_assert(std::is_base_of<internal::ParamBase, ParamId>::value ||
+                    internal::is_param_list<ParamId>::value,
                 "Inappropriate ParamId, ParamId must be of type "
-                "RAJA::Statement::Param< # >");
+                "RAJA::Statement::Param< # > or RAJA::ParamList< #, ... >");
 
   using execution_policy_t = camp::nil;
 };
@@ -0,0 +1,73 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for kernel sequence templates
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Sequence_HPP
+#define RAJA_pattern_kernel_Sequence_HPP
+
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include <type_traits>
+
+namespace RAJA
+{
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that runs its enclosed statements one after the
+ * other.
+ *
+ * This groups several loop nests into one statement so they can be placed
+ * together under a single statement, for example several For nests that
+ * share the same outer loops or the same InitLocalMem, and run in one
+ * CudaKernel or HipKernel launch. Place a CudaSyncThreads or HipSyncThreads
+ * between nests when a nest reads local memory written by an earlier nest.
+ *
+ */
+template <typename... EnclosedStmts>
+struct Sequence : public internal::Statement<camp::nil, EnclosedStmts...> {
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+
+template <typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Sequence<EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(
+        std::forward<Data>(data));
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_Sequence_HPP */
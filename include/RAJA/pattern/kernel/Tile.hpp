@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <type_traits>
 
@@ -27,6 +28,8 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -74,6 +77,79 @@ struct tile_dynamic {
   static constexpr camp::idx_t id = ArgumentId;
 };
 
+///! tag for a tiling loop whose tile fills a level of the data cache
+///
+/// Tiles are sized so that NumDims nested tile_auto loops with the same
+/// parameters each make tiles of the same size, and one tile of NumDims
+/// dimensions, with FootprintBytes of data per iterate, fills half of the
+/// CacheLevel data cache. The other half is left for data that is not
+/// tiled. Nesting a tile_auto<2,...> loop around a tile_auto<1,...> loop on
+/// the same argument makes L1 tiles within L2 tiles. FootprintBytes is
+/// typically view_footprint<Views...>::value for the Views the body touches.
+///
+/// The size is computed from get_cache_size the first time it is needed and
+/// reused afterwards.
+template <camp::idx_t CacheLevel,
+          camp::idx_t FootprintBytes,
+          camp::idx_t NumDims = 1>
+struct tile_auto {
+  static_assert(CacheLevel >= 1 && CacheLevel <= 3,
+                "tile_auto CacheLevel must be 1, 2 or 3");
+  static_assert(FootprintBytes > 0, "tile_auto FootprintBytes must be positive");
+  static_assert(NumDims > 0, "tile_auto NumDims must be positive");
+
+  static constexpr camp::idx_t cache_level = CacheLevel;
+  static constexpr camp::idx_t footprint_bytes = FootprintBytes;
+  static constexpr camp::idx_t num_dims = NumDims;
+
+  //! the largest size whose NumDims power of iterates fits the budget
+  static camp::idx_t compute_chunk_size(size_t cache_bytes)
+  {
+    double num_iterates =
+        static_cast<double>(cache_bytes / 2 / FootprintBytes);
+    auto fits = [=](camp::idx_t size) {
+      double tile_iterates = 1.0;
+      for (camp::idx_t d = 0; d < NumDims; ++d) {
+        tile_iterates *= static_cast<double>(size);
+      }
+      return tile_iterates <= num_iterates;
+    };
+    camp::idx_t size = static_cast<camp::idx_t>(
+        std::pow(num_iterates, 1.0 / static_cast<double>(NumDims)));
+    // correct for rounding in pow
+    while (size > 1 && !fits(size)) {
+      --size;
+    }
+    while (fits(size + 1)) {
+      ++size;
+    }
+    return (size < 1) ? 1 : size;
+  }
+
+  static camp::idx_t get_chunk_size()
+  {
+    static const camp::idx_t chunk_size =
+        compute_chunk_size(get_cache_size(CacheLevel));
+    return chunk_size;
+  }
+};
+
+///! bytes of data per iterate of a body that touches one element of each View
+template <typename... Views>
+struct view_footprint;
+
+template <>
+struct view_footprint<>
+    : std::integral_constant<camp::idx_t, 0> {
+};
+
+template <typename View, typename... Views>
+struct view_footprint<View, Views...>
+    : std::integral_constant<camp::idx_t,
+                             sizeof(typename camp::decay<View>::value_type) +
+                                 view_footprint<Views...>::value> {
+};
+
 
 
 namespace internal
@@ -211,6 +287,24 @@ struct IterableTiler {
   camp::idx_t dist;
 };
 
+/*!
+ * Tile size of a tile_fixed or tile_auto tiling policy
+ */
+template <typename TilePolicy>
+struct TileChunkSize {
+  static constexpr camp::idx_t get() { return TilePolicy::chunk_size; }
+};
+
+template <camp::idx_t CacheLevel,
+          camp::idx_t FootprintBytes,
+          camp::idx_t NumDims>
+struct TileChunkSize<tile_auto<CacheLevel, FootprintBytes, NumDims>> {
+  static camp::idx_t get()
+  {
+    return tile_auto<CacheLevel, FootprintBytes, NumDims>::get_chunk_size();
+  }
+};
+
 /*!
  * A generic RAJA::kernel forall_impl executor for statement::Tile
  *
@@ -284,6 +378,43 @@ struct StatementExecutor<
   }
 };
 
+template <camp::idx_t ArgumentId,
+          camp::idx_t CacheLevel,
+          camp::idx_t FootprintBytes,
+          camp::idx_t NumDims,
+          typename EPol,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Tile<ArgumentId, tile_auto<CacheLevel, FootprintBytes, NumDims>,
+                    EPol, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Get the segment we are going to tile
+    auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
+
+    // Get the tile size for this machine's cache
+    auto chunk_size =
+        TileChunkSize<tile_auto<CacheLevel, FootprintBytes, NumDims>>::get();
+
+    // Create a tile iterator
+    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+
+    // Wrap in case forall_impl needs to thread_privatize
+    TileWrapper<ArgumentId, Data, Types,
+                EnclosedStmts...> tile_wrapper(data);
+
+    // Loop over tiles, executing enclosed statement list
+    auto r = resources::get_resource<EPol>::type::get_default();
+    forall_impl(r, EPol{}, tiled_iterable, tile_wrapper, RAJA::expt::get_empty_forall_param_pack());
+
+    // Set range back to original values
+    camp::get<ArgumentId>(data.segment_tuple) = tiled_iterable.it;
+  }
+};
+
 }  // end namespace internal
 }  // end namespace RAJA
 
@@ -27,6 +27,7 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -112,7 +113,7 @@ struct StatementExecutor<
     auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
 
     // Get the tiling policies chunk size
-    auto chunk_size = TPol::chunk_size;
+    auto chunk_size = TileChunkSize<TPol>::get();
 
     // Create a tile iterator, needs to survive until the forall is
     // done executing.
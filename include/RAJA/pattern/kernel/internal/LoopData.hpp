@@ -67,37 +67,54 @@ struct iterable_difftype_getter {
       typename Iterator::iterator>::difference_type;
 };
 
+template <typename Iterator>
+struct iterable_value_type_getter {
+  using type =
+      typename std::iterator_traits<typename Iterator::iterator>::value_type;
+};
+
+/*
+ * The types LoopData derives from its segments, computed once per list of
+ * segment types with a pack expansion rather than with camp::transform and
+ * camp::apply_l for each of them.
+ */
+template <typename Segments>
+struct segment_types_info;
+
+template <typename... Segments>
+struct segment_types_info<camp::list<Segments...>> {
+  using difftype_list =
+      camp::list<typename iterable_difftype_getter<Segments>::type...>;
+  using difftype_tuple =
+      camp::tuple<typename iterable_difftype_getter<Segments>::type...>;
+  using value_type_list =
+      camp::list<typename iterable_value_type_getter<Segments>::type...>;
+  using index_tuple =
+      camp::tuple<typename iterable_value_type_getter<Segments>::type...>;
+};
+
 template <typename Segments>
 using difftype_list_from_segments =
-    typename camp::transform<iterable_difftype_getter, Segments>::type;
+    typename segment_types_info<Segments>::difftype_list;
 
 
 template <typename Segments>
 using difftype_tuple_from_segments =
-    typename camp::apply_l<camp::lambda<camp::tuple>,
-                           difftype_list_from_segments<Segments>>::type;
+    typename segment_types_info<Segments>::difftype_tuple;
 
 
-template <typename Iterator>
-struct iterable_value_type_getter {
-  using type =
-      typename std::iterator_traits<typename Iterator::iterator>::value_type;
-};
-
 template <typename Segments>
 using value_type_list_from_segments =
-    typename camp::transform<iterable_value_type_getter, Segments>::type;
+    typename segment_types_info<Segments>::value_type_list;
 
 
 template <typename Segments>
 using index_tuple_from_segments =
-    typename camp::apply_l<camp::lambda<camp::tuple>,
-                           value_type_list_from_segments<Segments>>::type;
+    typename segment_types_info<Segments>::index_tuple;
 
 template <typename Segments>
 using index_types_from_segments =
-    typename camp::apply_l<camp::lambda<camp::list>,
-                           value_type_list_from_segments<Segments>>::type;
+    typename segment_types_info<Segments>::value_type_list;
 
 
 
@@ -61,21 +61,27 @@ using makeInitialLoopTypes =
 template<typename Types, camp::idx_t Segment, typename T, typename Seq>
 struct SetSegmentTypeHelper;
 
-template<typename Types,
+// Expands the segment types and their indices together, rather than looking
+// up each segment type with camp::at_v, which is one instantiation per
+// segment and nesting level.
+template<typename ... SegmentTypes,
+         typename ... OffsetTypes,
          camp::idx_t Segment,
          typename T,
          camp::idx_t ... SEQ>
-struct SetSegmentTypeHelper<Types, Segment, T, camp::idx_seq<SEQ...>>
+struct SetSegmentTypeHelper<LoopTypes<camp::list<SegmentTypes...>,
+                                      camp::list<OffsetTypes...>>,
+                            Segment, T, camp::idx_seq<SEQ...>>
 {
-    using segment_list = typename Types::segment_types_t;
-    using offset_list = typename Types::offset_types_t;
+    using segment_list = camp::list<SegmentTypes...>;
 
     static_assert(std::is_same<camp::at_v<segment_list, Segment>, void>::value,
         "Segment was already assigned: Probably looping over same segment in loop nest");
 
-    using type = LoopTypes<
-        camp::list<typename std::conditional<SEQ == Segment, T, camp::at_v<segment_list, SEQ>>::type...>,
-        camp::list<typename std::conditional<SEQ == Segment, T, camp::at_v<segment_list, SEQ>>::type...>>;
+    using new_segment_list =
+        camp::list<typename std::conditional<SEQ == Segment, T, SegmentTypes>::type...>;
+
+    using type = LoopTypes<new_segment_list, new_segment_list>;
 
 };
 
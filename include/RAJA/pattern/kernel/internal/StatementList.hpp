@@ -41,42 +41,25 @@ template <typename... Stmts>
 using StatementList = camp::list<Stmts...>;
 
 
-template <camp::idx_t idx, camp::idx_t N, typename StmtList, typename Types>
+template <typename StmtList, typename Types>
 struct StatementListExecutor;
 
 
-template <camp::idx_t statement_index,
-          camp::idx_t num_statements,
-          typename StmtList, typename Types>
-struct StatementListExecutor {
-
-  template <typename Data>
-  static RAJA_INLINE void exec(Data &&data)
-  {
-
-    // Get the statement we're going to execute
-    using statement = camp::at_v<StmtList, statement_index>;
-
-    // Execute this statement
-    StatementExecutor<statement, Types>::exec(std::forward<Data>(data));
-
-    // call our next statement
-    StatementListExecutor<statement_index + 1, num_statements, StmtList, Types>::exec(
-        std::forward<Data>(data));
-  }
-};
-
-
 /*
- * termination case, a NOP.
+ * Executes the statements in order with one pack expansion, rather than a
+ * recursive executor per statement, which keeps the instantiation depth of
+ * a statement list constant.
  */
-
-template <camp::idx_t num_statements, typename StmtList, typename Types>
-struct StatementListExecutor<num_statements, num_statements, StmtList, Types> {
+template <typename... Stmts, typename Types>
+struct StatementListExecutor<StatementList<Stmts...>, Types> {
 
   template <typename Data>
-  static RAJA_INLINE void exec(Data &&)
+  static RAJA_INLINE void exec(Data &&data)
   {
+    // braced initializers are evaluated in order
+    int seq[] = {0, (StatementExecutor<Stmts, Types>::exec(
+                         std::forward<Data>(data)), 0)...};
+    RAJA_UNUSED_VAR(seq);
   }
 };
 
@@ -84,8 +67,7 @@ struct StatementListExecutor<num_statements, num_statements, StmtList, Types> {
 template <typename StmtList, typename Types, typename Data>
 RAJA_INLINE void execute_statement_list(Data &&data)
 {
-  StatementListExecutor<0, camp::size<StmtList>::value, StmtList, Types>::exec(
-      std::forward<Data>(data));
+  StatementListExecutor<StmtList, Types>::exec(std::forward<Data>(data));
 }
 
 
@@ -39,6 +39,14 @@
 #include "RAJA/policy/openmp/launch.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+#include "RAJA/policy/openmp_target/launch.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb/launch.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_SYCL)
 #include "RAJA/policy/sycl/launch.hpp"
 #endif
@@ -0,0 +1,144 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing asynchronous global to shared memory
+ *          copies for RAJA::launch and RAJA::kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_async_copy_HPP
+#define RAJA_pattern_launch_async_copy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/macros.hpp"
+
+//cp.async needs sm_80
+#if defined(RAJA_CUDA_ACTIVE) && defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800) \
+    && defined(CUDART_VERSION) && (CUDART_VERSION >= 11000)
+#define RAJA_CUDA_ASYNC_COPY_DEVICE_PASS_ACTIVE
+#include <cuda_pipeline_primitives.h>
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! types that cp.async copies in one instruction
+template <typename T>
+struct async_copyable {
+  static constexpr bool value =
+      sizeof(T) == alignof(T) &&
+      (sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16);
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Start copying src, in global memory, to dst, in team shared
+ *        memory, without waiting for the value to arrive.
+ *
+ * Each thread starts the copies of the values it is responsible for,
+ * commits them as a stage with async_copy_commit and later waits for the
+ * stage with async_copy_wait followed by a team synchronization. Loads of
+ * the next tile can so overlap computation on the current one.
+ *
+ * On CUDA devices of compute capability 8.0 or newer, values of 4, 8 or 16
+ * bytes aligned to their size are copied with cp.async. Everywhere else,
+ * including the host, the copy is done immediately and commit and wait do
+ * nothing, so code written for the asynchronous copy is correct on all
+ * back-ends.
+ *
+ * Usage example, with double buffered tiles:
+ *
+ * \verbatim
+ *
+ *   RAJA::loop<thread_policy>(ctx, tile_range, [&](int i) {
+ *     RAJA::expt::async_copy(ctx, tile[next][i], A[next_offset + i]);
+ *   });
+ *   RAJA::expt::async_copy_commit(ctx);
+ *
+ *   // compute on tile[cur]
+ *
+ *   RAJA::expt::async_copy_wait(ctx);
+ *   ctx.teamSync();
+ *
+ * \endverbatim
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy(T& dst, const T& src)
+{
+#if defined(RAJA_CUDA_ASYNC_COPY_DEVICE_PASS_ACTIVE)
+  if (detail::async_copyable<T>::value && __isShared(&dst)) {
+    __pipeline_memcpy_async(&dst, &src, sizeof(T));
+    return;
+  }
+#endif
+  dst = src;
+}
+
+//! Commit the copies started by this thread since the last commit as a stage
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_commit()
+{
+#if defined(RAJA_CUDA_ASYNC_COPY_DEVICE_PASS_ACTIVE)
+  __pipeline_commit();
+#endif
+}
+
+/*!
+ * \brief Wait until at most Pending stages committed by this thread are
+ *        still in flight.
+ *
+ * Only the copies of the calling thread are waited for, synchronize the team
+ * before reading values copied by other threads.
+ */
+template <size_t Pending = 0>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_wait()
+{
+#if defined(RAJA_CUDA_ASYNC_COPY_DEVICE_PASS_ACTIVE)
+  __pipeline_wait_prior(Pending);
+#endif
+}
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy(LaunchContext&,
+                                             T& dst,
+                                             const T& src)
+{
+  async_copy(dst, src);
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_commit(LaunchContext&)
+{
+  async_copy_commit();
+}
+
+template <size_t Pending = 0>
+RAJA_HOST_DEVICE RAJA_INLINE void async_copy_wait(LaunchContext&)
+{
+  async_copy_wait<Pending>();
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,133 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing ChildForall, which lets the body of
+ *          a RAJA::launch kernel start child loops whose length is only
+ *          known on the device
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_child_forall_HPP
+#define RAJA_pattern_launch_child_forall_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! a child loop queued by a parent kernel
+template <typename Arg>
+struct ChildItem {
+  Arg arg;
+  Index_type len;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Child loops started from the body of a RAJA::launch kernel.
+ *
+ * A parent kernel calls forall(arg, len) to run body(arg, i) for i in
+ * [0, len), where len is only known on the device, e.g. the number of
+ * cells a zone refines into. The child loops of a launch have run once the
+ * work that run(res) enqueues on res after the launch is done.
+ *
+ * ChildPolicy is the forall policy of the child loops:
+ *  - With cuda_exec policies and RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM each
+ *    child is a kernel the parent starts with a tail launch (CDP2), which
+ *    runs once the parent grid is done, and run does nothing.
+ *  - Otherwise with cuda_exec and hip_exec policies the children are queued
+ *    in device memory, and run enqueues a persistent kernel whose blocks
+ *    take the queued children in turn. The queue holds capacity children;
+ *    pushing more is an error.
+ *  - With host policies the child loop runs where forall is called.
+ *
+ * The handle is copied into the launch body, only the copy made on the
+ * host owns the queue.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   auto refine = [=] RAJA_HOST_DEVICE (int zone, RAJA::Index_type i) {
+ *     refine_cell(zone, i);
+ *   };
+ *
+ *   RAJA::expt::ChildForall<RAJA::hip_exec<256>, int, decltype(refine)>
+ *       children(refine, num_zones);
+ *
+ *   RAJA::launch<launch_policy>(res,
+ *     RAJA::LaunchParams(RAJA::Teams(NT), RAJA::Threads(NTh)),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+ *       RAJA::loop<global_policy>(ctx, zones, [&](int zone) {
+ *         if (needs_refine(zone)) {
+ *           children.forall(zone, num_new_cells(zone));
+ *         }
+ *       });
+ *   });
+ *
+ *   children.run(res);
+ *
+ * \endverbatim
+ */
+template <typename ChildPolicy, typename Arg, typename Body>
+class ChildForall
+{
+public:
+  using arg_type = Arg;
+  using body_type = Body;
+
+  explicit ChildForall(Body const& body, size_t capacity = 0)
+      : m_body(body)
+  {
+    RAJA_UNUSED_VAR(capacity);
+  }
+
+  //! run body(arg, i) for i in [0, len)
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  void forall(Arg const& arg, Index_type len) const
+  {
+    for (Index_type i = 0; i < len; ++i) {
+      m_body(arg, i);
+    }
+  }
+
+  //! enqueue the child loops on res, host children have already run
+  template <typename Res>
+  resources::EventProxy<Res> run(Res res)
+  {
+    return resources::EventProxy<Res>(res);
+  }
+
+private:
+  Body m_body;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,382 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing portable warp and team collectives
+ *          for RAJA::launch
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_collectives_HPP
+#define RAJA_pattern_launch_collectives_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/sort.hpp"
+
+#if defined(RAJA_CUDA_ACTIVE)
+#include "RAJA/policy/cuda/reduce.hpp"
+#elif defined(RAJA_HIP_ACTIVE)
+#include "RAJA/policy/hip/reduce.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_CUDA)
+constexpr int collective_warp_size = policy::cuda::WARP_SIZE;
+constexpr int collective_max_warps = policy::cuda::MAX_WARPS;
+#elif defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_HIP)
+constexpr int collective_warp_size = policy::hip::WARP_SIZE;
+constexpr int collective_max_warps = policy::hip::MAX_WARPS;
+#else
+//host threads and sycl work items are warps of one
+constexpr int collective_warp_size = 1;
+constexpr int collective_max_warps = 1;
+#endif
+
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
+#if defined(RAJA_ENABLE_CUDA)
+namespace shfl = RAJA::cuda::impl;
+#else
+namespace shfl = RAJA::hip::impl;
+#endif
+
+RAJA_DEVICE RAJA_INLINE int team_thread_id()
+{
+  return threadIdx.x + blockDim.x * threadIdx.y +
+         (blockDim.x * blockDim.y) * threadIdx.z;
+}
+
+RAJA_DEVICE RAJA_INLINE int team_num_threads()
+{
+  return blockDim.x * blockDim.y * blockDim.z;
+}
+#endif
+
+template <typename T>
+struct dependent_false : std::false_type {
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Number of threads in a warp, 32 on CUDA and NVIDIA HIP devices, 64
+ *        on AMD devices and 1 on the host.
+ */
+RAJA_HOST_DEVICE constexpr int warp_size(LaunchContext const&)
+{
+  return detail::collective_warp_size;
+}
+
+/*!
+ * \brief Combine v over the lanes of the warp with op, every lane gets the
+ *        result.
+ *
+ * All lanes of the warp must call it, so the number of threads of the team
+ * should be a multiple of the warp size. op is a binary functor such as
+ * RAJA::operators::plus<T>.
+ */
+template <typename T, typename Op>
+RAJA_HOST_DEVICE RAJA_INLINE T warp_reduce(LaunchContext const&, Op op, T v)
+{
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
+  for (int i = 1; i < detail::collective_warp_size; i *= 2) {
+    v = op(v, detail::shfl::shfl_xor_sync(v, i));
+  }
+#else
+  RAJA_UNUSED_VAR(op);
+#endif
+  return v;
+}
+
+/*!
+ * \brief Inclusive scan of v over the lanes of the warp with op.
+ */
+template <typename T, typename Op>
+RAJA_HOST_DEVICE RAJA_INLINE T warp_scan(LaunchContext const&, Op op, T v)
+{
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
+  const int lane = detail::team_thread_id() % detail::collective_warp_size;
+  for (int i = 1; i < detail::collective_warp_size; i *= 2) {
+    const int src = lane >= i ? lane - i : lane;
+    T rhs = detail::shfl::shfl_sync(v, src);
+    if (lane >= i) {
+      v = op(rhs, v);
+    }
+  }
+#else
+  RAJA_UNUSED_VAR(op);
+#endif
+  return v;
+}
+
+/*!
+ * \brief Bit mask with bit l set if pred is true in lane l of the warp.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE unsigned long long warp_ballot(LaunchContext const&,
+                                                          bool pred)
+{
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_CUDA)
+  return __ballot_sync(0xffffffffu, pred);
+#elif defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_HIP)
+  return __ballot(pred);
+#else
+  return pred ? 1ull : 0ull;
+#endif
+}
+
+/*!
+ * \brief Combine body(i) over the iterates i of segment with op, every thread
+ *        of the team gets the result.
+ *
+ * The iterates are distributed over the threads of the team with
+ * THREAD_POLICY, and all threads of the team must call it. On the device the
+ * partial results of the threads are combined with warp shuffles and team
+ * shared memory; on the host, where the threads of a team run one after the
+ * other, the iterates are combined in order. Not supported with SYCL.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   double norm2 = RAJA::expt::team_reduce<thread_policy>(
+ *       ctx, RAJA::RangeSegment(0, N), RAJA::operators::plus<double>{}, 0.0,
+ *       [&](int i) { return x[i] * x[i]; });
+ *
+ * \endverbatim
+ */
+template <typename THREAD_POLICY, typename SEGMENT, typename T, typename Op, typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE T team_reduce(LaunchContext& ctx,
+                                           SEGMENT const& segment,
+                                           Op op,
+                                           T identity,
+                                           BODY const& body)
+{
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_SYCL)
+  static_assert(detail::dependent_false<T>::value,
+                "team_reduce is not supported with SYCL");
+  return identity;
+#else
+  T val = identity;
+  RAJA::loop<THREAD_POLICY>(ctx, segment, [&](auto i) {
+    val = op(val, body(i));
+  });
+
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  RAJA_TEAM_SHARED alignas(T) char raw[detail::collective_max_warps * sizeof(T)];
+  T* partial = reinterpret_cast<T*>(raw);
+
+  const int tid = detail::team_thread_id();
+  const int nthreads = detail::team_num_threads();
+  const int lane = tid % detail::collective_warp_size;
+  const int warp = tid / detail::collective_warp_size;
+  const int nwarps = (nthreads + detail::collective_warp_size - 1) /
+                     detail::collective_warp_size;
+
+  //lanes past the end of a partial warp contribute the identity
+  for (int i = 1; i < detail::collective_warp_size; i *= 2) {
+    const int src = tid ^ i;
+    T rhs = detail::shfl::shfl_sync(val, src % detail::collective_warp_size);
+    if (src < nthreads) {
+      val = op(val, rhs);
+    }
+  }
+
+  //make sure an earlier call is done reading partial
+  ctx.teamSync();
+  if (lane == 0) {
+    partial[warp] = val;
+  }
+  ctx.teamSync();
+
+  T result = identity;
+  for (int w = 0; w < nwarps; ++w) {
+    result = op(result, partial[w]);
+  }
+  return result;
+#else
+  return val;
+#endif
+#endif
+}
+
+/*!
+ * \brief Inclusive scan with op of data[i] for the iterates i of segment,
+ *        in place.
+ *
+ * The iterates are distributed over the threads of the team with
+ * THREAD_POLICY and all threads of the team must call it, after a team
+ * synchronization if data was just written. scratch must hold as many values
+ * as data; both are usually team shared memory. The device
+ * scan takes log2(n) steps each separated by team synchronizations, the host
+ * scan runs in order.
+ */
+template <typename THREAD_POLICY, typename SEGMENT, typename T, typename Op>
+RAJA_HOST_DEVICE RAJA_INLINE void team_scan(LaunchContext& ctx,
+                                            SEGMENT const& segment,
+                                            Op op,
+                                            T* data,
+                                            T* scratch)
+{
+  auto begin = *segment.begin();
+  auto len = segment.end() - segment.begin();
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  T* src = data;
+  T* dst = scratch;
+  for (decltype(len) offset = 1; offset < len; offset *= 2) {
+    RAJA::loop<THREAD_POLICY>(ctx, segment, [&](auto i) {
+      auto k = i - begin;
+      dst[k] = k >= offset ? op(src[k - offset], src[k]) : src[k];
+    });
+    ctx.teamSync();
+    T* tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+  if (src != data) {
+    RAJA::loop<THREAD_POLICY>(ctx, segment, [&](auto i) {
+      data[i - begin] = src[i - begin];
+    });
+    ctx.teamSync();
+  }
+#else
+  RAJA_UNUSED_VAR(ctx);
+  RAJA_UNUSED_VAR(scratch);
+  for (decltype(len) k = 1; k < len; ++k) {
+    data[k] = op(data[k - 1], data[k]);
+  }
+  RAJA_UNUSED_VAR(begin);
+#endif
+}
+
+/*!
+ * \brief Exclusive scan with op of data[i] for the iterates i of segment,
+ *        in place, the first value becomes identity.
+ *
+ * Called like team_scan, with a scratch array as long as data.
+ */
+template <typename THREAD_POLICY, typename SEGMENT, typename T, typename Op>
+RAJA_HOST_DEVICE RAJA_INLINE void team_exclusive_scan(LaunchContext& ctx,
+                                                      SEGMENT const& segment,
+                                                      Op op,
+                                                      T identity,
+                                                      T* data,
+                                                      T* scratch)
+{
+  auto begin = *segment.begin();
+  auto len = segment.end() - segment.begin();
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  team_scan<THREAD_POLICY>(ctx, segment, op, data, scratch);
+  RAJA::loop<THREAD_POLICY>(ctx, segment, [&](auto i) {
+    auto k = i - begin;
+    scratch[k] = k == 0 ? identity : data[k - 1];
+  });
+  ctx.teamSync();
+  RAJA::loop<THREAD_POLICY>(ctx, segment, [&](auto i) {
+    data[i - begin] = scratch[i - begin];
+  });
+  ctx.teamSync();
+#else
+  RAJA_UNUSED_VAR(ctx);
+  RAJA_UNUSED_VAR(scratch);
+  RAJA_UNUSED_VAR(begin);
+  T acc = identity;
+  for (decltype(len) k = 0; k < len; ++k) {
+    T next = op(acc, data[k]);
+    data[k] = acc;
+    acc = next;
+  }
+#endif
+}
+
+/*!
+ * \brief Sort keys[i] for the iterates i of segment in place so that
+ *        comp holds between neighbors.
+ *
+ * The iterates are distributed over the threads of the team with
+ * THREAD_POLICY and all threads of the team must call it, after a team
+ * synchronization if the keys were just written. On the device the keys,
+ * usually in team shared memory, are sorted with a bitonic network of
+ * log2(n) * (log2(n) + 1) / 2 steps separated by team synchronizations,
+ * which needs no scratch memory and handles any length. On the host they
+ * are sorted with RAJA::intro_sort.
+ *
+ * Usage example, sorting the particles of a cell by key:
+ *
+ * \verbatim
+ *
+ *   RAJA::expt::team_sort<thread_policy>(ctx, RAJA::RangeSegment(0, count),
+ *                                        cell_keys);
+ *
+ * \endverbatim
+ */
+template <typename THREAD_POLICY, typename SEGMENT, typename T, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE void team_sort(LaunchContext& ctx,
+                                            SEGMENT const& segment,
+                                            T* keys,
+                                            Compare comp)
+{
+  auto len = segment.end() - segment.begin();
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  using diff_type = decltype(len);
+  auto begin = *segment.begin();
+  diff_type pow2 = 1;
+  while (pow2 < len) {
+    pow2 *= 2;
+  }
+  //keys past the end act as maximal values, so every comparator sorts
+  //ascending and the first step of each merge compares mirrored pairs
+  for (diff_type k = 2; k <= pow2; k *= 2) {
+    for (diff_type d = k / 2; d >= 1; d /= 2) {
+      RAJA::loop<THREAD_POLICY>(ctx, segment, [&](auto idx) {
+        diff_type i = idx - begin;
+        diff_type j = (d == k / 2) ? (i ^ (k - 1)) : (i ^ d);
+        if (j > i && j < len && comp(keys[j], keys[i])) {
+          T tmp = keys[i];
+          keys[i] = keys[j];
+          keys[j] = tmp;
+        }
+      });
+      ctx.teamSync();
+    }
+  }
+#else
+  RAJA_UNUSED_VAR(ctx);
+  RAJA::detail::intro_sort(keys, keys + len, comp);
+#endif
+}
+
+template <typename THREAD_POLICY, typename SEGMENT, typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void team_sort(LaunchContext& ctx,
+                                            SEGMENT const& segment,
+                                            T* keys)
+{
+  team_sort<THREAD_POLICY>(ctx, segment, keys, RAJA::operators::less<T>{});
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
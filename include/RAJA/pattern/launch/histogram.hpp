@@ -0,0 +1,160 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the team privatized histogram for
+ *          RAJA::launch
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_histogram_HPP
+#define RAJA_pattern_launch_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Histogram with bins privatized to a team of a RAJA::launch kernel.
+ *
+ * The bins are allocated in the team shared memory and zeroed on
+ * construction, updates are atomics on the team bins, and flush adds the
+ * team bins to the global bins with one atomic per nonzero bin.
+ *
+ * On the device the threads of the team cooperate to zero and flush the bins
+ * using the THREAD_POLICY which must cover num_bins, so use a loop policy or
+ * a direct policy with at least num_bins threads. On the host the team is
+ * run by a single thread, which zeroes and flushes its own bins.
+ *
+ * The team shared memory must hold num_bins values of T, see
+ * shared_mem_size, and the constructor and flush must be called by all
+ * threads of the team.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::launch<launch_policy>(
+ *     RAJA::LaunchParams(RAJA::Teams(NT), RAJA::Threads(NTh),
+ *         RAJA::expt::histogram<thread_policy, int>::shared_mem_size(M)),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+ *
+ *       RAJA::loop<team_policy>(ctx, teams_range, [&](int t) {
+ *
+ *         RAJA::expt::histogram<thread_policy, int> hist(ctx, bins, M);
+ *
+ *         RAJA::loop<thread_policy>(ctx, threads_range, [&](int i) {
+ *           hist.increment(bin_of(t, i));
+ *         });
+ *
+ *         hist.flush();
+ *         ctx.releaseSharedMemory();
+ *       });
+ *   });
+ *
+ * \endverbatim
+ */
+template <typename THREAD_POLICY,
+          typename T,
+          typename IndexType = RAJA::Index_type>
+class histogram
+{
+public:
+  using value_type = T;
+  using index_type = IndexType;
+
+  //! bytes of team shared memory needed for num_bins bins
+  RAJA_HOST_DEVICE
+  static constexpr size_t shared_mem_size(IndexType num_bins)
+  {
+    return static_cast<size_t>(num_bins) * sizeof(T);
+  }
+
+  RAJA_HOST_DEVICE
+  histogram(LaunchContext& ctx, T* global_bins, IndexType num_bins)
+      : m_ctx(ctx),
+        m_global_bins(global_bins),
+        m_bins(ctx.getSharedMemory<T>(num_bins)),
+        m_num_bins(num_bins)
+  {
+    for_each_bin([=](IndexType b) { m_bins[b] = T(0); });
+    m_ctx.teamSync();
+  }
+
+  //! add value to bin
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  void add(IndexType bin, T value) const
+  {
+    RAJA::atomicAdd<RAJA::auto_atomic>(&m_bins[bin], value);
+  }
+
+  //! add one to bin
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  void increment(IndexType bin) const
+  {
+    add(bin, T(1));
+  }
+
+  //! add the team bins to the global bins
+  RAJA_HOST_DEVICE
+  void flush() const
+  {
+    m_ctx.teamSync();
+    for_each_bin([=](IndexType b) {
+      const T value = m_bins[b];
+      if (value != T(0)) {
+        RAJA::atomicAdd<RAJA::auto_atomic>(&m_global_bins[b], value);
+      }
+    });
+  }
+
+private:
+  LaunchContext& m_ctx;
+  T* m_global_bins;
+  T* m_bins;
+  IndexType m_num_bins;
+
+  template <typename BODY>
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  void for_each_bin(BODY const& body) const
+  {
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    RAJA::loop<THREAD_POLICY>(m_ctx,
+                              TypedRangeSegment<IndexType>(0, m_num_bins),
+                              body);
+#else
+    for (IndexType b = 0; b < m_num_bins; ++b) {
+      body(b);
+    }
+#endif
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,156 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing launch_batch, which runs several
+ *          RAJA::launch kernels with one kernel launch on the device
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_batch_HPP
+#define RAJA_pattern_launch_batch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//! A kernel of a launch_batch, its launch parameters and body
+template <typename BODY>
+struct LaunchBatchItem {
+  LaunchParams params;
+  BODY body;
+};
+
+//! Make a kernel of a launch_batch from its launch parameters and body
+template <typename BODY>
+LaunchBatchItem<camp::decay<BODY>> batch_item(LaunchParams const &params,
+                                              BODY &&body)
+{
+  return LaunchBatchItem<camp::decay<BODY>>{params, std::forward<BODY>(body)};
+}
+
+namespace detail
+{
+
+/*!
+ * Body of the kernel that runs a batch, team z index k of the kernel runs
+ * the body of kernel k of the batch.
+ */
+template <typename... BODIES>
+struct LaunchBatchBody {
+  camp::tuple<BODIES...> bodies;
+
+  RAJA_SUPPRESS_HD_WARN
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void call(LaunchContext ctx,
+                             unsigned int k,
+                             camp::idx_seq<Is...>) const
+  {
+    int dummy[] = {0, (k == static_cast<unsigned int>(Is)
+                           ? (camp::get<Is>(bodies)(ctx), 0)
+                           : 0)...};
+    RAJA_UNUSED_VAR(dummy);
+  }
+
+  RAJA_HOST_DEVICE void operator()(LaunchContext ctx) const
+  {
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
+    call(ctx, blockIdx.z, camp::make_idx_seq_t<sizeof...(BODIES)>{});
+#else
+    RAJA_UNUSED_VAR(ctx);
+#endif
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Run several RAJA::launch kernels, with one kernel launch on the
+ *        device.
+ *
+ *   RAJA::expt::launch_batch<launch_policy>(res,
+ *     RAJA::expt::batch_item(RAJA::LaunchParams(teams0, threads0),
+ *       [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) { ... }),
+ *     RAJA::expt::batch_item(RAJA::LaunchParams(teams1, threads1, shmem1),
+ *       [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) { ... }));
+ *
+ * With a device resource the kernels run in one launch whose team z index
+ * selects the kernel, with the largest teams in x and y, the largest
+ * threads and the largest dynamic shared memory of the batch. Each kernel
+ * must use one team in z and must not use block z loop policies. A kernel
+ * runs as if it was launched with the larger teams and threads, which RAJA
+ * loop and direct policies handle by skipping the indices past the end of
+ * their segments, so bodies should only do work inside loops. The kernels
+ * of a batch may run concurrently, so they must not depend on each other.
+ *
+ * With a host resource the kernels run one after the other.
+ */
+template <typename POLICY_LIST, typename... BODIES>
+resources::EventProxy<resources::Resource>
+launch_batch(RAJA::resources::Resource res,
+             LaunchBatchItem<BODIES> const &... items)
+{
+  static_assert(sizeof...(BODIES) > 0, "launch_batch needs a kernel");
+
+  if (res.get_platform() == RAJA::Platform::host) {
+    int dummy[] = {0, (RAJA::launch<POLICY_LIST>(res, items.params, items.body),
+                       0)...};
+    RAJA_UNUSED_VAR(dummy);
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  LaunchParams const item_params[] = {items.params...};
+  LaunchParams params(Teams(1, 1, static_cast<int>(sizeof...(BODIES))),
+                      Threads(1, 1, 1), 0);
+  for (LaunchParams const &p : item_params) {
+    if (p.teams.value[2] != 1) {
+      RAJA_ABORT_OR_THROW("launch_batch kernels must use one team in z");
+    }
+    for (int d = 0; d < 2; ++d) {
+      if (p.teams.value[d] > params.teams.value[d]) {
+        params.teams.value[d] = p.teams.value[d];
+      }
+    }
+    for (int d = 0; d < 3; ++d) {
+      if (p.threads.value[d] > params.threads.value[d]) {
+        params.threads.value[d] = p.threads.value[d];
+      }
+    }
+    if (p.shared_mem_size > params.shared_mem_size) {
+      params.shared_mem_size = p.shared_mem_size;
+    }
+  }
+
+  detail::LaunchBatchBody<BODIES...> body{camp::make_tuple(items.body...)};
+  return RAJA::launch<POLICY_LIST>(res, params, "RAJA::expt::launch_batch",
+                                   body);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
@@ -20,9 +20,13 @@
 
 #include "RAJA/config.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/internal/unroll.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/plugins.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/util/types.hpp"
 #include "camp/camp.hpp"
 #include "camp/concepts.hpp"
@@ -31,6 +35,22 @@
 //Odd dependecy with atomics is breaking CI builds
 //#include "RAJA/util/View.hpp"
 
+#if defined(RAJA_CUDA_ACTIVE)
+#include <cooperative_groups.h>
+#elif defined(RAJA_HIP_ACTIVE)
+#include <hip/hip_cooperative_groups.h>
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+//Thread block clusters and distributed shared memory need sm_90
+#if defined(RAJA_CUDA_ACTIVE) && defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900) \
+    && defined(CUDART_VERSION) && (CUDART_VERSION >= 12000)
+#define RAJA_CUDA_CLUSTER_DEVICE_PASS_ACTIVE
+#endif
+
 #if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
 #define RAJA_TEAM_SHARED __shared__
 #else
@@ -44,7 +64,13 @@ namespace RAJA
 //strongly type the ExecPlace (guards agaist errors)
 enum struct ExecPlace : int { HOST, DEVICE, NUM_PLACES };
 
-struct null_launch_t {
+//Launch policy of a kernel that has no variant for a place, as in
+//HostLaunchPolicy, launching it there aborts. The kernel body is never
+//compiled for a null policy.
+struct null_launch_t : make_policy_pattern_launch_platform_t<Policy::undefined,
+                                                             Pattern::region,
+                                                             Launch::undefined,
+                                                             Platform::undefined> {
 };
 
 // Support for host, and device
@@ -75,6 +101,16 @@ struct LaunchPolicy {
 #endif
 };
 
+//Launch policy for kernels that only run on the host. With the run time
+//launch APIs the kernel body is not compiled for the device, which saves
+//compile time and binary size for cold or host only kernels.
+template <typename HOST_POLICY>
+#if defined(RAJA_GPU_ACTIVE)
+using HostLaunchPolicy = LaunchPolicy<HOST_POLICY, null_launch_t>;
+#else
+using HostLaunchPolicy = LaunchPolicy<HOST_POLICY>;
+#endif
+
 
 struct Teams {
   int value[3];
@@ -117,6 +153,26 @@ struct Threads {
   constexpr Threads(int i, int j, int k) : value{i, j, k} {}
 };
 
+struct Clusters {
+  int value[3];
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters() : value{1, 1, 1} {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters(int i) : value{i, 1, 1} {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters(int i, int j) : value{i, j, 1} {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr Clusters(int i, int j, int k) : value{i, j, k} {}
+};
+
 struct Lanes {
   int value;
 
@@ -134,6 +190,8 @@ public:
   Teams teams;
   Threads threads;
   size_t shared_mem_size;
+  //Teams per thread block cluster, only used by CUDA launches
+  Clusters clusters;
 
   RAJA_INLINE
   LaunchParams() = default;
@@ -141,6 +199,9 @@ public:
   LaunchParams(Teams in_teams, Threads in_threads, size_t in_shared_mem_size = 0)
     : teams(in_teams), threads(in_threads), shared_mem_size(in_shared_mem_size) {};
 
+  LaunchParams(Teams in_teams, Threads in_threads, Clusters in_clusters, size_t in_shared_mem_size = 0)
+    : teams(in_teams), threads(in_threads), shared_mem_size(in_shared_mem_size), clusters(in_clusters) {};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -156,7 +217,7 @@ class LaunchContext
 public:
 
   //Bump style allocator used to
-  //get memory from the pool
+  //get memory from the pool, offset in bytes
   size_t shared_mem_offset;
 
   void *shared_mem_ptr;
@@ -170,13 +231,19 @@ public:
   {
   }
 
-  //TODO handle alignment
+  //Get num_elems values of T aligned to alignof(T), the
+  //shared memory size must leave room for the alignment
+  //when types of different alignment are mixed
   template<typename T>
-  RAJA_HOST_DEVICE T* getSharedMemory(size_t bytes)
+  RAJA_HOST_DEVICE T* getSharedMemory(size_t num_elems)
   {
-    T * mem_ptr = &((T*) shared_mem_ptr)[shared_mem_offset];
+    const size_t align = alignof(T);
+    shared_mem_offset = (shared_mem_offset + align - 1) / align * align;
 
-    shared_mem_offset += bytes*sizeof(T);
+    T * mem_ptr = reinterpret_cast<T*>(
+        static_cast<char*>(shared_mem_ptr) + shared_mem_offset);
+
+    shared_mem_offset += num_elems*sizeof(T);
     return mem_ptr;
   }
 
@@ -207,6 +274,70 @@ public:
 
 #if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
     __syncthreads();
+#endif
+  }
+
+  //Rank of this team in its thread block cluster, teams are clusters
+  //of one where clusters are not supported
+  RAJA_HOST_DEVICE
+  int clusterRank() const
+  {
+#if defined(RAJA_CUDA_CLUSTER_DEVICE_PASS_ACTIVE)
+    return static_cast<int>(cooperative_groups::this_cluster().block_rank());
+#else
+    return 0;
+#endif
+  }
+
+  //Number of teams in the thread block cluster of this team
+  RAJA_HOST_DEVICE
+  int clusterSize() const
+  {
+#if defined(RAJA_CUDA_CLUSTER_DEVICE_PASS_ACTIVE)
+    return static_cast<int>(cooperative_groups::this_cluster().num_blocks());
+#else
+    return 1;
+#endif
+  }
+
+  //Synchronize all threads of the teams in the cluster, also makes
+  //shared memory writes visible to the other teams of the cluster
+  RAJA_HOST_DEVICE
+  void clusterSync()
+  {
+#if defined(RAJA_CUDA_CLUSTER_DEVICE_PASS_ACTIVE)
+    cooperative_groups::this_cluster().sync();
+#else
+    teamSync();
+#endif
+  }
+
+  //Address of ptr, which points into team shared memory, in the shared
+  //memory of the team with the given rank in the cluster
+  template<typename T>
+  RAJA_HOST_DEVICE T* getClusterSharedMemory(T* ptr, int rank)
+  {
+#if defined(RAJA_CUDA_CLUSTER_DEVICE_PASS_ACTIVE)
+    return cooperative_groups::this_cluster().map_shared_rank(ptr, rank);
+#else
+    RAJA_UNUSED_VAR(rank);
+    return ptr;
+#endif
+  }
+
+  //Synchronize all threads of all teams, only valid in kernels
+  //launched with cuda_launch_cooperative_t or hip_launch_cooperative_t.
+  //Host teams run one after the other in a team loop, so call it
+  //outside of team loops; in an omp_launch_t region it is a barrier
+  RAJA_HOST_DEVICE
+  void grid_sync()
+  {
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && !defined(RAJA_ENABLE_SYCL)
+    cooperative_groups::this_grid().sync();
+#elif !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_OPENMP)
+    if (omp_in_parallel()) {
+#pragma omp barrier
+    }
 #endif
   }
 };
@@ -278,6 +409,44 @@ void launch(ExecPlace place, const LaunchParams &params, const char *kernel_name
 
 }
 
+/*!
+ * Run time based policy launch on a device picked at run time, the kernel
+ * runs on one of the streams of device from
+ * RAJA::resources::device_select, with device current while it is
+ * launched. device is ignored when place is ExecPlace::HOST.
+ *
+ *   RAJA::launch<launch_policy>(RAJA::ExecPlace::DEVICE, rank % num_dev,
+ *     RAJA::LaunchParams(teams, threads),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) { ... });
+ */
+template <typename POLICY_LIST, typename BODY>
+void launch(ExecPlace place, int device, LaunchParams const &params, BODY const &body)
+{
+  launch<POLICY_LIST>(place, device, params, nullptr, body);
+}
+
+template <typename POLICY_LIST, typename BODY>
+void launch(ExecPlace place, int device, const LaunchParams &params, const char *kernel_name, BODY const &body)
+{
+  switch (place) {
+    case ExecPlace::HOST: {
+      using Res = typename resources::get_resource<typename POLICY_LIST::host_policy_t>::type;
+      launch<LaunchPolicy<typename POLICY_LIST::host_policy_t>>(Res::get_default(), params, kernel_name, body);
+      break;
+    }
+#if defined(RAJA_GPU_ACTIVE)
+  case ExecPlace::DEVICE: {
+      using Res = typename resources::get_resource<typename POLICY_LIST::device_policy_t>::type;
+      launch<LaunchPolicy<typename POLICY_LIST::device_policy_t>>(
+          resources::device_select<Res>::resource(device), params, kernel_name, body);
+      break;
+    }
+#endif
+    default:
+      RAJA_ABORT_OR_THROW("Unknown launch place or device is not enabled");
+  }
+}
+
 // Helper function to retrieve a resource based on the run-time policy - if a device is active
 #if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
 template<typename T, typename U>
@@ -315,6 +484,9 @@ launch(RAJA::resources::Resource res, LaunchParams const &params, const char *ke
     place = RAJA::ExecPlace::DEVICE;
   }
 
+  // make the device of a resource from device_select current
+  resources::DeviceScope device_scope(res);
+
   //
   //Configure plugins
   //
@@ -361,6 +533,120 @@ launch(RAJA::resources::Resource res, LaunchParams const &params, const char *ke
   return resources::EventProxy<resources::Resource>(res);
 }
 
+/*!
+ * Launch with RAJA::expt::Reduce and other forall params between the
+ * LaunchParams and the body, the body takes a reference to the value of each
+ * reducer after the LaunchContext:
+ *
+ *   RAJA::launch<launch_policy>(res, RAJA::LaunchParams(teams, threads),
+ *     RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx, double& _sum) {
+ *       RAJA::loop<loop_pol>(ctx, seg, [&](int i) { _sum += a[i]; });
+ *     });
+ *
+ * On the GPU each team combines its values in shared memory and then the
+ * teams combine once in global memory. Reducer values should only be
+ * updated inside loops, as the rest of the body runs on every thread.
+ */
+template <typename POLICY_LIST, typename Param, typename... ReduceParamsAndBody>
+concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                      std::is_base_of<expt::detail::ForallParamBase, camp::decay<Param>>>
+launch(RAJA::resources::Resource res, LaunchParams const &params, Param &&param, ReduceParamsAndBody &&... rest)
+{
+  auto f_params = expt::make_forall_param_pack(std::forward<Param>(param), std::forward<ReduceParamsAndBody>(rest)...);
+  auto&& body = expt::get_lambda(std::forward<Param>(param), std::forward<ReduceParamsAndBody>(rest)...);
+  expt::check_forall_optional_args(body, f_params);
+
+  const char *kernel_name = expt::get_kernel_name(f_params);
+
+  ExecPlace place;
+  if(res.get_platform() == RAJA::Platform::host) {
+    place = RAJA::ExecPlace::HOST;
+  }else{
+    place = RAJA::ExecPlace::DEVICE;
+  }
+
+  // make the device of a resource from device_select current
+  resources::DeviceScope device_scope(res);
+
+  //
+  //Configure plugins
+  //
+#if defined(RAJA_GPU_ACTIVE)
+  util::PluginContext context{place == ExecPlace::HOST ?
+      util::make_context<typename POLICY_LIST::host_policy_t>()
+      : util::make_context<typename POLICY_LIST::device_policy_t>()};
+#else
+  util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>()};
+#endif
+
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto p_body = trigger_updates_before(body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  switch (place) {
+    case ExecPlace::HOST: {
+      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
+      resources::EventProxy<resources::Resource> e_proxy = launch_t::exec(res, params, kernel_name, p_body, f_params);
+      util::callPostLaunchPlugins(context);
+      return e_proxy;
+    }
+#if defined(RAJA_GPU_ACTIVE)
+    case ExecPlace::DEVICE: {
+      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
+      resources::EventProxy<resources::Resource> e_proxy = launch_t::exec(res, params, kernel_name, p_body, f_params);
+      util::callPostLaunchPlugins(context);
+      return e_proxy;
+    }
+#endif
+    default: {
+      RAJA_ABORT_OR_THROW("Unknown launch place or device is not enabled");
+    }
+  }
+
+  RAJA_ABORT_OR_THROW("Unknown launch place");
+
+  //^^ RAJA will abort before getting here
+  return resources::EventProxy<resources::Resource>(res);
+}
+
+//Policy based launch with forall params
+template <typename LAUNCH_POLICY, typename Param, typename... ReduceParamsAndBody>
+concepts::enable_if<std::is_base_of<expt::detail::ForallParamBase, camp::decay<Param>>>
+launch(LaunchParams const &params, Param &&param, ReduceParamsAndBody &&... rest)
+{
+  using Res = typename resources::get_resource<typename LAUNCH_POLICY::host_policy_t>::type;
+  launch<LAUNCH_POLICY>(Res::get_default(), params, std::forward<Param>(param), std::forward<ReduceParamsAndBody>(rest)...);
+}
+
+//Run time based policy launch with forall params
+template <typename POLICY_LIST, typename Param, typename... ReduceParamsAndBody>
+concepts::enable_if<std::is_base_of<expt::detail::ForallParamBase, camp::decay<Param>>>
+launch(ExecPlace place, LaunchParams const &params, Param &&param, ReduceParamsAndBody &&... rest)
+{
+  switch (place) {
+    case ExecPlace::HOST: {
+      using Res = typename resources::get_resource<typename POLICY_LIST::host_policy_t>::type;
+      launch<LaunchPolicy<typename POLICY_LIST::host_policy_t>>(Res::get_default(), params, std::forward<Param>(param), std::forward<ReduceParamsAndBody>(rest)...);
+      break;
+    }
+#if defined(RAJA_GPU_ACTIVE)
+  case ExecPlace::DEVICE: {
+      using Res = typename resources::get_resource<typename POLICY_LIST::device_policy_t>::type;
+      launch<LaunchPolicy<typename POLICY_LIST::device_policy_t>>(Res::get_default(), params, std::forward<Param>(param), std::forward<ReduceParamsAndBody>(rest)...);
+      break;
+    }
+#endif
+    default:
+      RAJA_ABORT_OR_THROW("Unknown launch place or device is not enabled");
+  }
+}
+
 template<typename POLICY_LIST>
 #if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
 using loop_policy = typename POLICY_LIST::device_policy_t;
@@ -403,6 +689,32 @@ RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
                                                           body);
 }
 
+/*!
+ * Runs body sequentially over segment with the loop unrolled by
+ * UNROLL_FACTOR.  On the device every thread that reaches the call runs
+ * the whole loop.
+ *
+ * Blocks of UNROLL_FACTOR iterations are expanded at compile time, so a
+ * segment of length UNROLL_FACTOR is fully unrolled.  This is meant for
+ * short fixed-size loops, such as moment or group loops.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <camp::idx_t UNROLL_FACTOR,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_unroll(CONTEXT const &RAJA_UNUSED_ARG(ctx),
+                                              SEGMENT const &segment,
+                                              BODY const &body)
+{
+  using diff_t = decltype(segment.end() - segment.begin());
+
+  const diff_t len = segment.end() - segment.begin();
+  RAJA::internal::unroll_loop<UNROLL_FACTOR>(len, [&](diff_t i) {
+    body(*(segment.begin() + i));
+  });
+}
+
 namespace expt
 {
 
@@ -0,0 +1,212 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing typed, padded team shared memory
+ *          arrays for RAJA::launch
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_shared_array_HPP
+#define RAJA_pattern_launch_shared_array_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/LocalArray.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//! pad argument asking shared_array to choose the padding
+constexpr int shared_pad_auto = -1;
+
+//! View type returned by shared_array, stride one in the last dimension
+template <typename T, size_t DIM, typename IdxT = RAJA::Index_type>
+using shared_array_view =
+    RAJA::View<T, RAJA::Layout<DIM, IdxT, static_cast<ptrdiff_t>(DIM) - 1>>;
+
+namespace detail
+{
+
+/*!
+ * Smallest extent not below extent whose rows start an odd number of 4 byte
+ * banks apart, so threads reading a column of a row major array hit
+ * different banks of the 32 bank shared memory. Types smaller than a bank
+ * are padded to whole banks first.
+ */
+template <typename T, typename IdxT>
+RAJA_HOST_DEVICE constexpr IdxT bank_padded_extent(IdxT extent)
+{
+  const IdxT elems_per_bank = sizeof(T) < 4 ? IdxT(4 / sizeof(T)) : IdxT(1);
+  const IdxT banks = (extent + elems_per_bank - 1) / elems_per_bank;
+  return (banks % 2 == 0 ? banks + 1 : banks) * elems_per_bank;
+}
+
+//! innermost extent after padding, arrays of one dimension are not padded
+template <typename T, size_t DIM, typename IdxT>
+RAJA_HOST_DEVICE constexpr IdxT padded_extent(IdxT extent, int pad)
+{
+  return DIM < 2 ? extent
+         : pad == shared_pad_auto ? bank_padded_extent<T>(extent)
+                                  : extent + static_cast<IdxT>(pad);
+}
+
+template <typename T, size_t DIM, typename IdxT, camp::idx_t... I>
+RAJA_HOST_DEVICE RAJA_INLINE shared_array_view<T, DIM, IdxT> make_shared_view(
+    T* ptr, const IdxT (&dims)[DIM], IdxT inner, camp::idx_seq<I...>)
+{
+  return shared_array_view<T, DIM, IdxT>(
+      ptr, (static_cast<size_t>(I) + 1 == DIM ? inner : dims[I])...);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Bytes of team shared memory for a shared_array with the given
+ *        dimensions and pad, including room to align it.
+ *
+ * Add the sizes of all arrays of a team to get the shared memory size of
+ * RAJA::LaunchParams.
+ */
+template <typename T, size_t DIM, typename IdxT = RAJA::Index_type>
+RAJA_HOST_DEVICE constexpr size_t shared_array_size(const IdxT (&dims)[DIM],
+                                                    int pad = shared_pad_auto)
+{
+  size_t elems = static_cast<size_t>(
+      detail::padded_extent<T, DIM>(dims[DIM - 1], pad));
+  for (size_t d = 0; d + 1 < DIM; ++d) {
+    elems *= static_cast<size_t>(dims[d]);
+  }
+  return elems * sizeof(T) + alignof(T) - 1;
+}
+
+/*!
+ * \brief Allocate a row major array of T with the given dimensions from the
+ *        team shared memory and return a View of it.
+ *
+ * The memory is aligned for T. The last dimension is padded by pad
+ * elements, or with shared_pad_auto so rows start in different shared memory
+ * banks, which makes column accesses like the reads of a tiled transpose
+ * free of bank conflicts without manual padding. The View bounds of the last
+ * dimension include the padding.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::launch<launch_policy>(
+ *     RAJA::LaunchParams(RAJA::Teams(NT), RAJA::Threads(TILE, TILE),
+ *         RAJA::expt::shared_array_size<double, 2>({TILE, TILE})),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+ *
+ *       RAJA::loop<team_policy>(ctx, teams_range, [&](int t) {
+ *
+ *         auto tile = RAJA::expt::shared_array<double, 2>(ctx, {TILE, TILE});
+ *
+ *         ... tile(ty, tx) = A(row, col); ctx.teamSync(); ...
+ *
+ *         ctx.releaseSharedMemory();
+ *       });
+ *   });
+ *
+ * \endverbatim
+ */
+template <typename T, size_t DIM, typename IdxT = RAJA::Index_type>
+RAJA_HOST_DEVICE RAJA_INLINE shared_array_view<T, DIM, IdxT> shared_array(
+    LaunchContext& ctx, const IdxT (&dims)[DIM], int pad = shared_pad_auto)
+{
+  const IdxT inner = detail::padded_extent<T, DIM>(dims[DIM - 1], pad);
+  size_t elems = static_cast<size_t>(inner);
+  for (size_t d = 0; d + 1 < DIM; ++d) {
+    elems *= static_cast<size_t>(dims[d]);
+  }
+  T* ptr = ctx.getSharedMemory<T>(elems);
+  return detail::make_shared_view<T, DIM, IdxT>(
+      ptr, dims, inner, camp::make_idx_seq_t<DIM>{});
+}
+
+//! View type returned by static_view, a LocalArray of the team shared memory
+template <typename T, typename Perm, camp::idx_t... Sizes>
+using static_view_type = RAJA::LocalArray<T, Perm, RAJA::SizeList<Sizes...>>;
+
+/*!
+ * \brief Bytes of team shared memory for a static_view with extents
+ *        Sizes..., including room to align it.
+ */
+template <typename T, camp::idx_t... Sizes>
+RAJA_HOST_DEVICE constexpr size_t static_view_size()
+{
+  return static_cast<size_t>(
+             RAJA::StaticLayout<camp::make_idx_seq_t<sizeof...(Sizes)>,
+                                Sizes...>::s_size) *
+             sizeof(T) +
+         alignof(T) - 1;
+}
+
+/*!
+ * \brief Allocate an array of T with compile time extents Sizes... and
+ *        permutation Perm from the team shared memory and return a View of
+ *        it with a StaticLayout.
+ *
+ * The strides are constants of the layout type, so indexing folds to
+ * multiplies and adds of constants and the view is a single pointer, where a
+ * shared_array View also keeps its extents and strides in registers. Use it
+ * for tiles whose size is known at compile time.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::launch<launch_policy>(
+ *     RAJA::LaunchParams(RAJA::Teams(NT), RAJA::Threads(TILE, TILE),
+ *         RAJA::expt::static_view_size<double, TILE, TILE>()),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+ *
+ *       RAJA::loop<team_policy>(ctx, teams_range, [&](int t) {
+ *
+ *         auto tile =
+ *             RAJA::expt::static_view<double, RAJA::PERM_IJ, TILE, TILE>(ctx);
+ *
+ *         ... tile(ty, tx) = A(row, col); ctx.teamSync(); ...
+ *
+ *         ctx.releaseSharedMemory();
+ *       });
+ *   });
+ *
+ * \endverbatim
+ */
+template <typename T, typename Perm, camp::idx_t... Sizes>
+RAJA_HOST_DEVICE RAJA_INLINE static_view_type<T, Perm, Sizes...> static_view(
+    LaunchContext& ctx)
+{
+  using view_type = static_view_type<T, Perm, Sizes...>;
+  using layout_type = typename view_type::layout_type;
+  T* ptr = ctx.getSharedMemory<T>(static_cast<size_t>(layout_type::s_size));
+  return view_type(ptr, layout_type{});
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
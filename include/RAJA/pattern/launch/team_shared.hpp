@@ -0,0 +1,159 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing typed team shared arrays of compile
+ *          time size for RAJA::launch
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_team_shared_HPP
+#define RAJA_pattern_launch_team_shared_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/internal/foldl.hpp"
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+//! row major offset with compile time extents
+template <camp::idx_t... Dims>
+struct team_shared_offset;
+
+template <>
+struct team_shared_offset<> {
+  RAJA_HOST_DEVICE
+  static constexpr camp::idx_t get(camp::idx_t acc) { return acc; }
+};
+
+template <camp::idx_t Dim, camp::idx_t... Dims>
+struct team_shared_offset<Dim, Dims...> {
+  template <typename Idx, typename... Idxs>
+  RAJA_HOST_DEVICE static constexpr camp::idx_t get(camp::idx_t acc,
+                                                    Idx idx,
+                                                    Idxs... idxs)
+  {
+    return team_shared_offset<Dims...>::get(
+        acc * Dim + static_cast<camp::idx_t>(RAJA::stripIndexType(idx)),
+        idxs...);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Row major array of T with compile time extents Dims... for team
+ *        shared memory.
+ *
+ * Declared with RAJA_TEAM_SHARED in a team loop it is a static __shared__
+ * array on CUDA and HIP devices, so its size is known to the compiler and
+ * the occupancy calculator and its addressing uses constant strides. On the
+ * host it is an array on the stack of the thread running the team.
+ *
+ * The storage is raw bytes aligned for T so the array needs no dynamic
+ * initialization on the device; values are uninitialized until written.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::loop<team_policy>(ctx, teams_range, [&](int t) {
+ *
+ *     RAJA_TEAM_SHARED RAJA::expt::TeamShared<double, TILE, TILE> tile;
+ *
+ *     RAJA::loop<thread_policy>(ctx, threads_range, [&](int i) {
+ *       tile(ty, tx) = A(row, col);
+ *     });
+ *     ctx.teamSync();
+ *     ...
+ *   });
+ *
+ * \endverbatim
+ */
+template <typename T, camp::idx_t... Dims>
+struct TeamShared {
+  static_assert(sizeof...(Dims) > 0, "TeamShared needs at least one extent");
+
+  using value_type = T;
+
+  static constexpr camp::idx_t num_dims = sizeof...(Dims);
+
+  //! number of values of T
+  static constexpr size_t size = RAJA::product<size_t>(size_t(Dims)...);
+
+  //! bytes of shared memory used by the array
+  static constexpr size_t bytes = size * sizeof(T);
+
+#if defined(RAJA_ENABLE_CUDA)
+  static_assert(bytes <= 48 * 1024,
+                "static shared memory is limited to 48 KiB per block");
+#endif
+
+  alignas(T) char m_storage[bytes];
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  T* data() { return reinterpret_cast<T*>(m_storage); }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  const T* data() const { return reinterpret_cast<const T*>(m_storage); }
+
+  template <typename... Idxs>
+  RAJA_HOST_DEVICE RAJA_INLINE T& operator()(Idxs... idxs)
+  {
+    static_assert(sizeof...(Idxs) == sizeof...(Dims),
+                  "TeamShared needs one index per extent");
+    return data()[detail::team_shared_offset<Dims...>::get(0, idxs...)];
+  }
+
+  template <typename... Idxs>
+  RAJA_HOST_DEVICE RAJA_INLINE const T& operator()(Idxs... idxs) const
+  {
+    static_assert(sizeof...(Idxs) == sizeof...(Dims),
+                  "TeamShared needs one index per extent");
+    return data()[detail::team_shared_offset<Dims...>::get(0, idxs...)];
+  }
+
+  //! index the values of the array as if it had one dimension
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE T& operator[](Idx idx)
+  {
+    return data()[RAJA::stripIndexType(idx)];
+  }
+
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE const T& operator[](Idx idx) const
+  {
+    return data()[RAJA::stripIndexType(idx)];
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
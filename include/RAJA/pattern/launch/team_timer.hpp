@@ -0,0 +1,274 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the per team cycle timer for
+ *          RAJA::launch and its host side reporter
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_team_timer_HPP
+#define RAJA_pattern_launch_team_timer_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+
+#if !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && \
+    (defined(__x86_64__) || defined(_M_X64) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/util/macros.hpp"
+
+#if defined(__has_builtin)
+#define RAJA_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define RAJA_HAS_BUILTIN(x) 0
+#endif
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief Read the cycle counter of the calling thread.
+ *
+ * On CUDA and HIP devices this is clock64, which counts cycles of the
+ * multiprocessor the team runs on, so values of teams on different
+ * multiprocessors can not be compared, only their durations. On the host it
+ * is the time stamp counter or, where there is none, steady_clock
+ * nanoseconds. SYCL devices have no portable counter and read 0.
+ */
+RAJA_HOST_DEVICE
+RAJA_INLINE
+long long team_clock()
+{
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_SYCL)
+  return 0;
+#elif defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  return static_cast<long long>(clock64());
+#elif RAJA_HAS_BUILTIN(__builtin_readcyclecounter)
+  return static_cast<long long>(__builtin_readcyclecounter());
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+  return static_cast<long long>(__rdtsc());
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+/*!
+ * \brief Records the start and end cycle of each team of a RAJA::launch
+ *        kernel into a buffer of 2 * num_teams values.
+ *
+ * The constructor records the start and stop the end of the team, both
+ * synchronize the team and are called by all threads of the team, only the
+ * first thread of the team writes. On the host the team is run by a single
+ * thread which writes its own records. Teams that are not timed keep the
+ * values the buffer had, so initialize it, e.g. to 0, before the launch.
+ *
+ * Timing is opt-in: kernels that construct no team_timer are unchanged.
+ * Copy the buffer to the host and pass it to summarize_team_timing or
+ * print_team_heatmap to see how balanced the teams are.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::launch<launch_policy>(
+ *     RAJA::LaunchParams(RAJA::Teams(NT), RAJA::Threads(NTh)),
+ *     [=] RAJA_HOST_DEVICE (RAJA::LaunchContext ctx) {
+ *
+ *       RAJA::loop<team_policy>(ctx, teams_range, [&](int t) {
+ *
+ *         RAJA::expt::team_timer<int> timer(ctx, cycles, t);
+ *
+ *         RAJA::loop<thread_policy>(ctx, threads_range, [&](int i) {
+ *           work(t, i);
+ *         });
+ *
+ *         timer.stop();
+ *       });
+ *   });
+ *
+ *   RAJA::expt::print_team_heatmap(std::cout, host_cycles, NT);
+ *
+ * \endverbatim
+ */
+template <typename IndexType = RAJA::Index_type>
+class team_timer
+{
+public:
+  using index_type = IndexType;
+
+  //! number of values of the buffer for num_teams teams
+  RAJA_HOST_DEVICE
+  static constexpr size_t records_size(IndexType num_teams)
+  {
+    return 2 * static_cast<size_t>(num_teams);
+  }
+
+  RAJA_HOST_DEVICE
+  team_timer(LaunchContext& ctx, long long* records, IndexType team)
+      : m_ctx(ctx), m_record(records + 2 * static_cast<size_t>(team))
+  {
+    m_ctx.teamSync();
+    if (team_leader()) {
+      m_record[0] = team_clock();
+    }
+  }
+
+  //! record the end of the team
+  RAJA_HOST_DEVICE
+  void stop() const
+  {
+    m_ctx.teamSync();
+    if (team_leader()) {
+      m_record[1] = team_clock();
+    }
+  }
+
+private:
+  LaunchContext& m_ctx;
+  long long* m_record;
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  bool team_leader() const
+  {
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && defined(RAJA_ENABLE_SYCL)
+    return m_ctx.itm->get_local_id(0) == 0 &&
+           m_ctx.itm->get_local_id(1) == 0 &&
+           m_ctx.itm->get_local_id(2) == 0;
+#elif defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    return threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0;
+#else
+    return true;
+#endif
+  }
+};
+
+//! summary of the team durations recorded by team_timer
+struct team_timing {
+  long long num_teams = 0;
+  long long min_cycles = 0;
+  long long max_cycles = 0;
+  double mean_cycles = 0.0;
+  long long fastest_team = 0;
+  long long slowest_team = 0;
+
+  //! slowest team over the mean, 1 for perfectly balanced teams
+  double imbalance() const
+  {
+    return mean_cycles > 0.0 ? static_cast<double>(max_cycles) / mean_cycles
+                             : 0.0;
+  }
+};
+
+//! summarize the durations of num_teams teams in host records
+template <typename IndexType>
+team_timing summarize_team_timing(const long long* records,
+                                  IndexType num_teams)
+{
+  team_timing timing;
+  timing.num_teams = static_cast<long long>(num_teams);
+  if (num_teams <= IndexType(0)) {
+    return timing;
+  }
+  double sum = 0.0;
+  for (IndexType t = 0; t < num_teams; ++t) {
+    const long long cycles = records[2 * t + 1] - records[2 * t];
+    if (t == IndexType(0) || cycles < timing.min_cycles) {
+      timing.min_cycles = cycles;
+      timing.fastest_team = static_cast<long long>(t);
+    }
+    if (t == IndexType(0) || cycles > timing.max_cycles) {
+      timing.max_cycles = cycles;
+      timing.slowest_team = static_cast<long long>(t);
+    }
+    sum += static_cast<double>(cycles);
+  }
+  timing.mean_cycles = sum / static_cast<double>(num_teams);
+  return timing;
+}
+
+/*!
+ * \brief Print the summary and a heatmap of the team durations in host
+ *        records by team index.
+ *
+ * Each cell of the heatmap shows the slowest of a run of consecutive teams
+ * relative to the slowest team overall, from ' ' for no time to '@' for the
+ * slowest. The map has width cells per row and at most max_rows rows, teams
+ * are grouped into cells so they fit.
+ */
+template <typename IndexType>
+void print_team_heatmap(std::ostream& os,
+                        const long long* records,
+                        IndexType num_teams,
+                        int width = 64,
+                        int max_rows = 16)
+{
+  const team_timing timing = summarize_team_timing(records, num_teams);
+  os << "teams " << timing.num_teams << ", cycles min " << timing.min_cycles
+     << " (team " << timing.fastest_team << ") mean " << timing.mean_cycles
+     << " max " << timing.max_cycles << " (team " << timing.slowest_team
+     << "), max/mean " << timing.imbalance() << "\n";
+  if (timing.num_teams == 0 || width <= 0 || max_rows <= 0) {
+    return;
+  }
+
+  static const char shades[] = " .:-=+*#%@";
+  const long long num_shades = sizeof(shades) - 1;
+  const long long max_cells = static_cast<long long>(width) * max_rows;
+  const long long teams_per_cell =
+      (timing.num_teams + max_cells - 1) / max_cells;
+  const long long num_cells =
+      (timing.num_teams + teams_per_cell - 1) / teams_per_cell;
+
+  for (long long cell = 0; cell < num_cells; ++cell) {
+    if (cell % width == 0) {
+      if (cell != 0) os << "|\n";
+      os.width(10);
+      os << cell * teams_per_cell << " |";
+    }
+    const long long begin = cell * teams_per_cell;
+    const long long end =
+        std::min(begin + teams_per_cell, timing.num_teams);
+    long long cycles = 0;
+    for (long long t = begin; t < end; ++t) {
+      cycles = std::max(cycles, records[2 * t + 1] - records[2 * t]);
+    }
+    const long long shade =
+        timing.max_cycles > 0
+            ? std::min(num_shades - 1,
+                       cycles * num_shades / (timing.max_cycles + 1))
+            : 0;
+    os << shades[std::max(shade, 0ll)];
+  }
+  os << "|\n";
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#undef RAJA_HAS_BUILTIN
+
+#endif
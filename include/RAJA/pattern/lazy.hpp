@@ -0,0 +1,559 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing lazily evaluated elementwise array
+*          expressions.
+*
+*          Operands wrapped with RAJA::expt::lazy build an expression that
+*          is not evaluated until it is assigned to a lazy_target, which
+*          evaluates the whole expression in a single forall. A chain of
+*          elementwise loops then reads its inputs and writes its output
+*          once, without storing the intermediate arrays.
+*
+*          Usage example:
+*
+*          // a = b * c;  d = a + e;  f = sqrt(d);
+*          auto a = RAJA::expt::lazy(b) * RAJA::expt::lazy(c);
+*          auto d = a + RAJA::expt::lazy(e);
+*          RAJA::expt::lazy_target<RAJA::cuda_exec<256>>(
+*              RAJA::TypedRangeSegment<int>(0, N), f) = RAJA::expt::sqrt(d);
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_lazy_HPP
+#define RAJA_pattern_lazy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+template <typename FUNC, typename ARG>
+class LazyUnary;
+
+namespace lazy_detail
+{
+
+//! non-templated base of all lazy expressions, used with std::is_base_of
+class LazyExpressionConcreteBase
+{
+};
+
+template <typename T>
+using is_lazy_expression =
+    std::is_base_of<LazyExpressionConcreteBase, camp::decay<T>>;
+
+//! access element i of an operand, pointers are indexed and views called
+template <typename T, typename IdxT>
+RAJA_HOST_DEVICE RAJA_INLINE T& access(T* data, IdxT i)
+{
+  return data[i];
+}
+
+template <typename VIEW, typename IdxT>
+RAJA_HOST_DEVICE RAJA_INLINE auto access(VIEW const& view, IdxT i)
+    -> decltype(view(i))
+{
+  return view(i);
+}
+
+//! type of element i of an expression
+template <typename EXPR, typename IdxT>
+using value_t =
+    camp::decay<decltype(std::declval<EXPR const&>()(std::declval<IdxT>()))>;
+
+//! operands of a binary operation are converted to their common type
+template <typename LHS, typename RHS, typename IdxT>
+using binary_value_t =
+    typename std::common_type<value_t<LHS, IdxT>, value_t<RHS, IdxT>>::type;
+
+struct negate {
+  template <typename T>
+  RAJA_HOST_DEVICE constexpr auto operator()(T const& v) const -> decltype(-v)
+  {
+    return -v;
+  }
+};
+
+}  // namespace lazy_detail
+
+/*!
+ * \brief CRTP base of the lazy expressions, provides the operators.
+ */
+template <typename DERIVED_TYPE>
+class LazyExpression : public lazy_detail::LazyExpressionConcreteBase
+{
+public:
+  using self_type = DERIVED_TYPE;
+
+  RAJA_HOST_DEVICE constexpr self_type const& getThis() const
+  {
+    return *static_cast<self_type const*>(this);
+  }
+
+  RAJA_HOST_DEVICE constexpr LazyUnary<lazy_detail::negate, self_type>
+  operator-() const
+  {
+    return LazyUnary<lazy_detail::negate, self_type>(getThis());
+  }
+};
+
+/*!
+ * \brief Reference to the elements of a View or pointer in an expression.
+ */
+template <typename VIEW>
+class LazyTerminal : public LazyExpression<LazyTerminal<VIEW>>
+{
+public:
+  RAJA_HOST_DEVICE constexpr explicit LazyTerminal(VIEW const& view)
+      : m_view{view}
+  {
+  }
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE auto operator()(IdxT i) const
+      -> decltype(lazy_detail::access(std::declval<VIEW const&>(), i))
+  {
+    return lazy_detail::access(m_view, i);
+  }
+
+private:
+  VIEW m_view;
+};
+
+/*!
+ * \brief Scalar operand, the same value for every element.
+ */
+template <typename T>
+class LazyScalar : public LazyExpression<LazyScalar<T>>
+{
+public:
+  RAJA_HOST_DEVICE constexpr explicit LazyScalar(T value) : m_value{value} {}
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE constexpr T operator()(IdxT) const
+  {
+    return m_value;
+  }
+
+private:
+  T m_value;
+};
+
+/*!
+ * \brief Elementwise binary operation, OP is a RAJA::operators functor.
+ *
+ * The operands are converted to their common type before OP is applied,
+ * so mixed type operands promote as in ordinary C++ expressions.
+ */
+template <template <typename, typename, typename> class OP,
+          typename LHS,
+          typename RHS>
+class LazyBinary : public LazyExpression<LazyBinary<OP, LHS, RHS>>
+{
+public:
+  RAJA_HOST_DEVICE constexpr LazyBinary(LHS const& lhs, RHS const& rhs)
+      : m_lhs{lhs}, m_rhs{rhs}
+  {
+  }
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE lazy_detail::binary_value_t<LHS, RHS, IdxT>
+  operator()(IdxT i) const
+  {
+    using value_type = lazy_detail::binary_value_t<LHS, RHS, IdxT>;
+    return OP<value_type, value_type, value_type>{}(
+        static_cast<value_type>(m_lhs(i)),
+        static_cast<value_type>(m_rhs(i)));
+  }
+
+private:
+  LHS m_lhs;
+  RHS m_rhs;
+};
+
+/*!
+ * \brief Elementwise unary function, FUNC is a functor of one value.
+ */
+template <typename FUNC, typename ARG>
+class LazyUnary : public LazyExpression<LazyUnary<FUNC, ARG>>
+{
+public:
+  RAJA_HOST_DEVICE constexpr explicit LazyUnary(ARG const& arg) : m_arg{arg}
+  {
+  }
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE auto operator()(IdxT i) const
+      -> decltype(FUNC{}(std::declval<ARG const&>()(i)))
+  {
+    return FUNC{}(m_arg(i));
+  }
+
+private:
+  ARG m_arg;
+};
+
+namespace lazy_detail
+{
+
+//! wrap arithmetic operands as LazyScalar, pass expressions through
+template <typename T, typename Enable = void>
+struct normalize_operand {
+  using type = LazyScalar<T>;
+
+  RAJA_HOST_DEVICE static constexpr type apply(T const& value)
+  {
+    return type(value);
+  }
+};
+
+template <typename T>
+struct normalize_operand<T,
+                         typename std::enable_if<
+                             is_lazy_expression<T>::value>::type> {
+  using type = T;
+
+  RAJA_HOST_DEVICE static constexpr T const& apply(T const& expr)
+  {
+    return expr;
+  }
+};
+
+template <typename T>
+using normalize_operand_t = typename normalize_operand<camp::decay<T>>::type;
+
+template <typename T>
+RAJA_HOST_DEVICE constexpr normalize_operand_t<T> normalizeOperand(
+    T const& operand)
+{
+  return normalize_operand<camp::decay<T>>::apply(operand);
+}
+
+//! a binary operation is lazy if either operand is a lazy expression and
+//! the other one is an expression or arithmetic
+template <typename LHS, typename RHS>
+using enable_lazy_binary = typename std::enable_if<
+    (is_lazy_expression<LHS>::value || is_lazy_expression<RHS>::value) &&
+    (is_lazy_expression<LHS>::value ||
+     std::is_arithmetic<camp::decay<LHS>>::value) &&
+    (is_lazy_expression<RHS>::value ||
+     std::is_arithmetic<camp::decay<RHS>>::value)>::type;
+
+template <template <typename, typename, typename> class OP,
+          typename LHS,
+          typename RHS>
+using lazy_binary_t =
+    LazyBinary<OP, normalize_operand_t<LHS>, normalize_operand_t<RHS>>;
+
+template <template <typename, typename, typename> class OP,
+          typename LHS,
+          typename RHS>
+RAJA_HOST_DEVICE constexpr lazy_binary_t<OP, LHS, RHS> makeBinary(
+    LHS const& lhs,
+    RHS const& rhs)
+{
+  return lazy_binary_t<OP, LHS, RHS>(normalizeOperand(lhs),
+                                     normalizeOperand(rhs));
+}
+
+//
+// Functors for the functions that do not exist in RAJA::operators.
+//
+
+#define RAJA_LAZY_UNARY_FUNCTOR(NAME)                                  \
+  struct NAME##_fn {                                                   \
+    template <typename T>                                              \
+    RAJA_HOST_DEVICE RAJA_INLINE auto operator()(T const& v) const     \
+        -> decltype(std::NAME(v))                                      \
+    {                                                                  \
+      using std::NAME;                                                 \
+      return NAME(v);                                                  \
+    }                                                                  \
+  };
+
+RAJA_LAZY_UNARY_FUNCTOR(sqrt)
+RAJA_LAZY_UNARY_FUNCTOR(abs)
+RAJA_LAZY_UNARY_FUNCTOR(exp)
+RAJA_LAZY_UNARY_FUNCTOR(log)
+RAJA_LAZY_UNARY_FUNCTOR(sin)
+RAJA_LAZY_UNARY_FUNCTOR(cos)
+
+#undef RAJA_LAZY_UNARY_FUNCTOR
+
+template <typename Ret, typename Arg1 = Ret, typename Arg2 = Arg1>
+struct pow_op {
+  RAJA_HOST_DEVICE RAJA_INLINE Ret operator()(Arg1 const& base,
+                                              Arg2 const& exponent) const
+  {
+    using std::pow;
+    return pow(base, exponent);
+  }
+};
+
+//! the loop body of a lazy assignment
+template <typename VIEW, typename EXPR, typename ASSIGN>
+struct LazyAssignBody {
+  VIEW view;
+  EXPR expr;
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(IdxT i) const
+  {
+    ASSIGN{}(access(view, i), expr(i));
+  }
+};
+
+struct assign {
+  template <typename T, typename U>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T&& dst, U const& val) const
+  {
+    dst = val;
+  }
+};
+
+struct plus_assign {
+  template <typename T, typename U>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T&& dst, U const& val) const
+  {
+    dst += val;
+  }
+};
+
+struct multiplies_assign {
+  template <typename T, typename U>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T&& dst, U const& val) const
+  {
+    dst *= val;
+  }
+};
+
+}  // namespace lazy_detail
+
+//
+// Binary operators on lazy expressions and arithmetic values.
+//
+
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<RAJA::operators::plus, LHS, RHS>
+    operator+(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<RAJA::operators::plus>(lhs, rhs);
+}
+
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<RAJA::operators::minus, LHS, RHS>
+    operator-(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<RAJA::operators::minus>(lhs, rhs);
+}
+
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<RAJA::operators::multiplies, LHS, RHS>
+    operator*(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<RAJA::operators::multiplies>(lhs, rhs);
+}
+
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<RAJA::operators::divides, LHS, RHS>
+    operator/(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<RAJA::operators::divides>(lhs, rhs);
+}
+
+//! elementwise minimum
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<RAJA::operators::minimum, LHS, RHS>
+    min(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<RAJA::operators::minimum>(lhs, rhs);
+}
+
+//! elementwise maximum
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<RAJA::operators::maximum, LHS, RHS>
+    max(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<RAJA::operators::maximum>(lhs, rhs);
+}
+
+//! elementwise power
+template <typename LHS,
+          typename RHS,
+          typename = lazy_detail::enable_lazy_binary<LHS, RHS>>
+RAJA_HOST_DEVICE constexpr lazy_detail::
+    lazy_binary_t<lazy_detail::pow_op, LHS, RHS>
+    pow(LHS const& lhs, RHS const& rhs)
+{
+  return lazy_detail::makeBinary<lazy_detail::pow_op>(lhs, rhs);
+}
+
+//
+// Unary functions on lazy expressions.
+//
+
+#define RAJA_LAZY_UNARY_FUNCTION(NAME)                                     \
+  template <typename ARG,                                                  \
+            typename = typename std::enable_if<                            \
+                lazy_detail::is_lazy_expression<ARG>::value>::type>        \
+  RAJA_HOST_DEVICE constexpr LazyUnary<lazy_detail::NAME##_fn, ARG> NAME( \
+      ARG const& arg)                                                      \
+  {                                                                        \
+    return LazyUnary<lazy_detail::NAME##_fn, ARG>(arg);                    \
+  }
+
+RAJA_LAZY_UNARY_FUNCTION(sqrt)
+RAJA_LAZY_UNARY_FUNCTION(abs)
+RAJA_LAZY_UNARY_FUNCTION(exp)
+RAJA_LAZY_UNARY_FUNCTION(log)
+RAJA_LAZY_UNARY_FUNCTION(sin)
+RAJA_LAZY_UNARY_FUNCTION(cos)
+
+#undef RAJA_LAZY_UNARY_FUNCTION
+
+/*!
+ * \brief Wrap a View, or a pointer, as an operand of a lazy expression.
+ *
+ * The view is copied into the expression, so it must be valid where the
+ * expression is evaluated, e.g. device memory for a GPU policy.
+ */
+template <typename VIEW>
+RAJA_HOST_DEVICE constexpr LazyTerminal<VIEW> lazy(VIEW view)
+{
+  return LazyTerminal<VIEW>(view);
+}
+
+/*!
+ * \brief Destination of a lazy expression.
+ *
+ * Assigning an expression runs one forall over the segment with the
+ * policy, which evaluates the expression at each index and stores it in
+ * the view. Only the elements of the segment are written.
+ */
+template <typename ExecPolicy, typename Res, typename Segment, typename VIEW>
+class LazyTarget
+{
+public:
+  LazyTarget(Res res, Segment const& seg, VIEW const& view)
+      : m_res{res}, m_seg{seg}, m_view{view}
+  {
+  }
+
+  template <typename EXPR>
+  concepts::enable_if_t<resources::EventProxy<Res>,
+                        lazy_detail::is_lazy_expression<EXPR>>
+  operator=(EXPR const& expr)
+  {
+    return run<lazy_detail::assign>(expr);
+  }
+
+  template <typename EXPR>
+  concepts::enable_if_t<resources::EventProxy<Res>,
+                        lazy_detail::is_lazy_expression<EXPR>>
+  operator+=(EXPR const& expr)
+  {
+    return run<lazy_detail::plus_assign>(expr);
+  }
+
+  template <typename EXPR>
+  concepts::enable_if_t<resources::EventProxy<Res>,
+                        lazy_detail::is_lazy_expression<EXPR>>
+  operator*=(EXPR const& expr)
+  {
+    return run<lazy_detail::multiplies_assign>(expr);
+  }
+
+  //! the view as an operand, to use the target in its own expression
+  constexpr LazyTerminal<VIEW> operator()() const
+  {
+    return LazyTerminal<VIEW>(m_view);
+  }
+
+private:
+  Res m_res;
+  Segment m_seg;
+  VIEW m_view;
+
+  template <typename ASSIGN, typename EXPR>
+  resources::EventProxy<Res> run(EXPR const& expr)
+  {
+    using body_type = lazy_detail::LazyAssignBody<VIEW, EXPR, ASSIGN>;
+    return RAJA::forall<ExecPolicy>(m_res, m_seg, body_type{m_view, expr});
+  }
+};
+
+/*!
+ * \brief Make the destination of a lazy expression, evaluated with
+ *        ExecPolicy over seg on resource res.
+ */
+template <typename ExecPolicy, typename Res, typename Segment, typename VIEW>
+concepts::enable_if_t<LazyTarget<ExecPolicy, Res, Segment, VIEW>,
+                      RAJA::type_traits::is_resource<Res>>
+lazy_target(Res res, Segment const& seg, VIEW view)
+{
+  return LazyTarget<ExecPolicy, Res, Segment, VIEW>(res, seg, view);
+}
+
+/*!
+ * \brief Make the destination of a lazy expression, evaluated with
+ *        ExecPolicy over seg on the default resource of the policy.
+ */
+template <typename ExecPolicy,
+          typename Segment,
+          typename VIEW,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<LazyTarget<ExecPolicy, Res, Segment, VIEW>,
+                      concepts::negate<RAJA::type_traits::is_resource<Segment>>>
+lazy_target(Segment const& seg, VIEW view)
+{
+  return LazyTarget<ExecPolicy, Res, Segment, VIEW>(Res::get_default(),
+                                                    seg,
+                                                    view);
+}
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
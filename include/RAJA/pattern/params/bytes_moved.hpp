@@ -0,0 +1,62 @@
+#ifndef RAJA_BYTES_MOVED_HPP
+#define RAJA_BYTES_MOVED_HPP
+
+#include "RAJA/pattern/params/params_base.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace detail
+{
+
+  struct BytesMoved : public ForallParamBase {
+    RAJA_HOST_DEVICE BytesMoved() {}
+    BytesMoved(long long bytes_in) : bytes(bytes_in) {}
+    long long bytes = -1;
+  };
+
+  // The estimate is only passed to plugins, so the hooks of every back-end
+  // do nothing.
+
+  // Init
+  template<typename EXEC_POL, typename... Args>
+  void init(BytesMoved&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Args>
+  RAJA_HOST_DEVICE
+  void combine(BytesMoved&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Args>
+  void resolve(BytesMoved&, Args&&...) {}
+
+  //! bytes of a forall parameter that is a BytesMoved, otherwise -1
+  template<typename T>
+  constexpr long long bytes_moved_of(T const&) { return -1; }
+
+  inline long long bytes_moved_of(BytesMoved const& bm) { return bm.bytes; }
+
+} // namespace detail
+
+/*!
+ * \brief forall parameter with the number of bytes a kernel reads and
+ *        writes, passed to plugins in PluginContext::bytes so they can
+ *        report the bandwidth the kernel achieves.
+ *
+ *     RAJA::forall<RAJA::cuda_exec<256>>(range,
+ *         RAJA::expt::KernelName("axpy"),
+ *         RAJA::expt::BytesMoved(3 * N * sizeof(double)),
+ *         [=] RAJA_DEVICE (int i) { y[i] += a * x[i]; });
+ */
+inline auto BytesMoved(long long bytes)
+{
+  return detail::BytesMoved(bytes);
+}
+
+} // namespace expt
+
+} //  namespace RAJA
+
+#endif // RAJA_BYTES_MOVED_HPP
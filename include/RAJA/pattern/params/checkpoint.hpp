@@ -0,0 +1,68 @@
+#ifndef RAJA_CHECKPOINT_PARAM_HPP
+#define RAJA_CHECKPOINT_PARAM_HPP
+
+#include "RAJA/pattern/params/params_base.hpp"
+#include "RAJA/pattern/params/prefetch.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace detail
+{
+
+  template<typename... Outputs>
+  struct Checkpoint : public ForallParamBase {
+    RAJA_HOST_DEVICE Checkpoint() {}
+    Checkpoint(Outputs const&... outputs_in) : outputs(outputs_in...) {}
+    camp::tuple<Outputs...> outputs;
+  };
+
+  // The outputs are only saved by ft_exec, see policy/FaultTolerance.hpp,
+  // so the hooks of every back-end do nothing.
+
+  // Init
+  template<typename EXEC_POL, typename... Outputs, typename... Args>
+  void init(Checkpoint<Outputs...>&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Outputs, typename... Args>
+  RAJA_HOST_DEVICE
+  void combine(Checkpoint<Outputs...>&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Outputs, typename... Args>
+  void resolve(Checkpoint<Outputs...>&, Args&&...) {}
+
+  template<typename T>
+  struct is_checkpoint : std::false_type {};
+
+  template<typename... Outputs>
+  struct is_checkpoint<Checkpoint<Outputs...>> : std::true_type {};
+
+} // namespace detail
+
+/*!
+ * \brief forall parameter with the outputs an ft_exec loop writes, saved
+ *        before each chunk of the loop runs and restored before a chunk
+ *        that faulted runs again.
+ *
+ *     RAJA::forall<RAJA::ft_exec<RAJA::omp_parallel_for_exec, 4096>>(range,
+ *         RAJA::expt::Checkpoint(y_view),
+ *         [=] (int i) { y_view(i) += a * x_view(i); });
+ *
+ * The outputs are one dimensional Views or pointers indexed by the loop
+ * index, the same as for RAJA::expt::Prefetch. With other policies the
+ * outputs are not touched.
+ */
+template<typename... Outputs>
+inline auto Checkpoint(Outputs const&... outputs)
+{
+  return detail::Checkpoint<Outputs...>(outputs...);
+}
+
+} // namespace expt
+
+} //  namespace RAJA
+
+#endif // RAJA_CHECKPOINT_PARAM_HPP
@@ -3,11 +3,20 @@
 
 #include "RAJA/policy/sequential/params/reduce.hpp"
 #include "RAJA/policy/tbb/params/reduce.hpp"
+#include "RAJA/policy/pool/params/reduce.hpp"
 #include "RAJA/policy/openmp/params/reduce.hpp"
 #include "RAJA/policy/openmp_target/params/reduce.hpp"
 #include "RAJA/policy/cuda/params/reduce.hpp"
 #include "RAJA/policy/cuda/params/kernel_name.hpp"
+#include "RAJA/policy/cuda/params/prefetch.hpp"
 #include "RAJA/policy/hip/params/reduce.hpp"
+#include "RAJA/policy/hip/params/prefetch.hpp"
+#include "RAJA/policy/sycl/params/reduce.hpp"
+#include "RAJA/pattern/params/prefetch.hpp"
+#include "RAJA/pattern/params/checkpoint.hpp"
+#include "RAJA/pattern/params/kernel_name.hpp"
+#include "RAJA/pattern/params/bytes_moved.hpp"
+#include "RAJA/pattern/params/no_plugins.hpp"
 
 #include "RAJA/util/CombiningAdapter.hpp"
 
@@ -16,6 +25,29 @@ namespace RAJA
 namespace expt
 {
 
+  namespace detail {
+    // Combine a param that is not part of a fused reducer combine
+    template<typename EXEC_POL, typename Param>
+    RAJA_HOST_DEVICE
+    camp::concepts::enable_if< is_grid_reducer<Param> >
+    combine_unless_fused(Param&) {}
+
+    template<typename EXEC_POL, typename Param>
+    RAJA_HOST_DEVICE
+    camp::concepts::enable_if< concepts::negate<is_grid_reducer<Param>> >
+    combine_unless_fused(Param& param) {
+      detail::combine<EXEC_POL>(param);
+    }
+
+    // Back-ends without a fused combine combine each reducer separately
+    template<typename EXEC_POL, typename... Reds>
+    RAJA_HOST_DEVICE
+    camp::concepts::enable_if< concepts::negate<fuses_reducer_combine<EXEC_POL>> >
+    combine_fused(Reds&... reds) {
+      CAMP_EXPAND(detail::combine<EXEC_POL>(reds));
+    }
+  } // namespace detail
+
   //
   //
   // Forall Parameter Packing type
@@ -52,13 +84,41 @@ namespace expt
     template<typename EXEC_POL, camp::idx_t... Seq>
     RAJA_HOST_DEVICE
     static constexpr void detail_combine(EXEC_POL, camp::idx_seq<Seq...>, ForallParamPack& f_params ) {
+      detail_combine(EXEC_POL(), camp::idx_seq<Seq...>(), f_params, fuse_reducers<EXEC_POL>());
+    }
+
+    // Combine each param separately
+    template<typename EXEC_POL, camp::idx_t... Seq>
+    RAJA_HOST_DEVICE
+    static constexpr void detail_combine(EXEC_POL, camp::idx_seq<Seq...>, ForallParamPack& f_params, std::false_type ) {
       CAMP_EXPAND(detail::combine<EXEC_POL>( camp::get<Seq>(f_params.param_tup) ));
     }
+
+    // Combine the reducers together and the other params separately
+    template<typename EXEC_POL, camp::idx_t... Seq>
+    RAJA_HOST_DEVICE
+    static constexpr void detail_combine(EXEC_POL, camp::idx_seq<Seq...>, ForallParamPack& f_params, std::true_type ) {
+      CAMP_EXPAND(detail::combine_unless_fused<EXEC_POL>( camp::get<Seq>(f_params.param_tup) ));
+      detail_combine_fused(EXEC_POL(), detail::grid_reducer_seq<Params...>(), f_params);
+    }
+
+    template<typename EXEC_POL, camp::idx_t... RSeq>
+    RAJA_HOST_DEVICE
+    static constexpr void detail_combine_fused(EXEC_POL, camp::idx_seq<RSeq...>, ForallParamPack& f_params ) {
+      detail::combine_fused<EXEC_POL>( camp::get<RSeq>(f_params.param_tup)... );
+    }
+
+    // Fuse the reducer combines when the back-end supports it and there is
+    // more than one reducer to combine
+    template<typename EXEC_POL>
+    using fuse_reducers = std::integral_constant<bool,
+        detail::fuses_reducer_combine<EXEC_POL>::value &&
+        (detail::num_grid_reducers<Params...>::value > 1)>;
     
     // Resolve
-    template<typename EXEC_POL, camp::idx_t... Seq>
-    static constexpr void detail_resolve(EXEC_POL, camp::idx_seq<Seq...>, ForallParamPack& f_params ) {
-      CAMP_EXPAND(detail::resolve<EXEC_POL>( camp::get<Seq>(f_params.param_tup) ));
+    template<typename EXEC_POL, camp::idx_t... Seq, typename ...Args>
+    static constexpr void detail_resolve(EXEC_POL, camp::idx_seq<Seq...>, ForallParamPack& f_params, Args&& ...args) {
+      CAMP_EXPAND(detail::resolve<EXEC_POL>( camp::get<Seq>(f_params.param_tup), std::forward<Args>(args)... ));
     }
 
     // Used to construct the argument TYPES that will be invoked with the lambda.
@@ -116,6 +176,95 @@ namespace expt
 
 
 
+  //===========================================================================
+  //
+  //
+  // Name given to a kernel with a KernelName parameter, or nullptr.
+  //
+  //
+  namespace detail {
+    template<camp::idx_t... Seq, typename... Params>
+    const char* get_kernel_name(camp::idx_seq<Seq...>, const ForallParamPack<Params...>& f_params) {
+      const char* names[] = {nullptr, kernel_name_of(camp::get<Seq>(f_params.param_tup))...};
+      const char* name = nullptr;
+      for (const char* n : names) {
+        if (n != nullptr) name = n;
+      }
+      return name;
+    }
+  } // namespace detail
+
+  template<typename... Params>
+  const char* get_kernel_name(const ForallParamPack<Params...>& f_params) {
+    return detail::get_kernel_name(typename ForallParamPack<Params...>::params_seq(), f_params);
+  }
+
+  //
+  //
+  // Bytes declared with a BytesMoved parameter, or -1.
+  //
+  //
+  namespace detail {
+    template<camp::idx_t... Seq, typename... Params>
+    long long get_bytes_moved(camp::idx_seq<Seq...>, const ForallParamPack<Params...>& f_params) {
+      long long all_bytes[] = {-1, bytes_moved_of(camp::get<Seq>(f_params.param_tup))...};
+      long long bytes = -1;
+      for (long long b : all_bytes) {
+        if (b >= 0) bytes = b;
+      }
+      return bytes;
+    }
+  } // namespace detail
+
+  template<typename... Params>
+  long long get_bytes_moved(const ForallParamPack<Params...>& f_params) {
+    return detail::get_bytes_moved(typename ForallParamPack<Params...>::params_seq(), f_params);
+  }
+
+  //
+  //
+  // Whether a forall reduces, i.e. has Reduce or ReduceLoc parameters.
+  //
+  //
+  namespace detail {
+    template<typename Op, typename T>
+    std::true_type is_reducer_param(Reducer<Op, T> const*);
+
+    std::false_type is_reducer_param(...);
+
+    template<typename T>
+    struct is_reducer : decltype(is_reducer_param(std::declval<T*>())) {};
+  } // namespace detail
+
+  template<typename FpParams>
+  struct has_reducers;
+
+  template<typename... Params>
+  struct has_reducers<ForallParamPack<Params...>>
+    : concepts::any_of<detail::is_reducer<Params>...>
+  {};
+
+  //
+  //
+  // Whether plugins are called around a forall, false when RAJA is
+  // configured with RAJA_DISABLE_PLUGINS or a NoPlugins parameter is given.
+  //
+  //
+  template<typename FpParams>
+  struct plugins_enabled;
+
+  template<typename... Params>
+  struct plugins_enabled<ForallParamPack<Params...>>
+#if defined(RAJA_DISABLE_PLUGINS)
+    : std::false_type
+#else
+    : concepts::negate<concepts::any_of<detail::is_no_plugins<Params>...>>
+#endif
+  {};
+  //===========================================================================
+
+
+
   //===========================================================================
   //
   //
@@ -341,7 +490,7 @@ namespace expt
                                                       camp::idx_seq<Sequence...>,
                                                       Ts&&... extra)
     {
-      return f(std::forward<Ts...>(extra...), ( get_lambda_args<Sequence>(params) )...);
+      return f(std::forward<Ts>(extra)..., ( get_lambda_args<Sequence>(params) )...);
     }
   } // namespace detail
 
@@ -353,7 +502,7 @@ namespace expt
         camp::forward<Params>(params),
         camp::forward<Fn>(f),
         typename camp::decay<Params>::lambda_arg_seq(),
-        camp::forward<Ts...>(extra)...);
+        camp::forward<Ts>(extra)...);
   }
   //===========================================================================
 
@@ -2,6 +2,8 @@
 #define RAJA_KERNEL_NAME_HPP
 
 #include "RAJA/pattern/params/params_base.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
 
 namespace RAJA
 {
@@ -16,6 +18,32 @@ namespace detail
     const char* name;
   };
 
+  // The CUDA back-end marks the kernel with an NVTX range, see
+  // policy/cuda/params/kernel_name.hpp; the others only pass the name to
+  // plugins.
+
+  // Init
+  template<typename EXEC_POL, typename... Args>
+  camp::concepts::enable_if< concepts::negate<type_traits::is_cuda_policy<EXEC_POL>> >
+  init(KernelName&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Args>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< concepts::negate<type_traits::is_cuda_policy<EXEC_POL>> >
+  combine(KernelName&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Args>
+  camp::concepts::enable_if< concepts::negate<type_traits::is_cuda_policy<EXEC_POL>> >
+  resolve(KernelName&, Args&&...) {}
+
+  //! name of a forall parameter that is a KernelName, otherwise nullptr
+  template<typename T>
+  constexpr const char* kernel_name_of(T const&) { return nullptr; }
+
+  inline const char* kernel_name_of(KernelName const& kn) { return kn.name; }
+
 } // namespace detail
 
 inline auto KernelName(const char * n)
@@ -0,0 +1,62 @@
+#ifndef RAJA_NO_PLUGINS_HPP
+#define RAJA_NO_PLUGINS_HPP
+
+#include "RAJA/pattern/params/params_base.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace detail
+{
+
+  struct NoPlugins : public ForallParamBase {
+    RAJA_HOST_DEVICE NoPlugins() {}
+  };
+
+  // The tag is only looked at when the forall is compiled, so the hooks of
+  // every back-end do nothing.
+
+  // Init
+  template<typename EXEC_POL, typename... Args>
+  void init(NoPlugins&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Args>
+  RAJA_HOST_DEVICE
+  void combine(NoPlugins&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Args>
+  void resolve(NoPlugins&, Args&&...) {}
+
+  template<typename T>
+  struct is_no_plugins : std::false_type {};
+
+  template<>
+  struct is_no_plugins<NoPlugins> : std::true_type {};
+
+} // namespace detail
+
+/*!
+ * \brief forall parameter that compiles plugin calls out of a loop.
+ *
+ * The loop body is passed to the back-end without the copy made for
+ * plugins, and no PluginContext is built, so registered plugins do not see
+ * the loop at all. Other loops are unaffected; to remove plugin calls from
+ * every pattern configure RAJA with RAJA_DISABLE_PLUGINS.
+ *
+ *     RAJA::forall<RAJA::seq_exec>(range,
+ *         RAJA::expt::NoPlugins(),
+ *         [=] (int i) { y[i] += a * x[i]; });
+ */
+inline auto NoPlugins()
+{
+  return detail::NoPlugins();
+}
+
+} // namespace expt
+
+} //  namespace RAJA
+
+#endif // RAJA_NO_PLUGINS_HPP
@@ -0,0 +1,164 @@
+#ifndef RAJA_PREFETCH_PARAM_HPP
+#define RAJA_PREFETCH_PARAM_HPP
+
+#include "RAJA/pattern/params/params_base.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Prefetch.hpp"
+#include "RAJA/util/NonTemporalPointer.hpp"
+#include "RAJA/util/ReadOnlyPointer.hpp"
+#include "RAJA/index/IndexValue.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace detail
+{
+
+  template<typename... Views>
+  struct Prefetch : public ForallParamBase {
+    RAJA_HOST_DEVICE Prefetch() {}
+    Prefetch(Views const&... views_in) : views(views_in...) {}
+    camp::tuple<Views...> views;
+  };
+
+  // The views are only prefetched by the GPU back-ends, see
+  // policy/cuda/params/prefetch.hpp and policy/hip/params/prefetch.hpp.
+  template<typename EXEC_POL>
+  using is_prefetch_policy = concepts::any_of< type_traits::is_cuda_policy<EXEC_POL>,
+                                               type_traits::is_hip_policy<EXEC_POL> >;
+
+  // Init
+  template<typename EXEC_POL, typename... Views, typename... Args>
+  camp::concepts::enable_if< concepts::negate<is_prefetch_policy<EXEC_POL>> >
+  init(Prefetch<Views...>&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Views, typename... Args>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< concepts::negate<is_prefetch_policy<EXEC_POL>> >
+  combine(Prefetch<Views...>&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Views, typename... Args>
+  camp::concepts::enable_if< concepts::negate<is_prefetch_policy<EXEC_POL>> >
+  resolve(Prefetch<Views...>&, Args&&...) {}
+
+  //
+  // Host software prefetch of the element a view gathers at an index, used
+  // by the *_exec_prefetch<Distance> policies.
+  //
+  template<typename T>
+  RAJA_INLINE T* raw_pointer(T* ptr) { return ptr; }
+
+  template<typename T>
+  RAJA_INLINE T const* raw_pointer(ReadOnlyPointer<T> const& ptr) { return ptr.get(); }
+
+  template<typename T>
+  RAJA_INLINE T* raw_pointer(NonTemporalPointer<T> const& ptr) { return ptr.get(); }
+
+  template<typename T, typename IdxT>
+  RAJA_INLINE T* element_address(T* ptr, IdxT idx)
+  {
+    return ptr + stripIndexType(idx);
+  }
+
+  // one dimensional Views, the layout maps the index to an offset
+  template<typename View, typename IdxT>
+  RAJA_INLINE auto element_address(View const& view, IdxT idx)
+    -> decltype(raw_pointer(view.get_data()) + stripIndexType(view.get_layout()(idx)))
+  {
+    return raw_pointer(view.get_data()) + stripIndexType(view.get_layout()(idx));
+  }
+
+  template<typename T>
+  RAJA_INLINE void prefetch_address(T const* addr)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(static_cast<void const*>(addr), 0, 3);
+#else
+    RAJA_UNUSED_VAR(addr);
+#endif
+  }
+
+  template<typename Param, typename IdxT>
+  RAJA_INLINE void prefetch_param(Param const&, IdxT) {}
+
+  template<typename... Views, camp::idx_t... Seq, typename IdxT>
+  RAJA_INLINE void prefetch_views(Prefetch<Views...> const& param,
+                                  camp::idx_seq<Seq...>,
+                                  IdxT idx)
+  {
+    CAMP_EXPAND(prefetch_address(element_address(camp::get<Seq>(param.views), idx)));
+  }
+
+  template<typename... Views, typename IdxT>
+  RAJA_INLINE void prefetch_param(Prefetch<Views...> const& param, IdxT idx)
+  {
+    prefetch_views(param, camp::make_idx_seq_t<sizeof...(Views)>{}, idx);
+  }
+
+  template<typename ParamPack, camp::idx_t... Seq, typename IdxT>
+  RAJA_INLINE void prefetch_params(ParamPack const& f_params,
+                                   camp::idx_seq<Seq...>,
+                                   IdxT idx)
+  {
+    CAMP_EXPAND(prefetch_param(camp::get<Seq>(f_params.param_tup), idx));
+  }
+
+} // namespace detail
+
+/*!
+ * \brief Prefetch the elements the Prefetch params of a forall gather at the
+ *        index Distance iterations after iteration i of a loop over
+ *        [begin, begin + len), if there is one.
+ */
+template<int Distance, typename ParamPack, typename Iterator, typename DiffT>
+RAJA_INLINE void prefetch_ahead(ParamPack const& f_params,
+                                Iterator const& begin,
+                                DiffT i,
+                                DiffT len)
+{
+  if (i + Distance < len) {
+    detail::prefetch_params(f_params,
+                            typename ParamPack::params_seq{},
+                            *(begin + (i + Distance)));
+  }
+}
+
+/*!
+ * \brief forall parameter that prefetches the managed memory of views to
+ *        the device a GPU kernel runs on, on the stream of its resource,
+ *        before the kernel is launched.
+ *
+ *     RAJA::forall<RAJA::cuda_exec<256>>(res, range,
+ *         RAJA::expt::Prefetch(a_view, b_view),
+ *         [=] RAJA_DEVICE (int i) { a_view(i) += b_view(i); });
+ *
+ * The views of the loop body can not be found from its captures, so they
+ * are listed here.  With the seq_exec_prefetch, simd_exec_prefetch and
+ * omp_parallel_for_exec_prefetch policies the host prefetches the element
+ * each one dimensional view (or pointer) is indexed at a fixed number of
+ * iterations ahead, which hides the latency of the gathers of ListSegment
+ * loops:
+ *
+ *     RAJA::forall<RAJA::seq_exec_prefetch<16>>(list_segment,
+ *         RAJA::expt::Prefetch(x_view),
+ *         [=] (int i) { y[i] += x_view(i); });
+ *
+ * The views are prefetched at the loop index, so with a ListSegment that is
+ * the value stored Distance entries after the current one.
+ * With the other back-ends the views are not touched.
+ */
+template<typename... Views>
+inline auto Prefetch(Views const&... views)
+{
+  return detail::Prefetch<Views...>(views...);
+}
+
+} // namespace expt
+
+} //  namespace RAJA
+
+#endif // RAJA_PREFETCH_PARAM_HPP
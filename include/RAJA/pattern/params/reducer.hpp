@@ -2,8 +2,15 @@
 #define NEW_REDUCE_HPP
 
 #include "RAJA/pattern/params/params_base.hpp"
+#include "RAJA/internal/foldl.hpp"
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/util/SoAArray.hpp"
 #include "RAJA/util/SoAPtr.hpp"
 
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
 #if defined(RAJA_CUDA_ACTIVE)
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #elif defined(RAJA_HIP_ACTIVE)
@@ -16,14 +23,21 @@ namespace RAJA
 namespace expt
 {
 
-template<typename T>
+/*!
+ * \brief Value and location pair for min and max loc reductions.
+ *
+ * The location may be any trivially copyable type, e.g. a
+ * camp::tuple<I, J, K> holding the indices of a 3D View element, which GPU
+ * reducers store one tuple element per array so combines stay coalesced.
+ */
+template<typename T, typename IndexType = RAJA::Index_type>
 struct ValLoc {
-  using index_type = RAJA::Index_type;
+  using index_type = IndexType;
   using value_type = T;
 
   RAJA_HOST_DEVICE ValLoc() {}
   RAJA_HOST_DEVICE ValLoc(value_type v) : val(v) {}
-  RAJA_HOST_DEVICE ValLoc(value_type v, RAJA::Index_type l) : val(v), loc(l) {}
+  RAJA_HOST_DEVICE ValLoc(value_type v, index_type l) : val(v), loc(l) {}
 
   RAJA_HOST_DEVICE void min(value_type v, index_type l) { if (v <  val) { val = v; loc = l; } }
   RAJA_HOST_DEVICE void max(value_type v, index_type l) { if (v >  val) { val = v; loc = l; } }
@@ -33,28 +47,102 @@ struct ValLoc {
   bool constexpr operator > (const ValLoc& rhs) const { return val >= rhs.val; }
   bool constexpr operator >=(const ValLoc& rhs) const { return val > rhs.val; }
 
-  value_type getVal() {return val;}
-  RAJA::Index_type getLoc() {return loc;}
+  RAJA_HOST_DEVICE value_type getVal() const {return val;}
+  RAJA_HOST_DEVICE index_type getLoc() const {return loc;}
 
 private:
   value_type val;
-  index_type loc = -1;
+  index_type loc = RAJA::reduce::detail::DefaultLoc<index_type>().value();
 };
 
 } //  namespace expt
 
+namespace detail
+{
+
+/*!
+ * @brief Specialization for RAJA::expt::ValLoc, values and locations in
+ *        separate arrays.
+ */
+template <typename T, typename IndexType, size_t size>
+class SoAArray<RAJA::expt::ValLoc<T, IndexType>, size>
+{
+  using value_type = RAJA::expt::ValLoc<T, IndexType>;
+
+public:
+  RAJA_HOST_DEVICE value_type get(size_t i) const
+  {
+    return value_type(mem.get(i), mem_idx.get(i));
+  }
+  RAJA_HOST_DEVICE void set(size_t i, value_type val)
+  {
+    mem.set(i, val.getVal());
+    mem_idx.set(i, val.getLoc());
+  }
+
+private:
+  SoAArray<T, size> mem;
+  SoAArray<IndexType, size> mem_idx;
+};
+
+/*!
+ * @brief Specialization for RAJA::expt::ValLoc, values and locations in
+ *        separate arrays.
+ */
+template <typename T, typename IndexType, typename mempool>
+class SoAPtr<RAJA::expt::ValLoc<T, IndexType>, mempool>
+{
+  using value_type = RAJA::expt::ValLoc<T, IndexType>;
+
+public:
+  SoAPtr() = default;
+  explicit SoAPtr(size_t size) : mem(size), mem_idx(size) {}
+
+  SoAPtr& allocate(size_t size)
+  {
+    mem.allocate(size);
+    mem_idx.allocate(size);
+    return *this;
+  }
+
+  SoAPtr& deallocate()
+  {
+    mem.deallocate();
+    mem_idx.deallocate();
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE bool allocated() const { return mem.allocated(); }
+
+  RAJA_HOST_DEVICE value_type get(size_t i) const
+  {
+    return value_type(mem.get(i), mem_idx.get(i));
+  }
+  RAJA_HOST_DEVICE void set(size_t i, value_type val)
+  {
+    mem.set(i, val.getVal());
+    mem_idx.set(i, val.getLoc());
+  }
+
+private:
+  SoAPtr<T, mempool> mem;
+  SoAPtr<IndexType, mempool> mem_idx;
+};
+
+}  // namespace detail
+
 namespace operators
 {
 
-template <typename T>
-struct limits<RAJA::expt::ValLoc<T>> {
-  RAJA_INLINE RAJA_HOST_DEVICE static constexpr RAJA::expt::ValLoc<T> min()
+template <typename T, typename IndexType>
+struct limits<RAJA::expt::ValLoc<T, IndexType>> {
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr RAJA::expt::ValLoc<T, IndexType> min()
   {
-    return RAJA::expt::ValLoc<T>(RAJA::operators::limits<T>::min());
+    return RAJA::expt::ValLoc<T, IndexType>(RAJA::operators::limits<T>::min());
   }
-  RAJA_INLINE RAJA_HOST_DEVICE static constexpr RAJA::expt::ValLoc<T> max()
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr RAJA::expt::ValLoc<T, IndexType> max()
   {
-    return RAJA::expt::ValLoc<T>(RAJA::operators::limits<T>::max());
+    return RAJA::expt::ValLoc<T, IndexType>(RAJA::operators::limits<T>::max());
   }
 };
 
@@ -97,6 +185,12 @@ namespace detail
     value_type * devicetarget = nullptr;
     RAJA::detail::SoAPtr<value_type, device_mem_pool_t> device_mem;
     unsigned int * device_count = nullptr;
+#elif defined(RAJA_ENABLE_SYCL)
+    // Device related attributes, USM allocations of the launch queue.
+    value_type * devicetarget = nullptr;
+    value_type * device_partials = nullptr;
+    unsigned int * device_count = nullptr;
+    void * device_queue = nullptr;
 #endif
 
     using ARG_TUP_T = camp::tuple<value_type*>;
@@ -141,6 +235,276 @@ auto constexpr ReduceLoc(T *target)
 {
   return detail::ReducerLoc<Op<T, T, T>, T>(target);
 }
+
+
+
+namespace detail
+{
+
+  //
+  //
+  // Atomic combiners used by reducers that combine into their target on
+  // the device
+  //
+  //
+  template <typename Op>
+  struct atomic_combine;
+
+  template <typename T>
+  struct atomic_combine<RAJA::operators::plus<T, T, T>> {
+    template <typename AtomicPolicy>
+    RAJA_HOST_DEVICE static void apply(AtomicPolicy, T* target, T val) {
+      RAJA::atomicAdd<AtomicPolicy>(target, val);
+    }
+  };
+
+  template <typename T>
+  struct atomic_combine<RAJA::operators::minimum<T, T, T>> {
+    template <typename AtomicPolicy>
+    RAJA_HOST_DEVICE static void apply(AtomicPolicy, T* target, T val) {
+      RAJA::atomicMin<AtomicPolicy>(target, val);
+    }
+  };
+
+  template <typename T>
+  struct atomic_combine<RAJA::operators::maximum<T, T, T>> {
+    template <typename AtomicPolicy>
+    RAJA_HOST_DEVICE static void apply(AtomicPolicy, T* target, T val) {
+      RAJA::atomicMax<AtomicPolicy>(target, val);
+    }
+  };
+
+  template <typename T>
+  struct atomic_combine<RAJA::operators::bit_or<T, T, T>> {
+    template <typename AtomicPolicy>
+    RAJA_HOST_DEVICE static void apply(AtomicPolicy, T* target, T val) {
+      RAJA::atomicOr<AtomicPolicy>(target, val);
+    }
+  };
+
+  template <typename T>
+  struct atomic_combine<RAJA::operators::bit_and<T, T, T>> {
+    template <typename AtomicPolicy>
+    RAJA_HOST_DEVICE static void apply(AtomicPolicy, T* target, T val) {
+      RAJA::atomicAnd<AtomicPolicy>(target, val);
+    }
+  };
+
+  //
+  //
+  // Deferred Reducer
+  //
+  // Combines its result into target in the execution space of the loop
+  // without synchronizing or copying the result back to the host, so the
+  // result is available once the event returned by forall completes.
+  // On the device target must be device accessible (device or managed
+  // memory) and the result is combined with atomics, so no per launch
+  // temporary memory is needed and the loop may be captured into a graph.
+  //
+  //
+  template <typename Op, typename T>
+  struct DeferredReducer : public Reducer<Op, T> {
+    using Base = Reducer<Op, T>;
+    using value_type = typename Base::value_type;
+    RAJA_HOST_DEVICE DeferredReducer() {}
+    DeferredReducer(value_type *target_in) : Base(target_in) {}
+  };
+
+  //
+  //
+  // Multi Reducer
+  //
+  // Reduces into num_bins values at once, the bins are privatized in slices
+  // of num_bins values. On the host each thread combines into its own slice,
+  // on the device each thread block combines atomically into the slice it
+  // shares with a subset of the blocks. The slices are combined into target
+  // in resolve.
+  //
+  //
+  template <typename Op, typename T>
+  struct MultiReduceBins;
+
+  template <typename Op, typename T>
+  struct MultiReduceBinRef {
+    using op = Op;
+    using value_type = T;
+
+    const MultiReduceBins<Op, T>* bins;
+    size_t bin;
+
+    RAJA_HOST_DEVICE void combine(value_type v) const { bins->combine(bin, v); }
+
+    RAJA_HOST_DEVICE const MultiReduceBinRef& operator+=(value_type v) const
+    {
+      static_assert(std::is_same<op, RAJA::operators::plus<T, T, T>>::value,
+                    "operator+= requires a plus MultiReduce");
+      combine(v);
+      return *this;
+    }
+    RAJA_HOST_DEVICE const MultiReduceBinRef& min(value_type v) const
+    {
+      static_assert(std::is_same<op, RAJA::operators::minimum<T, T, T>>::value,
+                    "min requires a minimum MultiReduce");
+      combine(v);
+      return *this;
+    }
+    RAJA_HOST_DEVICE const MultiReduceBinRef& max(value_type v) const
+    {
+      static_assert(std::is_same<op, RAJA::operators::maximum<T, T, T>>::value,
+                    "max requires a maximum MultiReduce");
+      combine(v);
+      return *this;
+    }
+    RAJA_HOST_DEVICE const MultiReduceBinRef& operator|=(value_type v) const
+    {
+      static_assert(std::is_same<op, RAJA::operators::bit_or<T, T, T>>::value,
+                    "operator|= requires a bit_or MultiReduce");
+      combine(v);
+      return *this;
+    }
+    RAJA_HOST_DEVICE const MultiReduceBinRef& operator&=(value_type v) const
+    {
+      static_assert(std::is_same<op, RAJA::operators::bit_and<T, T, T>>::value,
+                    "operator&= requires a bit_and MultiReduce");
+      combine(v);
+      return *this;
+    }
+  };
+
+  template <typename Op, typename T>
+  struct MultiReduceBins {
+    using op = Op;
+    using value_type = T;
+
+    value_type* data = nullptr;
+    size_t num_bins = 0;
+    size_t num_slices = 0;
+
+    RAJA_HOST_DEVICE size_t size() const { return num_bins; }
+
+    RAJA_HOST_DEVICE MultiReduceBinRef<Op, T> operator[](size_t bin) const
+    {
+      return MultiReduceBinRef<Op, T>{this, bin};
+    }
+
+    RAJA_HOST_DEVICE void combine(size_t bin, value_type v) const
+    {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+      const size_t block = blockIdx.x +
+          gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+      atomic_combine<op>::apply(RAJA::auto_atomic{},
+                                &data[(block % num_slices) * num_bins + bin],
+                                v);
+#else
+#if defined(RAJA_ENABLE_OPENMP)
+      const size_t slice = (num_slices > 1) ? omp_get_thread_num() : 0;
+#else
+      const size_t slice = 0;
+#endif
+      value_type& val = data[slice * num_bins + bin];
+      val = op{}(val, v);
+#endif
+    }
+  };
+
+  template <typename Op, typename T>
+  struct MultiReducer : public ForallParamBase {
+    using op = Op;
+    using value_type = T;
+    using bins_type = MultiReduceBins<Op, T>;
+
+    RAJA_HOST_DEVICE MultiReducer() {}
+    MultiReducer(value_type *target_in, size_t num_bins_in) : target(target_in)
+    {
+      bins.num_bins = num_bins_in;
+    }
+
+    value_type *target = nullptr;
+    bins_type bins;
+
+    // Fill num_slices slices of the bins in host memory with the identity.
+    void fill_slices(value_type* slices, size_t num_slices) const
+    {
+      for (size_t i = 0; i < num_slices * bins.num_bins; ++i) {
+        slices[i] = op::identity();
+      }
+    }
+
+    // Combine num_slices slices of the bins in host memory into target.
+    void resolve_slices(const value_type* slices, size_t num_slices) const
+    {
+      for (size_t s = 0; s < num_slices; ++s) {
+        for (size_t b = 0; b < bins.num_bins; ++b) {
+          target[b] = op{}(slices[s * bins.num_bins + b], target[b]);
+        }
+      }
+    }
+
+    using ARG_TUP_T = camp::tuple<bins_type*>;
+    RAJA_HOST_DEVICE ARG_TUP_T get_lambda_arg_tup() { return camp::make_tuple(&bins); }
+
+    using ARG_LIST_T = typename ARG_TUP_T::TList;
+    static constexpr size_t num_lambda_args = camp::tuple_size<ARG_TUP_T>::value ;
+  };
+
+  //
+  //
+  // Fused reducer combine
+  //
+  // Back-ends that set fuses_reducer_combine for a policy combine all of
+  // the Reducer and ReducerLoc params of a forall together, in one pass
+  // over the block, with combine_fused instead of combine.
+  //
+  //
+  template <typename EXEC_POL, typename Enable = void>
+  struct fuses_reducer_combine : std::false_type {};
+
+  template <typename Param>
+  struct is_grid_reducer : std::false_type {};
+
+  template <typename Op, typename T>
+  struct is_grid_reducer<Reducer<Op, T>> : std::true_type {};
+
+  template <typename Op, typename T>
+  struct is_grid_reducer<ReducerLoc<Op, T>> : std::true_type {};
+
+  //! positions of the grid reducers in a param pack
+  template <camp::idx_t I, typename Seq, typename... Params>
+  struct grid_reducer_seq_impl {
+    using type = Seq;
+  };
+
+  template <camp::idx_t I, camp::idx_t... Seq, typename Param, typename... Params>
+  struct grid_reducer_seq_impl<I, camp::idx_seq<Seq...>, Param, Params...>
+      : grid_reducer_seq_impl<I + 1,
+                              typename std::conditional<is_grid_reducer<Param>::value,
+                                                        camp::idx_seq<Seq..., I>,
+                                                        camp::idx_seq<Seq...>>::type,
+                              Params...> {};
+
+  template <typename... Params>
+  using grid_reducer_seq = typename grid_reducer_seq_impl<0, camp::idx_seq<>, Params...>::type;
+
+  template <typename... Params>
+  struct num_grid_reducers
+      : std::integral_constant<size_t, RAJA::sum<size_t>(size_t(0), size_t(is_grid_reducer<Params>::value)...)> {};
+
+} // namespace detail
+
+template <template <typename, typename, typename> class Op, typename T>
+auto constexpr ReduceDeferred(T *target)
+{
+  return detail::DeferredReducer<Op<T, T, T>, T>(target);
+}
+
+template <template <typename, typename, typename> class Op, typename T>
+using MultiReduceBins = detail::MultiReduceBins<Op<T, T, T>, T>;
+
+template <template <typename, typename, typename> class Op, typename T>
+auto constexpr MultiReduce(T *target, size_t num_bins)
+{
+  return detail::MultiReducer<Op<T, T, T>, T>(target, num_bins);
+}
 } // namespace expt
 
 
@@ -21,8 +21,17 @@
 #ifndef RAJA_region_HPP
 #define RAJA_region_HPP
 
+#include "RAJA/config.hpp"
+
 #include "RAJA/policy/sequential/region.hpp"
 
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/region.hpp"
+#endif
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
 namespace RAJA
 {
 
@@ -38,6 +47,45 @@ void region(OuterBody&& outer_body, InnerBody&& inner_body)
   region_impl(ExecutionPolicy(), outer_body, inner_body);
 }
 
+/*!
+ * \brief Wait for all threads of the team running the enclosing region.
+ *
+ * Lighter than an OpenMP barrier, for ordering loops of a region that use
+ * nowait policies. It must be called by every thread of the team, not from
+ * inside a loop body. Outside a region or in a sequential region there is
+ * one thread and it returns at once.
+ */
+RAJA_INLINE void region_barrier()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  if (policy::omp::internal::RegionTeam* team =
+          policy::omp::internal::region_team()) {
+    team->barrier();
+  }
+#endif
+}
+
+/*!
+ * \brief Combine val over the threads of the team running the enclosing
+ *        region, every thread gets the result.
+ *
+ * The values are combined in thread order, so all threads get the same
+ * result even for floating point values. T must be trivially copyable and
+ * fit in a cache line. Like region_barrier it must be called by every
+ * thread of the team, and returns val outside a region.
+ */
+template <typename T, typename Op = operators::plus<T>>
+RAJA_INLINE T region_reduce(T const& val, Op op = Op{})
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  if (policy::omp::internal::RegionTeam* team =
+          policy::omp::internal::region_team()) {
+    return team->reduce(val, op);
+  }
+#endif
+  return val;
+}
+
 }  // namespace RAJA
 
 
@@ -26,11 +26,49 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/resource.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
 {
 
+namespace detail
+{
+
+/*!
+ * \brief Run scan, a call of a scan back-end over n items on r, between the
+ *        plugin calls of a parallel_scan launch.
+ */
+template <typename ExecPolicy, typename Res, typename Scan>
+RAJA_INLINE resources::EventProxy<Res> scan_with_plugins(Res& r,
+                                                         long long n,
+                                                         Scan&& scan)
+{
+#if defined(RAJA_DISABLE_PLUGINS)
+  using PluginHooks = util::detail::PluginHooks<false>;
+#else
+  using PluginHooks = util::detail::PluginHooks<true>;
+#endif
+
+  util::PluginContext context{util::make_context<camp::decay<ExecPolicy>>()};
+  if (PluginHooks::enabled) {
+    context.kind = util::LaunchKind::parallel_scan;
+    context.num_iterations = n;
+    context.stream = resources::get_native_stream(r);
+  }
+
+  typename PluginHooks::active_context_type active_context{context};
+  PluginHooks::preLaunch(context);
+
+  resources::EventProxy<Res> e = scan();
+
+  PluginHooks::postLaunch(context);
+  return e;
+}
+
+}  // namespace detail
+
 inline namespace policy_by_value_interface
 {
 
@@ -71,8 +109,13 @@ inclusive_scan_inplace(ExecPolicy&& p,
   if (begin(c) == end(c)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::inclusive_inplace(r, std::forward<ExecPolicy>(p),
-                                       begin(c), end(c), binop);
+  return detail::scan_with_plugins<ExecPolicy>(
+      r,
+      static_cast<long long>(std::distance(begin(c), end(c))),
+      [&]() {
+        return impl::scan::inclusive_inplace(r, std::forward<ExecPolicy>(p),
+            begin(c), end(c), binop);
+      });
 }
 ///
 template <typename ExecPolicy,
@@ -135,8 +178,13 @@ exclusive_scan_inplace(ExecPolicy&& p,
   if (begin(c) == end(c)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::exclusive_inplace(r, std::forward<ExecPolicy>(p),
-                                       begin(c), end(c), binop, value);
+  return detail::scan_with_plugins<ExecPolicy>(
+      r,
+      static_cast<long long>(std::distance(begin(c), end(c))),
+      [&]() {
+        return impl::scan::exclusive_inplace(r, std::forward<ExecPolicy>(p),
+            begin(c), end(c), binop, value);
+      });
 }
 ///
 template <typename ExecPolicy,
@@ -210,8 +258,13 @@ inclusive_scan(ExecPolicy&& p,
   if (begin(in) == end(in)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::inclusive(r, std::forward<ExecPolicy>(p),
-                               begin(in), end(in), begin(out), binop);
+  return detail::scan_with_plugins<ExecPolicy>(
+      r,
+      static_cast<long long>(std::distance(begin(in), end(in))),
+      [&]() {
+        return impl::scan::inclusive(r, std::forward<ExecPolicy>(p),
+            begin(in), end(in), begin(out), binop);
+      });
 }
 ///
 template <typename ExecPolicy,
@@ -288,8 +341,13 @@ exclusive_scan(ExecPolicy&& p,
   if (begin(in) == end(in)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::exclusive(r, std::forward<ExecPolicy>(p),
-                               begin(in), end(in), begin(out), binop, value);
+  return detail::scan_with_plugins<ExecPolicy>(
+      r,
+      static_cast<long long>(std::distance(begin(in), end(in))),
+      [&]() {
+        return impl::scan::exclusive(r, std::forward<ExecPolicy>(p),
+            begin(in), end(in), begin(out), binop, value);
+      });
 }
 ///
 template <typename ExecPolicy,
@@ -320,6 +378,207 @@ exclusive_scan(ExecPolicy&& p,
       value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[in] offsets Random-Access Container of num_segments+1 offsets into
+*in, segment i is [offsets[i], offsets[i+1])
+* \param[in] binop binary function to apply for scan
+*
+* Each segment is scanned independently. The segments must partition in,
+* i.e. offsets[0] is 0 and offsets[num_segments] is the size of in, empty
+* segments are allowed.
+*
+* \note{The range of in must be separate from out}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename OffsetContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>,
+                      type_traits::is_range<OffsetContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         OffsetContainer&& offsets,
+                         Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+  const int num_segments =
+      static_cast<int>(distance(begin(offsets), end(offsets))) - 1;
+  if (begin(in) == end(in) || num_segments <= 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  return detail::scan_with_plugins<ExecPolicy>(
+      r,
+      static_cast<long long>(std::distance(begin(in), end(in))),
+      [&]() {
+        return impl::scan::inclusive_segmented(r, std::forward<ExecPolicy>(p),
+            begin(in), end(in), begin(out), begin(offsets), num_segments,
+            binop);
+      });
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename OffsetContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>,
+                      type_traits::is_range<OffsetContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         OffsetContainer&& offsets,
+                         Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      std::forward<OffsetContainer>(offsets),
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[in] offsets Random-Access Container of num_segments+1 offsets into
+*in, segment i is [offsets[i], offsets[i+1])
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop, that starts
+*each segment
+*
+* Each segment is scanned independently. The segments must partition in,
+* i.e. offsets[0] is 0 and offsets[num_segments] is the size of in, empty
+* segments are allowed.
+*
+* \note{The range of in must be separate from out}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename OffsetContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>,
+                      type_traits::is_range<OffsetContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         OffsetContainer&& offsets,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+  const int num_segments =
+      static_cast<int>(distance(begin(offsets), end(offsets))) - 1;
+  if (begin(in) == end(in) || num_segments <= 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  return detail::scan_with_plugins<ExecPolicy>(
+      r,
+      static_cast<long long>(std::distance(begin(in), end(in))),
+      [&]() {
+        return impl::scan::exclusive_segmented(r, std::forward<ExecPolicy>(p),
+            begin(in), end(in), begin(out), begin(offsets), num_segments,
+            binop, value);
+      });
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename OffsetContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>,
+                      type_traits::is_range<OffsetContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         OffsetContainer&& offsets,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      std::forward<OffsetContainer>(offsets),
+      binop,
+      value);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -439,6 +698,65 @@ inclusive_scan_inplace(Res r, Args&&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
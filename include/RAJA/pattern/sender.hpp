@@ -0,0 +1,204 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with std::execution (P2300) sender adapters for
+ *          RAJA patterns, built on stdexec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_sender_HPP
+#define RAJA_pattern_sender_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_STDEXEC)
+
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <stdexec/execution.hpp>
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace exec
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Sender that enqueues RAJA::forall<ExecPol> on a resource when it
+ *        is started and completes with that resource.
+ *
+ * The forall is only enqueued, so for CUDA and HIP resources the sender
+ * completes before the kernel does. Work enqueued on the resource it
+ * completes with runs after the kernel without the host waiting.
+ */
+template <typename ExecPol, typename Res, typename... Args>
+struct forall_sender {
+  using sender_concept = stdexec::sender_t;
+  using completion_signatures =
+      stdexec::completion_signatures<stdexec::set_value_t(Res),
+                                     stdexec::set_error_t(std::exception_ptr)>;
+
+  Res res;
+  std::tuple<Args...> args;
+
+  template <typename Receiver>
+  struct operation {
+    using operation_state_concept = stdexec::operation_state_t;
+
+    Res res;
+    std::tuple<Args...> args;
+    Receiver rcvr;
+
+    void start() & noexcept
+    {
+      try {
+        std::apply(
+            [this](Args&... as) { ::RAJA::forall<ExecPol>(res, as...); },
+            args);
+      } catch (...) {
+        stdexec::set_error(std::move(rcvr), std::current_exception());
+        return;
+      }
+      stdexec::set_value(std::move(rcvr), res);
+    }
+  };
+
+  template <typename Receiver>
+  operation<Receiver> connect(Receiver rcvr) &&
+  {
+    return {std::move(res), std::move(args), std::move(rcvr)};
+  }
+
+  template <typename Receiver>
+  operation<Receiver> connect(Receiver rcvr) const&
+  {
+    return {res, args, std::move(rcvr)};
+  }
+};
+
+//! pipeable adapter made by then_forall
+template <typename ExecPol, typename... Args>
+struct then_forall_closure {
+  std::tuple<Args...> args;
+
+  template <typename Sender>
+  friend auto operator|(Sender&& sndr, then_forall_closure closure)
+  {
+    return stdexec::let_value(
+        std::forward<Sender>(sndr),
+        [args = std::move(closure.args)](auto& res) {
+          using Res = camp::decay<decltype(res)>;
+          return std::apply(
+              [&res](Args const&... as) {
+                return forall_sender<ExecPol, Res, Args...>{res, {as...}};
+              },
+              args);
+        });
+  }
+};
+
+//! pipeable adapter made by synchronize
+struct synchronize_closure {
+  template <typename Sender>
+  friend auto operator|(Sender&& sndr, synchronize_closure)
+  {
+    return stdexec::then(std::forward<Sender>(sndr), [](auto res) {
+      res.wait();
+      return res;
+    });
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Sender that runs RAJA::forall<ExecPol>(res, args...) when it is
+ *        started and completes with res.
+ *
+ *     auto s = RAJA::exec::forall<RAJA::cuda_exec_async<256>>(
+ *                  res, RAJA::TypedRangeSegment<int>(0, N),
+ *                  [=] RAJA_DEVICE (int i) { y[i] += a * x[i]; })
+ *            | RAJA::exec::then_forall<RAJA::cuda_exec_async<256>>(
+ *                  RAJA::TypedRangeSegment<int>(0, N),
+ *                  [=] RAJA_DEVICE (int i) { z[i] = 2.0 * y[i]; })
+ *            | RAJA::exec::synchronize();
+ *
+ *     stdexec::sync_wait(std::move(s));
+ *
+ * The arguments after the resource are those of RAJA::forall, so forall
+ * parameters such as RAJA::expt::Reduce may be given before the loop body.
+ * A forall that throws completes the sender with set_error.
+ */
+template <typename ExecPol, typename Res, typename... Args>
+concepts::enable_if_t<detail::forall_sender<ExecPol, Res, camp::decay<Args>...>,
+                      type_traits::is_resource<Res>>
+forall(Res res, Args&&... args)
+{
+  return {res, {std::forward<Args>(args)...}};
+}
+
+/*!
+ * \brief Sender that runs RAJA::forall<ExecPol>(args...) on the default
+ *        resource of ExecPol and completes with it.
+ */
+template <typename ExecPol,
+          typename Arg0,
+          typename... Args,
+          typename Res = typename resources::get_resource<ExecPol>::type>
+concepts::enable_if_t<
+    detail::forall_sender<ExecPol, Res, camp::decay<Arg0>, camp::decay<Args>...>,
+    concepts::negate<type_traits::is_resource<camp::decay<Arg0>>>>
+forall(Arg0&& arg0, Args&&... args)
+{
+  return {Res::get_default(),
+          {std::forward<Arg0>(arg0), std::forward<Args>(args)...}};
+}
+
+/*!
+ * \brief Adapter that runs RAJA::forall<ExecPol>(res, args...) on the
+ *        resource res a RAJA sender completes with.
+ *
+ * The loops are ordered by the resource, so a chain of GPU loops on one
+ * stream is enqueued without the host waiting between them.
+ */
+template <typename ExecPol, typename... Args>
+detail::then_forall_closure<ExecPol, camp::decay<Args>...> then_forall(
+    Args&&... args)
+{
+  return {{std::forward<Args>(args)...}};
+}
+
+/*!
+ * \brief Adapter that waits on the resource a RAJA sender completes with,
+ *        so the senders after it see the results of its loops.
+ *
+ * On CUDA and HIP resources this blocks the thread the sender completes on
+ * until the stream is idle; use it before handing results to senders that
+ * are not ordered by the resource, such as host I/O or MPI.
+ */
+inline detail::synchronize_closure synchronize() { return {}; }
+
+}  // namespace exec
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_STDEXEC
+
+#endif  // closing endif for header file include guard
@@ -322,6 +322,186 @@ stable_sort_pairs(ExecPolicy&& p,
       comp);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  segmented sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in] offsets RandomAccess Container of num_segments+1 offsets into
+* keys, segment i is [offsets[i], offsets[i+1])
+* \param[in] comp comparison function to apply for sort
+*
+* Each segment is sorted independently. The segments must partition keys,
+* i.e. offsets[0] is 0 and offsets[num_segments] is the size of keys, empty
+* segments are allowed.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_range<OffsetContainer>>
+segmented_sort(ExecPolicy&& p,
+               Res r,
+               Container&& c,
+               OffsetContainer&& offsets,
+               Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+  auto N = distance(begin_it, end_it);
+  const int num_segments =
+      static_cast<int>(distance(begin(offsets), end(offsets))) - 1;
+
+  if (N > 1 && num_segments > 0) {
+    return impl::sort::unstable_segmented(r, std::forward<ExecPolicy>(p),
+                                          begin_it, end_it, begin(offsets),
+                                          num_segments, comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>,
+                      type_traits::is_range<OffsetContainer>>
+segmented_sort(ExecPolicy&& p,
+               Container&& c,
+               OffsetContainer&& offsets,
+               Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::segmented_sort(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      std::forward<OffsetContainer>(offsets),
+      comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented sort pairs execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in,out] vals RandomAccess Container or range of values to reorder
+* along with keys
+* \param[in] offsets RandomAccess Container of num_segments+1 offsets into
+* keys, segment i is [offsets[i], offsets[i+1])
+* \param[in] comp comparison function to apply to keys for sort
+*
+* Each segment is sorted independently. The segments must partition keys,
+* i.e. offsets[0] is 0 and offsets[num_segments] is the size of keys, empty
+* segments are allowed.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename ValContainer,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<OffsetContainer>>
+segmented_sort_pairs(ExecPolicy&& p,
+                     Res r,
+                     KeyContainer&& keys,
+                     ValContainer&& vals,
+                     OffsetContainer&& offsets,
+                     Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffsetContainer>::value,
+                "OffsetContainer must model RandomAccessRange");
+
+  auto begin_key = begin(keys);
+  auto end_key   = end(keys);
+  auto N = distance(begin_key, end_key);
+  const int num_segments =
+      static_cast<int>(distance(begin(offsets), end(offsets))) - 1;
+
+  if (N > 1 && num_segments > 0) {
+    return impl::sort::unstable_segmented_pairs(r, std::forward<ExecPolicy>(p),
+                                                begin_key, end_key, begin(vals),
+                                                begin(offsets), num_segments,
+                                                comp);
+  } else {
+    return resources::EventProxy<Res>(r);
+  }
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename OffsetContainer,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<OffsetContainer>>
+segmented_sort_pairs(ExecPolicy&& p,
+                     KeyContainer&& keys,
+                     ValContainer&& vals,
+                     OffsetContainer&& offsets,
+                     Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::segmented_sort_pairs(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<ValContainer>(vals),
+      std::forward<OffsetContainer>(offsets),
+      comp);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 // =============================================================================
@@ -434,6 +614,61 @@ stable_sort_pairs(Res r, Args &&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * segmented_sort
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+segmented_sort(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::segmented_sort<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+segmented_sort(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::segmented_sort(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * segmented_sort_pairs
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+segmented_sort_pairs(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::segmented_sort_pairs<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+segmented_sort_pairs(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::segmented_sort_pairs(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,124 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort_low_memory declarations.
+*
+*          sort_low_memory sorts a range in place with extra memory bounded
+*          by a chunk size, for ranges too large to sort with a second
+*          array of the same size.
+*
+*          Usage example:
+*
+*          // at most N / 16 items of extra device memory
+*          RAJA::sort_low_memory<RAJA::cuda_exec<256>>(
+*              res, RAJA::make_span(keys, N), N / 16);
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_low_memory_HPP
+#define RAJA_sort_low_memory_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/pattern/sort.hpp"
+#include "RAJA/pattern/detail/sort_low_memory.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  sort with bounded extra memory
+*
+* \param[in] r Resource the sort runs on
+* \param[in,out] c RandomAccess Container
+* \param[in] chunk number of items sorted at once, which bounds the extra
+*memory
+* \param[in] comp comparison function to apply for sort
+*
+* Sorts c like RAJA::sort, but only ever sorts chunk items at once, so the
+* extra memory used is that of RAJA::sort of chunk items, e.g. a second
+* array of chunk items for the radix sorts of the CUDA and HIP back-ends,
+* instead of a second array of the size of c. The sorted chunks are merged
+* in place with merge path splits and rotations, which costs about
+* log2(size / chunk) extra passes over c for each of log2(size / chunk)
+* merge levels, and a host synchronization per split.
+*
+* Like RAJA::sort the sort is not stable.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      type_traits::is_range<Container>>
+sort_low_memory(Res r,
+                Container&& c,
+                size_t chunk,
+                Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using std::distance;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  const Index_type N = static_cast<Index_type>(distance(begin_it, end(c)));
+  const Index_type chunk_items =
+      chunk > 0 ? static_cast<Index_type>(chunk) : N;
+
+  if (N > 1) {
+    detail::SortLowMemory<ExecPolicy, Res, decltype(begin_it), Compare>
+        sorter(r, begin_it, chunk_items, comp);
+    sorter.sort(N);
+  }
+  return resources::EventProxy<Res>(r);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<type_traits::is_resource<camp::decay<Container>>>>
+sort_low_memory(Container&& c, size_t chunk, Compare comp = Compare{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::sort_low_memory<ExecPolicy>(
+      r, std::forward<Container>(c), chunk, comp);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
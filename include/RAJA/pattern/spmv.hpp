@@ -0,0 +1,127 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sparse matrix-vector product
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_spmv_HPP
+#define RAJA_spmv_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/spmv.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+******************************************************************************
+*
+* \brief  sparse matrix-vector product y = A x
+*
+* \param[in] r Resource
+* \param[in] A CSR matrix
+* \param[in] x vector of A.num_cols values
+* \param[out] y vector of A.num_rows values
+*
+* Rows of a CSR matrix can differ a lot in length, so the work is not split
+* by rows on GPUs:
+*
+*     RAJA::expt::spmv<RAJA::cuda_exec<256>>(res, A, x, y);
+*
+* Sequential and OpenMP policies compute the rows in order or over the
+* threads, OpenMP with dynamic scheduling. CUDA and HIP exec policies give
+* each row a warp when the rows average at least a quarter of a warp of
+* nonzeros, and otherwise split the rows and nonzeros evenly over the
+* threads along the merge path of row_ptr and the nonzeros, so a long row
+* is shared by several threads.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Res, typename T, typename IndexType>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::type_traits::is_resource<Res>>
+spmv(Res r, CSRView<T, IndexType> const& A, T const* x, T* y)
+{
+  if (A.num_rows == 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  return ::RAJA::impl::spmv::csr_spmv(r, ExecPolicy{}, A, x, y);
+}
+///
+template <typename ExecPolicy,
+          typename T,
+          typename IndexType,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>>
+spmv(CSRView<T, IndexType> const& A, T const* x, T* y)
+{
+  auto r = Res::get_default();
+  return ::RAJA::expt::spmv<ExecPolicy>(r, A, x, y);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sparse matrix-vector product y = A x with A in SELL-C-sigma format
+*
+* Each chunk of rows is computed with SIMD loads of its values and gathers
+* of x. SellMatrix is a host matrix, so only host policies are supported.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Res, typename T, typename IndexType>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::type_traits::is_resource<Res>>
+spmv(Res r, SellMatrix<T, IndexType> const& A, T const* x, T* y)
+{
+  if (A.num_rows() == 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  return ::RAJA::impl::spmv::sell_spmv(r, ExecPolicy{}, A, x, y);
+}
+///
+template <typename ExecPolicy,
+          typename T,
+          typename IndexType,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>>
+spmv(SellMatrix<T, IndexType> const& A, T const* x, T* y)
+{
+  auto r = Res::get_default();
+  return ::RAJA::expt::spmv<ExecPolicy>(r, A, x, y);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,298 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stencil_forall declarations.
+*
+*          stencil_forall runs a stencil over the points of an OffsetLayout
+*          with the points where the stencil stays inside the layout split
+*          from the boundary slabs, so the interior body needs no bounds
+*          checks.
+*
+*          Usage example:
+*
+*          RAJA::expt::stencil_forall<RAJA::cuda_exec<256>>(
+*              layout, 1,
+*              [=] RAJA_DEVICE (int i, int j) {
+*                out(i, j) = in(i - 1, j) + in(i + 1, j) +
+*                            in(i, j - 1) + in(i, j + 1);
+*              },
+*              [=] RAJA_DEVICE (int i, int j) {
+*                out(i, j) = 0;
+*              });
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_stencil_forall_HPP
+#define RAJA_stencil_forall_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/BoxSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/forall_fused.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief The points of a layout split into the interior box, where a
+ *        stencil of radius halo_width stays inside the layout, and the
+ *        boundary slabs around it.
+ *
+ * Boundary slabs 2 * d and 2 * d + 1 are the low and high slabs of
+ * dimension d. They span the interior in the dimensions before d and the
+ * whole layout in the dimensions after d, so every point of the layout is
+ * in exactly one box. Slabs may be empty.
+ */
+template <int DIM, typename IdxLin>
+struct StencilBoxes {
+  TypedBoxSegment<DIM, IdxLin> interior;
+  TypedBoxSegment<DIM, IdxLin> boundary[2 * DIM];
+};
+
+namespace detail
+{
+
+template <int DIM, typename IdxLin, camp::idx_t... Dims>
+TypedBoxSegment<DIM, IdxLin> make_box(IdxLin const* lo,
+                                      IdxLin const* hi,
+                                      camp::idx_seq<Dims...>)
+{
+  return TypedBoxSegment<DIM, IdxLin>(
+      TypedRangeSegment<IdxLin>(lo[Dims], hi[Dims])...);
+}
+
+//! boxes from the bounds of the interior and of the slabs
+template <int DIM, typename IdxLin, camp::idx_t... Is>
+StencilBoxes<DIM, IdxLin> make_stencil_boxes(IdxLin const* lo,
+                                             IdxLin const* hi,
+                                             IdxLin const (*slab_lo)[DIM],
+                                             IdxLin const (*slab_hi)[DIM],
+                                             camp::idx_seq<Is...>)
+{
+  using dim_seq = camp::make_idx_seq_t<DIM>;
+  return StencilBoxes<DIM, IdxLin>{
+      make_box<DIM>(lo, hi, dim_seq{}),
+      {make_box<DIM>(slab_lo[Is], slab_hi[Is], dim_seq{})...}};
+}
+
+//! adapter running body for the flattened points of box
+template <typename Box, typename Body>
+RAJA_INLINE ::RAJA::detail::box_adapter<Box::num_dims,
+                                        typename Box::value_type,
+                                        camp::decay<Body>>
+make_box_adapter(Box const& box, Body const& body)
+{
+  return ::RAJA::detail::box_adapter<Box::num_dims,
+                                     typename Box::value_type,
+                                     camp::decay<Body>>(box, body);
+}
+
+/*!
+ * Sequential, loop and simd policies run each box in tiles, the last
+ * dimension of the interior being a branch free stride one loop.
+ */
+template <typename ExecPolicy,
+          typename Res,
+          int DIM,
+          typename IdxLin,
+          typename InteriorBody,
+          typename BoundaryBody,
+          camp::idx_t... Is>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    ::RAJA::detail::is_box_tiled_policy<ExecPolicy>>
+stencil_forall_boxes(Res r,
+                     StencilBoxes<DIM, IdxLin> const& boxes,
+                     InteriorBody const& interior_body,
+                     BoundaryBody const& boundary_body,
+                     camp::idx_seq<Is...>)
+{
+  ::RAJA::forall<ExecPolicy>(r, boxes.interior, interior_body);
+  int unused[] = {0, (::RAJA::forall<ExecPolicy>(r,
+                                                 boxes.boundary[Is],
+                                                 boundary_body), 0)...};
+  RAJA_UNUSED_VAR(unused);
+  return resources::EventProxy<Res>(r);
+}
+
+/*!
+ * Other policies run the interior and the slabs flattened with
+ * forall_fused, which is one kernel launch on the GPU and one parallel
+ * region of nowait loops with OpenMP parallel for policies.
+ */
+template <typename ExecPolicy,
+          typename Res,
+          int DIM,
+          typename IdxLin,
+          typename InteriorBody,
+          typename BoundaryBody,
+          camp::idx_t... Is>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<::RAJA::detail::is_box_tiled_policy<ExecPolicy>>>
+stencil_forall_boxes(Res r,
+                     StencilBoxes<DIM, IdxLin> const& boxes,
+                     InteriorBody const& interior_body,
+                     BoundaryBody const& boundary_body,
+                     camp::idx_seq<Is...>)
+{
+  auto segs = camp::make_tuple(
+      TypedRangeSegment<Index_type>(0, boxes.interior.size()),
+      TypedRangeSegment<Index_type>(0, boxes.boundary[Is].size())...);
+  auto bodies =
+      camp::make_tuple(make_box_adapter(boxes.interior, interior_body),
+                       make_box_adapter(boxes.boundary[Is], boundary_body)...);
+  return ::RAJA::detail::forall_fused_loops(
+      ExecPolicy(), r, segs, bodies, camp::make_idx_seq_t<1 + sizeof...(Is)>{});
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Split the points of an OffsetLayout into the interior, at least
+ *        halo_width points from every side, and the boundary slabs.
+ */
+template <size_t n_dims, typename IdxLin>
+StencilBoxes<static_cast<int>(n_dims), IdxLin> make_stencil_boxes(
+    OffsetLayout<n_dims, IdxLin> const& layout,
+    IdxLin halo_width)
+{
+  constexpr int DIM = static_cast<int>(n_dims);
+
+  IdxLin begin[DIM];
+  IdxLin end[DIM];
+  IdxLin lo[DIM];
+  IdxLin hi[DIM];
+  for (int d = 0; d < DIM; ++d) {
+    begin[d] = layout.offsets[d];
+    end[d] = layout.offsets[d] + layout.base_.sizes[d];
+    // an interior thinner than the halo is empty, all points are boundary
+    lo[d] = end[d] - begin[d] > halo_width ? begin[d] + halo_width : end[d];
+    hi[d] = end[d] - lo[d] > halo_width ? end[d] - halo_width : lo[d];
+  }
+
+  IdxLin slab_lo[2 * DIM][DIM];
+  IdxLin slab_hi[2 * DIM][DIM];
+  for (int d = 0; d < DIM; ++d) {
+    for (int e = 0; e < DIM; ++e) {
+      slab_lo[2 * d][e] = slab_lo[2 * d + 1][e] = e < d ? lo[e] : begin[e];
+      slab_hi[2 * d][e] = slab_hi[2 * d + 1][e] = e < d ? hi[e] : end[e];
+    }
+    slab_hi[2 * d][d] = lo[d];
+    slab_lo[2 * d + 1][d] = hi[d];
+  }
+  return detail::make_stencil_boxes<DIM>(lo,
+                                         hi,
+                                         slab_lo,
+                                         slab_hi,
+                                         camp::make_idx_seq_t<2 * DIM>{});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  forall over an OffsetLayout with the interior split from the
+*         boundary
+*
+* \param[in] r Resource the loops run on
+* \param[in] layout Layout whose points are visited
+* \param[in] halo_width Radius of the stencil
+* \param[in] interior_body Body taking one index per dimension, run over the
+*            points at least halo_width from every side of the layout
+* \param[in] boundary_body Body taking one index per dimension, run over the
+*            other points
+*
+* The interior body may read every point within halo_width of its point
+* without checking bounds. Each point is visited once, by one of the bodies,
+* and the points may be visited in any order.
+*
+* Sequential, loop and simd policies walk the interior in tiles with the
+* last dimension innermost. GPU policies run the interior and the slabs in
+* one kernel launch, and OpenMP parallel for policies in one parallel
+* region, each thread moving to the next box without waiting for the
+* others.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          size_t n_dims,
+          typename IdxLin,
+          typename InteriorBody,
+          typename BoundaryBody>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+stencil_forall(Res r,
+               OffsetLayout<n_dims, IdxLin> const& layout,
+               IdxLin halo_width,
+               InteriorBody&& interior_body,
+               BoundaryBody&& boundary_body)
+{
+  auto boxes = make_stencil_boxes(layout, halo_width);
+  return detail::stencil_forall_boxes<camp::decay<ExecPolicy>>(
+      r,
+      boxes,
+      interior_body,
+      boundary_body,
+      camp::make_idx_seq_t<2 * static_cast<int>(n_dims)>{});
+}
+///
+template <typename ExecPolicy,
+          size_t n_dims,
+          typename IdxLin,
+          typename InteriorBody,
+          typename BoundaryBody,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+stencil_forall(OffsetLayout<n_dims, IdxLin> const& layout,
+               IdxLin halo_width,
+               InteriorBody&& interior_body,
+               BoundaryBody&& boundary_body)
+{
+  Res r = Res::get_default();
+  return ::RAJA::expt::stencil_forall<ExecPolicy>(
+      r,
+      layout,
+      halo_width,
+      std::forward<InteriorBody>(interior_body),
+      std::forward<BoundaryBody>(boundary_body));
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,101 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA tiled sweep declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sweep_HPP
+#define RAJA_sweep_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/sweep.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+******************************************************************************
+*
+* \brief  tiled (KBA style) sweep execution pattern
+*
+* \param[in] r Resource
+* \param[in] tiles cells of the sweep and the size of its tiles
+* \param[in] dirs direction of the sweep in each dimension
+* \param[in] body called with the 2 or 3 cell indices of each cell
+*
+* Calls body for each cell after the body of its upstream neighbors, the
+* cells one step against the sweep direction in each dimension, is done.
+* The cells are split into tiles, a tile starts as soon as its upstream
+* neighbor tiles are done instead of waiting for a whole wavefront, which
+* pipelines the sweep over the threads or blocks.
+*
+*     RAJA::expt::sweep<RAJA::omp_parallel_for_exec>(
+*         RAJA::expt::SweepTiles<2>{{nx, ny}, {16, 16}},
+*         RAJA::expt::SweepDirection<2>{{1, -1}},
+*         [=](RAJA::Index_type i, RAJA::Index_type j) { ... });
+*
+* Sequential policies run the tiles in wavefront order. OpenMP policies run
+* each tile on one thread, waiting on a DepGraphNode per tile. CUDA and HIP
+* exec policies run each tile on one block of BLOCK_SIZE threads, which
+* spin on a device counter per tile and run the cell wavefronts of the tile
+* one after the other; the GPU sweeps are synchronous.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Res, int DIM, typename Body>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::type_traits::is_resource<Res>>
+sweep(Res r,
+      SweepTiles<DIM> const& tiles,
+      SweepDirection<DIM> const& dirs,
+      Body const& body)
+{
+  detail::SweepSpace<DIM> space(tiles, dirs);
+  if (space.total_tiles() == 0) {
+    return resources::EventProxy<Res>(r);
+  }
+  return ::RAJA::impl::sweep::tiled_sweep(r, ExecPolicy{}, space, body);
+}
+///
+template <typename ExecPolicy,
+          int DIM,
+          typename Body,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>>
+sweep(SweepTiles<DIM> const& tiles,
+      SweepDirection<DIM> const& dirs,
+      Body const& body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::expt::sweep<ExecPolicy>(r, tiles, dirs, body);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -18,6 +18,8 @@
 #ifndef RAJA_synchronize_HPP
 #define RAJA_synchronize_HPP
 
+#include "RAJA/util/plugins.hpp"
+
 namespace RAJA
 {
 
@@ -35,13 +37,21 @@ namespace RAJA
  *
  * \tparam Policy synchronization policy
  *
+ * Registered plugins are called with preFence and postFence around the
+ * synchronization.
+ *
  * \see RAJA::policy::omp::synchronize_impl
  * \see RAJA::policy::cuda::synchronize_impl
  */
 template <typename Policy>
 void synchronize()
 {
+  util::PluginContext context{util::make_context<Policy>()};
+  util::callPreFencePlugins(context);
+
   synchronize_impl(Policy{});
+
+  util::callPostFencePlugins(context);
 }
 }  // namespace RAJA
 
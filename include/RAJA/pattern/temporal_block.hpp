@@ -0,0 +1,275 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA temporal blocking of stencil time steps.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_temporal_block_HPP
+#define RAJA_temporal_block_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/sweep.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief The cells of a 1D or 2D stencil, the tiles of time-skewed space
+ *        they are run in, and how far the stencil reaches.
+ *
+ *     RAJA::expt::TemporalTiles<2> tiles{{nx, ny}, {64, 64}, 8, 1};
+ *
+ * A tile runs depth time steps of tile_size skewed cells in each
+ * dimension. The tiles should fit in cache with the radius * depth cells
+ * they read around them.
+ */
+template <int DIM>
+struct TemporalTiles {
+  static_assert(DIM == 1 || DIM == 2, "Temporal blocks are 1D or 2D");
+
+  //! number of cells in each dimension
+  Index_type extent[DIM];
+  //! number of skewed cells of a tile in each dimension
+  Index_type tile_size[DIM];
+  //! number of time steps of a tile
+  Index_type depth;
+  //! cells a time step reads on each side of the cell it computes
+  Index_type radius;
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Time-skewed tile space of a temporal block.
+ *
+ * Cell x at step t has skewed coordinates s = x + radius * t in each
+ * dimension. A cell reads cells of the previous step with skewed
+ * coordinates between s - 2 * radius and s, and is overwritten two steps
+ * later, by a cell with skewed coordinates at or above those of the cells
+ * that read it. So every dependency, including the reuse of the buffers of
+ * a two buffer scheme, goes from smaller to larger or equal coordinates in
+ * time and in every skewed dimension, and the tiles are run as a sweep
+ * with every direction +1.
+ */
+template <int DIM>
+struct TemporalSpace {
+
+  Index_type extent[DIM];
+  Index_type tile_size[DIM];
+  Index_type num_tiles[DIM];
+  Index_type depth;
+  Index_type radius;
+  Index_type num_steps;
+  Index_type num_time_tiles;
+
+  TemporalSpace(TemporalTiles<DIM> const& tiles, Index_type steps)
+  {
+    depth = tiles.depth > 0 ? tiles.depth : 1;
+    radius = tiles.radius > 0 ? tiles.radius : 0;
+    num_steps = steps > 0 ? steps : 0;
+    num_time_tiles = RAJA_DIVIDE_CEILING_INT(num_steps, depth);
+    for (int d = 0; d < DIM; ++d) {
+      extent[d] = tiles.extent[d] > 0 ? tiles.extent[d] : 0;
+      tile_size[d] = tiles.tile_size[d] > 0 ? tiles.tile_size[d] : 1;
+      Index_type skewed =
+          extent[d] > 0 ? extent[d] + radius * (num_steps - 1) : 0;
+      num_tiles[d] = RAJA_DIVIDE_CEILING_INT(skewed, tile_size[d]);
+    }
+  }
+
+  bool empty() const
+  {
+    Index_type total = num_time_tiles;
+    for (int d = 0; d < DIM; ++d) {
+      total *= num_tiles[d];
+    }
+    return total == 0;
+  }
+
+  //! the tiles as the cells of a sweep, one tile per sweep tile
+  SweepTiles<DIM + 1> sweep_tiles() const
+  {
+    SweepTiles<DIM + 1> tiles;
+    tiles.extent[0] = num_time_tiles;
+    tiles.tile_size[0] = 1;
+    for (int d = 0; d < DIM; ++d) {
+      tiles.extent[d + 1] = num_tiles[d];
+      tiles.tile_size[d + 1] = 1;
+    }
+    return tiles;
+  }
+
+  SweepDirection<DIM + 1> sweep_direction() const
+  {
+    SweepDirection<DIM + 1> dirs;
+    for (int d = 0; d <= DIM; ++d) {
+      dirs.dir[d] = 1;
+    }
+    return dirs;
+  }
+
+  //! cells of the tile with skewed tile coordinate ts in dimension d at t
+  void cell_range(int d,
+                  Index_type ts,
+                  Index_type t,
+                  Index_type& lo,
+                  Index_type& hi) const
+  {
+    Index_type shift = radius * t;
+    lo = ts * tile_size[d] - shift;
+    hi = lo + tile_size[d];
+    lo = lo > 0 ? lo : 0;
+    hi = hi < extent[d] ? hi : extent[d];
+  }
+
+  //! run the time steps of tile tt, ts0 with body(t, i)
+  template <typename Body>
+  RAJA_INLINE void run_tile(Body const& body,
+                            Index_type tt,
+                            Index_type ts0) const
+  {
+    Index_type t_end = (tt + 1) * depth;
+    t_end = t_end < num_steps ? t_end : num_steps;
+    for (Index_type t = tt * depth; t < t_end; ++t) {
+      Index_type lo0, hi0;
+      cell_range(0, ts0, t, lo0, hi0);
+      for (Index_type i = lo0; i < hi0; ++i) {
+        body(t, i);
+      }
+    }
+  }
+
+  //! run the time steps of tile tt, ts0, ts1 with body(t, i, j)
+  template <typename Body>
+  RAJA_INLINE void run_tile(Body const& body,
+                            Index_type tt,
+                            Index_type ts0,
+                            Index_type ts1) const
+  {
+    Index_type t_end = (tt + 1) * depth;
+    t_end = t_end < num_steps ? t_end : num_steps;
+    for (Index_type t = tt * depth; t < t_end; ++t) {
+      Index_type lo0, hi0, lo1, hi1;
+      cell_range(0, ts0, t, lo0, hi0);
+      cell_range(1, ts1, t, lo1, hi1);
+      for (Index_type i = lo0; i < hi0; ++i) {
+        for (Index_type j = lo1; j < hi1; ++j) {
+          body(t, i, j);
+        }
+      }
+    }
+  }
+};
+
+//! sweep body running the temporal tile at the cell coordinates it is given
+template <int DIM, typename Body>
+struct TemporalTileBody {
+  TemporalSpace<DIM> const* space;
+  Body const* body;
+
+  template <typename... TileCoords>
+  RAJA_INLINE void operator()(TileCoords... tile) const
+  {
+    space->run_tile(*body, tile...);
+  }
+};
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  temporal blocking of explicit stencil time steps
+*
+* \param[in] r Resource
+* \param[in] tiles cells of the stencil, the tiles they are run in and the
+*                  radius of the stencil
+* \param[in] num_steps number of time steps
+* \param[in] body called with the step and the 1 or 2 cell indices for each
+*                 cell at each step 0 to num_steps - 1
+*
+* Runs depth time steps of a tile of cells while they are in cache instead
+* of sweeping all the cells once per step. body(t, i, j) computes cell
+* (i, j) of step t + 1 from cells up to radius away of step t, in its own
+* buffers, e.g. from buffer t % 2 to buffer (t + 1) % 2. It is called after
+* the cells it reads were computed for step t and before they are
+* overwritten with step t + 2, for any tile sizes.
+*
+*     RAJA::expt::temporal_block<RAJA::omp_parallel_for_exec>(
+*         RAJA::expt::TemporalTiles<2>{{nx, ny}, {64, 64}, 8, 1},
+*         num_steps,
+*         [=](RAJA::Index_type t, RAJA::Index_type i, RAJA::Index_type j) {
+*           double const* u = buf[t % 2];
+*           double* u_new = buf[(t + 1) % 2];
+*           ...
+*         });
+*
+* The tiles are parallelograms in time-skewed space, run as an
+* expt::sweep of the tiles, so sequential policies run them in wavefront
+* order and OpenMP policies run a tile as soon as the tiles before it in
+* time and space are done. Only host policies are supported.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Res, int DIM, typename Body>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::type_traits::is_resource<Res>>
+temporal_block(Res r,
+               TemporalTiles<DIM> const& tiles,
+               Index_type num_steps,
+               Body const& body)
+{
+  detail::TemporalSpace<DIM> space(tiles, num_steps);
+  if (space.empty()) {
+    return resources::EventProxy<Res>(r);
+  }
+  detail::TemporalTileBody<DIM, Body> tile_body{&space, &body};
+  return ::RAJA::expt::sweep<ExecPolicy>(r,
+                                         space.sweep_tiles(),
+                                         space.sweep_direction(),
+                                         tile_body);
+}
+///
+template <typename ExecPolicy,
+          int DIM,
+          typename Body,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      RAJA::type_traits::is_execution_policy<ExecPolicy>>
+temporal_block(TemporalTiles<DIM> const& tiles,
+               Index_type num_steps,
+               Body const& body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::expt::temporal_block<ExecPolicy>(r, tiles, num_steps, body);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
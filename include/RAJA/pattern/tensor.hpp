@@ -34,4 +34,7 @@
 
 #include "RAJA/pattern/tensor/TensorBlock.hpp"
 
+#include "RAJA/pattern/tensor/Gemm.hpp"
+#include "RAJA/pattern/tensor/Batched.hpp"
+
 #endif
@@ -0,0 +1,329 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining batched small matrix operations built
+ *          on the tensor vector registers.
+ *
+ *          The matrices of a batch are accessed through 3D views indexed as
+ *          (batch, row, column), and vectors through 2D views indexed as
+ *          (batch, row).  Each vector register holds the same entry of
+ *          consecutive matrices of the batch, so the operations vectorize
+ *          over the batch.  Layouts with the batch index innermost
+ *          (see batch_innermost and make_batched_layout) make these packed
+ *          loads and stores, other layouts use strided loads and stores.
+ *
+ *          Usage example:
+ *
+ *          auto layout = RAJA::expt::make_batched_layout<
+ *              RAJA::expt::batch_innermost>(num_batch, 3, 3);
+ *
+ *          RAJA::View<double, RAJA::Layout<3>> A(a, layout);
+ *          RAJA::View<double, RAJA::Layout<3>> B(b, layout);
+ *          RAJA::View<double, RAJA::Layout<3>> C(c, layout);
+ *
+ *          // C[e] = A[e]*B[e] for each e in the batch
+ *          RAJA::expt::batched_gemm(num_batch, 3, 3, 3, A, B, C);
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_Batched_HPP
+#define RAJA_pattern_tensor_Batched_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/PermutedLayout.hpp"
+#include "RAJA/pattern/tensor/VectorRegister.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+  //! (batch, row, column) permutation with the batch index stride-one
+  using batch_innermost = RAJA::PERM_JKI;
+
+  //! (batch, row, column) permutation with each matrix stored row-major
+  using batch_outermost = RAJA::PERM_IJK;
+
+  /*!
+   * Creates a (batch, row, column) layout for a batch of rows x cols
+   * matrices with the permutation PERM, where PERM is batch_innermost,
+   * batch_outermost or any other permutation of rank 3.
+   */
+  template<typename PERM, typename IdxLin = Index_type>
+  RAJA_INLINE
+  Layout<3, IdxLin> make_batched_layout(IdxLin num_batch, IdxLin rows, IdxLin cols)
+  {
+    return make_permuted_layout(std::array<IdxLin, 3>{{num_batch, rows, cols}},
+                                PERM::value);
+  }
+
+} // namespace expt
+
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Loads and stores a vector of one entry of up to VECTOR_TYPE::s_num_elem
+   * consecutive matrices of a batch.
+   */
+  template<typename VECTOR_TYPE>
+  struct BatchedAccess
+  {
+      using vector_type = VECTOR_TYPE;
+      using element_type = typename VECTOR_TYPE::element_type;
+
+      static constexpr camp::idx_t s_num_elem = VECTOR_TYPE::s_num_elem;
+
+      //! stride between consecutive batch entries of a view
+      template<typename VIEW, typename... IDX>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      camp::idx_t batch_stride(VIEW const &view, IDX... idx)
+      {
+        return camp::idx_t(view.get_layout()(1, idx...)) -
+               camp::idx_t(view.get_layout()(0, idx...));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      vector_type load(element_type const *ptr, camp::idx_t stride, camp::idx_t n)
+      {
+        vector_type v;
+        if(stride == 1){
+          v.load_packed_n(ptr, n);
+        }
+        else{
+          v.load_strided_n(ptr, stride, n);
+        }
+        return v;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      void store(vector_type const &v, element_type *ptr, camp::idx_t stride, camp::idx_t n)
+      {
+        if(stride == 1){
+          v.store_packed_n(ptr, n);
+        }
+        else{
+          v.store_strided_n(ptr, stride, n);
+        }
+      }
+  };
+
+
+  template<typename VECTOR_TYPE>
+  struct BatchedGemm
+  {
+      using access = BatchedAccess<VECTOR_TYPE>;
+      using vector_type = VECTOR_TYPE;
+
+      /*!
+       * C[e] = A[e]*B[e] for the n_batch matrices starting at e0
+       */
+      template<typename AVIEW, typename BVIEW, typename CVIEW>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      void exec(camp::idx_t e0, camp::idx_t n_batch,
+                camp::idx_t m, camp::idx_t n, camp::idx_t k,
+                AVIEW const &A, BVIEW const &B, CVIEW const &C)
+      {
+        camp::idx_t a_stride = access::batch_stride(A, 0, 0);
+        camp::idx_t b_stride = access::batch_stride(B, 0, 0);
+        camp::idx_t c_stride = access::batch_stride(C, 0, 0);
+
+        for(camp::idx_t i = 0;i < m;++ i){
+          for(camp::idx_t j = 0;j < n;++ j){
+            vector_type acc;
+            for(camp::idx_t p = 0;p < k;++ p){
+              vector_type a = access::load(&A(e0, i, p), a_stride, n_batch);
+              vector_type b = access::load(&B(e0, p, j), b_stride, n_batch);
+              acc = a.multiply_add(b, acc);
+            }
+            access::store(acc, &C(e0, i, j), c_stride, n_batch);
+          }
+        }
+      }
+  };
+
+
+  template<typename VECTOR_TYPE>
+  struct BatchedLUSolve
+  {
+      using access = BatchedAccess<VECTOR_TYPE>;
+      using vector_type = VECTOR_TYPE;
+
+      /*!
+       * Solves A[e] x[e] = b[e] for the n_batch systems starting at e0,
+       * overwriting A[e] with its LU factors and b[e] with x[e]
+       */
+      template<typename AVIEW, typename BVIEW>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      void exec(camp::idx_t e0, camp::idx_t n_batch, camp::idx_t n,
+                AVIEW const &A, BVIEW const &b)
+      {
+        camp::idx_t a_stride = access::batch_stride(A, 0, 0);
+        camp::idx_t b_stride = access::batch_stride(b, 0);
+
+        // factor and forward substitute with the unit lower triangle
+        for(camp::idx_t p = 0;p < n;++ p){
+          vector_type pivot = access::load(&A(e0, p, p), a_stride, n_batch);
+          vector_type inv_pivot = vector_type(1).divide(pivot);
+          vector_type b_p = access::load(&b(e0, p), b_stride, n_batch);
+
+          for(camp::idx_t i = p+1;i < n;++ i){
+            vector_type l = access::load(&A(e0, i, p), a_stride, n_batch).multiply(inv_pivot);
+            access::store(l, &A(e0, i, p), a_stride, n_batch);
+
+            for(camp::idx_t j = p+1;j < n;++ j){
+              vector_type a_ij = access::load(&A(e0, i, j), a_stride, n_batch);
+              vector_type a_pj = access::load(&A(e0, p, j), a_stride, n_batch);
+              access::store(a_ij.subtract(l.multiply(a_pj)), &A(e0, i, j), a_stride, n_batch);
+            }
+
+            vector_type b_i = access::load(&b(e0, i), b_stride, n_batch);
+            access::store(b_i.subtract(l.multiply(b_p)), &b(e0, i), b_stride, n_batch);
+          }
+        }
+
+        // back substitute with the upper triangle
+        for(camp::idx_t i = n-1;i >= 0;-- i){
+          vector_type x = access::load(&b(e0, i), b_stride, n_batch);
+          for(camp::idx_t j = i+1;j < n;++ j){
+            vector_type a_ij = access::load(&A(e0, i, j), a_stride, n_batch);
+            vector_type x_j = access::load(&b(e0, j), b_stride, n_batch);
+            x = x.subtract(a_ij.multiply(x_j));
+          }
+          vector_type a_ii = access::load(&A(e0, i, i), a_stride, n_batch);
+          access::store(x.divide(a_ii), &b(e0, i), b_stride, n_batch);
+        }
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  /*!
+   * Computes C[e] = A[e]*B[e] for each of the num_batch matrices in a batch,
+   * where A[e] is m x k, B[e] is k x n and C[e] is m x n.
+   *
+   * A, B and C are (batch, row, column) views.  Chunks of
+   * VECTOR_TYPE::s_num_elem consecutive matrices are computed with vector
+   * registers, and the chunks are run with EXEC_POLICY.
+   *
+   * On GPUs use a vector type with one element per thread, such as
+   * VectorRegister<T, scalar_register>, and a batch_innermost layout, so
+   * that each thread computes one matrix and the accesses of a warp
+   * coalesce.
+   */
+  template<typename EXEC_POLICY, typename VECTOR_TYPE,
+           typename AVIEW, typename BVIEW, typename CVIEW>
+  RAJA_INLINE
+  void batched_gemm(camp::idx_t num_batch,
+                    camp::idx_t m, camp::idx_t n, camp::idx_t k,
+                    AVIEW const &A, BVIEW const &B, CVIEW const &C)
+  {
+    using gemm_t = RAJA::internal::expt::BatchedGemm<VECTOR_TYPE>;
+    static constexpr camp::idx_t s_num_elem = VECTOR_TYPE::s_num_elem;
+
+    RAJA::forall<EXEC_POLICY>(
+        RAJA::TypedRangeStrideSegment<camp::idx_t>(0, num_batch, s_num_elem),
+        [=] RAJA_HOST_DEVICE (camp::idx_t e0){
+          gemm_t::exec(e0, RAJA::min<camp::idx_t>(s_num_elem, num_batch-e0),
+                       m, n, k, A, B, C);
+        });
+  }
+
+  /*!
+   * batched_gemm on the host with the default vector register
+   */
+  template<typename AVIEW, typename BVIEW, typename CVIEW>
+  RAJA_INLINE
+  void batched_gemm(camp::idx_t num_batch,
+                    camp::idx_t m, camp::idx_t n, camp::idx_t k,
+                    AVIEW const &A, BVIEW const &B, CVIEW const &C)
+  {
+    using element_type = camp::decay<decltype(C(0, 0, 0))>;
+    batched_gemm<RAJA::seq_exec, VectorRegister<element_type>>(
+        num_batch, m, n, k, A, B, C);
+  }
+
+
+  /*!
+   * Solves A[e] x[e] = b[e] for each of the num_batch n x n systems in a
+   * batch, overwriting A[e] with its LU factors and b[e] with x[e].
+   *
+   * A is a (batch, row, column) view and b is a (batch, row) view.  The
+   * factorization does not pivot, so it is meant for the small well
+   * conditioned systems (diagonally dominant, SPD, ...) where batched
+   * solvers are used.  Chunks of VECTOR_TYPE::s_num_elem consecutive
+   * systems are solved with vector registers, and the chunks are run with
+   * EXEC_POLICY.
+   */
+  template<typename EXEC_POLICY, typename VECTOR_TYPE,
+           typename AVIEW, typename BVIEW>
+  RAJA_INLINE
+  void batched_lu_solve(camp::idx_t num_batch, camp::idx_t n,
+                        AVIEW const &A, BVIEW const &b)
+  {
+    static_assert(std::is_floating_point<typename VECTOR_TYPE::element_type>::value,
+                  "batched_lu_solve requires a floating point element type");
+
+    using solve_t = RAJA::internal::expt::BatchedLUSolve<VECTOR_TYPE>;
+    static constexpr camp::idx_t s_num_elem = VECTOR_TYPE::s_num_elem;
+
+    RAJA::forall<EXEC_POLICY>(
+        RAJA::TypedRangeStrideSegment<camp::idx_t>(0, num_batch, s_num_elem),
+        [=] RAJA_HOST_DEVICE (camp::idx_t e0){
+          solve_t::exec(e0, RAJA::min<camp::idx_t>(s_num_elem, num_batch-e0),
+                        n, A, b);
+        });
+  }
+
+  /*!
+   * batched_lu_solve on the host with the default vector register
+   */
+  template<typename AVIEW, typename BVIEW>
+  RAJA_INLINE
+  void batched_lu_solve(camp::idx_t num_batch, camp::idx_t n,
+                        AVIEW const &A, BVIEW const &b)
+  {
+    using element_type = camp::decay<decltype(A(0, 0, 0))>;
+    batched_lu_solve<RAJA::seq_exec, VectorRegister<element_type>>(
+        num_batch, n, A, b);
+  }
+
+} // namespace expt
+} // namespace RAJA
+
+#endif
@@ -0,0 +1,358 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a cache blocked matrix multiply driver
+ *          built on the tensor registers.
+ *
+ *          Usage example:
+ *
+ *          RAJA::View<double, RAJA::Layout<2>> A(a, M, K);
+ *          RAJA::View<double, RAJA::Layout<2>> B(b, K, N);
+ *          RAJA::View<double, RAJA::Layout<2>> C(c, M, N);
+ *
+ *          // C = 1.0*A*B + 0.0*C
+ *          RAJA::expt::gemm(M, N, K, 1.0, A, B, 0.0, C);
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_Gemm_HPP
+#define RAJA_pattern_tensor_Gemm_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * Blocking parameters for gemm.
+   *
+   * The product is computed on MR x (NR_REGISTERS*register width) register
+   * tiles.  The register tiles stream through KC deep micro-panels of A and
+   * B that are sized to stay in L1, and MC x KC panels of A and KC x NC
+   * panels of B are packed into contiguous buffers sized for L2 and L3.
+   *
+   * Specialize gemm_blocking_traits for a register policy to change the
+   * defaults used by that policy.
+   */
+  template<typename REGISTER_POLICY,
+           camp::idx_t MR = 4,
+           camp::idx_t NR_REGISTERS = 2,
+           camp::idx_t KC = 256,
+           camp::idx_t MC = 128,
+           camp::idx_t NC = 2048>
+  struct gemm_blocking
+  {
+      using register_policy = REGISTER_POLICY;
+
+      static constexpr camp::idx_t s_mr = MR;
+      static constexpr camp::idx_t s_nr_registers = NR_REGISTERS;
+      static constexpr camp::idx_t s_kc = KC;
+      static constexpr camp::idx_t s_mc = MC;
+      static constexpr camp::idx_t s_nc = NC;
+
+      static_assert(MR > 0 && NR_REGISTERS > 0 && KC > 0 && MC > 0 && NC > 0,
+                    "gemm_blocking parameters must be positive");
+  };
+
+
+  /*!
+   * Default blocking used by gemm for each register policy
+   */
+  template<typename REGISTER_POLICY>
+  struct gemm_blocking_traits
+  {
+      using type = gemm_blocking<REGISTER_POLICY>;
+  };
+
+  // scalar registers have 1 lane, use a squarer register tile
+  template<>
+  struct gemm_blocking_traits<scalar_register>
+  {
+      using type = gemm_blocking<scalar_register, 4, 4>;
+  };
+
+} // namespace expt
+
+namespace internal
+{
+namespace expt
+{
+
+  template<typename T, typename BLOCKING>
+  struct GemmDriver
+  {
+      using element_type = T;
+      using register_type = RAJA::expt::Register<T, typename BLOCKING::register_policy>;
+
+      static constexpr camp::idx_t s_register_width = register_type::s_num_elem;
+
+      static constexpr camp::idx_t s_nr_registers = BLOCKING::s_nr_registers;
+
+      // register tile size
+      static constexpr camp::idx_t s_mr = BLOCKING::s_mr;
+      static constexpr camp::idx_t s_nr = s_nr_registers*s_register_width;
+
+      // cache panel sizes, rounded up to whole register tiles
+      static constexpr camp::idx_t s_kc = BLOCKING::s_kc;
+      static constexpr camp::idx_t s_mc = ((BLOCKING::s_mc+s_mr-1)/s_mr)*s_mr;
+      static constexpr camp::idx_t s_nc = ((BLOCKING::s_nc+s_nr-1)/s_nr)*s_nr;
+
+
+      /*!
+       * Packs the mc x kc block of A at (i0, p0) into MR row micro-panels,
+       * each stored k-major so the micro kernel reads it contiguously.
+       * Rows past mc are zero filled.
+       */
+      template<typename AVIEW>
+      RAJA_INLINE
+      static
+      void pack_a(AVIEW const &A, camp::idx_t i0, camp::idx_t p0,
+                  camp::idx_t mc, camp::idx_t kc, element_type *packed)
+      {
+        for(camp::idx_t ir = 0;ir < mc;ir += s_mr){
+          camp::idx_t mr = RAJA::min<camp::idx_t>(s_mr, mc-ir);
+          for(camp::idx_t p = 0;p < kc;++ p){
+            for(camp::idx_t r = 0;r < mr;++ r){
+              packed[r] = A(i0+ir+r, p0+p);
+            }
+            for(camp::idx_t r = mr;r < s_mr;++ r){
+              packed[r] = element_type(0);
+            }
+            packed += s_mr;
+          }
+        }
+      }
+
+      /*!
+       * Packs the kc x nc block of B at (p0, j0) into NR column
+       * micro-panels, each stored k-major so a row of the micro-panel is
+       * loaded with packed register loads.
+       * Columns past nc are zero filled.
+       */
+      template<typename BVIEW>
+      RAJA_INLINE
+      static
+      void pack_b(BVIEW const &B, camp::idx_t p0, camp::idx_t j0,
+                  camp::idx_t kc, camp::idx_t nc, element_type *packed)
+      {
+        for(camp::idx_t jr = 0;jr < nc;jr += s_nr){
+          camp::idx_t nr = RAJA::min<camp::idx_t>(s_nr, nc-jr);
+          for(camp::idx_t p = 0;p < kc;++ p){
+            for(camp::idx_t c = 0;c < nr;++ c){
+              packed[c] = B(p0+p, j0+jr+c);
+            }
+            for(camp::idx_t c = nr;c < s_nr;++ c){
+              packed[c] = element_type(0);
+            }
+            packed += s_nr;
+          }
+        }
+      }
+
+      /*!
+       * Computes a full MR x NR register tile of the product of packed
+       * micro-panels, writing it row-major to tile.
+       */
+      RAJA_INLINE
+      static
+      void micro_kernel(camp::idx_t kc,
+                        element_type const *a_panel,
+                        element_type const *b_panel,
+                        element_type *tile)
+      {
+        register_type acc[s_mr][s_nr_registers];
+
+        for(camp::idx_t p = 0;p < kc;++ p){
+          register_type b[s_nr_registers];
+          for(camp::idx_t j = 0;j < s_nr_registers;++ j){
+            b[j].load_packed(b_panel + j*s_register_width);
+          }
+
+          for(camp::idx_t r = 0;r < s_mr;++ r){
+            register_type a(a_panel[r]);
+            for(camp::idx_t j = 0;j < s_nr_registers;++ j){
+              acc[r][j] = a.multiply_add(b[j], acc[r][j]);
+            }
+          }
+
+          a_panel += s_mr;
+          b_panel += s_nr;
+        }
+
+        for(camp::idx_t r = 0;r < s_mr;++ r){
+          for(camp::idx_t j = 0;j < s_nr_registers;++ j){
+            acc[r][j].store_packed(tile + r*s_nr + j*s_register_width);
+          }
+        }
+      }
+
+      /*!
+       * Computes C = alpha*A*B + beta*C, where A is m x k, B is k x n and
+       * C is m x n.  C is not read when beta is zero.
+       */
+      template<typename AVIEW, typename BVIEW, typename CVIEW>
+      static
+      void exec(camp::idx_t m, camp::idx_t n, camp::idx_t k,
+                element_type alpha, AVIEW const &A, BVIEW const &B,
+                element_type beta, CVIEW const &C)
+      {
+        if(m <= 0 || n <= 0){
+          return;
+        }
+
+        if(k <= 0){
+          scale(m, n, beta, C);
+          return;
+        }
+
+        camp::idx_t kc_max = RAJA::min<camp::idx_t>(s_kc, k);
+        camp::idx_t mc_max = RAJA::min<camp::idx_t>(s_mc, ((m+s_mr-1)/s_mr)*s_mr);
+        camp::idx_t nc_max = RAJA::min<camp::idx_t>(s_nc, ((n+s_nr-1)/s_nr)*s_nr);
+
+        std::vector<element_type> a_packed(mc_max*kc_max);
+        std::vector<element_type> b_packed(kc_max*nc_max);
+
+        element_type tile[s_mr*s_nr];
+
+        // L3: column panels of B and C
+        for(camp::idx_t jc = 0;jc < n;jc += s_nc){
+          camp::idx_t nc = RAJA::min<camp::idx_t>(s_nc, n-jc);
+
+          // k panels, the first one applies beta to C
+          for(camp::idx_t pc = 0;pc < k;pc += s_kc){
+            camp::idx_t kc = RAJA::min<camp::idx_t>(s_kc, k-pc);
+            element_type beta_pc = pc == 0 ? beta : element_type(1);
+
+            pack_b(B, pc, jc, kc, nc, b_packed.data());
+
+            // L2: row panels of A and C
+            for(camp::idx_t ic = 0;ic < m;ic += s_mc){
+              camp::idx_t mc = RAJA::min<camp::idx_t>(s_mc, m-ic);
+
+              pack_a(A, ic, pc, mc, kc, a_packed.data());
+
+              // L1: register tiles over the packed panels
+              for(camp::idx_t jr = 0;jr < nc;jr += s_nr){
+                camp::idx_t nr = RAJA::min<camp::idx_t>(s_nr, nc-jr);
+                element_type const *b_panel = b_packed.data() + jr*kc;
+
+                for(camp::idx_t ir = 0;ir < mc;ir += s_mr){
+                  camp::idx_t mr = RAJA::min<camp::idx_t>(s_mr, mc-ir);
+                  element_type const *a_panel = a_packed.data() + ir*kc;
+
+                  micro_kernel(kc, a_panel, b_panel, tile);
+
+                  update(ic+ir, jc+jr, mr, nr, alpha, tile, beta_pc, C);
+                }
+              }
+            }
+          }
+        }
+      }
+
+    private:
+
+      /*!
+       * Writes the valid mr x nr part of a register tile into C
+       */
+      template<typename CVIEW>
+      RAJA_INLINE
+      static
+      void update(camp::idx_t i0, camp::idx_t j0,
+                  camp::idx_t mr, camp::idx_t nr,
+                  element_type alpha, element_type const *tile,
+                  element_type beta, CVIEW const &C)
+      {
+        if(beta == element_type(0)){
+          for(camp::idx_t r = 0;r < mr;++ r){
+            for(camp::idx_t c = 0;c < nr;++ c){
+              C(i0+r, j0+c) = alpha*tile[r*s_nr+c];
+            }
+          }
+        }
+        else{
+          for(camp::idx_t r = 0;r < mr;++ r){
+            for(camp::idx_t c = 0;c < nr;++ c){
+              C(i0+r, j0+c) = alpha*tile[r*s_nr+c] + beta*C(i0+r, j0+c);
+            }
+          }
+        }
+      }
+
+      template<typename CVIEW>
+      RAJA_INLINE
+      static
+      void scale(camp::idx_t m, camp::idx_t n, element_type beta, CVIEW const &C)
+      {
+        for(camp::idx_t i = 0;i < m;++ i){
+          for(camp::idx_t j = 0;j < n;++ j){
+            C(i, j) = beta == element_type(0) ? element_type(0) : beta*C(i, j);
+          }
+        }
+      }
+  };
+
+} // namespace expt
+} // namespace internal
+
+
+namespace expt
+{
+
+  /*!
+   * Computes C = alpha*A*B + beta*C on the host, where A is m x k, B is k x n
+   * and C is m x n.
+   *
+   * A, B and C may be any 2D views indexed as (row, column), for example
+   * RAJA::View with any layout.  The blocks of A and B are packed into
+   * contiguous buffers, so the layouts of the views only affect the cost
+   * of packing and of the updates of C.
+   *
+   * As with BLAS, C is not read when beta is zero.
+   */
+  template<typename BLOCKING, typename T, typename AVIEW, typename BVIEW, typename CVIEW>
+  RAJA_INLINE
+  void gemm(camp::idx_t m, camp::idx_t n, camp::idx_t k,
+            T alpha, AVIEW const &A, BVIEW const &B,
+            T beta, CVIEW const &C)
+  {
+    RAJA::internal::expt::GemmDriver<T, BLOCKING>::exec(m, n, k, alpha, A, B, beta, C);
+  }
+
+  /*!
+   * gemm using the default blocking of the default register policy
+   */
+  template<typename T, typename AVIEW, typename BVIEW, typename CVIEW>
+  RAJA_INLINE
+  void gemm(camp::idx_t m, camp::idx_t n, camp::idx_t k,
+            T alpha, AVIEW const &A, BVIEW const &B,
+            T beta, CVIEW const &C)
+  {
+    using blocking = typename gemm_blocking_traits<default_register>::type;
+    gemm<blocking>(m, n, k, alpha, A, B, beta, C);
+  }
+
+} // namespace expt
+} // namespace RAJA
+
+#endif
@@ -21,6 +21,7 @@
 #include "camp/camp.hpp"
 #include "RAJA/config.hpp"
 #include "RAJA/pattern/tensor/MatrixRegister.hpp"
+#include "RAJA/pattern/tensor/internal/MatrixMultiplyUnit.hpp"
 
 
 namespace RAJA
@@ -91,7 +92,7 @@ namespace expt
       static
       RAJA_INLINE
       typename std::enable_if<(s_C_minor_dim_registers != 0), dummy>::type
-      multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
+      multiply_accumulate_fma(left_type const &A, right_type const &B, result_type &C)
       {
 #if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
         RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
@@ -126,7 +127,7 @@ namespace expt
       RAJA_INLINE
       static
       typename std::enable_if<(s_C_minor_dim_registers == 0), dummy>::type
-      multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
+      multiply_accumulate_fma(left_type const &A, right_type const &B, result_type &C)
       {
         constexpr camp::idx_t bc_segbits = result_type::s_segbits;
         constexpr camp::idx_t a_segments_per_register = 1<<bc_segbits;
@@ -162,6 +163,23 @@ namespace expt
 
       }
 
+      /*
+       * Use the matrix multiply unit of the architecture if it has one for
+       * these matrices, otherwise use register multiply_adds
+       *
+       */
+      RAJA_HOST_DEVICE
+      static
+      RAJA_INLINE
+      void multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
+      {
+        using unit_type = MatrixMultiplyUnit<REGISTER_POLICY, T, N_SIZE, M_SIZE, O_SIZE>;
+
+        if(!unit_type::multiply_accumulate(A, B, C)){
+          multiply_accumulate_fma(A, B, C);
+        }
+      }
+
       RAJA_HOST_DEVICE
       static
       RAJA_INLINE
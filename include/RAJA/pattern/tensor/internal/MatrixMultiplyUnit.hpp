@@ -0,0 +1,64 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the hook for matrix multiply units.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_internal_MatrixMultiplyUnit_HPP
+#define RAJA_pattern_tensor_internal_MatrixMultiplyUnit_HPP
+
+#include "camp/camp.hpp"
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  /**
+   * Hook for hardware matrix multiply units (tensor cores, matrix cores).
+   *
+   * Computes C += A*B for row-major A (N_SIZE x M_SIZE), B (M_SIZE x O_SIZE)
+   * and C (N_SIZE x O_SIZE) matrix registers.
+   * Returns false when the multiply was not done, in which case the caller
+   * falls back to the register multiply_add implementation.
+   *
+   * Architectures specialize this for the register policies and element
+   * types they accelerate.
+   */
+  template<typename REGISTER_POLICY, typename T, camp::idx_t N_SIZE, camp::idx_t M_SIZE, camp::idx_t O_SIZE>
+  struct MatrixMultiplyUnit
+  {
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE>
+    RAJA_HOST_DEVICE
+    static
+    RAJA_INLINE
+    bool multiply_accumulate(A_TYPE const &, B_TYPE const &, C_TYPE &)
+    {
+      return false;
+    }
+  };
+
+
+} // namespace expt
+} // namespace internal
+} // namespace RAJA
+
+
+#endif
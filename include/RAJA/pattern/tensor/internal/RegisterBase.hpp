@@ -852,6 +852,29 @@ namespace expt
       }
 
 
+      /*!
+       * Permutes the lanes of the register, lane i of the result is lane
+       * idx[i] of this register.
+       *
+       * This is a non-optimized reference version which will be used if
+       * no architecture specialized version is supplied
+       */
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type permute(int_vector_type const &idx) const
+      {
+        auto const &x = *getThis();
+
+        self_type z;
+
+        for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
+          z.set(x.get(idx.get(i)), i);
+        }
+
+        return z;
+      }
+
+
 
 
       /*!
@@ -100,6 +100,33 @@ namespace expt
 
       using base_type::m_registers;
 
+      /*
+       * Loads element offsets from an index array.  Index arrays that
+       * already hold the integer element type are loaded as a vector,
+       * others (such as int ListSegment indices used with double vectors,
+       * which take 64-bit offsets) are converted lane by lane.
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      int_vector_type s_load_indices(int_element_type const *indices, camp::idx_t N){
+        int_vector_type offsets;
+        offsets.load_packed_n(indices, N);
+        return offsets;
+      }
+
+      template<typename IDX>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      int_vector_type s_load_indices(IDX const *indices, camp::idx_t N){
+        int_vector_type offsets;
+        for(camp::idx_t i = 0;i < N;++ i){
+          offsets.set(int_element_type(indices[i]), i);
+        }
+        return offsets;
+      }
+
     public:
 
 
@@ -748,6 +775,58 @@ namespace expt
       }
 
 
+      /*!
+       * @brief Indexed gather operation for full vector.
+       *
+       * Loads element i from ptr[indices[i]], where indices is an array of
+       * element-wise offsets, for example the indices of a ListSegment.
+       */
+      template<typename IDX>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &gather_indexed(element_type const *ptr, IDX const *indices){
+        return gather(ptr, s_load_indices(indices, s_num_elem));
+      }
+
+      /*!
+       * @brief Indexed gather operation for n-length subvector.
+       *
+       * Only reads the first N entries of indices, the remaining lanes are
+       * zeroed.
+       */
+      template<typename IDX>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &gather_indexed_n(element_type const *ptr, IDX const *indices, camp::idx_t N){
+        return gather_n(ptr, s_load_indices(indices, N), N);
+      }
+
+      /*!
+       * @brief Indexed scatter operation for full vector.
+       *
+       * Stores element i to ptr[indices[i]], where indices is an array of
+       * element-wise offsets, for example the indices of a ListSegment.
+       */
+      template<typename IDX>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &scatter_indexed(element_type *ptr, IDX const *indices) const {
+        return scatter(ptr, s_load_indices(indices, s_num_elem));
+      }
+
+      /*!
+       * @brief Indexed scatter operation for n-length subvector.
+       *
+       * Only reads the first N entries of indices.
+       */
+      template<typename IDX>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type const &scatter_indexed_n(element_type *ptr, IDX const *indices, camp::idx_t N) const {
+        return scatter_n(ptr, s_load_indices(indices, N), N);
+      }
+
+
       RAJA_HOST_DEVICE
       RAJA_INLINE
       self_type divide(self_type const &den) const {
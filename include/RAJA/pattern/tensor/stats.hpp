@@ -17,70 +17,113 @@
 
 
 // Place the following line before including RAJA to enable
-// statistics on the Vector abstractions
+// statistics on the Vector abstractions, the counters live in the
+// RAJA::metrics registry so RAJA must be built with RAJA_ENABLE_METRICS
 // #define RAJA_ENABLE_VECTOR_STATS
+//
+// Counting can then be switched off and on at runtime with
+// RAJA::tensor_stats::disable() and RAJA::tensor_stats::enable(), a
+// disabled statistic costs one relaxed load and a branch.
 
 
 #ifndef RAJA_pattern_simd_register_stats_HPP
 #define RAJA_pattern_simd_register_stats_HPP
 
 #include "RAJA/config.hpp"
+#include "RAJA/util/metrics.hpp"
 #include "camp/camp.hpp"
 
+#include <atomic>
+
+#if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(RAJA_ENABLE_METRICS)
+#error "RAJA_ENABLE_VECTOR_STATS requires RAJA built with RAJA_ENABLE_METRICS"
+#endif
+
+#if defined(RAJA_ENABLE_METRICS)
+
 namespace RAJA
 {
-namespace expt
-{
 struct tensor_stats
 {
-    static int indent;
+  //! Counter of the metrics registry that only counts while enabled
+  class Stat
+  {
+  public:
+    explicit Stat(const char* name) : m_counter(name) {}
+
+    void operator++(int) const { if(isEnabled()){ m_counter.add(1); } }
+    void operator++() const { if(isEnabled()){ m_counter.add(1); } }
+
+    //! sum over all threads since the last reset
+    metrics::count_type value() const { return m_counter.value(); }
 
-  static camp::idx_t num_vector_copy;
-  static camp::idx_t num_vector_copy_ctor;
-  static camp::idx_t num_vector_broadcast_ctor;
+    void reset() const { m_counter.reset(); }
 
-  static camp::idx_t num_vector_load_packed;
-  static camp::idx_t num_vector_load_packed_n;
-  static camp::idx_t num_vector_load_strided;
-  static camp::idx_t num_vector_load_strided_n;
+  private:
+    metrics::Counter m_counter;
+  };
 
-  static camp::idx_t num_vector_store_packed;
-  static camp::idx_t num_vector_store_packed_n;
-  static camp::idx_t num_vector_store_strided;
-  static camp::idx_t num_vector_store_strided_n;
+  static int indent;
 
-  static camp::idx_t num_vector_broadcast;
+  //! whether the statistics are counted, they are by default
+  static bool isEnabled()
+  {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
 
-  static camp::idx_t num_vector_get;
-  static camp::idx_t num_vector_set;
+  static void enable() { s_enabled.store(true, std::memory_order_relaxed); }
+  static void disable() { s_enabled.store(false, std::memory_order_relaxed); }
 
-  static camp::idx_t num_vector_add;
-  static camp::idx_t num_vector_subtract;
-  static camp::idx_t num_vector_multiply;
-  static camp::idx_t num_vector_divide;
+  static const Stat num_vector_copy;
+  static const Stat num_vector_copy_ctor;
+  static const Stat num_vector_broadcast_ctor;
 
-  static camp::idx_t num_vector_fma;
-  static camp::idx_t num_vector_fms;
+  static const Stat num_vector_load_packed;
+  static const Stat num_vector_load_packed_n;
+  static const Stat num_vector_load_strided;
+  static const Stat num_vector_load_strided_n;
 
-  static camp::idx_t num_vector_sum;
-  static camp::idx_t num_vector_max;
-  static camp::idx_t num_vector_min;
-  static camp::idx_t num_vector_vmax;
-  static camp::idx_t num_vector_vmin;
-  static camp::idx_t num_vector_dot;
+  static const Stat num_vector_store_packed;
+  static const Stat num_vector_store_packed_n;
+  static const Stat num_vector_store_strided;
+  static const Stat num_vector_store_strided_n;
 
+  static const Stat num_vector_broadcast;
 
-  static camp::idx_t num_matrix_mm_mult_row_row;
-  static camp::idx_t num_matrix_mm_multacc_row_row;
-  static camp::idx_t num_matrix_mm_mult_col_col;
-  static camp::idx_t num_matrix_mm_multacc_col_col;
+  static const Stat num_vector_get;
+  static const Stat num_vector_set;
+
+  static const Stat num_vector_add;
+  static const Stat num_vector_subtract;
+  static const Stat num_vector_multiply;
+  static const Stat num_vector_divide;
+
+  static const Stat num_vector_fma;
+  static const Stat num_vector_fms;
+
+  static const Stat num_vector_sum;
+  static const Stat num_vector_max;
+  static const Stat num_vector_min;
+  static const Stat num_vector_vmax;
+  static const Stat num_vector_vmin;
+  static const Stat num_vector_dot;
+
+
+  static const Stat num_matrix_mm_mult_row_row;
+  static const Stat num_matrix_mm_multacc_row_row;
+  static const Stat num_matrix_mm_mult_col_col;
+  static const Stat num_matrix_mm_multacc_col_col;
 
   static void resetVectorStats();
   static void printVectorStats();
 
+private:
+  static std::atomic<bool> s_enabled;
+
 };
 
-} // namespace expt
 } // namespace RAJA
 
 #endif
+
+#endif
@@ -0,0 +1,236 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA multi-policy that selects a policy by loop size, with size
+ *          thresholds calibrated at runtime
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AdaptiveMultiPolicy_HPP
+#define RAJA_AdaptiveMultiPolicy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/MultiPolicy.hpp"
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! loop body the policies are timed with, a streaming triad
+struct AdaptiveCalibrationBody {
+  double* x;
+  double* y;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type i) const
+  {
+    y[i] = 2.0 * x[i] + y[i];
+  }
+};
+
+struct AdaptiveCalibrationInit {
+  double* x;
+  double* y;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type i) const
+  {
+    x[i] = 1.0;
+    y[i] = 0.0;
+  }
+};
+
+/*!
+ * \brief Seconds forall with Policy takes over n iterates, on the default
+ *        resource of Policy and including the wait for the loop to finish.
+ */
+template <typename Policy>
+double adaptive_time_policy(Index_type n)
+{
+  using Res = typename resources::get_resource<Policy>::type;
+  Res res = Res::get_default();
+  camp::resources::Resource mem{res};
+  double* x = mem.allocate<double>(n);
+  double* y = mem.allocate<double>(n);
+  TypedRangeSegment<Index_type> range(0, n);
+
+  // the first launch pays one time costs, e.g. loading GPU kernels
+  ::RAJA::forall<Policy>(res, range, AdaptiveCalibrationInit{x, y});
+  res.wait();
+
+  const Index_type reps =
+      n >= (Index_type(1) << 20) ? 3 : std::min<Index_type>(
+                                           100, (Index_type(1) << 22) / n);
+  Timer timer;
+  timer.start();
+  for (Index_type r = 0; r < reps; ++r) {
+    ::RAJA::forall<Policy>(res, range, AdaptiveCalibrationBody{x, y});
+    res.wait();
+  }
+  timer.stop();
+
+  mem.deallocate(x);
+  mem.deallocate(y);
+  return timer.elapsed() / static_cast<double>(reps);
+}
+
+}  // namespace detail
+
+/// AdaptivePolicySelector - MultiPolicy selector that picks the fastest of
+/// Policies for the size of each loop
+///
+/// Each policy is timed running a streaming loop of 4^k iterates, for k up
+/// to log4(max_size), and the fastest policy at each size is kept in a
+/// table. Selecting a policy for a loop of n iterates reads the table at the
+/// largest calibrated size not above n, so small loops stop paying for GPU
+/// launches or OpenMP thread teams and no size thresholds are hard coded.
+///
+/// The policies are timed when calibrate() is called, or else when the
+/// first loop is run. Copies of a selector share the calibration, and the
+/// calibration is done once even if several threads run loops at once.
+/// Timing uses the default resource of each policy and allocates memory for
+/// 2 * max_size doubles with it.
+///
+/// \tparam Policies policies to select from, numbered from 0
+template <typename... Policies>
+class AdaptivePolicySelector
+{
+public:
+  //! largest power of 4 calibrated is 4^(max_levels - 1)
+  static constexpr int max_levels = 16;
+
+  explicit AdaptivePolicySelector(Index_type max_size = Index_type(1) << 20)
+      : m_state(std::make_shared<State>())
+  {
+    m_state->num_levels = 1;
+    while (m_state->num_levels < max_levels &&
+           (Index_type(1) << (2 * m_state->num_levels)) <= max_size) {
+      ++m_state->num_levels;
+    }
+  }
+
+  //! time the policies now, if they were not timed yet
+  void calibrate() const
+  {
+    std::call_once(m_state->once, [this]() { run_calibration(); });
+  }
+
+  //! index of the policy selected for loops of n iterates
+  int policy_for(Index_type n) const
+  {
+    calibrate();
+    int level = 0;
+    while (level + 1 < m_state->num_levels &&
+           (Index_type(1) << (2 * (level + 1))) <= n) {
+      ++level;
+    }
+    return m_state->best[level];
+  }
+
+  //! smallest loop size for which policy is selected, or -1 if never
+  Index_type threshold(int policy) const
+  {
+    calibrate();
+    for (int level = 0; level < m_state->num_levels; ++level) {
+      if (m_state->best[level] == policy) {
+        return Index_type(1) << (2 * level);
+      }
+    }
+    return -1;
+  }
+
+  template <typename Iterable>
+  int operator()(Iterable&& iter) const
+  {
+    using std::begin;
+    using std::end;
+    using std::distance;
+    return policy_for(
+        static_cast<Index_type>(distance(begin(iter), end(iter))));
+  }
+
+private:
+  struct State {
+    std::once_flag once;
+    int num_levels = 1;
+    int best[max_levels] = {};
+  };
+
+  void run_calibration() const
+  {
+    using timer_type = double (*)(Index_type);
+    const timer_type timers[] = {&detail::adaptive_time_policy<Policies>...};
+    for (int level = 0; level < m_state->num_levels; ++level) {
+      const Index_type n = Index_type(1) << (2 * level);
+      double best_time = 0.0;
+      for (int p = 0; p < static_cast<int>(sizeof...(Policies)); ++p) {
+        const double t = timers[p](n);
+        if (p == 0 || t < best_time) {
+          best_time = t;
+          m_state->best[level] = p;
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<State> m_state;
+};
+
+/// make_adaptive_multi_policy - Construct a MultiPolicy that selects from
+/// Policies by loop size, with thresholds calibrated on the first loop run
+///
+/// \tparam Policies list of policies, 0 to N-1
+/// \param max_size largest loop size calibrated, larger loops use the
+/// policy selected for it
+/// \return A MultiPolicy with an AdaptivePolicySelector
+template <typename... Policies>
+auto make_adaptive_multi_policy(Index_type max_size = Index_type(1) << 20)
+    -> MultiPolicy<AdaptivePolicySelector<Policies...>, Policies...>
+{
+  return MultiPolicy<AdaptivePolicySelector<Policies...>, Policies...>(
+      AdaptivePolicySelector<Policies...>(max_size), Policies{}...);
+}
+
+/// make_adaptive_multi_policy - Construct a MultiPolicy from a selector,
+/// e.g. one calibrated at startup whose thresholds have been inspected
+///
+/// \param s selector, copies share its calibration
+/// \return A MultiPolicy with the selector s
+template <typename... Policies>
+auto make_adaptive_multi_policy(AdaptivePolicySelector<Policies...> s)
+    -> MultiPolicy<AdaptivePolicySelector<Policies...>, Policies...>
+{
+  return MultiPolicy<AdaptivePolicySelector<Policies...>, Policies...>(
+      s, Policies{}...);
+}
+
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,262 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the forall policy that checkpoints the outputs
+ *          of each chunk of a loop and re-executes only the chunks that
+ *          faulted.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_FaultTolerance_HPP
+#define RAJA_FaultTolerance_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <csignal>
+#include <cstddef>
+#include <type_traits>
+
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace ft
+{
+
+/*!
+ * \brief Fault status of the chunk ft_exec is running.
+ *
+ * A signal handler or error detector sets it to a positive value when a
+ * recoverable fault occurs and to a negative value when the fault can not
+ * be recovered from. ft_exec clears it before each chunk and checks it
+ * once the chunk has finished.
+ */
+inline volatile std::sig_atomic_t& fault_status()
+{
+  static volatile std::sig_atomic_t status = 0;
+  return status;
+}
+
+}  // namespace ft
+
+namespace policy
+{
+namespace ft
+{
+
+/*!
+ * \brief forall execution policy that runs a loop in chunks of ChunkSize
+ *        iterations with InnerPolicy.
+ *
+ * The outputs listed in a RAJA::expt::Checkpoint param are copied into a
+ * pool buffer before each chunk runs. When RAJA::ft::fault_status() is set
+ * after a chunk, its outputs are restored and only that chunk runs again,
+ * so a fault late in a long loop costs one chunk instead of the whole loop.
+ * Without a Checkpoint param the loop body must be idempotent.
+ *
+ * The policy is an InnerPolicy, so it has its back-end, platform and
+ * resource type. The resource is waited on after each chunk.
+ */
+template <typename InnerPolicy, size_t ChunkSize>
+struct ft_exec : public InnerPolicy {
+  static_assert(ChunkSize > 0, "ft_exec chunk size must be positive");
+  using inner_policy = InnerPolicy;
+  static constexpr size_t chunk_size = ChunkSize;
+};
+
+namespace detail
+{
+
+//! pool the checkpoints of outputs accessed through Resource come from
+template <typename Resource>
+struct checkpoint_pool {
+  using type = basic_mempool::MemPool<basic_mempool::generic_allocator>;
+};
+
+#if defined(RAJA_ENABLE_CUDA)
+template <>
+struct checkpoint_pool<resources::Cuda> {
+  using type = ::RAJA::cuda::device_mempool_type;
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template <>
+struct checkpoint_pool<resources::Hip> {
+  using type = ::RAJA::hip::device_mempool_type;
+};
+#endif
+
+//! the bytes of one output a chunk writes
+struct ChunkRange {
+  char* data;
+  size_t bytes;
+};
+
+template <typename Output, typename IdxT>
+RAJA_INLINE ChunkRange checkpoint_range(Output const& output,
+                                        IdxT first,
+                                        IdxT last)
+{
+  auto* lo = expt::detail::element_address(output, first);
+  auto* hi = expt::detail::element_address(output, last);
+  if (hi < lo) {
+    std::swap(lo, hi);
+  }
+  return ChunkRange{const_cast<char*>(reinterpret_cast<char const*>(lo)),
+                    static_cast<size_t>(hi - lo + 1) * sizeof(*lo)};
+}
+
+template <typename... Outputs, camp::idx_t... Seq, typename IdxT>
+RAJA_INLINE std::array<ChunkRange, sizeof...(Outputs)> checkpoint_ranges(
+    camp::tuple<Outputs...> const& outputs,
+    camp::idx_seq<Seq...>,
+    IdxT first,
+    IdxT last)
+{
+  return {{checkpoint_range(camp::get<Seq>(outputs), first, last)...}};
+}
+
+//! outputs of the Checkpoint param of a pack, none for an empty pack
+RAJA_INLINE camp::tuple<> checkpoint_outputs(expt::ForallParamPack<> const&)
+{
+  return camp::tuple<>{};
+}
+
+template <typename... Outputs>
+RAJA_INLINE camp::tuple<Outputs...> const& checkpoint_outputs(
+    expt::ForallParamPack<expt::detail::Checkpoint<Outputs...>> const& f_params)
+{
+  return camp::get<0>(f_params.param_tup).outputs;
+}
+
+}  // namespace detail
+
+template <typename Resource,
+          typename InnerPolicy,
+          size_t ChunkSize,
+          typename Iterable,
+          typename Func,
+          typename ForallParam>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(
+    Resource res,
+    const ft_exec<InnerPolicy, ChunkSize>& pol,
+    Iterable&& iter,
+    Func&& body,
+    ForallParam f_params)
+{
+  using pool = typename detail::checkpoint_pool<Resource>::type;
+
+  auto const& outputs = detail::checkpoint_outputs(f_params);
+  using outputs_type = camp::decay<decltype(outputs)>;
+  constexpr size_t num_outputs = camp::tuple_size<outputs_type>::value;
+
+  volatile std::sig_atomic_t& status = ::RAJA::ft::fault_status();
+
+  char* buffer = nullptr;
+  size_t buffer_bytes = 0;
+
+  using value_type = typename camp::decay<Iterable>::value_type;
+  using diff_type = decltype(iter.size());
+
+  diff_type const len = iter.size();
+  for (diff_type off = 0; off < len;
+       off += static_cast<diff_type>(ChunkSize)) {
+    auto chunk = iter.slice(static_cast<value_type>(off),
+                            static_cast<diff_type>(ChunkSize));
+
+    auto ranges = detail::checkpoint_ranges(
+        outputs, camp::make_idx_seq_t<num_outputs>{}, *chunk.begin(),
+        *(chunk.end() - 1));
+
+    size_t bytes = 0;
+    for (size_t o = 0; o < num_outputs; ++o) {
+      bytes += ranges[o].bytes;
+    }
+    if (bytes > buffer_bytes) {
+      if (buffer != nullptr) {
+        pool::getInstance().free(buffer);
+      }
+      buffer = pool::getInstance().template malloc<char>(bytes);
+      buffer_bytes = bytes;
+    }
+    for (size_t o = 0, b = 0; o < num_outputs; b += ranges[o].bytes, ++o) {
+      res.memcpy(buffer + b, ranges[o].data, ranges[o].bytes);
+    }
+
+    bool faulted;
+    do {
+      status = 0;
+      forall_impl(res,
+                  static_cast<InnerPolicy const&>(pol),
+                  chunk,
+                  body,
+                  expt::get_empty_forall_param_pack());
+      res.wait();
+
+      if (status < 0) {
+        RAJA_ABORT_OR_THROW("Unrecoverable fault in ft_exec chunk");
+      }
+      faulted = status > 0;
+      if (faulted) {
+        for (size_t o = 0, b = 0; o < num_outputs; b += ranges[o].bytes, ++o) {
+          res.memcpy(ranges[o].data, buffer + b, ranges[o].bytes);
+        }
+      }
+    } while (faulted);
+  }
+  status = 0;
+
+  if (buffer != nullptr) {
+    pool::getInstance().free(buffer);
+  }
+
+  return resources::EventProxy<Resource>(res);
+}
+
+}  // namespace ft
+}  // namespace policy
+
+using policy::ft::ft_exec;
+
+namespace type_traits
+{
+
+template <typename Pol>
+struct is_ft_policy : std::false_type {
+};
+
+template <typename InnerPolicy, size_t ChunkSize>
+struct is_ft_policy<ft_exec<InnerPolicy, ChunkSize>> : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
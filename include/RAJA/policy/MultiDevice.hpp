@@ -0,0 +1,75 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the policy that runs a forall over all the
+ *          devices visible to the process.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MultiDevice_HPP
+#define RAJA_MultiDevice_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+namespace multi_device
+{
+
+/*!
+ * \brief forall execution policy that splits the iteration space into one
+ *        contiguous part per visible device and runs each part with
+ *        DevicePolicy on a stream of its device.
+ *
+ * For example, multi_device_exec<cuda_exec<256>> or
+ * multi_device_exec<hip_exec<256>>.  The policy is a DevicePolicy, so it
+ * has its back-end, platform and resource type.  Data placement is left to
+ * the user: the data the loop body accesses must be accessible from every
+ * device, e.g. managed memory, possibly prefetched to the devices that use
+ * each part.  Reductions use forall parameters, e.g. RAJA::expt::Reduce;
+ * the result of each device is combined into the target on the host.
+ */
+template <typename DevicePolicy>
+struct multi_device_exec : public DevicePolicy {
+  using device_policy = DevicePolicy;
+};
+
+}  // namespace multi_device
+}  // namespace policy
+
+using policy::multi_device::multi_device_exec;
+
+namespace type_traits
+{
+
+template <typename Pol>
+struct is_multi_device_policy : std::false_type {
+};
+
+template <typename DevicePolicy>
+struct is_multi_device_policy<multi_device_exec<DevicePolicy>>
+    : std::true_type {
+};
+
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
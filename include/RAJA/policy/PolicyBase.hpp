@@ -22,6 +22,7 @@
 #include "RAJA/util/concepts.hpp"
 
 #include <cstddef>
+#include <type_traits>
 
 namespace RAJA
 {
@@ -36,7 +37,8 @@ enum class Policy {
   cuda,
   hip,
   sycl,
-  tbb
+  tbb,
+  pool
 };
 
 enum class Pattern {
@@ -152,6 +154,27 @@ template <Policy Policy_,
 using make_policy_pattern_platform_t =
     PolicyBaseT<Policy_, Pattern_, Launch::undefined, Platform_, Args...>;
 
+//
+// Memory scopes of atomic operations, an atomic is only atomic with respect
+// to the threads in its scope
+//
+namespace atomic_scope
+{
+
+//! threads in the same block or team
+struct block {
+};
+
+//! threads on the same device
+struct device {
+};
+
+//! all threads in the system including the host and other devices
+struct system {
+};
+
+}  // end namespace atomic_scope
+
 namespace concepts
 {
 
@@ -188,6 +211,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_pool_policy : RAJA::policy_is<Pol, RAJA::Policy::pool> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -206,6 +232,12 @@ struct is_device_exec_policy
     : RAJA::policy_any_of<Pol, RAJA::Policy::cuda, RAJA::Policy::hip> {
 };
 
+//! true for segment iteration policies that run all the segments of an
+//! index set in one kernel launch instead of one launch per segment
+template <typename Pol>
+struct is_fused_segit_policy : std::false_type {
+};
+
 DefineTypeTraitFromConcept(is_execution_policy,
                            RAJA::concepts::ExecutionPolicy);
 
@@ -69,6 +69,14 @@ struct constant_stride_array_of_objects
     : RAJA::make_policy_pattern_t<Policy::undefined,
                                   Pattern::workgroup_storage> {
 };
+/// store an array of pointers to the enqueued objects. The enqueued objects
+/// are stored in a single compact array. The array is not deallocated when
+/// the WorkGroup using it is destroyed, it is kept by the WorkPool and reused
+/// by later instantiations that fit in it.
+struct persistent_ragged_array_of_objects
+    : RAJA::make_policy_pattern_t<Policy::undefined,
+                                  Pattern::workgroup_storage> {
+};
 
 /// Dispatch using function pointers to make indirect function calls
 struct indirect_function_call_dispatch
@@ -119,6 +127,7 @@ using policy::workgroup::reverse_ordered;
 using policy::workgroup::array_of_pointers;
 using policy::workgroup::ragged_array_of_objects;
 using policy::workgroup::constant_stride_array_of_objects;
+using policy::workgroup::persistent_ragged_array_of_objects;
 
 using policy::workgroup::indirect_function_call_dispatch;
 using policy::workgroup::indirect_virtual_function_dispatch;
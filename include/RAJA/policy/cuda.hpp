@@ -31,15 +31,25 @@
     #include "RAJA/policy/cuda/atomic.hpp"
 #endif
 
+#include "RAJA/policy/cuda/atomic_aggregated.hpp"
+#include "RAJA/policy/cuda/atomic_scoped.hpp"
 #include "RAJA/policy/cuda/forall.hpp"
+#include "RAJA/policy/cuda/forall_fused.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/prefetch.hpp"
 #include "RAJA/policy/cuda/reduce.hpp"
+#include "RAJA/policy/cuda/compact.hpp"
+#include "RAJA/policy/cuda/sweep.hpp"
+#include "RAJA/policy/cuda/spmv.hpp"
+#include "RAJA/policy/cuda/child_forall.hpp"
 #include "RAJA/policy/cuda/scan.hpp"
 #include "RAJA/policy/cuda/sort.hpp"
 #include "RAJA/policy/cuda/kernel.hpp"
 #include "RAJA/policy/cuda/synchronize.hpp"
+#include "RAJA/policy/cuda/timer.hpp"
 #include "RAJA/policy/cuda/launch.hpp"
 #include "RAJA/policy/cuda/WorkGroup.hpp"
+#include "RAJA/policy/cuda/WorkQueue.hpp"
 
 #endif  // closing endif for if defined(RAJA_ENABLE_CUDA)
 
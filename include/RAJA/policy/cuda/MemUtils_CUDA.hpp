@@ -23,19 +23,30 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <type_traits>
 #include <unordered_map>
 
 #include "nvToolsExt.h"
 
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/concepts.hpp"
 #include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/resource.hpp"
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/ScratchBuffer.hpp"
+#include "RAJA/util/StagingPool.hpp"
 
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
@@ -50,6 +61,9 @@ namespace cuda
 //! Allocator for pinned memory for use in basic_mempool
 struct PinnedAllocator {
 
+  // memory space reported to plugins
+  static const char* space_name() { return "CudaHostPinned"; }
+
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
@@ -69,6 +83,9 @@ struct PinnedAllocator {
 //! Allocator for device memory for use in basic_mempool
 struct DeviceAllocator {
 
+  // memory space reported to plugins
+  static const char* space_name() { return "Cuda"; }
+
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
@@ -89,6 +106,9 @@ struct DeviceAllocator {
 //  Note: Memory must be zero when returned to mempool
 struct DeviceZeroedAllocator {
 
+  // memory space reported to plugins
+  static const char* space_name() { return "Cuda"; }
+
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
@@ -106,10 +126,267 @@ struct DeviceZeroedAllocator {
   }
 };
 
-using device_mempool_type = basic_mempool::MemPool<DeviceAllocator>;
+/*!
+ * \brief  Device mempool with one pool_t per device, each created when the
+ *         device first allocates from it.
+ *
+ * malloc allocates from the pool of the current device and free gives the
+ * memory back to the pool of the device that allocated it, so work on
+ * several devices never shares arenas. The first device to allocate uses
+ * pool_t::getInstance(), so single device runs use one pool as before and
+ * free them without asking the runtime which device owns the memory.
+ */
+template <typename pool_t>
+class per_device_mempool
+{
+public:
+  using pool_type = pool_t;
+
+  static per_device_mempool& getInstance()
+  {
+    // never destroyed so memory can be freed during static destruction
+    static per_device_mempool* instance = new per_device_mempool;
+    return *instance;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    return pool(device_select::current()).template malloc<T>(nTs, alignment);
+  }
+
+  void free(const void* ptr)
+  {
+    pool_t* only = m_only.load(std::memory_order_acquire);
+    if (only != nullptr) {
+      only->free(ptr);
+      return;
+    }
+    cudaPointerAttributes attr;
+    // the runtime may be unloading at exit, then the memory goes with it
+    if (cudaPointerGetAttributes(&attr, ptr) == cudaSuccess) {
+      pool(attr.device).free(ptr);
+    } else {
+      cudaGetLastError();
+    }
+  }
+
+  //! pool of device, created on first use
+  pool_t& pool(int device)
+  {
+    pool_t* p = m_pools[device].load(std::memory_order_acquire);
+    return p != nullptr ? *p : create(device);
+  }
+
+private:
+  using device_select = ::RAJA::resources::device_select<::RAJA::resources::Cuda>;
+
+  per_device_mempool()
+      : m_pools(new std::atomic<pool_t*>[device_select::num_devices()]),
+        m_only(nullptr),
+        m_num_pools(0)
+  {
+    for (int d = 0; d < device_select::num_devices(); ++d) {
+      m_pools[d].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  pool_t& create(int device)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_lock);
+#else
+    std::lock_guard<std::mutex> lock(m_lock);
+#endif
+    pool_t* p = m_pools[device].load(std::memory_order_relaxed);
+    if (p == nullptr) {
+      // pools are never freed, like pool_t::getInstance()
+      p = m_num_pools == 0 ? &pool_t::getInstance() : pool_t::newInstance();
+      ++m_num_pools;
+      m_only.store(m_num_pools == 1 ? p : nullptr, std::memory_order_release);
+      m_pools[device].store(p, std::memory_order_release);
+    }
+    return *p;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_lock;
+#else
+  std::mutex m_lock;
+#endif
+  std::unique_ptr<std::atomic<pool_t*>[]> m_pools;
+  std::atomic<pool_t*> m_only;
+  int m_num_pools;
+};
+
+#if defined(RAJA_ENABLE_SLAB_MEMPOOL)
+using device_mempool_type =
+    per_device_mempool<basic_mempool::SlabPool<DeviceAllocator>>;
 using device_zeroed_mempool_type =
-    basic_mempool::MemPool<DeviceZeroedAllocator>;
+    per_device_mempool<basic_mempool::SlabPool<DeviceZeroedAllocator>>;
+using pinned_mempool_type = basic_mempool::SlabPool<PinnedAllocator>;
+#else
+using device_mempool_type =
+    per_device_mempool<basic_mempool::MemPool<DeviceAllocator>>;
+using device_zeroed_mempool_type =
+    per_device_mempool<basic_mempool::MemPool<DeviceZeroedAllocator>>;
 using pinned_mempool_type = basic_mempool::MemPool<PinnedAllocator>;
+#endif
+
+//! Allocator for the pinned staging buffers of expt::StagingPool, a type of
+//  its own so staging buffers do not share arenas with the reducers
+struct StagingAllocator {
+
+  // memory space reported to plugins
+  static const char* space_name() { return "CudaHostPinned"; }
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    void* ptr;
+    cudaErrchk(cudaHostAlloc(&ptr, nbytes, cudaHostAllocDefault));
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    cudaErrchk(cudaFreeHost(ptr));
+    return true;
+  }
+};
+
+}  // namespace cuda
+
+namespace expt
+{
+namespace detail
+{
+
+template <>
+struct staging_allocator<resources::Cuda> {
+  using type = ::RAJA::cuda::StagingAllocator;
+};
+
+}  // namespace detail
+}  // namespace expt
+
+namespace cuda
+{
+
+namespace detail
+{
+
+#if defined(RAJA_ENABLE_STREAM_ORDERED_ALLOC) && CUDART_VERSION >= 11020
+//! keep memory freed to the default memory pool of the current device
+//  cached for reuse instead of releasing it at each synchronization
+inline void setup_stream_ordered_pool()
+{
+  static std::unordered_map<int, bool> setup_devices;
+#if defined(RAJA_ENABLE_OPENMP)
+  static omp::mutex setup_mutex;
+  lock_guard<omp::mutex> lock(setup_mutex);
+#endif
+
+  int device = 0;
+  cudaErrchk(cudaGetDevice(&device));
+  if (!setup_devices[device]) {
+    cudaMemPool_t pool;
+    cudaErrchk(cudaDeviceGetDefaultMemPool(&pool, device));
+    uint64_t threshold = UINT64_MAX;
+    cudaErrchk(
+        cudaMemPoolSetAttribute(pool,
+                                cudaMemPoolAttrReleaseThreshold,
+                                &threshold));
+    setup_devices[device] = true;
+  }
+}
+#endif
+
+}  // namespace detail
+
+/*!
+ * \brief  Allocate nTs objects of temporary device memory used by work on
+ *         the stream of res, e.g. scan and sort temporaries.
+ *
+ * With RAJA_ENABLE_STREAM_ORDERED_ALLOC the memory is allocated stream
+ * ordered with cudaMallocAsync from the default memory pool of the current
+ * device, so temporaries on different streams do not serialize on the
+ * device_mempool_type lock and freed memory is reused without a device
+ * synchronization. Otherwise the memory comes from device_mempool_type.
+ */
+template <typename T>
+inline T* temp_malloc(::RAJA::resources::Cuda& res, size_t nTs)
+{
+#if defined(RAJA_ENABLE_STREAM_ORDERED_ALLOC) && CUDART_VERSION >= 11020
+  detail::setup_stream_ordered_pool();
+  void* ptr = nullptr;
+  cudaErrchk(cudaMallocAsync(&ptr, nTs * sizeof(T), res.get_stream()));
+  return static_cast<T*>(ptr);
+#else
+  RAJA_UNUSED_VAR(res);
+  return device_mempool_type::getInstance().template malloc<T>(nTs);
+#endif
+}
+
+/*!
+ * \brief  Free temporary device memory allocated with temp_malloc, after
+ *         the work already enqueued on the stream of res.
+ */
+inline void temp_free(::RAJA::resources::Cuda& res, void* ptr)
+{
+#if defined(RAJA_ENABLE_STREAM_ORDERED_ALLOC) && CUDART_VERSION >= 11020
+  cudaErrchk(cudaFreeAsync(ptr, res.get_stream()));
+#else
+  RAJA_UNUSED_VAR(res);
+  device_mempool_type::getInstance().free(ptr);
+#endif
+}
+
+/*!
+ * \brief  Run a device algorithm of cub with temporary device memory.
+ *
+ * call(d_temp_storage, temp_storage_bytes) is called like the cub
+ * algorithms, first with a null d_temp_storage to query the bytes needed
+ * and then to run. If a RAJA::expt::ScratchBuffer is bound to the stream of
+ * res the memory comes from it, and the query is skipped when a call of the
+ * same type with the same sizes n and m ran with the buffer before.
+ * Otherwise the memory comes from temp_malloc.
+ */
+template <typename Call>
+inline cudaError_t temp_storage_call(::RAJA::resources::Cuda& res,
+                                     Call&& call,
+                                     size_t n,
+                                     size_t m = 0)
+{
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+
+  ::RAJA::expt::detail::ScratchStorage* scratch =
+      ::RAJA::expt::detail::find_scratch(res.get_stream());
+  if (scratch != nullptr) {
+    void const* key =
+        ::RAJA::expt::detail::scratch_key<typename std::decay<Call>::type>();
+    if (!scratch->find(key, n, m, temp_storage_bytes)) {
+      cudaError_t err = call(d_temp_storage, temp_storage_bytes);
+      if (err != cudaSuccess) {
+        return err;
+      }
+      scratch->record(key, n, m, temp_storage_bytes);
+    }
+    d_temp_storage = scratch->reserve(temp_storage_bytes);
+    return call(d_temp_storage, temp_storage_bytes);
+  }
+
+  cudaError_t err = call(d_temp_storage, temp_storage_bytes);
+  if (err != cudaSuccess) {
+    return err;
+  }
+  d_temp_storage = temp_malloc<unsigned char>(res, temp_storage_bytes);
+  err = call(d_temp_storage, temp_storage_bytes);
+  temp_free(res, d_temp_storage);
+  return err;
+}
 
 namespace detail
 {
@@ -120,6 +397,8 @@ struct cudaInfo {
   cuda_dim_t blockDim{0, 0, 0};
   ::RAJA::resources::Cuda res{::RAJA::resources::Cuda::CudaFromStream(0,0)};
   bool setup_reducers = false;
+  //! set by launches that can't combine reducers, like multi_device_exec
+  bool reject_reducers = false;
 #if defined(RAJA_ENABLE_OPENMP)
   cudaInfo* thread_states = nullptr;
   omp::mutex lock;
@@ -156,7 +435,13 @@ extern std::unordered_map<cudaStream_t, bool> g_stream_info_map;
 RAJA_INLINE
 void synchronize_impl(::RAJA::resources::Cuda res)
 {
-  res.wait();
+  // waiting on a stream that is being captured into a graph is an error,
+  // the captured work is synchronized when the graph is replayed instead
+  cudaStreamCaptureStatus status = cudaStreamCaptureStatusNone;
+  cudaErrchk(cudaStreamIsCapturing(res.get_stream(), &status));
+  if (status == cudaStreamCaptureStatusNone) {
+    res.wait();
+  }
 }
 
 }  // namespace detail
@@ -227,6 +512,224 @@ void launch(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, void** ar
   RAJA_UNUSED_VAR(name);
 #endif
   cudaErrchk(cudaLaunchKernel(func, gridDim, blockDim, args, shmem, res.get_stream()));
+  ::RAJA::util::detail::record_launch_geometry(gridDim, blockDim, shmem);
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+  if(name) nvtxRangePop();
+#endif
+  launch(res, async);
+}
+
+/*!
+ * \brief Loop body passed to a kernel as a pointer to a copy of the body in
+ *        device memory, see launch_body_t.
+ *
+ * Kernels privatize their body per thread. Trivially copyable bodies are
+ * called through the pointer. Other bodies, e.g. those holding reducer
+ * objects, are copied from the device copy into each thread, as for bodies
+ * passed as kernel parameters, since reducers combine the values of the
+ * threads in the destructors of those copies.
+ */
+template <typename LOOP_BODY>
+struct StagedBody {
+  const LOOP_BODY* __restrict__ body;
+
+  template <typename... Args>
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Args&&... args) const
+  {
+    (*body)(std::forward<Args>(args)...);
+  }
+
+  //! per thread copy of the pointer
+  struct pointer_privatizer {
+    StagedBody priv;
+
+    RAJA_HOST_DEVICE pointer_privatizer(const StagedBody& o) : priv{o} {}
+
+    RAJA_HOST_DEVICE StagedBody& get_priv() { return priv; }
+  };
+
+  //! per thread copy of the body the pointer points to
+  struct body_privatizer {
+    LOOP_BODY priv;
+
+    RAJA_SUPPRESS_HD_WARN
+    RAJA_HOST_DEVICE body_privatizer(const StagedBody& o) : priv(*o.body) {}
+
+    RAJA_HOST_DEVICE LOOP_BODY& get_priv() { return priv; }
+  };
+
+  using privatizer =
+      typename std::conditional<std::is_trivially_copyable<LOOP_BODY>::value,
+                                pointer_privatizer,
+                                body_privatizer>::type;
+};
+
+/*!
+ * \brief Whether a loop body of type LOOP_BODY is staged in device memory
+ *        rather than passed as a kernel parameter.
+ *
+ * Kernel parameters are limited to 4KB and are copied at every launch, so
+ * with RAJA_CUDA_STAGED_BODY_BYTES set bodies of at least that many bytes,
+ * e.g. lambdas capturing many Views, are passed by pointer instead.
+ */
+template <typename LOOP_BODY>
+struct is_staged_body
+    : std::integral_constant<bool,
+                             (RAJA_CUDA_STAGED_BODY_BYTES > 0) &&
+                                 (sizeof(LOOP_BODY) >=
+                                  size_t(RAJA_CUDA_STAGED_BODY_BYTES))> {
+};
+
+//! type of the loop body argument of a kernel launched with launch_body
+template <typename LOOP_BODY>
+using launch_body_t = typename std::conditional<is_staged_body<LOOP_BODY>::value,
+                                                StagedBody<LOOP_BODY>,
+                                                LOOP_BODY>::type;
+
+namespace detail
+{
+
+/*!
+ * \brief Device copies of the staged loop bodies of type LOOP_BODY, one per
+ *        stream.
+ *
+ * A copy is only rewritten on its stream, after the kernels that read it,
+ * and only when the bytes of the body changed since the last launch, so
+ * launching the same lambda again copies nothing. The copies come from
+ * device_mempool_type and are kept for the life of the program.
+ */
+template <typename LOOP_BODY>
+struct staged_body_cache {
+  struct Entry {
+    LOOP_BODY* device = nullptr;
+    bool valid = false;
+    alignas(LOOP_BODY) unsigned char bytes[sizeof(LOOP_BODY)];
+  };
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex lock;
+#endif
+  std::unordered_map<cudaStream_t, Entry> entries;
+
+  static staged_body_cache& getInstance()
+  {
+    static staged_body_cache cache;
+    return cache;
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Launch kernel with body as its first argument followed by args,
+ *        see launch_body_t.
+ */
+template <typename LOOP_BODY, typename... Args>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<is_staged_body<LOOP_BODY>>>
+launch_body(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, size_t shmem,
+            ::RAJA::resources::Cuda res, bool async, LOOP_BODY& body, Args&... args)
+{
+  void* launch_args[] = {(void*)&body, (void*)&args...};
+  launch(func, gridDim, blockDim, launch_args, shmem, res, async);
+}
+
+template <typename LOOP_BODY, typename... Args>
+RAJA_INLINE
+concepts::enable_if<is_staged_body<LOOP_BODY>>
+launch_body(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, size_t shmem,
+            ::RAJA::resources::Cuda res, bool async, LOOP_BODY& body, Args&... args)
+{
+  auto& cache = detail::staged_body_cache<LOOP_BODY>::getInstance();
+  cudaStream_t stream = res.get_stream();
+
+  // held until the kernel is enqueued, so another thread cannot rewrite the
+  // copy between the update and the launch
+#if defined(RAJA_ENABLE_OPENMP)
+  lock_guard<omp::mutex> lock(cache.lock);
+#endif
+  auto& entry = cache.entries[stream];
+  if (entry.device == nullptr) {
+    entry.device =
+        device_mempool_type::getInstance().template malloc<LOOP_BODY>(1);
+  }
+  if (!entry.valid ||
+      std::memcmp(entry.bytes, (const void*)&body, sizeof(LOOP_BODY)) != 0) {
+    std::memcpy(entry.bytes, (const void*)&body, sizeof(LOOP_BODY));
+    entry.valid = true;
+    cudaErrchk(cudaMemcpyAsync(entry.device, entry.bytes, sizeof(LOOP_BODY),
+                               cudaMemcpyHostToDevice, stream));
+  }
+
+  StagedBody<LOOP_BODY> staged{entry.device};
+  void* launch_args[] = {(void*)&staged, (void*)&args...};
+  launch(func, gridDim, blockDim, launch_args, shmem, res, async);
+}
+
+//! Launch kernel with thread block clusters of clusterDim blocks
+RAJA_INLINE
+void launch_cluster(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, cuda_dim_t clusterDim,
+                    void** args, size_t shmem, ::RAJA::resources::Cuda res, bool async = true,
+                    const char *name = nullptr)
+{
+  if (clusterDim.x * clusterDim.y * clusterDim.z == 1) {
+    launch(func, gridDim, blockDim, args, shmem, res, async, name);
+    return;
+  }
+  if (gridDim.x % clusterDim.x != 0 || gridDim.y % clusterDim.y != 0 ||
+      gridDim.z % clusterDim.z != 0) {
+    RAJA_ABORT_OR_THROW("Teams must be a multiple of the cluster size.");
+  }
+#if defined(CUDART_VERSION) && CUDART_VERSION >= 11080
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+  if(name) nvtxRangePushA(name);
+#else
+  RAJA_UNUSED_VAR(name);
+#endif
+  cudaLaunchAttribute attr;
+  attr.id = cudaLaunchAttributeClusterDimension;
+  attr.val.clusterDim.x = clusterDim.x;
+  attr.val.clusterDim.y = clusterDim.y;
+  attr.val.clusterDim.z = clusterDim.z;
+
+  cudaLaunchConfig_t config = {};
+  config.gridDim = gridDim;
+  config.blockDim = blockDim;
+  config.dynamicSmemBytes = shmem;
+  config.stream = res.get_stream();
+  config.attrs = &attr;
+  config.numAttrs = 1;
+
+  cudaErrchk(cudaLaunchKernelExC(&config, func, args));
+  ::RAJA::util::detail::record_launch_geometry(gridDim, blockDim, shmem);
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+  if(name) nvtxRangePop();
+#endif
+  launch(res, async);
+#else
+  RAJA_UNUSED_VAR(func);
+  RAJA_UNUSED_VAR(args);
+  RAJA_UNUSED_VAR(shmem);
+  RAJA_UNUSED_VAR(res);
+  RAJA_UNUSED_VAR(async);
+  RAJA_UNUSED_VAR(name);
+  RAJA_ABORT_OR_THROW("Thread block clusters require CUDA 11.8 or newer.");
+#endif
+}
+
+//! Launch kernel cooperatively so the grid may synchronize
+RAJA_INLINE
+void launch_cooperative(const void* func, cuda_dim_t gridDim, cuda_dim_t blockDim, void** args, size_t shmem,
+                        ::RAJA::resources::Cuda res, bool async = true, const char *name = nullptr)
+{
+#if defined(RAJA_ENABLE_NV_TOOLS_EXT)
+  if(name) nvtxRangePushA(name);
+#else
+  RAJA_UNUSED_VAR(name);
+#endif
+  cudaErrchk(cudaLaunchCooperativeKernel(func, gridDim, blockDim, args, shmem, res.get_stream()));
+  ::RAJA::util::detail::record_launch_geometry(gridDim, blockDim, shmem);
 #if defined(RAJA_ENABLE_NV_TOOLS_EXT)
   if(name) nvtxRangePop();
 #endif
@@ -239,7 +742,14 @@ void peekAtLastError() { cudaErrchk(cudaPeekAtLastError()); }
 
 //! query whether reducers in this thread should setup for device execution now
 RAJA_INLINE
-bool setupReducers() { return detail::tl_status.setup_reducers; }
+bool setupReducers()
+{
+  if (detail::tl_status.setup_reducers && detail::tl_status.reject_reducers) {
+    RAJA_ABORT_OR_THROW("Reducer objects are not supported by this launch, "
+                        "use RAJA::expt::Reduce instead.");
+  }
+  return detail::tl_status.setup_reducers;
+}
 
 //! get gridDim of current launch
 RAJA_INLINE
@@ -253,6 +763,40 @@ cuda_dim_t currentBlockDim() { return detail::tl_status.blockDim; }
 RAJA_INLINE
 ::RAJA::resources::Cuda currentResource() { return detail::tl_status.res; }
 
+/*!
+ * \brief  mempool interface for the buffers of reducers, taken from a per
+ *         thread StreamCache of pool_t keyed by the stream of the current
+ *         launch, so building reducers for repeated launches on a stream
+ *         reuses their buffers without taking the pool lock.
+ */
+template <typename pool_t>
+struct launch_stream_cache {
+  using cache_type = basic_mempool::StreamCache<pool_t, cudaStream_t>;
+
+  static launch_stream_cache& getInstance()
+  {
+    static launch_stream_cache instance;
+    return instance;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs)
+  {
+    return cache_type::getInstance().template malloc<T>(
+        currentResource().get_stream(), nTs);
+  }
+
+  void free(const void* ptr) { cache_type::getInstance().free(ptr); }
+};
+
+using device_reducer_mempool_type = launch_stream_cache<device_mempool_type>;
+using device_zeroed_reducer_mempool_type =
+    launch_stream_cache<device_zeroed_mempool_type>;
+
+//! per thread cache of pinned memory keyed by stream
+using pinned_stream_cache_type =
+    basic_mempool::StreamCache<pinned_mempool_type, cudaStream_t>;
+
 //! create copy of loop_body that is setup for device execution
 template <typename LOOP_BODY>
 RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body(
@@ -291,8 +835,172 @@ cudaDeviceProp& device_prop()
   return prop;
 }
 
+namespace detail
+{
+
+//! block size of forall loops with cuda_exec_rt policies, 0 for the
+//! maximum block size of each policy
+inline std::atomic<size_t>& exec_block_size_setting()
+{
+  static std::atomic<size_t> block_size{[] {
+    const char* env = std::getenv("RAJA_CUDA_BLOCK_SIZE");
+    return env ? static_cast<size_t>(std::strtoul(env, nullptr, 10))
+               : size_t(0);
+  }()};
+  return block_size;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Set the block size of forall loops with cuda_exec_rt policies.
+ *
+ * The block size of a policy is capped at its MAX_BLOCK_SIZE and rounded
+ * down to whole warps, 0 selects MAX_BLOCK_SIZE. The initial value is read
+ * from the RAJA_CUDA_BLOCK_SIZE environment variable.
+ */
+RAJA_INLINE
+void set_exec_block_size(size_t block_size)
+{
+  detail::exec_block_size_setting().store(block_size);
+}
+
+//! block size set for forall loops with cuda_exec_rt policies
+RAJA_INLINE
+size_t get_exec_block_size()
+{
+  return detail::exec_block_size_setting().load();
+}
+
+//! block size of forall loops with a cuda_exec_rt policy with MaxBlockSize
+template <size_t MaxBlockSize>
+RAJA_INLINE size_t exec_block_size()
+{
+  size_t block_size = get_exec_block_size();
+  if (block_size == 0 || block_size > MaxBlockSize) {
+    block_size = MaxBlockSize;
+  }
+  size_t const warp = static_cast<size_t>(policy::cuda::WARP_SIZE);
+  if (block_size > warp) {
+    block_size -= block_size % warp;
+  }
+  return block_size;
+}
+
 }  // namespace cuda
 
+namespace internal
+{
+
+/*!
+ * Cache of occupancy calculator results of one kernel, keyed by the shared
+ * memory size and the number of threads.
+ *
+ * Lookups are lock free. A slot is claimed once with a compare and swap,
+ * filled and then published by storing its key, and never changes again, so
+ * a reader that sees the key also sees the values. When all slots are used
+ * the calculator is called without caching.
+ */
+template < typename Value, size_t num_slots = 8 >
+struct CudaOccupancyCache
+{
+  static constexpr unsigned long long empty_key = 0ull;
+  static constexpr unsigned long long claimed_key = ~0ull;
+
+  std::atomic<unsigned long long> keys[num_slots];
+  Value values[num_slots];
+
+  static unsigned long long make_key(int shmem_size, size_t num_threads)
+  {
+    return ((static_cast<unsigned long long>(shmem_size) + 1ull) << 32) |
+           static_cast<unsigned long long>(num_threads & 0xffffffffu);
+  }
+
+  template < typename Query >
+  Value get(int shmem_size, size_t num_threads, Query&& query)
+  {
+    const unsigned long long key = make_key(shmem_size, num_threads);
+
+    for (size_t i = 0; i < num_slots; ++i) {
+
+      unsigned long long slot_key = keys[i].load(std::memory_order_acquire);
+
+      if (slot_key == key) {
+        return values[i];
+      }
+
+      if (slot_key == empty_key &&
+          keys[i].compare_exchange_strong(slot_key, claimed_key,
+                                          std::memory_order_relaxed)) {
+        values[i] = query();
+        keys[i].store(key, std::memory_order_release);
+        return values[i];
+      }
+
+    }
+
+    return query();
+  }
+};
+
+struct CudaOccMaxBlocksThreadsData
+{
+  int max_blocks;
+  int max_threads;
+};
+
+template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
+RAJA_INLINE
+void cuda_occupancy_max_blocks_threads(Func&& func, int shmem_size,
+                                       size_t &max_blocks, size_t &max_threads)
+{
+  static CudaOccupancyCache<CudaOccMaxBlocksThreadsData> cache;
+
+  CudaOccMaxBlocksThreadsData data = cache.get(shmem_size, 0, [&]() {
+
+    CudaOccMaxBlocksThreadsData result;
+    cudaErrchk(cudaOccupancyMaxPotentialBlockSize(
+        &result.max_blocks, &result.max_threads, func, shmem_size));
+    return result;
+
+  });
+
+  max_blocks  = data.max_blocks;
+  max_threads = data.max_threads;
+
+}
+
+template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
+RAJA_INLINE
+void cuda_occupancy_max_blocks(Func&& func, int shmem_size,
+                               size_t &max_blocks, size_t num_threads)
+{
+  static CudaOccupancyCache<size_t> cache;
+
+  max_blocks = cache.get(shmem_size, num_threads, [&]() {
+
+    int blocks_per_sm = 0;
+    cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks_per_sm, func, static_cast<int>(num_threads), shmem_size));
+
+    return static_cast<size_t>(blocks_per_sm) *
+           cuda::device_prop().multiProcessorCount;
+
+  });
+
+}
+
+template < typename UniqueMarker, size_t num_threads, typename Func >
+RAJA_INLINE
+void cuda_occupancy_max_blocks(Func&& func, int shmem_size,
+                               size_t &max_blocks)
+{
+  cuda_occupancy_max_blocks<UniqueMarker>(
+      std::forward<Func>(func), shmem_size, max_blocks, num_threads);
+}
+
+}  // namespace internal
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_CUDA
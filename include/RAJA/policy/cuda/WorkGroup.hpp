@@ -20,5 +20,6 @@
 
 #include "RAJA/policy/cuda/WorkGroup/Dispatcher.hpp"
 #include "RAJA/policy/cuda/WorkGroup/WorkRunner.hpp"
+#include "RAJA/policy/cuda/WorkGroup/WorkGraph.hpp"
 
 #endif  // closing endif for header file include guard
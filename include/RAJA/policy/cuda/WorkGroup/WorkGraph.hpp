@@ -0,0 +1,126 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA WorkGraph class specializations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_cuda_WorkGroup_WorkGraph_HPP
+#define RAJA_cuda_WorkGroup_WorkGraph_HPP
+
+#include "RAJA/config.hpp"
+
+#include <utility>
+
+#include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+
+#include "RAJA/pattern/WorkGroup/WorkGraph.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Captures the kernels launched by a WorkGroup run into a cuda graph
+ * and replays them with a single cudaGraphLaunch.
+ *
+ * Note that capture requires a stream other than the legacy default stream.
+ */
+template < >
+struct WorkGraph<resources::Cuda>
+{
+  static constexpr bool supported = true;
+
+  WorkGraph() = default;
+
+  WorkGraph(WorkGraph const&) = delete;
+  WorkGraph& operator=(WorkGraph const&) = delete;
+
+  WorkGraph(WorkGraph && o)
+    : m_exec(o.m_exec)
+  {
+    o.m_exec = nullptr;
+  }
+  WorkGraph& operator=(WorkGraph && o)
+  {
+    if (this != &o) {
+      clear();
+      m_exec = o.m_exec;
+      o.m_exec = nullptr;
+    }
+    return *this;
+  }
+
+  ///
+  /// capture the work submitted to r by func into a graph and instantiate it
+  /// the work is not executed, returns the value returned by func
+  ///
+  template < typename Func >
+  auto capture(resources::Cuda r, Func&& func) -> decltype(func())
+  {
+    clear();
+
+    cudaStream_t stream = r.get_stream();
+
+    cudaErrchk(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+
+    auto ret = func();
+
+    cudaGraph_t graph;
+    cudaErrchk(cudaStreamEndCapture(stream, &graph));
+    cudaErrchk(cudaGraphInstantiate(&m_exec, graph, nullptr, nullptr, 0));
+    cudaErrchk(cudaGraphDestroy(graph));
+
+    return ret;
+  }
+
+  ///
+  /// launch the captured graph on r
+  ///
+  void replay(resources::Cuda r, bool async) const
+  {
+    if (m_exec == nullptr) {
+      RAJA_ABORT_OR_THROW("WorkGraph: cannot replay, no graph was captured");
+    }
+    cudaErrchk(cudaGraphLaunch(m_exec, r.get_stream()));
+    RAJA::cuda::launch(r, async);
+  }
+
+  // release the instantiated graph
+  void clear()
+  {
+    if (m_exec != nullptr) {
+      cudaErrchk(cudaGraphExecDestroy(m_exec));
+      m_exec = nullptr;
+    }
+  }
+
+  ~WorkGraph()
+  {
+    clear();
+  }
+
+private:
+  cudaGraphExec_t m_exec = nullptr;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
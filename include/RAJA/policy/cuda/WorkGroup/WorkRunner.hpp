@@ -20,6 +20,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
 #include "RAJA/policy/cuda/policy.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 
@@ -151,6 +155,147 @@ struct WorkRunner<
 };
 
 
+/*!
+ * Prefetches the loop storage of a WorkContainer to the device in chunks as
+ * loops are enqueued when the storage is in managed memory, so the transfer
+ * of the storage overlaps with enqueueing the rest of the loops instead of
+ * happening on demand when the kernel runs.
+ * Storage in other kinds of memory is left alone, pinned memory is read by
+ * the device directly.
+ */
+struct CudaStoragePrefetcher
+{
+  // prefetch in chunks of this many bytes, a chunk is prefetched once the
+  // storage has grown past its end so later enqueues do not touch it
+  static constexpr size_t chunk_size = 64*1024;
+
+  CudaStoragePrefetcher() = default;
+
+  CudaStoragePrefetcher(CudaStoragePrefetcher const&) = delete;
+  CudaStoragePrefetcher& operator=(CudaStoragePrefetcher const&) = delete;
+
+  CudaStoragePrefetcher(CudaStoragePrefetcher && o)
+    : m_array_begin(o.m_array_begin)
+    , m_prefetched_end(o.m_prefetched_end)
+    , m_managed(o.m_managed)
+  {
+    o.clear();
+  }
+  CudaStoragePrefetcher& operator=(CudaStoragePrefetcher && o)
+  {
+    m_array_begin = o.m_array_begin;
+    m_prefetched_end = o.m_prefetched_end;
+    m_managed = o.m_managed;
+
+    o.clear();
+    return *this;
+  }
+
+  // prefetch the full chunks of storage that were not prefetched already
+  template < typename WorkContainer >
+  void enqueued(WorkContainer const& storage)
+  {
+    const char* array_begin = nullptr;
+    const char* array_end = nullptr;
+    if (!get_array(storage, array_begin, array_end)) {
+      return;
+    }
+
+    if (array_begin != m_array_begin) {
+      // the storage was reallocated, start over with the new array
+      m_array_begin = array_begin;
+      m_prefetched_end = array_begin;
+      m_managed = is_managed(array_begin);
+    }
+
+    if (m_managed) {
+      const char* chunk_end = reinterpret_cast<const char*>(
+          reinterpret_cast<uintptr_t>(array_end) & ~(uintptr_t(chunk_size) - 1));
+      if (chunk_end > m_prefetched_end &&
+          static_cast<size_t>(chunk_end - m_prefetched_end) >= chunk_size) {
+        prefetch(m_prefetched_end, chunk_end, resources::Cuda::get_default());
+        m_prefetched_end = chunk_end;
+      }
+    }
+  }
+
+  // prefetch the rest of the storage on r before the storage is used by
+  // a kernel on r
+  template < typename WorkContainer >
+  void finish(WorkContainer const& storage, resources::Cuda r) const
+  {
+    const char* array_begin = nullptr;
+    const char* array_end = nullptr;
+    if (!get_array(storage, array_begin, array_end)) {
+      return;
+    }
+
+    if (array_begin != m_array_begin) {
+      if (is_managed(array_begin)) {
+        prefetch(array_begin, array_end, r);
+      }
+    } else if (m_managed && array_end > m_prefetched_end) {
+      prefetch(m_prefetched_end, array_end, r);
+    }
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_array_begin = nullptr;
+    m_prefetched_end = nullptr;
+    m_managed = false;
+  }
+
+private:
+  const char* m_array_begin = nullptr;
+  const char* m_prefetched_end = nullptr;
+  bool m_managed = false;
+
+  // get the contiguous array of bytes used by storage
+  // returns false if storage is empty or not contiguous
+  template < typename WorkContainer >
+  static bool get_array(WorkContainer const& storage,
+                        const char*& array_begin, const char*& array_end)
+  {
+    if (std::is_same<typename WorkContainer::storage_policy,
+                     RAJA::array_of_pointers>::value ||
+        storage.size() == 0) {
+      return false;
+    }
+    array_begin = reinterpret_cast<const char*>(&*storage.begin());
+    array_end = array_begin + storage.storage_size();
+    return true;
+  }
+
+  // check if ptr is in managed memory that can be prefetched
+  static bool is_managed(const char* ptr)
+  {
+    cudaPointerAttributes attributes;
+    if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+      cudaGetLastError(); // clear the error from non-cuda memory
+      return false;
+    }
+    if (attributes.type != cudaMemoryTypeManaged) {
+      return false;
+    }
+    int concurrent_managed_access = 0;
+    cudaErrchk(cudaDeviceGetAttribute(&concurrent_managed_access,
+                                      cudaDevAttrConcurrentManagedAccess,
+                                      attributes.device));
+    return concurrent_managed_access != 0;
+  }
+
+  static void prefetch(const char* begin, const char* end, resources::Cuda r)
+  {
+    int device = -1;
+    cudaErrchk(cudaGetDevice(&device));
+    cudaErrchk(cudaMemPrefetchAsync(begin, static_cast<size_t>(end - begin),
+                                    device, r.get_stream()));
+  }
+};
+
+
 /*!
  * A body and segment holder for storing loops that will be executed
  * on the device
@@ -255,12 +400,14 @@ struct WorkRunner<
 
   WorkRunner(WorkRunner && o)
     : m_total_iterations(o.m_total_iterations)
+    , m_prefetcher(std::move(o.m_prefetcher))
   {
     o.m_total_iterations = 0;
   }
   WorkRunner& operator=(WorkRunner && o)
   {
     m_total_iterations = o.m_total_iterations;
+    m_prefetcher = std::move(o.m_prefetcher);
 
     o.m_total_iterations = 0;
     return *this;
@@ -298,6 +445,8 @@ struct WorkRunner<
       storage.template emplace<holder>(
           get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
           std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+
+      m_prefetcher.enqueued(storage);
     }
   }
 
@@ -343,6 +492,11 @@ struct WorkRunner<
       //
       size_t shmem = 0;
 
+      //
+      // Prefetch the rest of the storage
+      //
+      m_prefetcher.finish(storage, r);
+
       {
         //
         // Launch the kernel
@@ -361,10 +515,256 @@ struct WorkRunner<
   void clear()
   {
     m_total_iterations = 0;
+    m_prefetcher.clear();
   }
 
 private:
   index_type m_total_iterations = 0;
+  CudaStoragePrefetcher m_prefetcher;
+};
+
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * on the device with each block running block_size iterations
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldCudaDeviceXBlockLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldCudaDeviceXBlockLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_DEVICE RAJA_INLINE void operator()(index_type loop_block, Args... args) const
+  {
+    const index_type i = threadIdx.x + loop_block * blockDim.x;
+    const auto begin = m_segment.begin();
+    const auto end   = m_segment.end();
+    const index_type len(end - begin);
+    if ( i < len ) {
+      m_body(begin[i], std::forward<Args>(args)...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+template < size_t BLOCK_SIZE,
+           size_t BLOCKS_PER_SM,
+           typename StorageIter,
+           typename value_type,
+           typename index_type,
+           typename ... Args >
+__launch_bounds__(BLOCK_SIZE, BLOCKS_PER_SM) __global__
+    void cuda_unordered_x_block_balanced_global(StorageIter iter,
+                                                const index_type* block_begins,
+                                                index_type num_loops,
+                                                Args... args)
+{
+  const index_type block = blockIdx.x;
+  // find the last loop that begins at or before this block
+  index_type lo = 0;
+  index_type hi = num_loops - 1;
+  while (lo < hi) {
+    const index_type mid = lo + (hi - lo + 1) / 2;
+    if (block_begins[mid] <= block) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  value_type::device_call(&iter[lo], block - block_begins[lo], args...);
+}
+
+
+/*!
+ * Runs work in a storage container out of order with each loop given a
+ * number of cuda blocks in the x direction proportional to its number of
+ * iterates, each block finds its loop with a binary search of the first
+ * block of each loop
+ */
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+        RAJA::policy::cuda::unordered_cuda_loop_x_block_balanced,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>;
+  using order_policy = RAJA::policy::cuda::unordered_cuda_loop_x_block_balanced;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Cuda;
+
+  // The type that will hold the segment and loop body in work storage
+  struct holder_type {
+    template < typename T >
+    using type = HoldCudaDeviceXBlockLoop<
+        typename camp::at<T, camp::num<0>>::type, // ITERABLE
+        typename camp::at<T, camp::num<1>>::type, // LOOP_BODY
+        index_type, Args...>;
+  };
+  ///
+  template < typename T >
+  using holder_type_t = typename holder_type::template type<T>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the device
+  using dispatcher_exec_policy = exec_policy;
+
+  // The Dispatcher policy with holder_types used internally to handle the
+  // ranges and callables passed in by the user.
+  using dispatcher_holder_policy = dispatcher_transform_types_t<dispatch_policy, holder_type>;
+
+  using dispatcher_type = Dispatcher<Platform::cuda, dispatcher_holder_policy, RAJA::cuda_work_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_block_begins(std::move(o.m_block_begins))
+    , m_total_blocks(o.m_total_blocks)
+    , m_prefetcher(std::move(o.m_prefetcher))
+  {
+    o.m_block_begins.clear();
+    o.m_total_blocks = 0;
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_block_begins = std::move(o.m_block_begins);
+    m_total_blocks = o.m_total_blocks;
+    m_prefetcher = std::move(o.m_prefetcher);
+
+    o.m_block_begins.clear();
+    o.m_total_blocks = 0;
+    return *this;
+  }
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using Iterator  = camp::decay<decltype(std::begin(iter))>;
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+    using holder = holder_type_t<camp::list<ITERABLE, LOOP_BODY>>;
+
+    Iterator begin = std::begin(iter);
+    Iterator end = std::end(iter);
+    IndexType len = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (len > 0 && BLOCK_SIZE > 0) {
+
+      constexpr index_type block_size = static_cast<index_type>(BLOCK_SIZE);
+
+      m_block_begins.emplace_back(m_total_blocks);
+      m_total_blocks += (static_cast<index_type>(len) + block_size - 1) / block_size;
+
+      storage.template emplace<holder>(
+          get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+
+      m_prefetcher.enqueued(storage);
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type r, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(storage), std::end(storage)))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    auto func = cuda_unordered_x_block_balanced_global<BLOCK_SIZE, BLOCKS_PER_SM, Iterator, value_type, index_type, Args...>;
+
+    //
+    // Compute the requested iteration space size
+    //
+    Iterator begin = std::begin(storage);
+    Iterator end = std::end(storage);
+    IndexType num_loops = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+
+      //
+      // Compute the number of blocks
+      //
+      cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BLOCK_SIZE), 1, 1};
+      cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(m_total_blocks), 1, 1};
+
+      RAJA_FT_BEGIN;
+
+      //
+      // Setup shared memory buffers
+      //
+      size_t shmem = 0;
+
+      //
+      // Prefetch the rest of the storage
+      //
+      m_prefetcher.finish(storage, r);
+
+      //
+      // Copy the first block of each loop to the device
+      //
+      index_type loops = static_cast<index_type>(num_loops);
+      index_type* block_begins =
+          RAJA::cuda::temp_malloc<index_type>(r, m_block_begins.size());
+      r.memcpy(block_begins, m_block_begins.data(),
+               m_block_begins.size() * sizeof(index_type));
+
+      {
+        //
+        // Launch the kernel
+        //
+        void* func_args[] = { (void*)&begin, (void*)&block_begins, (void*)&loops, (void*)&args... };
+        RAJA::cuda::launch((const void*)func, gridSize, blockSize, func_args, shmem, r, Async);
+      }
+
+      RAJA::cuda::temp_free(r, block_begins);
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_block_begins.clear();
+    m_total_blocks = 0;
+    m_prefetcher.clear();
+  }
+
+private:
+  std::vector<index_type> m_block_begins;
+  index_type m_total_blocks = 0;
+  CudaStoragePrefetcher m_prefetcher;
 };
 
 
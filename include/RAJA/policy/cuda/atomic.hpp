@@ -304,6 +304,40 @@ RAJA_INLINE __device__ unsigned long long cuda_atomicMin<unsigned long long>(
 }
 #endif
 
+/*
+ * Floating point atomicMin and atomicMax use integer atomics instead of CAS
+ * loops: non-negative values order like their bits as signed integers and
+ * negative values order in reverse like their bits as unsigned integers.
+ * The result with NaN values is unspecified.
+ */
+
+// 32-bit float atomicMin via 32-bit integer atomics
+#if __CUDA_ARCH__ >= 200
+template <>
+RAJA_INLINE __device__ float cuda_atomicMin<float>(float volatile *acc,
+                                              float value)
+{
+  return __float_as_int(value) < 0
+      ? __uint_as_float(::atomicMax((unsigned *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMin((int *)acc, __float_as_int(value)));
+}
+#endif
+
+// 64-bit double atomicMin via 64-bit integer atomics, sm_35 and later
+#if __CUDA_ARCH__ >= 350
+template <>
+RAJA_INLINE __device__ double cuda_atomicMin<double>(double volatile *acc,
+                                                double value)
+{
+  long long bits = __double_as_longlong(value);
+  return bits < 0
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMax((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(::atomicMin((long long *)acc, bits));
+}
+#endif
+
 #if __CUDA_ARCH__ >= 200
 template <typename T>
 RAJA_INLINE __device__ T cuda_atomicMax(T volatile *acc, T value)
@@ -342,6 +376,33 @@ RAJA_INLINE __device__ unsigned long long cuda_atomicMax<unsigned long long>(
 }
 #endif
 
+// 32-bit float atomicMax via 32-bit integer atomics
+#if __CUDA_ARCH__ >= 200
+template <>
+RAJA_INLINE __device__ float cuda_atomicMax<float>(float volatile *acc,
+                                              float value)
+{
+  return __float_as_int(value) < 0
+      ? __uint_as_float(::atomicMin((unsigned *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMax((int *)acc, __float_as_int(value)));
+}
+#endif
+
+// 64-bit double atomicMax via 64-bit integer atomics, sm_35 and later
+#if __CUDA_ARCH__ >= 350
+template <>
+RAJA_INLINE __device__ double cuda_atomicMax<double>(double volatile *acc,
+                                                double value)
+{
+  long long bits = __double_as_longlong(value);
+  return bits < 0
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMin((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(::atomicMax((long long *)acc, bits));
+}
+#endif
+
 #if __CUDA_ARCH__ >= 200
 template <typename T>
 RAJA_INLINE __device__ T cuda_atomicInc(T volatile *acc, T val)
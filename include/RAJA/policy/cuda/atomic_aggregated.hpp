@@ -0,0 +1,332 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining warp aggregated atomic operations for
+ *          CUDA
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_atomic_aggregated_HPP
+#define RAJA_policy_cuda_atomic_aggregated_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <type_traits>
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+#include "RAJA/policy/desul/atomic.hpp"
+#else
+#include "RAJA/policy/cuda/atomic.hpp"
+#endif
+
+#include "RAJA/policy/cuda/policy.hpp"
+
+#include "RAJA/pattern/atomic.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+
+namespace detail
+{
+
+// Aggregation uses __match_any_sync which requires sm_70 or greater, lower
+// architectures perform the atomics of each thread.
+#if __CUDA_ARCH__ >= 700
+
+/*!
+ * Returns the mask of the lanes in the warp below the calling lane.
+ */
+RAJA_INLINE __device__ unsigned cuda_lanemask_lt()
+{
+  unsigned mask;
+  asm("mov.u32 %0, %%lanemask_lt;" : "=r"(mask));
+  return mask;
+}
+
+/*!
+ * Returns the lane of the n-th (0 based) set bit of mask.
+ */
+RAJA_INLINE __device__ int cuda_nth_set_lane(unsigned mask, int n)
+{
+  int lane = 0;
+  for (int width = 16; width > 0; width /= 2) {
+    const int count = __popc((mask >> lane) & ((1u << width) - 1u));
+    if (n >= count) {
+      n -= count;
+      lane += width;
+    }
+  }
+  return lane;
+}
+
+/*!
+ * Aggregated atomic implementation.
+ * The active threads in the warp that use the same acc are grouped, their
+ * values are combined with combine, and the last thread of each group
+ * performs the atomic with the combined value.
+ * Each thread returns the value it would have seen if the threads of its
+ * group had performed their atomics in lane order, apply computes that value
+ * from the value returned by the atomic and the combined values of the lower
+ * lanes of the group.
+ */
+template <typename T, typename Combine, typename Apply, typename Atomic>
+RAJA_INLINE __device__ T cuda_atomic_aggregate(T volatile *acc,
+                                               T value,
+                                               Combine combine,
+                                               Apply apply,
+                                               Atomic atomic)
+{
+  const unsigned active = __activemask();
+  const unsigned peers = __match_any_sync(
+      active, reinterpret_cast<unsigned long long>(acc));
+  const int rank = __popc(peers & cuda_lanemask_lt());
+  const int num_peers = __popc(peers);
+
+  // inclusive scan of the values of the group in lane order
+  T inclusive = value;
+  for (int dist = 1; __any_sync(active, dist < num_peers); dist *= 2) {
+    const int src_rank = rank - dist;
+    const int src = cuda_nth_set_lane(peers, src_rank >= 0 ? src_rank : rank);
+    const T other = __shfl_sync(active, inclusive, src);
+    if (src_rank >= 0) {
+      inclusive = combine(other, inclusive);
+    }
+  }
+
+  const T exclusive = __shfl_sync(
+      active, inclusive, cuda_nth_set_lane(peers, rank > 0 ? rank - 1 : 0));
+
+  T old = inclusive;
+  if (rank == num_peers - 1) {
+    old = atomic(acc, inclusive);
+  }
+  old = __shfl_sync(active, old, cuda_nth_set_lane(peers, num_peers - 1));
+
+  return rank > 0 ? apply(old, exclusive) : old;
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Aggregated atomics combine the operations of the threads in a warp that
+ * target the same address, which reduces the number of atomics performed
+ * on highly contended addresses. Operations that can not be combined
+ * perform the atomic of each thread.
+ *
+ * These are atomic in cuda device code and use the host_policy otherwise
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::plus<T>{}, operators::plus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicAdd(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicAdd(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::plus<T>{}, operators::minus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicSub(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicSub(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::minimum<T>{}, operators::minimum<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicMin(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicMin(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::maximum<T>{}, operators::maximum<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicMax(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicMax(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T val)
+{
+  // wrapping increments can not be combined
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, T(1),
+      operators::plus<T>{}, operators::plus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicAdd(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T val)
+{
+  // wrapping decrements can not be combined
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, T(1),
+      operators::plus<T>{}, operators::minus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicSub(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::bit_and<T>{}, operators::bit_and<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicAnd(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicAnd(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::bit_or<T>{}, operators::bit_or<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicOr(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicOr(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 700
+  return detail::cuda_atomic_aggregate(acc, value,
+      operators::bit_xor<T>{}, operators::bit_xor<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicXor(cuda_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicXor(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(cuda_atomic_aggregated_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(cuda_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+
+namespace detail
+{
+
+// reserve with the aggregated atomics so threads in a warp reserving from
+// the same counter perform one atomic and get offsets in lane order
+template <typename host_policy>
+struct atomic_reserve_policy<cuda_atomic_explicit<host_policy>> {
+  using type = cuda_atomic_aggregated_explicit<host_policy>;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_CUDA
+#endif  // guard
@@ -0,0 +1,720 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining scoped atomic operations for CUDA
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_atomic_scoped_HPP
+#define RAJA_policy_cuda_atomic_scoped_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <type_traits>
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+#include "RAJA/policy/desul/atomic.hpp"
+#else
+#include "RAJA/policy/cuda/atomic.hpp"
+#endif
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+
+#include "RAJA/util/TypeConvert.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+
+namespace detail
+{
+
+/*!
+ * Scoped cuda atomic policies use the desul memory scope of their scope
+ */
+template <typename scope, typename host_policy>
+struct desul_policy_scope<cuda_atomic_scoped_explicit<scope, host_policy>>
+    : desul_scope<scope> {
+};
+
+}  // namespace detail
+
+#else
+
+namespace detail
+{
+
+// Block and system scope atomics were added for sm_60, lower architectures
+// use device scope atomics.
+#if __CUDA_ARCH__ >= 600
+
+/*!
+ * CUDA supplied atomics of a RAJA::atomic_scope.
+ * Each function only works for the types supported by the CUDA function.
+ */
+template <typename Scope>
+struct CudaScopedAtomic;
+
+template <>
+struct CudaScopedAtomic<atomic_scope::block> {
+  template <typename T>
+  static RAJA_INLINE __device__ T add(T volatile *acc, T value)
+  {
+    return ::atomicAdd_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T sub(T volatile *acc, T value)
+  {
+    return ::atomicSub_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T min(T volatile *acc, T value)
+  {
+    return ::atomicMin_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T max(T volatile *acc, T value)
+  {
+    return ::atomicMax_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T inc(T volatile *acc, T value)
+  {
+    return ::atomicInc_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T dec(T volatile *acc, T value)
+  {
+    return ::atomicDec_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T bit_and(T volatile *acc, T value)
+  {
+    return ::atomicAnd_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T bit_or(T volatile *acc, T value)
+  {
+    return ::atomicOr_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T bit_xor(T volatile *acc, T value)
+  {
+    return ::atomicXor_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T exchange(T volatile *acc, T value)
+  {
+    return ::atomicExch_block((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T cas(T volatile *acc, T compare, T value)
+  {
+    return ::atomicCAS_block((T *)acc, compare, value);
+  }
+};
+
+template <>
+struct CudaScopedAtomic<atomic_scope::system> {
+  template <typename T>
+  static RAJA_INLINE __device__ T add(T volatile *acc, T value)
+  {
+    return ::atomicAdd_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T sub(T volatile *acc, T value)
+  {
+    return ::atomicSub_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T min(T volatile *acc, T value)
+  {
+    return ::atomicMin_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T max(T volatile *acc, T value)
+  {
+    return ::atomicMax_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T inc(T volatile *acc, T value)
+  {
+    return ::atomicInc_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T dec(T volatile *acc, T value)
+  {
+    return ::atomicDec_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T bit_and(T volatile *acc, T value)
+  {
+    return ::atomicAnd_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T bit_or(T volatile *acc, T value)
+  {
+    return ::atomicOr_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T bit_xor(T volatile *acc, T value)
+  {
+    return ::atomicXor_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T exchange(T volatile *acc, T value)
+  {
+    return ::atomicExch_system((T *)acc, value);
+  }
+  template <typename T>
+  static RAJA_INLINE __device__ T cas(T volatile *acc, T compare, T value)
+  {
+    return ::atomicCAS_system((T *)acc, compare, value);
+  }
+};
+
+/*!
+ * Type traits for the types supported by the CUDA supplied atomics.
+ */
+template <typename T>
+struct cuda_scoped_atomic_is_int32
+    : std::integral_constant<bool, std::is_same<T, int>::value ||
+                                   std::is_same<T, unsigned>::value> {
+};
+///
+template <typename T>
+struct cuda_scoped_atomic_is_bitwise
+    : std::integral_constant<bool, cuda_scoped_atomic_is_int32<T>::value ||
+                                   std::is_same<T, unsigned long long>::value> {
+};
+///
+template <typename T>
+struct cuda_scoped_atomic_is_minmax
+    : std::integral_constant<bool, cuda_scoped_atomic_is_bitwise<T>::value ||
+                                   std::is_same<T, long long>::value> {
+};
+///
+template <typename T>
+struct cuda_scoped_atomic_is_add
+    : std::integral_constant<bool, cuda_scoped_atomic_is_bitwise<T>::value ||
+                                   std::is_same<T, float>::value ||
+                                   std::is_same<T, double>::value> {
+};
+///
+template <typename T>
+struct cuda_scoped_atomic_is_exchange
+    : std::integral_constant<bool, cuda_scoped_atomic_is_bitwise<T>::value ||
+                                   std::is_same<T, float>::value> {
+};
+
+/*!
+ * Unsigned type used to compare and swap T.
+ */
+template <typename T>
+using cuda_scoped_atomic_uint = typename std::enable_if<
+    sizeof(T) == sizeof(unsigned) || sizeof(T) == sizeof(unsigned long long),
+    typename std::conditional<sizeof(T) == sizeof(unsigned),
+                              unsigned,
+                              unsigned long long>::type>::type;
+
+/*!
+ * Scoped compare and swap of any 32-bit or 64-bit type using the unsigned
+ * 32-bit and 64-bit CUDA supplied CAS.
+ * Returns the value that was stored before this operation.
+ */
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomic_CAS(T volatile *acc,
+                                                T compare,
+                                                T value)
+{
+  using U = cuda_scoped_atomic_uint<T>;
+  return RAJA::util::reinterp_A_as_B<U, T>(
+      CudaScopedAtomic<Scope>::cas((U volatile *)acc,
+          RAJA::util::reinterp_A_as_B<T, U>(compare),
+          RAJA::util::reinterp_A_as_B<T, U>(value)));
+}
+
+/*!
+ * Scoped implementation of any atomic 32-bit or 64-bit operator using
+ * compare and swap.
+ * Returns the OLD value that was replaced by the result of this operation.
+ */
+template <typename Scope, typename T, typename OPER>
+RAJA_INLINE __device__ T cuda_scoped_atomic_CAS_oper(T volatile *acc,
+                                                     OPER const &oper)
+{
+  using U = cuda_scoped_atomic_uint<T>;
+  U oldval, newval, readback;
+  oldval = RAJA::util::reinterp_A_as_B<T, U>(*acc);
+  newval = RAJA::util::reinterp_A_as_B<T, U>(
+      oper(RAJA::util::reinterp_A_as_B<U, T>(oldval)));
+  while ((readback = CudaScopedAtomic<Scope>::cas((U volatile *)acc,
+                                                  oldval, newval)) != oldval) {
+    oldval = readback;
+    newval = RAJA::util::reinterp_A_as_B<T, U>(
+        oper(RAJA::util::reinterp_A_as_B<U, T>(oldval)));
+  }
+  return RAJA::util::reinterp_A_as_B<U, T>(oldval);
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicAdd(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::add(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicAdd(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a + value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicSub(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::sub(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicSub(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a - value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicMin(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::min(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicMin(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return value < a ? value : a;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicMax(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::max(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicMax(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return value > a ? value : a;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicInc(std::true_type, T volatile *acc, T val)
+{
+  return CudaScopedAtomic<Scope>::inc(acc, val);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicInc(std::false_type, T volatile *acc, T val)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T old) {
+    return ((old >= val) ? (T)0 : (old + (T)1));
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicDec(std::true_type, T volatile *acc, T val)
+{
+  return CudaScopedAtomic<Scope>::dec(acc, val);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicDec(std::false_type, T volatile *acc, T val)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T old) {
+    return (((old == (T)0) | (old > val)) ? val : (old - (T)1));
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicAnd(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::bit_and(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicAnd(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a & value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicOr(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::bit_or(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicOr(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a | value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicXor(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::bit_xor(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicXor(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a ^ value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicExchange(std::true_type, T volatile *acc, T value)
+{
+  return CudaScopedAtomic<Scope>::exchange(acc, value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T cuda_scoped_atomicExchange(std::false_type, T volatile *acc, T value)
+{
+  return cuda_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T) {
+    return value;
+  });
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Scoped policies pass off to CUDA's builtin scoped atomics for the types
+ * they support and use compare and swap with the same scope otherwise.
+ *
+ * The device scope policy is the same as cuda_atomic_explicit.
+ *
+ * These are atomic in cuda device code and use the host_policy otherwise
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicAdd(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicAdd<scope>(
+      detail::cuda_scoped_atomic_is_add<T>{}, acc, value);
+#else
+  return RAJA::atomicAdd(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicSub(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicSub<scope>(
+      detail::cuda_scoped_atomic_is_int32<T>{}, acc, value);
+#else
+  return RAJA::atomicSub(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicMin(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicMin<scope>(
+      detail::cuda_scoped_atomic_is_minmax<T>{}, acc, value);
+#else
+  return RAJA::atomicMin(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicMax(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicMax<scope>(
+      detail::cuda_scoped_atomic_is_minmax<T>{}, acc, value);
+#else
+  return RAJA::atomicMax(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T val)
+{
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc, val);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T val)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicInc<scope>(
+      std::is_same<T, unsigned>{}, acc, val);
+#else
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc, val);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc)
+{
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicAdd<scope>(
+      detail::cuda_scoped_atomic_is_add<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicInc(cuda_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T val)
+{
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc, val);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T val)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicDec<scope>(
+      std::is_same<T, unsigned>{}, acc, val);
+#else
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc, val);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc)
+{
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicSub<scope>(
+      detail::cuda_scoped_atomic_is_int32<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicDec(cuda_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicAnd(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicAnd<scope>(
+      detail::cuda_scoped_atomic_is_bitwise<T>{}, acc, value);
+#else
+  return RAJA::atomicAnd(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+         T volatile *acc, T value)
+{
+  return RAJA::atomicOr(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicOr<scope>(
+      detail::cuda_scoped_atomic_is_bitwise<T>{}, acc, value);
+#else
+  return RAJA::atomicOr(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicXor(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicXor<scope>(
+      detail::cuda_scoped_atomic_is_bitwise<T>{}, acc, value);
+#else
+  return RAJA::atomicXor(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+               T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(cuda_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomicExchange<scope>(
+      detail::cuda_scoped_atomic_is_exchange<T>{}, acc, value);
+#else
+  return RAJA::atomicExchange(cuda_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(cuda_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(cuda_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T compare, T value)
+{
+#if __CUDA_ARCH__ >= 600
+  return detail::cuda_scoped_atomic_CAS<scope>(acc, compare, value);
+#else
+  return RAJA::atomicCAS(cuda_atomic_explicit<host_policy>{}, acc, compare, value);
+#endif
+}
+
+#endif  // RAJA_ENABLE_DESUL_ATOMICS
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_CUDA
+#endif  // guard
@@ -0,0 +1,228 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the CUDA ChildForall, which starts child
+ *          loops from a RAJA::launch kernel with dynamic parallelism or
+ *          a device work queue.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_child_forall_HPP
+#define RAJA_policy_cuda_child_forall_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "RAJA/pattern/launch/child_forall.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+#if defined(RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM)
+
+/*!
+ * CUDA global function for one child loop, launched from the parent kernel.
+ */
+template <size_t BLOCK_SIZE, typename Arg, typename Body>
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void child_forall_cuda_global(Body body, Arg arg, Index_type len)
+{
+  Index_type i = static_cast<Index_type>(blockIdx.x) * BLOCK_SIZE + threadIdx.x;
+  if (i < len) {
+    body(arg, i);
+  }
+}
+
+#endif
+
+/*!
+ * CUDA global function for queued child loops. Each block takes the next
+ * queued child until the queue is empty, and its threads stride over the
+ * iterations of the child. The last block to finish empties the queue.
+ */
+template <size_t BLOCK_SIZE, typename Arg, typename Body>
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void child_queue_cuda_global(Body body,
+                                 ChildItem<Arg> const* items,
+                                 unsigned long long* counters,
+                                 size_t capacity)
+{
+  __shared__ unsigned long long s_item;
+
+  unsigned long long num_items = counters[0];
+  if (num_items > capacity) {
+    num_items = capacity;
+  }
+
+  for (;;) {
+    if (threadIdx.x == 0) {
+      s_item = atomicAdd(&counters[1], 1ull);
+    }
+    __syncthreads();
+    unsigned long long item = s_item;
+    __syncthreads();
+    if (item >= num_items) {
+      break;
+    }
+    ChildItem<Arg> const child = items[item];
+    for (Index_type i = threadIdx.x; i < child.len; i += BLOCK_SIZE) {
+      body(child.arg, i);
+    }
+  }
+
+  if (threadIdx.x == 0) {
+    __threadfence();
+    if (atomicAdd(&counters[2], 1ull) + 1 == gridDim.x) {
+      counters[0] = 0;
+      counters[1] = 0;
+      counters[2] = 0;
+    }
+  }
+}
+
+}  // namespace detail
+
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename Arg, typename Body>
+class ChildForall<
+    ::RAJA::policy::cuda::cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Arg, Body>
+{
+public:
+  using arg_type = Arg;
+  using body_type = Body;
+
+  explicit ChildForall(Body const& body, size_t capacity = 0)
+      : m_body(body), m_capacity(capacity), m_owner(true)
+  {
+#if !defined(RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM)
+    if (m_capacity > 0) {
+      m_items = ::RAJA::cuda::device_mempool_type::getInstance()
+                    .template malloc<detail::ChildItem<Arg>>(m_capacity);
+    }
+    // queued, taken and finished block counts
+    m_counters = ::RAJA::cuda::device_zeroed_mempool_type::getInstance()
+                     .template malloc<unsigned long long>(3);
+#endif
+  }
+
+  RAJA_HOST_DEVICE
+  ChildForall(ChildForall const& other)
+      : m_body(other.m_body),
+        m_items(other.m_items),
+        m_counters(other.m_counters),
+        m_capacity(other.m_capacity),
+        m_owner(false)
+  {
+  }
+
+  ChildForall& operator=(ChildForall const&) = delete;
+
+  RAJA_HOST_DEVICE
+  ~ChildForall()
+  {
+#if !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    if (m_owner) {
+      if (m_items != nullptr) {
+        ::RAJA::cuda::device_mempool_type::getInstance().free(m_items);
+      }
+      if (m_counters != nullptr) {
+        ::RAJA::cuda::device_zeroed_mempool_type::getInstance().free(
+            m_counters);
+      }
+    }
+#endif
+  }
+
+  //! run body(arg, i) for i in [0, len), called by the parent kernel
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  void forall(Arg const& arg, Index_type len) const
+  {
+#if defined(__CUDA_ARCH__) && defined(RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM)
+    if (len > 0) {
+      const unsigned int grid =
+          static_cast<unsigned int>((len + BLOCK_SIZE - 1) / BLOCK_SIZE);
+      detail::child_forall_cuda_global<BLOCK_SIZE, Arg, Body>
+          <<<grid, BLOCK_SIZE, 0, cudaStreamTailLaunch>>>(m_body, arg, len);
+    }
+#elif defined(__CUDA_ARCH__)
+    if (len > 0) {
+      unsigned long long item = atomicAdd(&m_counters[0], 1ull);
+      if (item >= m_capacity) {
+        RAJA_ABORT_OR_THROW("ChildForall queue is full");
+      }
+      m_items[item] = detail::ChildItem<Arg>{arg, len};
+    }
+#else
+    for (Index_type i = 0; i < len; ++i) {
+      m_body(arg, i);
+    }
+#endif
+  }
+
+  //! enqueue the queued child loops on res, after the parent kernel
+  resources::EventProxy<resources::Cuda> run(resources::Cuda res)
+  {
+#if !defined(RAJA_ENABLE_CUDA_DYNAMIC_PARALLELISM)
+    if (m_capacity > 0) {
+      auto func = detail::child_queue_cuda_global<BLOCK_SIZE, Arg, Body>;
+
+      // enough blocks to fill the device, the queue length is only known
+      // on the device
+      cuda_dim_t gridSize{static_cast<unsigned int>(
+                              ::RAJA::cuda::device_prop().multiProcessorCount *
+                              (BLOCKS_PER_SM > 0 ? BLOCKS_PER_SM : 1)),
+                          1, 1};
+      cuda_dim_t blockSize{static_cast<unsigned int>(BLOCK_SIZE), 1, 1};
+
+      auto cuda_body = ::RAJA::cuda::make_launch_body(
+          gridSize, blockSize, 0, res, m_body);
+      detail::ChildItem<Arg> const* items = m_items;
+      unsigned long long* counters = m_counters;
+      size_t capacity = m_capacity;
+
+      void* args[] = {(void*)&cuda_body, (void*)&items, (void*)&counters,
+                      (void*)&capacity};
+      ::RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, 0,
+                           res, Async);
+    }
+#endif
+    return resources::EventProxy<resources::Cuda>(res);
+  }
+
+private:
+  Body m_body;
+  detail::ChildItem<Arg>* m_items = nullptr;
+  unsigned long long* m_counters = nullptr;
+  size_t m_capacity = 0;
+  bool m_owner = false;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
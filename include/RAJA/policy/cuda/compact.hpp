@@ -0,0 +1,271 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_cuda_HPP
+#define RAJA_compact_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <iterator>
+#include <type_traits>
+
+#include "cub/device/device_partition.cuh"
+#include "cub/device/device_reduce.cuh"
+#include "cub/device/device_select.cuh"
+#include "cub/util_allocator.cuh"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief explicit copy if given input range, output, count output, and
+   predicate, uses the single pass decoupled look-back select of cub
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+copy_if(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceSelect::If(d_temp_storage,
+                                       temp_storage_bytes,
+                                       begin,
+                                       out,
+                                       num_selected,
+                                       len,
+                                       pred,
+                                       stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit partition given input range, output, count output, and
+   predicate, uses the single pass decoupled look-back partition of cub
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+partition(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DevicePartition::If(d_temp_storage,
+                                          temp_storage_bytes,
+                                          begin,
+                                          out,
+                                          num_selected,
+                                          len,
+                                          pred,
+                                          stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief static assert unimplemented unique with an equality function
+   other than RAJA::operators::equal_to
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<camp::is_same<Compare,
+                          operators::equal_to<RAJA::detail::IterVal<InputIter>>>>>
+unique(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter,
+    InputIter,
+    OutputIter,
+    CountIter,
+    Compare)
+{
+  static_assert (!std::is_same<Compare, Compare>::value,
+      "unique<cuda_exec> is only implemented for RAJA::operators::equal_to");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit unique given input range, output, count output, and
+   equality function, uses the single pass decoupled look-back unique of cub
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      camp::is_same<Compare,
+                          operators::equal_to<RAJA::detail::IterVal<InputIter>>>>
+unique(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    CountIter num_selected,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceSelect::Unique(d_temp_storage,
+                                           temp_storage_bytes,
+                                           begin,
+                                           out,
+                                           num_selected,
+                                           len,
+                                           stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit reduce by key given key and value input ranges, key
+   and value outputs, count output, and reduction function, uses the single
+   pass decoupled look-back reduce by key of cub
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename CountIter,
+          typename BinaryOp>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+reduce_by_key(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValueIter values,
+    OutKeyIter out_keys,
+    OutValueIter out_values,
+    CountIter num_segments,
+    BinaryOp op)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(keys_begin, keys_end);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceReduce::ReduceByKey(d_temp_storage,
+                                                temp_storage_bytes,
+                                                keys_begin,
+                                                out_keys,
+                                                values,
+                                                out_values,
+                                                num_segments,
+                                                op,
+                                                len,
+                                                stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
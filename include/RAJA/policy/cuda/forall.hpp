@@ -27,6 +27,7 @@
 #if defined(RAJA_ENABLE_CUDA)
 
 #include <algorithm>
+#include <vector>
 
 #include "RAJA/pattern/forall.hpp"
 
@@ -39,10 +40,14 @@
 
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/MultiDevice.hpp"
 #include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
 
+#include "RAJA/index/DeviceIndexSet.hpp"
+#include "RAJA/pattern/detail/fused_segments.hpp"
+
 #include "RAJA/util/resource.hpp"
 
 namespace RAJA
@@ -74,6 +79,55 @@ cuda_dim_t getGridDim(cuda_dim_member_t len, cuda_dim_t blockDim)
   return {gridSize, 1, 1};
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief calculate the maximum number of blocks of func that can be resident
+ *        on the device at once using the CUDA occupancy calculator
+ *
+ * The result is cached per UniqueMarker and shmem_size by
+ * internal::cuda_occupancy_max_blocks.
+ *
+ ******************************************************************************
+ */
+template < typename UniqueMarker, size_t BlockSize >
+RAJA_INLINE
+cuda_dim_member_t getOccMaxGridSize(const void* func, size_t shmem_size)
+{
+  size_t max_blocks = 0;
+  ::RAJA::internal::cuda_occupancy_max_blocks<UniqueMarker, BlockSize>(
+      func, static_cast<int>(shmem_size), max_blocks);
+
+  // always allow at least one block per SM so launches make progress
+  max_blocks = std::max(max_blocks,
+      static_cast<size_t>(cuda::device_prop().multiProcessorCount));
+
+  return static_cast<cuda_dim_member_t>(max_blocks);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief calculate gridDim from length of iteration and blockDim capped at
+ *        the largest grid that can be resident on the device at once
+ *
+ ******************************************************************************
+ */
+template < typename UniqueMarker, size_t BlockSize >
+RAJA_INLINE
+cuda_dim_t getOccGridDim(cuda_dim_member_t len, cuda_dim_t blockDim,
+                         const void* func, size_t shmem_size)
+{
+  cuda_dim_t gridDim = getGridDim(len, blockDim);
+
+  cuda_dim_member_t max_grid_size =
+      getOccMaxGridSize<UniqueMarker, BlockSize>(func, shmem_size);
+
+  gridDim.x = std::min(gridDim.x, max_grid_size);
+
+  return gridDim;
+}
+
 /*!
  ******************************************************************************
  *
@@ -177,6 +231,248 @@ __launch_bounds__(BlockSize, 1) __global__
   RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(f_params);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernal forall template using a grid-stride loop.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t BlocksPerSM,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void forall_cuda_occ_kernel(LOOP_BODY loop_body,
+                                const Iterator idx,
+                                IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto stride = static_cast<IndexType>(getGlobalNumThreads_1D_1D<BlockSize>());
+  for (auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D<BlockSize>());
+       ii < length;
+       ii += stride) {
+    body(idx[ii]);
+  }
+}
+
+template <typename EXEC_POL,
+          size_t BlockSize,
+          size_t BlocksPerSM,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType,
+          typename ForallParam>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void forallp_cuda_occ_kernel(
+                            LOOP_BODY loop_body,
+                            const Iterator idx,
+                            IndexType length,
+                            ForallParam f_params)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto stride = static_cast<IndexType>(getGlobalNumThreads_1D_1D<BlockSize>());
+  for (auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D<BlockSize>());
+       ii < length;
+       ii += stride) {
+    RAJA::expt::invoke_body( f_params, body, idx[ii] );
+  }
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(f_params);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernel forall template giving each thread ItemsPerThread
+ *         iterates, BlockSize apart, in an unrolled loop.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t ItemsPerThread,
+          size_t BlocksPerSM,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void forall_cuda_ilp_kernel(LOOP_BODY loop_body,
+                                const Iterator idx,
+                                IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<IndexType>(blockIdx.x * BlockSize * ItemsPerThread +
+                                   threadIdx.x);
+  if (ii + static_cast<IndexType>((ItemsPerThread - 1) * BlockSize) < length) {
+    RAJA_UNROLL
+    for (size_t item = 0; item < ItemsPerThread; ++item) {
+      body(idx[ii + static_cast<IndexType>(item * BlockSize)]);
+    }
+  } else {
+    RAJA_UNROLL
+    for (size_t item = 0; item < ItemsPerThread; ++item) {
+      auto jj = ii + static_cast<IndexType>(item * BlockSize);
+      if (jj < length) {
+        body(idx[jj]);
+      }
+    }
+  }
+}
+
+template <typename EXEC_POL,
+          size_t BlockSize,
+          size_t ItemsPerThread,
+          size_t BlocksPerSM,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType,
+          typename ForallParam>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void forallp_cuda_ilp_kernel(
+                            LOOP_BODY loop_body,
+                            const Iterator idx,
+                            IndexType length,
+                            ForallParam f_params)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<IndexType>(blockIdx.x * BlockSize * ItemsPerThread +
+                                   threadIdx.x);
+  RAJA_UNROLL
+  for (size_t item = 0; item < ItemsPerThread; ++item) {
+    auto jj = ii + static_cast<IndexType>(item * BlockSize);
+    if ( jj < length )
+    {
+      RAJA::expt::invoke_body( f_params, body, idx[jj] );
+    }
+  }
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(f_params);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernel forall template with the block size chosen at launch,
+ *         compiled for blocks of up to MaxBlockSize threads.
+ *
+ ******************************************************************************
+ */
+template <size_t MaxBlockSize,
+          size_t BlocksPerSM,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(MaxBlockSize, BlocksPerSM) __global__
+    void forall_cuda_rt_kernel(LOOP_BODY loop_body,
+                               const Iterator idx,
+                               IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<IndexType>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (ii < length) {
+    body(idx[ii]);
+  }
+}
+
+template <typename EXEC_POL,
+          size_t MaxBlockSize,
+          size_t BlocksPerSM,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType,
+          typename ForallParam>
+__launch_bounds__(MaxBlockSize, BlocksPerSM) __global__
+    void forallp_cuda_rt_kernel(
+                            LOOP_BODY loop_body,
+                            const Iterator idx,
+                            IndexType length,
+                            ForallParam f_params)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto ii = static_cast<IndexType>(blockIdx.x * blockDim.x + threadIdx.x);
+  if ( ii < length )
+  {
+    RAJA::expt::invoke_body( f_params, body, idx[ii] );
+  }
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(f_params);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernel forall template running all the segments of an index
+ *         set, each block runs part of one segment of the table.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t BlocksPerSM,
+          typename Table,
+          typename LOOP_BODY>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void forall_cuda_fused_segit_kernel(LOOP_BODY loop_body, const Table table)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  table.run(body,
+            static_cast<Index_type>(blockIdx.x),
+            static_cast<Index_type>(threadIdx.x),
+            static_cast<Index_type>(BlockSize));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  One resource per visible device, used by multi_device_exec.
+ *
+ *         Peer access is enabled between the devices that support it, so
+ *         that the temporary memory of reductions allocated on one device
+ *         may be used on the others.
+ *
+ ******************************************************************************
+ */
+inline std::vector<resources::Cuda>& multi_device_resources()
+{
+  static std::vector<resources::Cuda> device_res = [] {
+    int num_dev = 0;
+    cudaErrchk(cudaGetDeviceCount(&num_dev));
+    int orig_dev = 0;
+    cudaErrchk(cudaGetDevice(&orig_dev));
+
+    std::vector<resources::Cuda> res;
+    for (int d = 0; d < num_dev; ++d) {
+      cudaErrchk(cudaSetDevice(d));
+      res.push_back(resources::Cuda{});
+      for (int p = 0; p < num_dev; ++p) {
+        int can_access = 0;
+        if (p != d &&
+            cudaDeviceCanAccessPeer(&can_access, d, p) == cudaSuccess &&
+            can_access) {
+          // ignore cudaErrorPeerAccessAlreadyEnabled
+          cudaDeviceEnablePeerAccess(p, 0);
+          cudaGetLastError();
+        }
+      }
+    }
+
+    cudaErrchk(cudaSetDevice(orig_dev));
+    return res;
+  }();
+  return device_res;
+}
+
 }  // namespace impl
 
 //
@@ -203,7 +499,7 @@ forall_impl(resources::Cuda cuda_res,
   using LOOP_BODY = camp::decay<LoopBody>;
   using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
 
-  auto func = impl::forall_cuda_kernel<BlockSize, BlocksPerSM, Iterator, LOOP_BODY, IndexType>;
+  auto func = impl::forall_cuda_kernel<BlockSize, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType>;
 
   //
   // Compute the requested iteration space size
@@ -243,8 +539,8 @@ forall_impl(resources::Cuda cuda_res,
       //
       // Launch the kernels
       //
-      void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
-      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, Async);
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len);
     }
 
     RAJA_FT_END;
@@ -270,7 +566,7 @@ forall_impl(resources::Cuda cuda_res,
   using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
   using EXEC_POL = RAJA::cuda_exec_explicit<BlockSize, BlocksPerSM, Async>;
 
-  auto func = impl::forallp_cuda_kernel< EXEC_POL, BlockSize, BlocksPerSM, Iterator, LOOP_BODY, IndexType, camp::decay<ForallParam> >;
+  auto func = impl::forallp_cuda_kernel< EXEC_POL, BlockSize, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType, camp::decay<ForallParam> >;
 
   //
   // Compute the requested iteration space size
@@ -316,10 +612,10 @@ forall_impl(resources::Cuda cuda_res,
       //
       // Launch the kernels
       //
-      void *args[] = {(void*)&body, (void*)&begin, (void*)&len, (void*)&f_params};
-      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, Async);
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len, f_params);
 
-      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params, launch_info);
     }
 
     RAJA_FT_END;
@@ -329,47 +625,809 @@ forall_impl(resources::Cuda cuda_res,
 }
 
 
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Cuda cuda_res,
+            cuda_exec_occ_explicit<BlockSize, BlocksPerSM, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using UniqueMarker = camp::list<camp::num<BlockSize>, camp::num<BlocksPerSM>,
+                                  Iterator, LOOP_BODY, IndexType>;
+
+  auto func = impl::forall_cuda_occ_kernel<BlockSize, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType>;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
 
-//
-//////////////////////////////////////////////////////////////////////
-//
-// The following function templates iterate over index set segments
-// using the explicitly named segment iteration policy and execute
-// segments as CUDA kernels.
-//
-//////////////////////////////////////////////////////////////////////
-//
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
 
-/*!
- ******************************************************************************
- *
- * \brief  Sequential iteration over segments of index set and
- *         CUDA execution for segments.
- *
- ******************************************************************************
- */
-template <typename LoopBody,
-          size_t BlockSize,
-          size_t BlocksPerSM,
-          bool Async,
-          typename... SegmentTypes>
-RAJA_INLINE resources::EventProxy<resources::Cuda>
-forall_impl(resources::Cuda r,
-            ExecPolicy<seq_segit, cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>,
-            const TypedIndexSet<SegmentTypes...>& iset,
-            LoopBody&& loop_body)
-{
-  int num_seg = iset.getNumSegments();
-  for (int isi = 0; isi < num_seg; ++isi) {
-    iset.segmentCall(r,
-                     isi,
-                     detail::CallForall(),
-                     cuda_exec_explicit<BlockSize, BlocksPerSM, true>(),
-                     loop_body);
-  }  // iterate over segments of index set
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
 
-  if (!Async) RAJA::cuda::synchronize(r);
-  return resources::EventProxy<resources::Cuda>(r);
+    //
+    // Compute the number of blocks, limited to those that can be resident
+    //
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize = impl::getOccGridDim<UniqueMarker, BlockSize>(
+        static_cast<cuda_dim_member_t>(len), blockSize, (const void*)func, shmem);
+
+    RAJA_FT_BEGIN;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate< RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>> >
+forall_impl(resources::Cuda cuda_res,
+            cuda_exec_occ_explicit<BlockSize, BlocksPerSM, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam f_params)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::cuda_exec_occ_explicit<BlockSize, BlocksPerSM, Async>;
+  using UniqueMarker = camp::list<EXEC_POL, Iterator, LOOP_BODY, IndexType,
+                                  camp::decay<ForallParam>>;
+
+  auto func = impl::forallp_cuda_occ_kernel< EXEC_POL, BlockSize, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType, camp::decay<ForallParam> >;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    //
+    // Compute the number of blocks, limited to those that can be resident
+    //
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize = impl::getOccGridDim<UniqueMarker, BlockSize>(
+        static_cast<cuda_dim_member_t>(len), blockSize, (const void*)func, shmem);
+
+    RAJA_FT_BEGIN;
+
+    RAJA::cuda::detail::cudaInfo launch_info;
+    launch_info.gridDim = gridSize;
+    launch_info.blockDim = blockSize;
+    launch_info.res = cuda_res;
+
+    {
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params, launch_info);
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len, f_params);
+
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params, launch_info);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+template <typename Iterable, typename LoopBody, size_t MaxBlockSize, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Cuda cuda_res,
+            cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_cuda_rt_kernel<MaxBlockSize, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType>;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  //
+  // Block size chosen at run time, at most MaxBlockSize
+  //
+  size_t const block_size = RAJA::cuda::exec_block_size<MaxBlockSize>();
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && block_size > 0) {
+
+    //
+    // Compute the number of blocks
+    //
+    cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(block_size), 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(static_cast<cuda_dim_member_t>(len), blockSize);
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+template <typename Iterable, typename LoopBody, size_t MaxBlockSize, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate< RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>> >
+forall_impl(resources::Cuda cuda_res,
+            cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam f_params)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, Async>;
+
+  auto func = impl::forallp_cuda_rt_kernel< EXEC_POL, MaxBlockSize, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType, camp::decay<ForallParam> >;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  //
+  // Block size chosen at run time, at most MaxBlockSize
+  //
+  size_t const block_size = RAJA::cuda::exec_block_size<MaxBlockSize>();
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && block_size > 0) {
+
+    //
+    // Compute the number of blocks
+    //
+    cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(block_size), 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(static_cast<cuda_dim_member_t>(len), blockSize);
+
+    RAJA_FT_BEGIN;
+
+    RAJA::cuda::detail::cudaInfo launch_info;
+    launch_info.gridDim = gridSize;
+    launch_info.blockDim = blockSize;
+    launch_info.res = cuda_res;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params, launch_info);
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len, f_params);
+
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params, launch_info);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t ItemsPerThread, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Cuda cuda_res,
+            cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+  auto func = impl::forall_cuda_ilp_kernel<BlockSize, ItemsPerThread, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType>;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0 && ItemsPerThread > 0) {
+
+    //
+    // Compute the number of blocks, each covering ItemsPerThread iterates
+    // per thread
+    //
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(
+        static_cast<cuda_dim_member_t>(RAJA_DIVIDE_CEILING_INT(len, static_cast<IndexType>(ItemsPerThread))),
+        blockSize);
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t ItemsPerThread, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate< RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>> >
+forall_impl(resources::Cuda cuda_res,
+            cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam f_params)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, Async>;
+
+  auto func = impl::forallp_cuda_ilp_kernel< EXEC_POL, BlockSize, ItemsPerThread, BlocksPerSM, Iterator, RAJA::cuda::launch_body_t<LOOP_BODY>, IndexType, camp::decay<ForallParam> >;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0 && ItemsPerThread > 0) {
+
+    //
+    // Compute the number of blocks, each covering ItemsPerThread iterates
+    // per thread
+    //
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize = impl::getGridDim(
+        static_cast<cuda_dim_member_t>(RAJA_DIVIDE_CEILING_INT(len, static_cast<IndexType>(ItemsPerThread))),
+        blockSize);
+
+    RAJA_FT_BEGIN;
+
+    RAJA::cuda::detail::cudaInfo launch_info;
+    launch_info.gridDim = gridSize;
+    launch_info.blockDim = blockSize;
+    launch_info.res = cuda_res;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params, launch_info);
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernels
+      //
+      RAJA::cuda::launch_body((const void*)func, gridSize, blockSize, shmem, cuda_res, Async,
+                              body, begin, len, f_params);
+
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params, launch_info);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA execution over all the visible devices.
+ *
+ *         The iteration space is split into one contiguous part per device
+ *         and each part runs on a stream of its device, after the work
+ *         already enqueued on cuda_res. Then cuda_res waits for all the
+ *         parts, and the forall parameters of each part are resolved into
+ *         the same targets.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename LoopBody, size_t BlockSize, size_t BlocksPerSM, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Cuda>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>>
+forall_impl(resources::Cuda cuda_res,
+            multi_device_exec<cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam f_params)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::cuda_exec_explicit<BlockSize, BlocksPerSM, true>;
+
+  auto func = impl::forallp_cuda_kernel< EXEC_POL, BlockSize, BlocksPerSM, Iterator, LOOP_BODY, IndexType, camp::decay<ForallParam> >;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernels if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    std::vector<resources::Cuda>& device_res = impl::multi_device_resources();
+    const int num_dev = static_cast<int>(device_res.size());
+
+    int orig_dev = 0;
+    cudaErrchk(cudaGetDevice(&orig_dev));
+
+    resources::Event start = cuda_res.get_event();
+
+    std::vector<camp::decay<ForallParam>> device_params(num_dev, f_params);
+    std::vector<char> has_part(num_dev, 0);
+
+    // Reducer objects in the loop body would each combine only one part,
+    // so make_launch_body throws for them
+    RAJA::cuda::detail::SetterResetter<bool> reject_reducers_srer(
+        RAJA::cuda::detail::tl_status.reject_reducers, true);
+
+    RAJA_FT_BEGIN;
+
+    for (int d = 0; d < num_dev; ++d) {
+      IndexType lo = static_cast<IndexType>((static_cast<long long>(len) * d) / num_dev);
+      IndexType hi = static_cast<IndexType>((static_cast<long long>(len) * (d + 1)) / num_dev);
+      IndexType part_len = hi - lo;
+      if (part_len <= 0) continue;
+
+      Iterator part_begin = begin + lo;
+
+      //
+      // Compute the number of blocks
+      //
+      cuda_dim_t blockSize{BlockSize, 1, 1};
+      cuda_dim_t gridSize = impl::getGridDim(static_cast<cuda_dim_member_t>(part_len), blockSize);
+
+      //
+      // Setup shared memory buffers
+      //
+      size_t shmem = 0;
+
+      //
+      // Privatize the loop_body before changing the device, so a rejected
+      // reducer object leaves the current device and the parameters alone
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, device_res[d], loop_body);
+
+      cudaErrchk(cudaSetDevice(d));
+      resources::Cuda part_res = device_res[d];
+      part_res.wait_for(&start);
+      has_part[d] = 1;
+
+      RAJA::cuda::detail::cudaInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = part_res;
+
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(device_params[d], launch_info);
+
+      //
+      // Launch the kernel of this part, without waiting for it
+      //
+      void *args[] = {(void*)&body, (void*)&part_begin, (void*)&part_len, (void*)&device_params[d]};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, part_res, true);
+    }
+
+    for (int d = 0; d < num_dev; ++d) {
+      if (!has_part[d]) continue;
+
+      cudaErrchk(cudaSetDevice(d));
+      RAJA::cuda::detail::cudaInfo resolve_info;
+      resolve_info.res = device_res[d];
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(device_params[d], resolve_info);
+
+      resources::Event done = device_res[d].get_event();
+      cuda_res.wait_for(&done);
+    }
+
+    cudaErrchk(cudaSetDevice(orig_dev));
+
+    RAJA_FT_END;
+
+    if (!Async) RAJA::cuda::synchronize(cuda_res);
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// The following function templates iterate over index set segments
+// using the explicitly named segment iteration policy and execute
+// segments as CUDA kernels.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Sequential iteration over segments of index set and
+ *         CUDA execution for segments.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody,
+          size_t BlockSize,
+          size_t BlocksPerSM,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Cuda>
+forall_impl(resources::Cuda r,
+            ExecPolicy<seq_segit, cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body)
+{
+  int num_seg = iset.getNumSegments();
+  for (int isi = 0; isi < num_seg; ++isi) {
+    iset.segmentCall(r,
+                     isi,
+                     detail::CallForall(),
+                     cuda_exec_explicit<BlockSize, BlocksPerSM, true>(),
+                     loop_body);
+  }  // iterate over segments of index set
+
+  if (!Async) RAJA::cuda::synchronize(r);
+  return resources::EventProxy<resources::Cuda>(r);
+}
+
+template <typename LoopBody,
+          size_t BlockSize,
+          size_t BlocksPerSM,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Cuda>
+forall_impl(resources::Cuda r,
+            ExecPolicy<seq_segit, cuda_exec_occ_explicit<BlockSize, BlocksPerSM, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body)
+{
+  int num_seg = iset.getNumSegments();
+  for (int isi = 0; isi < num_seg; ++isi) {
+    iset.segmentCall(r,
+                     isi,
+                     detail::CallForall(),
+                     cuda_exec_occ_explicit<BlockSize, BlocksPerSM, true>(),
+                     loop_body);
+  }  // iterate over segments of index set
+
+  if (!Async) RAJA::cuda::synchronize(r);
+  return resources::EventProxy<resources::Cuda>(r);
+}
+
+template <typename LoopBody,
+          size_t MaxBlockSize,
+          size_t BlocksPerSM,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Cuda>
+forall_impl(resources::Cuda r,
+            ExecPolicy<seq_segit, cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body)
+{
+  int num_seg = iset.getNumSegments();
+  for (int isi = 0; isi < num_seg; ++isi) {
+    iset.segmentCall(r,
+                     isi,
+                     detail::CallForall(),
+                     cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, true>(),
+                     loop_body);
+  }  // iterate over segments of index set
+
+  if (!Async) RAJA::cuda::synchronize(r);
+  return resources::EventProxy<resources::Cuda>(r);
+}
+
+template <typename LoopBody,
+          size_t BlockSize,
+          size_t ItemsPerThread,
+          size_t BlocksPerSM,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Cuda>
+forall_impl(resources::Cuda r,
+            ExecPolicy<seq_segit, cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body)
+{
+  int num_seg = iset.getNumSegments();
+  for (int isi = 0; isi < num_seg; ++isi) {
+    iset.segmentCall(r,
+                     isi,
+                     detail::CallForall(),
+                     cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, true>(),
+                     loop_body);
+  }  // iterate over segments of index set
+
+  if (!Async) RAJA::cuda::synchronize(r);
+  return resources::EventProxy<resources::Cuda>(r);
+}
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA execution of all the segments of index set in one kernel.
+ *
+ *         The segments are described in a table that is built on the host
+ *         and copied to the device with one copy; each segment gets enough
+ *         blocks for its length and every block looks up its segment in the
+ *         table.  This saves the launch latency of one kernel per segment
+ *         for index sets with many small segments.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody,
+          size_t BlockSize,
+          size_t BlocksPerSM,
+          bool Async,
+          typename... SegmentTypes,
+          typename ForallParam>
+RAJA_INLINE resources::EventProxy<resources::Cuda>
+forall_impl(resources::Cuda cuda_res,
+            ExecPolicy<cuda_segit_fused, cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  static_assert(RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>::value,
+                "cuda_segit_fused does not support forall parameters");
+
+  using Table = RAJA::detail::FusedSegmentTable<SegmentTypes...>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  auto func = impl::forall_cuda_fused_segit_kernel<BlockSize, BlocksPerSM, Table, LOOP_BODY>;
+
+  RAJA::detail::FusedSegmentTableBuilder<SegmentTypes...> builder(iset, BlockSize);
+
+  // Only launch kernel if we have something to iterate over
+  if (builder.num_blocks() > 0) {
+
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(builder.num_blocks()), 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Copy the segment table to the device
+    //
+    char* d_table = cuda::temp_malloc<char>(cuda_res, builder.bytes());
+    cudaErrchk(cudaMemcpyAsync(d_table, builder.data(), builder.bytes(),
+                                 cudaMemcpyHostToDevice, cuda_res.get_stream()));
+    Table table = builder.table(d_table);
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernel
+      //
+      void *args[] = {(void*)&body, (void*)&table};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, Async);
+    }
+
+    cuda::temp_free(cuda_res, d_table);
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA execution of all the segments of an index set in one kernel
+ *         using the resident segment table of a TypedDeviceIndexSet, so no
+ *         table is built or copied per launch.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody,
+          size_t BlockSize,
+          size_t BlocksPerSM,
+          bool Async,
+          typename... SegmentTypes,
+          typename ForallParam>
+RAJA_INLINE resources::EventProxy<resources::Cuda>
+forall_impl(resources::Cuda cuda_res,
+            ExecPolicy<cuda_segit_fused, cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>,
+            const TypedDeviceIndexSet<SegmentTypes...>& diset,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  static_assert(RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>::value,
+                "cuda_segit_fused does not support forall parameters");
+
+  using Table = RAJA::detail::FusedSegmentTable<SegmentTypes...>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  auto func = impl::forall_cuda_fused_segit_kernel<BlockSize, BlocksPerSM, Table, LOOP_BODY>;
+
+  auto entry = diset.getTable(BlockSize);
+
+  // Only launch kernel if we have something to iterate over
+  if (entry.num_blocks > 0) {
+
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize{static_cast<cuda_dim_member_t>(entry.num_blocks), 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    Table table = entry.table;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernel
+      //
+      void *args[] = {(void*)&body, (void*)&table};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, Async);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
 }
 
 }  // namespace cuda
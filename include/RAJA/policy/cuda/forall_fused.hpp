@@ -0,0 +1,212 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA fused forall declarations for CUDA.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_fused_cuda_HPP
+#define RAJA_forall_fused_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace fused
+{
+
+/*!
+ * Loop of a fused kernel, the iterator to the start of the segment, the
+ * length of the segment, and the loop body.
+ */
+template <typename Iterator, typename IndexType, typename LoopBody>
+struct CudaFusedLoop
+{
+  Iterator begin;
+  IndexType length;
+  LoopBody body;
+};
+
+template <typename Segment, typename LoopBody>
+using cuda_fused_loop_t = CudaFusedLoop<
+    camp::decay<decltype(std::begin(std::declval<Segment&>()))>,
+    camp::decay<decltype(std::distance(std::begin(std::declval<Segment&>()),
+                                       std::end(std::declval<Segment&>())))>,
+    LoopBody>;
+
+/*!
+ * Blocks of a fused kernel, loop i runs in the blocks from begin[i] to
+ * begin[i+1].
+ */
+template <size_t NumLoops>
+struct CudaFusedBlocks
+{
+  cuda_dim_member_t begin[NumLoops + 1];
+};
+
+/*!
+ * Run the part of a loop assigned to this thread if this block is one of the
+ * blocks of the loop.
+ */
+template <size_t BlockSize, typename Loop>
+__device__ __forceinline__ void forall_fused_cuda_loop(
+    Loop& loop,
+    cuda_dim_member_t block_begin,
+    cuda_dim_member_t block_end)
+{
+  using IndexType = decltype(loop.length);
+  const cuda_dim_member_t block = blockIdx.x;
+  if (block_begin <= block && block < block_end) {
+    auto ii = static_cast<IndexType>((block - block_begin) * BlockSize +
+                                     threadIdx.x);
+    if (ii < loop.length) {
+      loop.body(loop.begin[ii]);
+    }
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  CUDA kernel running several loops, each in its own range of blocks.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          size_t BlocksPerSM,
+          typename Loops,
+          camp::idx_t... Is>
+__launch_bounds__(BlockSize, BlocksPerSM) __global__
+    void forall_fused_cuda_kernel(Loops loops,
+                                  CudaFusedBlocks<sizeof...(Is)> blocks)
+{
+  // every thread privatizes all of the loops so reducers used by a loop
+  // see every block of the grid
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loops);
+  auto& priv_loops = privatizer.get_priv();
+  int unused[] = {0, (forall_fused_cuda_loop<BlockSize>(camp::get<Is>(priv_loops),
+                                                        blocks.begin[Is],
+                                                        blocks.begin[Is + 1]), 0)...};
+  RAJA_UNUSED_VAR(unused);
+}
+
+/*!
+        \brief explicit fused forall given a tuple of segments and a tuple of
+   loop bodies, runs each loop in its own range of blocks of one kernel
+*/
+template <size_t BlockSize,
+          size_t BlocksPerSM,
+          bool Async,
+          typename Segments,
+          typename Bodies,
+          camp::idx_t... Is>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+forall_fused(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BlockSize, BlocksPerSM, Async>,
+    Segments& segs,
+    Bodies& bodies,
+    camp::idx_seq<Is...>)
+{
+  using Loops = camp::tuple<
+      cuda_fused_loop_t<camp::tuple_element_t<Is, Segments>,
+                        camp::tuple_element_t<Is, Bodies>>...>;
+
+  constexpr size_t num_loops = sizeof...(Is);
+
+  auto func = forall_fused_cuda_kernel<BlockSize, BlocksPerSM, Loops, Is...>;
+
+  //
+  // Compute the number of blocks of each loop
+  //
+  using std::begin;
+  using std::end;
+  using std::distance;
+  const cuda_dim_member_t lens[num_loops] = {
+      static_cast<cuda_dim_member_t>(distance(begin(camp::get<Is>(segs)),
+                                              end(camp::get<Is>(segs))))...};
+
+  CudaFusedBlocks<num_loops> blocks;
+  blocks.begin[0] = 0;
+  for (size_t i = 0; i < num_loops; ++i) {
+    blocks.begin[i + 1] = blocks.begin[i] + (lens[i] + BlockSize - 1) / BlockSize;
+  }
+
+  // Only launch kernel if we have something to iterate over
+  if (blocks.begin[num_loops] > 0 && BlockSize > 0) {
+
+    cuda_dim_t blockSize{BlockSize, 1, 1};
+    cuda_dim_t gridSize{blocks.begin[num_loops], 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loops, using make_launch_body to setup reductions
+      //
+      Loops loops = RAJA::cuda::make_launch_body(
+          gridSize, blockSize, shmem, cuda_res,
+          camp::make_tuple(
+              camp::tuple_element_t<Is, Loops>{
+                  begin(camp::get<Is>(segs)),
+                  distance(begin(camp::get<Is>(segs)), end(camp::get<Is>(segs))),
+                  camp::get<Is>(bodies)}...));
+
+      //
+      // Launch the kernel
+      //
+      void *args[] = {(void*)&loops, (void*)&blocks};
+      RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, shmem, cuda_res, Async);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+}  // namespace fused
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
@@ -19,14 +19,17 @@
 #ifndef RAJA_policy_cuda_kernel_HPP
 #define RAJA_policy_cuda_kernel_HPP
 
+#include "RAJA/policy/cuda/kernel/Collapse.hpp"
 #include "RAJA/policy/cuda/kernel/Conditional.hpp"
 #include "RAJA/policy/cuda/kernel/CudaKernel.hpp"
 #include "RAJA/policy/cuda/kernel/For.hpp"
 #include "RAJA/policy/cuda/kernel/ForICount.hpp"
+#include "RAJA/policy/cuda/kernel/ForUnroll.hpp"
 #include "RAJA/policy/cuda/kernel/Hyperplane.hpp"
 #include "RAJA/policy/cuda/kernel/InitLocalMem.hpp"
 #include "RAJA/policy/cuda/kernel/Lambda.hpp"
 #include "RAJA/policy/cuda/kernel/Reduce.hpp"
+#include "RAJA/policy/cuda/kernel/Sequence.hpp"
 #include "RAJA/policy/cuda/kernel/Sync.hpp"
 #include "RAJA/policy/cuda/kernel/Tile.hpp"
 #include "RAJA/policy/cuda/kernel/TileTCount.hpp"
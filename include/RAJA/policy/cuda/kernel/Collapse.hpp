@@ -0,0 +1,216 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for CUDA collapse statement executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_policy_cuda_kernel_Collapse_HPP
+#define RAJA_policy_cuda_kernel_Collapse_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/cuda/kernel/internal.hpp"
+
+#include "RAJA/pattern/kernel/Collapse.hpp"
+
+#include "RAJA/util/FastDivmod.hpp"
+
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+
+/*
+ * Executor for collapsing two loops onto the whole grid inside CudaKernel.
+ * Provides a grid-stride loop over the linearized iteration space.
+ * Assigns the loop indices to offsets Arg0 and Arg1, Arg1 varying fastest
+ */
+template <typename Data,
+          int Dim,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<
+    Data,
+    statement::Collapse<RAJA::cuda_flatten_global_xyz_loop<Dim>,
+                        ArgList<Arg0, Arg1>,
+                        EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument types for this loop
+  using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+  using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+  using enclosed_stmts_t =
+      CudaStatementListExecutor<Data, stmt_list_t, NewTypes1>;
+
+  using diff_t = segment_diff_type<Arg1, Data>;
+
+
+  static
+  inline RAJA_DEVICE void exec(Data &data, bool thread_active)
+  {
+    diff_t len1 = segment_length<Arg1>(data);
+    diff_t len = segment_length<Arg0>(data) * len1;
+
+    // grid stride loop
+    diff_t i_init = get_cuda_dim<Dim>(blockIdx) * get_cuda_dim<Dim>(blockDim) +
+                    get_cuda_dim<Dim>(threadIdx);
+    diff_t i_stride = get_cuda_dim<Dim>(gridDim) * get_cuda_dim<Dim>(blockDim);
+
+    // the magic numbers are computed once and used by every iterate
+    RAJA::FastDivmod<diff_t> div1(len1);
+
+    for (diff_t ii = 0; ii < len; ii += i_stride) {
+      diff_t i = ii + i_init;
+
+      // execute enclosed statements if any thread will
+      // but mask off threads without work
+      bool have_work = i < len;
+
+      if (have_work) {
+        diff_t i0, i1;
+        div1.divmod(i, i0, i1);
+
+        data.template assign_offset<Arg0>(i0);
+        data.template assign_offset<Arg1>(i1);
+      }
+
+      enclosed_stmts_t::exec(data, thread_active && have_work);
+    }
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    diff_t len = segment_length<Arg0>(data) * segment_length<Arg1>(data);
+
+    // request one thread per element in the iteration space,
+    // the launch fits the threads and blocks to the device
+    LaunchDims dims;
+    set_cuda_dim<Dim>(dims.threads, len);
+    set_cuda_dim<Dim>(dims.blocks, len);
+
+    // combine with enclosed statements
+    LaunchDims enclosed_dims = enclosed_stmts_t::calculateDimensions(data);
+    return dims.max(enclosed_dims);
+  }
+};
+
+
+/*
+ * Executor for collapsing three loops onto the whole grid inside CudaKernel.
+ * Provides a grid-stride loop over the linearized iteration space.
+ * Assigns the loop indices to offsets Arg0, Arg1 and Arg2, Arg2 varying
+ * fastest
+ */
+template <typename Data,
+          int Dim,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<
+    Data,
+    statement::Collapse<RAJA::cuda_flatten_global_xyz_loop<Dim>,
+                        ArgList<Arg0, Arg1, Arg2>,
+                        EnclosedStmts...>,
+    Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  // Set the argument types for this loop
+  using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+  using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+  using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+  using enclosed_stmts_t =
+      CudaStatementListExecutor<Data, stmt_list_t, NewTypes2>;
+
+  using diff_t = segment_diff_type<Arg2, Data>;
+
+
+  static
+  inline RAJA_DEVICE void exec(Data &data, bool thread_active)
+  {
+    diff_t len1 = segment_length<Arg1>(data);
+    diff_t len2 = segment_length<Arg2>(data);
+    diff_t len = segment_length<Arg0>(data) * len1 * len2;
+
+    // grid stride loop
+    diff_t i_init = get_cuda_dim<Dim>(blockIdx) * get_cuda_dim<Dim>(blockDim) +
+                    get_cuda_dim<Dim>(threadIdx);
+    diff_t i_stride = get_cuda_dim<Dim>(gridDim) * get_cuda_dim<Dim>(blockDim);
+
+    // the magic numbers are computed once and used by every iterate
+    RAJA::FastDivmod<diff_t> div1(len1);
+    RAJA::FastDivmod<diff_t> div2(len2);
+
+    for (diff_t ii = 0; ii < len; ii += i_stride) {
+      diff_t i = ii + i_init;
+
+      // execute enclosed statements if any thread will
+      // but mask off threads without work
+      bool have_work = i < len;
+
+      if (have_work) {
+        diff_t i01, i0, i1, i2;
+        div2.divmod(i, i01, i2);
+        div1.divmod(i01, i0, i1);
+
+        data.template assign_offset<Arg0>(i0);
+        data.template assign_offset<Arg1>(i1);
+        data.template assign_offset<Arg2>(i2);
+      }
+
+      enclosed_stmts_t::exec(data, thread_active && have_work);
+    }
+  }
+
+
+  static
+  inline
+  LaunchDims calculateDimensions(Data const &data)
+  {
+    diff_t len = segment_length<Arg0>(data) * segment_length<Arg1>(data) *
+                 segment_length<Arg2>(data);
+
+    // request one thread per element in the iteration space,
+    // the launch fits the threads and blocks to the device
+    LaunchDims dims;
+    set_cuda_dim<Dim>(dims.threads, len);
+    set_cuda_dim<Dim>(dims.blocks, len);
+
+    // combine with enclosed statements
+    LaunchDims enclosed_dims = enclosed_stmts_t::calculateDimensions(data);
+    return dims.max(enclosed_dims);
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_policy_cuda_kernel_Collapse_HPP */
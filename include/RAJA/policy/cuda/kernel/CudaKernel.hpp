@@ -550,12 +550,6 @@ struct StatementExecutor<
       launch_dims.threads = fit_threads;
 
 
-      //
-      // Compute the MAX physical kernel blocks
-      //
-      size_t max_blocks;
-      launch_t::max_blocks(shmem, max_blocks, launch_dims.num_threads());
-
       size_t use_blocks;
 
       if ( launch_dims.num_threads() == recommended_threads ) {
@@ -568,9 +562,10 @@ struct StatementExecutor<
       } else {
 
         //
-        // Fit the max blocks
+        // Fit the MAX physical kernel blocks, only queried when needed
+        // so the occupancy calculator is not called on every launch
         //
-        use_blocks = max_blocks;
+        launch_t::max_blocks(shmem, use_blocks, launch_dims.num_threads());
 
       }
 
@@ -27,6 +27,9 @@
 
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
 
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/kernel/internal.hpp"
+
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -105,6 +108,189 @@ struct CudaStatementExecutor<Data,
 
 
 
+/*!
+ * Wait, with the other blocks of a wavefront kernel, until the blocks have
+ * finished the hyperplanes before the next one. The count of blocks that
+ * finished a hyperplane only grows, so hyperplane h is complete when it
+ * reaches (h+1) * number of blocks.
+ */
+RAJA_DEVICE RAJA_INLINE void cuda_wavefront_wait(unsigned long long *arrivals,
+                                              unsigned long long target)
+{
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    __threadfence();
+    atomicAdd(arrivals, 1ull);
+    while (*static_cast<volatile unsigned long long *>(arrivals) < target) {
+    }
+    __threadfence();
+  }
+  __syncthreads();
+}
+
+/*!
+ * Arrive after the last hyperplane, the last block to arrive zeroes the
+ * count so it goes back to the zeroed memory pool as it came.
+ */
+RAJA_DEVICE RAJA_INLINE void cuda_wavefront_finish(unsigned long long *arrivals,
+                                                unsigned long long target)
+{
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    if (atomicAdd(arrivals, 1ull) + 1ull == target) {
+      *arrivals = 0ull;
+    }
+  }
+}
+
+/*!
+ * CUDA global function for the wavefront hyperplane executor.
+ *
+ * The iterates of the arguments of the hyperplane are spread over all the
+ * threads of the grid, each hyperplane masks off the threads whose point
+ * lies outside of the iteration space, as the sequential executor does.
+ */
+template <size_t BlockSize,
+          typename Data,
+          typename Exec,
+          typename Offsets,
+          camp::idx_t HpArgumentId>
+__launch_bounds__(BlockSize, 1) __global__
+    void CudaWavefrontLauncher(Data data, unsigned long long *arrivals)
+{
+  using data_t = camp::decay<Data>;
+  using hp_offset_t =
+      camp::tuple_element_t<HpArgumentId, typename data_t::offset_tuple_t>;
+
+  data_t private_data = data;
+
+  Index_type i_len =
+      static_cast<Index_type>(stripIndexType(segment_length<HpArgumentId>(private_data)));
+  Index_type inner_size = Offsets::size(private_data);
+  Index_type hp_len = i_len + Offsets::max_sum(private_data);
+
+  Index_type num_threads = static_cast<Index_type>(blockDim.x) * gridDim.x;
+  Index_type tid = threadIdx.x + static_cast<Index_type>(blockIdx.x) * blockDim.x;
+  unsigned long long num_blocks = gridDim.x;
+
+  for (Index_type h = 0; h < hp_len; ++h) {
+
+    for (Index_type k0 = 0; k0 < inner_size; k0 += num_threads) {
+
+      Index_type k = k0 + tid;
+      Index_type i = -1;
+      if (k < inner_size) {
+        // compute actual iterate for HpArgumentId
+        // as:  i0 = h - (i1 + i2 + i3 + ...)
+        i = h - Offsets::assign(private_data, k);
+      }
+
+      private_data.template assign_offset<HpArgumentId>(static_cast<hp_offset_t>(i));
+      Exec::exec(private_data, i >= 0 && i < i_len);
+    }
+
+    if (h + 1 < hp_len) {
+      cuda_wavefront_wait(arrivals, static_cast<unsigned long long>(h + 1) * num_blocks);
+    }
+  }
+
+  cuda_wavefront_finish(arrivals, static_cast<unsigned long long>(hp_len) * num_blocks);
+}
+
+//! the CUDA resource of the kernel, or the default one for host resources
+RAJA_INLINE resources::Cuda cuda_wavefront_resource(resources::Cuda res)
+{
+  return res;
+}
+
+template <typename Resource>
+RAJA_INLINE resources::Cuda cuda_wavefront_resource(Resource const &)
+{
+  return resources::Cuda::get_default();
+}
+
+/*!
+ * Specialization that runs a Hyperplane statement in one persistent CUDA
+ * kernel, from host code.
+ *
+ * All hyperplanes run in one kernel, the blocks count their completion of
+ * each hyperplane in a device counter and wait for the others before they
+ * start the next one. The grid is limited to the blocks that can be
+ * resident at once and launched cooperatively, so the wait can not
+ * deadlock. The EnclosedStmts run on each thread, e.g. statement::Lambda,
+ * and ExecPolicy is not used.
+ */
+template <camp::idx_t HpArgumentId,
+          size_t BlockSize,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Hyperplane<HpArgumentId,
+                                               cuda_wavefront_exec<BlockSize>,
+                                               ArgList<Args...>,
+                                               ExecPolicy,
+                                               EnclosedStmts...>, Types> {
+
+  using Self = StatementExecutor;
+
+  template <typename Data>
+  static inline void exec(Data &data)
+  {
+    using data_t = camp::decay<Data>;
+
+    // Set the argument types of all of the hyperplane arguments
+    using NewTypes = setSegmentTypesFromData<Types, data_t, HpArgumentId, Args...>;
+
+    using executor_t =
+        cuda_statement_list_executor_t<StatementList<EnclosedStmts...>, data_t, NewTypes>;
+    using offsets_t = HyperplaneOffsets<Args...>;
+
+    Index_type i_len =
+        static_cast<Index_type>(stripIndexType(segment_length<HpArgumentId>(data)));
+    Index_type inner_size = offsets_t::size(data);
+
+    // Only launch kernel if we have something to iterate over
+    if (i_len <= 0 || inner_size <= 0) {
+      return;
+    }
+
+    resources::Cuda res = cuda_wavefront_resource(data.get_resource());
+
+    auto func = CudaWavefrontLauncher<BlockSize, data_t, executor_t, offsets_t, HpArgumentId>;
+
+    //
+    // One block per BlockSize points of a hyperplane, as many as can be
+    // resident at once
+    //
+    size_t max_blocks = 0;
+    internal::cuda_occupancy_max_blocks<Self, BlockSize>(func, 0, max_blocks);
+    size_t num_blocks = RAJA_DIVIDE_CEILING_INT(static_cast<size_t>(inner_size), BlockSize);
+    if (max_blocks > 0 && num_blocks > max_blocks) {
+      num_blocks = max_blocks;
+    }
+
+    cuda_dim_t blocks{static_cast<unsigned int>(num_blocks), 1, 1};
+    cuda_dim_t threads{static_cast<unsigned int>(BlockSize), 1, 1};
+
+    unsigned long long *arrivals =
+        RAJA::cuda::device_zeroed_mempool_type::getInstance().template malloc<unsigned long long>(1);
+
+    {
+      //
+      // Privatize the LoopData, using make_launch_body to setup reductions
+      //
+      auto cuda_data = RAJA::cuda::make_launch_body(blocks, threads, 0, res, data);
+
+      void *args[] = {(void*)&cuda_data, (void*)&arrivals};
+      RAJA::cuda::launch_cooperative((const void*)func, blocks, threads, args, 0, res, false);
+    }
+
+    RAJA::cuda::device_zeroed_mempool_type::getInstance().free(arrivals);
+  }
+};
+
+
 }  // end namespace internal
 
 }  // end namespace RAJA
@@ -89,6 +89,75 @@ struct CudaStatementExecutor<Data,
 };
 
 
+//
+// Executor that handles reductions of several params across a single CUDA
+// thread block, all params are combined in one shared memory pass
+//
+template <typename Data,
+          template <typename...> class ReduceOperator,
+          camp::idx_t... ParamIds,
+          typename... EnclosedStmts,
+          typename Types>
+struct CudaStatementExecutor<Data,
+                             statement::Reduce<RAJA::cuda_block_reduce,
+                                               ReduceOperator,
+                                               camp::idx_seq<ParamIds...>,
+                                               EnclosedStmts...>,
+                                               Types> {
+
+  using stmt_list_t = StatementList<EnclosedStmts...>;
+
+  using enclosed_stmts_t = CudaStatementListExecutor<Data, stmt_list_t, Types>;
+
+  template <camp::idx_t ParamId>
+  using param_t =
+      camp::decay<camp::at_v<typename Data::param_tuple_t::TList, ParamId>>;
+
+  using values_t = camp::tuple<param_t<ParamIds>...>;
+
+  using ops_t = camp::list<ReduceOperator<param_t<ParamIds>>...>;
+
+
+  static inline RAJA_DEVICE void exec(Data &data, bool thread_active)
+  {
+    // inactive threads contribute the identity of every param
+    values_t values((thread_active
+        ? camp::get<ParamIds>(data.param_tuple)
+        : ReduceOperator<param_t<ParamIds>>::identity())...);
+
+    // block reduce all params together into thread 0
+    RAJA::cuda::impl::expt::block_reduce_fused(
+        ops_t{}, camp::make_idx_seq_t<sizeof...(ParamIds)>{}, values);
+
+
+    // execute enclosed statements, and mask off everyone but thread 0
+    thread_active = threadIdx.x == 0 && threadIdx.y == 0 && threadIdx.z == 0;
+    if(thread_active){
+      // Only update to new values on root thread
+      assignParams(data, values, camp::make_idx_seq_t<sizeof...(ParamIds)>{});
+    }
+    enclosed_stmts_t::exec(data, thread_active);
+  }
+
+  template <camp::idx_t... Seq>
+  static inline RAJA_DEVICE void assignParams(Data &data,
+                                              values_t const &values,
+                                              camp::idx_seq<Seq...>)
+  {
+    CAMP_EXPAND(camp::get<ParamIds>(data.param_tuple) =
+                    camp::get<Seq>(values));
+  }
+
+
+  static inline LaunchDims calculateDimensions(Data const &data)
+  {
+    // combine with enclosed statements
+    LaunchDims enclosed_dims = enclosed_stmts_t::calculateDimensions(data);
+    return enclosed_dims;
+  }
+};
+
+
 //
 // Executor that handles reductions across a single CUDA thread warp
 //
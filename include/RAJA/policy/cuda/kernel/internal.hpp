@@ -23,8 +23,10 @@
 
 #if defined(RAJA_ENABLE_CUDA)
 
+#include <atomic>
 #include <cassert>
 #include <climits>
+#include <utility>
 
 #include "camp/camp.hpp"
 
@@ -128,187 +130,19 @@ struct LaunchDims {
 };
 
 
-struct CudaFixedMaxBlocksData
-{
-  int multiProcessorCount;
-  int maxThreadsPerMultiProcessor;
-};
-
 RAJA_INLINE
 size_t cuda_max_blocks(size_t block_size)
 {
-  static CudaFixedMaxBlocksData data = {-1, -1};
+  cudaDeviceProp& prop = cuda::device_prop();
 
-  if (data.multiProcessorCount < 0) {
-    cudaDeviceProp& prop = cuda::device_prop();
-    data.multiProcessorCount = prop.multiProcessorCount;
-    data.maxThreadsPerMultiProcessor = prop.maxThreadsPerMultiProcessor;
-  }
-
-  size_t max_blocks = data.multiProcessorCount *
-                  (data.maxThreadsPerMultiProcessor / block_size);
+  size_t max_blocks = prop.multiProcessorCount *
+                  (prop.maxThreadsPerMultiProcessor / block_size);
 
   // printf("MAX_BLOCKS=%d\n", max_blocks);
 
   return max_blocks;
 }
 
-struct CudaOccMaxBlocksThreadsData
-{
-  int prev_shmem_size;
-  int max_blocks;
-  int max_threads;
-};
-
-template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
-RAJA_INLINE
-void cuda_occupancy_max_blocks_threads(Func&& func, int shmem_size,
-                                       size_t &max_blocks, size_t &max_threads)
-{
-  static CudaOccMaxBlocksThreadsData data = {-1, -1, -1};
-
-  if (data.prev_shmem_size != shmem_size) {
-
-    cudaErrchk(cudaOccupancyMaxPotentialBlockSize(
-        &data.max_blocks, &data.max_threads, func, shmem_size));
-
-    data.prev_shmem_size = shmem_size;
-
-  }
-
-  max_blocks  = data.max_blocks;
-  max_threads = data.max_threads;
-
-}
-
-struct CudaOccMaxBlocksFixedThreadsData
-{
-  int prev_shmem_size;
-  int max_blocks;
-  int multiProcessorCount;
-};
-
-template < typename RAJA_UNUSED_ARG(UniqueMarker), size_t num_threads, typename Func >
-RAJA_INLINE
-void cuda_occupancy_max_blocks(Func&& func, int shmem_size,
-                               size_t &max_blocks)
-{
-  static CudaOccMaxBlocksFixedThreadsData data = {-1, -1, -1};
-
-  if (data.prev_shmem_size != shmem_size) {
-
-    cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-        &data.max_blocks, func, num_threads, shmem_size));
-
-    if (data.multiProcessorCount < 0) {
-
-      data.multiProcessorCount = cuda::device_prop().multiProcessorCount;
-
-    }
-
-    data.max_blocks *= data.multiProcessorCount;
-
-    data.prev_shmem_size = shmem_size;
-
-  }
-
-  max_blocks = data.max_blocks;
-
-}
-
-struct CudaOccMaxBlocksVariableThreadsData
-{
-  int prev_shmem_size;
-  size_t prev_num_threads;
-  size_t max_blocks;
-  int multiProcessorCount;
-};
-
-template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
-RAJA_INLINE
-void cuda_occupancy_max_blocks(Func&& func, int shmem_size,
-                               size_t &max_blocks, size_t num_threads)
-{
-  static CudaOccMaxBlocksVariableThreadsData data = {0, 0, 0, 0};
-
-  if ( data.prev_shmem_size  != shmem_size ||
-       data.prev_num_threads != num_threads ) {
-
-    int max_blocks(0);
-    cudaErrchk(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &max_blocks, func, static_cast<int>(num_threads), shmem_size));
-
-    data.max_blocks = max_blocks;
-
-    if (data.multiProcessorCount < 0) {
-
-      data.multiProcessorCount = cuda::device_prop().multiProcessorCount;
-
-    }
-
-    data.max_blocks *= data.multiProcessorCount;
-
-    data.prev_shmem_size  = shmem_size;
-    data.prev_num_threads = num_threads;
-
-  }
-
-  max_blocks = data.max_blocks;
-
-}
-
-
-
-template <camp::idx_t cur_stmt, camp::idx_t num_stmts, typename StmtList>
-struct CudaStatementListExecutorHelper {
-
-  using next_helper_t =
-      CudaStatementListExecutorHelper<cur_stmt + 1, num_stmts, StmtList>;
-
-  using cur_stmt_t = camp::at_v<StmtList, cur_stmt>;
-
-  template <typename Data>
-  inline static RAJA_DEVICE void exec(Data &data, bool thread_active)
-  {
-    // Execute stmt
-    cur_stmt_t::exec(data, thread_active);
-
-    // Execute next stmt
-    next_helper_t::exec(data, thread_active);
-  }
-
-
-  template <typename Data>
-  inline static LaunchDims calculateDimensions(Data &data)
-  {
-    // Compute this statements launch dimensions
-    LaunchDims statement_dims = cur_stmt_t::calculateDimensions(data);
-
-    // call the next statement in the list
-    LaunchDims next_dims = next_helper_t::calculateDimensions(data);
-
-    // Return the maximum of the two
-    return statement_dims.max(next_dims);
-  }
-};
-
-template <camp::idx_t num_stmts, typename StmtList>
-struct CudaStatementListExecutorHelper<num_stmts, num_stmts, StmtList> {
-
-  template <typename Data>
-  inline static RAJA_DEVICE void exec(Data &, bool)
-  {
-    // nop terminator
-  }
-
-  template <typename Data>
-  inline static LaunchDims calculateDimensions(Data &)
-  {
-    return LaunchDims();
-  }
-};
-
-
 template <typename Data, typename Policy, typename Types>
 struct CudaStatementExecutor;
 
@@ -329,8 +163,11 @@ struct CudaStatementListExecutor<Data, StatementList<Stmts...>, Types> {
   RAJA_DEVICE
   void exec(Data &data, bool thread_active)
   {
-    // Execute statements in order with helper class
-    CudaStatementListExecutorHelper<0, num_stmts, enclosed_stmts_t>::exec(data, thread_active);
+    // Execute statements in order, braced initializers are evaluated in
+    // order
+    int seq[] = {0, (CudaStatementExecutor<Data, Stmts, Types>::exec(
+                         data, thread_active), 0)...};
+    RAJA_UNUSED_VAR(seq);
   }
 
 
@@ -339,9 +176,13 @@ struct CudaStatementListExecutor<Data, StatementList<Stmts...>, Types> {
   inline
   LaunchDims calculateDimensions(Data const &data)
   {
-    // Compute this statements launch dimensions
-    return CudaStatementListExecutorHelper<0, num_stmts, enclosed_stmts_t>::
-        calculateDimensions(data);
+    // The maximum of the launch dimensions of the statements
+    LaunchDims dims;
+    int seq[] = {0, (dims = dims.max(
+                         CudaStatementExecutor<Data, Stmts, Types>::
+                             calculateDimensions(data)), 0)...};
+    RAJA_UNUSED_VAR(seq);
+    return dims;
   }
 };
 
@@ -45,6 +45,26 @@ __global__ void launch_global_fcn(BODY body_in)
   body(ctx);
 }
 
+//! launch kernel with forall params, each team combines the reducer values
+//  of its threads in shared memory and then the teams combine them once
+template <typename EXEC_POL, typename BODY, typename ReduceParams>
+__global__ void launch_global_fcn_params(BODY body_in, ReduceParams reduce_params)
+{
+  LaunchContext ctx;
+
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(body_in);
+  auto& body = privatizer.get_priv();
+
+  //Set pointer to shared memory
+  extern __shared__ char raja_shmem_ptr[];
+  ctx.shared_mem_ptr = raja_shmem_ptr;
+
+  RAJA::expt::invoke_body(reduce_params, body, ctx);
+
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(reduce_params);
+}
+
 template <bool async>
 struct LaunchExecute<RAJA::cuda_launch_t<async, 1>> {
 // cuda_launch_t num_threads set to 1, but not used in launch of kernel
@@ -73,6 +93,10 @@ struct LaunchExecute<RAJA::cuda_launch_t<async, 1>> {
                           static_cast<cuda_dim_member_t>(params.threads.value[1]),
                           static_cast<cuda_dim_member_t>(params.threads.value[2]) };
 
+    cuda_dim_t clusterSize{ static_cast<cuda_dim_member_t>(params.clusters.value[0]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[1]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[2]) };
+
     // Only launch kernel if we have something to iterate over
     constexpr cuda_dim_member_t zero = 0;
     if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
@@ -92,7 +116,7 @@ struct LaunchExecute<RAJA::cuda_launch_t<async, 1>> {
         //
         void *args[] = {(void*)&body};
         {
-          RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
+          RAJA::cuda::launch_cluster((const void*)func, gridSize, blockSize, clusterSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
         }
       }
 
@@ -102,6 +126,194 @@ struct LaunchExecute<RAJA::cuda_launch_t<async, 1>> {
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY_IN, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in, ReduceParams &launch_reducers)
+  {
+
+    using BODY = camp::decay<BODY_IN>;
+
+    using EXEC_POL = RAJA::cuda_launch_t<async, 1>;
+
+    auto func = launch_global_fcn_params<EXEC_POL, BODY, camp::decay<ReduceParams>>;
+
+    // Get the concrete resource
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(params.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(params.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[2]) };
+
+    cuda_dim_t clusterSize{ static_cast<cuda_dim_member_t>(params.clusters.value[0]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[1]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr cuda_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      RAJA::cuda::detail::cudaInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = cuda_res;
+
+      {
+        RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers, launch_info);
+
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::cuda::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, cuda_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel
+        //
+        void *args[] = {(void*)&body, (void*)&launch_reducers};
+        {
+          RAJA::cuda::launch_cluster((const void*)func, gridSize, blockSize, clusterSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
+        }
+
+        RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers, launch_info);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+template <bool async>
+struct LaunchExecute<RAJA::policy::cuda::cuda_launch_cooperative_t<async>> {
+
+  template <typename BODY_IN>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    auto func = launch_global_fcn<BODY>;
+
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(params.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(params.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr cuda_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      {
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::cuda::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, cuda_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel cooperatively, fails if the grid is larger
+        // than the number of blocks that can be resident at once
+        //
+        void *args[] = {(void*)&body};
+        RAJA::cuda::launch_cooperative((const void*)func, gridSize, blockSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template <typename BODY_IN, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in, ReduceParams &launch_reducers)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    using EXEC_POL = RAJA::policy::cuda::cuda_launch_cooperative_t<async>;
+
+    auto func = launch_global_fcn_params<EXEC_POL, BODY, camp::decay<ReduceParams>>;
+
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(params.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(params.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr cuda_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      RAJA::cuda::detail::cudaInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = cuda_res;
+
+      {
+        RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers, launch_info);
+
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::cuda::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, cuda_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel cooperatively, fails if the grid is larger
+        // than the number of blocks that can be resident at once
+        //
+        void *args[] = {(void*)&body, (void*)&launch_reducers};
+        RAJA::cuda::launch_cooperative((const void*)func, gridSize, blockSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
+
+        RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers, launch_info);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
 };
 
 
@@ -123,6 +335,26 @@ __launch_bounds__(num_threads, BLOCKS_PER_SM) __global__
   body(ctx);
 }
 
+template <typename EXEC_POL, typename BODY, int num_threads, size_t BLOCKS_PER_SM, typename ReduceParams>
+__launch_bounds__(num_threads, BLOCKS_PER_SM) __global__
+    void launch_global_fcn_fixed_params(BODY body_in, ReduceParams reduce_params)
+{
+
+  LaunchContext ctx;
+
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(body_in);
+  auto& body = privatizer.get_priv();
+
+  //Set pointer to shared memory
+  extern __shared__ char raja_shmem_ptr[];
+  ctx.shared_mem_ptr = raja_shmem_ptr;
+
+  RAJA::expt::invoke_body(reduce_params, body, ctx);
+
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(reduce_params);
+}
+
 template <bool async, int nthreads, size_t BLOCKS_PER_SM>
 struct LaunchExecute<RAJA::policy::cuda::cuda_launch_explicit_t<async, nthreads, BLOCKS_PER_SM>> {
 
@@ -150,6 +382,10 @@ struct LaunchExecute<RAJA::policy::cuda::cuda_launch_explicit_t<async, nthreads,
                           static_cast<cuda_dim_member_t>(params.threads.value[1]),
                           static_cast<cuda_dim_member_t>(params.threads.value[2]) };
 
+    cuda_dim_t clusterSize{ static_cast<cuda_dim_member_t>(params.clusters.value[0]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[1]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[2]) };
+
     // Only launch kernel if we have something to iterate over
     constexpr cuda_dim_member_t zero = 0;
     if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
@@ -169,8 +405,78 @@ struct LaunchExecute<RAJA::policy::cuda::cuda_launch_explicit_t<async, nthreads,
         //
         void *args[] = {(void*)&body};
         {
-          RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
+          RAJA::cuda::launch_cluster((const void*)func, gridSize, blockSize, clusterSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
+        }
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template <typename BODY_IN, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in, ReduceParams &launch_reducers)
+  {
+
+    using BODY = camp::decay<BODY_IN>;
+
+    using EXEC_POL = RAJA::policy::cuda::cuda_launch_explicit_t<async, nthreads, BLOCKS_PER_SM>;
+
+    auto func = launch_global_fcn_fixed_params<EXEC_POL, BODY, nthreads, BLOCKS_PER_SM, camp::decay<ReduceParams>>;
+
+    //Get the concrete resource
+    resources::Cuda cuda_res = res.get<RAJA::resources::Cuda>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    cuda_dim_t gridSize{ static_cast<cuda_dim_member_t>(params.teams.value[0]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[1]),
+                         static_cast<cuda_dim_member_t>(params.teams.value[2]) };
+
+    cuda_dim_t blockSize{ static_cast<cuda_dim_member_t>(params.threads.value[0]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[1]),
+                          static_cast<cuda_dim_member_t>(params.threads.value[2]) };
+
+    cuda_dim_t clusterSize{ static_cast<cuda_dim_member_t>(params.clusters.value[0]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[1]),
+                            static_cast<cuda_dim_member_t>(params.clusters.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr cuda_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      RAJA::cuda::detail::cudaInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = cuda_res;
+
+      {
+        RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers, launch_info);
+
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::cuda::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, cuda_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel
+        //
+        void *args[] = {(void*)&body, (void*)&launch_reducers};
+        {
+          RAJA::cuda::launch_cluster((const void*)func, gridSize, blockSize, clusterSize, args, params.shared_mem_size, cuda_res, async, kernel_name);
         }
+
+        RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers, launch_info);
       }
 
       RAJA_FT_END;
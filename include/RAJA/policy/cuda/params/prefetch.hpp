@@ -0,0 +1,46 @@
+#ifndef CUDA_PREFETCH_PARAM_HPP
+#define CUDA_PREFETCH_PARAM_HPP
+
+#if defined(RAJA_CUDA_ACTIVE)
+
+#include <cuda.h>
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/prefetch.hpp"
+#include "RAJA/pattern/params/prefetch.hpp"
+
+namespace RAJA {
+namespace expt {
+namespace detail {
+
+  template<camp::idx_t... Seq, typename... Views>
+  void prefetch_views(camp::idx_seq<Seq...>, Prefetch<Views...>& pf, resources::Cuda res)
+  {
+    CAMP_EXPAND(RAJA::prefetch(camp::get<Seq>(pf.views), res));
+  }
+
+  // Init
+  template<typename EXEC_POL, typename... Views>
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  init(Prefetch<Views...>& pf, const RAJA::cuda::detail::cudaInfo & cs)
+  {
+    prefetch_views(camp::make_idx_seq_t<sizeof...(Views)>{}, pf, cs.res);
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename... Views, typename... Args>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  combine(Prefetch<Views...>&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Views>
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  resolve(Prefetch<Views...>&, const RAJA::cuda::detail::cudaInfo &) {}
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif
+
+#endif //  CUDA_PREFETCH_PARAM_HPP
@@ -8,6 +8,8 @@
 #include "RAJA/policy/cuda/reduce.hpp"
 #include "RAJA/pattern/params/reducer.hpp"
 
+#include <algorithm>
+
 namespace RAJA {
 namespace expt {
 namespace detail {
@@ -33,12 +35,105 @@ namespace detail {
   // Resolve
   template<typename EXEC_POL, typename OP, typename T>
   camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
-  resolve(Reducer<OP, T>& red) {
+  resolve(Reducer<OP, T>& red, const RAJA::cuda::detail::cudaInfo &) {
     cudaDeviceSynchronize();
     cudaMemcpy(&red.val, red.devicetarget, sizeof(T), cudaMemcpyDeviceToHost);
     *red.target = OP{}(red.val, *red.target);
   }
 
+  //
+  // Several Reducers in one forall are combined together, each block
+  // reduces all of their values in one shared memory pass
+  //
+
+  template<typename EXEC_POL>
+  struct fuses_reducer_combine<EXEC_POL,
+                               camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >>
+      : std::true_type {};
+
+  // Combine
+  template<typename EXEC_POL, typename... Reds>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  combine_fused(Reds&... reds) {
+    RAJA::cuda::impl::expt::grid_reduce_fused(camp::make_idx_seq_t<sizeof...(Reds)>{}, reds...);
+  }
+
+  //
+  // DeferredReducer combines into the device accessible target on the device
+  // and needs no temporary memory or host synchronization
+  //
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  init(DeferredReducer<OP, T>&, const RAJA::cuda::detail::cudaInfo &)
+  { }
+
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  combine(DeferredReducer<OP, T>& red) {
+    RAJA::cuda::impl::expt::block_atomic_reduce(red);
+  }
+
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  resolve(DeferredReducer<OP, T>&, const RAJA::cuda::detail::cudaInfo &)
+  { }
+
+  //
+  // MultiReducer privatizes the bins in slices of device memory, each
+  // slice is shared by the blocks with the same index modulo the number of
+  // slices and the slices are combined on the host in resolve.
+  //
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  init(MultiReducer<OP, T>& red, const RAJA::cuda::detail::cudaInfo & cs)
+  {
+    const size_t num_blocks = cs.gridDim.x * cs.gridDim.y * cs.gridDim.z;
+    const size_t num_sms = RAJA::cuda::device_prop().multiProcessorCount;
+    red.bins.num_slices = std::max(std::min(num_blocks, num_sms), size_t(1));
+
+    const size_t len = red.bins.num_slices * red.bins.num_bins;
+    red.bins.data = RAJA::cuda::device_mempool_type::getInstance().template malloc<T>(len);
+
+    T* slices = RAJA::cuda::pinned_mempool_type::getInstance().template malloc<T>(len);
+    red.fill_slices(slices, red.bins.num_slices);
+    ::RAJA::resources::Cuda res = cs.res;
+    cudaErrchk(cudaMemcpyAsync(red.bins.data, slices, len * sizeof(T),
+                               cudaMemcpyHostToDevice, res.get_stream()));
+    res.wait();
+    RAJA::cuda::pinned_mempool_type::getInstance().free(slices);
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  combine(MultiReducer<OP, T>&) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_cuda_policy<EXEC_POL> >
+  resolve(MultiReducer<OP, T>& red, const RAJA::cuda::detail::cudaInfo & cs)
+  {
+    const size_t len = red.bins.num_slices * red.bins.num_bins;
+    T* slices = RAJA::cuda::pinned_mempool_type::getInstance().template malloc<T>(len);
+    ::RAJA::resources::Cuda res = cs.res;
+    cudaErrchk(cudaMemcpyAsync(slices, red.bins.data, len * sizeof(T),
+                               cudaMemcpyDeviceToHost, res.get_stream()));
+    res.wait();
+    red.resolve_slices(slices, red.bins.num_slices);
+    RAJA::cuda::pinned_mempool_type::getInstance().free(slices);
+    RAJA::cuda::device_mempool_type::getInstance().free(red.bins.data);
+    red.bins.data = nullptr;
+  }
+
 } //  namespace detail
 } //  namespace expt
 } //  namespace RAJA
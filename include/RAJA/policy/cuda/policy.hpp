@@ -85,6 +85,40 @@ struct cuda_exec_explicit : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::cuda> {
 };
 
+/// forall execution policy that sizes the grid with the CUDA occupancy
+/// calculator, capping the number of blocks at the number that can be
+/// resident on the device, and iterates with a grid-stride loop
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async = false>
+struct cuda_exec_occ_explicit : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::forall,
+                       detail::get_launch<Async>::value,
+                       RAJA::Platform::cuda> {
+};
+
+/// forall execution policy whose block size is chosen at run time with
+/// RAJA::cuda::set_exec_block_size or the RAJA_CUDA_BLOCK_SIZE environment
+/// variable, up to MAX_BLOCK_SIZE, the block size the kernel is compiled
+/// for with __launch_bounds__
+template <size_t MAX_BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async = false>
+struct cuda_exec_rt_explicit : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::forall,
+                       detail::get_launch<Async>::value,
+                       RAJA::Platform::cuda> {
+};
+
+/// forall execution policy giving each thread ITEMS_PER_THREAD iterates,
+/// BLOCK_SIZE apart, in an unrolled loop so their loads are in flight
+/// together
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, size_t BLOCKS_PER_SM, bool Async = false>
+struct cuda_exec_ilp_explicit : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::forall,
+                       detail::get_launch<Async>::value,
+                       RAJA::Platform::cuda> {
+};
+
 template <bool Async, int num_threads, size_t BLOCKS_PER_SM = policy::cuda::MIN_BLOCKS_PER_SM>
 struct cuda_launch_explicit_t : public RAJA::make_policy_pattern_launch_platform_t<
                                 RAJA::Policy::cuda,
@@ -93,12 +127,47 @@ struct cuda_launch_explicit_t : public RAJA::make_policy_pattern_launch_platform
                                 RAJA::Platform::cuda> {
 };
 
+///
+/// Launch policy for RAJA::launch kernels that synchronize the whole grid
+/// with LaunchContext::grid_sync, the kernel is launched with
+/// cudaLaunchCooperativeKernel so all blocks must be resident at once
+///
+template <bool Async>
+struct cuda_launch_cooperative_t : public RAJA::make_policy_pattern_launch_platform_t<
+                                   RAJA::Policy::cuda,
+                                   RAJA::Pattern::region,
+                                   detail::get_launch<Async>::value,
+                                   RAJA::Platform::cuda> {
+};
 
+///
+/// Hyperplane policy for RAJA::kernel that runs all the hyperplanes of a
+/// statement::Hyperplane in one persistent kernel of BLOCK_SIZE threads per
+/// block, the blocks wait on a completion count between hyperplanes. The
+/// kernel is launched with cudaLaunchCooperativeKernel so all blocks are resident
+///
+template <size_t BLOCK_SIZE>
+struct cuda_wavefront_exec : public RAJA::make_policy_pattern_launch_platform_t<
+                           RAJA::Policy::cuda,
+                           RAJA::Pattern::forall,
+                           RAJA::Launch::sync,
+                           RAJA::Platform::cuda> {
+};
 
 
-//
-// NOTE: There is no Index set segment iteration policy for CUDA
-//
+
+
+///
+/// Index set segment iteration policy that runs all the segments in one
+/// kernel, as in ExecPolicy<cuda_segit_fused, cuda_exec<256>>, instead of
+/// launching a kernel per segment like seq_segit
+///
+struct cuda_segit_fused : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::forall,
+                       RAJA::Launch::undefined,
+                       RAJA::Platform::cuda> {
+};
 
 ///
 /// WorkGroup execution policies
@@ -122,6 +191,16 @@ struct unordered_cuda_loop_y_block_iter_x_threadblock_average
                        RAJA::Platform::cuda> {
 };
 
+/// execute the enqueued loops in an unordered fashion by giving each loop a
+/// number of blocks in the x direction proportional to its iteration count
+/// and mapping loop iterations to threads in the x direction
+struct unordered_cuda_loop_x_block_balanced
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::cuda,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::cuda> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -130,7 +209,12 @@ struct unordered_cuda_loop_y_block_iter_x_threadblock_average
 ///////////////////////////////////////////////////////////////////////
 ///
 
-template <bool maybe_atomic>
+//
+// maybe_atomic reductions combine the values of the blocks with atomics
+// when the type supports them, auto_atomic reductions only do so for
+// launches with few blocks and otherwise reduce the blocks in a tree
+//
+template <bool maybe_atomic, bool auto_atomic = false>
 struct cuda_reduce_base
     : public RAJA::
           make_policy_pattern_launch_platform_t<RAJA::Policy::cuda,
@@ -152,10 +236,51 @@ struct cuda_atomic_explicit{};
 //
 using cuda_atomic = cuda_atomic_explicit<loop_atomic>;
 
+//
+// Cuda atomic policy for using cuda atomics with the given
+// RAJA::atomic_scope on the device and the provided Policy on the host
+//
+template<typename scope, typename host_policy>
+struct cuda_atomic_scoped_explicit{};
+
+template<typename host_policy>
+using cuda_atomic_block_explicit =
+    cuda_atomic_scoped_explicit<atomic_scope::block, host_policy>;
+
+template<typename host_policy>
+using cuda_atomic_device_explicit =
+    cuda_atomic_scoped_explicit<atomic_scope::device, host_policy>;
+
+template<typename host_policy>
+using cuda_atomic_system_explicit =
+    cuda_atomic_scoped_explicit<atomic_scope::system, host_policy>;
+
+//
+// Default scoped cuda atomic policies use non-atomics on the host
+//
+using cuda_atomic_block = cuda_atomic_block_explicit<loop_atomic>;
+using cuda_atomic_device = cuda_atomic_device_explicit<loop_atomic>;
+using cuda_atomic_system = cuda_atomic_system_explicit<loop_atomic>;
+
+//
+// Cuda atomic policy that combines the atomics of the threads in a warp that
+// target the same address so one thread per address performs the atomic on
+// the device, and uses the provided Policy on the host
+//
+template<typename host_policy>
+struct cuda_atomic_aggregated_explicit{};
+
+//
+// Default cuda aggregated atomic policy uses non-atomics on the host
+//
+using cuda_atomic_aggregated = cuda_atomic_aggregated_explicit<loop_atomic>;
+
 using cuda_reduce = cuda_reduce_base<false>;
 
 using cuda_reduce_atomic = cuda_reduce_base<true>;
 
+using cuda_reduce_auto = cuda_reduce_base<true, true>;
+
 
 // Policy for RAJA::statement::Reduce that reduces threads in a block
 // down to threadIdx 0
@@ -226,7 +351,15 @@ struct cuda_synchronize : make_policy_pattern_launch_t<Policy::cuda,
 }  // end namespace cuda
 }  // end namespace policy
 
+namespace type_traits
+{
+template <>
+struct is_fused_segit_policy<policy::cuda::cuda_segit_fused> : std::true_type {
+};
+}  // end namespace type_traits
+
 using policy::cuda::cuda_exec_explicit;
+using policy::cuda::cuda_segit_fused;
 
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM>
 using cuda_exec_explicit_async = policy::cuda::cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>;
@@ -237,6 +370,33 @@ using cuda_exec = policy::cuda::cuda_exec_explicit<BLOCK_SIZE, policy::cuda::MIN
 template <size_t BLOCK_SIZE>
 using cuda_exec_async = policy::cuda::cuda_exec_explicit<BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, true>;
 
+using policy::cuda::cuda_exec_occ_explicit;
+
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM>
+using cuda_exec_occ_explicit_async = policy::cuda::cuda_exec_occ_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>;
+
+template <size_t BLOCK_SIZE, bool ASYNC = false>
+using cuda_exec_occ = policy::cuda::cuda_exec_occ_explicit<BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, ASYNC>;
+
+template <size_t BLOCK_SIZE>
+using cuda_exec_occ_async = policy::cuda::cuda_exec_occ_explicit<BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, true>;
+
+using policy::cuda::cuda_exec_rt_explicit;
+
+template <size_t MAX_BLOCK_SIZE, bool ASYNC = false>
+using cuda_exec_rt = policy::cuda::cuda_exec_rt_explicit<MAX_BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, ASYNC>;
+
+template <size_t MAX_BLOCK_SIZE>
+using cuda_exec_rt_async = policy::cuda::cuda_exec_rt_explicit<MAX_BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, true>;
+
+using policy::cuda::cuda_exec_ilp_explicit;
+
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD, bool ASYNC = false>
+using cuda_exec_ilp = policy::cuda::cuda_exec_ilp_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, policy::cuda::MIN_BLOCKS_PER_SM, ASYNC>;
+
+template <size_t BLOCK_SIZE, size_t ITEMS_PER_THREAD>
+using cuda_exec_ilp_async = policy::cuda::cuda_exec_ilp_explicit<BLOCK_SIZE, ITEMS_PER_THREAD, policy::cuda::MIN_BLOCKS_PER_SM, true>;
+
 using policy::cuda::cuda_work_explicit;
 
 template <size_t BLOCK_SIZE, bool ASYNC = false>
@@ -246,13 +406,24 @@ template <size_t BLOCK_SIZE>
 using cuda_work_async = policy::cuda::cuda_work_explicit<BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, true>;
 
 using policy::cuda::unordered_cuda_loop_y_block_iter_x_threadblock_average;
+using policy::cuda::unordered_cuda_loop_x_block_balanced;
 
 using policy::cuda::cuda_atomic;
 using policy::cuda::cuda_atomic_explicit;
+using policy::cuda::cuda_atomic_aggregated;
+using policy::cuda::cuda_atomic_aggregated_explicit;
+using policy::cuda::cuda_atomic_scoped_explicit;
+using policy::cuda::cuda_atomic_block_explicit;
+using policy::cuda::cuda_atomic_device_explicit;
+using policy::cuda::cuda_atomic_system_explicit;
+using policy::cuda::cuda_atomic_block;
+using policy::cuda::cuda_atomic_device;
+using policy::cuda::cuda_atomic_system;
 
 using policy::cuda::cuda_reduce_base;
 using policy::cuda::cuda_reduce;
 using policy::cuda::cuda_reduce_atomic;
+using policy::cuda::cuda_reduce_auto;
 
 using policy::cuda::cuda_block_reduce;
 using policy::cuda::cuda_warp_reduce;
@@ -272,6 +443,9 @@ using policy::cuda::cuda_synchronize;
   template <bool Async, int num_threads = 1>
   using cuda_launch_t = policy::cuda::cuda_launch_explicit_t<Async, num_threads, policy::cuda::MIN_BLOCKS_PER_SM>;
 
+using policy::cuda::cuda_launch_cooperative_t;
+using policy::cuda::cuda_wavefront_exec;
+
 
 /*!
  * Maps segment indices to CUDA threads.
@@ -324,6 +498,22 @@ using cuda_block_y_loop = cuda_block_xyz_loop<1>;
 using cuda_block_z_loop = cuda_block_xyz_loop<2>;
 
 
+/*!
+ * Collapse policy that linearizes the iteration space of the collapsed
+ * arguments and maps it onto every thread of the grid in one dimension,
+ * blockIdx.xyz*blockDim.xyz+threadIdx.xyz, with grid-stride looping.
+ * The last argument of the ArgList varies fastest. This keeps all threads
+ * busy for shapes like 5x7x1000 that map poorly onto separate thread and
+ * block dimensions.
+ */
+template<int dim>
+struct cuda_flatten_global_xyz_loop{};
+
+using cuda_flatten_global_x_loop = cuda_flatten_global_xyz_loop<0>;
+using cuda_flatten_global_y_loop = cuda_flatten_global_xyz_loop<1>;
+using cuda_flatten_global_z_loop = cuda_flatten_global_xyz_loop<2>;
+
+
 
 
 namespace internal{
@@ -0,0 +1,135 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the CUDA prefetch and memory advice methods for
+ *          Views of managed memory.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_prefetch_HPP
+#define RAJA_policy_cuda_prefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_CUDA_ACTIVE)
+
+#include <cuda_runtime.h>
+
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#include "RAJA/util/Prefetch.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace cuda
+{
+
+namespace detail
+{
+
+/*!
+ * \brief True if ptr is managed memory that can be prefetched to the
+ *        current device.
+ *
+ * Other memory is skipped by the prefetch methods, so they can be used with
+ * views of any memory.
+ */
+inline bool is_prefetchable(const void* ptr)
+{
+  cudaPointerAttributes attributes;
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    cudaGetLastError(); // clear the error from non-cuda memory
+    return false;
+  }
+  if (attributes.type != cudaMemoryTypeManaged) {
+    return false;
+  }
+  int device = -1;
+  cudaErrchk(cudaGetDevice(&device));
+  int concurrent_managed_access = 0;
+  cudaErrchk(cudaDeviceGetAttribute(&concurrent_managed_access,
+                                    cudaDevAttrConcurrentManagedAccess,
+                                    device));
+  return concurrent_managed_access != 0;
+}
+
+inline void advise(const void* ptr, size_t bytes, MemAdvice advice)
+{
+  int device = -1;
+  cudaErrchk(cudaGetDevice(&device));
+  switch (advice) {
+    case MemAdvice::ReadMostly:
+      cudaErrchk(cudaMemAdvise(ptr, bytes, cudaMemAdviseSetReadMostly, device));
+      break;
+    case MemAdvice::PreferredLocation:
+      cudaErrchk(cudaMemAdvise(ptr, bytes, cudaMemAdviseSetPreferredLocation, device));
+      break;
+    case MemAdvice::AccessedBy:
+      cudaErrchk(cudaMemAdvise(ptr, bytes, cudaMemAdviseSetAccessedBy, device));
+      break;
+    case MemAdvice::None:
+      break;
+  }
+}
+
+inline void prefetch(const void* ptr, size_t bytes, resources::Cuda res)
+{
+  int device = -1;
+  cudaErrchk(cudaGetDevice(&device));
+  cudaErrchk(cudaMemPrefetchAsync(ptr, bytes, device, res.get_stream()));
+}
+
+}  // namespace detail
+
+}  // namespace cuda
+
+/*!
+ * \brief Give the advice of a ManagedView for its memory, relative to the
+ *        current device.  Does nothing for memory that is not managed.
+ */
+template <typename ViewType>
+RAJA_INLINE void advise(ManagedView<ViewType> const& view, resources::Cuda)
+{
+  const void* ptr = detail::view_data(view);
+  const size_t bytes = detail::view_bytes(view);
+  if (bytes > 0 && cuda::detail::is_prefetchable(ptr)) {
+    cuda::detail::advise(ptr, bytes, view.advice);
+  }
+}
+
+/*!
+ * \brief Prefetch the memory of a view to the current device on the stream
+ *        of res, after giving the advice of a ManagedView.  Does nothing
+ *        for memory that is not managed.
+ *
+ *     RAJA::resources::Cuda res;
+ *     RAJA::prefetch(v, res);
+ *     RAJA::forall<RAJA::cuda_exec_async<256>>(res, range, body);
+ */
+template <typename ViewType>
+RAJA_INLINE void prefetch(ViewType const& view, resources::Cuda res)
+{
+  const void* ptr = detail::view_data(view);
+  const size_t bytes = detail::view_bytes(view);
+  if (bytes > 0 && cuda::detail::is_prefetchable(ptr)) {
+    cuda::detail::advise(ptr, bytes, detail::get_mem_advice(view));
+    cuda::detail::prefetch(ptr, bytes, res);
+  }
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_CUDA_ACTIVE)
+
+#endif  // closing endif for header file include guard
@@ -31,6 +31,7 @@
 #include "RAJA/util/SoAArray.hpp"
 #include "RAJA/util/SoAPtr.hpp"
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/metrics.hpp"
 #include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -650,6 +651,185 @@ RAJA_DEVICE RAJA_INLINE bool grid_reduce(RAJA::expt::detail::Reducer<OP, T>& red
   return lastBlock && threadId == 0;
 }
 
+//! reduce values in block then atomically combine the block value into the
+//  reducer target, returns true if this thread combined into the target
+template <typename OP, typename T>
+RAJA_DEVICE RAJA_INLINE bool block_atomic_reduce(RAJA::expt::detail::Reducer<OP, T>& red) {
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  T temp = block_reduce<OP>(red.val, OP::identity());
+
+  // one thread per block combines into target
+  if (threadId == 0) {
+    RAJA::expt::detail::atomic_combine<OP>::apply(RAJA::cuda_atomic{}, red.target, temp);
+  }
+
+  return threadId == 0;
+}
+
+
+//
+// Fused reduction of several Reducer params. The values of all the
+// reducers go through the block together, so the block writes shared
+// memory and synchronizes once for the pack, and one counter finds the
+// last block for the pack.
+//
+
+//! reduce val over the lanes of each warp into the first lane
+template <typename OP, typename T>
+RAJA_DEVICE RAJA_INLINE T fused_warp_reduce(T val, int threadId, int numThreads)
+{
+  T temp = val;
+
+  if (numThreads % RAJA::policy::cuda::WARP_SIZE == 0) {
+
+    for (int i = 1; i < RAJA::policy::cuda::WARP_SIZE; i *= 2) {
+      T rhs = RAJA::cuda::impl::shfl_xor_sync(temp, i);
+      temp = OP{}(temp, rhs);
+    }
+
+  } else {
+
+    for (int i = 1; i < RAJA::policy::cuda::WARP_SIZE; i *= 2) {
+      int srcLane = threadId ^ i;
+      T rhs = RAJA::cuda::impl::shfl_sync(temp, srcLane);
+      // only add from threads that exist (don't double count own value)
+      if (srcLane < numThreads) {
+        temp = OP{}(temp, rhs);
+      }
+    }
+  }
+
+  return temp;
+}
+
+//! reduce the per warp values held by the lanes of the first warp
+template <typename OP, typename T>
+RAJA_DEVICE RAJA_INLINE T fused_warps_reduce(T val)
+{
+  for (int i = 1; i < RAJA::policy::cuda::MAX_WARPS; i *= 2) {
+    T rhs = RAJA::cuda::impl::shfl_xor_sync(val, i);
+    val = OP{}(val, rhs);
+  }
+  return val;
+}
+
+//! reduce each of vals in block into thread 0 with the matching OP
+template <typename... OPs, typename... Ts, camp::idx_t... Seq>
+RAJA_DEVICE RAJA_INLINE void block_reduce_fused(camp::list<OPs...>,
+                                                camp::idx_seq<Seq...>,
+                                                camp::tuple<Ts...>& vals)
+{
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  int warpId = threadId % RAJA::policy::cuda::WARP_SIZE;
+  int warpNum = threadId / RAJA::policy::cuda::WARP_SIZE;
+
+  // reduce each warp
+  CAMP_EXPAND(camp::get<Seq>(vals) =
+      fused_warp_reduce<OPs>(camp::get<Seq>(vals), threadId, numThreads));
+
+  static_assert(RAJA::policy::cuda::MAX_WARPS <= RAJA::policy::cuda::WARP_SIZE,
+               "Max Warps must be less than or equal to Warp Size for this algorithm to work");
+
+  // reduce per warp values
+  if (numThreads > RAJA::policy::cuda::WARP_SIZE) {
+
+    using shared_type =
+        camp::tuple<RAJA::detail::SoAArray<Ts, RAJA::policy::cuda::MAX_WARPS>...>;
+
+    // Need to separate declaration and initialization for clang-cuda
+    __shared__ unsigned char tmpsd[sizeof(shared_type)];
+
+    // Partial placement new: Should call new(tmpsd) here but recasting memory
+    // to avoid calling constructor/destructor in shared memory.
+    shared_type * sd = reinterpret_cast<shared_type *>(tmpsd);
+
+    // write per warp values of every reducer to shared memory
+    if (warpId == 0) {
+      CAMP_EXPAND(camp::get<Seq>(*sd).set(warpNum, camp::get<Seq>(vals)));
+    }
+
+    __syncthreads();
+
+    if (warpNum == 0) {
+
+      // read per warp values
+      const bool valid = warpId * RAJA::policy::cuda::WARP_SIZE < numThreads;
+
+      CAMP_EXPAND(camp::get<Seq>(vals) = fused_warps_reduce<OPs>(
+          valid ? camp::get<Seq>(*sd).get(warpId) : OPs::identity()));
+    }
+
+    __syncthreads();
+  }
+}
+
+//! counter used to find the last block of a fused reduction
+template <typename Red0, typename... Reds>
+RAJA_DEVICE RAJA_INLINE unsigned int* fused_device_count(Red0& red0, Reds&...)
+{
+  return red0.device_count;
+}
+
+//! reduce the values of several reducers in grid into their device targets
+template <typename... Reds, camp::idx_t... Seq>
+RAJA_DEVICE RAJA_INLINE void grid_reduce_fused(camp::idx_seq<Seq...> seq,
+                                               Reds&... reds)
+{
+  using ops = camp::list<typename Reds::op...>;
+
+  int numBlocks = gridDim.x * gridDim.y * gridDim.z;
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+  unsigned int wrap_around = numBlocks - 1;
+
+  int blockId = blockIdx.x + gridDim.x * blockIdx.y +
+                (gridDim.x * gridDim.y) * blockIdx.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  camp::tuple<typename Reds::value_type...> temps(reds.val...);
+
+  block_reduce_fused(ops{}, seq, temps);
+
+  // one thread per block writes to device_mem
+  bool lastBlock = false;
+  if (threadId == 0) {
+    CAMP_EXPAND(reds.device_mem.set(blockId, camp::get<Seq>(temps)));
+    // ensure writes visible to all threadblocks
+    __threadfence();
+    // increment counter, (wraps back to zero if old count == wrap_around)
+    unsigned int old_count = ::atomicInc(fused_device_count(reds...), wrap_around);
+    lastBlock = (old_count == wrap_around);
+  }
+
+  // returns non-zero value if any thread passes in a non-zero value
+  lastBlock = __syncthreads_or(lastBlock);
+
+  // last block accumulates values from device_mem
+  if (lastBlock) {
+    CAMP_EXPAND(camp::get<Seq>(temps) = Reds::op::identity());
+
+    for (int i = threadId; i < numBlocks; i += numThreads) {
+      CAMP_EXPAND(camp::get<Seq>(temps) =
+          typename Reds::op{}(camp::get<Seq>(temps), reds.device_mem.get(i)));
+    }
+
+    block_reduce_fused(ops{}, seq, temps);
+
+    // one thread returns the values
+    if (threadId == 0) {
+      CAMP_EXPAND(*(reds.devicetarget) = camp::get<Seq>(temps));
+    }
+  }
+}
+
 } //  namespace expt
 
 //! reduce values in grid into thread 0 of last running block
@@ -840,7 +1020,9 @@ public:
       rn->node_list = nullptr;
       resource_list = rn;
     }
-    Node* n = cuda::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    RAJA_METRICS_ADD("pinned_tally.allocations", 1);
+    Node* n = cuda::pinned_stream_cache_type::getInstance()
+                  .template malloc<Node>(res.get_stream(), 1);
     n->next = rn->node_list;
     rn->node_list = n;
     return &n->value;
@@ -863,7 +1045,7 @@ public:
       while (rn->node_list) {
         Node* n = rn->node_list;
         rn->node_list = n->next;
-        cuda::pinned_mempool_type::getInstance().free(n);
+        cuda::pinned_stream_cache_type::getInstance().free(n);
       }
       resource_list = rn->next;
       free(rn);
@@ -896,7 +1078,7 @@ struct Reduce_Data {
   mutable T value;
   T identity;
   unsigned int* device_count;
-  RAJA::detail::SoAPtr<T, device_mempool_type> device;
+  RAJA::detail::SoAPtr<T, device_reducer_mempool_type> device;
   bool own_device_ptr;
 
   Reduce_Data() : Reduce_Data(T(), T()){};
@@ -951,7 +1133,7 @@ struct Reduce_Data {
       cuda_dim_t gridDim = currentGridDim();
       size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
       device.allocate(numBlocks);
-      device_count = device_zeroed_mempool_type::getInstance()
+      device_count = device_zeroed_reducer_mempool_type::getInstance()
                          .template malloc<unsigned int>(1);
       own_device_ptr = true;
     }
@@ -965,7 +1147,7 @@ struct Reduce_Data {
     bool act = own_device_ptr;
     if (act) {
       device.deallocate();
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_zeroed_reducer_mempool_type::getInstance().free(device_count);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -1029,8 +1211,9 @@ struct ReduceAtomic_Data {
   {
     bool act = !device && setupReducers();
     if (act) {
-      device = device_mempool_type::getInstance().template malloc<T>(1);
-      device_count = device_zeroed_mempool_type::getInstance()
+      device =
+          device_reducer_mempool_type::getInstance().template malloc<T>(1);
+      device_count = device_zeroed_reducer_mempool_type::getInstance()
                          .template malloc<unsigned int>(1);
       own_device_ptr = true;
     }
@@ -1043,9 +1226,9 @@ struct ReduceAtomic_Data {
   {
     bool act = own_device_ptr;
     if (act) {
-      device_mempool_type::getInstance().free(device);
+      device_reducer_mempool_type::getInstance().free(device);
       device = nullptr;
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_zeroed_reducer_mempool_type::getInstance().free(device_count);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -1053,8 +1236,119 @@ struct ReduceAtomic_Data {
   }
 };
 
+//! Reduction data for Cuda Offload -- stores value, host pointer, and
+//! device pointers, and chooses per launch between the tree of
+//! Reduce_Data and the atomics of ReduceAtomic_Data
+template <typename Combiner, typename T>
+struct ReduceAuto_Data {
+
+  //! launches with at most this many blocks combine the values of the
+  //  blocks with atomics, larger launches reduce them in a tree to avoid
+  //  contention on a single address
+  static constexpr size_t atomic_max_blocks = 64;
+
+  mutable T value;
+  T identity;
+  unsigned int* device_count;
+  RAJA::detail::SoAPtr<T, device_reducer_mempool_type> device;
+  T* device_atomic;
+  bool use_atomic;
+  bool own_device_ptr;
+
+  ReduceAuto_Data() : ReduceAuto_Data(T(), T()){};
+
+  ReduceAuto_Data(T initValue, T identity_)
+      : value{initValue},
+        identity{identity_},
+        device_count{nullptr},
+        device{},
+        device_atomic{nullptr},
+        use_atomic{false},
+        own_device_ptr{false}
+  {
+  }
+
+  RAJA_HOST_DEVICE
+  ReduceAuto_Data(const ReduceAuto_Data& other)
+      : value{other.identity},
+        identity{other.identity},
+        device_count{other.device_count},
+        device{other.device},
+        device_atomic{other.device_atomic},
+        use_atomic{other.use_atomic},
+        own_device_ptr{false}
+  {
+  }
+
+  ReduceAuto_Data& operator=(const ReduceAuto_Data&) = default;
+
+  //! initialize output to identity to ensure never read
+  //  uninitialized memory
+  void init_grid_val(T* output) { *output = identity; }
+
+  //! reduce values in grid to single value, store in output
+  RAJA_DEVICE
+  void grid_reduce(T* output)
+  {
+    T temp = value;
+
+    bool last = use_atomic
+                    ? impl::grid_reduce_atomic<Combiner>(
+                          temp, identity, device_atomic, device_count)
+                    : impl::grid_reduce<Combiner>(
+                          temp, identity, device, device_count);
+    if (last) {
+      *output = temp;
+    }
+  }
+
+  //! check and setup for device
+  //  allocate device pointers for the path chosen by the grid size
+  bool setupForDevice()
+  {
+    bool act = !device.allocated() && !device_atomic && setupReducers();
+    if (act) {
+      cuda_dim_t gridDim = currentGridDim();
+      size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
+      use_atomic = numBlocks <= atomic_max_blocks;
+      if (use_atomic) {
+        device_atomic =
+            device_reducer_mempool_type::getInstance().template malloc<T>(1);
+      } else {
+        device.allocate(numBlocks);
+      }
+      device_count = device_zeroed_reducer_mempool_type::getInstance()
+                         .template malloc<unsigned int>(1);
+      own_device_ptr = true;
+    }
+    return act;
+  }
+
+  //! if own resources teardown device setup
+  //  free device pointers
+  bool teardownForDevice()
+  {
+    bool act = own_device_ptr;
+    if (act) {
+      if (use_atomic) {
+        device_reducer_mempool_type::getInstance().free(device_atomic);
+        device_atomic = nullptr;
+      } else {
+        device.deallocate();
+      }
+      device_zeroed_reducer_mempool_type::getInstance().free(device_count);
+      device_count = nullptr;
+      own_device_ptr = false;
+    }
+    return act;
+  }
+};
+
+template <typename Combiner, typename T>
+constexpr size_t ReduceAuto_Data<Combiner, T>::atomic_max_blocks;
+
 //! Cuda Reduction entity -- generalize on reduction, and type
-template <typename Combiner, typename T, bool maybe_atomic>
+template <typename Combiner, typename T, bool maybe_atomic, bool auto_atomic>
 class Reduce
 {
 public:
@@ -1067,8 +1361,11 @@ public:
         tally_or_val_ptr{new PinnedTally<T>},
         val(init_val, identity_)
   {
+    RAJA_METRICS_ADD("reduce.reducers", 1);
   }
 
+  //! reset the value, keeping the tally so later launches reuse the
+  //  cached buffers of earlier ones
   void reset(T in_val, T identity_ = Combiner::identity())
   {
     operator T();  // syncs device
@@ -1175,7 +1472,9 @@ private:
   //! cuda reduction data storage class and folding algorithm
   using reduce_data_type = typename std::conditional<
       maybe_atomic && RAJA::reduce::cuda::cuda_atomic_available<T>::value,
-      cuda::ReduceAtomic_Data<Combiner, T>,
+      typename std::conditional<auto_atomic,
+                                cuda::ReduceAuto_Data<Combiner, T>,
+                                cuda::ReduceAtomic_Data<Combiner, T>>::type,
       cuda::Reduce_Data<Combiner, T>>::type;
 
   //! storage for reduction data
@@ -1185,13 +1484,13 @@ private:
 }  // end namespace cuda
 
 //! specialization of ReduceSum for cuda_reduce
-template <bool maybe_atomic, typename T>
-class ReduceSum<cuda_reduce_base<maybe_atomic>, T>
-    : public cuda::Reduce<RAJA::reduce::sum<T>, T, maybe_atomic>
+template <bool maybe_atomic, bool auto_atomic, typename T>
+class ReduceSum<cuda_reduce_base<maybe_atomic, auto_atomic>, T>
+    : public cuda::Reduce<RAJA::reduce::sum<T>, T, maybe_atomic, auto_atomic>
 {
 
 public:
-  using Base = cuda::Reduce<RAJA::reduce::sum<T>, T, maybe_atomic>;
+  using Base = cuda::Reduce<RAJA::reduce::sum<T>, T, maybe_atomic, auto_atomic>;
   using Base::Base;
   //! enable operator+= for ReduceSum -- alias for combine()
   RAJA_HOST_DEVICE
@@ -1203,13 +1502,13 @@ public:
 };
 
 //! specialization of ReduceBitOr for cuda_reduce
-template <bool maybe_atomic, typename T>
-class ReduceBitOr<cuda_reduce_base<maybe_atomic>, T>
-    : public cuda::Reduce<RAJA::reduce::or_bit<T>, T, maybe_atomic>
+template <bool maybe_atomic, bool auto_atomic, typename T>
+class ReduceBitOr<cuda_reduce_base<maybe_atomic, auto_atomic>, T>
+    : public cuda::Reduce<RAJA::reduce::or_bit<T>, T, maybe_atomic, auto_atomic>
 {
 
 public:
-  using Base = cuda::Reduce<RAJA::reduce::or_bit<T>, T, maybe_atomic>;
+  using Base = cuda::Reduce<RAJA::reduce::or_bit<T>, T, maybe_atomic, auto_atomic>;
   using Base::Base;
   //! enable operator|= for ReduceBitOr -- alias for combine()
   RAJA_HOST_DEVICE
@@ -1221,13 +1520,13 @@ public:
 };
 
 //! specialization of ReduceBitAnd for cuda_reduce
-template <bool maybe_atomic, typename T>
-class ReduceBitAnd<cuda_reduce_base<maybe_atomic>, T>
-    : public cuda::Reduce<RAJA::reduce::and_bit<T>, T, maybe_atomic>
+template <bool maybe_atomic, bool auto_atomic, typename T>
+class ReduceBitAnd<cuda_reduce_base<maybe_atomic, auto_atomic>, T>
+    : public cuda::Reduce<RAJA::reduce::and_bit<T>, T, maybe_atomic, auto_atomic>
 {
 
 public:
-  using Base = cuda::Reduce<RAJA::reduce::and_bit<T>, T, maybe_atomic>;
+  using Base = cuda::Reduce<RAJA::reduce::and_bit<T>, T, maybe_atomic, auto_atomic>;
   using Base::Base;
   //! enable operator&= for ReduceBitAnd -- alias for combine()
   RAJA_HOST_DEVICE
@@ -1239,13 +1538,13 @@ public:
 };
 
 //! specialization of ReduceMin for cuda_reduce
-template <bool maybe_atomic, typename T>
-class ReduceMin<cuda_reduce_base<maybe_atomic>, T>
-    : public cuda::Reduce<RAJA::reduce::min<T>, T, maybe_atomic>
+template <bool maybe_atomic, bool auto_atomic, typename T>
+class ReduceMin<cuda_reduce_base<maybe_atomic, auto_atomic>, T>
+    : public cuda::Reduce<RAJA::reduce::min<T>, T, maybe_atomic, auto_atomic>
 {
 
 public:
-  using Base = cuda::Reduce<RAJA::reduce::min<T>, T, maybe_atomic>;
+  using Base = cuda::Reduce<RAJA::reduce::min<T>, T, maybe_atomic, auto_atomic>;
   using Base::Base;
   //! enable min() for ReduceMin -- alias for combine()
   RAJA_HOST_DEVICE
@@ -1257,13 +1556,13 @@ public:
 };
 
 //! specialization of ReduceMax for cuda_reduce
-template <bool maybe_atomic, typename T>
-class ReduceMax<cuda_reduce_base<maybe_atomic>, T>
-    : public cuda::Reduce<RAJA::reduce::max<T>, T, maybe_atomic>
+template <bool maybe_atomic, bool auto_atomic, typename T>
+class ReduceMax<cuda_reduce_base<maybe_atomic, auto_atomic>, T>
+    : public cuda::Reduce<RAJA::reduce::max<T>, T, maybe_atomic, auto_atomic>
 {
 
 public:
-  using Base = cuda::Reduce<RAJA::reduce::max<T>, T, maybe_atomic>;
+  using Base = cuda::Reduce<RAJA::reduce::max<T>, T, maybe_atomic, auto_atomic>;
   using Base::Base;
   //! enable max() for ReduceMax -- alias for combine()
   RAJA_HOST_DEVICE
@@ -1275,18 +1574,19 @@ public:
 };
 
 //! specialization of ReduceMinLoc for cuda_reduce
-template <bool maybe_atomic, typename T, typename IndexType>
-class ReduceMinLoc<cuda_reduce_base<maybe_atomic>, T, IndexType>
+template <bool maybe_atomic, bool auto_atomic, typename T, typename IndexType>
+class ReduceMinLoc<cuda_reduce_base<maybe_atomic, auto_atomic>, T, IndexType>
     : public cuda::Reduce<RAJA::reduce::min<RAJA::reduce::detail::ValueLoc<T, IndexType>>,
                           RAJA::reduce::detail::ValueLoc<T, IndexType>,
-                          maybe_atomic>
+                          maybe_atomic,
+                          auto_atomic>
 {
 
 public:
   using value_type = RAJA::reduce::detail::ValueLoc<T, IndexType>;
   using Combiner = RAJA::reduce::min<value_type>;
   using NonLocCombiner = RAJA::reduce::min<T>;
-  using Base = cuda::Reduce<Combiner, value_type, maybe_atomic>;
+  using Base = cuda::Reduce<Combiner, value_type, maybe_atomic, auto_atomic>;
   using Base::Base;
 
   //! constructor requires a default value for the reducer
@@ -1325,18 +1625,19 @@ public:
 };
 
 //! specialization of ReduceMaxLoc for cuda_reduce
-template <bool maybe_atomic, typename T, typename IndexType>
-class ReduceMaxLoc<cuda_reduce_base<maybe_atomic>, T, IndexType>
+template <bool maybe_atomic, bool auto_atomic, typename T, typename IndexType>
+class ReduceMaxLoc<cuda_reduce_base<maybe_atomic, auto_atomic>, T, IndexType>
     : public cuda::
           Reduce<RAJA::reduce::max<RAJA::reduce::detail::ValueLoc<T, IndexType, false>>,
                  RAJA::reduce::detail::ValueLoc<T, IndexType, false>,
-                 maybe_atomic>
+                 maybe_atomic,
+                 auto_atomic>
 {
 public:
   using value_type = RAJA::reduce::detail::ValueLoc<T, IndexType, false>;
   using Combiner = RAJA::reduce::max<value_type>;
   using NonLocCombiner = RAJA::reduce::max<T>;
-  using Base = cuda::Reduce<Combiner, value_type, maybe_atomic>;
+  using Base = cuda::Reduce<Combiner, value_type, maybe_atomic, auto_atomic>;
   using Base::Base;
 
   //! constructor requires a default value for the reducer
@@ -55,30 +55,19 @@ inclusive_inplace(
   cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              len,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              len,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                begin,
+                                                binary_op,
+                                                len,
+                                                stream);
+      },
+      len));
 
   cuda::launch(cuda_res, Async);
 
@@ -108,32 +97,20 @@ exclusive_inplace(
   cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                begin,
+                                                binary_op,
+                                                init,
+                                                len,
+                                                stream);
+      },
+      len));
 
   cuda::launch(cuda_res, Async);
 
@@ -163,30 +140,19 @@ inclusive(
   cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              out,
-                                              binary_op,
-                                              len,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-  cudaErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              out,
-                                              binary_op,
-                                              len,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                out,
+                                                binary_op,
+                                                len,
+                                                stream);
+      },
+      len));
 
   cuda::launch(cuda_res, Async);
 
@@ -218,32 +184,189 @@ exclusive(
   cudaStream_t stream = cuda_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              out,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-  cudaErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              out,
-                                              binary_op,
-                                              init,
-                                              len,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                out,
+                                                binary_op,
+                                                init,
+                                                len,
+                                                stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+namespace detail
+{
+
+/*!
+        \brief kernel that writes the index of the segment containing each
+   element, the segments given by num_segments+1 offsets partition [0, len)
+*/
+template <typename OffsetIter>
+__global__ void segment_keys(OffsetIter offsets,
+                             int num_segments,
+                             int* keys,
+                             int len)
+{
+  const int i = static_cast<int>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < len) {
+    // last segment that begins at or before i, skipping empty segments
+    int lo = 0;
+    int hi = num_segments;
+    while (hi - lo > 1) {
+      const int mid = lo + (hi - lo) / 2;
+      if (offsets[mid] <= i) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    keys[i] = lo;
+  }
+}
+
+/*!
+        \brief allocate and fill the segment index of each element in [0, len)
+   on the stream of cuda_res
+*/
+template <size_t BLOCK_SIZE, typename OffsetIter>
+RAJA_INLINE
+int* make_segment_keys(resources::Cuda cuda_res,
+                       OffsetIter offsets,
+                       int num_segments,
+                       int len)
+{
+  int* keys = cuda::temp_malloc<int>(cuda_res, len);
+
+  auto func = segment_keys<OffsetIter>;
+  const cuda_dim_member_t num_blocks =
+      static_cast<cuda_dim_member_t>((len + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  cuda_dim_t gridSize{num_blocks, 1, 1};
+  cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BLOCK_SIZE), 1, 1};
+  void* args[] = {(void*)&offsets, (void*)&num_segments, (void*)&keys,
+                  (void*)&len};
+  RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, 0,
+                     cuda_res, true);
+
+  return keys;
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive segmented scan given input range, output,
+   segment offsets, and function
+
+   Each element is keyed by the index of its segment and the segments are
+   scanned together with a single scan by key.
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename OffsetIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+inclusive_segmented(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    OffsetIter offsets,
+    int num_segments,
+    Function binary_op)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  int* d_keys =
+      detail::make_segment_keys<BLOCK_SIZE>(cuda_res, offsets,
+                                            num_segments, len);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_keys,
+                                                     begin,
+                                                     out,
+                                                     binary_op,
+                                                     len,
+                                                     ::cub::Equality(),
+                                                     stream);
+      },
+      len));
+  cuda::temp_free(cuda_res, d_keys);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, output,
+   segment offsets, function, and initial value for each segment
+
+   Each element is keyed by the index of its segment and the segments are
+   scanned together with a single scan by key.
+*/
+template <size_t BLOCK_SIZE,
+          size_t BLOCKS_PER_SM,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename OffsetIter,
+          typename Function,
+          typename T>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+exclusive_segmented(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    OffsetIter offsets,
+    int num_segments,
+    Function binary_op,
+    T init)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+  int* d_keys =
+      detail::make_segment_keys<BLOCK_SIZE>(cuda_res, offsets,
+                                            num_segments, len);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_keys,
+                                                     begin,
+                                                     out,
+                                                     binary_op,
+                                                     init,
+                                                     len,
+                                                     ::cub::Equality(),
+                                                     stream);
+      },
+      len));
+  cuda::temp_free(cuda_res, d_keys);
 
   cuda::launch(cuda_res, Async);
 
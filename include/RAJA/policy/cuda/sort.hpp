@@ -27,9 +27,15 @@
 #include <type_traits>
 
 #include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_segmented_radix_sort.cuh"
+#if defined(CUB_VERSION) && (CUB_VERSION >= 101500)
+#include "cub/device/device_merge_sort.cuh"
+#endif
 
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/zip.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
 #include "RAJA/policy/cuda/policy.hpp"
@@ -42,7 +48,8 @@ namespace sort
 {
 
 /*!
-        \brief static assert unimplemented stable sort
+        \brief stable merge sort given range using comparison function,
+               used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
@@ -55,19 +62,34 @@ concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
 stable(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
-    Iter,
-    Iter,
-    Compare)
+    Iter begin,
+    Iter end,
+    Compare comp)
 {
-  static_assert (std::is_pointer<Iter>::value,
-      "stable_sort<cuda_exec> is only implemented for pointers");
-  using iterval = RAJA::detail::IterVal<Iter>;
-  static_assert (type_traits::is_arithmetic<iterval>::value,
-      "stable_sort<cuda_exec> is only implemented for arithmetic types");
-  static_assert (concepts::any_of<
-      camp::is_same<Compare, operators::less<iterval>>,
-      camp::is_same<Compare, operators::greater<iterval>>>::value,
-      "stable_sort<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+#if defined(CUB_VERSION) && (CUB_VERSION >= 101500)
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(begin, end);
+
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceMergeSort::StableSortKeys(d_temp_storage,
+                                                      temp_storage_bytes,
+                                                      begin,
+                                                      len,
+                                                      comp,
+                                                      stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+#else
+  RAJA_UNUSED_VAR(begin, end, comp);
+  static_assert (!std::is_same<Iter, Iter>::value,
+      "stable_sort<cuda_exec> requires cub 1.15 or later for iterators other than pointers to arithmetic types or comparators other than RAJA::operators::less or RAJA::operators::greater");
+#endif
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
@@ -95,37 +117,25 @@ stable(
   int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = cuda::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = cuda::temp_malloc<R>(cuda_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
   cub::DoubleBuffer<R> d_keys(begin, d_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
-                                              temp_storage_bytes,
-                                              d_keys,
-                                              len,
-                                              begin_bit,
-                                              end_bit,
-                                              stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-  cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
-                                              temp_storage_bytes,
-                                              d_keys,
-                                              len,
-                                              begin_bit,
-                                              end_bit,
-                                              stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                len,
+                                                begin_bit,
+                                                end_bit,
+                                                stream);
+      },
+      len));
 
   if (d_keys.Current() == d_out) {
 
@@ -133,7 +143,7 @@ stable(
     cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_out);
+  cuda::temp_free(cuda_res, d_out);
 
   cuda::launch(cuda_res, Async);
 
@@ -163,37 +173,25 @@ stable(
   int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = cuda::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = cuda::temp_malloc<R>(cuda_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
   cub::DoubleBuffer<R> d_keys(begin, d_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        d_keys,
-                                                        len,
-                                                        begin_bit,
-                                                        end_bit,
-                                                        stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-  cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        d_keys,
-                                                        len,
-                                                        begin_bit,
-                                                        end_bit,
-                                                        stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys,
+                                                          len,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream);
+      },
+      len));
 
   if (d_keys.Current() == d_out) {
 
@@ -201,7 +199,7 @@ stable(
     cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_out);
+  cuda::temp_free(cuda_res, d_out);
 
   cuda::launch(cuda_res, Async);
 
@@ -210,7 +208,8 @@ stable(
 
 
 /*!
-        \brief static assert unimplemented sort
+        \brief sort given range using comparison function,
+               used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
@@ -222,22 +221,12 @@ concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                           camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
 unstable(
     resources::Cuda cuda_res,
-    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
-    Iter,
-    Iter,
-    Compare)
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> p,
+    Iter begin,
+    Iter end,
+    Compare comp)
 {
-  static_assert (std::is_pointer<Iter>::value,
-      "sort<cuda_exec> is only implemented for pointers");
-  using iterval = RAJA::detail::IterVal<Iter>;
-  static_assert (type_traits::is_arithmetic<iterval>::value,
-      "sort<cuda_exec> is only implemented for arithmetic types");
-  static_assert (concepts::any_of<
-      camp::is_same<Compare, operators::less<iterval>>,
-      camp::is_same<Compare, operators::greater<iterval>>>::value,
-      "sort<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
-
-  return resources::EventProxy<resources::Cuda>(cuda_res);
+  return stable(cuda_res, p, begin, end, comp);
 }
 
 /*!
@@ -276,7 +265,8 @@ unstable(
 
 
 /*!
-        \brief static assert unimplemented stable sort pairs
+        \brief stable merge sort given range of pairs using comparison
+               function on keys, used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
           typename KeyIter, typename ValIter, typename Compare>
@@ -284,29 +274,45 @@ concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                       concepts::negate<concepts::all_of<
                         type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                         std::is_pointer<KeyIter>,
-                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          std::is_pointer<ValIter>,
+                          RAJA::detail::is_pointer_zip_iterator<ValIter>>,
                         concepts::any_of<
                           camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                           camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
 stable_pairs(
     resources::Cuda cuda_res,
     cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
-    KeyIter,
-    KeyIter,
-    ValIter,
-    Compare)
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
 {
-  static_assert (std::is_pointer<KeyIter>::value,
-      "stable_sort_pairs<cuda_exec> is only implemented for pointers");
-  static_assert (std::is_pointer<ValIter>::value,
-      "stable_sort_pairs<cuda_exec> is only implemented for pointers");
-  using K = RAJA::detail::IterVal<KeyIter>;
-  static_assert (type_traits::is_arithmetic<K>::value,
-      "stable_sort_pairs<cuda_exec> is only implemented for arithmetic types");
-  static_assert (concepts::any_of<
-      camp::is_same<Compare, operators::less<K>>,
-      camp::is_same<Compare, operators::greater<K>>>::value,
-      "stable_sort_pairs<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+#if defined(CUB_VERSION) && (CUB_VERSION >= 101500)
+  cudaStream_t stream = cuda_res.get_stream();
+
+  int len = std::distance(keys_begin, keys_end);
+
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceMergeSort::StableSortPairs(d_temp_storage,
+                                                       temp_storage_bytes,
+                                                       keys_begin,
+                                                       vals_begin,
+                                                       len,
+                                                       comp,
+                                                       stream);
+      },
+      len));
+
+  cuda::launch(cuda_res, Async);
+#else
+  RAJA_UNUSED_VAR(keys_begin, keys_end, vals_begin, comp);
+  static_assert (!std::is_same<KeyIter, KeyIter>::value,
+      "stable_sort_pairs<cuda_exec> requires cub 1.15 or later for iterators other than pointers to arithmetic keys or comparators other than RAJA::operators::less or RAJA::operators::greater");
+#endif
 
   return resources::EventProxy<resources::Cuda>(cuda_res);
 }
@@ -338,41 +344,28 @@ stable_pairs(
   int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = cuda::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = cuda::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = cuda::temp_malloc<K>(cuda_res, len);
+  V* d_vals_out = cuda::temp_malloc<V>(cuda_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
   cub::DoubleBuffer<K> d_keys(keys_begin, d_keys_out);
   cub::DoubleBuffer<V> d_vals(vals_begin, d_vals_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
-                                               temp_storage_bytes,
-                                               d_keys,
-                                               d_vals,
-                                               len,
-                                               begin_bit,
-                                               end_bit,
-                                               stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
-                                               temp_storage_bytes,
-                                               d_keys,
-                                               d_vals,
-                                               len,
-                                               begin_bit,
-                                               end_bit,
-                                               stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 d_vals,
+                                                 len,
+                                                 begin_bit,
+                                                 end_bit,
+                                                 stream);
+      },
+      len));
 
   if (d_keys.Current() == d_keys_out) {
 
@@ -385,8 +378,8 @@ stable_pairs(
     cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_keys_out);
-  cuda::device_mempool_type::getInstance().free(d_vals_out);
+  cuda::temp_free(cuda_res, d_keys_out);
+  cuda::temp_free(cuda_res, d_vals_out);
 
   cuda::launch(cuda_res, Async);
 
@@ -420,41 +413,28 @@ stable_pairs(
   int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = cuda::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = cuda::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = cuda::temp_malloc<K>(cuda_res, len);
+  V* d_vals_out = cuda::temp_malloc<V>(cuda_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
   cub::DoubleBuffer<K> d_keys(keys_begin, d_keys_out);
   cub::DoubleBuffer<V> d_vals(vals_begin, d_vals_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-  cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
-                                                         temp_storage_bytes,
-                                                         d_keys,
-                                                         d_vals,
-                                                         len,
-                                                         begin_bit,
-                                                         end_bit,
-                                                         stream));
-  // Allocate temporary storage
-  d_temp_storage =
-      cuda::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-  cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
-                                                         temp_storage_bytes,
-                                                         d_keys,
-                                                         d_vals,
-                                                         len,
-                                                         begin_bit,
-                                                         end_bit,
-                                                         stream));
-  // Free temporary storage
-  cuda::device_mempool_type::getInstance().free(d_temp_storage);
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return ::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_keys,
+                                                           d_vals,
+                                                           len,
+                                                           begin_bit,
+                                                           end_bit,
+                                                           stream);
+      },
+      len));
 
   if (d_keys.Current() == d_keys_out) {
 
@@ -467,8 +447,8 @@ stable_pairs(
     cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
   }
 
-  cuda::device_mempool_type::getInstance().free(d_keys_out);
-  cuda::device_mempool_type::getInstance().free(d_vals_out);
+  cuda::temp_free(cuda_res, d_keys_out);
+  cuda::temp_free(cuda_res, d_vals_out);
 
   cuda::launch(cuda_res, Async);
 
@@ -476,8 +456,131 @@ stable_pairs(
 }
 
 
+namespace detail
+{
+
+/*!
+        \brief fill perm with the indices [0, len)
+*/
+template <typename IdxT>
+__global__ void sort_iota(IdxT* perm, IdxT len)
+{
+  const IdxT i = static_cast<IdxT>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < len) {
+    perm[i] = i;
+  }
+}
+
+/*!
+        \brief gather the zipped values in the sorted order given by perm
+*/
+template <typename ZipIter, typename IdxT>
+__global__ void sort_gather_zip(ZipIter out, ZipIter in, const IdxT* perm, IdxT len)
+{
+  const IdxT i = static_cast<IdxT>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < len) {
+    out[i] = in[perm[i]];
+  }
+}
+
 /*!
-        \brief static assert unimplemented sort pairs
+        \brief copy a temporary value array back to dst and free it
+*/
+template <typename T>
+RAJA_INLINE
+int sort_copy_back(resources::Cuda cuda_res, T* dst, T* src, int len)
+{
+  cudaErrchk(cudaMemcpyAsync(dst, src, len*sizeof(T), cudaMemcpyDefault, cuda_res.get_stream()));
+  cuda::temp_free(cuda_res, src);
+  return 0;
+}
+
+template <typename... ValPtrs, camp::idx_t... Is>
+RAJA_INLINE
+void sort_copy_back_zip(resources::Cuda cuda_res,
+                        ZipIterator<ValPtrs...> dst,
+                        ZipIterator<ValPtrs...> src,
+                        int len,
+                        camp::idx_seq<Is...>)
+{
+  camp::sink(sort_copy_back(cuda_res,
+                            RAJA::get<Is>(dst.get_iterators()),
+                            RAJA::get<Is>(src.get_iterators()),
+                            len)...);
+}
+
+} // namespace detail
+
+/*!
+        \brief stable sort given range of pairs with zipped values in
+               ascending or descending order of keys
+
+   The keys are radix sorted once together with the permutation of the
+   values, then one kernel gathers every value array in sorted order, so a
+   key carrying several value arrays is sorted in a single pass.
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename... ValPtrs, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      RAJA::detail::is_pointer_zip_iterator<ZipIterator<ValPtrs...>>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+stable_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ZipIterator<ValPtrs...> vals_begin,
+    Compare comp)
+{
+  int len = std::distance(keys_begin, keys_end);
+  if (len <= 0) {
+    return resources::EventProxy<resources::Cuda>(cuda_res);
+  }
+
+  const cuda_dim_member_t num_blocks =
+      static_cast<cuda_dim_member_t>((len + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  cuda_dim_t gridSize{num_blocks, 1, 1};
+  cuda_dim_t blockSize{static_cast<cuda_dim_member_t>(BLOCK_SIZE), 1, 1};
+
+  // sort the keys with the permutation of the values
+  int* perm = cuda::temp_malloc<int>(cuda_res, len);
+  {
+    auto func = detail::sort_iota<int>;
+    void* args[] = {(void*)&perm, (void*)&len};
+    RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, 0,
+                       cuda_res, true);
+  }
+  stable_pairs(cuda_res, cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, true>{},
+               keys_begin, keys_end, perm, comp);
+
+  // gather the values into temporary arrays and copy them back
+  ZipIterator<ValPtrs...> vals_out(
+      cuda::temp_malloc<typename std::iterator_traits<ValPtrs>::value_type>(
+          cuda_res, len)...);
+  {
+    auto func = detail::sort_gather_zip<ZipIterator<ValPtrs...>, int>;
+    void* args[] = {(void*)&vals_out, (void*)&vals_begin, (void*)&perm,
+                    (void*)&len};
+    RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, 0,
+                       cuda_res, true);
+  }
+  detail::sort_copy_back_zip(cuda_res, vals_begin, vals_out, len,
+                             camp::make_idx_seq_t<sizeof...(ValPtrs)>{});
+
+  cuda::temp_free(cuda_res, perm);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys,
+               used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
           typename KeyIter, typename ValIter, typename Compare>
@@ -485,31 +588,21 @@ concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
                       concepts::negate<concepts::all_of<
                         type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                         std::is_pointer<KeyIter>,
-                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          std::is_pointer<ValIter>,
+                          RAJA::detail::is_pointer_zip_iterator<ValIter>>,
                         concepts::any_of<
                           camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                           camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
 unstable_pairs(
     resources::Cuda cuda_res,
-    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
-    KeyIter,
-    KeyIter,
-    ValIter,
-    Compare)
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
 {
-  static_assert (std::is_pointer<KeyIter>::value,
-      "sort_pairs<cuda_exec> is only implemented for pointers");
-  static_assert (std::is_pointer<ValIter>::value,
-      "sort_pairs<cuda_exec> is only implemented for pointers");
-  using K = RAJA::detail::IterVal<KeyIter>;
-  static_assert (type_traits::is_arithmetic<K>::value,
-      "sort_pairs<cuda_exec> is only implemented for arithmetic types");
-  static_assert (concepts::any_of<
-      camp::is_same<Compare, operators::less<K>>,
-      camp::is_same<Compare, operators::greater<K>>>::value,
-      "sort_pairs<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
-
-  return resources::EventProxy<resources::Cuda>(cuda_res);
+  return stable_pairs(cuda_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 /*!
@@ -552,6 +645,299 @@ unstable_pairs(
   return stable_pairs(cuda_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief stable sort given range of pairs with zipped values in
+               ascending or descending order of keys
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename... ValPtrs, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      RAJA::detail::is_pointer_zip_iterator<ZipIterator<ValPtrs...>>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+unstable_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ZipIterator<ValPtrs...> vals_begin,
+    Compare comp)
+{
+  return stable_pairs(cuda_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
+namespace detail
+{
+
+/*!
+    \brief ascending or descending cub segmented radix sort
+*/
+template <bool Descending>
+struct cuda_segmented_radix_sort;
+///
+template <>
+struct cuda_segmented_radix_sort<false>
+{
+  template <typename... Args>
+  static cudaError_t keys(Args&&... args)
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortKeys(
+        std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  static cudaError_t pairs(Args&&... args)
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortPairs(
+        std::forward<Args>(args)...);
+  }
+};
+///
+template <>
+struct cuda_segmented_radix_sort<true>
+{
+  template <typename... Args>
+  static cudaError_t keys(Args&&... args)
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortKeysDescending(
+        std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  static cudaError_t pairs(Args&&... args)
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortPairsDescending(
+        std::forward<Args>(args)...);
+  }
+};
+
+} // namespace detail
+
+/*!
+        \brief static assert unimplemented segmented sort
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+unstable_segmented(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter,
+    Iter,
+    OffsetIter,
+    int,
+    Compare)
+{
+  static_assert (std::is_pointer<Iter>::value,
+      "segmented_sort<cuda_exec> is only implemented for pointers");
+  using iterval = RAJA::detail::IterVal<Iter>;
+  static_assert (type_traits::is_arithmetic<iterval>::value,
+      "segmented_sort<cuda_exec> is only implemented for arithmetic types");
+  static_assert (concepts::any_of<
+      camp::is_same<Compare, operators::less<iterval>>,
+      camp::is_same<Compare, operators::greater<iterval>>>::value,
+      "segmented_sort<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief sort each segment of given range in ascending or descending
+               order with one segmented radix sort
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+unstable_segmented(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    Iter begin,
+    Iter end,
+    OffsetIter offsets,
+    int num_segments,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using R = RAJA::detail::IterVal<Iter>;
+  using sorter = detail::cuda_segmented_radix_sort<
+      std::is_same<Compare, operators::greater<R>>::value>;
+
+  int len = std::distance(begin, end);
+  int begin_bit=0;
+  int end_bit=sizeof(R)*CHAR_BIT;
+
+  // Allocate temporary storage for the output array
+  R* d_out = cuda::temp_malloc<R>(cuda_res, len);
+
+  // use cub double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the begin buffer
+  cub::DoubleBuffer<R> d_keys(begin, d_out);
+
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return sorter::keys(d_temp_storage,
+                            temp_storage_bytes,
+                            d_keys,
+                            len,
+                            num_segments,
+                            offsets,
+                            offsets + 1,
+                            begin_bit,
+                            end_bit,
+                            stream);
+      },
+      len, num_segments));
+
+  if (d_keys.Current() == d_out) {
+
+    // copy
+    cudaErrchk(cudaMemcpyAsync(begin, d_out, len*sizeof(R), cudaMemcpyDefault, stream));
+  }
+
+  cuda::temp_free(cuda_res, d_out);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief static assert unimplemented segmented sort pairs
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter,
+          typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+unstable_segmented_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter,
+    KeyIter,
+    ValIter,
+    OffsetIter,
+    int,
+    Compare)
+{
+  static_assert (std::is_pointer<KeyIter>::value,
+      "segmented_sort_pairs<cuda_exec> is only implemented for pointers");
+  static_assert (std::is_pointer<ValIter>::value,
+      "segmented_sort_pairs<cuda_exec> is only implemented for pointers");
+  using K = RAJA::detail::IterVal<KeyIter>;
+  static_assert (type_traits::is_arithmetic<K>::value,
+      "segmented_sort_pairs<cuda_exec> is only implemented for arithmetic types");
+  static_assert (concepts::any_of<
+      camp::is_same<Compare, operators::less<K>>,
+      camp::is_same<Compare, operators::greater<K>>>::value,
+      "segmented_sort_pairs<cuda_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+/*!
+        \brief sort each segment of given range of pairs in ascending or
+               descending order of keys with one segmented radix sort
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter,
+          typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Cuda>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+unstable_segmented_pairs(
+    resources::Cuda cuda_res,
+    cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OffsetIter offsets,
+    int num_segments,
+    Compare)
+{
+  cudaStream_t stream = cuda_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+  using sorter = detail::cuda_segmented_radix_sort<
+      std::is_same<Compare, operators::greater<K>>::value>;
+
+  int len = std::distance(keys_begin, keys_end);
+  int begin_bit=0;
+  int end_bit=sizeof(K)*CHAR_BIT;
+
+  // Allocate temporary storage for the output arrays
+  K* d_keys_out = cuda::temp_malloc<K>(cuda_res, len);
+  V* d_vals_out = cuda::temp_malloc<V>(cuda_res, len);
+
+  // use cub double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the keys_begin and vals_begin buffers
+  cub::DoubleBuffer<K> d_keys(keys_begin, d_keys_out);
+  cub::DoubleBuffer<V> d_vals(vals_begin, d_vals_out);
+
+  // Run with temporary device storage
+  cudaErrchk(cuda::temp_storage_call(
+      cuda_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+        return sorter::pairs(d_temp_storage,
+                             temp_storage_bytes,
+                             d_keys,
+                             d_vals,
+                             len,
+                             num_segments,
+                             offsets,
+                             offsets + 1,
+                             begin_bit,
+                             end_bit,
+                             stream);
+      },
+      len, num_segments));
+
+  if (d_keys.Current() == d_keys_out) {
+
+    // copy keys
+    cudaErrchk(cudaMemcpyAsync(keys_begin, d_keys_out, len*sizeof(K), cudaMemcpyDefault, stream));
+  }
+  if (d_vals.Current() == d_vals_out) {
+
+    // copy vals
+    cudaErrchk(cudaMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), cudaMemcpyDefault, stream));
+  }
+
+  cuda::temp_free(cuda_res, d_keys_out);
+  cuda::temp_free(cuda_res, d_vals_out);
+
+  cuda::launch(cuda_res, Async);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
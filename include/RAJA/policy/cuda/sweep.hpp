@@ -0,0 +1,191 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA tiled sweep declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sweep_cuda_HPP
+#define RAJA_sweep_cuda_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/sweep.hpp"
+
+#include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
+#include "RAJA/policy/cuda/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sweep
+{
+
+namespace detail
+{
+
+/*!
+ * CUDA global function for tiled sweeps, one block per tile.
+ *
+ * Thread 0 of a block takes the next tile in wavefront order and spins on
+ * the count of its upstream neighbors that are done. Blocks only wait on
+ * tiles handed out before theirs, which are running or done, so the sweep
+ * makes progress whatever the number of resident blocks. The block runs
+ * the cell wavefronts of the tile, then counts itself done for each of its
+ * downstream neighbors.
+ */
+template <size_t BLOCK_SIZE, int DIM, typename Body>
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void tiled_sweep_global(expt::detail::SweepSpace<DIM> space,
+                            Body body,
+                            unsigned int* tickets,
+                            int* done_upstream)
+{
+  __shared__ Index_type s_tile[DIM];
+
+  if (threadIdx.x == 0) {
+    Index_type num_tiles = space.total_tiles();
+    Index_type ticket = atomicAdd(tickets, 1u);
+    if (ticket + 1 == num_tiles) {
+      // last ticket, leave the memory zeroed for the pool
+      *tickets = 0u;
+    }
+
+    Index_type t[DIM];
+    space.decode(ticket, t);
+    Index_type lin = space.linear(t);
+    int num_upstream = space.num_upstream(t);
+    while (*static_cast<volatile int*>(done_upstream + lin) < num_upstream) {
+    }
+    done_upstream[lin] = 0;
+    __threadfence();
+
+    for (int d = 0; d < DIM; ++d) {
+      s_tile[d] = t[d];
+    }
+  }
+  __syncthreads();
+
+  Index_type t[DIM];
+  for (int d = 0; d < DIM; ++d) {
+    t[d] = s_tile[d];
+  }
+
+  const Index_type planes = space.tile_planes(t);
+  const Index_type inner_size = space.tile_inner_size(t);
+  for (Index_type h = 0; h < planes; ++h) {
+    for (Index_type k = threadIdx.x; k < inner_size; k += BLOCK_SIZE) {
+      space.invoke_on_plane(t, h, k, body);
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    __threadfence();
+    for (int d = 0; d < DIM; ++d) {
+      if (t[d] + 1 < space.num_tiles[d]) {
+        ++t[d];
+        atomicAdd(done_upstream + space.linear(t), 1);
+        --t[d];
+      }
+    }
+  }
+}
+
+/*!
+        \brief run the tiles of a sweep on the blocks of one kernel, the
+   sweep is synchronous since the tile counters go back to the pool after it
+*/
+template <size_t BLOCK_SIZE, int DIM, typename Body>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+tiled_sweep_launch(resources::Cuda cuda_res,
+                   expt::detail::SweepSpace<DIM> const &space,
+                   Body const &body)
+{
+  const Index_type num_tiles = space.total_tiles();
+
+  unsigned int* tickets =
+      ::RAJA::cuda::device_zeroed_mempool_type::getInstance().template malloc<unsigned int>(1);
+  int* done_upstream =
+      ::RAJA::cuda::device_zeroed_mempool_type::getInstance().template malloc<int>(num_tiles);
+
+  auto func = detail::tiled_sweep_global<BLOCK_SIZE, DIM, camp::decay<Body>>;
+
+  cuda_dim_t gridSize{static_cast<unsigned int>(num_tiles), 1, 1};
+  cuda_dim_t blockSize{static_cast<unsigned int>(BLOCK_SIZE), 1, 1};
+
+  {
+    auto cuda_body = ::RAJA::cuda::make_launch_body(
+        gridSize, blockSize, 0, cuda_res, body);
+
+    void* args[] = {(void*)&space, (void*)&cuda_body,
+                    (void*)&tickets, (void*)&done_upstream};
+
+    // the memory goes back to the pool after the kernel is done
+    ::RAJA::cuda::launch((const void*)func, gridSize, blockSize, args, 0,
+                         cuda_res, false);
+  }
+
+  ::RAJA::cuda::device_zeroed_mempool_type::getInstance().free(done_upstream);
+  ::RAJA::cuda::device_zeroed_mempool_type::getInstance().free(tickets);
+
+  return resources::EventProxy<resources::Cuda>(cuda_res);
+}
+
+}  // namespace detail
+
+/*!
+        \brief run the tiles of a sweep on the blocks of one kernel
+*/
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          int DIM, typename Body>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+tiled_sweep(resources::Cuda cuda_res,
+            ::RAJA::policy::cuda::cuda_exec_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+            expt::detail::SweepSpace<DIM> const &space,
+            Body const &body)
+{
+  return detail::tiled_sweep_launch<BLOCK_SIZE>(cuda_res, space, body);
+}
+
+template <size_t BLOCK_SIZE, size_t BLOCKS_PER_SM, bool Async,
+          int DIM, typename Body>
+RAJA_INLINE
+resources::EventProxy<resources::Cuda>
+tiled_sweep(resources::Cuda cuda_res,
+            ::RAJA::policy::cuda::cuda_exec_occ_explicit<BLOCK_SIZE, BLOCKS_PER_SM, Async>,
+            expt::detail::SweepSpace<DIM> const &space,
+            Body const &body)
+{
+  return detail::tiled_sweep_launch<BLOCK_SIZE>(cuda_res, space, body);
+}
+
+}  // namespace sweep
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_CUDA guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,147 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the CUDA event based DeviceTimer.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_cuda_timer_HPP
+#define RAJA_policy_cuda_timer_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_CUDA_ACTIVE)
+
+#include <utility>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * DeviceTimer timing the intervals between cuda events recorded on the
+ * stream of a Cuda resource. Events are reused once their interval has
+ * been resolved.
+ */
+template <>
+class DeviceTimer<resources::Cuda>
+{
+public:
+  using ElapsedType = double;
+
+  explicit DeviceTimer(resources::Cuda res = resources::Cuda::get_default())
+      : m_res(res), m_start(nullptr), telapsed(0)
+  {
+  }
+
+  DeviceTimer(DeviceTimer const&) = delete;
+  DeviceTimer& operator=(DeviceTimer const&) = delete;
+
+  ~DeviceTimer()
+  {
+    // events of unresolved intervals are released when they complete
+    for (auto& interval : m_pending) {
+      cudaErrchk(cudaEventDestroy(interval.first));
+      cudaErrchk(cudaEventDestroy(interval.second));
+    }
+    if (m_start != nullptr) {
+      cudaErrchk(cudaEventDestroy(m_start));
+    }
+    for (cudaEvent_t event : m_free) {
+      cudaErrchk(cudaEventDestroy(event));
+    }
+  }
+
+  //! record the start of an interval on the stream
+  void start()
+  {
+    if (m_start == nullptr) {
+      m_start = get_event();
+    }
+    cudaErrchk(cudaEventRecord(m_start, m_res.get_stream()));
+  }
+
+  //! record the end of the interval on the stream
+  void stop()
+  {
+    cudaEvent_t stop_event = get_event();
+    cudaErrchk(cudaEventRecord(stop_event, m_res.get_stream()));
+    m_pending.emplace_back(m_start, stop_event);
+    m_start = nullptr;
+  }
+
+  //! true if elapsed() would not wait for the device
+  bool ready() const
+  {
+    for (auto const& interval : m_pending) {
+      cudaError_t status = cudaEventQuery(interval.second);
+      if (status == cudaErrorNotReady) {
+        return false;
+      }
+      cudaErrchk(status);
+    }
+    return true;
+  }
+
+  //! elapsed time of the recorded intervals, waits for their events
+  ElapsedType elapsed() const
+  {
+    for (auto const& interval : m_pending) {
+      cudaErrchk(cudaEventSynchronize(interval.second));
+      float ms = 0.0f;
+      cudaErrchk(cudaEventElapsedTime(&ms, interval.first, interval.second));
+      telapsed += static_cast<ElapsedType>(ms) / 1000.0;
+      m_free.push_back(interval.first);
+      m_free.push_back(interval.second);
+    }
+    m_pending.clear();
+    return telapsed;
+  }
+
+  void reset()
+  {
+    elapsed();
+    telapsed = 0;
+  }
+
+private:
+  cudaEvent_t get_event() const
+  {
+    cudaEvent_t event;
+    if (m_free.empty()) {
+      cudaErrchk(cudaEventCreate(&event));
+    } else {
+      event = m_free.back();
+      m_free.pop_back();
+    }
+    return event;
+  }
+
+  resources::Cuda m_res;
+  cudaEvent_t m_start;
+  mutable std::vector<std::pair<cudaEvent_t, cudaEvent_t>> m_pending;
+  mutable std::vector<cudaEvent_t> m_free;
+  mutable ElapsedType telapsed;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_CUDA_ACTIVE guard
+
+#endif  // closing endif for header file include guard
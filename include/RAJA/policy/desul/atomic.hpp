@@ -14,6 +14,7 @@
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
 
 #include "desul/atomics.hpp"
@@ -26,6 +27,41 @@ using raja_default_desul_scope = desul::MemoryScopeDevice;
 namespace RAJA
 {
 
+namespace detail
+{
+
+/*!
+ * desul memory scope of a RAJA::atomic_scope
+ */
+template <typename Scope>
+struct desul_scope;
+///
+template <>
+struct desul_scope<atomic_scope::block> {
+  using type = desul::MemoryScopeCore;
+};
+///
+template <>
+struct desul_scope<atomic_scope::device> {
+  using type = desul::MemoryScopeDevice;
+};
+///
+template <>
+struct desul_scope<atomic_scope::system> {
+  using type = desul::MemoryScopeSystem;
+};
+
+/*!
+ * desul memory scope used with AtomicPolicy, scoped atomic policies
+ * specialize this to use their scope
+ */
+template <typename AtomicPolicy>
+struct desul_policy_scope {
+  using type = raja_default_desul_scope;
+};
+
+}  // namespace detail
+
 RAJA_SUPPRESS_HD_WARN
 template <typename AtomicPolicy, typename T>
 RAJA_HOST_DEVICE
@@ -34,7 +70,7 @@ atomicAdd(AtomicPolicy, T volatile *acc, T value) {
   return desul::atomic_fetch_add(const_cast<T*>(acc),
                                  value,
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -45,7 +81,7 @@ atomicSub(AtomicPolicy, T volatile *acc, T value) {
   return desul::atomic_fetch_sub(const_cast<T*>(acc),
                                  value,
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -56,7 +92,7 @@ RAJA_INLINE T atomicMin(AtomicPolicy, T volatile *acc, T value)
   return desul::atomic_fetch_min(const_cast<T*>(acc),
                                  value,
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -67,7 +103,7 @@ RAJA_INLINE T atomicMax(AtomicPolicy, T volatile *acc, T value)
   return desul::atomic_fetch_max(const_cast<T*>(acc),
                                  value,
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -77,7 +113,7 @@ RAJA_INLINE T atomicInc(AtomicPolicy, T volatile *acc)
 {
   return desul::atomic_fetch_inc(const_cast<T*>(acc),
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -90,7 +126,7 @@ RAJA_INLINE T atomicInc(AtomicPolicy, T volatile *acc, T val)
   return desul::atomic_fetch_inc_mod(const_cast<T*>(acc),
                                           val,
                                           raja_default_desul_order{},
-                                          raja_default_desul_scope{});
+                                          typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -100,7 +136,7 @@ RAJA_INLINE T atomicDec(AtomicPolicy, T volatile *acc)
 {
   return desul::atomic_fetch_dec(const_cast<T*>(acc),
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -113,7 +149,7 @@ RAJA_INLINE T atomicDec(AtomicPolicy, T volatile *acc, T val)
   return desul::atomic_fetch_dec_mod(const_cast<T*>(acc),
                                           val,
                                           raja_default_desul_order{},
-                                          raja_default_desul_scope{});
+                                          typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -124,7 +160,7 @@ RAJA_INLINE T atomicAnd(AtomicPolicy, T volatile *acc, T value)
   return desul::atomic_fetch_and(const_cast<T*>(acc),
                                  value,
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -135,7 +171,7 @@ RAJA_INLINE T atomicOr(AtomicPolicy, T volatile *acc, T value)
   return desul::atomic_fetch_or(const_cast<T*>(acc),
                                 value,
                                 raja_default_desul_order{},
-                                raja_default_desul_scope{});
+                                typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -146,7 +182,7 @@ RAJA_INLINE T atomicXor(AtomicPolicy, T volatile *acc, T value)
   return desul::atomic_fetch_xor(const_cast<T*>(acc),
                                  value,
                                  raja_default_desul_order{},
-                                 raja_default_desul_scope{});
+                                 typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -157,7 +193,7 @@ RAJA_INLINE T atomicExchange(AtomicPolicy, T volatile *acc, T value)
   return desul::atomic_exchange(const_cast<T*>(acc),
                                 value,
                                 raja_default_desul_order{},
-                                raja_default_desul_scope{});
+                                typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -169,7 +205,7 @@ RAJA_INLINE T atomicCAS(AtomicPolicy, T volatile *acc, T compare, T value)
                                         compare,
                                         value,
                                         raja_default_desul_order{},
-                                        raja_default_desul_scope{});
+                                        typename detail::desul_policy_scope<AtomicPolicy>::type{});
 }
 
 }  // namespace RAJA
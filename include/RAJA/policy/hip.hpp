@@ -30,15 +30,26 @@
 #include "RAJA/policy/hip/atomic.hpp"
 #endif
 
+#include "RAJA/policy/hip/atomic_aggregated.hpp"
+#include "RAJA/policy/hip/atomic_scoped.hpp"
+#include "RAJA/policy/hip/atomic_unsafe_fp.hpp"
 #include "RAJA/policy/hip/forall.hpp"
+#include "RAJA/policy/hip/forall_fused.hpp"
 #include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/prefetch.hpp"
 #include "RAJA/policy/hip/reduce.hpp"
+#include "RAJA/policy/hip/compact.hpp"
+#include "RAJA/policy/hip/sweep.hpp"
+#include "RAJA/policy/hip/spmv.hpp"
+#include "RAJA/policy/hip/child_forall.hpp"
 #include "RAJA/policy/hip/scan.hpp"
 #include "RAJA/policy/hip/sort.hpp"
 #include "RAJA/policy/hip/kernel.hpp"
 #include "RAJA/policy/hip/synchronize.hpp"
+#include "RAJA/policy/hip/timer.hpp"
 #include "RAJA/policy/hip/launch.hpp"
 #include "RAJA/policy/hip/WorkGroup.hpp"
+#include "RAJA/policy/hip/WorkQueue.hpp"
 
 
 #endif  // closing endif for if defined(RAJA_HIP_ACTIVE)
@@ -23,9 +23,13 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 
@@ -34,6 +38,9 @@
 #include "RAJA/util/types.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/resource.hpp"
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/ScratchBuffer.hpp"
+#include "RAJA/util/StagingPool.hpp"
 
 #include "RAJA/policy/hip/policy.hpp"
 #include "RAJA/policy/hip/raja_hiperrchk.hpp"
@@ -53,6 +60,9 @@ namespace hip
 //! Allocator for pinned memory for use in basic_mempool
 struct PinnedAllocator {
 
+  // memory space reported to plugins
+  static const char* space_name() { return "HIPHostPinned"; }
+
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
@@ -72,6 +82,9 @@ struct PinnedAllocator {
 //! Allocator for device memory for use in basic_mempool
 struct DeviceAllocator {
 
+  // memory space reported to plugins
+  static const char* space_name() { return "HIP"; }
+
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
@@ -92,6 +105,9 @@ struct DeviceAllocator {
 //  Note: Memory must be zero when returned to mempool
 struct DeviceZeroedAllocator {
 
+  // memory space reported to plugins
+  static const char* space_name() { return "HIP"; }
+
   // returns a valid pointer on success, nullptr on failure
   void* malloc(size_t nbytes)
   {
@@ -109,10 +125,295 @@ struct DeviceZeroedAllocator {
   }
 };
 
-using device_mempool_type = basic_mempool::MemPool<DeviceAllocator>;
+//! Allocator for coarse-grained device memory for use in basic_mempool
+//  Coarse-grained memory is coherent only at kernel boundaries and supports
+//  the hardware floating point atomics used by hip_atomic_unsafe_fp
+struct DeviceCoarseAllocator {
+
+  // memory space reported to plugins
+  static const char* space_name() { return "HIPCoarse"; }
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    void* ptr;
+    hipErrchk(hipExtMallocWithFlags(&ptr, nbytes, hipDeviceMallocDefault));
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    hipErrchk(hipFree(ptr));
+    return true;
+  }
+};
+
+/*!
+ * \brief  Device mempool with one pool_t per device, each created when the
+ *         device first allocates from it.
+ *
+ * malloc allocates from the pool of the current device and free gives the
+ * memory back to the pool of the device that allocated it, so work on
+ * several devices never shares arenas. The first device to allocate uses
+ * pool_t::getInstance(), so single device runs use one pool as before and
+ * free them without asking the runtime which device owns the memory.
+ */
+template <typename pool_t>
+class per_device_mempool
+{
+public:
+  using pool_type = pool_t;
+
+  static per_device_mempool& getInstance()
+  {
+    // never destroyed so memory can be freed during static destruction
+    static per_device_mempool* instance = new per_device_mempool;
+    return *instance;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    return pool(device_select::current()).template malloc<T>(nTs, alignment);
+  }
+
+  void free(const void* ptr)
+  {
+    pool_t* only = m_only.load(std::memory_order_acquire);
+    if (only != nullptr) {
+      only->free(ptr);
+      return;
+    }
+    hipPointerAttribute_t attr;
+    // the runtime may be unloading at exit, then the memory goes with it
+    if (hipPointerGetAttributes(&attr, ptr) == hipSuccess) {
+      pool(attr.device).free(ptr);
+    } else {
+      hipGetLastError();
+    }
+  }
+
+  //! pool of device, created on first use
+  pool_t& pool(int device)
+  {
+    pool_t* p = m_pools[device].load(std::memory_order_acquire);
+    return p != nullptr ? *p : create(device);
+  }
+
+private:
+  using device_select = ::RAJA::resources::device_select<::RAJA::resources::Hip>;
+
+  per_device_mempool()
+      : m_pools(new std::atomic<pool_t*>[device_select::num_devices()]),
+        m_only(nullptr),
+        m_num_pools(0)
+  {
+    for (int d = 0; d < device_select::num_devices(); ++d) {
+      m_pools[d].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  pool_t& create(int device)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_lock);
+#else
+    std::lock_guard<std::mutex> lock(m_lock);
+#endif
+    pool_t* p = m_pools[device].load(std::memory_order_relaxed);
+    if (p == nullptr) {
+      // pools are never freed, like pool_t::getInstance()
+      p = m_num_pools == 0 ? &pool_t::getInstance() : pool_t::newInstance();
+      ++m_num_pools;
+      m_only.store(m_num_pools == 1 ? p : nullptr, std::memory_order_release);
+      m_pools[device].store(p, std::memory_order_release);
+    }
+    return *p;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_lock;
+#else
+  std::mutex m_lock;
+#endif
+  std::unique_ptr<std::atomic<pool_t*>[]> m_pools;
+  std::atomic<pool_t*> m_only;
+  int m_num_pools;
+};
+
+#if defined(RAJA_ENABLE_SLAB_MEMPOOL)
+using device_mempool_type =
+    per_device_mempool<basic_mempool::SlabPool<DeviceAllocator>>;
 using device_zeroed_mempool_type =
-    basic_mempool::MemPool<DeviceZeroedAllocator>;
+    per_device_mempool<basic_mempool::SlabPool<DeviceZeroedAllocator>>;
+using device_coarse_mempool_type =
+    per_device_mempool<basic_mempool::SlabPool<DeviceCoarseAllocator>>;
+using pinned_mempool_type = basic_mempool::SlabPool<PinnedAllocator>;
+#else
+using device_mempool_type =
+    per_device_mempool<basic_mempool::MemPool<DeviceAllocator>>;
+using device_zeroed_mempool_type =
+    per_device_mempool<basic_mempool::MemPool<DeviceZeroedAllocator>>;
+using device_coarse_mempool_type =
+    per_device_mempool<basic_mempool::MemPool<DeviceCoarseAllocator>>;
 using pinned_mempool_type = basic_mempool::MemPool<PinnedAllocator>;
+#endif
+
+//! Allocator for the pinned staging buffers of expt::StagingPool, a type of
+//  its own so staging buffers do not share arenas with the reducers
+struct StagingAllocator {
+
+  // memory space reported to plugins
+  static const char* space_name() { return "HIPHostPinned"; }
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    void* ptr;
+    hipErrchk(hipHostMalloc(&ptr, nbytes, hipHostMallocDefault));
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    hipErrchk(hipHostFree(ptr));
+    return true;
+  }
+};
+
+}  // namespace hip
+
+namespace expt
+{
+namespace detail
+{
+
+template <>
+struct staging_allocator<resources::Hip> {
+  using type = ::RAJA::hip::StagingAllocator;
+};
+
+}  // namespace detail
+}  // namespace expt
+
+namespace hip
+{
+
+namespace detail
+{
+
+#if defined(RAJA_ENABLE_STREAM_ORDERED_ALLOC)
+//! keep memory freed to the default memory pool of the current device
+//  cached for reuse instead of releasing it at each synchronization
+inline void setup_stream_ordered_pool()
+{
+  static std::unordered_map<int, bool> setup_devices;
+#if defined(RAJA_ENABLE_OPENMP)
+  static omp::mutex setup_mutex;
+  lock_guard<omp::mutex> lock(setup_mutex);
+#endif
+
+  int device = 0;
+  hipErrchk(hipGetDevice(&device));
+  if (!setup_devices[device]) {
+    hipMemPool_t pool;
+    hipErrchk(hipDeviceGetDefaultMemPool(&pool, device));
+    uint64_t threshold = UINT64_MAX;
+    hipErrchk(
+        hipMemPoolSetAttribute(pool,
+                               hipMemPoolAttrReleaseThreshold,
+                               &threshold));
+    setup_devices[device] = true;
+  }
+}
+#endif
+
+}  // namespace detail
+
+/*!
+ * \brief  Allocate nTs objects of temporary device memory used by work on
+ *         the stream of res, e.g. scan and sort temporaries.
+ *
+ * With RAJA_ENABLE_STREAM_ORDERED_ALLOC the memory is allocated stream
+ * ordered with hipMallocAsync from the default memory pool of the current
+ * device, so temporaries on different streams do not serialize on the
+ * device_mempool_type lock and freed memory is reused without a device
+ * synchronization. Otherwise the memory comes from device_mempool_type.
+ */
+template <typename T>
+inline T* temp_malloc(::RAJA::resources::Hip& res, size_t nTs)
+{
+#if defined(RAJA_ENABLE_STREAM_ORDERED_ALLOC)
+  detail::setup_stream_ordered_pool();
+  void* ptr = nullptr;
+  hipErrchk(hipMallocAsync(&ptr, nTs * sizeof(T), res.get_stream()));
+  return static_cast<T*>(ptr);
+#else
+  RAJA_UNUSED_VAR(res);
+  return device_mempool_type::getInstance().template malloc<T>(nTs);
+#endif
+}
+
+/*!
+ * \brief  Free temporary device memory allocated with temp_malloc, after
+ *         the work already enqueued on the stream of res.
+ */
+inline void temp_free(::RAJA::resources::Hip& res, void* ptr)
+{
+#if defined(RAJA_ENABLE_STREAM_ORDERED_ALLOC)
+  hipErrchk(hipFreeAsync(ptr, res.get_stream()));
+#else
+  RAJA_UNUSED_VAR(res);
+  device_mempool_type::getInstance().free(ptr);
+#endif
+}
+
+/*!
+ * \brief  Run a device algorithm of cub or rocPRIM with temporary device memory.
+ *
+ * call(d_temp_storage, temp_storage_bytes) is called like the cub or rocPRIM
+ * algorithms, first with a null d_temp_storage to query the bytes needed
+ * and then to run. If a RAJA::expt::ScratchBuffer is bound to the stream of
+ * res the memory comes from it, and the query is skipped when a call of the
+ * same type with the same sizes n and m ran with the buffer before.
+ * Otherwise the memory comes from temp_malloc.
+ */
+template <typename Call>
+inline hipError_t temp_storage_call(::RAJA::resources::Hip& res,
+                                    Call&& call,
+                                    size_t n,
+                                    size_t m = 0)
+{
+  void* d_temp_storage = nullptr;
+  size_t temp_storage_bytes = 0;
+
+  ::RAJA::expt::detail::ScratchStorage* scratch =
+      ::RAJA::expt::detail::find_scratch(res.get_stream());
+  if (scratch != nullptr) {
+    void const* key =
+        ::RAJA::expt::detail::scratch_key<typename std::decay<Call>::type>();
+    if (!scratch->find(key, n, m, temp_storage_bytes)) {
+      hipError_t err = call(d_temp_storage, temp_storage_bytes);
+      if (err != hipSuccess) {
+        return err;
+      }
+      scratch->record(key, n, m, temp_storage_bytes);
+    }
+    d_temp_storage = scratch->reserve(temp_storage_bytes);
+    return call(d_temp_storage, temp_storage_bytes);
+  }
+
+  hipError_t err = call(d_temp_storage, temp_storage_bytes);
+  if (err != hipSuccess) {
+    return err;
+  }
+  d_temp_storage = temp_malloc<unsigned char>(res, temp_storage_bytes);
+  err = call(d_temp_storage, temp_storage_bytes);
+  temp_free(res, d_temp_storage);
+  return err;
+}
 
 namespace detail
 {
@@ -123,6 +424,8 @@ struct hipInfo {
   hip_dim_t blockDim = 0;
   ::RAJA::resources::Hip res{::RAJA::resources::Hip::HipFromStream(0,0)};
   bool setup_reducers = false;
+  //! set by launches that can't combine reducers, like multi_device_exec
+  bool reject_reducers = false;
 #if defined(RAJA_ENABLE_OPENMP)
   hipInfo* thread_states = nullptr;
   omp::mutex lock;
@@ -230,6 +533,25 @@ void launch(const void* func, hip_dim_t gridDim, hip_dim_t blockDim, void** args
     RAJA_UNUSED_VAR(name);
   #endif
   hipErrchk(hipLaunchKernel(func, dim3(gridDim), dim3(blockDim), args, shmem, res.get_stream()));
+  ::RAJA::util::detail::record_launch_geometry(gridDim, blockDim, shmem);
+  #if defined(RAJA_ENABLE_ROCTX)
+  if(name) roctxRangePop();
+  #endif
+  launch(res, async);
+}
+
+//! Launch kernel cooperatively so the grid may synchronize
+RAJA_INLINE
+void launch_cooperative(const void* func, hip_dim_t gridDim, hip_dim_t blockDim, void** args, size_t shmem,
+                        ::RAJA::resources::Hip res, bool async = true, const char *name = nullptr)
+{
+  #if defined(RAJA_ENABLE_ROCTX)
+  if(name) roctxRangePush(name);
+  #else
+    RAJA_UNUSED_VAR(name);
+  #endif
+  hipErrchk(hipLaunchCooperativeKernel(func, dim3(gridDim), dim3(blockDim), args, shmem, res.get_stream()));
+  ::RAJA::util::detail::record_launch_geometry(gridDim, blockDim, shmem);
   #if defined(RAJA_ENABLE_ROCTX)
   if(name) roctxRangePop();
   #endif
@@ -242,7 +564,14 @@ void peekAtLastError() { hipErrchk(hipPeekAtLastError()); }
 
 //! query whether reducers in this thread should setup for device execution now
 RAJA_INLINE
-bool setupReducers() { return detail::tl_status.setup_reducers; }
+bool setupReducers()
+{
+  if (detail::tl_status.setup_reducers && detail::tl_status.reject_reducers) {
+    RAJA_ABORT_OR_THROW("Reducer objects are not supported by this launch, "
+                        "use RAJA::expt::Reduce instead.");
+  }
+  return detail::tl_status.setup_reducers;
+}
 
 //! get gridDim of current launch
 RAJA_INLINE
@@ -256,6 +585,40 @@ hip_dim_t currentBlockDim() { return detail::tl_status.blockDim; }
 RAJA_INLINE
 ::RAJA::resources::Hip currentResource() { return detail::tl_status.res; }
 
+/*!
+ * \brief  mempool interface for the buffers of reducers, taken from a per
+ *         thread StreamCache of pool_t keyed by the stream of the current
+ *         launch, so building reducers for repeated launches on a stream
+ *         reuses their buffers without taking the pool lock.
+ */
+template <typename pool_t>
+struct launch_stream_cache {
+  using cache_type = basic_mempool::StreamCache<pool_t, hipStream_t>;
+
+  static launch_stream_cache& getInstance()
+  {
+    static launch_stream_cache instance;
+    return instance;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs)
+  {
+    return cache_type::getInstance().template malloc<T>(
+        currentResource().get_stream(), nTs);
+  }
+
+  void free(const void* ptr) { cache_type::getInstance().free(ptr); }
+};
+
+using device_reducer_mempool_type = launch_stream_cache<device_mempool_type>;
+using device_zeroed_reducer_mempool_type =
+    launch_stream_cache<device_zeroed_mempool_type>;
+
+//! per thread cache of pinned memory keyed by stream
+using pinned_stream_cache_type =
+    basic_mempool::StreamCache<pinned_mempool_type, hipStream_t>;
+
 //! create copy of loop_body that is setup for device execution
 template <typename LOOP_BODY>
 RAJA_INLINE typename std::remove_reference<LOOP_BODY>::type make_launch_body(
@@ -294,8 +657,139 @@ hipDeviceProp_t& device_prop()
   return prop;
 }
 
+//! Warp size of the device, which may be smaller than policy::hip::WARP_SIZE
+//  in host code when the device runs wave32
+RAJA_INLINE
+int device_warp_size()
+{
+  return device_prop().warpSize;
+}
+
 }  // namespace hip
 
+namespace internal
+{
+
+/*!
+ * Cache of occupancy calculator results of one kernel, keyed by the shared
+ * memory size and the number of threads.
+ *
+ * Lookups are lock free. A slot is claimed once with a compare and swap,
+ * filled and then published by storing its key, and never changes again, so
+ * a reader that sees the key also sees the values. When all slots are used
+ * the calculator is called without caching.
+ */
+template < typename Value, size_t num_slots = 8 >
+struct HipOccupancyCache
+{
+  static constexpr unsigned long long empty_key = 0ull;
+  static constexpr unsigned long long claimed_key = ~0ull;
+
+  std::atomic<unsigned long long> keys[num_slots];
+  Value values[num_slots];
+
+  static unsigned long long make_key(int shmem_size, int num_threads)
+  {
+    return ((static_cast<unsigned long long>(shmem_size) + 1ull) << 32) |
+           static_cast<unsigned long long>(
+               static_cast<unsigned int>(num_threads));
+  }
+
+  template < typename Query >
+  Value get(int shmem_size, int num_threads, Query&& query)
+  {
+    const unsigned long long key = make_key(shmem_size, num_threads);
+
+    for (size_t i = 0; i < num_slots; ++i) {
+
+      unsigned long long slot_key = keys[i].load(std::memory_order_acquire);
+
+      if (slot_key == key) {
+        return values[i];
+      }
+
+      if (slot_key == empty_key &&
+          keys[i].compare_exchange_strong(slot_key, claimed_key,
+                                          std::memory_order_relaxed)) {
+        values[i] = query();
+        keys[i].store(key, std::memory_order_release);
+        return values[i];
+      }
+
+    }
+
+    return query();
+  }
+};
+
+struct HipOccMaxBlocksThreadsData
+{
+  int max_blocks;
+  int max_threads;
+};
+
+template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
+RAJA_INLINE
+void hip_occupancy_max_blocks_threads(Func&& func, int shmem_size,
+                                       int &max_blocks, int &max_threads)
+{
+  static HipOccupancyCache<HipOccMaxBlocksThreadsData> cache;
+
+  HipOccMaxBlocksThreadsData data = cache.get(shmem_size, 0, [&]() {
+
+    HipOccMaxBlocksThreadsData result;
+#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
+    hipErrchk(hipOccupancyMaxPotentialBlockSize(
+        &result.max_blocks, &result.max_threads, func, shmem_size));
+#else
+    RAJA_UNUSED_VAR(func);
+    result.max_blocks = 64;
+    result.max_threads = 1024;
+#endif
+    return result;
+
+  });
+
+  max_blocks  = data.max_blocks;
+  max_threads = data.max_threads;
+
+}
+
+template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
+RAJA_INLINE
+void hip_occupancy_max_blocks(Func&& func, int shmem_size,
+                               int &max_blocks, int num_threads)
+{
+  static HipOccupancyCache<int> cache;
+
+  max_blocks = cache.get(shmem_size, num_threads, [&]() {
+
+    int blocks_per_sm = 0;
+#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
+    hipErrchk(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks_per_sm, func, num_threads, shmem_size));
+#else
+    RAJA_UNUSED_VAR(func);
+    blocks_per_sm = 2;
+#endif
+
+    return blocks_per_sm * hip::device_prop().multiProcessorCount;
+
+  });
+
+}
+
+template < typename UniqueMarker, int num_threads, typename Func >
+RAJA_INLINE
+void hip_occupancy_max_blocks(Func&& func, int shmem_size,
+                               int &max_blocks)
+{
+  hip_occupancy_max_blocks<UniqueMarker>(
+      std::forward<Func>(func), shmem_size, max_blocks, num_threads);
+}
+
+}  // namespace internal
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_HIP
@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <vector>
+
 #include "RAJA/policy/hip/policy.hpp"
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 
@@ -366,6 +368,238 @@ private:
   index_type m_total_iterations = 0;
 };
 
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * on the device with each block running block_size iterations
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldHipDeviceXBlockLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldHipDeviceXBlockLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_DEVICE RAJA_INLINE void operator()(index_type loop_block, Args... args) const
+  {
+    const index_type i = threadIdx.x + loop_block * blockDim.x;
+    const auto begin = m_segment.begin();
+    const auto end   = m_segment.end();
+    const index_type len(end - begin);
+    if ( i < len ) {
+      m_body(begin[i], std::forward<Args>(args)...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+template < size_t BLOCK_SIZE,
+           typename StorageIter,
+           typename value_type,
+           typename index_type,
+           typename ... Args >
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void hip_unordered_x_block_balanced_global(StorageIter iter,
+                                               const index_type* block_begins,
+                                               index_type num_loops,
+                                               Args... args)
+{
+  const index_type block = blockIdx.x;
+  // find the last loop that begins at or before this block
+  index_type lo = 0;
+  index_type hi = num_loops - 1;
+  while (lo < hi) {
+    const index_type mid = lo + (hi - lo + 1) / 2;
+    if (block_begins[mid] <= block) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  value_type::device_call(&iter[lo], block - block_begins[lo], args...);
+}
+
+
+/*!
+ * Runs work in a storage container out of order with each loop given a
+ * number of hip blocks in the x direction proportional to its number of
+ * iterates, each block finds its loop with a binary search of the first
+ * block of each loop
+ */
+template <size_t BLOCK_SIZE, bool Async,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::hip_work<BLOCK_SIZE, Async>,
+        RAJA::policy::hip::unordered_hip_loop_x_block_balanced,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::hip_work<BLOCK_SIZE, Async>;
+  using order_policy = RAJA::policy::hip::unordered_hip_loop_x_block_balanced;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Hip;
+
+  // The type that will hold the segment and loop body in work storage
+  struct holder_type {
+    template < typename T >
+    using type = HoldHipDeviceXBlockLoop<
+        typename camp::at<T, camp::num<0>>::type, // ITERABLE
+        typename camp::at<T, camp::num<1>>::type, // LOOP_BODY
+        index_type, Args...>;
+  };
+  ///
+  template < typename T >
+  using holder_type_t = typename holder_type::template type<T>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the device
+  using dispatcher_exec_policy = exec_policy;
+
+  // The Dispatcher policy with holder_types used internally to handle the
+  // ranges and callables passed in by the user.
+  using dispatcher_holder_policy = dispatcher_transform_types_t<dispatch_policy, holder_type>;
+
+  using dispatcher_type = Dispatcher<Platform::hip, dispatcher_holder_policy, RAJA::hip_work<BLOCK_SIZE, true>, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_block_begins(std::move(o.m_block_begins))
+    , m_total_blocks(o.m_total_blocks)
+  {
+    o.m_block_begins.clear();
+    o.m_total_blocks = 0;
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_block_begins = std::move(o.m_block_begins);
+    m_total_blocks = o.m_total_blocks;
+
+    o.m_block_begins.clear();
+    o.m_total_blocks = 0;
+    return *this;
+  }
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using Iterator  = camp::decay<decltype(std::begin(iter))>;
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+    using holder = holder_type_t<camp::list<ITERABLE, LOOP_BODY>>;
+
+    Iterator begin = std::begin(iter);
+    Iterator end = std::end(iter);
+    IndexType len = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (len > 0 && BLOCK_SIZE > 0) {
+
+      constexpr index_type block_size = static_cast<index_type>(BLOCK_SIZE);
+
+      m_block_begins.emplace_back(m_total_blocks);
+      m_total_blocks += (static_cast<index_type>(len) + block_size - 1) / block_size;
+
+      storage.template emplace<holder>(
+          get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type r, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(storage), std::end(storage)))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    auto func = hip_unordered_x_block_balanced_global<BLOCK_SIZE, Iterator, value_type, index_type, Args...>;
+
+    //
+    // Compute the requested iteration space size
+    //
+    Iterator begin = std::begin(storage);
+    Iterator end = std::end(storage);
+    IndexType num_loops = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+
+      //
+      // Compute the number of blocks
+      //
+      hip_dim_t blockSize{static_cast<hip_dim_member_t>(BLOCK_SIZE), 1, 1};
+      hip_dim_t gridSize{static_cast<hip_dim_member_t>(m_total_blocks), 1, 1};
+
+      RAJA_FT_BEGIN;
+
+      //
+      // Setup shared memory buffers
+      //
+      size_t shmem = 0;
+
+      //
+      // Copy the first block of each loop to the device
+      //
+      index_type loops = static_cast<index_type>(num_loops);
+      index_type* block_begins =
+          RAJA::hip::temp_malloc<index_type>(r, m_block_begins.size());
+      r.memcpy(block_begins, m_block_begins.data(),
+               m_block_begins.size() * sizeof(index_type));
+
+      {
+        //
+        // Launch the kernel
+        //
+        void* func_args[] = { (void*)&begin, (void*)&block_begins, (void*)&loops, (void*)&args... };
+        RAJA::hip::launch((const void*)func, gridSize, blockSize, func_args, shmem, r, Async);
+      }
+
+      RAJA::hip::temp_free(r, block_begins);
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_block_begins.clear();
+    m_total_blocks = 0;
+  }
+
+private:
+  std::vector<index_type> m_block_begins;
+  index_type m_total_blocks = 0;
+};
+
+
 #if !defined(RAJA_ENABLE_HIP_INDIRECT_FUNCTION_CALL)
 
 /// leave unsupported runner types incomplete
@@ -392,6 +626,30 @@ struct WorkRunner<
         ALLOCATOR_T,
         INDEX_T,
         Args...>;
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::hip_work<BLOCK_SIZE, Async>,
+        RAJA::policy::hip::unordered_hip_loop_x_block_balanced,
+        RAJA::indirect_function_call_dispatch,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::hip_work<BLOCK_SIZE, Async>,
+        RAJA::policy::hip::unordered_hip_loop_x_block_balanced,
+        RAJA::indirect_virtual_function_dispatch,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
 
 #endif
 
@@ -0,0 +1,204 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the HIP WorkQueue, which runs queued work
+ *          items with a persistent kernel.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_WorkQueue_HPP
+#define RAJA_policy_hip_WorkQueue_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <vector>
+
+#include "RAJA/pattern/WorkQueue.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * HIP global function for a work queue. Thread 0 of each block takes the
+ * next item and waits until it is pushed, then all threads of the block call
+ * it. Once every item pushed has finished no item can push more, so the
+ * blocks waiting for items exit.
+ */
+template <size_t BLOCK_SIZE, typename Context>
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void work_queue_hip_global(typename Context::slot_type* slots,
+                                unsigned int* ready,
+                                WorkQueueCounters* counters,
+                                size_t capacity)
+{
+  using slot_type = typename Context::slot_type;
+
+  __shared__ unsigned long long s_item;
+  __shared__ bool s_finished;
+
+  Context ctx(slots, ready, counters, capacity, static_cast<int>(threadIdx.x),
+              static_cast<int>(BLOCK_SIZE));
+
+  for (;;) {
+    if (threadIdx.x == 0) {
+      const unsigned long long item = atomicAdd(&counters->taken, 1ull);
+      bool finished = false;
+      for (;;) {
+        if (item < capacity &&
+            static_cast<volatile unsigned int*>(ready)[item] != 0u) {
+          break;
+        }
+        // read done before pushed, if they match nothing was running
+        const unsigned long long done =
+            static_cast<volatile unsigned long long&>(counters->done);
+        __threadfence();
+        const unsigned long long pushed =
+            static_cast<volatile unsigned long long&>(counters->pushed);
+        if (done == pushed) {
+          finished = true;
+          break;
+        }
+      }
+      __threadfence();
+      s_item = item;
+      s_finished = finished;
+    }
+    __syncthreads();
+    const unsigned long long item = s_item;
+    const bool finished = s_finished;
+    __syncthreads();
+    if (finished) {
+      break;
+    }
+
+    slot_type::device_call(&slots[item], ctx);
+
+    __syncthreads();
+    if (threadIdx.x == 0) {
+      __threadfence();
+      atomicAdd(&counters->done, 1ull);
+    }
+  }
+}
+
+}  // namespace detail
+
+template <size_t BLOCK_SIZE, bool Async, typename... Items>
+class WorkQueue<::RAJA::policy::hip::hip_exec<BLOCK_SIZE, Async>, Items...>
+{
+public:
+  using context_type = WorkQueueContext<Platform::hip, Items...>;
+  using slot_type = typename context_type::slot_type;
+
+  static_assert(sizeof...(Items) > 0, "WorkQueue needs an item type");
+
+  explicit WorkQueue(size_t capacity)
+      : m_host_slots(capacity), m_host_ready(capacity, 0u),
+        m_capacity(capacity)
+  {
+    m_slots = ::RAJA::hip::device_mempool_type::getInstance()
+                  .template malloc<slot_type>(m_capacity);
+    m_ready = ::RAJA::hip::device_mempool_type::getInstance()
+                  .template malloc<unsigned int>(m_capacity);
+    m_counters = ::RAJA::hip::device_mempool_type::getInstance()
+                     .template malloc<detail::WorkQueueCounters>(1);
+  }
+
+  WorkQueue(WorkQueue const&) = delete;
+  WorkQueue& operator=(WorkQueue const&) = delete;
+
+  ~WorkQueue()
+  {
+    ::RAJA::hip::device_mempool_type::getInstance().free(m_slots);
+    ::RAJA::hip::device_mempool_type::getInstance().free(m_ready);
+    ::RAJA::hip::device_mempool_type::getInstance().free(m_counters);
+  }
+
+  //! add item to the queue before the next run
+  template <typename Item>
+  void enqueue(Item const& item)
+  {
+    context_type(m_host_slots.data(), m_host_ready.data(), &m_host_counters,
+                 m_capacity)
+        .push(item);
+  }
+
+  //! number of items the next run starts with
+  size_t size() const { return static_cast<size_t>(m_host_counters.pushed); }
+
+  //! enqueue a persistent kernel on res running the items until none is left
+  resources::EventProxy<resources::Hip> run(resources::Hip res)
+  {
+    const size_t num_items = size();
+    if (num_items > 0) {
+      res.memcpy(m_slots, m_host_slots.data(), sizeof(slot_type) * num_items);
+    }
+    res.memset(m_ready, 0, sizeof(unsigned int) * m_capacity);
+    if (num_items > 0) {
+      // any nonzero flag marks an item as pushed
+      res.memset(m_ready, 1, sizeof(unsigned int) * num_items);
+    }
+    res.memcpy(m_counters, &m_host_counters, sizeof(detail::WorkQueueCounters));
+    m_host_counters = detail::WorkQueueCounters{0, 0, 0};
+
+    if (num_items > 0) {
+      auto func = detail::work_queue_hip_global<BLOCK_SIZE, context_type>;
+
+      // every block that can be resident, blocks without an item wait for
+      // the items the running ones push
+      hip_dim_t gridSize{static_cast<unsigned int>(
+                             ::RAJA::hip::device_prop().multiProcessorCount),
+                         1, 1};
+      hip_dim_t blockSize{static_cast<unsigned int>(BLOCK_SIZE), 1, 1};
+
+      slot_type* slots = m_slots;
+      unsigned int* ready = m_ready;
+      detail::WorkQueueCounters* counters = m_counters;
+      size_t capacity = m_capacity;
+
+      void* args[] = {(void*)&slots, (void*)&ready, (void*)&counters,
+                      (void*)&capacity};
+      ::RAJA::hip::launch((const void*)func, gridSize, blockSize, args, 0,
+                          res, Async);
+    }
+    return resources::EventProxy<resources::Hip>(res);
+  }
+
+private:
+  std::vector<slot_type> m_host_slots;
+  std::vector<unsigned int> m_host_ready;
+  detail::WorkQueueCounters m_host_counters{0, 0, 0};
+  slot_type* m_slots = nullptr;
+  unsigned int* m_ready = nullptr;
+  detail::WorkQueueCounters* m_counters = nullptr;
+  size_t m_capacity;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_HIP guard
+
+#endif  // closing endif for header file include guard
@@ -230,10 +230,31 @@ using hip_atomicSub_via_Add_builtin_types = list<
 #endif
     >;
 
+/*!
+ * List of types where HIP builtin integer atomics are used to implement
+ * atomicMin and atomicMax.
+ */
+using hip_atomicMinMax_types = list<
+      int
+     ,unsigned int
+     ,unsigned long long
+     ,float
+     ,double
+    >;
+
 using hip_atomicMin_builtin_types = hip_atomicCommon_builtin_types;
 
 using hip_atomicMax_builtin_types = hip_atomicCommon_builtin_types;
 
+/*!
+ * List of floating point types where HIP builtin integer atomics on their
+ * bits are used to implement atomicMin and atomicMax.
+ */
+using hip_atomicMinMax_via_int_types = list<
+      float
+     ,double
+    >;
+
 using hip_atomicIncReset_builtin_types = list<
       unsigned int
     >;
@@ -304,7 +325,7 @@ RAJA_INLINE __device__ T hip_atomicSub(T volatile *acc, T value)
 }
 
 
-template <typename T, enable_if_is_none_of<T, hip_atomicMin_builtin_types>* = nullptr>
+template <typename T, enable_if_is_none_of<T, hip_atomicMinMax_types>* = nullptr>
 RAJA_INLINE __device__ T hip_atomicMin(T volatile *acc, T value)
 {
   return hip_atomic_CAS_oper(acc, [=] __device__(T a) {
@@ -319,7 +340,7 @@ RAJA_INLINE __device__ T hip_atomicMin(T volatile *acc, T value)
 }
 
 
-template <typename T, enable_if_is_none_of<T, hip_atomicMax_builtin_types>* = nullptr>
+template <typename T, enable_if_is_none_of<T, hip_atomicMinMax_types>* = nullptr>
 RAJA_INLINE __device__ T hip_atomicMax(T volatile *acc, T value)
 {
   return hip_atomic_CAS_oper(acc, [=] __device__(T a) {
@@ -333,6 +354,62 @@ RAJA_INLINE __device__ T hip_atomicMax(T volatile *acc, T value)
   return ::atomicMax((T *)acc, value);
 }
 
+/*!
+ * Floating point atomicMin and atomicMax via integer atomics instead of CAS
+ * loops: non-negative values order like their bits as signed integers and
+ * negative values order in reverse like their bits as unsigned integers.
+ * The result with NaN values is unspecified.
+ */
+RAJA_INLINE __device__ float hip_atomicMin_via_int(float volatile *acc,
+                                                   float value)
+{
+  return __float_as_int(value) < 0
+      ? __uint_as_float(::atomicMax((unsigned int *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMin((int *)acc, __float_as_int(value)));
+}
+
+RAJA_INLINE __device__ double hip_atomicMin_via_int(double volatile *acc,
+                                                    double value)
+{
+  long long bits = __double_as_longlong(value);
+  return bits < 0
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMax((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(::atomicMin((long long *)acc, bits));
+}
+
+RAJA_INLINE __device__ float hip_atomicMax_via_int(float volatile *acc,
+                                                   float value)
+{
+  return __float_as_int(value) < 0
+      ? __uint_as_float(::atomicMin((unsigned int *)acc, __float_as_uint(value)))
+      : __int_as_float(::atomicMax((int *)acc, __float_as_int(value)));
+}
+
+RAJA_INLINE __device__ double hip_atomicMax_via_int(double volatile *acc,
+                                                    double value)
+{
+  long long bits = __double_as_longlong(value);
+  return bits < 0
+      ? __longlong_as_double(static_cast<long long>(
+            ::atomicMin((unsigned long long *)acc,
+                        static_cast<unsigned long long>(bits))))
+      : __longlong_as_double(::atomicMax((long long *)acc, bits));
+}
+
+template <typename T, enable_if_is_any_of<T, hip_atomicMinMax_via_int_types>* = nullptr>
+RAJA_INLINE __device__ T hip_atomicMin(T volatile *acc, T value)
+{
+  return hip_atomicMin_via_int(acc, value);
+}
+
+template <typename T, enable_if_is_any_of<T, hip_atomicMinMax_via_int_types>* = nullptr>
+RAJA_INLINE __device__ T hip_atomicMax(T volatile *acc, T value)
+{
+  return hip_atomicMax_via_int(acc, value);
+}
+
 
 template <typename T, enable_if_is_none_of<T, hip_atomicIncReset_builtin_types>* = nullptr>
 RAJA_INLINE __device__ T hip_atomicInc(T volatile *acc, T val)
@@ -0,0 +1,346 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining wavefront aggregated atomic operations
+ *          for HIP
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_atomic_aggregated_HPP
+#define RAJA_policy_hip_atomic_aggregated_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <type_traits>
+
+#include <hip/hip_runtime.h>
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+#include "RAJA/policy/desul/atomic.hpp"
+#else
+#include "RAJA/policy/hip/atomic.hpp"
+#endif
+
+#include "RAJA/policy/hip/policy.hpp"
+
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/policy/hip/reduce.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+
+namespace detail
+{
+
+#if defined(__HIP_DEVICE_COMPILE__)
+
+/*!
+ * Returns the lane of the n-th (0 based) set bit of mask.
+ */
+RAJA_INLINE __device__ int hip_nth_set_lane(unsigned long long mask, int n)
+{
+  int lane = 0;
+  for (int width = 32; width > 0; width /= 2) {
+    const int count = __popcll((mask >> lane) & ((1ull << width) - 1ull));
+    if (n >= count) {
+      n -= count;
+      lane += width;
+    }
+  }
+  return lane;
+}
+
+/*!
+ * Returns the mask of the active lanes in the wavefront that use the same
+ * acc as the calling lane.
+ * Hip has no match any primitive so the lanes are grouped one address at a
+ * time.
+ */
+RAJA_INLINE __device__ unsigned long long hip_match_any(void volatile *acc)
+{
+  const unsigned long long addr = reinterpret_cast<unsigned long long>(acc);
+  unsigned long long remaining = __ballot(1);
+  unsigned long long peers = 0;
+  while (remaining != 0ull) {
+    const int leader = __ffsll(remaining) - 1;
+    const unsigned long long leader_addr =
+        ::RAJA::hip::impl::shfl_sync(addr, leader);
+    const unsigned long long match = __ballot(addr == leader_addr);
+    if (addr == leader_addr) {
+      peers = match;
+    }
+    remaining &= ~match;
+  }
+  return peers;
+}
+
+/*!
+ * Aggregated atomic implementation.
+ * The active threads in the wavefront that use the same acc are grouped,
+ * their values are combined with combine, and the last thread of each group
+ * performs the atomic with the combined value.
+ * Each thread returns the value it would have seen if the threads of its
+ * group had performed their atomics in lane order, apply computes that value
+ * from the value returned by the atomic and the combined values of the lower
+ * lanes of the group.
+ */
+template <typename T, typename Combine, typename Apply, typename Atomic>
+RAJA_INLINE __device__ T hip_atomic_aggregate(T volatile *acc,
+                                              T value,
+                                              Combine combine,
+                                              Apply apply,
+                                              Atomic atomic)
+{
+  const unsigned long long peers = hip_match_any(acc);
+  const unsigned long long lanemask_lt = (1ull << __lane_id()) - 1ull;
+  const int rank = __popcll(peers & lanemask_lt);
+  const int num_peers = __popcll(peers);
+
+  // inclusive scan of the values of the group in lane order
+  T inclusive = value;
+  for (int dist = 1; __any(dist < num_peers); dist *= 2) {
+    const int src_rank = rank - dist;
+    const int src = hip_nth_set_lane(peers, src_rank >= 0 ? src_rank : rank);
+    const T other = ::RAJA::hip::impl::shfl_sync(inclusive, src);
+    if (src_rank >= 0) {
+      inclusive = combine(other, inclusive);
+    }
+  }
+
+  const T exclusive = ::RAJA::hip::impl::shfl_sync(
+      inclusive, hip_nth_set_lane(peers, rank > 0 ? rank - 1 : 0));
+
+  T old = inclusive;
+  if (rank == num_peers - 1) {
+    old = atomic(acc, inclusive);
+  }
+  old = ::RAJA::hip::impl::shfl_sync(old, hip_nth_set_lane(peers, num_peers - 1));
+
+  return rank > 0 ? apply(old, exclusive) : old;
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Aggregated atomics combine the operations of the threads in a wavefront that
+ * target the same address, which reduces the number of atomics performed
+ * on highly contended addresses. Operations that can not be combined
+ * perform the atomic of each thread.
+ *
+ * These are atomic in hip device code and use the host_policy otherwise
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::plus<T>{}, operators::plus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::plus<T>{}, operators::minus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::minimum<T>{}, operators::minimum<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicMin(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicMin(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::maximum<T>{}, operators::maximum<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicMax(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicMax(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T val)
+{
+  // wrapping increments can not be combined
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, T(1),
+      operators::plus<T>{}, operators::plus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T val)
+{
+  // wrapping decrements can not be combined
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, T(1),
+      operators::plus<T>{}, operators::minus<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::bit_and<T>{}, operators::bit_and<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicAnd(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicAnd(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::bit_or<T>{}, operators::bit_or<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicOr(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicOr(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return detail::hip_atomic_aggregate(acc, value,
+      operators::bit_xor<T>{}, operators::bit_xor<T>{},
+      [](T volatile *a, T v) {
+        return RAJA::atomicXor(hip_atomic_explicit<host_policy>{}, a, v);
+      });
+#else
+  return RAJA::atomicXor(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(hip_atomic_aggregated_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(hip_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+
+namespace detail
+{
+
+// reserve with the aggregated atomics so threads in a warp reserving from
+// the same counter perform one atomic and get offsets in lane order
+template <typename host_policy>
+struct atomic_reserve_policy<hip_atomic_explicit<host_policy>> {
+  using type = hip_atomic_aggregated_explicit<host_policy>;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_HIP
+#endif  // guard
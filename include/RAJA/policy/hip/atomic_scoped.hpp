@@ -0,0 +1,593 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining scoped atomic operations for HIP
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_atomic_scoped_HPP
+#define RAJA_policy_hip_atomic_scoped_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <type_traits>
+
+#include <hip/hip_runtime.h>
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+#include "RAJA/policy/desul/atomic.hpp"
+#else
+#include "RAJA/policy/hip/atomic.hpp"
+#endif
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+
+#include "RAJA/util/TypeConvert.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+
+namespace detail
+{
+
+/*!
+ * Scoped hip atomic policies use the desul memory scope of their scope
+ */
+template <typename scope, typename host_policy>
+struct desul_policy_scope<hip_atomic_scoped_explicit<scope, host_policy>>
+    : desul_scope<scope> {
+};
+
+}  // namespace detail
+
+#else
+
+// The clang scoped atomic builtins define the memory scope macros, without
+// them the scoped policies use device scope atomics.
+#if defined(__HIP_DEVICE_COMPILE__) && defined(__HIP_MEMORY_SCOPE_WORKGROUP)
+#define RAJA_HIP_HAVE_SCOPED_ATOMICS
+#endif
+
+namespace detail
+{
+
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+
+/*!
+ * HIP memory scope of a RAJA::atomic_scope.
+ */
+template <typename Scope>
+struct hip_memory_scope;
+///
+template <>
+struct hip_memory_scope<atomic_scope::block>
+    : std::integral_constant<int, __HIP_MEMORY_SCOPE_WORKGROUP> {
+};
+///
+template <>
+struct hip_memory_scope<atomic_scope::system>
+    : std::integral_constant<int, __HIP_MEMORY_SCOPE_SYSTEM> {
+};
+
+/*!
+ * Unsigned type used to compare and swap T.
+ */
+template <typename T>
+using hip_scoped_atomic_uint = typename std::enable_if<
+    sizeof(T) == sizeof(unsigned) || sizeof(T) == sizeof(unsigned long long),
+    typename std::conditional<sizeof(T) == sizeof(unsigned),
+                              unsigned,
+                              unsigned long long>::type>::type;
+
+/*!
+ * Scoped compare and swap of unsigned 32-bit and 64-bit integers.
+ * Returns the value that was stored before this operation.
+ */
+template <typename Scope, typename U>
+RAJA_INLINE __device__ U hip_scoped_atomic_uint_CAS(U volatile *acc,
+                                                    U compare,
+                                                    U value)
+{
+  __hip_atomic_compare_exchange_strong((U *)acc, &compare, value,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED,
+                                       hip_memory_scope<Scope>::value);
+  return compare;
+}
+
+/*!
+ * Scoped compare and swap of any 32-bit or 64-bit type.
+ * Returns the value that was stored before this operation.
+ */
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomic_CAS(T volatile *acc,
+                                               T compare,
+                                               T value)
+{
+  using U = hip_scoped_atomic_uint<T>;
+  return RAJA::util::reinterp_A_as_B<U, T>(
+      hip_scoped_atomic_uint_CAS<Scope>((U volatile *)acc,
+          RAJA::util::reinterp_A_as_B<T, U>(compare),
+          RAJA::util::reinterp_A_as_B<T, U>(value)));
+}
+
+/*!
+ * Scoped implementation of any atomic 32-bit or 64-bit operator using
+ * compare and swap.
+ * Returns the OLD value that was replaced by the result of this operation.
+ */
+template <typename Scope, typename T, typename OPER>
+RAJA_INLINE __device__ T hip_scoped_atomic_CAS_oper(T volatile *acc,
+                                                    OPER const &oper)
+{
+  using U = hip_scoped_atomic_uint<T>;
+  U oldval, newval, readback;
+  oldval = RAJA::util::reinterp_A_as_B<T, U>(*acc);
+  newval = RAJA::util::reinterp_A_as_B<T, U>(
+      oper(RAJA::util::reinterp_A_as_B<U, T>(oldval)));
+  while ((readback = hip_scoped_atomic_uint_CAS<Scope>((U volatile *)acc,
+                                                       oldval, newval)) != oldval) {
+    oldval = readback;
+    newval = RAJA::util::reinterp_A_as_B<T, U>(
+        oper(RAJA::util::reinterp_A_as_B<U, T>(oldval)));
+  }
+  return RAJA::util::reinterp_A_as_B<U, T>(oldval);
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicAdd(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_add((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicAdd(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a + value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicSub(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_sub((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicSub(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a - value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicMin(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_min((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicMin(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return value < a ? value : a;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicMax(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_max((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicMax(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return value > a ? value : a;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicAnd(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_and((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicAnd(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a & value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicOr(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_or((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicOr(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a | value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicXor(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_fetch_xor((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicXor(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T a) {
+    return a ^ value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicExchange(std::true_type, T volatile *acc, T value)
+{
+  return __hip_atomic_exchange((T *)acc, value, __ATOMIC_RELAXED,
+      hip_memory_scope<Scope>::value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicExchange(std::false_type, T volatile *acc, T value)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T) {
+    return value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicInc(std::false_type, T volatile *acc, T val)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T old) {
+    return ((old >= val) ? (T)0 : (old + (T)1));
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE __device__ T hip_scoped_atomicDec(std::false_type, T volatile *acc, T val)
+{
+  return hip_scoped_atomic_CAS_oper<Scope>(acc, [=] __device__(T old) {
+    return (((old == (T)0) | (old > val)) ? val : (old - (T)1));
+  });
+}
+
+#endif
+
+}  // namespace detail
+
+
+/*!
+ * Scoped policies use the clang scoped atomic builtins for the types they
+ * support and use compare and swap with the same scope otherwise.
+ *
+ * The device scope policy is the same as hip_atomic_explicit.
+ *
+ * These are atomic in hip device code and use the host_policy otherwise
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicAdd<scope>(
+      std::is_arithmetic<T>{}, acc, value);
+#else
+  return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicSub<scope>(
+      std::is_arithmetic<T>{}, acc, value);
+#else
+  return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicMin(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicMin<scope>(
+      std::is_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicMin(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicMax(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicMax<scope>(
+      std::is_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicMax(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T val)
+{
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T val)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicInc<scope>(
+      std::false_type{}, acc, val);
+#else
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc, val);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc)
+{
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicAdd<scope>(
+      std::is_arithmetic<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T val)
+{
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T val)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicDec<scope>(
+      std::false_type{}, acc, val);
+#else
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc, val);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc)
+{
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicSub<scope>(
+      std::is_arithmetic<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicAnd(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicAnd<scope>(
+      std::is_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicAnd(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+         T volatile *acc, T value)
+{
+  return RAJA::atomicOr(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicOr<scope>(
+      std::is_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicOr(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T value)
+{
+  return RAJA::atomicXor(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicXor<scope>(
+      std::is_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicXor(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+               T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomicExchange<scope>(
+      std::is_arithmetic<T>{}, acc, value);
+#else
+  return RAJA::atomicExchange(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(hip_atomic_scoped_explicit<atomic_scope::device, host_policy>,
+          T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(hip_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(hip_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T compare, T value)
+{
+#if defined(RAJA_HIP_HAVE_SCOPED_ATOMICS)
+  return detail::hip_scoped_atomic_CAS<scope>(acc, compare, value);
+#else
+  return RAJA::atomicCAS(hip_atomic_explicit<host_policy>{}, acc, compare, value);
+#endif
+}
+
+#endif  // RAJA_ENABLE_DESUL_ATOMICS
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_HIP
+#endif  // guard
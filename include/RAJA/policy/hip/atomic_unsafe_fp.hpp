@@ -0,0 +1,222 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic operations for HIP that use the
+ *          unsafe hardware floating point atomics.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_atomic_unsafe_fp_HPP
+#define RAJA_policy_hip_atomic_unsafe_fp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <type_traits>
+
+#include <hip/hip_runtime.h>
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+#include "RAJA/policy/desul/atomic.hpp"
+#else
+#include "RAJA/policy/hip/atomic.hpp"
+#endif
+
+#include "RAJA/policy/hip/policy.hpp"
+
+#include "RAJA/pattern/atomic.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+
+/*!
+ * Unsafe floating point atomics use the hardware float and double atomicAdd
+ * instructions of gfx90a and later with unsafeAtomicAdd, where hip_atomic
+ * uses a compare and swap loop unless the whole translation unit is compiled
+ * with -munsafe-fp-atomics. The hardware instructions only work on
+ * coarse-grained memory, such as memory from hipMalloc or
+ * RAJA::hip::device_coarse_mempool_type, they silently do nothing on
+ * fine-grained memory such as managed or host pinned memory.
+ *
+ * Other operations and types use hip_atomic_explicit<host_policy>.
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE float
+atomicAdd(hip_atomic_unsafe_fp_explicit<host_policy>,
+          float volatile *acc,
+          float value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return ::unsafeAtomicAdd(const_cast<float *>(acc), value);
+#else
+  return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE double
+atomicAdd(hip_atomic_unsafe_fp_explicit<host_policy>,
+          double volatile *acc,
+          double value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return ::unsafeAtomicAdd(const_cast<double *>(acc), value);
+#else
+  return RAJA::atomicAdd(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE float
+atomicSub(hip_atomic_unsafe_fp_explicit<host_policy>,
+          float volatile *acc,
+          float value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return ::unsafeAtomicAdd(const_cast<float *>(acc), -value);
+#else
+  return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE double
+atomicSub(hip_atomic_unsafe_fp_explicit<host_policy>,
+          double volatile *acc,
+          double value)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+  return ::unsafeAtomicAdd(const_cast<double *>(acc), -value);
+#else
+  return RAJA::atomicSub(hip_atomic_explicit<host_policy>{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicMin(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicMax(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T val)
+{
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc)
+{
+  return RAJA::atomicInc(hip_atomic_explicit<host_policy>{}, acc);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T val)
+{
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc)
+{
+  return RAJA::atomicDec(hip_atomic_explicit<host_policy>{}, acc);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicAnd(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicOr(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicXor(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T value)
+{
+  return RAJA::atomicExchange(hip_atomic_explicit<host_policy>{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(hip_atomic_unsafe_fp_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+  return RAJA::atomicCAS(hip_atomic_explicit<host_policy>{}, acc, compare, value);
+}
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_HIP
+#endif  // guard
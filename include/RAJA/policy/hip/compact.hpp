@@ -0,0 +1,300 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_hip_HPP
+#define RAJA_compact_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <iterator>
+#include <type_traits>
+
+#if defined(__HIPCC__)
+#define ROCPRIM_HIP_API 1
+#include "rocprim/device/device_partition.hpp"
+#include "rocprim/device/device_reduce_by_key.hpp"
+#include "rocprim/device/device_select.hpp"
+#elif defined(__CUDACC__)
+#include "cub/device/device_partition.cuh"
+#include "cub/device/device_reduce.cuh"
+#include "cub/device/device_select.cuh"
+#include "cub/util_allocator.cuh"
+#endif
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief explicit copy if given input range, output, count output, and
+   predicate, uses the single pass decoupled look-back select of rocPRIM
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+copy_if(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(begin, end);
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::select(d_temp_storage,
+                                 temp_storage_bytes,
+                                 begin,
+                                 out,
+                                 num_selected,
+                                 len,
+                                 pred,
+                                 stream);
+#elif defined(__CUDACC__)
+        return ::cub::DeviceSelect::If(d_temp_storage,
+                                       temp_storage_bytes,
+                                       begin,
+                                       out,
+                                       num_selected,
+                                       len,
+                                       pred,
+                                       stream);
+#endif
+      },
+      len));
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief explicit partition given input range, output, count output, and
+   predicate, uses the single pass decoupled look-back partition of rocPRIM
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+partition(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(begin, end);
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::partition(d_temp_storage,
+                                    temp_storage_bytes,
+                                    begin,
+                                    out,
+                                    num_selected,
+                                    len,
+                                    pred,
+                                    stream);
+#elif defined(__CUDACC__)
+        return ::cub::DevicePartition::If(d_temp_storage,
+                                          temp_storage_bytes,
+                                          begin,
+                                          out,
+                                          num_selected,
+                                          len,
+                                          pred,
+                                          stream);
+#endif
+      },
+      len));
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief explicit unique given input range, output, count output, and
+   equality function, uses the single pass decoupled look-back unique of
+   rocPRIM
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename CountIter,
+          typename Compare>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+unique(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    CountIter num_selected,
+    Compare eq)
+{
+#if defined(__CUDACC__)
+  static_assert (camp::is_same<Compare,
+                     operators::equal_to<RAJA::detail::IterVal<InputIter>>>::value,
+      "unique<hip_exec> is only implemented for RAJA::operators::equal_to with cub");
+  RAJA_UNUSED_VAR(eq);
+#endif
+
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(begin, end);
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::unique(d_temp_storage,
+                                 temp_storage_bytes,
+                                 begin,
+                                 out,
+                                 num_selected,
+                                 len,
+                                 eq,
+                                 stream);
+#elif defined(__CUDACC__)
+        return ::cub::DeviceSelect::Unique(d_temp_storage,
+                                           temp_storage_bytes,
+                                           begin,
+                                           out,
+                                           num_selected,
+                                           len,
+                                           stream);
+#endif
+      },
+      len));
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief explicit reduce by key given key and value input ranges, key
+   and value outputs, count output, and reduction function, uses the reduce
+   by key of rocPRIM
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename CountIter,
+          typename BinaryOp>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+reduce_by_key(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValueIter values,
+    OutKeyIter out_keys,
+    OutValueIter out_values,
+    CountIter num_segments,
+    BinaryOp op)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(keys_begin, keys_end);
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::reduce_by_key(
+         d_temp_storage,
+         temp_storage_bytes,
+         keys_begin,
+         values,
+         len,
+         out_keys,
+         out_values,
+         num_segments,
+         op,
+         ::rocprim::equal_to<RAJA::detail::IterVal<KeyIter>>(),
+         stream);
+#elif defined(__CUDACC__)
+        return ::cub::DeviceReduce::ReduceByKey(d_temp_storage,
+                                                temp_storage_bytes,
+                                                keys_begin,
+                                                out_keys,
+                                                values,
+                                                out_values,
+                                                num_segments,
+                                                op,
+                                                len,
+                                                stream);
+#endif
+      },
+      len));
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_HIP guard
+
+#endif  // closing endif for header file include guard
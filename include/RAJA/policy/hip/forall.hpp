@@ -27,6 +27,7 @@
 #if defined(RAJA_ENABLE_HIP)
 
 #include <algorithm>
+#include <vector>
 #include "hip/hip_runtime.h"
 
 #include "RAJA/pattern/forall.hpp"
@@ -38,10 +39,14 @@
 
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 #include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/MultiDevice.hpp"
 #include "RAJA/policy/hip/raja_hiperrchk.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
 
+#include "RAJA/index/DeviceIndexSet.hpp"
+#include "RAJA/pattern/detail/fused_segments.hpp"
+
 namespace RAJA
 {
 
@@ -70,6 +75,55 @@ hip_dim_t getGridDim(hip_dim_member_t len, hip_dim_t blockDim)
   return gridSize;
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief calculate the maximum number of blocks of func that can be resident
+ *        on the device at once using the HIP occupancy calculator
+ *
+ * The result is cached per UniqueMarker and shmem_size by
+ * internal::hip_occupancy_max_blocks.
+ *
+ ******************************************************************************
+ */
+template < typename UniqueMarker, size_t BlockSize >
+RAJA_INLINE
+hip_dim_member_t getOccMaxGridSize(const void* func, size_t shmem_size)
+{
+  int max_blocks = 0;
+  ::RAJA::internal::hip_occupancy_max_blocks<UniqueMarker,
+                                             static_cast<int>(BlockSize)>(
+      func, static_cast<int>(shmem_size), max_blocks);
+
+  // always allow at least one block per CU so launches make progress
+  max_blocks = std::max(max_blocks, hip::device_prop().multiProcessorCount);
+
+  return static_cast<hip_dim_member_t>(max_blocks);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief calculate gridDim from length of iteration and blockDim capped at
+ *        the largest grid that can be resident on the device at once
+ *
+ ******************************************************************************
+ */
+template < typename UniqueMarker, size_t BlockSize >
+RAJA_INLINE
+hip_dim_t getOccGridDim(hip_dim_member_t len, hip_dim_t blockDim,
+                        const void* func, size_t shmem_size)
+{
+  hip_dim_t gridDim = getGridDim(len, blockDim);
+
+  hip_dim_member_t max_grid_size =
+      getOccMaxGridSize<UniqueMarker, BlockSize>(func, shmem_size);
+
+  gridDim.x = std::min(gridDim.x, max_grid_size);
+
+  return gridDim;
+}
+
 /*!
  ******************************************************************************
  *
@@ -171,6 +225,122 @@ __launch_bounds__(BlockSize, 1) __global__
   RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(f_params);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP kernal forall template using a grid-stride loop.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_hip_occ_kernel(LOOP_BODY loop_body,
+                               const Iterator idx,
+                               IndexType length)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto stride = static_cast<IndexType>(getGlobalNumThreads_1D_1D<BlockSize>());
+  for (auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D<BlockSize>());
+       ii < length;
+       ii += stride) {
+    body(idx[ii]);
+  }
+}
+
+template <typename EXEC_POL,
+          size_t BlockSize,
+          typename Iterator,
+          typename LOOP_BODY,
+          typename IndexType,
+          typename ForallParam>
+__launch_bounds__(BlockSize, 1) __global__
+    void forallp_hip_occ_kernel(
+                            LOOP_BODY loop_body,
+                            const Iterator idx,
+                            IndexType length,
+                            ForallParam f_params)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  auto stride = static_cast<IndexType>(getGlobalNumThreads_1D_1D<BlockSize>());
+  for (auto ii = static_cast<IndexType>(getGlobalIdx_1D_1D<BlockSize>());
+       ii < length;
+       ii += stride) {
+    RAJA::expt::invoke_body( f_params, body, idx[ii] );
+  }
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(f_params);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP kernel forall template running all the segments of an index
+ *         set, each block runs part of one segment of the table.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          typename Table,
+          typename LOOP_BODY>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_hip_fused_segit_kernel(LOOP_BODY loop_body, const Table table)
+{
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loop_body);
+  auto& body = privatizer.get_priv();
+  table.run(body,
+            static_cast<Index_type>(blockIdx.x),
+            static_cast<Index_type>(threadIdx.x),
+            static_cast<Index_type>(BlockSize));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  One resource per visible device, used by multi_device_exec.
+ *
+ *         Peer access is enabled between the devices that support it, so
+ *         that the temporary memory of reductions allocated on one device
+ *         may be used on the others.
+ *
+ ******************************************************************************
+ */
+inline std::vector<resources::Hip>& multi_device_resources()
+{
+  static std::vector<resources::Hip> device_res = [] {
+    int num_dev = 0;
+    hipErrchk(hipGetDeviceCount(&num_dev));
+    int orig_dev = 0;
+    hipErrchk(hipGetDevice(&orig_dev));
+
+    std::vector<resources::Hip> res;
+    for (int d = 0; d < num_dev; ++d) {
+      hipErrchk(hipSetDevice(d));
+      res.push_back(resources::Hip{});
+      for (int p = 0; p < num_dev; ++p) {
+        int can_access = 0;
+        if (p != d &&
+            hipDeviceCanAccessPeer(&can_access, d, p) == hipSuccess &&
+            can_access) {
+          // ignore hipErrorPeerAccessAlreadyEnabled
+          hipDeviceEnablePeerAccess(p, 0);
+          hipGetLastError();
+        }
+      }
+    }
+
+    hipErrchk(hipSetDevice(orig_dev));
+    return res;
+  }();
+  return device_res;
+}
+
 }  // namespace impl
 
 //
@@ -314,7 +484,7 @@ forall_impl(resources::Hip hip_res,
       void *args[] = {(void*)&body, (void*)&begin, (void*)&len, (void*)&f_params};
       RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, hip_res, Async);
 
-      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params, launch_info);
     }
 
     RAJA_FT_END;
@@ -323,6 +493,272 @@ forall_impl(resources::Hip hip_res,
   return resources::EventProxy<resources::Hip>(hip_res);
 }
 
+template <typename Iterable, typename LoopBody, size_t BlockSize, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Hip>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Hip hip_res,
+            hip_exec_occ<BlockSize, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using UniqueMarker = camp::list<camp::num<BlockSize>, Iterator, LOOP_BODY, IndexType>;
+
+  auto func = impl::forall_hip_occ_kernel<BlockSize, Iterator, LOOP_BODY, IndexType>;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    //
+    // Compute the number of blocks, limited to those that can be resident
+    //
+    hip_dim_t blockSize{BlockSize, 1, 1};
+    hip_dim_t gridSize = impl::getOccGridDim<UniqueMarker, BlockSize>(
+        static_cast<hip_dim_member_t>(len), blockSize, (const void*)func, shmem);
+
+    RAJA_FT_BEGIN;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, hip_res, std::forward<LoopBody>(loop_body));
+
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&begin, (void*)&len};
+      RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, hip_res, Async);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+
+template <typename Iterable, typename LoopBody, size_t BlockSize, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Hip>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate< RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>> >
+forall_impl(resources::Hip hip_res,
+            hip_exec_occ<BlockSize, Async>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam f_params)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::hip_exec_occ<BlockSize, Async>;
+  using UniqueMarker = camp::list<EXEC_POL, Iterator, LOOP_BODY, IndexType,
+                                  camp::decay<ForallParam>>;
+
+  auto func = impl::forallp_hip_occ_kernel< EXEC_POL, BlockSize, Iterator, LOOP_BODY, IndexType, camp::decay<ForallParam> >;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    //
+    // Compute the number of blocks, limited to those that can be resident
+    //
+    hip_dim_t blockSize{BlockSize, 1, 1};
+    hip_dim_t gridSize = impl::getOccGridDim<UniqueMarker, BlockSize>(
+        static_cast<hip_dim_member_t>(len), blockSize, (const void*)func, shmem);
+
+    RAJA_FT_BEGIN;
+
+    RAJA::hip::detail::hipInfo launch_info;
+    launch_info.gridDim = gridSize;
+    launch_info.blockDim = blockSize;
+    launch_info.res = hip_res;
+
+    {
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params, launch_info);
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, hip_res, std::forward<LoopBody>(loop_body));
+
+
+      //
+      // Launch the kernels
+      //
+      void *args[] = {(void*)&body, (void*)&begin, (void*)&len, (void*)&f_params};
+      RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, hip_res, Async);
+
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params, launch_info);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP execution over all the visible devices.
+ *
+ *         The iteration space is split into one contiguous part per device
+ *         and each part runs on a stream of its device, after the work
+ *         already enqueued on hip_res. Then hip_res waits for all the
+ *         parts, and the forall parameters of each part are resolved into
+ *         the same targets.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename LoopBody, size_t BlockSize, bool Async, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Hip>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>>
+forall_impl(resources::Hip hip_res,
+            multi_device_exec<hip_exec<BlockSize, Async>>,
+            Iterable&& iter,
+            LoopBody&& loop_body,
+            ForallParam f_params)
+{
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::hip_exec<BlockSize, true>;
+
+  auto func = impl::forallp_hip_kernel< EXEC_POL, BlockSize, Iterator, LOOP_BODY, IndexType, camp::decay<ForallParam> >;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernels if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    std::vector<resources::Hip>& device_res = impl::multi_device_resources();
+    const int num_dev = static_cast<int>(device_res.size());
+
+    int orig_dev = 0;
+    hipErrchk(hipGetDevice(&orig_dev));
+
+    resources::Event start = hip_res.get_event();
+
+    std::vector<camp::decay<ForallParam>> device_params(num_dev, f_params);
+    std::vector<char> has_part(num_dev, 0);
+
+    // Reducer objects in the loop body would each combine only one part,
+    // so make_launch_body throws for them
+    RAJA::hip::detail::SetterResetter<bool> reject_reducers_srer(
+        RAJA::hip::detail::tl_status.reject_reducers, true);
+
+    RAJA_FT_BEGIN;
+
+    for (int d = 0; d < num_dev; ++d) {
+      IndexType lo = static_cast<IndexType>((static_cast<long long>(len) * d) / num_dev);
+      IndexType hi = static_cast<IndexType>((static_cast<long long>(len) * (d + 1)) / num_dev);
+      IndexType part_len = hi - lo;
+      if (part_len <= 0) continue;
+
+      Iterator part_begin = begin + lo;
+
+      //
+      // Compute the number of blocks
+      //
+      hip_dim_t blockSize{BlockSize, 1, 1};
+      hip_dim_t gridSize = impl::getGridDim(static_cast<hip_dim_member_t>(part_len), blockSize);
+
+      //
+      // Setup shared memory buffers
+      //
+      size_t shmem = 0;
+
+      //
+      // Privatize the loop_body before changing the device, so a rejected
+      // reducer object leaves the current device and the parameters alone
+      //
+      LOOP_BODY body = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, device_res[d], loop_body);
+
+      hipErrchk(hipSetDevice(d));
+      resources::Hip part_res = device_res[d];
+      part_res.wait_for(&start);
+      has_part[d] = 1;
+
+      RAJA::hip::detail::hipInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = part_res;
+
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(device_params[d], launch_info);
+
+      //
+      // Launch the kernel of this part, without waiting for it
+      //
+      void *args[] = {(void*)&body, (void*)&part_begin, (void*)&part_len, (void*)&device_params[d]};
+      RAJA::hip::launch((const void*)func, gridSize, blockSize, args, shmem, part_res, true);
+    }
+
+    for (int d = 0; d < num_dev; ++d) {
+      if (!has_part[d]) continue;
+
+      hipErrchk(hipSetDevice(d));
+      RAJA::hip::detail::hipInfo resolve_info;
+      resolve_info.res = device_res[d];
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(device_params[d], resolve_info);
+
+      resources::Event done = device_res[d].get_event();
+      hip_res.wait_for(&done);
+    }
+
+    hipErrchk(hipSetDevice(orig_dev));
+
+    RAJA_FT_END;
+
+    if (!Async) RAJA::hip::synchronize(hip_res);
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -364,6 +800,174 @@ forall_impl(resources::Hip r,
   return resources::EventProxy<resources::Hip>(r);
 }
 
+template <typename LoopBody,
+          size_t BlockSize,
+          bool Async,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Hip>
+forall_impl(resources::Hip r,
+            ExecPolicy<seq_segit, hip_exec_occ<BlockSize, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body)
+{
+  int num_seg = iset.getNumSegments();
+  for (int isi = 0; isi < num_seg; ++isi) {
+    iset.segmentCall(r,
+                     isi,
+                     detail::CallForall(),
+                     hip_exec_occ<BlockSize, true>(),
+                     loop_body);
+  }  // iterate over segments of index set
+
+  if (!Async) RAJA::hip::synchronize(r);
+  return resources::EventProxy<resources::Hip>(r);
+}
+
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP execution of all the segments of index set in one kernel.
+ *
+ *         The segments are described in a table that is built on the host
+ *         and copied to the device with one copy; each segment gets enough
+ *         blocks for its length and every block looks up its segment in the
+ *         table.  This saves the launch latency of one kernel per segment
+ *         for index sets with many small segments.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody,
+          size_t BlockSize,
+          bool Async,
+          typename... SegmentTypes,
+          typename ForallParam>
+RAJA_INLINE resources::EventProxy<resources::Hip>
+forall_impl(resources::Hip hip_res,
+            ExecPolicy<hip_segit_fused, hip_exec<BlockSize, Async>>,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  static_assert(RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>::value,
+                "hip_segit_fused does not support forall parameters");
+
+  using Table = RAJA::detail::FusedSegmentTable<SegmentTypes...>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  auto func = impl::forall_hip_fused_segit_kernel<BlockSize, Table, LOOP_BODY>;
+
+  RAJA::detail::FusedSegmentTableBuilder<SegmentTypes...> builder(iset, BlockSize);
+
+  // Only launch kernel if we have something to iterate over
+  if (builder.num_blocks() > 0) {
+
+    hip_dim_t blockSize{BlockSize, 1, 1};
+    hip_dim_t gridSize{static_cast<hip_dim_member_t>(builder.num_blocks()), 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Copy the segment table to the device
+    //
+    char* d_table = hip::temp_malloc<char>(hip_res, builder.bytes());
+    hipErrchk(hipMemcpyAsync(d_table, builder.data(), builder.bytes(),
+                               hipMemcpyHostToDevice, hip_res.get_stream()));
+    Table table = builder.table(d_table);
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, hip_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernel
+      //
+      void *args[] = {(void*)&body, (void*)&table};
+      RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, hip_res, Async);
+    }
+
+    hip::temp_free(hip_res, d_table);
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP execution of all the segments of an index set in one kernel
+ *         using the resident segment table of a TypedDeviceIndexSet, so no
+ *         table is built or copied per launch.
+ *
+ ******************************************************************************
+ */
+template <typename LoopBody,
+          size_t BlockSize,
+          bool Async,
+          typename... SegmentTypes,
+          typename ForallParam>
+RAJA_INLINE resources::EventProxy<resources::Hip>
+forall_impl(resources::Hip hip_res,
+            ExecPolicy<hip_segit_fused, hip_exec<BlockSize, Async>>,
+            const TypedDeviceIndexSet<SegmentTypes...>& diset,
+            LoopBody&& loop_body,
+            ForallParam)
+{
+  static_assert(RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>::value,
+                "hip_segit_fused does not support forall parameters");
+
+  using Table = RAJA::detail::FusedSegmentTable<SegmentTypes...>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+
+  auto func = impl::forall_hip_fused_segit_kernel<BlockSize, Table, LOOP_BODY>;
+
+  auto entry = diset.getTable(BlockSize);
+
+  // Only launch kernel if we have something to iterate over
+  if (entry.num_blocks > 0) {
+
+    hip_dim_t blockSize{BlockSize, 1, 1};
+    hip_dim_t gridSize{static_cast<hip_dim_member_t>(entry.num_blocks), 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    Table table = entry.table;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loop_body, using make_launch_body to setup reductions
+      //
+      LOOP_BODY body = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, hip_res, std::forward<LoopBody>(loop_body));
+
+      //
+      // Launch the kernel
+      //
+      void *args[] = {(void*)&body, (void*)&table};
+      RAJA::hip::launch((const void*)func, gridSize, BlockSize, args, shmem, hip_res, Async);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
 }  // namespace hip
 
 }  // namespace policy
@@ -0,0 +1,212 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA fused forall declarations for HIP.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_fused_hip_HPP
+#define RAJA_forall_fused_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <iterator>
+#include <type_traits>
+
+#include "hip/hip_runtime.h"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace fused
+{
+
+/*!
+ * Loop of a fused kernel, the iterator to the start of the segment, the
+ * length of the segment, and the loop body.
+ */
+template <typename Iterator, typename IndexType, typename LoopBody>
+struct HipFusedLoop
+{
+  Iterator begin;
+  IndexType length;
+  LoopBody body;
+};
+
+template <typename Segment, typename LoopBody>
+using hip_fused_loop_t = HipFusedLoop<
+    camp::decay<decltype(std::begin(std::declval<Segment&>()))>,
+    camp::decay<decltype(std::distance(std::begin(std::declval<Segment&>()),
+                                       std::end(std::declval<Segment&>())))>,
+    LoopBody>;
+
+/*!
+ * Blocks of a fused kernel, loop i runs in the blocks from begin[i] to
+ * begin[i+1].
+ */
+template <size_t NumLoops>
+struct HipFusedBlocks
+{
+  hip_dim_member_t begin[NumLoops + 1];
+};
+
+/*!
+ * Run the part of a loop assigned to this thread if this block is one of the
+ * blocks of the loop.
+ */
+template <size_t BlockSize, typename Loop>
+__device__ __forceinline__ void forall_fused_hip_loop(
+    Loop& loop,
+    hip_dim_member_t block_begin,
+    hip_dim_member_t block_end)
+{
+  using IndexType = decltype(loop.length);
+  const hip_dim_member_t block = blockIdx.x;
+  if (block_begin <= block && block < block_end) {
+    auto ii = static_cast<IndexType>((block - block_begin) * BlockSize +
+                                     threadIdx.x);
+    if (ii < loop.length) {
+      loop.body(loop.begin[ii]);
+    }
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  HIP kernel running several loops, each in its own range of blocks.
+ *
+ ******************************************************************************
+ */
+template <size_t BlockSize,
+          typename Loops,
+          camp::idx_t... Is>
+__launch_bounds__(BlockSize, 1) __global__
+    void forall_fused_hip_kernel(Loops loops,
+                                 HipFusedBlocks<sizeof...(Is)> blocks)
+{
+  // every thread privatizes all of the loops so reducers used by a loop
+  // see every block of the grid
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(loops);
+  auto& priv_loops = privatizer.get_priv();
+  int unused[] = {0, (forall_fused_hip_loop<BlockSize>(camp::get<Is>(priv_loops),
+                                                       blocks.begin[Is],
+                                                       blocks.begin[Is + 1]), 0)...};
+  RAJA_UNUSED_VAR(unused);
+}
+
+/*!
+        \brief explicit fused forall given a tuple of segments and a tuple of
+   loop bodies, runs each loop in its own range of blocks of one kernel
+*/
+template <size_t BlockSize,
+          bool Async,
+          typename Segments,
+          typename Bodies,
+          camp::idx_t... Is>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+forall_fused(
+    resources::Hip hip_res,
+    hip_exec<BlockSize, Async>,
+    Segments& segs,
+    Bodies& bodies,
+    camp::idx_seq<Is...>)
+{
+  using Loops = camp::tuple<
+      hip_fused_loop_t<camp::tuple_element_t<Is, Segments>,
+                       camp::tuple_element_t<Is, Bodies>>...>;
+
+  constexpr size_t num_loops = sizeof...(Is);
+
+  auto func = forall_fused_hip_kernel<BlockSize, Loops, Is...>;
+
+  //
+  // Compute the number of blocks of each loop
+  //
+  using std::begin;
+  using std::end;
+  using std::distance;
+  const hip_dim_member_t lens[num_loops] = {
+      static_cast<hip_dim_member_t>(distance(begin(camp::get<Is>(segs)),
+                                             end(camp::get<Is>(segs))))...};
+
+  HipFusedBlocks<num_loops> blocks;
+  blocks.begin[0] = 0;
+  for (size_t i = 0; i < num_loops; ++i) {
+    blocks.begin[i + 1] = blocks.begin[i] + (lens[i] + BlockSize - 1) / BlockSize;
+  }
+
+  // Only launch kernel if we have something to iterate over
+  if (blocks.begin[num_loops] > 0 && BlockSize > 0) {
+
+    hip_dim_t blockSize{BlockSize, 1, 1};
+    hip_dim_t gridSize{blocks.begin[num_loops], 1, 1};
+
+    RAJA_FT_BEGIN;
+
+    //
+    // Setup shared memory buffers
+    //
+    size_t shmem = 0;
+
+    {
+      //
+      // Privatize the loops, using make_launch_body to setup reductions
+      //
+      Loops loops = RAJA::hip::make_launch_body(
+          gridSize, blockSize, shmem, hip_res,
+          camp::make_tuple(
+              camp::tuple_element_t<Is, Loops>{
+                  begin(camp::get<Is>(segs)),
+                  distance(begin(camp::get<Is>(segs)), end(camp::get<Is>(segs))),
+                  camp::get<Is>(bodies)}...));
+
+      //
+      // Launch the kernel
+      //
+      void *args[] = {(void*)&loops, (void*)&blocks};
+      RAJA::hip::launch((const void*)func, gridSize, blockSize, args, shmem, hip_res, Async);
+    }
+
+    RAJA_FT_END;
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+}  // namespace fused
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_HIP guard
+
+#endif  // closing endif for header file include guard
@@ -20,14 +20,17 @@
 #ifndef RAJA_policy_hip_kernel_HPP
 #define RAJA_policy_hip_kernel_HPP
 
+#include "RAJA/policy/hip/kernel/Collapse.hpp"
 #include "RAJA/policy/hip/kernel/Conditional.hpp"
 #include "RAJA/policy/hip/kernel/For.hpp"
 #include "RAJA/policy/hip/kernel/ForICount.hpp"
+#include "RAJA/policy/hip/kernel/ForUnroll.hpp"
 #include "RAJA/policy/hip/kernel/HipKernel.hpp"
 #include "RAJA/policy/hip/kernel/Hyperplane.hpp"
 #include "RAJA/policy/hip/kernel/InitLocalMem.hpp"
 #include "RAJA/policy/hip/kernel/Lambda.hpp"
 #include "RAJA/policy/hip/kernel/Reduce.hpp"
+#include "RAJA/policy/hip/kernel/Sequence.hpp"
 #include "RAJA/policy/hip/kernel/Sync.hpp"
 #include "RAJA/policy/hip/kernel/Tile.hpp"
 #include "RAJA/policy/hip/kernel/TileTCount.hpp"
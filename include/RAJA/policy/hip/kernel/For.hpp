@@ -140,7 +140,7 @@ struct HipStatementExecutor<
     LaunchDims dims = enclosed_stmts_t::calculateDimensions(data);
 
     // we always get EXACTLY one warp by allocating one warp in the X dimension
-    diff_t len = RAJA::policy::hip::WARP_SIZE;
+    diff_t len = RAJA::hip::device_warp_size();
 
     // request one thread per element in the segment
     set_hip_dim<0>(dims.threads, len);
@@ -284,7 +284,7 @@ struct HipStatementExecutor<
     LaunchDims dims = enclosed_stmts_t::calculateDimensions(data);
 
     // we always get EXACTLY one warp by allocating one warp in the X dimension
-    diff_t len = RAJA::policy::hip::WARP_SIZE;
+    diff_t len = RAJA::hip::device_warp_size();
 
     // request one thread per element in the segment
     set_hip_dim<0>(dims.threads, len);
@@ -354,7 +354,7 @@ struct HipStatementExecutor<
 
     // we always get EXACTLY one warp by allocating one warp in the X
     // dimension
-    diff_t len = RAJA::policy::hip::WARP_SIZE;
+    diff_t len = RAJA::hip::device_warp_size();
 
     // request one thread per element in the segment
     set_hip_dim<0>(dims.threads, len);
@@ -435,7 +435,7 @@ struct HipStatementExecutor<
 
     // we always get EXACTLY one warp by allocating one warp in the X
     // dimension
-    diff_t len = RAJA::policy::hip::WARP_SIZE;
+    diff_t len = RAJA::hip::device_warp_size();
 
     // request one thread per element in the segment
     set_hip_dim<0>(dims.threads, len);
@@ -24,8 +24,10 @@
 
 #if defined(RAJA_ENABLE_HIP)
 
+#include <atomic>
 #include <cassert>
 #include <climits>
+#include <utility>
 
 #include "camp/camp.hpp"
 
@@ -183,200 +185,19 @@ struct LaunchDims {
 };
 
 
-struct HipFixedMaxBlocksData
-{
-  int multiProcessorCount;
-  int maxThreadsPerMultiProcessor;
-};
-
 RAJA_INLINE
 int hip_max_blocks(int block_size)
 {
-  static HipFixedMaxBlocksData data = {-1, -1};
-
-  if (data.multiProcessorCount < 0) {
-    hipDeviceProp_t& prop = hip::device_prop();
-    data.multiProcessorCount = prop.multiProcessorCount;
-    data.maxThreadsPerMultiProcessor = prop.maxThreadsPerMultiProcessor;
-  }
+  hipDeviceProp_t& prop = hip::device_prop();
 
-  int max_blocks = data.multiProcessorCount *
-                  (data.maxThreadsPerMultiProcessor / block_size);
+  int max_blocks = prop.multiProcessorCount *
+                  (prop.maxThreadsPerMultiProcessor / block_size);
 
   // printf("MAX_BLOCKS=%d\n", max_blocks);
 
   return max_blocks;
 }
 
-struct HipOccMaxBlocksThreadsData
-{
-  int prev_shmem_size;
-  int max_blocks;
-  int max_threads;
-};
-
-template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
-RAJA_INLINE
-void hip_occupancy_max_blocks_threads(Func&& func, int shmem_size,
-                                       int &max_blocks, int &max_threads)
-{
-  static HipOccMaxBlocksThreadsData data = {-1, -1, -1};
-
-  if (data.prev_shmem_size != shmem_size) {
-
-#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
-    hipErrchk(hipOccupancyMaxPotentialBlockSize(
-        &data.max_blocks, &data.max_threads, func, shmem_size));
-#else
-    RAJA_UNUSED_VAR(func);
-    data.max_blocks = 64;
-    data.max_threads = 1024;
-#endif
-
-    data.prev_shmem_size = shmem_size;
-
-  }
-
-  max_blocks  = data.max_blocks;
-  max_threads = data.max_threads;
-
-}
-
-struct HipOccMaxBlocksFixedThreadsData
-{
-  int prev_shmem_size;
-  int max_blocks;
-  int multiProcessorCount;
-};
-
-template < typename RAJA_UNUSED_ARG(UniqueMarker), int num_threads, typename Func >
-RAJA_INLINE
-void hip_occupancy_max_blocks(Func&& func, int shmem_size,
-                               int &max_blocks)
-{
-  static HipOccMaxBlocksFixedThreadsData data = {-1, -1, -1};
-
-  if (data.prev_shmem_size != shmem_size) {
-
-#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
-    hipErrchk(hipOccupancyMaxActiveBlocksPerMultiprocessor(
-        &data.max_blocks, func, num_threads, shmem_size));
-#else
-    RAJA_UNUSED_VAR(func);
-    data.max_blocks = 2;
-#endif
-
-    if (data.multiProcessorCount < 0) {
-
-      data.multiProcessorCount = hip::device_prop().multiProcessorCount;
-
-    }
-
-    data.max_blocks *= data.multiProcessorCount;
-
-    data.prev_shmem_size = shmem_size;
-
-  }
-
-  max_blocks = data.max_blocks;
-
-}
-
-struct HipOccMaxBlocksVariableThreadsData
-{
-  int prev_shmem_size;
-  int prev_num_threads;
-  int max_blocks;
-  int multiProcessorCount;
-};
-
-template < typename RAJA_UNUSED_ARG(UniqueMarker), typename Func >
-RAJA_INLINE
-void hip_occupancy_max_blocks(Func&& func, int shmem_size,
-                               int &max_blocks, int num_threads)
-{
-  static HipOccMaxBlocksVariableThreadsData data = {-1, -1, -1, -1};
-
-  if ( data.prev_shmem_size  != shmem_size ||
-       data.prev_num_threads != num_threads ) {
-
-#ifdef RAJA_ENABLE_HIP_OCCUPANCY_CALCULATOR
-    hipErrchk(hipOccupancyMaxActiveBlocksPerMultiprocessor(
-        &data.max_blocks, func, num_threads, shmem_size));
-#else
-    RAJA_UNUSED_VAR(func);
-    data.max_blocks = 2;
-#endif
-
-    if (data.multiProcessorCount < 0) {
-
-      data.multiProcessorCount = hip::device_prop().multiProcessorCount;
-
-    }
-
-    data.max_blocks *= data.multiProcessorCount;
-
-    data.prev_shmem_size  = shmem_size;
-    data.prev_num_threads = num_threads;
-
-  }
-
-  max_blocks = data.max_blocks;
-
-}
-
-
-
-template <camp::idx_t cur_stmt, camp::idx_t num_stmts, typename StmtList>
-struct HipStatementListExecutorHelper {
-
-  using next_helper_t =
-      HipStatementListExecutorHelper<cur_stmt + 1, num_stmts, StmtList>;
-
-  using cur_stmt_t = camp::at_v<StmtList, cur_stmt>;
-
-  template <typename Data>
-  inline static RAJA_DEVICE void exec(Data &data, bool thread_active)
-  {
-    // Execute stmt
-    cur_stmt_t::exec(data, thread_active);
-
-    // Execute next stmt
-    next_helper_t::exec(data, thread_active);
-  }
-
-
-  template <typename Data>
-  inline static LaunchDims calculateDimensions(Data &data)
-  {
-    // Compute this statements launch dimensions
-    LaunchDims statement_dims = cur_stmt_t::calculateDimensions(data);
-
-    // call the next statement in the list
-    LaunchDims next_dims = next_helper_t::calculateDimensions(data);
-
-    // Return the maximum of the two
-    return statement_dims.max(next_dims);
-  }
-};
-
-template <camp::idx_t num_stmts, typename StmtList>
-struct HipStatementListExecutorHelper<num_stmts, num_stmts, StmtList> {
-
-  template <typename Data>
-  inline static RAJA_DEVICE void exec(Data &, bool)
-  {
-    // nop terminator
-  }
-
-  template <typename Data>
-  inline static LaunchDims calculateDimensions(Data &)
-  {
-    return LaunchDims();
-  }
-};
-
-
 template <typename Data, typename Policy, typename Types>
 struct HipStatementExecutor;
 
@@ -397,8 +218,11 @@ struct HipStatementListExecutor<Data, StatementList<Stmts...>, Types> {
   RAJA_DEVICE
   void exec(Data &data, bool thread_active)
   {
-    // Execute statements in order with helper class
-    HipStatementListExecutorHelper<0, num_stmts, enclosed_stmts_t>::exec(data, thread_active);
+    // Execute statements in order, braced initializers are evaluated in
+    // order
+    int seq[] = {0, (HipStatementExecutor<Data, Stmts, Types>::exec(
+                         data, thread_active), 0)...};
+    RAJA_UNUSED_VAR(seq);
   }
 
 
@@ -407,9 +231,13 @@ struct HipStatementListExecutor<Data, StatementList<Stmts...>, Types> {
   inline
   LaunchDims calculateDimensions(Data const &data)
   {
-    // Compute this statements launch dimensions
-    return HipStatementListExecutorHelper<0, num_stmts, enclosed_stmts_t>::
-        calculateDimensions(data);
+    // The maximum of the launch dimensions of the statements
+    LaunchDims dims;
+    int seq[] = {0, (dims = dims.max(
+                         HipStatementExecutor<Data, Stmts, Types>::
+                             calculateDimensions(data)), 0)...};
+    RAJA_UNUSED_VAR(seq);
+    return dims;
   }
 };
 
@@ -44,6 +44,26 @@ __global__ void launch_global_fcn(BODY body_in)
   body(ctx);
 }
 
+//! launch kernel with forall params, each team combines the reducer values
+//  of its threads in shared memory and then the teams combine them once
+template <typename EXEC_POL, typename BODY, typename ReduceParams>
+__global__ void launch_global_fcn_params(BODY body_in, ReduceParams reduce_params)
+{
+  LaunchContext ctx;
+
+  using RAJA::internal::thread_privatize;
+  auto privatizer = thread_privatize(body_in);
+  auto& body = privatizer.get_priv();
+
+  //Set pointer to shared memory
+  extern __shared__ char raja_shmem_ptr[];
+  ctx.shared_mem_ptr = raja_shmem_ptr;
+
+  RAJA::expt::invoke_body(reduce_params, body, ctx);
+
+  RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(reduce_params);
+}
+
 template <bool async>
 struct LaunchExecute<RAJA::hip_launch_t<async, 0>> {
 
@@ -96,6 +116,186 @@ struct LaunchExecute<RAJA::hip_launch_t<async, 0>> {
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY_IN, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in, ReduceParams &launch_reducers)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    using EXEC_POL = RAJA::hip_launch_t<async, 0>;
+
+    auto func = launch_global_fcn_params<EXEC_POL, BODY, camp::decay<ReduceParams>>;
+
+    resources::Hip hip_res = res.get<RAJA::resources::Hip>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    hip_dim_t gridSize{ static_cast<hip_dim_member_t>(params.teams.value[0]),
+                        static_cast<hip_dim_member_t>(params.teams.value[1]),
+                        static_cast<hip_dim_member_t>(params.teams.value[2]) };
+
+    hip_dim_t blockSize{ static_cast<hip_dim_member_t>(params.threads.value[0]),
+                         static_cast<hip_dim_member_t>(params.threads.value[1]),
+                         static_cast<hip_dim_member_t>(params.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr hip_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      RAJA::hip::detail::hipInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = hip_res;
+
+      {
+        RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers, launch_info);
+
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::hip::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, hip_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel
+        //
+        void *args[] = {(void*)&body, (void*)&launch_reducers};
+        RAJA::hip::launch((const void*)func, gridSize, blockSize, args, params.shared_mem_size, hip_res, async, kernel_name);
+
+        RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers, launch_info);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+template <bool async>
+struct LaunchExecute<RAJA::policy::hip::hip_launch_cooperative_t<async>> {
+
+  template <typename BODY_IN>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    auto func = launch_global_fcn<BODY>;
+
+    resources::Hip hip_res = res.get<RAJA::resources::Hip>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    hip_dim_t gridSize{ static_cast<hip_dim_member_t>(params.teams.value[0]),
+                        static_cast<hip_dim_member_t>(params.teams.value[1]),
+                        static_cast<hip_dim_member_t>(params.teams.value[2]) };
+
+    hip_dim_t blockSize{ static_cast<hip_dim_member_t>(params.threads.value[0]),
+                         static_cast<hip_dim_member_t>(params.threads.value[1]),
+                         static_cast<hip_dim_member_t>(params.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr hip_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      {
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::hip::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, hip_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel cooperatively, fails if the grid is larger
+        // than the number of blocks that can be resident at once
+        //
+        void *args[] = {(void*)&body};
+        RAJA::hip::launch_cooperative((const void*)func, gridSize, blockSize, args, params.shared_mem_size, hip_res, async, kernel_name);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template <typename BODY_IN, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in, ReduceParams &launch_reducers)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    using EXEC_POL = RAJA::policy::hip::hip_launch_cooperative_t<async>;
+
+    auto func = launch_global_fcn_params<EXEC_POL, BODY, camp::decay<ReduceParams>>;
+
+    resources::Hip hip_res = res.get<RAJA::resources::Hip>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    hip_dim_t gridSize{ static_cast<hip_dim_member_t>(params.teams.value[0]),
+                        static_cast<hip_dim_member_t>(params.teams.value[1]),
+                        static_cast<hip_dim_member_t>(params.teams.value[2]) };
+
+    hip_dim_t blockSize{ static_cast<hip_dim_member_t>(params.threads.value[0]),
+                         static_cast<hip_dim_member_t>(params.threads.value[1]),
+                         static_cast<hip_dim_member_t>(params.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr hip_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      RAJA::hip::detail::hipInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = hip_res;
+
+      {
+        RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers, launch_info);
+
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::hip::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, hip_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel cooperatively, fails if the grid is larger
+        // than the number of blocks that can be resident at once
+        //
+        void *args[] = {(void*)&body, (void*)&launch_reducers};
+        RAJA::hip::launch_cooperative((const void*)func, gridSize, blockSize, args, params.shared_mem_size, hip_res, async, kernel_name);
+
+        RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers, launch_info);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
 };
 
 template <typename BODY, int num_threads>
@@ -167,6 +367,68 @@ struct LaunchExecute<RAJA::hip_launch_t<async, nthreads>> {
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY_IN, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, const LaunchParams &params, const char *kernel_name, BODY_IN &&body_in, ReduceParams &launch_reducers)
+  {
+    using BODY = camp::decay<BODY_IN>;
+
+    using EXEC_POL = RAJA::hip_launch_t<async, nthreads>;
+
+    auto func = launch_global_fcn_params<EXEC_POL, BODY, camp::decay<ReduceParams>>;
+
+    resources::Hip hip_res = res.get<RAJA::resources::Hip>();
+
+    //
+    // Compute the number of blocks and threads
+    //
+
+    hip_dim_t gridSize{ static_cast<hip_dim_member_t>(params.teams.value[0]),
+                        static_cast<hip_dim_member_t>(params.teams.value[1]),
+                        static_cast<hip_dim_member_t>(params.teams.value[2]) };
+
+    hip_dim_t blockSize{ static_cast<hip_dim_member_t>(params.threads.value[0]),
+                         static_cast<hip_dim_member_t>(params.threads.value[1]),
+                         static_cast<hip_dim_member_t>(params.threads.value[2]) };
+
+    // Only launch kernel if we have something to iterate over
+    constexpr hip_dim_member_t zero = 0;
+    if ( gridSize.x  > zero && gridSize.y  > zero && gridSize.z  > zero &&
+         blockSize.x > zero && blockSize.y > zero && blockSize.z > zero ) {
+
+      RAJA_FT_BEGIN;
+
+      RAJA::hip::detail::hipInfo launch_info;
+      launch_info.gridDim = gridSize;
+      launch_info.blockDim = blockSize;
+      launch_info.res = hip_res;
+
+      {
+        RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers, launch_info);
+
+        //
+        // Privatize the loop_body, using make_launch_body to setup reductions
+        //
+        BODY body = RAJA::hip::make_launch_body(
+            gridSize, blockSize, params.shared_mem_size, hip_res, std::forward<BODY_IN>(body_in));
+
+        //
+        // Launch the kernel
+        //
+        void *args[] = {(void*)&body, (void*)&launch_reducers};
+        RAJA::hip::launch((const void*)func, gridSize, blockSize, args, params.shared_mem_size, hip_res, async, kernel_name);
+
+        RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers, launch_info);
+      }
+
+      RAJA_FT_END;
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
 };
 
 /*
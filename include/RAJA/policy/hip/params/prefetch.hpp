@@ -0,0 +1,46 @@
+#ifndef HIP_PREFETCH_PARAM_HPP
+#define HIP_PREFETCH_PARAM_HPP
+
+#if defined(RAJA_HIP_ACTIVE)
+
+#include <hip.h>
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/prefetch.hpp"
+#include "RAJA/pattern/params/prefetch.hpp"
+
+namespace RAJA {
+namespace expt {
+namespace detail {
+
+  template<camp::idx_t... Seq, typename... Views>
+  void prefetch_views(camp::idx_seq<Seq...>, Prefetch<Views...>& pf, resources::Hip res)
+  {
+    CAMP_EXPAND(RAJA::prefetch(camp::get<Seq>(pf.views), res));
+  }
+
+  // Init
+  template<typename EXEC_POL, typename... Views>
+  camp::concepts::enable_if< type_traits::is_hip_policy<EXEC_POL> >
+  init(Prefetch<Views...>& pf, const RAJA::hip::detail::hipInfo & cs)
+  {
+    prefetch_views(camp::make_idx_seq_t<sizeof...(Views)>{}, pf, cs.res);
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename... Views, typename... Args>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< type_traits::is_hip_policy<EXEC_POL> >
+  combine(Prefetch<Views...>&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Views>
+  camp::concepts::enable_if< type_traits::is_hip_policy<EXEC_POL> >
+  resolve(Prefetch<Views...>&, const RAJA::hip::detail::hipInfo &) {}
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif
+
+#endif //  HIP_PREFETCH_PARAM_HPP
@@ -78,6 +78,17 @@ struct hip_exec : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::hip> {
 };
 
+/// forall execution policy that sizes the grid with the HIP occupancy
+/// calculator, capping the number of blocks at the number that can be
+/// resident on the device, and iterates with a grid-stride loop
+template <size_t BLOCK_SIZE, bool Async = false>
+struct hip_exec_occ : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::hip,
+                       RAJA::Pattern::forall,
+                       detail::get_launch<Async>::value,
+                       RAJA::Platform::hip> {
+};
+
 template <bool Async, int num_threads = 0>
 struct hip_launch_t : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Policy::hip,
@@ -86,10 +97,45 @@ struct hip_launch_t : public RAJA::make_policy_pattern_launch_platform_t<
                        RAJA::Platform::hip> {
 };
 
+///
+/// Launch policy for RAJA::launch kernels that synchronize the whole grid
+/// with LaunchContext::grid_sync, the kernel is launched with
+/// hipLaunchCooperativeKernel so all blocks must be resident at once
+///
+template <bool Async>
+struct hip_launch_cooperative_t : public RAJA::make_policy_pattern_launch_platform_t<
+                                  RAJA::Policy::hip,
+                                  RAJA::Pattern::region,
+                                  detail::get_launch<Async>::value,
+                                  RAJA::Platform::hip> {
+};
+
+///
+/// Hyperplane policy for RAJA::kernel that runs all the hyperplanes of a
+/// statement::Hyperplane in one persistent kernel of BLOCK_SIZE threads per
+/// block, the blocks wait on a completion count between hyperplanes. The
+/// kernel is launched with hipLaunchCooperativeKernel so all blocks are resident
+///
+template <size_t BLOCK_SIZE>
+struct hip_wavefront_exec : public RAJA::make_policy_pattern_launch_platform_t<
+                           RAJA::Policy::hip,
+                           RAJA::Pattern::forall,
+                           RAJA::Launch::sync,
+                           RAJA::Platform::hip> {
+};
 
-//
-// NOTE: There is no Index set segment iteration policy for HIP
-//
+
+///
+/// Index set segment iteration policy that runs all the segments in one
+/// kernel, as in ExecPolicy<hip_segit_fused, hip_exec<256>>, instead of
+/// launching a kernel per segment like seq_segit
+///
+struct hip_segit_fused : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::hip,
+                       RAJA::Pattern::forall,
+                       RAJA::Launch::undefined,
+                       RAJA::Platform::hip> {
+};
 
 ///
 /// WorkGroup execution policies
@@ -113,6 +159,16 @@ struct unordered_hip_loop_y_block_iter_x_threadblock_average
                        RAJA::Platform::hip> {
 };
 
+/// execute the enqueued loops in an unordered fashion by giving each loop a
+/// number of blocks in the x direction proportional to its iteration count
+/// and mapping loop iterations to threads in the x direction
+struct unordered_hip_loop_x_block_balanced
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::hip,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::hip> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -189,8 +245,18 @@ struct hip_thread_masked_loop {};
 // Operations in the included files are parametrized using the following
 // values for HIP warp size and max block size.
 //
+// On AMD GPUs the device compilation pass of each --offload-arch uses the
+// wavefront size of that architecture, 32 on RDNA and 64 on CDNA, so the
+// shuffle trees of a fat binary match each device. The host pass uses the
+// largest wavefront size; host code that depends on the wavefront size of
+// the device, such as launch dimensions, uses hip::device_warp_size().
+//
 #if defined(__HIP_PLATFORM_HCC__)
+#if defined(__AMDGCN_WAVEFRONT_SIZE)
+constexpr const RAJA::Index_type WARP_SIZE = __AMDGCN_WAVEFRONT_SIZE;
+#else
 constexpr const RAJA::Index_type WARP_SIZE = 64;
+#endif
 #elif defined(__HIP_PLATFORM_NVCC__)
 constexpr const RAJA::Index_type WARP_SIZE = 32;
 #endif
@@ -221,14 +287,79 @@ struct hip_atomic_explicit{};
  */
 using hip_atomic = hip_atomic_explicit<loop_atomic>;
 
+/*!
+ * Hip atomic policy for using hip atomics with the given RAJA::atomic_scope
+ * on the device and the provided host_policy on the host
+ */
+template<typename scope, typename host_policy>
+struct hip_atomic_scoped_explicit{};
+
+template<typename host_policy>
+using hip_atomic_block_explicit =
+    hip_atomic_scoped_explicit<atomic_scope::block, host_policy>;
+
+template<typename host_policy>
+using hip_atomic_device_explicit =
+    hip_atomic_scoped_explicit<atomic_scope::device, host_policy>;
+
+template<typename host_policy>
+using hip_atomic_system_explicit =
+    hip_atomic_scoped_explicit<atomic_scope::system, host_policy>;
+
+/*!
+ * Default scoped hip atomic policies use non-atomics on the host
+ */
+using hip_atomic_block = hip_atomic_block_explicit<loop_atomic>;
+using hip_atomic_device = hip_atomic_device_explicit<loop_atomic>;
+using hip_atomic_system = hip_atomic_system_explicit<loop_atomic>;
+
+/*!
+ * Hip atomic policy that combines the atomics of the threads in a wavefront
+ * that target the same address so one thread per address performs the atomic
+ * on the device, and uses the provided host_policy on the host
+ */
+template<typename host_policy>
+struct hip_atomic_aggregated_explicit{};
+
+/*!
+ * Default hip aggregated atomic policy uses non-atomics on the host
+ */
+using hip_atomic_aggregated = hip_atomic_aggregated_explicit<loop_atomic>;
+
+/*!
+ * Hip atomic policy that uses the unsafe hardware floating point atomics for
+ * float and double atomicAdd and atomicSub on the device, which only work on
+ * coarse-grained memory, and uses the provided host_policy on the host
+ */
+template<typename host_policy>
+struct hip_atomic_unsafe_fp_explicit{};
+
+/*!
+ * Default hip unsafe floating point atomic policy uses non-atomics on the host
+ */
+using hip_atomic_unsafe_fp = hip_atomic_unsafe_fp_explicit<loop_atomic>;
+
 }  // end namespace hip
 }  // end namespace policy
 
+namespace type_traits
+{
+template <>
+struct is_fused_segit_policy<policy::hip::hip_segit_fused> : std::true_type {
+};
+}  // end namespace type_traits
+
 using policy::hip::hip_exec;
+using policy::hip::hip_segit_fused;
 
 template <size_t BLOCK_SIZE>
 using hip_exec_async = policy::hip::hip_exec<BLOCK_SIZE, true>;
 
+using policy::hip::hip_exec_occ;
+
+template <size_t BLOCK_SIZE>
+using hip_exec_occ_async = policy::hip::hip_exec_occ<BLOCK_SIZE, true>;
+
 using policy::hip::hip_work;
 
 template <size_t BLOCK_SIZE>
@@ -236,8 +367,20 @@ using hip_work_async = policy::hip::hip_work<BLOCK_SIZE, true>;
 
 using policy::hip::hip_atomic;
 using policy::hip::hip_atomic_explicit;
+using policy::hip::hip_atomic_aggregated;
+using policy::hip::hip_atomic_aggregated_explicit;
+using policy::hip::hip_atomic_unsafe_fp;
+using policy::hip::hip_atomic_unsafe_fp_explicit;
+using policy::hip::hip_atomic_scoped_explicit;
+using policy::hip::hip_atomic_block_explicit;
+using policy::hip::hip_atomic_device_explicit;
+using policy::hip::hip_atomic_system_explicit;
+using policy::hip::hip_atomic_block;
+using policy::hip::hip_atomic_device;
+using policy::hip::hip_atomic_system;
 
 using policy::hip::unordered_hip_loop_y_block_iter_x_threadblock_average;
+using policy::hip::unordered_hip_loop_x_block_balanced;
 
 using policy::hip::hip_reduce_base;
 using policy::hip::hip_reduce;
@@ -258,6 +401,8 @@ using policy::hip::hip_thread_masked_loop;
 using policy::hip::hip_synchronize;
 
 using policy::hip::hip_launch_t;
+using policy::hip::hip_launch_cooperative_t;
+using policy::hip::hip_wavefront_exec;
 
 /*!
  * Maps segment indices to HIP threads.
@@ -311,6 +456,22 @@ using hip_block_y_loop = hip_block_xyz_loop<1>;
 using hip_block_z_loop = hip_block_xyz_loop<2>;
 
 
+/*!
+ * Collapse policy that linearizes the iteration space of the collapsed
+ * arguments and maps it onto every thread of the grid in one dimension,
+ * blockIdx.xyz*blockDim.xyz+threadIdx.xyz, with grid-stride looping.
+ * The last argument of the ArgList varies fastest. This keeps all threads
+ * busy for shapes like 5x7x1000 that map poorly onto separate thread and
+ * block dimensions.
+ */
+template<int dim>
+struct hip_flatten_global_xyz_loop{};
+
+using hip_flatten_global_x_loop = hip_flatten_global_xyz_loop<0>;
+using hip_flatten_global_y_loop = hip_flatten_global_xyz_loop<1>;
+using hip_flatten_global_z_loop = hip_flatten_global_xyz_loop<2>;
+
+
 
 
 namespace internal{
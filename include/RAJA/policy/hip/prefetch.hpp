@@ -0,0 +1,135 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the HIP prefetch and memory advice methods for
+ *          Views of managed memory.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_prefetch_HPP
+#define RAJA_policy_hip_prefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_HIP_ACTIVE)
+
+#include <hip/hip_runtime.h>
+
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#include "RAJA/util/Prefetch.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace hip
+{
+
+namespace detail
+{
+
+/*!
+ * \brief True if ptr is managed memory that can be prefetched to the
+ *        current device.
+ *
+ * Other memory is skipped by the prefetch methods, so they can be used with
+ * views of any memory.
+ */
+inline bool is_prefetchable(const void* ptr)
+{
+  hipPointerAttribute_t attributes;
+  if (hipPointerGetAttributes(&attributes, ptr) != hipSuccess) {
+    hipGetLastError(); // clear the error from non-hip memory
+    return false;
+  }
+  if (!attributes.isManaged) {
+    return false;
+  }
+  int device = -1;
+  hipErrchk(hipGetDevice(&device));
+  int concurrent_managed_access = 0;
+  hipErrchk(hipDeviceGetAttribute(&concurrent_managed_access,
+                                  hipDeviceAttributeConcurrentManagedAccess,
+                                  device));
+  return concurrent_managed_access != 0;
+}
+
+inline void advise(const void* ptr, size_t bytes, MemAdvice advice)
+{
+  int device = -1;
+  hipErrchk(hipGetDevice(&device));
+  switch (advice) {
+    case MemAdvice::ReadMostly:
+      hipErrchk(hipMemAdvise(ptr, bytes, hipMemAdviseSetReadMostly, device));
+      break;
+    case MemAdvice::PreferredLocation:
+      hipErrchk(hipMemAdvise(ptr, bytes, hipMemAdviseSetPreferredLocation, device));
+      break;
+    case MemAdvice::AccessedBy:
+      hipErrchk(hipMemAdvise(ptr, bytes, hipMemAdviseSetAccessedBy, device));
+      break;
+    case MemAdvice::None:
+      break;
+  }
+}
+
+inline void prefetch(const void* ptr, size_t bytes, resources::Hip res)
+{
+  int device = -1;
+  hipErrchk(hipGetDevice(&device));
+  hipErrchk(hipMemPrefetchAsync(ptr, bytes, device, res.get_stream()));
+}
+
+}  // namespace detail
+
+}  // namespace hip
+
+/*!
+ * \brief Give the advice of a ManagedView for its memory, relative to the
+ *        current device.  Does nothing for memory that is not managed.
+ */
+template <typename ViewType>
+RAJA_INLINE void advise(ManagedView<ViewType> const& view, resources::Hip)
+{
+  const void* ptr = detail::view_data(view);
+  const size_t bytes = detail::view_bytes(view);
+  if (bytes > 0 && hip::detail::is_prefetchable(ptr)) {
+    hip::detail::advise(ptr, bytes, view.advice);
+  }
+}
+
+/*!
+ * \brief Prefetch the memory of a view to the current device on the stream
+ *        of res, after giving the advice of a ManagedView.  Does nothing
+ *        for memory that is not managed.
+ *
+ *     RAJA::resources::Hip res;
+ *     RAJA::prefetch(v, res);
+ *     RAJA::forall<RAJA::hip_exec_async<256>>(res, range, body);
+ */
+template <typename ViewType>
+RAJA_INLINE void prefetch(ViewType const& view, resources::Hip res)
+{
+  const void* ptr = detail::view_data(view);
+  const size_t bytes = detail::view_bytes(view);
+  if (bytes > 0 && hip::detail::is_prefetchable(ptr)) {
+    hip::detail::advise(ptr, bytes, detail::get_mem_advice(view));
+    hip::detail::prefetch(ptr, bytes, res);
+  }
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_HIP_ACTIVE)
+
+#endif  // closing endif for header file include guard
@@ -33,6 +33,7 @@
 #include "RAJA/util/SoAArray.hpp"
 #include "RAJA/util/SoAPtr.hpp"
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/metrics.hpp"
 #include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -524,6 +525,185 @@ RAJA_DEVICE RAJA_INLINE bool grid_reduce(RAJA::expt::detail::Reducer<OP, T>& red
   return lastBlock && threadId == 0;
 }
 
+//! reduce values in block then atomically combine the block value into the
+//  reducer target, returns true if this thread combined into the target
+template <typename OP, typename T>
+RAJA_DEVICE RAJA_INLINE bool block_atomic_reduce(RAJA::expt::detail::Reducer<OP, T>& red) {
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  T temp = block_reduce<OP>(red.val, OP::identity());
+
+  // one thread per block combines into target
+  if (threadId == 0) {
+    RAJA::expt::detail::atomic_combine<OP>::apply(RAJA::hip_atomic{}, red.target, temp);
+  }
+
+  return threadId == 0;
+}
+
+
+//
+// Fused reduction of several Reducer params. The values of all the
+// reducers go through the block together, so the block writes shared
+// memory and synchronizes once for the pack, and one counter finds the
+// last block for the pack.
+//
+
+//! reduce val over the lanes of each warp into the first lane
+template <typename OP, typename T>
+RAJA_DEVICE RAJA_INLINE T fused_warp_reduce(T val, int threadId, int numThreads)
+{
+  T temp = val;
+
+  if (numThreads % RAJA::policy::hip::WARP_SIZE == 0) {
+
+    for (int i = 1; i < RAJA::policy::hip::WARP_SIZE; i *= 2) {
+      T rhs = RAJA::hip::impl::shfl_xor_sync(temp, i);
+      temp = OP{}(temp, rhs);
+    }
+
+  } else {
+
+    for (int i = 1; i < RAJA::policy::hip::WARP_SIZE; i *= 2) {
+      int srcLane = threadId ^ i;
+      T rhs = RAJA::hip::impl::shfl_sync(temp, srcLane);
+      // only add from threads that exist (don't double count own value)
+      if (srcLane < numThreads) {
+        temp = OP{}(temp, rhs);
+      }
+    }
+  }
+
+  return temp;
+}
+
+//! reduce the per warp values held by the lanes of the first warp
+template <typename OP, typename T>
+RAJA_DEVICE RAJA_INLINE T fused_warps_reduce(T val)
+{
+  for (int i = 1; i < RAJA::policy::hip::MAX_WARPS; i *= 2) {
+    T rhs = RAJA::hip::impl::shfl_xor_sync(val, i);
+    val = OP{}(val, rhs);
+  }
+  return val;
+}
+
+//! reduce each of vals in block into thread 0 with the matching OP
+template <typename... OPs, typename... Ts, camp::idx_t... Seq>
+RAJA_DEVICE RAJA_INLINE void block_reduce_fused(camp::list<OPs...>,
+                                                camp::idx_seq<Seq...>,
+                                                camp::tuple<Ts...>& vals)
+{
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  int warpId = threadId % RAJA::policy::hip::WARP_SIZE;
+  int warpNum = threadId / RAJA::policy::hip::WARP_SIZE;
+
+  // reduce each warp
+  CAMP_EXPAND(camp::get<Seq>(vals) =
+      fused_warp_reduce<OPs>(camp::get<Seq>(vals), threadId, numThreads));
+
+  static_assert(RAJA::policy::hip::MAX_WARPS <= RAJA::policy::hip::WARP_SIZE,
+               "Max Warps must be less than or equal to Warp Size for this algorithm to work");
+
+  // reduce per warp values
+  if (numThreads > RAJA::policy::hip::WARP_SIZE) {
+
+    using shared_type =
+        camp::tuple<RAJA::detail::SoAArray<Ts, RAJA::policy::hip::MAX_WARPS>...>;
+
+    // Need to separate declaration and initialization for clang-hip
+    __shared__ unsigned char tmpsd[sizeof(shared_type)];
+
+    // Partial placement new: Should call new(tmpsd) here but recasting memory
+    // to avoid calling constructor/destructor in shared memory.
+    shared_type * sd = reinterpret_cast<shared_type *>(tmpsd);
+
+    // write per warp values of every reducer to shared memory
+    if (warpId == 0) {
+      CAMP_EXPAND(camp::get<Seq>(*sd).set(warpNum, camp::get<Seq>(vals)));
+    }
+
+    __syncthreads();
+
+    if (warpNum == 0) {
+
+      // read per warp values
+      const bool valid = warpId * RAJA::policy::hip::WARP_SIZE < numThreads;
+
+      CAMP_EXPAND(camp::get<Seq>(vals) = fused_warps_reduce<OPs>(
+          valid ? camp::get<Seq>(*sd).get(warpId) : OPs::identity()));
+    }
+
+    __syncthreads();
+  }
+}
+
+//! counter used to find the last block of a fused reduction
+template <typename Red0, typename... Reds>
+RAJA_DEVICE RAJA_INLINE unsigned int* fused_device_count(Red0& red0, Reds&...)
+{
+  return red0.device_count;
+}
+
+//! reduce the values of several reducers in grid into their device targets
+template <typename... Reds, camp::idx_t... Seq>
+RAJA_DEVICE RAJA_INLINE void grid_reduce_fused(camp::idx_seq<Seq...> seq,
+                                               Reds&... reds)
+{
+  using ops = camp::list<typename Reds::op...>;
+
+  int numBlocks = gridDim.x * gridDim.y * gridDim.z;
+  int numThreads = blockDim.x * blockDim.y * blockDim.z;
+  unsigned int wrap_around = numBlocks - 1;
+
+  int blockId = blockIdx.x + gridDim.x * blockIdx.y +
+                (gridDim.x * gridDim.y) * blockIdx.z;
+
+  int threadId = threadIdx.x + blockDim.x * threadIdx.y +
+                 (blockDim.x * blockDim.y) * threadIdx.z;
+
+  camp::tuple<typename Reds::value_type...> temps(reds.val...);
+
+  block_reduce_fused(ops{}, seq, temps);
+
+  // one thread per block writes to device_mem
+  bool lastBlock = false;
+  if (threadId == 0) {
+    CAMP_EXPAND(reds.device_mem.set(blockId, camp::get<Seq>(temps)));
+    // ensure writes visible to all threadblocks
+    __threadfence();
+    // increment counter, (wraps back to zero if old count == wrap_around)
+    unsigned int old_count = ::atomicInc(fused_device_count(reds...), wrap_around);
+    lastBlock = (old_count == wrap_around);
+  }
+
+  // returns non-zero value if any thread passes in a non-zero value
+  lastBlock = __syncthreads_or(lastBlock);
+
+  // last block accumulates values from device_mem
+  if (lastBlock) {
+    CAMP_EXPAND(camp::get<Seq>(temps) = Reds::op::identity());
+
+    for (int i = threadId; i < numBlocks; i += numThreads) {
+      CAMP_EXPAND(camp::get<Seq>(temps) =
+          typename Reds::op{}(camp::get<Seq>(temps), reds.device_mem.get(i)));
+    }
+
+    block_reduce_fused(ops{}, seq, temps);
+
+    // one thread returns the values
+    if (threadId == 0) {
+      CAMP_EXPAND(*(reds.devicetarget) = camp::get<Seq>(temps));
+    }
+  }
+}
+
 } //  namespace expt
 
 
@@ -715,7 +895,9 @@ public:
       rn->node_list = nullptr;
       resource_list = rn;
     }
-    Node* n = hip::pinned_mempool_type::getInstance().template malloc<Node>(1);
+    RAJA_METRICS_ADD("pinned_tally.allocations", 1);
+    Node* n = hip::pinned_stream_cache_type::getInstance()
+                  .template malloc<Node>(res.get_stream(), 1);
     n->next = rn->node_list;
     rn->node_list = n;
     return &n->value;
@@ -738,7 +920,7 @@ public:
       while (rn->node_list) {
         Node* n = rn->node_list;
         rn->node_list = n->next;
-        hip::pinned_mempool_type::getInstance().free(n);
+        hip::pinned_stream_cache_type::getInstance().free(n);
       }
       resource_list = rn->next;
       free(rn);
@@ -771,7 +953,7 @@ struct Reduce_Data {
   mutable T value;
   T identity;
   unsigned int* device_count;
-  RAJA::detail::SoAPtr<T, device_mempool_type> device;
+  RAJA::detail::SoAPtr<T, device_reducer_mempool_type> device;
   bool own_device_ptr;
 
   Reduce_Data() : Reduce_Data(T(), T()){};
@@ -826,7 +1008,7 @@ struct Reduce_Data {
       hip_dim_t gridDim = currentGridDim();
       size_t numBlocks = gridDim.x * gridDim.y * gridDim.z;
       device.allocate(numBlocks);
-      device_count = device_zeroed_mempool_type::getInstance()
+      device_count = device_zeroed_reducer_mempool_type::getInstance()
                          .template malloc<unsigned int>(1);
       own_device_ptr = true;
     }
@@ -840,7 +1022,7 @@ struct Reduce_Data {
     bool act = own_device_ptr;
     if (act) {
       device.deallocate();
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_zeroed_reducer_mempool_type::getInstance().free(device_count);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -904,8 +1086,9 @@ struct ReduceAtomic_Data {
   {
     bool act = !device && setupReducers();
     if (act) {
-      device = device_mempool_type::getInstance().template malloc<T>(1);
-      device_count = device_zeroed_mempool_type::getInstance()
+      device =
+          device_reducer_mempool_type::getInstance().template malloc<T>(1);
+      device_count = device_zeroed_reducer_mempool_type::getInstance()
                          .template malloc<unsigned int>(1);
       own_device_ptr = true;
     }
@@ -918,9 +1101,9 @@ struct ReduceAtomic_Data {
   {
     bool act = own_device_ptr;
     if (act) {
-      device_mempool_type::getInstance().free(device);
+      device_reducer_mempool_type::getInstance().free(device);
       device = nullptr;
-      device_zeroed_mempool_type::getInstance().free(device_count);
+      device_zeroed_reducer_mempool_type::getInstance().free(device_count);
       device_count = nullptr;
       own_device_ptr = false;
     }
@@ -942,8 +1125,11 @@ public:
         tally_or_val_ptr{new PinnedTally<T>},
         val(init_val, identity_)
   {
+    RAJA_METRICS_ADD("reduce.reducers", 1);
   }
 
+  //! reset the value, keeping the tally so later launches reuse the
+  //  cached buffers of earlier ones
   void reset(T in_val, T identity_ = Combiner::identity())
   {
     operator T();  // syncs device
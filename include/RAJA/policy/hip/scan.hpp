@@ -28,6 +28,7 @@
 #if defined(__HIPCC__)
 #define ROCPRIM_HIP_API 1
 #include "rocprim/device/device_scan.hpp"
+#include "rocprim/device/device_scan_by_key.hpp"
 #elif defined(__CUDACC__)
 #include "cub/device/device_scan.cuh"
 #include "cub/util_allocator.cuh"
@@ -60,51 +61,29 @@ inclusive_inplace(
   hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::inclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      begin,
-                                      len,
-                                      binary_op,
-                                      stream));
+        return ::rocprim::inclusive_scan(d_temp_storage,
+                                         temp_storage_bytes,
+                                         begin,
+                                         begin,
+                                         len,
+                                         binary_op,
+                                         stream);
 #elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             begin,
-                                             binary_op,
-                                             len,
-                                             stream));
+        return ::cub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                begin,
+                                                binary_op,
+                                                len,
+                                                stream);
 #endif
-
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::inclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      begin,
-                                      len,
-                                      binary_op,
-                                      stream));
-#elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             begin,
-                                             binary_op,
-                                             len,
-                                             stream));
-#endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   hip::launch(hip_res, Async);
 
@@ -133,54 +112,31 @@ exclusive_inplace(
   hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      begin,
-                                      init,
-                                      len,
-                                      binary_op,
-                                      stream));
+        return ::rocprim::exclusive_scan(d_temp_storage,
+                                         temp_storage_bytes,
+                                         begin,
+                                         begin,
+                                         init,
+                                         len,
+                                         binary_op,
+                                         stream);
 #elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             begin,
-                                             binary_op,
-                                             init,
-                                             len,
-                                             stream));
+        return ::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                begin,
+                                                binary_op,
+                                                init,
+                                                len,
+                                                stream);
 #endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
-                                              temp_storage_bytes,
-                                              begin,
-                                              begin,
-                                              init,
-                                              len,
-                                              binary_op,
-                                              stream));
-#elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             begin,
-                                             binary_op,
-                                             init,
-                                             len,
-                                             stream));
-#endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   hip::launch(hip_res, Async);
 
@@ -209,50 +165,29 @@ inclusive(
   hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::inclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      out,
-                                      len,
-                                      binary_op,
-                                      stream));
+        return ::rocprim::inclusive_scan(d_temp_storage,
+                                         temp_storage_bytes,
+                                         begin,
+                                         out,
+                                         len,
+                                         binary_op,
+                                         stream);
 #elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             out,
-                                             binary_op,
-                                             len,
-                                             stream));
+        return ::cub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                out,
+                                                binary_op,
+                                                len,
+                                                stream);
 #endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::inclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      out,
-                                      len,
-                                      binary_op,
-                                      stream));
-#elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::InclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             out,
-                                             binary_op,
-                                             len,
-                                             stream));
-#endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   hip::launch(hip_res, Async);
 
@@ -283,54 +218,223 @@ exclusive(
   hipStream_t stream = hip_res.get_stream();
 
   int len = std::distance(begin, end);
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      out,
-                                      init,
-                                      len,
-                                      binary_op,
-                                      stream));
+        return ::rocprim::exclusive_scan(d_temp_storage,
+                                         temp_storage_bytes,
+                                         begin,
+                                         out,
+                                         init,
+                                         len,
+                                         binary_op,
+                                         stream);
 #elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             out,
-                                             binary_op,
-                                             init,
-                                             len,
-                                             stream));
+        return ::cub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                begin,
+                                                out,
+                                                binary_op,
+                                                init,
+                                                len,
+                                                stream);
 #endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-  // Run
+      },
+      len));
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+namespace detail
+{
+
+/*!
+        \brief kernel that writes the index of the segment containing each
+   element, the segments given by num_segments+1 offsets partition [0, len)
+*/
+template <typename OffsetIter>
+__global__ void segment_keys(OffsetIter offsets,
+                             int num_segments,
+                             int* keys,
+                             int len)
+{
+  const int i = static_cast<int>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < len) {
+    // last segment that begins at or before i, skipping empty segments
+    int lo = 0;
+    int hi = num_segments;
+    while (hi - lo > 1) {
+      const int mid = lo + (hi - lo) / 2;
+      if (offsets[mid] <= i) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    keys[i] = lo;
+  }
+}
+
+/*!
+        \brief allocate and fill the segment index of each element in [0, len)
+   on the stream of hip_res
+*/
+template <size_t BLOCK_SIZE, typename OffsetIter>
+RAJA_INLINE
+int* make_segment_keys(resources::Hip hip_res,
+                       OffsetIter offsets,
+                       int num_segments,
+                       int len)
+{
+  int* keys = hip::temp_malloc<int>(hip_res, len);
+
+  auto func = segment_keys<OffsetIter>;
+  const hip_dim_member_t num_blocks =
+      static_cast<hip_dim_member_t>((len + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  hip_dim_t gridSize{num_blocks, 1, 1};
+  hip_dim_t blockSize{static_cast<hip_dim_member_t>(BLOCK_SIZE), 1, 1};
+  void* args[] = {(void*)&offsets, (void*)&num_segments, (void*)&keys,
+                  (void*)&len};
+  RAJA::hip::launch((const void*)func, gridSize, blockSize, args, 0,
+                     hip_res, true);
+
+  return keys;
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive segmented scan given input range, output,
+   segment offsets, and function
+
+   Each element is keyed by the index of its segment and the segments are
+   scanned together with a single scan by key.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename OffsetIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+inclusive_segmented(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    OffsetIter offsets,
+    int num_segments,
+    Function binary_op)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(begin, end);
+  int* d_keys =
+      detail::make_segment_keys<BLOCK_SIZE>(hip_res, offsets,
+                                            num_segments, len);
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::inclusive_scan_by_key(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                begin,
+                                                out,
+                                                len,
+                                                binary_op,
+                                                ::rocprim::equal_to<int>(),
+                                                stream);
+#elif defined(__CUDACC__)
+        return ::cub::DeviceScan::InclusiveScanByKey(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_keys,
+                                                     begin,
+                                                     out,
+                                                     binary_op,
+                                                     len,
+                                                     ::cub::Equality(),
+                                                     stream);
+#endif
+      },
+      len));
+  hip::temp_free(hip_res, d_keys);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, output,
+   segment offsets, function, and initial value for each segment
+
+   Each element is keyed by the index of its segment and the segments are
+   scanned together with a single scan by key.
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename OffsetIter,
+          typename Function,
+          typename T>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+exclusive_segmented(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    OffsetIter offsets,
+    int num_segments,
+    Function binary_op,
+    T init)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(begin, end);
+  int* d_keys =
+      detail::make_segment_keys<BLOCK_SIZE>(hip_res, offsets,
+                                            num_segments, len);
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::exclusive_scan(d_temp_storage,
-                                      temp_storage_bytes,
-                                      begin,
-                                      out,
-                                      init,
-                                      len,
-                                      binary_op,
-                                      stream));
+        return ::rocprim::exclusive_scan_by_key(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                begin,
+                                                out,
+                                                init,
+                                                len,
+                                                binary_op,
+                                                ::rocprim::equal_to<int>(),
+                                                stream);
 #elif defined(__CUDACC__)
-  hipErrchk(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
-                                             temp_storage_bytes,
-                                             begin,
-                                             out,
-                                             binary_op,
-                                             init,
-                                             len,
-                                             stream));
+        return ::cub::DeviceScan::ExclusiveScanByKey(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_keys,
+                                                     begin,
+                                                     out,
+                                                     binary_op,
+                                                     init,
+                                                     len,
+                                                     ::cub::Equality(),
+                                                     stream);
 #endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
+  hip::temp_free(hip_res, d_keys);
 
   hip::launch(hip_res, Async);
 
@@ -30,12 +30,17 @@
 #define ROCPRIM_HIP_API 1
 #include "rocprim/device/device_transform.hpp"
 #include "rocprim/device/device_radix_sort.hpp"
+#include "rocprim/device/device_segmented_radix_sort.hpp"
+#include "rocprim/device/device_merge_sort.hpp"
 #elif defined(__CUDACC__)
 #include "cub/device/device_radix_sort.cuh"
+#include "cub/device/device_segmented_radix_sort.cuh"
+#include "cub/device/device_merge_sort.cuh"
 #endif
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/zip.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/policy/hip/MemUtils_HIP.hpp"
 #include "RAJA/policy/hip/policy.hpp"
@@ -71,7 +76,8 @@ namespace detail
 }
 
 /*!
-        \brief static assert unimplemented stable sort
+        \brief stable merge sort given range using comparison function,
+               used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Hip>,
@@ -84,17 +90,38 @@ concepts::enable_if_t<resources::EventProxy<resources::Hip>,
 stable(
     resources::Hip hip_res,
     hip_exec<BLOCK_SIZE, Async>,
-    Iter,
-    Iter,
-    Compare)
+    Iter begin,
+    Iter end,
+    Compare comp)
 {
-  static_assert(concepts::all_of<
-                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
-                  std::is_pointer<Iter>,
-                  concepts::any_of<
-                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
-                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
-                "RAJA stable_sort<hip_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(begin, end);
+
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::merge_sort(d_temp_storage,
+                                     temp_storage_bytes,
+                                     begin,
+                                     begin,
+                                     len,
+                                     comp,
+                                     stream);
+#elif defined(__CUDACC__)
+        return ::cub::DeviceMergeSort::StableSortKeys(d_temp_storage,
+                                                      temp_storage_bytes,
+                                                      begin,
+                                                      len,
+                                                      comp,
+                                                      stream);
+#endif
+      },
+      len));
+
+  hip::launch(hip_res, Async);
 
   return resources::EventProxy<resources::Hip>(hip_res);
 }
@@ -122,57 +149,35 @@ stable(
   int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = hip::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = hip::temp_malloc<R>(hip_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
   detail::double_buffer<R> d_keys(begin, d_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_keys(d_temp_storage,
-                                       temp_storage_bytes,
-                                       d_keys,
-                                       len,
-                                       begin_bit,
-                                       end_bit,
-                                       stream));
+        return ::rocprim::radix_sort_keys(d_temp_storage,
+                                          temp_storage_bytes,
+                                          d_keys,
+                                          len,
+                                          begin_bit,
+                                          end_bit,
+                                          stream);
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
-                                              temp_storage_bytes,
-                                              d_keys,
-                                              len,
-                                              begin_bit,
-                                              end_bit,
-                                              stream));
+        return ::cub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                len,
+                                                begin_bit,
+                                                end_bit,
+                                                stream);
 #endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_keys(d_temp_storage,
-                                       temp_storage_bytes,
-                                       d_keys,
-                                       len,
-                                       begin_bit,
-                                       end_bit,
-                                       stream));
-#elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
-                                              temp_storage_bytes,
-                                              d_keys,
-                                              len,
-                                              begin_bit,
-                                              end_bit,
-                                              stream));
-#endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   if (detail::get_current(d_keys) == d_out) {
 
@@ -180,7 +185,7 @@ stable(
     hipErrchk(hipMemcpyAsync(begin, d_out, len*sizeof(R), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_out);
+  hip::temp_free(hip_res, d_out);
 
   hip::launch(hip_res, Async);
 
@@ -210,57 +215,35 @@ stable(
   int end_bit=sizeof(R)*CHAR_BIT;
 
   // Allocate temporary storage for the output array
-  R* d_out = hip::device_mempool_type::getInstance().malloc<R>(len);
+  R* d_out = hip::temp_malloc<R>(hip_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the begin buffer
   detail::double_buffer<R> d_keys(begin, d_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_keys_desc(d_temp_storage,
-                                            temp_storage_bytes,
-                                            d_keys,
-                                            len,
-                                            begin_bit,
-                                            end_bit,
-                                            stream));
-#elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        d_keys,
-                                                        len,
-                                                        begin_bit,
-                                                        end_bit,
-                                                        stream));
-#endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_keys_desc(d_temp_storage,
-                                            temp_storage_bytes,
-                                            d_keys,
-                                            len,
-                                            begin_bit,
-                                            end_bit,
-                                            stream));
+        return ::rocprim::radix_sort_keys_desc(d_temp_storage,
+                                               temp_storage_bytes,
+                                               d_keys,
+                                               len,
+                                               begin_bit,
+                                               end_bit,
+                                               stream);
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
-                                                        temp_storage_bytes,
-                                                        d_keys,
-                                                        len,
-                                                        begin_bit,
-                                                        end_bit,
-                                                        stream));
+        return ::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys,
+                                                          len,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream);
 #endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   if (detail::get_current(d_keys) == d_out) {
 
@@ -268,7 +251,7 @@ stable(
     hipErrchk(hipMemcpyAsync(begin, d_out, len*sizeof(R), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_out);
+  hip::temp_free(hip_res, d_out);
 
   hip::launch(hip_res, Async);
 
@@ -277,7 +260,8 @@ stable(
 
 
 /*!
-        \brief static assert unimplemented sort
+        \brief sort given range using comparison function,
+               used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Hip>,
@@ -289,20 +273,12 @@ concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                           camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
 unstable(
     resources::Hip hip_res,
-    hip_exec<BLOCK_SIZE, Async>,
-    Iter,
-    Iter,
-    Compare)
+    hip_exec<BLOCK_SIZE, Async> p,
+    Iter begin,
+    Iter end,
+    Compare comp)
 {
-  static_assert(concepts::all_of<
-                  type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
-                  std::is_pointer<Iter>,
-                  concepts::any_of<
-                    camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
-                    camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>::value,
-                "RAJA sort<hip_exec> is only implemented for pointers to arithmetic types and RAJA::operators::less and RAJA::operators::greater.");
-
-  return resources::EventProxy<resources::Hip>(hip_res);
+  return stable(hip_res, p, begin, end, comp);
 }
 
 /*!
@@ -341,7 +317,8 @@ unstable(
 
 
 /*!
-        \brief static assert unimplemented stable sort pairs
+        \brief stable merge sort given range of pairs using comparison
+               function on keys, used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, bool Async,
           typename KeyIter, typename ValIter, typename Compare>
@@ -349,29 +326,51 @@ concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                       concepts::negate<concepts::all_of<
                         type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                         std::is_pointer<KeyIter>,
-                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          std::is_pointer<ValIter>,
+                          RAJA::detail::is_pointer_zip_iterator<ValIter>>,
                         concepts::any_of<
                           camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                           camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
 stable_pairs(
     resources::Hip hip_res,
     hip_exec<BLOCK_SIZE, Async>,
-    KeyIter,
-    KeyIter,
-    ValIter,
-    Compare)
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
 {
-  static_assert (std::is_pointer<KeyIter>::value,
-      "stable_sort_pairs<hip_exec> is only implemented for pointers");
-  static_assert (std::is_pointer<ValIter>::value,
-      "stable_sort_pairs<hip_exec> is only implemented for pointers");
-  using K = RAJA::detail::IterVal<KeyIter>;
-  static_assert (type_traits::is_arithmetic<K>::value,
-      "stable_sort_pairs<hip_exec> is only implemented for arithmetic types");
-  static_assert (concepts::any_of<
-      camp::is_same<Compare, operators::less<K>>,
-      camp::is_same<Compare, operators::greater<K>>>::value,
-      "stable_sort_pairs<hip_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+  hipStream_t stream = hip_res.get_stream();
+
+  int len = std::distance(keys_begin, keys_end);
+
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return ::rocprim::merge_sort(d_temp_storage,
+                                     temp_storage_bytes,
+                                     keys_begin,
+                                     keys_begin,
+                                     vals_begin,
+                                     vals_begin,
+                                     len,
+                                     comp,
+                                     stream);
+#elif defined(__CUDACC__)
+        return ::cub::DeviceMergeSort::StableSortPairs(d_temp_storage,
+                                                       temp_storage_bytes,
+                                                       keys_begin,
+                                                       vals_begin,
+                                                       len,
+                                                       comp,
+                                                       stream);
+#endif
+      },
+      len));
+
+  hip::launch(hip_res, Async);
 
   return resources::EventProxy<resources::Hip>(hip_res);
 }
@@ -403,63 +402,39 @@ stable_pairs(
   int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = hip::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = hip::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = hip::temp_malloc<K>(hip_res, len);
+  V* d_vals_out = hip::temp_malloc<V>(hip_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
   detail::double_buffer<K> d_keys(keys_begin, d_keys_out);
   detail::double_buffer<V> d_vals(vals_begin, d_vals_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_pairs(d_temp_storage,
-                                        temp_storage_bytes,
-                                        d_keys,
-                                        d_vals,
-                                        len,
-                                        begin_bit,
-                                        end_bit,
-                                        stream));
+        return ::rocprim::radix_sort_pairs(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_keys,
+                                           d_vals,
+                                           len,
+                                           begin_bit,
+                                           end_bit,
+                                           stream);
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
-                                               temp_storage_bytes,
-                                               d_keys,
-                                               d_vals,
-                                               len,
-                                               begin_bit,
-                                               end_bit,
-                                               stream));
+        return ::cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 d_vals,
+                                                 len,
+                                                 begin_bit,
+                                                 end_bit,
+                                                 stream);
 #endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_pairs(d_temp_storage,
-                                        temp_storage_bytes,
-                                        d_keys,
-                                        d_vals,
-                                        len,
-                                        begin_bit,
-                                        end_bit,
-                                        stream));
-#elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
-                                               temp_storage_bytes,
-                                               d_keys,
-                                               d_vals,
-                                               len,
-                                               begin_bit,
-                                               end_bit,
-                                               stream));
-#endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   if (detail::get_current(d_keys) == d_keys_out) {
 
@@ -472,8 +447,8 @@ stable_pairs(
     hipErrchk(hipMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_keys_out);
-  hip::device_mempool_type::getInstance().free(d_vals_out);
+  hip::temp_free(hip_res, d_keys_out);
+  hip::temp_free(hip_res, d_vals_out);
 
   hip::launch(hip_res, Async);
 
@@ -507,63 +482,39 @@ stable_pairs(
   int end_bit=sizeof(K)*CHAR_BIT;
 
   // Allocate temporary storage for the output arrays
-  K* d_keys_out = hip::device_mempool_type::getInstance().malloc<K>(len);
-  V* d_vals_out = hip::device_mempool_type::getInstance().malloc<V>(len);
+  K* d_keys_out = hip::temp_malloc<K>(hip_res, len);
+  V* d_vals_out = hip::temp_malloc<V>(hip_res, len);
 
   // use cub double buffer to reduce temporary memory requirements
   // by allowing cub to write to the keys_begin and vals_begin buffers
   detail::double_buffer<K> d_keys(keys_begin, d_keys_out);
   detail::double_buffer<V> d_vals(vals_begin, d_vals_out);
 
-  // Determine temporary device storage requirements
-  void* d_temp_storage = nullptr;
-  size_t temp_storage_bytes = 0;
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
 #if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_pairs_desc(d_temp_storage,
-                                             temp_storage_bytes,
-                                             d_keys,
-                                             d_vals,
-                                             len,
-                                             begin_bit,
-                                             end_bit,
-                                             stream));
+        return ::rocprim::radix_sort_pairs_desc(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys,
+                                                d_vals,
+                                                len,
+                                                begin_bit,
+                                                end_bit,
+                                                stream);
 #elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
-                                                         temp_storage_bytes,
-                                                         d_keys,
-                                                         d_vals,
-                                                         len,
-                                                         begin_bit,
-                                                         end_bit,
-                                                         stream));
+        return ::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_keys,
+                                                           d_vals,
+                                                           len,
+                                                           begin_bit,
+                                                           end_bit,
+                                                           stream);
 #endif
-  // Allocate temporary storage
-  d_temp_storage =
-      hip::device_mempool_type::getInstance().malloc<unsigned char>(
-          temp_storage_bytes);
-
-  // Run
-#if defined(__HIPCC__)
-  hipErrchk(::rocprim::radix_sort_pairs_desc(d_temp_storage,
-                                             temp_storage_bytes,
-                                             d_keys,
-                                             d_vals,
-                                             len,
-                                             begin_bit,
-                                             end_bit,
-                                             stream));
-#elif defined(__CUDACC__)
-  cudaErrchk(::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
-                                                         temp_storage_bytes,
-                                                         d_keys,
-                                                         d_vals,
-                                                         len,
-                                                         begin_bit,
-                                                         end_bit,
-                                                         stream));
-#endif
-  // Free temporary storage
-  hip::device_mempool_type::getInstance().free(d_temp_storage);
+      },
+      len));
 
   if (detail::get_current(d_keys) == d_keys_out) {
 
@@ -576,8 +527,8 @@ stable_pairs(
     hipErrchk(hipMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), hipMemcpyDefault, stream));
   }
 
-  hip::device_mempool_type::getInstance().free(d_keys_out);
-  hip::device_mempool_type::getInstance().free(d_vals_out);
+  hip::temp_free(hip_res, d_keys_out);
+  hip::temp_free(hip_res, d_vals_out);
 
   hip::launch(hip_res, Async);
 
@@ -585,8 +536,131 @@ stable_pairs(
 }
 
 
+namespace detail
+{
+
+/*!
+        \brief fill perm with the indices [0, len)
+*/
+template <typename IdxT>
+__global__ void sort_iota(IdxT* perm, IdxT len)
+{
+  const IdxT i = static_cast<IdxT>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < len) {
+    perm[i] = i;
+  }
+}
+
+/*!
+        \brief gather the zipped values in the sorted order given by perm
+*/
+template <typename ZipIter, typename IdxT>
+__global__ void sort_gather_zip(ZipIter out, ZipIter in, const IdxT* perm, IdxT len)
+{
+  const IdxT i = static_cast<IdxT>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (i < len) {
+    out[i] = in[perm[i]];
+  }
+}
+
+/*!
+        \brief copy a temporary value array back to dst and free it
+*/
+template <typename T>
+RAJA_INLINE
+int sort_copy_back(resources::Hip hip_res, T* dst, T* src, int len)
+{
+  hipErrchk(hipMemcpyAsync(dst, src, len*sizeof(T), hipMemcpyDefault, hip_res.get_stream()));
+  hip::temp_free(hip_res, src);
+  return 0;
+}
+
+template <typename... ValPtrs, camp::idx_t... Is>
+RAJA_INLINE
+void sort_copy_back_zip(resources::Hip hip_res,
+                        ZipIterator<ValPtrs...> dst,
+                        ZipIterator<ValPtrs...> src,
+                        int len,
+                        camp::idx_seq<Is...>)
+{
+  camp::sink(sort_copy_back(hip_res,
+                            RAJA::get<Is>(dst.get_iterators()),
+                            RAJA::get<Is>(src.get_iterators()),
+                            len)...);
+}
+
+} // namespace detail
+
 /*!
-        \brief static assert unimplemented sort pairs
+        \brief stable sort given range of pairs with zipped values in
+               ascending or descending order of keys
+
+   The keys are radix sorted once together with the permutation of the
+   values, then one kernel gathers every value array in sorted order, so a
+   key carrying several value arrays is sorted in a single pass.
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename... ValPtrs, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      RAJA::detail::is_pointer_zip_iterator<ZipIterator<ValPtrs...>>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+stable_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ZipIterator<ValPtrs...> vals_begin,
+    Compare comp)
+{
+  int len = std::distance(keys_begin, keys_end);
+  if (len <= 0) {
+    return resources::EventProxy<resources::Hip>(hip_res);
+  }
+
+  const hip_dim_member_t num_blocks =
+      static_cast<hip_dim_member_t>((len + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  hip_dim_t gridSize{num_blocks, 1, 1};
+  hip_dim_t blockSize{static_cast<hip_dim_member_t>(BLOCK_SIZE), 1, 1};
+
+  // sort the keys with the permutation of the values
+  int* perm = hip::temp_malloc<int>(hip_res, len);
+  {
+    auto func = detail::sort_iota<int>;
+    void* args[] = {(void*)&perm, (void*)&len};
+    RAJA::hip::launch((const void*)func, gridSize, blockSize, args, 0,
+                       hip_res, true);
+  }
+  stable_pairs(hip_res, hip_exec<BLOCK_SIZE, true>{},
+               keys_begin, keys_end, perm, comp);
+
+  // gather the values into temporary arrays and copy them back
+  ZipIterator<ValPtrs...> vals_out(
+      hip::temp_malloc<typename std::iterator_traits<ValPtrs>::value_type>(
+          hip_res, len)...);
+  {
+    auto func = detail::sort_gather_zip<ZipIterator<ValPtrs...>, int>;
+    void* args[] = {(void*)&vals_out, (void*)&vals_begin, (void*)&perm,
+                    (void*)&len};
+    RAJA::hip::launch((const void*)func, gridSize, blockSize, args, 0,
+                       hip_res, true);
+  }
+  detail::sort_copy_back_zip(hip_res, vals_begin, vals_out, len,
+                             camp::make_idx_seq_t<sizeof...(ValPtrs)>{});
+
+  hip::temp_free(hip_res, perm);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys,
+               used when the radix sort does not apply
 */
 template <size_t BLOCK_SIZE, bool Async,
           typename KeyIter, typename ValIter, typename Compare>
@@ -594,31 +668,21 @@ concepts::enable_if_t<resources::EventProxy<resources::Hip>,
                       concepts::negate<concepts::all_of<
                         type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
                         std::is_pointer<KeyIter>,
-                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          std::is_pointer<ValIter>,
+                          RAJA::detail::is_pointer_zip_iterator<ValIter>>,
                         concepts::any_of<
                           camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
                           camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
 unstable_pairs(
     resources::Hip hip_res,
-    hip_exec<BLOCK_SIZE, Async>,
-    KeyIter,
-    KeyIter,
-    ValIter,
-    Compare)
+    hip_exec<BLOCK_SIZE, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
 {
-  static_assert (std::is_pointer<KeyIter>::value,
-      "sort_pairs<hip_exec> is only implemented for pointers");
-  static_assert (std::is_pointer<ValIter>::value,
-      "sort_pairs<hip_exec> is only implemented for pointers");
-  using K = RAJA::detail::IterVal<KeyIter>;
-  static_assert (type_traits::is_arithmetic<K>::value,
-      "sort_pairs<hip_exec> is only implemented for arithmetic types");
-  static_assert (concepts::any_of<
-      camp::is_same<Compare, operators::less<K>>,
-      camp::is_same<Compare, operators::greater<K>>>::value,
-      "sort_pairs<hip_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
-
-  return resources::EventProxy<resources::Hip>(hip_res);
+  return stable_pairs(hip_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
 /*!
@@ -661,6 +725,354 @@ unstable_pairs(
   return stable_pairs(hip_res, p, keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief stable sort given range of pairs with zipped values in
+               ascending or descending order of keys
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename... ValPtrs, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      RAJA::detail::is_pointer_zip_iterator<ZipIterator<ValPtrs...>>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+unstable_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ZipIterator<ValPtrs...> vals_begin,
+    Compare comp)
+{
+  return stable_pairs(hip_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
+namespace detail
+{
+
+/*!
+    \brief ascending or descending rocprim or cub segmented radix sort
+*/
+template <bool Descending>
+struct hip_segmented_radix_sort;
+///
+template <>
+struct hip_segmented_radix_sort<false>
+{
+  template <typename... Args>
+  static auto keys(Args&&... args)
+#if defined(__HIPCC__)
+    -> decltype(::rocprim::segmented_radix_sort_keys(std::forward<Args>(args)...))
+  {
+    return ::rocprim::segmented_radix_sort_keys(std::forward<Args>(args)...);
+  }
+#elif defined(__CUDACC__)
+    -> decltype(::cub::DeviceSegmentedRadixSort::SortKeys(std::forward<Args>(args)...))
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortKeys(std::forward<Args>(args)...);
+  }
+#endif
+
+  template <typename... Args>
+  static auto pairs(Args&&... args)
+#if defined(__HIPCC__)
+    -> decltype(::rocprim::segmented_radix_sort_pairs(std::forward<Args>(args)...))
+  {
+    return ::rocprim::segmented_radix_sort_pairs(std::forward<Args>(args)...);
+  }
+#elif defined(__CUDACC__)
+    -> decltype(::cub::DeviceSegmentedRadixSort::SortPairs(std::forward<Args>(args)...))
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortPairs(std::forward<Args>(args)...);
+  }
+#endif
+};
+///
+template <>
+struct hip_segmented_radix_sort<true>
+{
+  template <typename... Args>
+  static auto keys(Args&&... args)
+#if defined(__HIPCC__)
+    -> decltype(::rocprim::segmented_radix_sort_keys_desc(std::forward<Args>(args)...))
+  {
+    return ::rocprim::segmented_radix_sort_keys_desc(std::forward<Args>(args)...);
+  }
+#elif defined(__CUDACC__)
+    -> decltype(::cub::DeviceSegmentedRadixSort::SortKeysDescending(std::forward<Args>(args)...))
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortKeysDescending(std::forward<Args>(args)...);
+  }
+#endif
+
+  template <typename... Args>
+  static auto pairs(Args&&... args)
+#if defined(__HIPCC__)
+    -> decltype(::rocprim::segmented_radix_sort_pairs_desc(std::forward<Args>(args)...))
+  {
+    return ::rocprim::segmented_radix_sort_pairs_desc(std::forward<Args>(args)...);
+  }
+#elif defined(__CUDACC__)
+    -> decltype(::cub::DeviceSegmentedRadixSort::SortPairsDescending(std::forward<Args>(args)...))
+  {
+    return ::cub::DeviceSegmentedRadixSort::SortPairsDescending(std::forward<Args>(args)...);
+  }
+#endif
+};
+
+} // namespace detail
+
+/*!
+        \brief static assert unimplemented segmented sort
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                        std::is_pointer<Iter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>>>
+unstable_segmented(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter,
+    Iter,
+    OffsetIter,
+    int,
+    Compare)
+{
+  static_assert (std::is_pointer<Iter>::value,
+      "segmented_sort<hip_exec> is only implemented for pointers");
+  using iterval = RAJA::detail::IterVal<Iter>;
+  static_assert (type_traits::is_arithmetic<iterval>::value,
+      "segmented_sort<hip_exec> is only implemented for arithmetic types");
+  static_assert (concepts::any_of<
+      camp::is_same<Compare, operators::less<iterval>>,
+      camp::is_same<Compare, operators::greater<iterval>>>::value,
+      "segmented_sort<hip_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief sort each segment of given range in ascending or descending
+               order with one segmented radix sort
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<Iter>>,
+                      std::is_pointer<Iter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<Iter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<Iter>>>>>
+unstable_segmented(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter end,
+    OffsetIter offsets,
+    int num_segments,
+    Compare)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  using R = RAJA::detail::IterVal<Iter>;
+  using sorter = detail::hip_segmented_radix_sort<
+      std::is_same<Compare, operators::greater<R>>::value>;
+
+  int len = std::distance(begin, end);
+  int begin_bit=0;
+  int end_bit=sizeof(R)*CHAR_BIT;
+
+  // Allocate temporary storage for the output array
+  R* d_out = hip::temp_malloc<R>(hip_res, len);
+
+  // use double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the begin buffer
+  detail::double_buffer<R> d_keys(begin, d_out);
+
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return sorter::keys(d_temp_storage,
+                            temp_storage_bytes,
+                            d_keys,
+                            len,
+                            num_segments,
+                            offsets,
+                            offsets + 1,
+                            begin_bit,
+                            end_bit,
+                            stream);
+#elif defined(__CUDACC__)
+        return sorter::keys(d_temp_storage,
+                            temp_storage_bytes,
+                            d_keys,
+                            len,
+                            num_segments,
+                            offsets,
+                            offsets + 1,
+                            begin_bit,
+                            end_bit,
+                            stream);
+#endif
+      },
+      len, num_segments));
+
+  if (detail::get_current(d_keys) == d_out) {
+
+    // copy
+    hipErrchk(hipMemcpyAsync(begin, d_out, len*sizeof(R), hipMemcpyDefault, stream));
+  }
+
+  hip::temp_free(hip_res, d_out);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief static assert unimplemented segmented sort pairs
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter,
+          typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      concepts::negate<concepts::all_of<
+                        type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                        std::is_pointer<KeyIter>,
+                        std::is_pointer<ValIter>,
+                        concepts::any_of<
+                          camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                          camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>>>
+unstable_segmented_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter,
+    KeyIter,
+    ValIter,
+    OffsetIter,
+    int,
+    Compare)
+{
+  static_assert (std::is_pointer<KeyIter>::value,
+      "segmented_sort_pairs<hip_exec> is only implemented for pointers");
+  static_assert (std::is_pointer<ValIter>::value,
+      "segmented_sort_pairs<hip_exec> is only implemented for pointers");
+  using K = RAJA::detail::IterVal<KeyIter>;
+  static_assert (type_traits::is_arithmetic<K>::value,
+      "segmented_sort_pairs<hip_exec> is only implemented for arithmetic types");
+  static_assert (concepts::any_of<
+      camp::is_same<Compare, operators::less<K>>,
+      camp::is_same<Compare, operators::greater<K>>>::value,
+      "segmented_sort_pairs<hip_exec> is only implemented for RAJA::operators::less or RAJA::operators::greater");
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+/*!
+        \brief sort each segment of given range of pairs in ascending or
+               descending order of keys with one segmented radix sort
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename OffsetIter,
+          typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Hip>,
+                      type_traits::is_arithmetic<RAJA::detail::IterVal<KeyIter>>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>,
+                      concepts::any_of<
+                        camp::is_same<Compare, operators::less<RAJA::detail::IterVal<KeyIter>>>,
+                        camp::is_same<Compare, operators::greater<RAJA::detail::IterVal<KeyIter>>>>>
+unstable_segmented_pairs(
+    resources::Hip hip_res,
+    hip_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OffsetIter offsets,
+    int num_segments,
+    Compare)
+{
+  hipStream_t stream = hip_res.get_stream();
+
+  using K = RAJA::detail::IterVal<KeyIter>;
+  using V = RAJA::detail::IterVal<ValIter>;
+  using sorter = detail::hip_segmented_radix_sort<
+      std::is_same<Compare, operators::greater<K>>::value>;
+
+  int len = std::distance(keys_begin, keys_end);
+  int begin_bit=0;
+  int end_bit=sizeof(K)*CHAR_BIT;
+
+  // Allocate temporary storage for the output arrays
+  K* d_keys_out = hip::temp_malloc<K>(hip_res, len);
+  V* d_vals_out = hip::temp_malloc<V>(hip_res, len);
+
+  // use double buffer to reduce temporary memory requirements
+  // by allowing cub to write to the keys_begin and vals_begin buffers
+  detail::double_buffer<K> d_keys(keys_begin, d_keys_out);
+  detail::double_buffer<V> d_vals(vals_begin, d_vals_out);
+
+  // Run with temporary device storage
+  hipErrchk(hip::temp_storage_call(
+      hip_res,
+      [&](void* d_temp_storage, size_t& temp_storage_bytes) {
+#if defined(__HIPCC__)
+        return sorter::pairs(d_temp_storage,
+                             temp_storage_bytes,
+                             d_keys,
+                             d_vals,
+                             len,
+                             num_segments,
+                             offsets,
+                             offsets + 1,
+                             begin_bit,
+                             end_bit,
+                             stream);
+#elif defined(__CUDACC__)
+        return sorter::pairs(d_temp_storage,
+                             temp_storage_bytes,
+                             d_keys,
+                             d_vals,
+                             len,
+                             num_segments,
+                             offsets,
+                             offsets + 1,
+                             begin_bit,
+                             end_bit,
+                             stream);
+#endif
+      },
+      len, num_segments));
+
+  if (detail::get_current(d_keys) == d_keys_out) {
+
+    // copy keys
+    hipErrchk(hipMemcpyAsync(keys_begin, d_keys_out, len*sizeof(K), hipMemcpyDefault, stream));
+  }
+  if (detail::get_current(d_vals) == d_vals_out) {
+
+    // copy vals
+    hipErrchk(hipMemcpyAsync(vals_begin, d_vals_out, len*sizeof(V), hipMemcpyDefault, stream));
+  }
+
+  hip::temp_free(hip_res, d_keys_out);
+  hip::temp_free(hip_res, d_vals_out);
+
+  hip::launch(hip_res, Async);
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
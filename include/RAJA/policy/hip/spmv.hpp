@@ -0,0 +1,247 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA spmv declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_spmv_hip_HPP
+#define RAJA_spmv_hip_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/spmv.hpp"
+
+#include "RAJA/policy/hip/MemUtils_HIP.hpp"
+#include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/reduce.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace spmv
+{
+
+namespace detail
+{
+
+//! rows and nonzeros each thread of the merge path kernel consumes
+constexpr Index_type hip_merge_items_per_thread = 8;
+
+/*!
+ * Find where diagonal diag crosses the merge path of the row ends and the
+ * nonzero indices, the thread starting there has ended rows [0, i) and
+ * consumed nonzeros [0, j).
+ */
+template <typename T, typename IndexType>
+RAJA_DEVICE RAJA_INLINE void hip_merge_path_search(
+    expt::CSRView<T, IndexType> const& A,
+    Index_type diag,
+    IndexType& i,
+    IndexType& j)
+{
+  Index_type lo = diag > A.nnz ? diag - A.nnz : 0;
+  Index_type hi = diag < A.num_rows ? diag : A.num_rows;
+  while (lo < hi) {
+    const Index_type mid = (lo + hi) / 2;
+    if (A.row_ptr[mid + 1] <= diag - mid - 1) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  i = static_cast<IndexType>(lo);
+  j = static_cast<IndexType>(diag - lo);
+}
+
+/*!
+ * HIP global function for spmv with a warp per row, the lanes stride over
+ * the nonzeros of the row and sum with shuffles.
+ */
+template <size_t BLOCK_SIZE, typename T, typename IndexType>
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void csr_spmv_warp_global(expt::CSRView<T, IndexType> A,
+                              T const* x,
+                              T* y)
+{
+  constexpr Index_type warp_size = policy::hip::WARP_SIZE;
+  static_assert(BLOCK_SIZE % warp_size == 0,
+                "BLOCK_SIZE must be a multiple of the warp size");
+
+  const Index_type gid =
+      static_cast<Index_type>(blockIdx.x) * BLOCK_SIZE + threadIdx.x;
+  const Index_type r = gid / warp_size;
+  const Index_type lane = gid % warp_size;
+  // r is the same over the warp, so whole warps return
+  if (r >= A.num_rows) {
+    return;
+  }
+
+  T sum = T(0);
+  for (Index_type k = A.row_ptr[r] + lane; k < A.row_ptr[r + 1];
+       k += warp_size) {
+    sum += A.values[k] * x[A.col_idx[k]];
+  }
+  sum = ::RAJA::hip::impl::warp_allreduce<RAJA::reduce::sum<T>>(sum);
+
+  if (lane == 0) {
+    y[r] = sum;
+  }
+}
+
+/*!
+ * HIP global function for merge path spmv. Each thread consumes the same
+ * number of row ends and nonzeros, so long rows are split over threads. A
+ * row that starts and ends in a thread is stored, the parts of a row split
+ * over threads are added atomically to y, which is zeroed before.
+ */
+template <size_t BLOCK_SIZE, typename T, typename IndexType>
+__launch_bounds__(BLOCK_SIZE, 1) __global__
+    void csr_spmv_merge_global(expt::CSRView<T, IndexType> A,
+                               T const* x,
+                               T* y)
+{
+  const Index_type total = static_cast<Index_type>(A.num_rows) + A.nnz;
+  const Index_type tid =
+      static_cast<Index_type>(blockIdx.x) * BLOCK_SIZE + threadIdx.x;
+  const Index_type d_begin = tid * hip_merge_items_per_thread;
+  if (d_begin >= total) {
+    return;
+  }
+  const Index_type d_end = d_begin + hip_merge_items_per_thread < total
+                               ? d_begin + hip_merge_items_per_thread
+                               : total;
+
+  IndexType i;
+  IndexType j;
+  hip_merge_path_search(A, d_begin, i, j);
+  const IndexType j_begin = j;
+  IndexType row_begin = j;
+
+  T sum = T(0);
+  for (Index_type d = d_begin; d < d_end; ++d) {
+    if (j < A.row_ptr[i + 1]) {
+      sum += A.values[j] * x[A.col_idx[j]];
+      ++j;
+    } else {
+      if (A.row_ptr[i] < j_begin) {
+        RAJA::atomicAdd<RAJA::hip_atomic>(&y[i], sum);
+      } else {
+        y[i] = sum;
+      }
+      sum = T(0);
+      ++i;
+      row_begin = j;
+    }
+  }
+
+  // the rest of row i is consumed by the next threads
+  if (j > row_begin) {
+    RAJA::atomicAdd<RAJA::hip_atomic>(&y[i], sum);
+  }
+}
+
+/*!
+        \brief launch the warp per row kernel when the rows are long enough
+   to fill a good part of a wavefront, and the merge path kernel otherwise
+*/
+template <size_t BLOCK_SIZE, bool Async, typename T, typename IndexType>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+csr_spmv_launch(resources::Hip hip_res,
+                expt::CSRView<T, IndexType> const &A,
+                T const *x,
+                T *y)
+{
+  const Index_type warp_size = ::RAJA::hip::device_warp_size();
+  const Index_type num_rows = A.num_rows;
+  const Index_type nnz = A.nnz;
+
+  hip_dim_t blockSize{static_cast<unsigned int>(BLOCK_SIZE), 1, 1};
+  void* args[] = {(void*)&A, (void*)&x, (void*)&y};
+
+  if (nnz >= num_rows * (warp_size / 4)) {
+    auto func = csr_spmv_warp_global<BLOCK_SIZE, T, IndexType>;
+
+    const Index_type num_threads = num_rows * warp_size;
+    hip_dim_t gridSize{static_cast<unsigned int>(
+                           (num_threads + BLOCK_SIZE - 1) / BLOCK_SIZE),
+                       1, 1};
+
+    ::RAJA::hip::launch((const void*)func, gridSize, blockSize, args, 0,
+                        hip_res, Async);
+  } else {
+    auto func = csr_spmv_merge_global<BLOCK_SIZE, T, IndexType>;
+
+    const Index_type num_threads =
+        (num_rows + nnz + hip_merge_items_per_thread - 1) /
+        hip_merge_items_per_thread;
+    hip_dim_t gridSize{static_cast<unsigned int>(
+                           (num_threads + BLOCK_SIZE - 1) / BLOCK_SIZE),
+                       1, 1};
+
+    // rows split over threads are summed into y
+    hip_res.memset(y, 0, sizeof(T) * static_cast<size_t>(num_rows));
+    ::RAJA::hip::launch((const void*)func, gridSize, blockSize, args, 0,
+                        hip_res, Async);
+  }
+
+  return resources::EventProxy<resources::Hip>(hip_res);
+}
+
+}  // namespace detail
+
+/*!
+        \brief compute a CSR spmv with a warp per row or along the merge path
+*/
+template <size_t BLOCK_SIZE, bool Async, typename T, typename IndexType>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+csr_spmv(resources::Hip hip_res,
+         ::RAJA::policy::hip::hip_exec<BLOCK_SIZE, Async>,
+         expt::CSRView<T, IndexType> const &A,
+         T const *x,
+         T *y)
+{
+  return detail::csr_spmv_launch<BLOCK_SIZE, Async>(hip_res, A, x, y);
+}
+
+template <size_t BLOCK_SIZE, bool Async, typename T, typename IndexType>
+RAJA_INLINE
+resources::EventProxy<resources::Hip>
+csr_spmv(resources::Hip hip_res,
+         ::RAJA::policy::hip::hip_exec_occ<BLOCK_SIZE, Async>,
+         expt::CSRView<T, IndexType> const &A,
+         T const *x,
+         T *y)
+{
+  return detail::csr_spmv_launch<BLOCK_SIZE, Async>(hip_res, A, x, y);
+}
+
+}  // namespace spmv
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_HIP guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,147 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the HIP event based DeviceTimer.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_hip_timer_HPP
+#define RAJA_policy_hip_timer_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_HIP_ACTIVE)
+
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * DeviceTimer timing the intervals between hip events recorded on the
+ * stream of a Hip resource. Events are reused once their interval has
+ * been resolved.
+ */
+template <>
+class DeviceTimer<resources::Hip>
+{
+public:
+  using ElapsedType = double;
+
+  explicit DeviceTimer(resources::Hip res = resources::Hip::get_default())
+      : m_res(res), m_start(nullptr), telapsed(0)
+  {
+  }
+
+  DeviceTimer(DeviceTimer const&) = delete;
+  DeviceTimer& operator=(DeviceTimer const&) = delete;
+
+  ~DeviceTimer()
+  {
+    // events of unresolved intervals are released when they complete
+    for (auto& interval : m_pending) {
+      hipErrchk(hipEventDestroy(interval.first));
+      hipErrchk(hipEventDestroy(interval.second));
+    }
+    if (m_start != nullptr) {
+      hipErrchk(hipEventDestroy(m_start));
+    }
+    for (hipEvent_t event : m_free) {
+      hipErrchk(hipEventDestroy(event));
+    }
+  }
+
+  //! record the start of an interval on the stream
+  void start()
+  {
+    if (m_start == nullptr) {
+      m_start = get_event();
+    }
+    hipErrchk(hipEventRecord(m_start, m_res.get_stream()));
+  }
+
+  //! record the end of the interval on the stream
+  void stop()
+  {
+    hipEvent_t stop_event = get_event();
+    hipErrchk(hipEventRecord(stop_event, m_res.get_stream()));
+    m_pending.emplace_back(m_start, stop_event);
+    m_start = nullptr;
+  }
+
+  //! true if elapsed() would not wait for the device
+  bool ready() const
+  {
+    for (auto const& interval : m_pending) {
+      hipError_t status = hipEventQuery(interval.second);
+      if (status == hipErrorNotReady) {
+        return false;
+      }
+      hipErrchk(status);
+    }
+    return true;
+  }
+
+  //! elapsed time of the recorded intervals, waits for their events
+  ElapsedType elapsed() const
+  {
+    for (auto const& interval : m_pending) {
+      hipErrchk(hipEventSynchronize(interval.second));
+      float ms = 0.0f;
+      hipErrchk(hipEventElapsedTime(&ms, interval.first, interval.second));
+      telapsed += static_cast<ElapsedType>(ms) / 1000.0;
+      m_free.push_back(interval.first);
+      m_free.push_back(interval.second);
+    }
+    m_pending.clear();
+    return telapsed;
+  }
+
+  void reset()
+  {
+    elapsed();
+    telapsed = 0;
+  }
+
+private:
+  hipEvent_t get_event() const
+  {
+    hipEvent_t event;
+    if (m_free.empty()) {
+      hipErrchk(hipEventCreate(&event));
+    } else {
+      event = m_free.back();
+      m_free.pop_back();
+    }
+    return event;
+  }
+
+  resources::Hip m_res;
+  hipEvent_t m_start;
+  mutable std::vector<std::pair<hipEvent_t, hipEvent_t>> m_pending;
+  mutable std::vector<hipEvent_t> m_free;
+  mutable ElapsedType telapsed;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_HIP_ACTIVE guard
+
+#endif  // closing endif for header file include guard
@@ -27,6 +27,7 @@
 #include "RAJA/policy/loop/forall.hpp"
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/loop/compact.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/policy/loop/launch.hpp"
@@ -32,6 +32,7 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/forall.hpp"
 #include "RAJA/pattern/params/forall.hpp"
 
 using RAJA::concepts::enable_if;
@@ -60,6 +61,7 @@ RAJA_INLINE
 concepts::enable_if_t<
   resources::EventProxy<Resource>,
   expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
   concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
   >
 forall_impl(Resource res,
@@ -69,7 +71,7 @@ forall_impl(Resource res,
             ForallParam f_params)
 {
   expt::ParamMultiplexer::init<seq_exec>(f_params);
-  RAJA_EXTRACT_BED_IT(iter);
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
 
   for (decltype(distance_it) i = 0; i < distance_it; ++i) {
     expt::invoke_body(f_params, body, *(begin_it + i));
@@ -83,6 +85,7 @@ RAJA_INLINE
 concepts::enable_if_t<
   resources::EventProxy<Resource>,
   expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
   expt::type_traits::is_ForallParamPack_empty<ForallParam>
   >
 forall_impl(Resource res,
@@ -91,13 +94,60 @@ forall_impl(Resource res,
             Func &&body,
             ForallParam)
 {
-  RAJA_EXTRACT_BED_IT(iter);
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
 
   for (decltype(distance_it) i = 0; i < distance_it; ++i) {
     body(*(begin_it + i));
   }
   return RAJA::resources::EventProxy<Resource>(res);
 }
+
+//
+// Compressed segments visit their indices by decoding them in order.
+//
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  type_traits::is_compressed_segment<camp::decay<Iterable>>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(Resource res,
+            const loop_exec &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam f_params)
+{
+  expt::ParamMultiplexer::init<seq_exec>(f_params);
+
+  iter.for_each_index([&](auto idx) {
+    expt::invoke_body(f_params, body, idx);
+  });
+
+  expt::ParamMultiplexer::resolve<seq_exec>(f_params);
+  return RAJA::resources::EventProxy<Resource>(res);
+}
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  type_traits::is_compressed_segment<camp::decay<Iterable>>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(Resource res,
+            const loop_exec &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam)
+{
+  iter.for_each_index(body);
+  return RAJA::resources::EventProxy<Resource>(res);
+}
+
 }  // namespace loop
 
 }  // namespace policy
@@ -29,10 +29,19 @@ namespace RAJA
 template <>
 struct LaunchExecute<RAJA::null_launch_t> {
   template <typename BODY>
-  static void exec(LaunchContext const& RAJA_UNUSED_ARG(ctx),
-                   BODY const& RAJA_UNUSED_ARG(body))
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchParams const &RAJA_UNUSED_ARG(params), const char *RAJA_UNUSED_ARG(kernel_name), BODY const &RAJA_UNUSED_ARG(body))
+  {
+    RAJA_ABORT_OR_THROW("NULL Launch: kernel has no variant for this place");
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+  template <typename BODY, typename ReduceParams>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchParams const &RAJA_UNUSED_ARG(params), const char *RAJA_UNUSED_ARG(kernel_name), BODY const &RAJA_UNUSED_ARG(body), ReduceParams &RAJA_UNUSED_ARG(launch_reducers))
   {
-    RAJA_ABORT_OR_THROW("NULL Launch");
+    RAJA_ABORT_OR_THROW("NULL Launch: kernel has no variant for this place");
+    return resources::EventProxy<resources::Resource>(res);
   }
 };
 
@@ -58,6 +67,31 @@ struct LaunchExecute<RAJA::seq_launch_t> {
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *RAJA_UNUSED_ARG(kernel_name), BODY const &body, ReduceParams &launch_reducers)
+  {
+    using EXEC_POL = RAJA::seq_exec;
+
+    RAJA::expt::ParamMultiplexer::init<EXEC_POL>(launch_reducers);
+
+    LaunchContext ctx;
+
+    char *kernel_local_mem = new char[params.shared_mem_size];
+    ctx.shared_mem_ptr = kernel_local_mem;
+
+    RAJA::expt::invoke_body(launch_reducers, body, ctx);
+
+    delete[] kernel_local_mem;
+    ctx.shared_mem_ptr = nullptr;
+
+    RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(launch_reducers);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
 };
 
 template <typename SEGMENT>
@@ -156,6 +156,80 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+
+/*!
+        \brief explicit inclusive segmented scan given input range, output,
+   segment offsets, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename OffsetIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy& exec,
+    const Iter begin,
+    const Iter,
+    OutIter out,
+    OffsetIter offsets,
+    int num_segments,
+    BinFn f)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    const auto seg_begin = offsets[s];
+    const auto seg_end = offsets[s + 1];
+    if (seg_begin != seg_end) {
+      inclusive(host_res, exec,
+                begin + seg_begin, begin + seg_end,
+                out + seg_begin, f);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, output,
+   segment offsets, function, and
+   initial value for each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename OffsetIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy& exec,
+    const Iter begin,
+    const Iter,
+    OutIter out,
+    OffsetIter offsets,
+    int num_segments,
+    BinFn f,
+    T v)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    const auto seg_begin = offsets[s];
+    const auto seg_end = offsets[s + 1];
+    if (seg_begin != seg_end) {
+      exclusive(host_res, exec,
+                begin + seg_begin, begin + seg_end,
+                out + seg_begin, f, v);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
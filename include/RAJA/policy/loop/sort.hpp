@@ -32,6 +32,8 @@
 
 #include "RAJA/util/sort.hpp"
 
+#include "RAJA/util/simd_sort.hpp"
+
 #include "RAJA/policy/loop/policy.hpp"
 
 namespace RAJA
@@ -46,7 +48,8 @@ namespace detail
 
 /*!
     \brief Functional that performs an unstable sort with the
-           given arguments, uses RAJA::intro_sort
+           given arguments, uses RAJA::intro_sort with SIMD sorting
+           networks for small partitions when possible
 */
 struct UnstableSorter
 {
@@ -54,7 +57,7 @@ struct UnstableSorter
   RAJA_INLINE
   void operator()(Args&&... args) const
   {
-    RAJA::detail::intro_sort(std::forward<Args>(args)...);
+    RAJA::detail::simd_intro_sort(std::forward<Args>(args)...);
   }
 };
 
@@ -154,6 +157,60 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+unstable_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    if (offsets[s + 1] - offsets[s] > 1) {
+      detail::UnstableSorter{}(begin + offsets[s], begin + offsets[s + 1], comp);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+unstable_segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  for (int s = 0; s < num_segments; ++s) {
+    if (offsets[s + 1] - offsets[s] > 1) {
+      detail::UnstableSorter{}(begin + offsets[s], begin + offsets[s + 1],
+                               RAJA::compare_first<zip_ref>(comp));
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -34,10 +34,15 @@
 #endif
 
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/forall_fused.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/privatized_view.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
+#include "RAJA/policy/openmp/compact.hpp"
+#include "RAJA/policy/openmp/sweep.hpp"
+#include "RAJA/policy/openmp/spmv.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
 #include "RAJA/policy/openmp/sort.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
@@ -81,6 +81,67 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container out of order with all of the loops in
+ * one omp parallel region, each loop is run as an omp for nowait so there
+ * is no barrier between loops
+ */
+template <typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_for_nowait,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallOrdered_base<
+        RAJA::omp_for_nowait_static_exec< >,
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_for_nowait,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerForallOrdered_base<
+        RAJA::omp_for_nowait_static_exec< >,
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_for_nowait,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+
+  // run the loops in one parallel region, every thread encounters the
+  // omp for nowait of each loop in the order they were enqueued
+  template < typename WorkContainer >
+  typename base::per_run_storage run(WorkContainer const& storage,
+                                     typename base::resource_type r,
+                                     Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    typename base::per_run_storage run_storage{};
+
+    auto begin = storage.begin();
+    auto end = storage.end();
+    if (begin != end) {
+#pragma omp parallel
+      {
+        for (auto iter = begin; iter != end; ++iter) {
+          value_type::host_call(&*iter, r, args...);
+        }
+      }
+    }
+
+    return run_storage;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
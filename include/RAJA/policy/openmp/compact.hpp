@@ -0,0 +1,332 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_openmp_HPP
+#define RAJA_compact_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace detail
+{
+
+/*!
+        \brief copy the items begin[i] for which flag(i) is true to the front
+   of out, and if Partition the other items to the back of out in reverse
+   order, returns the number of selected items
+
+   Each thread counts the selected items of its chunk, the counts are
+   scanned, and each thread then writes the items of its chunk starting at
+   its offset.
+*/
+template <bool Partition,
+          typename Iter,
+          typename OutIter,
+          typename DistanceT,
+          typename Flag>
+RAJA_INLINE
+DistanceT
+select(Iter begin, DistanceT n, OutIter out, Flag flag)
+{
+  using RAJA::detail::firstIndex;
+  if (n <= 0) {
+    return 0;
+  }
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<DistanceT> offsets(p0 + 1, 0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+
+    DistanceT count = 0;
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      count += flag(i) ? 1 : 0;
+    }
+    offsets[pid + 1] = count;
+
+#pragma omp barrier
+#pragma omp single
+    for (int t = 0; t < p0; ++t) {
+      offsets[t + 1] += offsets[t];
+    }
+
+    DistanceT selected = offsets[pid];
+    DistanceT rejected = idx_begin - selected;
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      if (flag(i)) {
+        out[selected++] = begin[i];
+      } else if (Partition) {
+        out[n - 1 - rejected++] = begin[i];
+      }
+    }
+  }
+  return offsets[p0];
+}
+
+/*!
+        \brief reduce the values of each run of equal keys with op, writing
+   the key and reduced value of each run to the front of out_keys and
+   out_values, returns the number of runs
+
+   Each thread counts the run heads of its chunk and the counts are scanned.
+   Each thread then reduces the runs that start in its chunk up to the end of
+   its chunk, and the values before its first head into a carry. The carries
+   are folded into the runs they continue in thread order, so no atomics are
+   used and the order op is applied in is fixed.
+*/
+template <typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename DistanceT,
+          typename BinaryOp>
+RAJA_INLINE
+DistanceT
+reduce_by_key(KeyIter keys,
+              ValueIter values,
+              DistanceT n,
+              OutKeyIter out_keys,
+              OutValueIter out_values,
+              BinaryOp op)
+{
+  using RAJA::detail::firstIndex;
+  using ValueT = RAJA::detail::IterVal<ValueIter>;
+  if (n <= 0) {
+    return 0;
+  }
+  auto is_head = [=](DistanceT i) {
+    return i == 0 || !(keys[i - 1] == keys[i]);
+  };
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<DistanceT> offsets(p0 + 1, 0);
+  ::std::vector<ValueT> carry(p0);
+  ::std::vector<char> has_carry(p0, 0);
+  int num_threads = p0;
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+
+    DistanceT count = 0;
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      count += is_head(i) ? 1 : 0;
+    }
+    offsets[pid + 1] = count;
+
+#pragma omp barrier
+#pragma omp single
+    {
+      num_threads = p;
+      for (int t = 0; t < p; ++t) {
+        offsets[t + 1] += offsets[t];
+      }
+    }
+
+    DistanceT i = idx_begin;
+    if (i < idx_end && !is_head(i)) {
+      ValueT sum = values[i];
+      for (++i; i < idx_end && !is_head(i); ++i) {
+        sum = op(sum, values[i]);
+      }
+      carry[pid] = sum;
+      has_carry[pid] = 1;
+    }
+    DistanceT seg = offsets[pid] - 1;
+    for (; i < idx_end; ++i) {
+      if (is_head(i)) {
+        ++seg;
+        out_keys[seg] = keys[i];
+        out_values[seg] = values[i];
+      } else {
+        out_values[seg] = op(out_values[seg], values[i]);
+      }
+    }
+  }
+
+  for (int t = 1; t < num_threads; ++t) {
+    if (has_carry[t]) {
+      const DistanceT seg = offsets[t] - 1;
+      out_values[seg] = op(out_values[seg], carry[t]);
+    }
+  }
+  return offsets[num_threads];
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit copy if given input range, output, count output, and
+   predicate
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+copy_if(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  *num_selected = static_cast<CountT>(detail::select<false>(
+      begin, n, out,
+      [=](DistanceT i) { return static_cast<bool>(pred(begin[i])); }));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit partition given input range, output, count output, and
+   predicate
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+partition(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  *num_selected = static_cast<CountT>(detail::select<true>(
+      begin, n, out,
+      [=](DistanceT i) { return static_cast<bool>(pred(begin[i])); }));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit unique given input range, output, count output, and
+   equality function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+unique(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Compare eq)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  *num_selected = static_cast<CountT>(detail::select<false>(
+      begin, n, out,
+      [=](DistanceT i) { return i == 0 || !eq(begin[i - 1], begin[i]); }));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit reduce by key given key and value input ranges, key
+   and value outputs, count output, and reduction function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename CountIter,
+          typename BinaryOp>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const KeyIter keys_begin,
+    const KeyIter keys_end,
+    const ValueIter values,
+    OutKeyIter out_keys,
+    OutValueIter out_values,
+    CountIter num_segments,
+    BinaryOp op)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(keys_begin, keys_end);
+
+  *num_segments = static_cast<CountT>(detail::reduce_by_key(
+      keys_begin, values, n, out_keys, out_values, op));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
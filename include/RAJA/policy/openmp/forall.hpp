@@ -25,13 +25,20 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/internal/WorkStealingDeque.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
@@ -39,6 +46,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -67,7 +75,7 @@ forall_impl(resources::Host host_res,
             Func&& loop_body,
             ForallParam f_params)
 {
-  RAJA::region<RAJA::omp_parallel_region>([&]() {
+  internal::team_region([&]() {
     using RAJA::internal::thread_privatize;
     auto body = thread_privatize(loop_body);
     forall_impl(host_res, InnerPolicy{}, iter, body.get_priv(), f_params);
@@ -76,6 +84,28 @@ forall_impl(resources::Host host_res,
 }
 
 
+//
+// Without params there is nothing to prefetch
+//
+template <typename Iterable, typename Func, typename ForallParam, int Distance>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_parallel_for_exec_prefetch<Distance>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  return forall_impl(host_res,
+                     omp_parallel_for_static_exec<>{},
+                     std::forward<Iterable>(iter),
+                     std::forward<Func>(loop_body),
+                     f_params);
+}
+
 ///
 /// OpenMP parallel for schedule policy implementation
 ///
@@ -93,7 +123,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -109,7 +139,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(static)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -125,7 +155,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(static, ChunkSize)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -141,7 +171,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(dynamic)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -157,7 +187,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(dynamic, ChunkSize)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -173,7 +203,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(guided)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -189,7 +219,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(guided, ChunkSize)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -204,7 +234,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(runtime)
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -239,7 +269,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for nowait
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -255,7 +285,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(static) nowait
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -271,7 +301,7 @@ namespace internal
                                Iterable&& iter,
                                Func&& loop_body)
   {
-    RAJA_EXTRACT_BED_IT(iter);
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
     #pragma omp for schedule(static, ChunkSize) nowait
     for (decltype(distance_it) i = 0; i < distance_it; ++i) {
       loop_body(begin_it[i]);
@@ -329,6 +359,179 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+namespace expt
+{
+namespace internal
+{
+
+  //
+  // Inside a RAJA::region the params can not be an OpenMP reduction list
+  // item, which must be shared by the team. Each thread reduces into its
+  // own copy of the params over its iterates of an orphaned omp for, and
+  // the copies are resolved into the targets one thread at a time.
+  //
+  template <typename Schedule, typename Iterable, typename Func, typename ForallParam>
+  RAJA_INLINE void region_forall_impl(const Schedule& p,
+                                      Iterable&& iter,
+                                      Func&& loop_body,
+                                      ForallParam&& f_params)
+  {
+    using EXEC_POL = typename std::decay<decltype(p)>::type;
+    auto thread_params = f_params;
+    RAJA::expt::ParamMultiplexer::init<EXEC_POL>(thread_params);
+
+    ::RAJA::policy::omp::internal::forall_impl(
+        p, std::forward<Iterable>(iter), [&](auto&& i) {
+          RAJA::expt::invoke_body(thread_params, loop_body, i);
+        });
+
+#pragma omp critical(ompRegionParamsCritical)
+    RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(thread_params);
+#pragma omp barrier
+  }
+
+} // namespace internal
+} // namespace expt
+
+///
+/// OpenMP taskloop policy implementation
+///
+
+namespace internal
+{
+
+  //
+  // omp taskloop, each task runs a copy of the loop body
+  //
+  template <int GrainSize, typename Iterable, typename Func,
+    typename std::enable_if<(GrainSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_taskloop(Iterable&& iter, Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
+    camp::decay<Func> body = loop_body;
+    #pragma omp taskloop firstprivate(body)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp taskloop grainsize(GrainSize)
+  //
+  template <int GrainSize, typename Iterable, typename Func,
+    typename std::enable_if<(GrainSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_taskloop(Iterable&& iter, Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
+    camp::decay<Func> body = loop_body;
+    #pragma omp taskloop grainsize(GrainSize) firstprivate(body)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp taskloop with a task reduction of the forall params
+  //
+  template <int GrainSize, typename Iterable, typename Func, typename ForallParam,
+    typename std::enable_if<(GrainSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_taskloop(Iterable&& iter,
+                                        Func&& loop_body,
+                                        ForallParam& f_params)
+  {
+    using EXEC_POL = omp_taskloop_exec<GrainSize>;
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
+    camp::decay<Func> body = loop_body;
+    #pragma omp taskloop firstprivate(body) reduction(combine : f_params)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      RAJA::expt::invoke_body(f_params, body, begin_it[i]);
+    }
+  }
+
+  //
+  // omp taskloop grainsize(GrainSize) with a task reduction of the forall
+  // params
+  //
+  template <int GrainSize, typename Iterable, typename Func, typename ForallParam,
+    typename std::enable_if<(GrainSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_taskloop(Iterable&& iter,
+                                        Func&& loop_body,
+                                        ForallParam& f_params)
+  {
+    using EXEC_POL = omp_taskloop_exec<GrainSize>;
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+    RAJA_EXTRACT_BED_LOOP_IT(iter);
+    camp::decay<Func> body = loop_body;
+    #pragma omp taskloop grainsize(GrainSize) firstprivate(body) \
+        reduction(combine : f_params)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      RAJA::expt::invoke_body(f_params, body, begin_it[i]);
+    }
+  }
+
+  //
+  // Tasks need a team to run them, outside of a parallel region make one
+  // and generate the tasks on one of its threads. Inside a parallel region
+  // the forall must be called by one thread, e.g. from a task or a single.
+  //
+  template <typename Func>
+  RAJA_INLINE void taskloop_region(Func&& f)
+  {
+    if (omp_in_parallel()) {
+      f();
+    } else {
+      #pragma omp parallel
+      #pragma omp single
+      f();
+    }
+  }
+
+} // end namespace internal
+
+template <int GrainSize, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskloop_exec<GrainSize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  internal::taskloop_region([&]() {
+    internal::forall_impl_taskloop<GrainSize>(iter, loop_body);
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <int GrainSize, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_taskloop_exec<GrainSize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = omp_taskloop_exec<GrainSize>;
+  RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+  internal::taskloop_region([&]() {
+    internal::forall_impl_taskloop<GrainSize>(iter, loop_body, f_params);
+  });
+
+  RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -401,10 +604,163 @@ RAJA_INLINE void forall(
 }
 */
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments as their dependencies in a
+ *         segment dependency graph are satisfied. Individual segment
+ *         execution will use execution policy template parameter.
+ *
+ *         graph holds a DepGraphNode for each segment in the index set,
+ *         segments whose semaphore value is zero are ready to run. Each
+ *         thread keeps a deque of ready segments and pushes a segment when
+ *         it satisfies its last dependency, idle threads steal ready
+ *         segments from the other threads.
+ *
+ ******************************************************************************
+ */
+template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename... SEG_TYPES>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_taskgraph(
+    resources::Host host_res,
+    ExecPolicy<omp_taskgraph_steal_segit, SEG_EXEC_POLICY_T>,
+    const TypedIndexSet<SEG_TYPES...>& iset,
+    DepGraphNode* graph,
+    LOOP_BODY loop_body)
+{
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  if (num_seg == 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+
+  // walk the graph in dependency order first, the threads would wait forever
+  // for a segment no root segment leads to, e.g. one on a cycle
+  {
+    std::vector<int> waiting(num_seg);
+    std::vector<int> order;
+    order.reserve(num_seg);
+    for (int isi = 0; isi < num_seg; ++isi) {
+      waiting[isi] = graph[isi].semaphoreValue().load();
+      if (waiting[isi] == 0) {
+        order.push_back(isi);
+      }
+    }
+    if (order.empty()) {
+      std::cerr << "\n RAJA forall_taskgraph: no segment without "
+                << "dependencies, FILE: " << __FILE__ << " line: " << __LINE__
+                << std::endl;
+      RAJA_ABORT_OR_THROW("forall_taskgraph dependency graph has no root");
+    }
+    for (size_t o = 0; o < order.size(); ++o) {
+      DepGraphNode& task = graph[order[o]];
+      for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+        const int dep = task.depTaskNum(ii);
+        if (dep < 0 || dep >= num_seg) {
+          std::cerr << "\n RAJA forall_taskgraph: segment " << order[o]
+                    << " has dependent segment " << dep << " out of range, "
+                    << "FILE: " << __FILE__ << " line: " << __LINE__
+                    << std::endl;
+          RAJA_ABORT_OR_THROW("forall_taskgraph dependent segment out of range");
+        }
+        if (--waiting[dep] == 0) {
+          order.push_back(dep);
+        }
+      }
+    }
+    if (static_cast<int>(order.size()) != num_seg) {
+      std::cerr << "\n RAJA forall_taskgraph: "
+                << num_seg - static_cast<int>(order.size())
+                << " segments can never run, the dependency graph has a cycle "
+                << "or semaphore values above their number of dependencies, "
+                << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+      RAJA_ABORT_OR_THROW("forall_taskgraph dependency graph has a cycle");
+    }
+  }
+
+  const int num_threads = std::min(num_seg, omp_get_max_threads());
+
+  // each segment is made ready once, so no deque holds more than num_seg
+  std::vector<std::unique_ptr<WorkStealingDeque<int>>> ready(num_threads);
+  for (auto& deque : ready) {
+    deque.reset(new WorkStealingDeque<int>(num_seg));
+  }
+
+  int next_thread = 0;
+  for (int isi = 0; isi < num_seg; ++isi) {
+    if (graph[isi].semaphoreValue() == 0) {
+      ready[next_thread]->push(isi);
+      next_thread = (next_thread + 1) % num_threads;
+    }
+  }
+
+  auto f_params = expt::get_empty_forall_param_pack();
+  std::atomic<int> remaining(num_seg);
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    const int tid = omp_get_thread_num();
+    WorkStealingDeque<int>& my_ready = *ready[tid];
+
+    while (remaining.load() > 0) {
+      int isi;
+      bool found = my_ready.pop(isi);
+      for (int victim = 1; !found && victim < num_threads; ++victim) {
+        found = ready[(tid + victim) % num_threads]->steal(isi);
+      }
+      if (!found) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      iset.segmentCall(isi,
+                       RAJA::detail::CallForall{},
+                       SEG_EXEC_POLICY_T(),
+                       loop_body,
+                       host_res,
+                       f_params);
+
+      DepGraphNode& task = graph[isi];
+      task.reset();
+      for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+        const int dep = task.depTaskNum(ii);
+        if (graph[dep].satisfyOne()) {
+          my_ready.push(dep);
+        }
+      }
+
+      --remaining;
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace omp
 
 }  // namespace policy
 
+using policy::omp::forall_taskgraph;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Dependency graph index set traversal using the default host
+ *         resource.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename... SEG_TYPES, typename LOOP_BODY>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_taskgraph(
+    const TypedIndexSet<SEG_TYPES...>& iset,
+    DepGraphNode* graph,
+    LOOP_BODY loop_body)
+{
+  return forall_taskgraph(resources::Host::get_default(),
+                          ExecutionPolicy(),
+                          iset,
+                          graph,
+                          loop_body);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
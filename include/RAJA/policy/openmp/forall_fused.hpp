@@ -0,0 +1,92 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA fused forall for OpenMP.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_fused_openmp_HPP
+#define RAJA_forall_fused_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace fused
+{
+
+/*!
+ * Run the part of a loop assigned to this thread, without waiting for the
+ * other threads at the end.
+ */
+template <typename Schedule, typename Segment, typename LoopBody>
+RAJA_INLINE void forall_fused_omp_loop(Segment& seg, LoopBody& loop_body)
+{
+  using RAJA::internal::thread_privatize;
+  auto body = thread_privatize(loop_body);
+  ::RAJA::policy::omp::internal::forall_impl_nowait(Schedule{},
+                                                    seg,
+                                                    body.get_priv());
+}
+
+/*!
+        \brief fused forall for OpenMP parallel for policies, runs the loops
+   as nowait loops in one parallel region, so a thread done with its part of
+   a loop starts on the next loop
+*/
+template <typename Schedule,
+          typename Segments,
+          typename Bodies,
+          camp::idx_t... Is>
+RAJA_INLINE
+resources::EventProxy<resources::Host>
+forall_fused(
+    resources::Host host_res,
+    const ::RAJA::policy::omp::omp_parallel_exec<
+        ::RAJA::policy::omp::omp_for_schedule_exec<Schedule>>&,
+    Segments& segs,
+    Bodies& bodies,
+    camp::idx_seq<Is...>)
+{
+  ::RAJA::policy::omp::internal::team_region([&]() {
+    int unused[] = {0, (forall_fused_omp_loop<Schedule>(camp::get<Is>(segs),
+                                                        camp::get<Is>(bodies)),
+                        0)...};
+    RAJA_UNUSED_VAR(unused);
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace fused
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -31,6 +31,7 @@
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 namespace RAJA
 {
@@ -70,6 +71,24 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
     using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
 
     using RAJA::internal::thread_privatize;
+    if (RAJA::policy::omp::internal::region_active()) {
+      // every thread of the region's team has its own privatizer
+      {
+        auto privatizer = thread_privatize(data);
+#pragma omp for RAJA_COLLAPSE(2)
+        for (i0 = 0; i0 < l0; ++i0) {
+          for (i1 = 0; i1 < l1; ++i1) {
+            auto& private_data = privatizer.get_priv();
+            private_data.template assign_offset<Arg0>(i0);
+            private_data.template assign_offset<Arg1>(i1);
+            execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+          }
+        }
+      }
+#pragma omp barrier
+      return;
+    }
+
     auto privatizer = thread_privatize(data);
 #pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
     RAJA_COLLAPSE(2)
@@ -111,6 +130,27 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
     using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
 
     using RAJA::internal::thread_privatize;
+    if (RAJA::policy::omp::internal::region_active()) {
+      // every thread of the region's team has its own privatizer
+      {
+        auto privatizer = thread_privatize(data);
+#pragma omp for RAJA_COLLAPSE(3)
+        for (i0 = 0; i0 < l0; ++i0) {
+          for (i1 = 0; i1 < l1; ++i1) {
+            for (i2 = 0; i2 < l2; ++i2) {
+              auto& private_data = privatizer.get_priv();
+              private_data.template assign_offset<Arg0>(i0);
+              private_data.template assign_offset<Arg1>(i1);
+              private_data.template assign_offset<Arg2>(i2);
+              execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+            }
+          }
+        }
+      }
+#pragma omp barrier
+      return;
+    }
+
     auto privatizer = thread_privatize(data);
 #pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
     RAJA_COLLAPSE(3)
@@ -20,6 +20,7 @@
 
 #include "RAJA/pattern/launch/launch_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/params/forall.hpp"
 
 
 namespace RAJA
@@ -50,6 +51,39 @@ struct LaunchExecute<RAJA::omp_launch_t> {
     return resources::EventProxy<resources::Resource>(res);
   }
 
+  template <typename BODY, typename ReduceParams>
+  static concepts::enable_if_t<resources::EventProxy<resources::Resource>,
+                               RAJA::expt::type_traits::is_ForallParamPack<ReduceParams>,
+                               concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ReduceParams>>>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *, BODY const &body, ReduceParams &f_params)
+  {
+    using EXEC_POL = RAJA::omp_launch_t;
+    RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+    RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+    // each thread reduces into its own copy of the params, which are
+    // combined at the end of the region
+    #pragma omp parallel reduction(combine : f_params)
+    {
+        LaunchContext ctx;
+
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+
+        ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+
+        RAJA::expt::invoke_body(f_params, loop_body.get_priv(), ctx);
+
+        free(ctx.shared_mem_ptr);
+        ctx.shared_mem_ptr = nullptr;
+    }
+
+    RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
 };
 
 
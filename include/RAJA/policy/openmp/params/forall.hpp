@@ -11,8 +11,8 @@
 #define RAJA_OMP_DECLARE_REDUCTION_COMBINE \
       _Pragma(" omp declare reduction( combine \
         : typename std::remove_reference<decltype(f_params)>::type \
-        : RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(omp_out, omp_in) ) ")\
-        //initializer(omp_priv = omp_in) ")
+        : RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(omp_out, omp_in) ) \
+        initializer(omp_priv = omp_orig) ")
 
 namespace RAJA
 {
@@ -26,6 +26,15 @@ namespace expt
 
   namespace internal
   {
+    //
+    // Run by the team of a RAJA::region, defined with the omp for loops
+    //
+    template <typename Schedule, typename Iterable, typename Func, typename ForallParam>
+    RAJA_INLINE void region_forall_impl(const Schedule& p,
+                                        Iterable&& iter,
+                                        Func&& loop_body,
+                                        ForallParam&& f_params);
+
     //
     // omp for (Auto)
     //
@@ -300,7 +309,11 @@ namespace expt
                                                                  Func&& loop_body,
                                                                  ForallParam f_params)
   {
-    expt::internal::forall_impl(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body), std::forward<ForallParam>(f_params));
+    if (::RAJA::policy::omp::internal::region_active()) {
+      expt::internal::region_forall_impl(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body), f_params);
+    } else {
+      expt::internal::forall_impl(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body), std::forward<ForallParam>(f_params));
+    }
     return resources::EventProxy<resources::Host>(host_res);
   }
 } //  namespace expt
@@ -324,6 +337,37 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP parallel for with software prefetch, the static schedule keeps
+/// the iterations Distance ahead of a thread mostly in its own chunk
+///
+template <typename Iterable, typename Func, typename ForallParam, int Distance>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_parallel_for_exec_prefetch<Distance>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = omp_parallel_for_exec_prefetch<Distance>;
+  RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+  RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+  RAJA_EXTRACT_BED_IT(iter);
+  #pragma omp parallel for schedule(static) reduction(combine : f_params)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    RAJA::expt::prefetch_ahead<Distance>(f_params, begin_it, i, distance_it);
+    RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+  }
+
+  RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace omp
 
 }  // namespace policy
@@ -30,6 +30,34 @@ namespace detail {
     *red.target = OP{}(red.val, *red.target);
   }
 
+  //
+  // MultiReducer, the threads share the bins and combine into their own
+  // slice of them, so there is nothing to combine between threads.
+  //
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  init(MultiReducer<OP, T>& red) {
+    red.bins.num_slices = omp_get_max_threads();
+    red.bins.data = new T[red.bins.num_slices * red.bins.num_bins];
+    red.fill_slices(red.bins.data, red.bins.num_slices);
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  combine(MultiReducer<OP, T>&, const MultiReducer<OP, T>&) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  resolve(MultiReducer<OP, T>& red) {
+    red.resolve_slices(red.bins.data, red.bins.num_slices);
+    delete[] red.bins.data;
+    red.bins.data = nullptr;
+  }
+
 #endif
 
 } //  namespace detail
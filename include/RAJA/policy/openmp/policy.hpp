@@ -224,6 +224,32 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 ///
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
+///
+///  'omp parallel for schedule(static)' that prefetches the elements the
+///  views of a RAJA::expt::Prefetch param gather Distance iterations ahead
+///  of each thread
+///
+template <int Distance>
+struct omp_parallel_for_exec_prefetch : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                                              Pattern::forall,
+                                                                              Launch::undefined,
+                                                                              Platform::host> {
+  static_assert(Distance > 0, "Prefetch distance must be positive");
+};
+
+///
+///  Struct supporting OpenMP 'taskloop grainsize( )', the loop runs as tasks
+///  so foralls issued from tasks or other parallel code compose with it
+///  without creating nested parallel regions. A GrainSize <= 0 leaves the
+///  grain size to the implementation.
+///
+template <int GrainSize = 0>
+struct omp_taskloop_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                                 Pattern::forall,
+                                                                 Launch::undefined,
+                                                                 Platform::host> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -254,6 +280,14 @@ struct omp_taskgraph_interval_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
 };
 
+///
+/// Runs segments as their dependencies are satisfied using a work-stealing
+/// deque of ready segments per thread, see RAJA::forall_taskgraph.
+///
+struct omp_taskgraph_steal_segit
+    : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -268,6 +302,17 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+/// WorkGroup order policy that runs all of the loops in one omp parallel
+/// region with each loop run as an 'omp for nowait', threads move on to the
+/// next loop without waiting for the other threads to finish the last one
+///
+struct unordered_omp_for_nowait
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -321,6 +366,7 @@ using policy::omp::omp_atomic;
 /// Type aliases to simplify common omp parallel for loop execution
 ///
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_exec_prefetch;
 ///
 using policy::omp::omp_parallel_for_static_exec;
 ///
@@ -330,12 +376,19 @@ using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
 
+///
+/// Type alias for 'omp taskloop'
+///
+using policy::omp::omp_taskloop_exec;
+
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
 ///
 using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
+///
+using policy::omp::omp_taskgraph_steal_segit;
 
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
@@ -397,6 +450,7 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+using policy::omp::unordered_omp_for_nowait;
 
 }  // namespace RAJA
 
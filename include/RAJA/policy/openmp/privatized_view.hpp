@@ -0,0 +1,169 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the OpenMP PrivatizedViewWrapper.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_omp_privatized_view_HPP
+#define RAJA_omp_privatized_view_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/util/PrivatizedView.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Private blocks of the data of a View, one row of lazily allocated blocks
+ * per OpenMP thread. Each thread only allocates and writes the blocks of
+ * its own row, so no synchronization is needed until the merge.
+ */
+template <typename T>
+class OmpPrivatizedBlocks
+{
+public:
+  OmpPrivatizedBlocks(T *target, Index_type size, Index_type block_size)
+      : m_target(target), m_size(size), m_shift(0)
+  {
+    while ((Index_type(1) << m_shift) < block_size) {
+      ++m_shift;
+    }
+    m_num_blocks = (m_size + block_mask()) >> m_shift;
+    m_num_threads = omp_get_max_threads();
+    m_blocks.resize(static_cast<size_t>(m_num_threads * m_num_blocks),
+                    nullptr);
+  }
+
+  OmpPrivatizedBlocks(OmpPrivatizedBlocks const &) = delete;
+  OmpPrivatizedBlocks &operator=(OmpPrivatizedBlocks const &) = delete;
+
+  ~OmpPrivatizedBlocks() { merge(); }
+
+  //! private element idx of the calling thread
+  RAJA_INLINE T &at(Index_type idx)
+  {
+    const Index_type thread = omp_get_thread_num();
+    if (thread >= m_num_threads) {
+      RAJA_ABORT_OR_THROW(
+          "PrivatizedViewWrapper used by more threads than "
+          "omp_get_max_threads() when it was made");
+    }
+    T *&block = m_blocks[static_cast<size_t>(thread * m_num_blocks +
+                                             (idx >> m_shift))];
+    if (block == nullptr) {
+      block = new T[static_cast<size_t>(block_mask() + 1)]();
+    }
+    return block[idx & block_mask()];
+  }
+
+  //! add the private blocks to the target, a block at a time in parallel
+  void merge()
+  {
+    const Index_type num_blocks = m_num_blocks;
+#pragma omp parallel for schedule(static)
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      const Index_type begin = b << m_shift;
+      const Index_type len = m_size - begin < block_mask() + 1
+                                 ? m_size - begin
+                                 : block_mask() + 1;
+      T *target = m_target + begin;
+      for (Index_type t = 0; t < m_num_threads; ++t) {
+        T *&block = m_blocks[static_cast<size_t>(t * num_blocks + b)];
+        if (block != nullptr) {
+          for (Index_type i = 0; i < len; ++i) {
+            target[i] += block[i];
+          }
+          delete[] block;
+          block = nullptr;
+        }
+      }
+    }
+  }
+
+private:
+  Index_type block_mask() const { return (Index_type(1) << m_shift) - 1; }
+
+  T *m_target;
+  Index_type m_size;
+  Index_type m_shift;
+  Index_type m_num_blocks;
+  Index_type m_num_threads;
+  std::vector<T *> m_blocks;
+};
+
+}  // namespace detail
+
+/*!
+ * PrivatizedViewWrapper for omp_reduce, each OpenMP thread adds into its
+ * own lazily allocated blocks and merge() adds the blocks of all threads
+ * to the View in parallel.
+ */
+template <typename ViewType>
+struct PrivatizedViewWrapper<ViewType, RAJA::omp_reduce> {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using nc_value_type = typename std::remove_const<value_type>::type;
+
+  static_assert(std::is_same<pointer_type, nc_value_type *>::value,
+                "PrivatizedViewWrapper requires a View of a plain pointer");
+
+  base_type base_;
+  std::shared_ptr<detail::OmpPrivatizedBlocks<nc_value_type>> blocks_;
+
+  RAJA_INLINE
+  explicit PrivatizedViewWrapper(ViewType const &view,
+                                 Index_type block_size = 4096)
+      : base_{view},
+        blocks_{std::make_shared<detail::OmpPrivatizedBlocks<nc_value_type>>(
+            view.get_data(),
+            static_cast<Index_type>(view.size()),
+            block_size)}
+  {
+  }
+
+  template <typename... ARGS>
+  RAJA_INLINE nc_value_type &operator()(ARGS &&... args) const
+  {
+    const Index_type idx = static_cast<Index_type>(
+        &base_.operator()(std::forward<ARGS>(args)...) - base_.get_data());
+    return blocks_->at(idx);
+  }
+
+  //! add the private copies of all threads to the View
+  RAJA_INLINE void merge() const { blocks_->merge(); }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -8,6 +8,19 @@
 #ifndef RAJA_region_openmp_HPP
 #define RAJA_region_openmp_HPP
 
+#include "RAJA/config.hpp"
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -15,6 +28,124 @@ namespace policy
 namespace omp
 {
 
+namespace internal
+{
+
+/*!
+ * \brief True on the threads of the team running the body of a
+ *        RAJA::region<omp_parallel_region>.
+ *
+ * Every thread of the team runs the body, so OpenMP foralls, reductions,
+ * scans and kernels called from it use the team with orphaned worksharing
+ * instead of opening nested parallel regions.
+ */
+RAJA_INLINE bool& region_active()
+{
+  static thread_local bool active = false;
+  return active;
+}
+
+/*!
+ * \brief State the threads of a RAJA::region share, for region_barrier and
+ *        region_reduce.
+ */
+class RegionTeam
+{
+public:
+  //! largest value region_reduce combines, a cache line
+  static constexpr size_t max_value_bytes = 64;
+
+  explicit RegionTeam(int max_threads)
+      : m_barrier(max_threads),
+        m_slots(new slot[2 * max_threads]),
+        m_counts(new count[max_threads])
+  {
+  }
+
+  void barrier() { m_barrier.arrive_and_wait(); }
+
+  /*!
+   * Each thread writes val to its slot and, after the barrier, combines the
+   * slots of all threads in thread order, so every thread gets the same
+   * result. Reduces alternate between two sets of slots, a set is written
+   * again only after the barrier of the next reduce, when all threads have
+   * read it.
+   */
+  template <typename T, typename Op>
+  T reduce(T const& val, Op op)
+  {
+    static_assert(sizeof(T) <= max_value_bytes,
+                  "region_reduce values must fit in a cache line");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "region_reduce values must be trivially copyable");
+
+    const int p = omp_get_num_threads();
+    const int t = omp_get_thread_num();
+    slot* slots =
+        m_slots.get() + (m_counts[t].value++ % 2) * m_barrier.max_threads();
+    std::memcpy(slots[t].bytes, &val, sizeof(T));
+
+    m_barrier.arrive_and_wait();
+
+    T result;
+    std::memcpy(&result, slots[0].bytes, sizeof(T));
+    for (int i = 1; i < p; ++i) {
+      T other;
+      std::memcpy(&other, slots[i].bytes, sizeof(T));
+      result = op(result, other);
+    }
+    return result;
+  }
+
+private:
+  struct alignas(64) slot {
+    unsigned char bytes[max_value_bytes];
+  };
+
+  struct alignas(64) count {
+    unsigned value = 0;
+  };
+
+  ::RAJA::omp::barrier m_barrier;
+  std::unique_ptr<slot[]> m_slots;
+  std::unique_ptr<count[]> m_counts;
+};
+
+//! RegionTeam of the region the thread runs, or nullptr
+RAJA_INLINE RegionTeam*& region_team()
+{
+  static thread_local RegionTeam* team = nullptr;
+  return team;
+}
+
+/*!
+ * \brief Run body on a team of threads, the team of the enclosing
+ *        RAJA::region if there is one, or a new parallel region.
+ *
+ * In a region every thread of the team runs body, then waits at a barrier
+ * for the others, so the work and the combines of the copies of body are
+ * done when any thread returns, as at the end of a parallel region.
+ */
+template <typename Func>
+RAJA_INLINE void team_region(Func &&body)
+{
+  if (region_active()) {
+    {
+      auto loopbody = body;
+      loopbody();
+    }
+#pragma omp barrier
+  } else {
+#pragma omp parallel
+    {
+      auto loopbody = body;
+      loopbody();
+    }
+  }
+}
+
+}  // namespace internal
+
 /*!
  * \brief RAJA::region implementation for OpenMP.
  *
@@ -30,6 +161,13 @@ namespace omp
  *
  * \endcode
  *
+ * OpenMP loops, omp_reduce and expt::Reduce reductions, scans and kernels
+ * in the body run on the team of the region with orphaned worksharing. Like
+ * omp_for_nowait_exec loops they must be called by every thread of the
+ * team, not from inside a loop body. A region in the body of a region uses
+ * the team of the outer one. RAJA::region_barrier and RAJA::region_reduce
+ * synchronize and combine values between the threads of the team.
+ *
  * \tparam Policy region policy
  *
  */
@@ -37,12 +175,24 @@ namespace omp
 template <typename Func>
 RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
 {
+  if (internal::region_active()) {
+    internal::team_region(body);
+    return;
+  }
+
+  internal::RegionTeam team(omp_get_max_threads());
 
 #pragma omp parallel
     { // curly brackets to ensure body() is encapsulated in omp parallel region
-      //thread private copy of body
-      auto loopbody = body;
-      loopbody();
+      internal::region_active() = true;
+      internal::region_team() = &team;
+      {
+        //thread private copy of body
+        auto loopbody = body;
+        loopbody();
+      }
+      internal::region_team() = nullptr;
+      internal::region_active() = false;
     }
 }
 
@@ -29,6 +29,7 @@
 #include <omp.h>
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -39,9 +40,105 @@ namespace impl
 namespace scan
 {
 
+namespace detail
+{
+
+/*!
+        \brief inclusive inplace scan by the threads of a team, sums has an
+   item per thread of the team
+*/
+template <typename Iter, typename BinFn, typename Value>
+RAJA_INLINE void omp_inclusive_inplace_team(resources::Host host_res,
+                                            Iter begin,
+                                            Iter end,
+                                            BinFn f,
+                                            Value* sums)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p = omp_get_num_threads();
+  const int pid = omp_get_thread_num();
+  const DistanceT idx_begin = firstIndex(n, p, pid);
+  const DistanceT idx_end = firstIndex(n, p, pid + 1);
+  sums[pid] = BinFn::identity();
+  if (idx_begin != idx_end) {
+    inclusive_inplace(host_res, ::RAJA::loop_exec{},
+                      begin + idx_begin, begin + idx_end, f);
+    sums[pid] = begin[idx_end - 1];
+  }
+#pragma omp barrier
+#pragma omp single
+  exclusive_inplace(host_res, ::RAJA::loop_exec{},
+                    sums, sums + p, f, BinFn::identity());
+  for (auto i = idx_begin; i < idx_end; ++i) {
+    begin[i] = f(begin[i], sums[pid]);
+  }
+}
+
+/*!
+        \brief exclusive inplace scan by the threads of a team, sums has an
+   item per thread of the team
+*/
+template <typename Iter, typename BinFn, typename ValueT, typename Value>
+RAJA_INLINE void omp_exclusive_inplace_team(resources::Host host_res,
+                                            Iter begin,
+                                            Iter end,
+                                            BinFn f,
+                                            ValueT v,
+                                            Value* sums)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p = omp_get_num_threads();
+  const int pid = omp_get_thread_num();
+  const DistanceT idx_begin = firstIndex(n, p, pid);
+  const DistanceT idx_end = firstIndex(n, p, pid + 1);
+  const Value init =
+      ((pid == 0 || idx_begin == idx_end) ? v : *(begin + idx_begin - 1));
+  sums[pid] = BinFn::identity();
+#pragma omp barrier
+  if (idx_begin != idx_end) {
+    exclusive_inplace(host_res, loop_exec{},
+                      begin + idx_begin, begin + idx_end, f, init);
+    sums[pid] = begin[idx_end - 1];
+  }
+#pragma omp barrier
+#pragma omp single
+  exclusive_inplace(host_res, loop_exec{},
+                    sums, sums + p, f, BinFn::identity());
+  for (auto i = idx_begin; i < idx_end; ++i) {
+    begin[i] = f(begin[i], sums[pid]);
+  }
+}
+
+/*!
+        \brief run scan on the team of the enclosing RAJA::region, with an
+   item of shared storage per thread allocated by one of them
+*/
+template <typename Value, typename Scan>
+RAJA_INLINE void omp_region_scan(Scan&& scan)
+{
+  Value* sums = nullptr;
+#pragma omp single copyprivate(sums)
+  sums = new Value[omp_get_num_threads()];
+  scan(sums);
+#pragma omp barrier
+#pragma omp single
+  delete[] sums;
+}
+
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
+
+   Inside a RAJA::region the threads of its team scan with no new parallel
+   region.
 */
 template <typename Policy, typename Iter, typename BinFn>
 RAJA_INLINE
@@ -55,31 +152,19 @@ inclusive_inplace(
     BinFn f)
 {
   using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
+  if (::RAJA::policy::omp::internal::region_active()) {
+    detail::omp_region_scan<Value>([&](Value* sums) {
+      detail::omp_inclusive_inplace_team(host_res, begin, end, f, sums);
+    });
+    return resources::EventProxy<resources::Host>(host_res);
+  }
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
   const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
   ::std::vector<Value> sums(p0, Value());
 #pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    if (idx_begin != idx_end) {
-      inclusive_inplace(host_res, ::RAJA::loop_exec{},
-                        begin + idx_begin, begin + idx_end, f);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, ::RAJA::loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  detail::omp_inclusive_inplace_team(host_res, begin, end, f, sums.data());
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -87,6 +172,9 @@ inclusive_inplace(
 /*!
         \brief explicit exclusive inplace scan given range, function, and
    initial value
+
+   Inside a RAJA::region the threads of its team scan with no new parallel
+   region.
 */
 template <typename Policy, typename Iter, typename BinFn, typename ValueT>
 RAJA_INLINE
@@ -101,33 +189,19 @@ exclusive_inplace(
     ValueT v)
 {
   using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
+  if (::RAJA::policy::omp::internal::region_active()) {
+    detail::omp_region_scan<Value>([&](Value* sums) {
+      detail::omp_exclusive_inplace_team(host_res, begin, end, f, v, sums);
+    });
+    return resources::EventProxy<resources::Host>(host_res);
+  }
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
   const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
   ::std::vector<Value> sums(p0, v);
 #pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + idx_begin - 1));
-#pragma omp barrier
-    if (idx_begin != idx_end) {
-      exclusive_inplace(host_res, loop_exec{},
-                        begin + idx_begin, begin + idx_end, f, init);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  detail::omp_exclusive_inplace_team(host_res, begin, end, f, v, sums.data());
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -149,7 +223,15 @@ inclusive(
     BinFn f)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
+  if (::RAJA::policy::omp::internal::region_active()) {
+    const auto n = distance(begin, end);
+#pragma omp for
+    for (decltype(distance(begin, end)) i = 0; i < n; ++i) {
+      out[i] = begin[i];
+    }
+  } else {
+    ::std::copy(begin, end, out);
+  }
   return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
 }
 
@@ -175,10 +257,114 @@ exclusive(
     ValueT v)
 {
   using std::distance;
-  ::std::copy(begin, end, out);
+  if (::RAJA::policy::omp::internal::region_active()) {
+    const auto n = distance(begin, end);
+#pragma omp for
+    for (decltype(distance(begin, end)) i = 0; i < n; ++i) {
+      out[i] = begin[i];
+    }
+  } else {
+    ::std::copy(begin, end, out);
+  }
   return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
 }
 
+
+/*!
+        \brief explicit inclusive segmented scan given input range, output,
+   segment offsets, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename OffsetIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter,
+    OutIter out,
+    OffsetIter offsets,
+    int num_segments,
+    BinFn f)
+{
+  auto scan_segment = [&](int s) {
+    const auto seg_begin = offsets[s];
+    const auto seg_end = offsets[s + 1];
+    if (seg_begin != seg_end) {
+      inclusive(host_res, loop_exec{},
+                begin + seg_begin, begin + seg_end,
+                out + seg_begin, f);
+    }
+  };
+  if (::RAJA::policy::omp::internal::region_active()) {
+#pragma omp for schedule(guided)
+    for (int s = 0; s < num_segments; ++s) {
+      scan_segment(s);
+    }
+  } else {
+#pragma omp parallel for schedule(guided)
+    for (int s = 0; s < num_segments; ++s) {
+      scan_segment(s);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, output,
+   segment offsets, function, and
+   initial value for each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename OffsetIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter,
+    OutIter out,
+    OffsetIter offsets,
+    int num_segments,
+    BinFn f,
+    T v)
+{
+  auto scan_segment = [&](int s) {
+    const auto seg_begin = offsets[s];
+    const auto seg_end = offsets[s + 1];
+    if (seg_begin != seg_end) {
+      exclusive(host_res, loop_exec{},
+                begin + seg_begin, begin + seg_end,
+                out + seg_begin, f, v);
+    }
+  };
+  if (::RAJA::policy::omp::internal::region_active()) {
+#pragma omp for schedule(guided)
+    for (int s = 0; s < num_segments; ++s) {
+      scan_segment(s);
+    }
+  } else {
+#pragma omp parallel for schedule(guided)
+    for (int s = 0; s < num_segments; ++s) {
+      scan_segment(s);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
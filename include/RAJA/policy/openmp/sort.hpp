@@ -21,14 +21,24 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
@@ -88,46 +98,150 @@ inline void sort_task(Sorter sorter,
 
 #else
 
+/*!
+        \brief find the number of elements taken from [a, a+a_len) in the
+               first diag elements of the stable merge of [a, a+a_len) and
+               [b, b+b_len)
+*/
+template <typename Iter, typename Compare>
+inline RAJA::detail::IterDiff<Iter> merge_path(Iter a,
+                                               RAJA::detail::IterDiff<Iter> a_len,
+                                               Iter b,
+                                               RAJA::detail::IterDiff<Iter> b_len,
+                                               RAJA::detail::IterDiff<Iter> diag,
+                                               Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  diff_type lo = (diag > b_len) ? diag - b_len : 0;
+  diff_type hi = (diag < a_len) ? diag : a_len;
+  while (lo < hi) {
+    const diff_type mid = lo + (hi - lo) / 2;
+    if (comp(b[diag - mid - 1], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief this thread's part of merging pairs of sorted runs of
+               run_len thread chunks from src into dst, the part written
+               is the chunk of dst owned by this thread
+*/
+template <typename SrcIter, typename DstIter, typename Compare>
+inline void merge_level_parallel_region(SrcIter src,
+                                        DstIter dst,
+                                        RAJA::detail::IterDiff<SrcIter> n,
+                                        RAJA::detail::IterDiff<SrcIter> run_len,
+                                        Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<SrcIter>;
+
+  const diff_type num_threads = omp_get_num_threads();
+
+  const diff_type thread_id = omp_get_thread_num();
+
+  const diff_type pair_id = thread_id / (2*run_len);
+
+  const diff_type a_begin = firstIndex(n, num_threads, std::min(2*pair_id*run_len,     num_threads));
+  const diff_type b_begin = firstIndex(n, num_threads, std::min((2*pair_id+1)*run_len, num_threads));
+  const diff_type b_end   = firstIndex(n, num_threads, std::min((2*pair_id+2)*run_len, num_threads));
+
+  const diff_type o_begin = firstIndex(n, num_threads, thread_id);
+  const diff_type o_end   = firstIndex(n, num_threads, thread_id + 1);
+
+  const diff_type a_len = b_begin - a_begin;
+  const diff_type b_len = b_end - b_begin;
+
+  // split the merge by diagonals so each thread writes its own chunk
+  diff_type ia = merge_path(src + a_begin, a_len, src + b_begin, b_len,
+                            o_begin - a_begin, comp);
+  diff_type ib = (o_begin - a_begin) - ia;
+  const diff_type ia_end = merge_path(src + a_begin, a_len, src + b_begin, b_len,
+                                      o_end - a_begin, comp);
+  const diff_type ib_end = (o_end - a_begin) - ia_end;
+
+  // other threads read src while finding their diagonals
+#pragma omp barrier
+
+  SrcIter a = src + a_begin;
+  SrcIter b = src + b_begin;
+  DstIter out = dst + o_begin;
+  while (ia < ia_end && ib < ib_end) {
+    if (comp(b[ib], a[ia])) {
+      *out = std::move(b[ib]);
+      ++ib;
+    } else {
+      *out = std::move(a[ia]);
+      ++ia;
+    }
+    ++out;
+  }
+  for (; ia < ia_end; ++ia, ++out) {
+    *out = std::move(a[ia]);
+  }
+  for (; ib < ib_end; ++ib, ++out) {
+    *out = std::move(b[ib]);
+  }
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by manually assigning work to threads
+
+        Each thread sorts a chunk, then the sorted runs are merged pairwise
+        with every thread taking part in every level of merges. The runs
+        move back and forth between the range and buf, which is
+        uninitialized storage for n values.
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
                                  RAJA::detail::IterDiff<Iter> n,
+                                 RAJA::detail::IterVal<Iter>* buf,
                                  Compare comp)
 {
   using RAJA::detail::firstIndex;
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   const diff_type num_threads = omp_get_num_threads();
 
   const diff_type thread_id = omp_get_thread_num();
 
   const diff_type i_begin = firstIndex(n, num_threads, thread_id);
-  {
-    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+  const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
 
-    // this thread sorts range [i_begin, i_end)
-    sorter(begin + i_begin, begin + i_end, comp);
+  // this thread sorts range [i_begin, i_end) and moves it into buf
+  sorter(begin + i_begin, begin + i_end, comp);
+  for (diff_type i = i_begin; i < i_end; ++i) {
+    new(&buf[i]) value_type(std::move(begin[i]));
   }
 
-  // hierarchically merge ranges
-  for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
+  // merge runs of thread chunks until one run is left
+  bool in_buf = true;
+  for (diff_type run_len = 1; run_len < num_threads; run_len *= 2) {
 
-    diff_type end_offset = 2*middle_offset;
+#pragma omp barrier
 
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
+    if (in_buf) {
+      merge_level_parallel_region(buf, begin, n, run_len, comp);
+    } else {
+      merge_level_parallel_region(begin, buf, n, run_len, comp);
+    }
+    in_buf = !in_buf;
+  }
 
-#pragma omp barrier
+  if (in_buf) {
 
-    if (thread_id % end_offset == 0) {
+#pragma omp barrier
 
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    for (diff_type i = i_begin; i < i_end; ++i) {
+      begin[i] = std::move(buf[i]);
     }
   }
 }
@@ -140,10 +254,10 @@ inline void sort_parallel_region(Sorter sorter,
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline
-void sort(Sorter sorter,
-          Iter begin,
-          Iter end,
-          Compare comp)
+void comparison_sort(Sorter sorter,
+                     Iter begin,
+                     Iter end,
+                     Compare comp)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
 
@@ -151,14 +265,14 @@ void sort(Sorter sorter,
 
   const diff_type n = end - begin;
 
-  if (n <= min_iterates_per_task) {
+  const diff_type max_threads = omp_get_max_threads();
+
+  if (n <= min_iterates_per_task || max_threads == 1) {
 
     sorter(begin, end, comp);
 
   } else {
 
-    const diff_type max_threads = omp_get_max_threads();
-
 #ifdef RAJA_ENABLE_OPENMP_TASK
 
     const diff_type iterates_per_task = std::max(n/(2*max_threads), min_iterates_per_task);
@@ -174,18 +288,329 @@ void sort(Sorter sorter,
 
 #else
 
+    using value_type = RAJA::detail::IterVal<Iter>;
+
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
     RAJA_UNUSED_VAR(requested_num_threads); // avoid warning in hip device code
 
+    // Manage the lifetime of the buffer and objects constructed in the buffer
+    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, n * sizeof(value_type) ),
+        buf_deleter);
+
+    // check memory allocation worked
+    if (buf.get() == nullptr) {
+      RAJA_ABORT_OR_THROW( "openmp sort temporary memory allocation failed" );
+    }
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+      sort_parallel_region(sorter, begin, n, buf.get(), comp);
     }
 
+    // every thread constructed its chunk of the buffer
+    buf_deleter.size = n;
+
 #endif
   }
 }
 
+
+// below this size the comparison sort is as fast as the radix sort
+constexpr int get_min_iterates_per_radix_sort() { return 1 << 16; }
+
+// number of bits sorted in each pass of the radix sort
+constexpr int get_radix_sort_digit_bits() { return 8; }
+
+/*!
+        \brief unsigned integer type with the given size in bytes
+*/
+template <size_t Size>
+struct radix_bits;
+///
+template <>
+struct radix_bits<1> { using type = std::uint8_t; };
+///
+template <>
+struct radix_bits<2> { using type = std::uint16_t; };
+///
+template <>
+struct radix_bits<4> { using type = std::uint32_t; };
+///
+template <>
+struct radix_bits<8> { using type = std::uint64_t; };
+
+/*!
+        \brief map arithmetic keys to unsigned integers that compare in the
+               same order as the keys
+*/
+template <typename Key, bool Descending>
+struct radix_key
+{
+  using bits_type = typename radix_bits<sizeof(Key)>::type;
+
+  static constexpr int num_bits = sizeof(Key) * CHAR_BIT;
+
+  static constexpr bits_type sign_bit = bits_type(bits_type(1) << (num_bits - 1));
+
+  static RAJA_INLINE bits_type to_bits(Key key)
+  {
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(Key));
+    if (std::is_floating_point<Key>::value) {
+      // flip all the bits of negative values and the sign bit of the rest
+      bits ^= (bits & sign_bit) ? bits_type(~bits_type(0)) : sign_bit;
+    } else if (std::is_signed<Key>::value) {
+      bits ^= sign_bit;
+    }
+    return Descending ? bits_type(~bits) : bits;
+  }
+};
+
+/*!
+        \brief checks if the keys in the range can be radix sorted for
+               the sorter and comparison function
+
+        Stable sorts radix sort integral keys only, as the radix sort
+        orders -0.0 before 0.0 which less and greater treat as equivalent.
+*/
+template <typename Sorter, typename Iter, typename Compare,
+          typename Key = RAJA::detail::IterVal<Iter>>
+struct can_radix_sort
+    : std::integral_constant<bool,
+          std::is_pointer<Iter>::value &&
+          std::is_arithmetic<Key>::value &&
+          (sizeof(Key) == 1 || sizeof(Key) == 2 ||
+           sizeof(Key) == 4 || sizeof(Key) == 8) &&
+          (std::is_integral<Key>::value ||
+           (std::numeric_limits<Key>::is_iec559 &&
+            std::is_same<Sorter, UnstableSorter>::value)) &&
+          (std::is_same<Compare, operators::less<Key>>::value ||
+           std::is_same<Compare, operators::greater<Key>>::value)>
+{
+};
+
+/*!
+        \brief this thread's part of the lsd radix sort of keys and vals if
+               vals is not null, keys_buf and vals_buf have room for n values
+               and counts has room for one count per digit per thread
+*/
+template <bool Descending, typename Key, typename Val, typename diff_type>
+inline void radix_sort_parallel_region(Key* keys,
+                                       Key* keys_buf,
+                                       Val* vals,
+                                       Val* vals_buf,
+                                       diff_type n,
+                                       diff_type* counts,
+                                       bool& skip_pass)
+{
+  using RAJA::detail::firstIndex;
+  using radix = radix_key<Key, Descending>;
+  constexpr int digit_bits = get_radix_sort_digit_bits();
+  constexpr int radix_size = 1 << digit_bits;
+
+  const diff_type num_threads = omp_get_num_threads();
+
+  const diff_type thread_id = omp_get_thread_num();
+
+  const diff_type i_begin = firstIndex(n, num_threads, thread_id);
+  const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
+
+  diff_type* thread_counts = counts + thread_id * radix_size;
+
+  Key* keys_src = keys;
+  Key* keys_dst = keys_buf;
+  Val* vals_src = vals;
+  Val* vals_dst = vals_buf;
+
+  for (int shift = 0; shift < radix::num_bits; shift += digit_bits) {
+
+    auto digit = [=](Key key) {
+      return static_cast<int>((radix::to_bits(key) >> shift) & (radix_size - 1));
+    };
+
+    // count the digits in this thread's chunk
+    diff_type local_counts[radix_size] = {};
+    for (diff_type i = i_begin; i < i_end; ++i) {
+      ++local_counts[digit(keys_src[i])];
+    }
+    for (int d = 0; d < radix_size; ++d) {
+      thread_counts[d] = local_counts[d];
+    }
+
+#pragma omp barrier
+
+    // turn the counts into offsets ordered by digit then thread
+#pragma omp single
+    {
+      skip_pass = false;
+      diff_type sum = 0;
+      for (int d = 0; d < radix_size; ++d) {
+        const diff_type digit_begin = sum;
+        for (diff_type t = 0; t < num_threads; ++t) {
+          const diff_type count = counts[t * radix_size + d];
+          counts[t * radix_size + d] = sum;
+          sum += count;
+        }
+        // every key has the same digit, nothing to do in this pass
+        if (sum - digit_begin == n) {
+          skip_pass = true;
+        }
+      }
+    }
+
+    if (skip_pass) {
+      continue;
+    }
+
+    if (vals_src != nullptr) {
+      for (diff_type i = i_begin; i < i_end; ++i) {
+        const diff_type pos = thread_counts[digit(keys_src[i])]++;
+        keys_dst[pos] = keys_src[i];
+        vals_dst[pos] = vals_src[i];
+      }
+    } else {
+      for (diff_type i = i_begin; i < i_end; ++i) {
+        const diff_type pos = thread_counts[digit(keys_src[i])]++;
+        keys_dst[pos] = keys_src[i];
+      }
+    }
+
+    std::swap(keys_src, keys_dst);
+    std::swap(vals_src, vals_dst);
+
+#pragma omp barrier
+  }
+
+  if (keys_src != keys) {
+    std::copy(keys_src + i_begin, keys_src + i_end, keys + i_begin);
+    if (vals_src != nullptr) {
+      std::copy(vals_src + i_begin, vals_src + i_end, vals + i_begin);
+    }
+  }
+}
+
+/*!
+        \brief stable lsd radix sort given range of keys and vals if vals
+               is not null in ascending or descending order
+*/
+template <bool Descending, typename Key, typename Val>
+inline void radix_sort(Key* keys, Key* keys_end, Val* vals)
+{
+  using diff_type = RAJA::detail::IterDiff<Key*>;
+
+  const diff_type n = keys_end - keys;
+
+  const diff_type max_threads = omp_get_max_threads();
+
+  std::unique_ptr<Key, FreeAligned> keys_buf(
+      RAJA::allocate_aligned_type<Key>( RAJA::DATA_ALIGN, n * sizeof(Key) ));
+  std::unique_ptr<Val, FreeAligned> vals_buf(
+      (vals != nullptr)
+        ? RAJA::allocate_aligned_type<Val>( RAJA::DATA_ALIGN, n * sizeof(Val) )
+        : nullptr);
+  std::vector<diff_type> counts(max_threads << get_radix_sort_digit_bits());
+
+  // check memory allocation worked
+  if (keys_buf.get() == nullptr ||
+      (vals != nullptr && vals_buf.get() == nullptr)) {
+    RAJA_ABORT_OR_THROW( "openmp radix sort temporary memory allocation failed" );
+  }
+
+  bool skip_pass = false;
+
+#pragma omp parallel num_threads(static_cast<int>(max_threads))
+  {
+    radix_sort_parallel_region<Descending>(keys, keys_buf.get(),
+                                           vals, vals_buf.get(),
+                                           n, counts.data(), skip_pass);
+  }
+}
+
+/*!
+        \brief sort given range using sorter and comparison function,
+               radix sort the keys if possible
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<can_radix_sort<Sorter, Iter, Compare>>
+sort(Sorter sorter,
+     Iter begin,
+     Iter end,
+     Compare comp)
+{
+  using Key = RAJA::detail::IterVal<Iter>;
+
+  if (end - begin < get_min_iterates_per_radix_sort() ||
+      omp_get_max_threads() == 1) {
+    comparison_sort(sorter, begin, end, comp);
+  } else {
+    radix_sort<std::is_same<Compare, operators::greater<Key>>::value>(
+        begin, end, static_cast<Key*>(nullptr));
+  }
+}
+///
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<can_radix_sort<Sorter, Iter, Compare>>>
+sort(Sorter sorter,
+     Iter begin,
+     Iter end,
+     Compare comp)
+{
+  comparison_sort(sorter, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of pairs using sorter and comparison
+               function on keys, radix sort the pairs if possible
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<can_radix_sort<Sorter, KeyIter, Compare>,
+                    std::is_pointer<ValIter>,
+                    std::is_trivially_copyable<RAJA::detail::IterVal<ValIter>>>
+sort_pairs(Sorter sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  using Key = RAJA::detail::IterVal<KeyIter>;
+
+  if (keys_end - keys_begin < get_min_iterates_per_radix_sort() ||
+      omp_get_max_threads() == 1) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    comparison_sort(sorter, begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    radix_sort<std::is_same<Compare, operators::greater<Key>>::value>(
+        keys_begin, keys_end, vals_begin);
+  }
+}
+///
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<concepts::all_of<
+                      can_radix_sort<Sorter, KeyIter, Compare>,
+                      std::is_pointer<ValIter>,
+                      std::is_trivially_copyable<RAJA::detail::IterVal<ValIter>>>>>
+sort_pairs(Sorter sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  comparison_sort(sorter, begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
 } // namespace openmp
 
 } // namespace detail
@@ -240,10 +665,7 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::sort_pairs(detail::UnstableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -262,10 +684,63 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  detail::openmp::sort_pairs(detail::StableSorter{}, keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+unstable_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+#pragma omp parallel for schedule(guided)
+  for (int s = 0; s < num_segments; ++s) {
+    if (offsets[s + 1] - offsets[s] > 1) {
+      detail::UnstableSorter{}(begin + offsets[s], begin + offsets[s + 1], comp);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+unstable_segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
   using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+#pragma omp parallel for schedule(guided)
+  for (int s = 0; s < num_segments; ++s) {
+    if (offsets[s + 1] - offsets[s] > 1) {
+      detail::UnstableSorter{}(begin + offsets[s], begin + offsets[s + 1],
+                               RAJA::compare_first<zip_ref>(comp));
+    }
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
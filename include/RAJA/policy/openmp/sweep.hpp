@@ -0,0 +1,107 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA tiled sweep declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sweep_openmp_HPP
+#define RAJA_sweep_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/pattern/detail/sweep.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sweep
+{
+
+/*!
+        \brief run the tiles of a sweep on the threads of a parallel region
+
+   Each thread takes the next tile in wavefront order, waits on the
+   DepGraphNode of the tile until its upstream neighbors are done, runs it
+   and satisfies one dependency of each of its downstream neighbors. There
+   is no barrier between wavefronts, a tile starts as soon as its upstream
+   neighbors are done.
+*/
+template <typename ExecPolicy, int DIM, typename Body>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+tiled_sweep(resources::Host host_res,
+            const ExecPolicy &,
+            expt::detail::SweepSpace<DIM> const &space,
+            Body const &body)
+{
+  const Index_type num_tiles = space.total_tiles();
+
+  std::vector<DepGraphNode> graph(num_tiles);
+  {
+    Index_type t[DIM];
+    for (Index_type ticket = 0; ticket < num_tiles; ++ticket) {
+      space.decode(ticket, t);
+      DepGraphNode &node = graph[space.linear(t)];
+      node.semaphoreReloadValue() = space.num_upstream(t);
+      node.reset();
+    }
+  }
+
+  std::atomic<Index_type> next_ticket(0);
+
+#pragma omp parallel
+  {
+    Index_type t[DIM];
+    for (Index_type ticket = next_ticket++; ticket < num_tiles;
+         ticket = next_ticket++) {
+
+      space.decode(ticket, t);
+      graph[space.linear(t)].wait();
+
+      space.for_each_cell(t, body);
+
+      for (int d = 0; d < DIM; ++d) {
+        if (t[d] + 1 < space.num_tiles[d]) {
+          ++t[d];
+          graph[space.linear(t)].satisfyOne();
+          --t[d];
+        }
+      }
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace sweep
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
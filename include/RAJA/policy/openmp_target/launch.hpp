@@ -0,0 +1,461 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for
+ *          RAJA::launch::openmp_target
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_openmp_target_HPP
+#define RAJA_pattern_launch_openmp_target_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Runs the launch body once per team in an omp target teams region. The
+ * team shared memory is allocated from the omp_pteam_mem_alloc allocator,
+ * which places it in the fast team local memory of the device.
+ *
+ * Thread loops are parallel regions nested in the team region, the end of
+ * each thread loop is a barrier for the threads of the team so teamSync
+ * is not needed between thread loops.
+ */
+template <>
+struct LaunchExecute<RAJA::omp_target_launch_t> {
+
+  template <typename BODY_IN>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *, BODY_IN const &body_in)
+  {
+    using BODY = camp::decay<BODY_IN>;
+    BODY body = body_in;
+
+    const int num_teams = params.teams.value[0] *
+                          params.teams.value[1] *
+                          params.teams.value[2];
+    int num_threads = params.threads.value[0] *
+                      params.threads.value[1] *
+                      params.threads.value[2];
+
+    // Reset if exceed CUDA threads per block limit.
+    if ( num_threads > omp::MAXNUMTHREADS ) {
+      num_threads = omp::MAXNUMTHREADS;
+    }
+
+    // Only launch kernel if we have something to iterate over
+    if ( num_teams > 0 && num_threads > 0 ) {
+
+      const size_t shared_mem_size = params.shared_mem_size;
+
+#pragma omp target teams num_teams(num_teams) thread_limit(num_threads) \
+    map(to : body) firstprivate(shared_mem_size)
+      {
+        LaunchContext ctx;
+
+        if ( shared_mem_size > 0 ) {
+          ctx.shared_mem_ptr = omp_alloc(shared_mem_size, omp_pteam_mem_alloc);
+        }
+
+        body(ctx);
+
+        if ( shared_mem_size > 0 ) {
+          omp_free(ctx.shared_mem_ptr, omp_pteam_mem_alloc);
+          ctx.shared_mem_ptr = nullptr;
+        }
+      }
+    }
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+
+/*
+  Team loops, each team starts at its team number and strides over the
+  number of teams, multi-dimensional segments are linearized with
+  segment0 fastest
+*/
+template <typename SEGMENT>
+struct LoopExecute<omp_target_team_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+
+    for (int i = omp_get_team_num(); i < len; i += omp_get_num_teams()) {
+
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    const int len = len0 * len1;
+
+    for (int ij = omp_get_team_num(); ij < len; ij += omp_get_num_teams()) {
+      const int i = ij % len0;
+      const int j = ij / len0;
+
+      body(*(segment0.begin() + i), *(segment1.begin() + j));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    const int len = len0 * len1 * len2;
+
+    for (int ijk = omp_get_team_num(); ijk < len; ijk += omp_get_num_teams()) {
+      const int i = ijk % len0;
+      const int j = (ijk / len0) % len1;
+      const int k = ijk / (len0 * len1);
+
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_target_team_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+
+    for (int i = omp_get_team_num(); i < len; i += omp_get_num_teams()) {
+
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    const int len = len0 * len1;
+
+    for (int ij = omp_get_team_num(); ij < len; ij += omp_get_num_teams()) {
+      const int i = ij % len0;
+      const int j = ij / len0;
+
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           i,
+           j);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    const int len = len0 * len1 * len2;
+
+    for (int ijk = omp_get_team_num(); ijk < len; ijk += omp_get_num_teams()) {
+      const int i = ijk % len0;
+      const int j = (ijk / len0) % len1;
+      const int k = ijk / (len0 * len1);
+
+      body(*(segment0.begin() + i),
+           *(segment1.begin() + j),
+           *(segment2.begin() + k),
+           i,
+           j,
+           k);
+    }
+  }
+};
+
+
+/*
+  Thread loops, a parallel for over the threads of the team
+*/
+template <typename SEGMENT>
+struct LoopExecute<omp_target_thread_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+
+#pragma omp parallel for
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp parallel for collapse(2)
+    for (int j = 0; j < len1; j++) {
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp parallel for collapse(3)
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_target_thread_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+
+#pragma omp parallel for
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp parallel for collapse(2)
+    for (int j = 0; j < len1; j++) {
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i),
+             *(segment1.begin() + j),
+             i,
+             j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp parallel for collapse(3)
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k),
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
+
+
+template <typename SEGMENT>
+struct TileExecute<omp_target_team_loop, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+    for (int i = omp_get_team_num(); i < numTiles; i += omp_get_num_teams()) {
+      body(segment.slice(i * tile_size, tile_size));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<omp_target_team_loop, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+    for (int i = omp_get_team_num(); i < numTiles; i += omp_get_num_teams()) {
+      body(segment.slice(i * tile_size, tile_size), i);
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_target_thread_loop, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+#pragma omp parallel for
+    for (int i = 0; i < numTiles; i++) {
+      body(segment.slice(i * tile_size, tile_size));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<omp_target_thread_loop, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+#pragma omp parallel for
+    for (int i = 0; i < numTiles; i++) {
+      body(segment.slice(i * tile_size, tile_size), i);
+    }
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TARGET_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -59,10 +59,19 @@ struct omp_target_parallel_collapse_exec
                             omp::Collapse> {
 };
 
-struct omp_target_reduce
+///
+/// Reduction policies, with device_combine the per team values are combined
+/// on the device and only the combined value is transferred to the host
+///
+template <bool device_combine>
+struct omp_target_reduce_base
     : make_policy_pattern_platform_t<Policy::target_openmp, Pattern::reduce, Platform::omp_target> {
 };
 
+using omp_target_reduce = omp_target_reduce_base<false>;
+
+using omp_target_reduce_device = omp_target_reduce_base<true>;
+
 ///
 /// WorkGroup execution policies
 ///
@@ -73,6 +82,17 @@ struct omp_target_work
                                             Platform::omp_target> {
 };
 
+///
+/// RAJA::launch execution policy, teams map to omp teams and threads map
+/// to the threads of each team
+///
+struct omp_target_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::target_openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::omp_target> {
+};
+
 
 }  // closing brace for omp namespace
 }  // closing brace for policy namespace
@@ -80,9 +100,19 @@ struct omp_target_work
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using policy::omp::omp_target_parallel_for_exec;
 using policy::omp::omp_target_parallel_for_exec_nt;
+using policy::omp::omp_target_reduce_base;
 using policy::omp::omp_target_reduce;
+using policy::omp::omp_target_reduce_device;
 using policy::omp::omp_target_parallel_collapse_exec;
 using policy::omp::omp_target_work;
+using policy::omp::omp_target_launch_t;
+
+///
+/// RAJA::launch loop policies, team loops stride over the teams of the
+/// launch and thread loops run as a parallel for over the threads of a team
+///
+struct omp_target_team_loop{};
+struct omp_target_thread_loop{};
 #endif
 
 } // closing brace for RAJA namespace
@@ -15,6 +15,7 @@
 //#include <cassert>  // Leaving out until XL is fixed 2/25/2019.
 
 #include <algorithm>
+#include <type_traits>
 
 #include <omp.h>
 
@@ -23,6 +24,7 @@
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
 
 
 namespace RAJA
@@ -86,7 +88,7 @@ struct Offload_Info
 
 //! Reduction data for OpenMP Offload -- stores value, host pointer, and device
 //! pointer
-template <typename T>
+template <typename T, bool DeviceCombine = false>
 struct Reduce_Data
 {
   mutable T value;
@@ -173,11 +175,80 @@ struct Reduce_Data
   }
 };
 
+//! Reduction data for OpenMP Offload with device combining -- stores value
+//! and device pointer, the per team values never leave the device
+template <typename T>
+struct Reduce_Data<T, true>
+{
+  mutable T value;
+  T *device;
+
+  //! disallow default constructor
+  Reduce_Data() = delete;
+
+  /*! \brief create from a default value and offload information
+   *
+   *  allocates data on the device and initializes values to default on the
+   *  device
+   */
+  Reduce_Data(T initValue, T identityValue, Offload_Info &info)
+      : value(initValue),
+        device{reinterpret_cast<T *>(
+            omp_target_alloc(omp::MaxNumTeams * sizeof(T), info.deviceID))}
+  {
+    if (!device) {
+      printf("Unable to allocate space on device\n");
+      exit(1);
+    }
+    T *dev = device;
+#pragma omp target teams distribute parallel for device(info.deviceID) \
+    is_device_ptr(dev) firstprivate(identityValue)
+    for (int i = 0; i < omp::MaxNumTeams; ++i) {
+      dev[i] = identityValue;
+    }
+  }
+
+  void reset(T initValue)
+  {
+    value = initValue;
+  }
+
+
+  //! default copy constructor for POD
+  Reduce_Data(const Reduce_Data &) = default;
+
+  //! transfers the first device value to the host -- exit() is called upon
+  //! failure
+  RAJA_INLINE void deviceToHost(T &hostValue, Offload_Info &info)
+  {
+    // precondition: device is a valid pointer
+    if (omp_target_memcpy(reinterpret_cast<void *>(&hostValue),
+                          reinterpret_cast<void *>(device),
+                          sizeof(T),
+                          0,
+                          0,
+                          info.hostID,
+                          info.deviceID) != 0) {
+      printf("Unable to copy memory from device to host\n");
+      exit(1);
+    }
+  }
+
+  //! frees all data from the offload information passed
+  RAJA_INLINE void cleanup(Offload_Info &info)
+  {
+    if (device) {
+      omp_target_free(reinterpret_cast<void *>(device), info.deviceID);
+      device = nullptr;
+    }
+  }
+};
+
 }  // end namespace omp
 
-//! OpenMP Target Reduction entity -- generalize on # of teams, reduction, and
-//! type
-template <typename Reducer, typename T>
+//! OpenMP Target Reduction entity -- generalize on # of teams, reduction,
+//! type, and where the per team values are combined
+template <typename Reducer, typename T, bool DeviceCombine = false>
 struct TargetReduce 
 {
   TargetReduce() = delete;
@@ -222,12 +293,7 @@ struct TargetReduce
   operator T()
   {
     if (!info.isMapped) {
-      val.deviceToHost(info);
-
-      for (int i = 0; i < omp::MaxNumTeams; ++i) {
-        Reducer{}(val.value, val.host[i]);
-      }
-      val.cleanup(info);
+      combineTeams(std::integral_constant<bool, DeviceCombine>{});
       info.isMapped = true;
     }
     finalVal = Reducer::identity();
@@ -253,17 +319,46 @@ struct TargetReduce
   }
 
 private:
+  //! map the per team values back to the host and combine them there
+  void combineTeams(std::false_type)
+  {
+    val.deviceToHost(info);
+
+    for (int i = 0; i < omp::MaxNumTeams; ++i) {
+      Reducer{}(val.value, val.host[i]);
+    }
+    val.cleanup(info);
+  }
+
+  //! combine the per team values on the device and map back only the result
+  void combineTeams(std::true_type)
+  {
+    T *dev = val.device;
+#pragma omp target device(info.deviceID) is_device_ptr(dev)
+    {
+      for (int i = 1; i < omp::MaxNumTeams; ++i) {
+        Reducer{}(dev[0], dev[i]);
+      }
+    }
+
+    T teamsVal = val.value;
+    val.deviceToHost(teamsVal, info);
+    Reducer{}(val.value, teamsVal);
+    val.cleanup(info);
+  }
+
   //! storage for offload information (host ID, device ID)
   omp::Offload_Info info;
   //! storage for reduction data (host ptr, device ptr, value)
-  omp::Reduce_Data<T> val;
+  omp::Reduce_Data<T, DeviceCombine> val;
   T initVal;
   T finalVal;
 };
 
 //! OpenMP Target Reduction Location entity -- generalize on # of teams,
-//! reduction, and type
-template <typename Reducer, typename T, typename IndexType>
+//! reduction, type, and where the per team values are combined
+template <typename Reducer, typename T, typename IndexType,
+          bool DeviceCombine = false>
 struct TargetReduceLoc 
 {
   TargetReduceLoc() = delete;
@@ -311,13 +406,7 @@ struct TargetReduceLoc
   operator T()
   {
     if (!info.isMapped) {
-      val.deviceToHost(info);
-      loc.deviceToHost(info);
-      for (int i = 0; i < omp::MaxNumTeams; ++i) {
-        Reducer{}(val.value, loc.value, val.host[i], loc.host[i]);
-      }
-      val.cleanup(info);
-      loc.cleanup(info);
+      combineTeams(std::integral_constant<bool, DeviceCombine>{});
       info.isMapped = true;
     }
     finalVal = Reducer::identity;
@@ -353,12 +442,45 @@ struct TargetReduceLoc
   }
 
 private:
+  //! map the per team values back to the host and combine them there
+  void combineTeams(std::false_type)
+  {
+    val.deviceToHost(info);
+    loc.deviceToHost(info);
+    for (int i = 0; i < omp::MaxNumTeams; ++i) {
+      Reducer{}(val.value, loc.value, val.host[i], loc.host[i]);
+    }
+    val.cleanup(info);
+    loc.cleanup(info);
+  }
+
+  //! combine the per team values on the device and map back only the result
+  void combineTeams(std::true_type)
+  {
+    T *dev_val = val.device;
+    IndexType *dev_loc = loc.device;
+#pragma omp target device(info.deviceID) is_device_ptr(dev_val, dev_loc)
+    {
+      for (int i = 1; i < omp::MaxNumTeams; ++i) {
+        Reducer{}(dev_val[0], dev_loc[0], dev_val[i], dev_loc[i]);
+      }
+    }
+
+    T teamsVal = val.value;
+    IndexType teamsLoc = loc.value;
+    val.deviceToHost(teamsVal, info);
+    loc.deviceToHost(teamsLoc, info);
+    Reducer{}(val.value, loc.value, teamsVal, teamsLoc);
+    val.cleanup(info);
+    loc.cleanup(info);
+  }
+
   //! storage for offload information
   omp::Offload_Info info;
   //! storage for reduction data for value
-  omp::Reduce_Data<T> val;
+  omp::Reduce_Data<T, DeviceCombine> val;
   //! storage for redcution data for location
-  omp::Reduce_Data<IndexType> loc;
+  omp::Reduce_Data<IndexType, DeviceCombine> loc;
   T initVal;
   T finalVal;
   IndexType initLoc;
@@ -367,14 +489,14 @@ private:
 
 
 //! specialization of ReduceSum for omp_target_reduce
-template <typename T>
-class ReduceSum<omp_target_reduce, T>
-    : public TargetReduce<RAJA::reduce::sum<T>, T>
+template <bool device_combine, typename T>
+class ReduceSum<omp_target_reduce_base<device_combine>, T>
+    : public TargetReduce<RAJA::reduce::sum<T>, T, device_combine>
 {
 public:
 
-  using self = ReduceSum<omp_target_reduce, T>;
-  using parent = TargetReduce<RAJA::reduce::sum<T>, T>;
+  using self = ReduceSum<omp_target_reduce_base<device_combine>, T>;
+  using parent = TargetReduce<RAJA::reduce::sum<T>, T, device_combine>;
   using parent::parent;
 
   //! enable operator+= for ReduceSum -- alias for reduce()
@@ -393,14 +515,14 @@ public:
 };
 
 //! specialization of ReduceBitOr for omp_target_reduce
-template <typename T>
-class ReduceBitOr<omp_target_reduce, T>
-    : public TargetReduce<RAJA::reduce::or_bit<T>, T>
+template <bool device_combine, typename T>
+class ReduceBitOr<omp_target_reduce_base<device_combine>, T>
+    : public TargetReduce<RAJA::reduce::or_bit<T>, T, device_combine>
 {
 public:
 
-  using self = ReduceBitOr<omp_target_reduce, T>;
-  using parent = TargetReduce<RAJA::reduce::or_bit<T>, T>;
+  using self = ReduceBitOr<omp_target_reduce_base<device_combine>, T>;
+  using parent = TargetReduce<RAJA::reduce::or_bit<T>, T, device_combine>;
   using parent::parent;
 
   //! enable operator|= for ReduceBitOr -- alias for reduce()
@@ -419,14 +541,14 @@ public:
 };
 
 //! specialization of ReduceBitAnd for omp_target_reduce
-template <typename T>
-class ReduceBitAnd<omp_target_reduce, T>
-    : public TargetReduce<RAJA::reduce::and_bit<T>, T>
+template <bool device_combine, typename T>
+class ReduceBitAnd<omp_target_reduce_base<device_combine>, T>
+    : public TargetReduce<RAJA::reduce::and_bit<T>, T, device_combine>
 {
 public:
 
-  using self = ReduceBitAnd<omp_target_reduce, T>;
-  using parent = TargetReduce<RAJA::reduce::and_bit<T>, T>;
+  using self = ReduceBitAnd<omp_target_reduce_base<device_combine>, T>;
+  using parent = TargetReduce<RAJA::reduce::and_bit<T>, T, device_combine>;
   using parent::parent;
 
   //! enable operator&= for ReduceBitAnd -- alias for reduce()
@@ -445,14 +567,14 @@ public:
 };
 
 //! specialization of ReduceMin for omp_target_reduce
-template <typename T>
-class ReduceMin<omp_target_reduce, T>
-    : public TargetReduce<RAJA::reduce::min<T>, T>
+template <bool device_combine, typename T>
+class ReduceMin<omp_target_reduce_base<device_combine>, T>
+    : public TargetReduce<RAJA::reduce::min<T>, T, device_combine>
 {
 public:
 
-  using self = ReduceMin<omp_target_reduce, T>;
-  using parent = TargetReduce<RAJA::reduce::min<T>, T>;
+  using self = ReduceMin<omp_target_reduce_base<device_combine>, T>;
+  using parent = TargetReduce<RAJA::reduce::min<T>, T, device_combine>;
   using parent::parent;
 
   //! enable min() for ReduceMin -- alias for reduce()
@@ -472,14 +594,14 @@ public:
 
 
 //! specialization of ReduceMax for omp_target_reduce
-template <typename T>
-class ReduceMax<omp_target_reduce, T>
-    : public TargetReduce<RAJA::reduce::max<T>, T>
+template <bool device_combine, typename T>
+class ReduceMax<omp_target_reduce_base<device_combine>, T>
+    : public TargetReduce<RAJA::reduce::max<T>, T, device_combine>
 {
 public:
 
-  using self = ReduceMax<omp_target_reduce, T>;
-  using parent = TargetReduce<RAJA::reduce::max<T>, T>;
+  using self = ReduceMax<omp_target_reduce_base<device_combine>, T>;
+  using parent = TargetReduce<RAJA::reduce::max<T>, T, device_combine>;
   using parent::parent;
 
   //! enable max() for ReduceMax -- alias for reduce()
@@ -498,15 +620,16 @@ public:
 };
 
 //! specialization of ReduceMinLoc for omp_target_reduce
-template <typename T, typename IndexType>
-class ReduceMinLoc<omp_target_reduce, T, IndexType>
-    : public TargetReduceLoc<omp::minloc<T, IndexType>, T, IndexType>
+template <bool device_combine, typename T, typename IndexType>
+class ReduceMinLoc<omp_target_reduce_base<device_combine>, T, IndexType>
+    : public TargetReduceLoc<omp::minloc<T, IndexType>, T, IndexType,
+                             device_combine>
 {
 public:
 
-  using self = ReduceMinLoc<omp_target_reduce, T, IndexType>;
+  using self = ReduceMinLoc<omp_target_reduce_base<device_combine>, T, IndexType>;
   using parent =
-      TargetReduceLoc<omp::minloc<T, IndexType>, T, IndexType>;
+      TargetReduceLoc<omp::minloc<T, IndexType>, T, IndexType, device_combine>;
   using parent::parent;
 
   //! enable minloc() for ReduceMinLoc -- alias for reduce()
@@ -526,15 +649,16 @@ public:
 
 
 //! specialization of ReduceMaxLoc for omp_target_reduce
-template <typename T, typename IndexType>
-class ReduceMaxLoc<omp_target_reduce, T, IndexType>
-    : public TargetReduceLoc<omp::maxloc<T, IndexType>, T, IndexType>
+template <bool device_combine, typename T, typename IndexType>
+class ReduceMaxLoc<omp_target_reduce_base<device_combine>, T, IndexType>
+    : public TargetReduceLoc<omp::maxloc<T, IndexType>, T, IndexType,
+                             device_combine>
 {
 public:
 
-  using self = ReduceMaxLoc<omp_target_reduce, T, IndexType>;
+  using self = ReduceMaxLoc<omp_target_reduce_base<device_combine>, T, IndexType>;
   using parent =
-      TargetReduceLoc<omp::maxloc<T, IndexType>, T, IndexType>;
+      TargetReduceLoc<omp::maxloc<T, IndexType>, T, IndexType, device_combine>;
   using parent::parent;
 
   //! enable maxloc() for ReduceMaxLoc -- alias for reduce()
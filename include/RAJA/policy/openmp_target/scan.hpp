@@ -0,0 +1,253 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_openmp_target_HPP
+#define RAJA_scan_openmp_target_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include <iterator>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+namespace detail
+{
+namespace openmp_target
+{
+
+// maximum number of chunks the scans split the range into, each chunk is
+// scanned by one device thread
+constexpr int get_max_scan_chunks() { return 1 << 14; }
+
+/*!
+        \brief allocate an array of n values in device memory
+*/
+template <typename T>
+inline T* device_alloc(size_t n, int device)
+{
+  T* ptr = static_cast<T*>(omp_target_alloc(n * sizeof(T), device));
+  if (ptr == nullptr) {
+    RAJA_ABORT_OR_THROW( "openmp target scan temporary memory allocation failed" );
+  }
+  return ptr;
+}
+
+/*!
+        \brief two pass inplace scan, the first pass scans each chunk and
+               stores the chunk totals, the chunk totals are scanned on the
+               device, and the second pass adds the scanned totals to the
+               values of each chunk
+*/
+template <bool Inclusive, typename Iter, typename BinFn, typename ValueT>
+inline void scan_inplace(Iter begin, Iter end, BinFn f, ValueT v)
+{
+  using RAJA::detail::firstIndex;
+  using Value = RAJA::detail::IterVal<Iter>;
+  using DistanceT = RAJA::detail::IterDiff<Iter>;
+
+  const DistanceT n = std::distance(begin, end);
+  if (n <= 0) {
+    return;
+  }
+
+  const DistanceT num_chunks =
+      (n < static_cast<DistanceT>(get_max_scan_chunks()))
+        ? n : static_cast<DistanceT>(get_max_scan_chunks());
+
+  const int device = omp_get_default_device();
+  Value* sums = device_alloc<Value>(num_chunks, device);
+
+  const Value init = v;
+
+  // scan each chunk from the identity and store the chunk totals
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(begin, f, n, num_chunks) is_device_ptr(sums)
+  for (DistanceT c = 0; c < num_chunks; ++c) {
+    const DistanceT i_begin = firstIndex(n, num_chunks, c);
+    const DistanceT i_end   = firstIndex(n, num_chunks, c + 1);
+    Value sum = BinFn::identity();
+    for (DistanceT i = i_begin; i < i_end; ++i) {
+      const Value val = begin[i];
+      if (Inclusive) {
+        sum = f(sum, val);
+        begin[i] = sum;
+      } else {
+        begin[i] = sum;
+        sum = f(sum, val);
+      }
+    }
+    sums[c] = sum;
+  }
+
+  // exclusive scan of the chunk totals starting from the initial value
+#pragma omp target firstprivate(f, num_chunks, init) is_device_ptr(sums)
+  {
+    Value sum = init;
+    for (DistanceT c = 0; c < num_chunks; ++c) {
+      const Value val = sums[c];
+      sums[c] = sum;
+      sum = f(sum, val);
+    }
+  }
+
+  // combine the scanned chunk totals into the chunk values
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(begin, f, n, num_chunks) is_device_ptr(sums)
+  for (DistanceT c = 0; c < num_chunks; ++c) {
+    const DistanceT i_begin = firstIndex(n, num_chunks, c);
+    const DistanceT i_end   = firstIndex(n, num_chunks, c + 1);
+    const Value prefix = sums[c];
+    for (DistanceT i = i_begin; i < i_end; ++i) {
+      begin[i] = f(prefix, begin[i]);
+    }
+  }
+
+  omp_target_free(sums, device);
+}
+
+/*!
+        \brief copy the input range to the output range on the device
+*/
+template <typename Iter, typename OutIter>
+inline void copy(Iter begin, Iter end, OutIter out)
+{
+  using DistanceT = RAJA::detail::IterDiff<Iter>;
+
+  const DistanceT n = std::distance(begin, end);
+
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(begin, out, n)
+  for (DistanceT i = 0; i < n; ++i) {
+    out[i] = begin[i];
+  }
+}
+
+} // namespace openmp_target
+} // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>>
+inclusive_inplace(
+    resources::Omp omp_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  detail::openmp_target::scan_inplace<true>(begin, end, f, BinFn::identity());
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>>
+exclusive_inplace(
+    resources::Omp omp_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  detail::openmp_target::scan_inplace<false>(begin, end, f, v);
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>>
+inclusive(
+    resources::Omp omp_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  detail::openmp_target::copy(begin, end, out);
+  return inclusive_inplace(omp_res, exec, out, out + distance(begin, end), f);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>>
+exclusive(
+    resources::Omp omp_res,
+    const ExecPolicy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  detail::openmp_target::copy(begin, end, out);
+  return exclusive_inplace(omp_res, exec, out, out + distance(begin, end), f, v);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TARGET_OPENMP guard
+
+#endif  // closing endif for header file include guard
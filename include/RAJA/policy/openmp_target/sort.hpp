@@ -0,0 +1,430 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_target_HPP
+#define RAJA_sort_openmp_target_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/openmp_target/policy.hpp"
+#include "RAJA/policy/openmp_target/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+namespace openmp_target
+{
+
+// maximum number of chunks the radix sort splits the range into, each chunk
+// is counted and scattered by one device thread
+constexpr int get_max_radix_sort_chunks() { return 1 << 12; }
+
+// length of the runs the merge sort insertion sorts before merging
+constexpr int get_merge_sort_run_size() { return 16; }
+
+using RAJA::impl::scan::detail::openmp_target::device_alloc;
+
+/*!
+        \brief copy n keys and vals if vals is not null on the device
+*/
+template <typename Key, typename Val, typename diff_type>
+inline void copy_pairs(Key* keys_src, Val* vals_src,
+                       Key* keys_dst, Val* vals_dst, diff_type n)
+{
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(n) is_device_ptr(keys_src, vals_src, keys_dst, vals_dst)
+  for (diff_type i = 0; i < n; ++i) {
+    keys_dst[i] = keys_src[i];
+    if (vals_src != nullptr) {
+      vals_dst[i] = vals_src[i];
+    }
+  }
+}
+
+/*!
+        \brief stable lsd radix sort on the device given range of keys and
+               vals if vals is not null in ascending or descending order
+
+        Each chunk of the range counts its digits, the counts are scanned
+        in digit then chunk order to get the position of the first key of
+        each digit in each chunk, and each chunk scatters its keys in order.
+*/
+template <bool Descending, typename Key, typename Val>
+inline void radix_sort(Key* keys, Key* keys_end, Val* vals)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Key*>;
+  using radix = RAJA::impl::sort::detail::openmp::radix_key<Key, Descending>;
+  constexpr int digit_bits =
+      RAJA::impl::sort::detail::openmp::get_radix_sort_digit_bits();
+  constexpr diff_type radix_size = diff_type(1) << digit_bits;
+
+  const diff_type n = keys_end - keys;
+  if (n <= 1) {
+    return;
+  }
+
+  const diff_type num_chunks =
+      (n < static_cast<diff_type>(get_max_radix_sort_chunks()))
+        ? n : static_cast<diff_type>(get_max_radix_sort_chunks());
+
+  const int device = omp_get_default_device();
+
+  Key* keys_buf = device_alloc<Key>(n, device);
+  Val* vals_buf = (vals != nullptr) ? device_alloc<Val>(n, device) : nullptr;
+  diff_type* counts = device_alloc<diff_type>(radix_size * num_chunks, device);
+
+  Key* keys_src = keys;
+  Key* keys_dst = keys_buf;
+  Val* vals_src = vals;
+  Val* vals_dst = vals_buf;
+
+  for (int shift = 0; shift < radix::num_bits; shift += digit_bits) {
+
+    // count the digits in each chunk
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(n, num_chunks, shift) is_device_ptr(keys_src, counts)
+    for (diff_type c = 0; c < num_chunks; ++c) {
+      const diff_type i_begin = firstIndex(n, num_chunks, c);
+      const diff_type i_end   = firstIndex(n, num_chunks, c + 1);
+      for (diff_type d = 0; d < radix_size; ++d) {
+        counts[d * num_chunks + c] = 0;
+      }
+      for (diff_type i = i_begin; i < i_end; ++i) {
+        const diff_type d = static_cast<diff_type>(
+            (radix::to_bits(keys_src[i]) >> shift) & (radix_size - 1));
+        ++counts[d * num_chunks + c];
+      }
+    }
+
+    // turn the counts into offsets ordered by digit then chunk
+    RAJA::impl::scan::detail::openmp_target::scan_inplace<false>(
+        counts, counts + radix_size * num_chunks,
+        operators::plus<diff_type>{}, diff_type(0));
+
+    // scatter the keys of each chunk in order
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(n, num_chunks, shift) \
+    is_device_ptr(keys_src, keys_dst, vals_src, vals_dst, counts)
+    for (diff_type c = 0; c < num_chunks; ++c) {
+      const diff_type i_begin = firstIndex(n, num_chunks, c);
+      const diff_type i_end   = firstIndex(n, num_chunks, c + 1);
+      for (diff_type i = i_begin; i < i_end; ++i) {
+        const diff_type d = static_cast<diff_type>(
+            (radix::to_bits(keys_src[i]) >> shift) & (radix_size - 1));
+        const diff_type pos = counts[d * num_chunks + c]++;
+        keys_dst[pos] = keys_src[i];
+        if (vals_src != nullptr) {
+          vals_dst[pos] = vals_src[i];
+        }
+      }
+    }
+
+    std::swap(keys_src, keys_dst);
+    std::swap(vals_src, vals_dst);
+  }
+
+  if (keys_src != keys) {
+    copy_pairs(keys_src, vals_src, keys, vals, n);
+  }
+
+  omp_target_free(counts, device);
+  if (vals_buf != nullptr) {
+    omp_target_free(vals_buf, device);
+  }
+  omp_target_free(keys_buf, device);
+}
+
+/*!
+        \brief stable merge sort on the device given range of keys and vals
+               if vals is not null using comparison function on keys
+
+        Each device thread insertion sorts a short run, then runs are
+        merged pairwise until one run is left.
+*/
+template <typename Key, typename Val, typename Compare>
+inline void merge_sort(Key* keys, Key* keys_end, Val* vals, Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Key*>;
+  constexpr diff_type run_size = get_merge_sort_run_size();
+
+  const diff_type n = keys_end - keys;
+  if (n <= 1) {
+    return;
+  }
+
+  const int device = omp_get_default_device();
+
+  const diff_type num_runs = RAJA_DIVIDE_CEILING_INT(n, run_size);
+
+  // insertion sort each run in place
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(comp, n) is_device_ptr(keys, vals)
+  for (diff_type r = 0; r < num_runs; ++r) {
+    const diff_type lo = r * run_size;
+    const diff_type hi = (lo + run_size < n) ? lo + run_size : n;
+    for (diff_type i = lo + 1; i < hi; ++i) {
+      Key key = keys[i];
+      Val val;
+      if (vals != nullptr) {
+        val = vals[i];
+      }
+      diff_type j = i;
+      for (; j > lo && comp(key, keys[j - 1]); --j) {
+        keys[j] = keys[j - 1];
+        if (vals != nullptr) {
+          vals[j] = vals[j - 1];
+        }
+      }
+      keys[j] = key;
+      if (vals != nullptr) {
+        vals[j] = val;
+      }
+    }
+  }
+
+  if (n <= run_size) {
+    return;
+  }
+
+  Key* keys_buf = device_alloc<Key>(n, device);
+  Val* vals_buf = (vals != nullptr) ? device_alloc<Val>(n, device) : nullptr;
+
+  Key* keys_src = keys;
+  Key* keys_dst = keys_buf;
+  Val* vals_src = vals;
+  Val* vals_dst = vals_buf;
+
+  for (diff_type width = run_size; width < n; width *= 2) {
+
+    const diff_type num_merges = RAJA_DIVIDE_CEILING_INT(n, 2 * width);
+
+    // merge pairs of adjacent runs, taking from the left run on ties
+#pragma omp target teams distribute parallel for schedule(static, 1) \
+    firstprivate(comp, n, width) \
+    is_device_ptr(keys_src, keys_dst, vals_src, vals_dst)
+    for (diff_type m = 0; m < num_merges; ++m) {
+      const diff_type lo  = 2 * width * m;
+      const diff_type mid = (lo + width < n) ? lo + width : n;
+      const diff_type hi  = (lo + 2 * width < n) ? lo + 2 * width : n;
+      diff_type i = lo;
+      diff_type j = mid;
+      for (diff_type k = lo; k < hi; ++k) {
+        const bool take_right =
+            (j < hi) && (i >= mid || comp(keys_src[j], keys_src[i]));
+        const diff_type from = take_right ? j++ : i++;
+        keys_dst[k] = keys_src[from];
+        if (vals_src != nullptr) {
+          vals_dst[k] = vals_src[from];
+        }
+      }
+    }
+
+    std::swap(keys_src, keys_dst);
+    std::swap(vals_src, vals_dst);
+  }
+
+  if (keys_src != keys) {
+    copy_pairs(keys_src, vals_src, keys, vals, n);
+  }
+
+  if (vals_buf != nullptr) {
+    omp_target_free(vals_buf, device);
+  }
+  omp_target_free(keys_buf, device);
+}
+
+/*!
+        \brief sort given range using sorter and comparison function,
+               radix sort the keys if possible
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<RAJA::impl::sort::detail::openmp::can_radix_sort<Sorter, Iter, Compare>>
+sort(Sorter,
+     Iter begin,
+     Iter end,
+     Compare)
+{
+  using Key = RAJA::detail::IterVal<Iter>;
+
+  radix_sort<std::is_same<Compare, operators::greater<Key>>::value>(
+      begin, end, static_cast<Key*>(nullptr));
+}
+///
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<
+    RAJA::impl::sort::detail::openmp::can_radix_sort<Sorter, Iter, Compare>>>
+sort(Sorter,
+     Iter begin,
+     Iter end,
+     Compare comp)
+{
+  using Key = RAJA::detail::IterVal<Iter>;
+
+  merge_sort(begin, end, static_cast<Key*>(nullptr), comp);
+}
+
+/*!
+        \brief sort given range of pairs using sorter and comparison
+               function on keys, radix sort the pairs if possible
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<RAJA::impl::sort::detail::openmp::can_radix_sort<Sorter, KeyIter, Compare>>
+sort_pairs(Sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare)
+{
+  using Key = RAJA::detail::IterVal<KeyIter>;
+
+  radix_sort<std::is_same<Compare, operators::greater<Key>>::value>(
+      keys_begin, keys_end, vals_begin);
+}
+///
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<
+    RAJA::impl::sort::detail::openmp::can_radix_sort<Sorter, KeyIter, Compare>>>
+sort_pairs(Sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  merge_sort(keys_begin, keys_end, vals_begin, comp);
+}
+
+} // namespace openmp_target
+
+} // namespace detail
+
+/*!
+        \brief sort given range using comparison function,
+               the range must be a pointer to device memory
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>,
+                      std::is_pointer<Iter>>
+unstable(
+    resources::Omp omp_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::openmp_target::sort(detail::UnstableSorter{}, begin, end, comp);
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function,
+               the range must be a pointer to device memory
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>,
+                      std::is_pointer<Iter>>
+stable(
+    resources::Omp omp_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::openmp_target::sort(detail::StableSorter{}, begin, end, comp);
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys,
+               the ranges must be pointers to device memory
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>>
+unstable_pairs(
+    resources::Omp omp_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::openmp_target::sort_pairs(detail::UnstableSorter{}, keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on
+               keys, the ranges must be pointers to device memory
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Omp>,
+                      type_traits::is_target_openmp_policy<ExecPolicy>,
+                      std::is_pointer<KeyIter>,
+                      std::is_pointer<ValIter>>
+stable_pairs(
+    resources::Omp omp_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::openmp_target::sort_pairs(detail::StableSorter{}, keys_begin, keys_end, vals_begin, comp);
+
+  return resources::EventProxy<resources::Omp>(omp_res);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TARGET_OPENMP guard
+
+#endif  // closing endif for header file include guard
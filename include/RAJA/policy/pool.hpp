@@ -0,0 +1,32 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for thread pool execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pool_HPP
+#define RAJA_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_POOL)
+
+#include "RAJA/policy/pool/ThreadPool.hpp"
+#include "RAJA/policy/pool/forall.hpp"
+#include "RAJA/policy/pool/launch.hpp"
+#include "RAJA/policy/pool/policy.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,271 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent thread pool used by the
+ *          RAJA pool execution policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_pool_ThreadPool_HPP
+#define RAJA_policy_pool_ThreadPool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_POOL)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace RAJA
+{
+namespace policy
+{
+namespace pool
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent pool of worker threads.
+ *
+ *         The threads of the pool are created on first use and live until
+ *         program exit. Between jobs the workers spin for a while before
+ *         they sleep on a condition variable, so back-to-back jobs do not pay
+ *         for waking threads. The calling thread participates in each job
+ *         as thread 0 and joins the workers with a counter.
+ *
+ *         The number of threads is read from RAJA_POOL_NUM_THREADS or else
+ *         is the number of hardware threads. On linux the workers are bound
+ *         in order to the cpus the process may run on, so contiguous chunks
+ *         of a static partition stay on the same cores (and NUMA domain)
+ *         from one job to the next. The calling thread is not bound.
+ *
+ ******************************************************************************
+ */
+class ThreadPool
+{
+public:
+  static ThreadPool& getInstance()
+  {
+    static ThreadPool pool{};
+    return pool;
+  }
+
+  ///
+  /// Number of threads running a job, including the calling thread.
+  ///
+  int numThreads() const { return m_num_threads; }
+
+  ///
+  /// Run func(thread_id, num_threads) on each thread of the pool and return
+  /// once every thread has finished. Calls from inside a job run func on
+  /// the calling thread only.
+  ///
+  template <typename Func>
+  void run(Func&& func)
+  {
+    if (m_num_threads == 1 || in_job()) {
+      func(0, 1);
+      return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+    m_job_data = static_cast<void*>(&func);
+    m_job = &call_job<typename std::remove_reference<Func>::type>;
+    m_remaining.store(m_num_threads - 1, std::memory_order_relaxed);
+
+    m_generation.fetch_add(1);
+    if (m_num_sleeping.load() > 0) {
+      std::lock_guard<std::mutex> sleep_lock(m_sleep_mutex);
+      m_sleep_cv.notify_all();
+    }
+
+    in_job() = true;
+    func(0, m_num_threads);
+    in_job() = false;
+
+    for (int spins = 1; m_remaining.load(std::memory_order_acquire) != 0;
+         ++spins) {
+      backoff(spins);
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool()
+  {
+    m_stop.store(true);
+    m_generation.fetch_add(1);
+    {
+      std::lock_guard<std::mutex> sleep_lock(m_sleep_mutex);
+      m_sleep_cv.notify_all();
+    }
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+private:
+  // number of polls of the job generation before a worker sleeps
+  static constexpr int s_spin_count = 1 << 16;
+
+  ThreadPool() : m_num_threads(get_num_threads())
+  {
+    get_allowed_cpus();
+    m_workers.reserve(m_num_threads - 1);
+    for (int tid = 1; tid < m_num_threads; ++tid) {
+      m_workers.emplace_back([this, tid]() { worker_loop(tid); });
+    }
+  }
+
+  template <typename Func>
+  static void call_job(void* data, int tid, int num_threads)
+  {
+    (*static_cast<Func*>(data))(tid, num_threads);
+  }
+
+  static bool& in_job()
+  {
+    static thread_local bool in_job = false;
+    return in_job;
+  }
+
+  static void cpu_relax()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+  }
+
+  // yield now and then so spinning does not starve oversubscribed threads
+  static void backoff(int spins)
+  {
+    if (spins % 64 == 0) {
+      std::this_thread::yield();
+    } else {
+      cpu_relax();
+    }
+  }
+
+  static int get_num_threads()
+  {
+    int num_threads = 0;
+    if (const char* env = std::getenv("RAJA_POOL_NUM_THREADS")) {
+      num_threads = std::atoi(env);
+    }
+    if (num_threads <= 0) {
+      num_threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    return (num_threads > 0) ? num_threads : 1;
+  }
+
+  void get_allowed_cpus()
+  {
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &allowed)) {
+          m_cpus.push_back(cpu);
+        }
+      }
+    }
+#endif
+  }
+
+  void bind_to_cpu(int tid) const
+  {
+#if defined(__linux__)
+    if (!m_cpus.empty()) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      CPU_SET(m_cpus[tid % m_cpus.size()], &cpuset);
+      pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+    }
+#else
+    (void)tid;
+#endif
+  }
+
+  void worker_loop(int tid)
+  {
+    bind_to_cpu(tid);
+    in_job() = true;
+
+    unsigned seen = 0;
+    for (;;) {
+      unsigned generation;
+      int spins = 0;
+      while ((generation = m_generation.load(std::memory_order_acquire)) ==
+             seen) {
+        if (++spins < s_spin_count) {
+          backoff(spins);
+          continue;
+        }
+        std::unique_lock<std::mutex> sleep_lock(m_sleep_mutex);
+        ++m_num_sleeping;
+        m_sleep_cv.wait(sleep_lock,
+                        [&]() { return m_generation.load() != seen; });
+        --m_num_sleeping;
+        spins = 0;
+      }
+      seen = generation;
+
+      if (m_stop.load()) {
+        return;
+      }
+
+      m_job(m_job_data, tid, m_num_threads);
+      m_remaining.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  const int m_num_threads;
+  std::vector<int> m_cpus;
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_run_mutex;
+  void (*m_job)(void*, int, int) = nullptr;
+  void* m_job_data = nullptr;
+
+  std::atomic<unsigned> m_generation{0};
+  std::atomic<int> m_remaining{0};
+  std::atomic<bool> m_stop{false};
+
+  std::mutex m_sleep_mutex;
+  std::condition_variable m_sleep_cv;
+  std::atomic<int> m_num_sleeping{0};
+};
+
+}  // namespace pool
+}  // namespace policy
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_POOL)
+
+#endif  // closing endif for header file include guard
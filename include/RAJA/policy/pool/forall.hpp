@@ -0,0 +1,159 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the persistent thread pool.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_pool_HPP
+#define RAJA_forall_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_POOL)
+
+#include <vector>
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/policy/pool/ThreadPool.hpp"
+#include "RAJA/policy/pool/policy.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace pool
+{
+
+namespace internal
+{
+
+  //
+  // Run the iterations [0, len) assigned to thread tid of num_threads.
+  //
+  template <int ChunkSize, typename Iterator, typename Distance, typename Func>
+  RAJA_INLINE void forall_chunks(Iterator begin_it,
+                                 Distance len,
+                                 int tid,
+                                 int num_threads,
+                                 Func&& func)
+  {
+    if (ChunkSize <= 0) {
+      const Distance i_begin = (len * tid) / num_threads;
+      const Distance i_end = (len * (tid + 1)) / num_threads;
+      for (Distance i = i_begin; i < i_end; ++i) {
+        func(begin_it[i]);
+      }
+    } else {
+      const Distance stride = static_cast<Distance>(ChunkSize) * num_threads;
+      for (Distance c = static_cast<Distance>(ChunkSize) * tid; c < len;
+           c += stride) {
+        const Distance c_end = (c + ChunkSize < len) ? c + ChunkSize : len;
+        for (Distance i = c; i < c_end; ++i) {
+          func(begin_it[i]);
+        }
+      }
+    }
+  }
+
+}  // namespace internal
+
+/**
+ * @brief Thread pool static for implementation
+ *
+ * This forall statically partitions the iterable among the threads of the
+ * persistent thread pool. The threads are not created or woken for each
+ * loop, which keeps the overhead of small loops low.
+ */
+template <typename Iterable, typename Func, int ChunkSize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(resources::Host host_res,
+            const pool_for_static<ChunkSize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  ThreadPool::getInstance().run([&](int tid, int num_threads) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    internal::forall_chunks<ChunkSize>(begin_it, distance_it, tid, num_threads, body);
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, int ChunkSize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(resources::Host host_res,
+            const pool_for_static<ChunkSize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = pool_for_static<ChunkSize>;
+  RAJA_EXTRACT_BED_IT(iter);
+
+  ThreadPool& pool = ThreadPool::getInstance();
+
+  expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+
+  // each thread reduces into its own copy of the initialized params
+  std::vector<ForallParam> thread_params(pool.numThreads(), f_params);
+
+  pool.run([&](int tid, int num_threads) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    ForallParam& fp = thread_params[tid];
+    internal::forall_chunks<ChunkSize>(begin_it, distance_it, tid, num_threads,
+        [&](decltype(*begin_it) idx) { expt::invoke_body(fp, body, idx); });
+  });
+
+  for (ForallParam& fp : thread_params) {
+    expt::ParamMultiplexer::combine<EXEC_POL>(f_params, fp);
+  }
+
+  expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace pool
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,78 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the RAJA::loop implementation for
+ *          the persistent thread pool.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_pool_HPP
+#define RAJA_pattern_launch_pool_HPP
+
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/policy/pool/ThreadPool.hpp"
+#include "RAJA/policy/pool/forall.hpp"
+#include "RAJA/policy/pool/policy.hpp"
+
+
+namespace RAJA
+{
+
+//
+// Loops using the pool inside a host launch (e.g. seq_launch_t) run in
+// parallel on the thread pool.
+//
+template <int ChunkSize, typename SEGMENT>
+struct LoopExecute<pool_for_static<ChunkSize>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    policy::pool::ThreadPool::getInstance().run([&](int tid, int num_threads) {
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      policy::pool::internal::forall_chunks<ChunkSize>(
+          segment.begin(), len, tid, num_threads, loop_body.get_priv());
+    });
+  }
+};
+
+template <int ChunkSize, typename SEGMENT>
+struct LoopICountExecute<pool_for_static<ChunkSize>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    policy::pool::ThreadPool::getInstance().run([&](int tid, int num_threads) {
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      auto &priv_body = loop_body.get_priv();
+      policy::pool::internal::forall_chunks<ChunkSize>(
+          RAJA::TypedRangeSegment<int>(0, len).begin(), len, tid, num_threads,
+          [&](int i) { priv_body(*(segment.begin() + i), i); });
+    });
+  }
+};
+
+}  // namespace RAJA
+#endif
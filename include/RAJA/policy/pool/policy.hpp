@@ -0,0 +1,69 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_pool_HPP
+#define policy_pool_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace pool
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+/// Iterations are statically partitioned among the threads of the
+/// persistent thread pool. With ChunkSize == 0 each thread runs one
+/// contiguous block of iterations, otherwise chunks of ChunkSize iterations
+/// are dealt to the threads round-robin.
+///
+template <int ChunkSize = 0>
+struct pool_for_static : make_policy_pattern_launch_platform_t<Policy::pool,
+                                                               Pattern::forall,
+                                                               Launch::sync,
+                                                               Platform::host> {
+};
+
+using pool_exec = pool_for_static<>;
+
+///
+/// Index set segment iteration policies
+///
+using pool_segit = pool_exec;
+
+}  // namespace pool
+}  // namespace policy
+
+using policy::pool::pool_exec;
+using policy::pool::pool_for_static;
+using policy::pool::pool_segit;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,155 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the declarations of the reducers, memory pools,
+ *          scans and sorts compiled into the RAJA library when it is built
+ *          with RAJA_ENABLE_PREBUILT.
+ *
+ *          The reducers and memory pools are explicit instantiation
+ *          declarations, so translation units including RAJA use the
+ *          instantiations in the library rather than compiling their own.
+ *          The GPU scans and sorts are overloads for the common policies
+ *          and types, which overload resolution prefers to the templates of
+ *          the back-ends, so the cub and rocprim algorithms are only
+ *          compiled in the library.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_prebuilt_HPP
+#define RAJA_policy_prebuilt_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_PREBUILT)
+
+#include <cstdint>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
+
+/*!
+ * Call M(BLOCK_SIZE, ASYNC, T) for the policies and value types the scans
+ * and sorts are prebuilt for.
+ */
+#define RAJA_PREBUILT_ALGORITHM_TYPES(M, BLOCK_SIZE, ASYNC) \
+  M(BLOCK_SIZE, ASYNC, double)                            \
+  M(BLOCK_SIZE, ASYNC, int)                               \
+  M(BLOCK_SIZE, ASYNC, std::int64_t)
+
+#define RAJA_PREBUILT_ALGORITHM_POLICIES(M)       \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 128, false)    \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 256, false)    \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 512, false)    \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 1024, false)   \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 128, true)     \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 256, true)     \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 512, true)     \
+  RAJA_PREBUILT_ALGORITHM_TYPES(M, 1024, true)
+
+/*!
+ * Declare the prebuilt scans and sorts of a GPU back-end with resource RES
+ * and execution policy POL<BLOCK_SIZE, ASYNC>.
+ */
+#define RAJA_PREBUILT_DECLARE_ALGORITHMS(RES, POL, BLOCK_SIZE, ASYNC, T)     \
+  namespace scan                                                            \
+  {                                                                         \
+  resources::EventProxy<RES> inclusive_inplace(RES,                         \
+                                               POL<BLOCK_SIZE, ASYNC>,      \
+                                               T*,                          \
+                                               T*,                          \
+                                               operators::plus<T>);         \
+  resources::EventProxy<RES> exclusive_inplace(RES,                         \
+                                               POL<BLOCK_SIZE, ASYNC>,      \
+                                               T*,                          \
+                                               T*,                          \
+                                               operators::plus<T>,          \
+                                               T);                          \
+  }                                                                         \
+  namespace sort                                                            \
+  {                                                                         \
+  resources::EventProxy<RES> unstable(RES,                                  \
+                                      POL<BLOCK_SIZE, ASYNC>,               \
+                                      T*,                                   \
+                                      T*,                                   \
+                                      operators::less<T>);                  \
+  resources::EventProxy<RES> stable(RES,                                    \
+                                    POL<BLOCK_SIZE, ASYNC>,                 \
+                                    T*,                                     \
+                                    T*,                                     \
+                                    operators::less<T>);                    \
+  }
+
+namespace RAJA
+{
+
+extern template class ReduceSum<seq_reduce, double>;
+extern template class ReduceSum<seq_reduce, int>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+extern template class ReduceSum<omp_reduce, double>;
+extern template class ReduceSum<omp_reduce, int>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+extern template class ReduceSum<cuda_reduce, double>;
+extern template class ReduceSum<cuda_reduce, int>;
+extern template class ReduceSum<cuda_reduce_atomic, double>;
+extern template class ReduceSum<cuda_reduce_atomic, int>;
+
+extern template class basic_mempool::MemPool<cuda::DeviceAllocator>;
+extern template class basic_mempool::MemPool<cuda::DeviceZeroedAllocator>;
+extern template class basic_mempool::MemPool<cuda::PinnedAllocator>;
+#if defined(RAJA_ENABLE_SLAB_MEMPOOL)
+extern template class basic_mempool::SlabPool<cuda::DeviceAllocator>;
+extern template class basic_mempool::SlabPool<cuda::DeviceZeroedAllocator>;
+extern template class basic_mempool::SlabPool<cuda::PinnedAllocator>;
+#endif
+
+namespace impl
+{
+#define RAJA_PREBUILT_DECLARE_CUDA(BLOCK_SIZE, ASYNC, T) \
+  RAJA_PREBUILT_DECLARE_ALGORITHMS(                   \
+      resources::Cuda, cuda_exec, BLOCK_SIZE, ASYNC, T)
+RAJA_PREBUILT_ALGORITHM_POLICIES(RAJA_PREBUILT_DECLARE_CUDA)
+#undef RAJA_PREBUILT_DECLARE_CUDA
+}  // namespace impl
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+extern template class ReduceSum<hip_reduce, double>;
+extern template class ReduceSum<hip_reduce, int>;
+
+extern template class basic_mempool::MemPool<hip::DeviceAllocator>;
+extern template class basic_mempool::MemPool<hip::DeviceZeroedAllocator>;
+extern template class basic_mempool::MemPool<hip::PinnedAllocator>;
+#if defined(RAJA_ENABLE_SLAB_MEMPOOL)
+extern template class basic_mempool::SlabPool<hip::DeviceAllocator>;
+extern template class basic_mempool::SlabPool<hip::DeviceZeroedAllocator>;
+extern template class basic_mempool::SlabPool<hip::PinnedAllocator>;
+#endif
+
+namespace impl
+{
+#define RAJA_PREBUILT_DECLARE_HIP(BLOCK_SIZE, ASYNC, T) \
+  RAJA_PREBUILT_DECLARE_ALGORITHMS(                   \
+      resources::Hip, hip_exec, BLOCK_SIZE, ASYNC, T)
+RAJA_PREBUILT_ALGORITHM_POLICIES(RAJA_PREBUILT_DECLARE_HIP)
+#undef RAJA_PREBUILT_DECLARE_HIP
+}  // namespace impl
+#endif
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_PREBUILT
+
+#endif  // closing endif for header file include guard
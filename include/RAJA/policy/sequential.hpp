@@ -28,6 +28,9 @@
 #include "RAJA/policy/sequential/kernel.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
+#include "RAJA/policy/sequential/compact.hpp"
+#include "RAJA/policy/sequential/sweep.hpp"
+#include "RAJA/policy/sequential/spmv.hpp"
 #include "RAJA/policy/sequential/scan.hpp"
 #include "RAJA/policy/sequential/sort.hpp"
 #include "RAJA/policy/sequential/launch.hpp"
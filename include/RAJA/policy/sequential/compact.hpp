@@ -0,0 +1,208 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_sequential_HPP
+#define RAJA_compact_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+/*!
+        \brief explicit copy if given input range, output, count output, and
+   predicate
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+copy_if(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  DistanceT count = 0;
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    if (pred(begin[i])) {
+      out[count++] = begin[i];
+    }
+  }
+  *num_selected = static_cast<CountT>(count);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit partition given input range, output, count output, and
+   predicate
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+partition(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  DistanceT count = 0;
+  DistanceT rejected = 0;
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    if (pred(begin[i])) {
+      out[count++] = begin[i];
+    } else {
+      out[n - 1 - rejected++] = begin[i];
+    }
+  }
+  *num_selected = static_cast<CountT>(count);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit unique given input range, output, count output, and
+   equality function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+unique(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Compare eq)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  DistanceT count = 0;
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    if (i == 0 || !eq(begin[i - 1], begin[i])) {
+      out[count++] = begin[i];
+    }
+  }
+  *num_selected = static_cast<CountT>(count);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit reduce by key given key and value input ranges, key
+   and value outputs, count output, and reduction function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename CountIter,
+          typename BinaryOp>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const KeyIter keys_begin,
+    const KeyIter keys_end,
+    const ValueIter values,
+    OutKeyIter out_keys,
+    OutValueIter out_values,
+    CountIter num_segments,
+    BinaryOp op)
+{
+  using std::distance;
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+  const auto n = distance(keys_begin, keys_end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  DistanceT count = 0;
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    if (i == 0 || !(keys_begin[i - 1] == keys_begin[i])) {
+      out_keys[count] = keys_begin[i];
+      out_values[count] = values[i];
+      ++count;
+    } else {
+      out_values[count - 1] = op(out_values[count - 1], values[i]);
+    }
+  }
+  *num_segments = static_cast<CountT>(count);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -60,6 +60,7 @@ RAJA_INLINE
 concepts::enable_if_t<
   resources::EventProxy<Resource>,
   expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
   concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
   >
 forall_impl(Resource res,
@@ -68,7 +69,7 @@ forall_impl(Resource res,
             Func &&body,
             ForallParam f_params)
 {
-  RAJA_EXTRACT_BED_IT(iter);
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
 
   expt::ParamMultiplexer::init<seq_exec>(f_params);
 
@@ -86,6 +87,7 @@ RAJA_INLINE
 concepts::enable_if_t<
   resources::EventProxy<Resource>,
   expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
   expt::type_traits::is_ForallParamPack_empty<ForallParam>
   >
 forall_impl(Resource res,
@@ -93,16 +95,198 @@ forall_impl(Resource res,
             Iterable &&iter,
             Func &&body,
             ForallParam)
+{
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
+
+  RAJA_NO_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    body(*(begin_it + i));
+  }
+  return resources::EventProxy<Resource>(res);
+}
+
+//
+// Compressed segments visit their indices by decoding them in order.
+//
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  type_traits::is_compressed_segment<camp::decay<Iterable>>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(Resource res,
+            const seq_exec &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam f_params)
+{
+  expt::ParamMultiplexer::init<seq_exec>(f_params);
+
+  iter.for_each_index([&](auto idx) {
+    expt::invoke_body(f_params, body, idx);
+  });
+
+  expt::ParamMultiplexer::resolve<seq_exec>(f_params);
+  return resources::EventProxy<Resource>(res);
+}
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  type_traits::is_compressed_segment<camp::decay<Iterable>>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(Resource res,
+            const seq_exec &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam)
+{
+  iter.for_each_index(body);
+  return resources::EventProxy<Resource>(res);
+}
+
+//
+// seq_exec_prefetch prefetches the gathers of the Prefetch params Distance
+// iterations ahead. Without params, or for compressed segments, it runs as
+// seq_exec.
+//
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam, int Distance>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(Resource res,
+            const seq_exec_prefetch<Distance> &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam f_params)
 {
   RAJA_EXTRACT_BED_IT(iter);
 
+  expt::ParamMultiplexer::init<seq_exec>(f_params);
+
   RAJA_NO_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    expt::prefetch_ahead<Distance>(f_params, begin_it, i, distance_it);
+    expt::invoke_body(f_params, body, *(begin_it + i));
+  }
+
+  expt::ParamMultiplexer::resolve<seq_exec>(f_params);
+  return resources::EventProxy<Resource>(res);
+}
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam, int Distance>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::any_of<type_traits::is_compressed_segment<camp::decay<Iterable>>,
+                   expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(Resource res,
+            const seq_exec_prefetch<Distance> &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam f_params)
+{
+  return forall_impl(res,
+                     seq_exec{},
+                     std::forward<Iterable>(iter),
+                     std::forward<Func>(body),
+                     f_params);
+}
+
+//
+// seq_exec_restrict runs a local copy of the body, so the compiler sees that
+// stores through the pointers the body captured can not change them, in a
+// loop marked free of dependences between iterations and unrolled by 4.
+// Compressed segments run as seq_exec.
+//
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(Resource res,
+            const seq_exec_restrict &,
+            Iterable &&iter,
+            Func &&loop_body,
+            ForallParam f_params)
+{
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
+  camp::decay<Func> body(loop_body);
+
+  expt::ParamMultiplexer::init<seq_exec>(f_params);
+
+  RAJA_IVDEP
+  RAJA_UNROLL_COUNT(4)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    expt::invoke_body(f_params, body, *(begin_it + i));
+  }
+
+  expt::ParamMultiplexer::resolve<seq_exec>(f_params);
+  return resources::EventProxy<Resource>(res);
+}
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<type_traits::is_compressed_segment<camp::decay<Iterable>>>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(Resource res,
+            const seq_exec_restrict &,
+            Iterable &&iter,
+            Func &&loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
+  camp::decay<Func> body(loop_body);
+
+  RAJA_IVDEP
+  RAJA_UNROLL_COUNT(4)
   for (decltype(distance_it) i = 0; i < distance_it; ++i) {
     body(*(begin_it + i));
   }
   return resources::EventProxy<Resource>(res);
 }
 
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  type_traits::is_compressed_segment<camp::decay<Iterable>>
+  >
+forall_impl(Resource res,
+            const seq_exec_restrict &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam f_params)
+{
+  return forall_impl(res,
+                     seq_exec{},
+                     std::forward<Iterable>(iter),
+                     std::forward<Func>(body),
+                     f_params);
+}
+
 }  // namespace sequential
 
 }  // namespace policy
@@ -26,6 +26,31 @@ namespace detail {
     *red.target = OP{}(red.val, *red.target);
   }
 
+  //
+  // MultiReducer
+  //
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  init(MultiReducer<OP, T>& red) {
+    red.bins.num_slices = 1;
+    red.bins.data = new T[red.bins.num_bins];
+    red.fill_slices(red.bins.data, red.bins.num_slices);
+  }
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  combine(MultiReducer<OP, T>&, const MultiReducer<OP, T>&) {}
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  resolve(MultiReducer<OP, T>& red) {
+    red.resolve_slices(red.bins.data, red.bins.num_slices);
+    delete[] red.bins.data;
+    red.bins.data = nullptr;
+  }
+
 } //  namespace detail
 } //  namespace expt
 } //  namespace RAJA
@@ -57,6 +57,29 @@ struct seq_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                         Platform::host> {
 };
 
+///
+/// seq_exec that prefetches the elements the views of a
+/// RAJA::expt::Prefetch param gather Distance iterations ahead
+///
+template <int Distance>
+struct seq_exec_prefetch : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                                 Pattern::forall,
+                                                                 Launch::undefined,
+                                                                 Platform::host> {
+  static_assert(Distance > 0, "Prefetch distance must be positive");
+};
+
+///
+/// seq_exec whose loop tells the host compiler that the data the loop body
+/// writes through its pointers and Views is not read or written through
+/// others, so it may be vectorized, and unrolls it
+///
+struct seq_exec_restrict : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                                 Pattern::forall,
+                                                                 Launch::undefined,
+                                                                 Platform::host> {
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -99,6 +122,8 @@ struct seq_atomic {
 
 using policy::sequential::seq_atomic;
 using policy::sequential::seq_exec;
+using policy::sequential::seq_exec_prefetch;
+using policy::sequential::seq_exec_restrict;
 using policy::sequential::seq_reduce;
 using policy::sequential::seq_region;
 using policy::sequential::seq_segit;
@@ -28,6 +28,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
 
 namespace RAJA
@@ -51,7 +53,7 @@ inclusive_inplace(
     Iter end,
     BinFn f)
 {
-  using ValueT = typename std::remove_reference<decltype(*begin)>::type;
+  using ValueT = RAJA::detail::IterVal<Iter>;
   ValueT agg = *begin;
 
   RAJA_NO_SIMD
@@ -83,12 +85,12 @@ exclusive_inplace(
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
 
-  using ValueT = typename std::remove_reference<decltype(*begin)>::type;
+  using ValueT = RAJA::detail::IterVal<Iter>;
   ValueT agg = v;
 
   RAJA_NO_SIMD
   for (DistanceT i = 0; i < n; ++i) {
-    auto t = begin[i];
+    ValueT t = begin[i];
     begin[i] = agg;
     agg = f(agg, t);
   }
@@ -112,7 +114,7 @@ inclusive(
     OutIter out,
     BinFn f)
 {
-  using ValueT = typename std::remove_reference<decltype(*out)>::type;
+  using ValueT = RAJA::detail::IterVal<OutIter>;
   ValueT agg = *begin;
   *out++ = agg;
 
@@ -146,7 +148,7 @@ exclusive(
     BinFn f,
     T v)
 {
-  using ValueT = typename std::remove_reference<decltype(*out)>::type;
+  using ValueT = RAJA::detail::IterVal<OutIter>;
   ValueT agg = v;
   OutIter o = out;
   *o++ = v;
@@ -160,6 +162,80 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+
+/*!
+        \brief explicit inclusive segmented scan given input range, output,
+   segment offsets, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename OffsetIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy& exec,
+    const Iter begin,
+    const Iter,
+    OutIter out,
+    OffsetIter offsets,
+    int num_segments,
+    BinFn f)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    const auto seg_begin = offsets[s];
+    const auto seg_end = offsets[s + 1];
+    if (seg_begin != seg_end) {
+      inclusive(host_res, exec,
+                begin + seg_begin, begin + seg_end,
+                out + seg_begin, f);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, output,
+   segment offsets, function, and
+   initial value for each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename OffsetIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy& exec,
+    const Iter begin,
+    const Iter,
+    OutIter out,
+    OffsetIter offsets,
+    int num_segments,
+    BinFn f,
+    T v)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    const auto seg_begin = offsets[s];
+    const auto seg_end = offsets[s + 1];
+    if (seg_begin != seg_end) {
+      exclusive(host_res, exec,
+                begin + seg_begin, begin + seg_end,
+                out + seg_begin, f, v);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
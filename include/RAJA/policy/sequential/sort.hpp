@@ -108,6 +108,47 @@ stable_pairs(
       keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+unstable_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  return RAJA::impl::sort::unstable_segmented(host_res, ::RAJA::loop_exec{},
+      begin, end, offsets, num_segments, comp);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+unstable_segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  return RAJA::impl::sort::unstable_segmented_pairs(host_res, ::RAJA::loop_exec{},
+      keys_begin, keys_end, vals_begin, offsets, num_segments, comp);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -0,0 +1,85 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA spmv declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_spmv_sequential_HPP
+#define RAJA_spmv_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/spmv.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace spmv
+{
+
+/*!
+        \brief compute the rows of a CSR spmv in order
+*/
+template <typename ExecPolicy, typename T, typename IndexType>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+csr_spmv(resources::Host host_res,
+         const ExecPolicy &,
+         expt::CSRView<T, IndexType> const &A,
+         T const *x,
+         T *y)
+{
+  for (IndexType r = 0; r < A.num_rows; ++r) {
+    y[r] = expt::detail::csr_row_dot(A, x, r);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief compute the chunks of a SELL-C-sigma spmv in order
+*/
+template <typename ExecPolicy, typename T, typename IndexType>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+sell_spmv(resources::Host host_res,
+          const ExecPolicy &,
+          expt::SellMatrix<T, IndexType> const &A,
+          T const *x,
+          T *y)
+{
+  for (IndexType c = 0; c < A.num_chunks(); ++c) {
+    A.multiply_chunk(c, x, y);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace spmv
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
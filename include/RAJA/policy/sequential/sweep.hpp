@@ -0,0 +1,69 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA tiled sweep declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sweep_sequential_HPP
+#define RAJA_sweep_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/detail/sweep.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sweep
+{
+
+/*!
+        \brief run the tiles of a sweep one after the other in wavefront
+   order
+*/
+template <typename ExecPolicy, int DIM, typename Body>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_sequential_policy<ExecPolicy>>
+tiled_sweep(resources::Host host_res,
+            const ExecPolicy &,
+            expt::detail::SweepSpace<DIM> const &space,
+            Body const &body)
+{
+  const Index_type num_tiles = space.total_tiles();
+
+  Index_type t[DIM];
+  for (Index_type ticket = 0; ticket < num_tiles; ++ticket) {
+    space.decode(ticket, t);
+    space.for_each_cell(t, body);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace sweep
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -37,6 +37,7 @@
 
 #include "RAJA/policy/simd/policy.hpp"
 
+#include "RAJA/pattern/detail/forall.hpp"
 #include "RAJA/pattern/params/forall.hpp"
 
 namespace RAJA
@@ -62,11 +63,42 @@ forall_impl(RAJA::resources::Host host_res,
 {
   expt::ParamMultiplexer::init<seq_exec>(f_params);
 
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
+  RAJA_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    expt::invoke_body(f_params, loop_body, *(begin_it + i));
+  }
+
+  expt::ParamMultiplexer::resolve<seq_exec>(f_params);
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+//
+// simd_exec_prefetch prefetches the gathers of the Prefetch params Distance
+// iterations ahead, without params it runs as simd_exec.
+//
+
+template <typename Iterable, typename Func, typename ForallParam, int Distance>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(RAJA::resources::Host host_res,
+            const simd_exec_prefetch<Distance> &,
+            Iterable &&iter,
+            Func &&loop_body,
+            ForallParam f_params)
+{
+  expt::ParamMultiplexer::init<seq_exec>(f_params);
+
   auto begin = std::begin(iter);
   auto end = std::end(iter);
   auto distance = std::distance(begin, end);
   RAJA_SIMD
   for (decltype(distance) i = 0; i < distance; ++i) {
+    expt::prefetch_ahead<Distance>(f_params, begin, i, distance);
     expt::invoke_body(f_params, loop_body, *(begin + i));
   }
 
@@ -74,6 +106,26 @@ forall_impl(RAJA::resources::Host host_res,
   return RAJA::resources::EventProxy<resources::Host>(host_res);
 }
 
+template <typename Iterable, typename Func, typename ForallParam, int Distance>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(RAJA::resources::Host host_res,
+            const simd_exec_prefetch<Distance> &,
+            Iterable &&iter,
+            Func &&loop_body,
+            ForallParam f_params)
+{
+  return forall_impl(host_res,
+                     simd_exec{},
+                     std::forward<Iterable>(iter),
+                     std::forward<Func>(loop_body),
+                     f_params);
+}
+
 template <typename Iterable, typename Func, typename ForallParam>
 RAJA_INLINE
 concepts::enable_if_t<
@@ -87,12 +139,10 @@ forall_impl(RAJA::resources::Host host_res,
             Func &&loop_body,
             ForallParam)
 {
-  auto begin = std::begin(iter);
-  auto end = std::end(iter);
-  auto distance = std::distance(begin, end);
+  RAJA_EXTRACT_BED_LOOP_IT(iter);
   RAJA_SIMD
-  for (decltype(distance) i = 0; i < distance; ++i) {
-    loop_body(*(begin + i));
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(*(begin_it + i));
   }
 
   return RAJA::resources::EventProxy<resources::Host>(host_res);
@@ -63,15 +63,16 @@ struct StatementExecutor<
     RAJA_SIMD
     for (decltype(distance) i = 0; i < distance; ++i) {
 
-      // Offsets and parameters need to be privatized
-      data.template assign_offset<ArgumentId>(i);
-      data.template assign_param<ParamId>(i);
-
       // Privatize data for SIMD correctness reasons
       using RAJA::internal::thread_privatize;
       auto privatizer = thread_privatize(data);
       auto& private_data = privatizer.get_priv();
 
+      // Assign offset and param on privatized data, so iterations do not
+      // store to the shared loop data and the loop vectorizes
+      private_data.template assign_offset<ArgumentId>(i);
+      private_data.template assign_param<ParamId>(i);
+
       Invoke_all_Lambda<NewTypes, EnclosedStmts...>::lambda_special(private_data);
     }
   }
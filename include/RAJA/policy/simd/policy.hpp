@@ -44,11 +44,24 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// simd_exec that prefetches the elements the views of a
+/// RAJA::expt::Prefetch param gather Distance iterations ahead
+///
+template <int Distance>
+struct simd_exec_prefetch : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                                  Pattern::forall,
+                                                                  Launch::undefined,
+                                                                  Platform::host> {
+  static_assert(Distance > 0, "Prefetch distance must be positive");
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::simd_exec_prefetch;
 
 }  // end of namespace RAJA
 
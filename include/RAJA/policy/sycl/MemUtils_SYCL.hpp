@@ -68,6 +68,17 @@ void setQueue(camp::resources::Resource* q);
 
 cl::sycl::queue* getQueue();
 
+//! nd_item of the calling work item, for device code that is not passed it
+template <int Dims>
+RAJA_INLINE cl::sycl::nd_item<Dims> this_nd_item()
+{
+#if defined(__INTEL_LLVM_COMPILER) && (__INTEL_LLVM_COMPILER >= 20250000)
+  return cl::sycl::ext::oneapi::this_work_item::get_nd_item<Dims>();
+#else
+  return cl::sycl::ext::oneapi::experimental::this_nd_item<Dims>();
+#endif
+}
+
 }  // namespace detail
 
 }  // namespace sycl
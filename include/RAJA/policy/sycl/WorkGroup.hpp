@@ -0,0 +1,24 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA Dispatcher and WorkRunner constructs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sycl_WorkGroup_HPP
+#define RAJA_sycl_WorkGroup_HPP
+
+#include "RAJA/policy/sycl/WorkGroup/Dispatcher.hpp"
+#include "RAJA/policy/sycl/WorkGroup/WorkRunner.hpp"
+
+#endif  // closing endif for header file include guard
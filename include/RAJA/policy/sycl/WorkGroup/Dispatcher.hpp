@@ -0,0 +1,66 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA workgroup Dispatcher.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sycl_WorkGroup_Dispatcher_HPP
+#define RAJA_sycl_WorkGroup_Dispatcher_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/sycl/policy.hpp"
+
+#include "RAJA/pattern/WorkGroup/Dispatcher.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+namespace sycl
+{
+
+template < typename >
+struct dependent_false : std::false_type { };
+
+}  // namespace sycl
+
+/*!
+* Populate and return a Dispatcher object that can be used in device code
+*
+* SYCL devices can not call through function pointers so only the direct
+* dispatcher, which selects the callable with an id and needs no factory, is
+* supported.
+*/
+template < typename T, typename Dispatcher_T, size_t BLOCK_SIZE, bool Async >
+inline const Dispatcher_T* get_Dispatcher(sycl_work<BLOCK_SIZE, Async> const&)
+{
+  static Dispatcher_T dispatcher{
+        Dispatcher_T::template makeDispatcher<T>(
+          [](auto&& factory) {
+            static_assert(sycl::dependent_false<decltype(factory)>::value,
+                          "sycl_work only supports RAJA::direct_dispatch");
+            return factory();
+          }) };
+  return &dispatcher;
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
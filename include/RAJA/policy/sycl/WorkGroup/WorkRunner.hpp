@@ -0,0 +1,361 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA WorkRunner class specializations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sycl_WorkGroup_WorkRunner_HPP
+#define RAJA_sycl_WorkGroup_WorkRunner_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/sycl/policy.hpp"
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+
+#include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Runs work in a storage container in order
+ * and returns any per run resources
+ */
+template <size_t BLOCK_SIZE, bool Async,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallOrdered<
+        RAJA::sycl_exec<BLOCK_SIZE, true>,
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerForallOrdered<
+        RAJA::sycl_exec<BLOCK_SIZE, true>,
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+  using IndexType = INDEX_T;
+  using per_run_storage = typename base::per_run_storage;
+
+  ///
+  /// run the loops in the given work container in order using forall
+  /// run all loops asynchronously and synchronize after is necessary
+  ///
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage,
+                      typename base::resource_type r, Args... args) const
+  {
+    per_run_storage run_storage =
+        base::run(storage, r, std::forward<Args>(args)...);
+
+    IndexType num_loops = std::distance(std::begin(storage), std::end(storage));
+
+    // Only synchronize if we had something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+      if (!Async) { r.wait(); }
+    }
+
+    return run_storage;
+  }
+};
+
+/*!
+ * Runs work in a storage container in reverse order
+ * and returns any per run resources
+ */
+template <size_t BLOCK_SIZE, bool Async,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::reverse_ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallReverse<
+        RAJA::sycl_exec<BLOCK_SIZE, true>,
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::reverse_ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerForallReverse<
+        RAJA::sycl_exec<BLOCK_SIZE, true>,
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::reverse_ordered,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+  using IndexType = INDEX_T;
+  using per_run_storage = typename base::per_run_storage;
+
+  ///
+  /// run the loops in the given work container in reverse order using forall
+  /// run all loops asynchronously and synchronize after is necessary
+  ///
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage,
+                      typename base::resource_type r, Args... args) const
+  {
+    per_run_storage run_storage =
+        base::run(storage, r, std::forward<Args>(args)...);
+
+    IndexType num_loops = std::distance(std::begin(storage), std::end(storage));
+
+    // Only synchronize if we had something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+      if (!Async) { r.wait(); }
+    }
+
+    return run_storage;
+  }
+};
+
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * on the device, work groups in dimension 0 select the loop and the work
+ * items in dimension 1 stride over its iterations
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldSyclDeviceXThreadblockLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldSyclDeviceXThreadblockLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(Args... args) const
+  {
+    // the dispatcher call interface does not pass the nd_item
+    cl::sycl::nd_item<2> it = RAJA::sycl::detail::this_nd_item<2>();
+    const index_type i_begin = static_cast<index_type>(it.get_global_id(1));
+    const index_type stride  = static_cast<index_type>(it.get_global_range(1));
+    const auto begin = m_segment.begin();
+    const auto end   = m_segment.end();
+    const index_type len(end - begin);
+    for ( index_type i = i_begin; i < len; i += stride ) {
+      m_body(begin[i], std::forward<Args>(args)...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+
+/*!
+ * Runs work in a storage container out of order with loops mapping to
+ * sycl work groups in dimension 0 and iterations mapping to work items in
+ * dimension 1, with the number of work items in dimension 1 determined
+ * by the average number of iterates per loop
+ *
+ * All loops run in a single kernel. The storage must be allocated with an
+ * allocator that returns memory accessible on the device, such as USM host
+ * or shared memory, and the loops must be selected with RAJA::direct_dispatch.
+ */
+template <size_t BLOCK_SIZE, bool Async,
+          typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::sycl_work<BLOCK_SIZE, Async>,
+        RAJA::policy::sycl::unordered_sycl_loop_y_block_iter_x_threadblock_average,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::sycl_work<BLOCK_SIZE, Async>;
+  using order_policy = RAJA::policy::sycl::unordered_sycl_loop_y_block_iter_x_threadblock_average;
+  using dispatch_policy =  DISPATCH_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Sycl;
+
+  // The type that will hold the segment and loop body in work storage
+  struct holder_type {
+    template < typename T >
+    using type = HoldSyclDeviceXThreadblockLoop<
+        typename camp::at<T, camp::num<0>>::type, // ITERABLE
+        typename camp::at<T, camp::num<1>>::type, // LOOP_BODY
+        index_type, Args...>;
+  };
+  ///
+  template < typename T >
+  using holder_type_t = typename holder_type::template type<T>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the device
+  using dispatcher_exec_policy = exec_policy;
+
+  // The Dispatcher policy with holder_types used internally to handle the
+  // ranges and callables passed in by the user.
+  using dispatcher_holder_policy = dispatcher_transform_types_t<dispatch_policy, holder_type>;
+
+  using dispatcher_type = Dispatcher<Platform::sycl, dispatcher_holder_policy, RAJA::sycl_work<BLOCK_SIZE, true>, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_total_iterations(o.m_total_iterations)
+  {
+    o.m_total_iterations = 0;
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_total_iterations = o.m_total_iterations;
+
+    o.m_total_iterations = 0;
+    return *this;
+  }
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using Iterator  = camp::decay<decltype(std::begin(iter))>;
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+
+    using holder = holder_type_t<camp::list<ITERABLE, LOOP_BODY>>;
+
+    Iterator begin = std::begin(iter);
+    Iterator end = std::end(iter);
+    IndexType len = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (len > 0 && BLOCK_SIZE > 0) {
+
+      m_total_iterations += len;
+
+      storage.template emplace<holder>(
+          get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type r, Args... args) const
+  {
+    using Iterator  = camp::decay<decltype(std::begin(storage))>;
+    using IndexType = camp::decay<decltype(std::distance(std::begin(storage), std::end(storage)))>;
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    //
+    // Compute the requested iteration space size
+    //
+    Iterator begin = std::begin(storage);
+    Iterator end = std::end(storage);
+    IndexType num_loops = std::distance(begin, end);
+
+    // Only launch kernel if we have something to iterate over
+    if (num_loops > 0 && BLOCK_SIZE > 0) {
+
+      index_type average_iterations = m_total_iterations / static_cast<index_type>(num_loops);
+
+      //
+      // Compute the number of work groups
+      //
+      constexpr size_t block_size = BLOCK_SIZE;
+      const size_t blocks_per_loop =
+          (static_cast<size_t>(average_iterations) + block_size - 1) / block_size;
+
+      cl::sycl::range<2> globalSize{static_cast<size_t>(num_loops),
+                                    blocks_per_loop * block_size};
+      cl::sycl::range<2> localSize{1, block_size};
+
+      cl::sycl::queue* q = ::RAJA::sycl::detail::getQueue();
+      // Global resource was not set, use the resource that was passed to run
+      if (!q) {
+        q = r.get_queue();
+      }
+
+      RAJA_FT_BEGIN;
+
+      q->submit([&](cl::sycl::handler& h) {
+
+        h.parallel_for( cl::sycl::nd_range<2>{globalSize, localSize},
+                        [=] (cl::sycl::nd_item<2> it) {
+
+          const index_type i_loop = static_cast<index_type>(it.get_group(0));
+          value_type::device_call(&begin[i_loop], args...);
+        });
+      });
+
+      if (!Async) { q->wait(); }
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_total_iterations = 0;
+  }
+
+private:
+  index_type m_total_iterations = 0;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
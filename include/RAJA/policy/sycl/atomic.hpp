@@ -0,0 +1,632 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic operations for SYCL
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_sycl_atomic_HPP
+#define RAJA_policy_sycl_atomic_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+
+#if defined(RAJA_ENABLE_DESUL_ATOMICS)
+#include "RAJA/policy/desul/atomic.hpp"
+#endif
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+#include "RAJA/util/TypeConvert.hpp"
+#include "RAJA/util/macros.hpp"
+
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * SYCL memory scope of a RAJA::atomic_scope.
+ */
+template <typename Scope>
+struct sycl_memory_scope;
+///
+template <>
+struct sycl_memory_scope<atomic_scope::block> {
+  static constexpr cl::sycl::memory_scope value =
+      cl::sycl::memory_scope::work_group;
+};
+///
+template <>
+struct sycl_memory_scope<atomic_scope::device> {
+  static constexpr cl::sycl::memory_scope value =
+      cl::sycl::memory_scope::device;
+};
+///
+template <>
+struct sycl_memory_scope<atomic_scope::system> {
+  static constexpr cl::sycl::memory_scope value =
+      cl::sycl::memory_scope::system;
+};
+
+/*!
+ * Types that sycl::atomic_ref supports natively.
+ */
+template <typename T>
+struct sycl_atomic_ref_supported
+    : std::integral_constant<bool,
+                             std::is_arithmetic<T>::value &&
+                             !std::is_same<T, bool>::value &&
+                             (sizeof(T) == 4 || sizeof(T) == 8)> {
+};
+
+/*!
+ * Integral types that sycl::atomic_ref supports natively, the bitwise
+ * operations are only available for these.
+ */
+template <typename T>
+struct sycl_atomic_ref_integral
+    : std::integral_constant<bool,
+                             sycl_atomic_ref_supported<T>::value &&
+                             std::is_integral<T>::value> {
+};
+
+/*!
+ * Relaxed atomic_ref in the generic address space, so the same operations
+ * work on global memory and on local memory such as RAJA::launch team
+ * shared memory.
+ */
+template <typename Scope, typename T>
+using sycl_atomic_ref_t =
+    cl::sycl::atomic_ref<T,
+                         cl::sycl::memory_order::relaxed,
+                         sycl_memory_scope<Scope>::value,
+                         cl::sycl::access::address_space::generic_space>;
+
+template <typename Scope, typename T>
+RAJA_INLINE sycl_atomic_ref_t<Scope, T> sycl_atomic_ref(T volatile *acc)
+{
+  return sycl_atomic_ref_t<Scope, T>(*const_cast<T *>(acc));
+}
+
+/*!
+ * Unsigned type used to compare and swap T.
+ */
+template <typename T>
+using sycl_atomic_uint = typename std::enable_if<
+    sizeof(T) == sizeof(unsigned) || sizeof(T) == sizeof(unsigned long long),
+    typename std::conditional<sizeof(T) == sizeof(unsigned),
+                              unsigned,
+                              unsigned long long>::type>::type;
+
+/*!
+ * Compare and swap of any 32-bit or 64-bit type.
+ * Returns the value that was stored before this operation.
+ */
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomic_CAS(T volatile *acc, T compare, T value)
+{
+  using U = sycl_atomic_uint<T>;
+  U expected = RAJA::util::reinterp_A_as_B<T, U>(compare);
+  sycl_atomic_ref<Scope>((U volatile *)acc)
+      .compare_exchange_strong(expected,
+                               RAJA::util::reinterp_A_as_B<T, U>(value));
+  return RAJA::util::reinterp_A_as_B<U, T>(expected);
+}
+
+/*!
+ * Implementation of any atomic 32-bit or 64-bit operator using
+ * compare and swap.
+ * Returns the OLD value that was replaced by the result of this operation.
+ */
+template <typename Scope, typename T, typename OPER>
+RAJA_INLINE T sycl_atomic_CAS_oper(T volatile *acc, OPER const &oper)
+{
+  using U = sycl_atomic_uint<T>;
+  auto ref = sycl_atomic_ref<Scope>((U volatile *)acc);
+  U oldval = ref.load();
+  // compare_exchange_strong updates oldval with the current value on failure
+  while (!ref.compare_exchange_strong(
+      oldval,
+      RAJA::util::reinterp_A_as_B<T, U>(
+          oper(RAJA::util::reinterp_A_as_B<U, T>(oldval))))) {
+  }
+  return RAJA::util::reinterp_A_as_B<U, T>(oldval);
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicAdd(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_add(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicAdd(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return a + value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicSub(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_sub(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicSub(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return a - value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicMin(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_min(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicMin(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return value < a ? value : a;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicMax(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_max(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicMax(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return value > a ? value : a;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicAnd(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_and(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicAnd(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return a & value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicOr(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_or(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicOr(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return a | value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicXor(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).fetch_xor(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicXor(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T a) {
+    return a ^ value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicExchange(std::true_type, T volatile *acc, T value)
+{
+  return sycl_atomic_ref<Scope>(acc).exchange(value);
+}
+///
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicExchange(std::false_type, T volatile *acc, T value)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T) {
+    return value;
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicInc(T volatile *acc, T val)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T old) {
+    return ((old >= val) ? (T)0 : (old + (T)1));
+  });
+}
+
+template <typename Scope, typename T>
+RAJA_INLINE T sycl_atomicDec(T volatile *acc, T val)
+{
+  return sycl_atomic_CAS_oper<Scope>(acc, [=](T old) {
+    return (((old == (T)0) | (old > val)) ? val : (old - (T)1));
+  });
+}
+
+}  // namespace detail
+
+
+/*!
+ * SYCL atomics use sycl::atomic_ref with relaxed memory order for the types
+ * it supports and compare and swap through atomic_ref otherwise. They work on
+ * global and local memory.
+ *
+ * sycl_atomic_explicit uses device scope, sycl_atomic_scoped_explicit uses the
+ * memory scope of its RAJA::atomic_scope.
+ *
+ * These are atomic in sycl device code and use the host_policy otherwise
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAdd<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicAdd(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAdd(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAdd<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicAdd(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicSub<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicSub(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicSub(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicSub<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicSub(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicMin<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicMin(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMin(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicMin<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicMin(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicMax<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicMax(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicMax(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicMax<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicMax(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(sycl_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicInc<atomic_scope::device>(acc, val);
+#else
+  return RAJA::atomicInc(host_policy{}, acc, val);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T val)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicInc<scope>(acc, val);
+#else
+  return RAJA::atomicInc(host_policy{}, acc, val);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(sycl_atomic_explicit<host_policy>, T volatile *acc)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAdd<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicInc(host_policy{}, acc);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicInc(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAdd<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicInc(host_policy{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(sycl_atomic_explicit<host_policy>, T volatile *acc, T val)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicDec<atomic_scope::device>(acc, val);
+#else
+  return RAJA::atomicDec(host_policy{}, acc, val);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T val)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicDec<scope>(acc, val);
+#else
+  return RAJA::atomicDec(host_policy{}, acc, val);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(sycl_atomic_explicit<host_policy>, T volatile *acc)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicSub<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicDec(host_policy{}, acc);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicDec(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicSub<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, (T)1);
+#else
+  return RAJA::atomicDec(host_policy{}, acc);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAnd<atomic_scope::device>(
+      detail::sycl_atomic_ref_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicAnd(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicAnd(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicAnd<scope>(
+      detail::sycl_atomic_ref_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicAnd(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicOr<atomic_scope::device>(
+      detail::sycl_atomic_ref_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicOr(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicOr(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicOr<scope>(
+      detail::sycl_atomic_ref_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicOr(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicXor<atomic_scope::device>(
+      detail::sycl_atomic_ref_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicXor(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicXor(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicXor<scope>(
+      detail::sycl_atomic_ref_integral<T>{}, acc, value);
+#else
+  return RAJA::atomicXor(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(sycl_atomic_explicit<host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicExchange<atomic_scope::device>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicExchange(host_policy{}, acc, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicExchange(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomicExchange<scope>(
+      detail::sycl_atomic_ref_supported<T>{}, acc, value);
+#else
+  return RAJA::atomicExchange(host_policy{}, acc, value);
+#endif
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(sycl_atomic_explicit<host_policy>, T volatile *acc, T compare, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomic_CAS<atomic_scope::device>(acc, compare, value);
+#else
+  return RAJA::atomicCAS(host_policy{}, acc, compare, value);
+#endif
+}
+///
+RAJA_SUPPRESS_HD_WARN
+template <typename T, typename scope, typename host_policy>
+RAJA_INLINE RAJA_HOST_DEVICE T
+atomicCAS(sycl_atomic_scoped_explicit<scope, host_policy>, T volatile *acc, T compare, T value)
+{
+#if defined(__SYCL_DEVICE_ONLY__)
+  return detail::sycl_atomic_CAS<scope>(acc, compare, value);
+#else
+  return RAJA::atomicCAS(host_policy{}, acc, compare, value);
+#endif
+}
+
+}  // namespace RAJA
+
+
+#endif  // RAJA_ENABLE_SYCL
+#endif  // guard
@@ -31,6 +31,7 @@
 #include <chrono>
 
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/forall.hpp"
 
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -83,7 +84,8 @@ cl::sycl::range<1> getGridDim(size_t len, size_t block_size)
 //
 
 template <typename Iterable, typename LoopBody, size_t BlockSize, bool Async, typename ForallParam,
-          typename std::enable_if<std::is_trivially_copyable<LoopBody>{},bool>::type = true>
+          typename std::enable_if<std::is_trivially_copyable<LoopBody>{} &&
+                                  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>{},bool>::type = true>
 RAJA_INLINE resources::EventProxy<resources::Sycl>  forall_impl(resources::Sycl &sycl_res,
                                                                 sycl_exec<BlockSize, Async>,
                                                                 Iterable&& iter,
@@ -139,6 +141,86 @@ RAJA_INLINE resources::EventProxy<resources::Sycl>  forall_impl(resources::Sycl
   return resources::EventProxy<resources::Sycl>(sycl_res);
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  SYCL kernel with forall parameters, eg. RAJA::expt::Reduce.
+ *
+ *         Every work item combines its parameters, including the ones past
+ *         the end of the iteration space, since reductions use group
+ *         algorithms that all work items of a group have to reach.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename LoopBody, size_t BlockSize, bool Async, typename ForallParam,
+          typename std::enable_if<std::is_trivially_copyable<LoopBody>{} &&
+                                  !RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>{},bool>::type = true>
+RAJA_INLINE resources::EventProxy<resources::Sycl>  forall_impl(resources::Sycl &sycl_res,
+                                                                sycl_exec<BlockSize, Async>,
+                                                                Iterable&& iter,
+                                                                LoopBody&& loop_body,
+                                                                ForallParam f_params)
+{
+
+  using Iterator  = camp::decay<decltype(std::begin(iter))>;
+  using LOOP_BODY = camp::decay<LoopBody>;
+  using IndexType = camp::decay<decltype(std::distance(std::begin(iter), std::end(iter)))>;
+  using EXEC_POL = RAJA::sycl_exec<BlockSize, Async>;
+
+  //
+  // Compute the requested iteration space size
+  //
+  Iterator begin = std::begin(iter);
+  Iterator end = std::end(iter);
+  IndexType len = std::distance(begin, end);
+
+  // Only launch kernel if we have something to iterate over
+  if (len > 0 && BlockSize > 0) {
+
+    //
+    // Compute the number of blocks
+    //
+    sycl_dim_t blockSize{BlockSize};
+    sycl_dim_t gridSize = impl::getGridDim(static_cast<size_t>(len), BlockSize);
+
+    cl::sycl::queue* q = ::RAJA::sycl::detail::getQueue();
+    // Global resource was not set, use the resource that was passed to forall
+    // Determine if the default SYCL res is being used
+    if (!q) {
+      q = sycl_res.get_queue();
+    }
+
+    RAJA::sycl::detail::syclInfo launch_info;
+    launch_info.gridDim = gridSize;
+    launch_info.blockDim = blockSize;
+    launch_info.qu = *q;
+
+    RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params, launch_info);
+
+    q->submit([&](cl::sycl::handler& h) {
+
+      h.parallel_for( cl::sycl::nd_range<1>{gridSize, blockSize},
+                      [=]  (cl::sycl::nd_item<1> it) {
+
+        ForallParam fp = f_params;
+        LOOP_BODY body = loop_body;
+
+        IndexType ii = it.get_global_id(0);
+        if (ii < len) {
+          RAJA::expt::invoke_body(fp, body, begin[ii]);
+        }
+        RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(fp);
+      });
+    });
+
+    RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+
+    if (!Async) { q->wait(); }
+  }
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
 template <typename Iterable, typename LoopBody, size_t BlockSize, bool Async, typename ForallParam,
           typename std::enable_if<!std::is_trivially_copyable<LoopBody>{},bool>::type = true>
 RAJA_INLINE resources::EventProxy<resources::Sycl> forall_impl(resources::Sycl &sycl_res,
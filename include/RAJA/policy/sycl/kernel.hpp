@@ -23,10 +23,12 @@
 #include "RAJA/policy/sycl/kernel/SyclKernel.hpp"
 #include "RAJA/policy/sycl/kernel/For.hpp"
 #include "RAJA/policy/sycl/kernel/ForICount.hpp"
+#include "RAJA/policy/sycl/kernel/ForUnroll.hpp"
 //#include "RAJA/policy/sycl/kernel/Hyperplane.hpp"
 //#include "RAJA/policy/sycl/kernel/InitLocalMem.hpp"
 #include "RAJA/policy/sycl/kernel/Lambda.hpp"
 //#include "RAJA/policy/sycl/kernel/Reduce.hpp"
+#include "RAJA/policy/sycl/kernel/Sequence.hpp"
 //#include "RAJA/policy/sycl/kernel/Sync.hpp"
 #include "RAJA/policy/sycl/kernel/Tile.hpp"
 #include "RAJA/policy/sycl/kernel/TileTCount.hpp"
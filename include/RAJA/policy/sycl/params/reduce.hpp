@@ -0,0 +1,230 @@
+#ifndef NEW_REDUCE_SYCL_REDUCE_HPP
+#define NEW_REDUCE_SYCL_REDUCE_HPP
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <type_traits>
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/pattern/params/reducer.hpp"
+
+namespace RAJA {
+namespace sycl {
+namespace impl {
+namespace expt {
+
+  //
+  // Reductions whose operator and type the SYCL group algorithms support
+  // combine each work group with reduce_over_group. The others combine each
+  // sub-group with shuffles, so any trivially copyable type works.
+  //
+  template <typename Op>
+  struct group_op {
+    static constexpr bool value = false;
+  };
+
+  template <typename T>
+  struct group_op<RAJA::operators::plus<T, T, T>> {
+    static constexpr bool value = std::is_arithmetic<T>::value;
+    using type = cl::sycl::plus<T>;
+  };
+
+  template <typename T>
+  struct group_op<RAJA::operators::minimum<T, T, T>> {
+    static constexpr bool value = std::is_arithmetic<T>::value;
+    using type = cl::sycl::minimum<T>;
+  };
+
+  template <typename T>
+  struct group_op<RAJA::operators::maximum<T, T, T>> {
+    static constexpr bool value = std::is_arithmetic<T>::value;
+    using type = cl::sycl::maximum<T>;
+  };
+
+  template <typename T>
+  struct group_op<RAJA::operators::bit_or<T, T, T>> {
+    static constexpr bool value = std::is_integral<T>::value;
+    using type = cl::sycl::bit_or<T>;
+  };
+
+  template <typename T>
+  struct group_op<RAJA::operators::bit_and<T, T, T>> {
+    static constexpr bool value = std::is_integral<T>::value;
+    using type = cl::sycl::bit_and<T>;
+  };
+
+  //! work group path, one partial value per work group
+  template <typename OP, typename T, bool use_group_op = group_op<OP>::value>
+  struct reduce_unit {
+
+    static cl::sycl::group<1> get(cl::sycl::nd_item<1> const& it)
+    {
+      return it.get_group();
+    }
+
+    static size_t slot(cl::sycl::nd_item<1> const& it)
+    {
+      return it.get_group_linear_id();
+    }
+
+    static size_t num_slots(cl::sycl::nd_item<1> const& it)
+    {
+      return it.get_group_range(0);
+    }
+
+    static T reduce(cl::sycl::group<1> const& g, T val)
+    {
+      return cl::sycl::reduce_over_group(g, val, typename group_op<OP>::type{});
+    }
+  };
+
+  //! sub-group path, one partial value per sub-group
+  template <typename OP, typename T>
+  struct reduce_unit<OP, T, false> {
+
+    static cl::sycl::sub_group get(cl::sycl::nd_item<1> const& it)
+    {
+      return it.get_sub_group();
+    }
+
+    static size_t slot(cl::sycl::nd_item<1> const& it)
+    {
+      cl::sycl::sub_group sg = it.get_sub_group();
+      return it.get_group_linear_id() * sg.get_group_range()[0] +
+             sg.get_group_linear_id();
+    }
+
+    static size_t num_slots(cl::sycl::nd_item<1> const& it)
+    {
+      return it.get_group_range(0) * it.get_sub_group().get_group_range()[0];
+    }
+
+    // tree of shuffles that leaves the result in the first work item, works
+    // for any sub-group size
+    static T reduce(cl::sycl::sub_group const& sg, T val)
+    {
+      const size_t lane = sg.get_local_linear_id();
+      const size_t size = sg.get_local_linear_range();
+      for (size_t offset = 1; offset < size; offset *= 2) {
+        T other = cl::sycl::shift_group_left(sg, val, offset);
+        if (lane % (2 * offset) == 0 && lane + offset < size) {
+          val = OP{}(val, other);
+        }
+      }
+      return val;
+    }
+  };
+
+  /*!
+   * Two stage reduction of the values of all work items into
+   * red.devicetarget. The first work item of each unit, work group or
+   * sub-group, stores the unit's value in red.device_partials; the unit
+   * that stores the last partial reduces the partials.
+   */
+  template <typename OP, typename T>
+  void grid_reduce(RAJA::expt::detail::Reducer<OP, T>& red)
+  {
+    using unit_t = reduce_unit<OP, T>;
+    using count_ref = cl::sycl::atomic_ref<unsigned int,
+                                           cl::sycl::memory_order::acq_rel,
+                                           cl::sycl::memory_scope::device,
+                                           cl::sycl::access::address_space::global_space>;
+
+    // the combine interface does not pass the nd_item
+    cl::sycl::nd_item<1> it = RAJA::sycl::detail::this_nd_item<1>();
+    auto unit = unit_t::get(it);
+    const size_t num_slots = unit_t::num_slots(it);
+    const bool leader = unit.get_local_linear_id() == 0;
+
+    T val = unit_t::reduce(unit, red.val);
+
+    bool last = false;
+    if (leader) {
+      red.device_partials[unit_t::slot(it)] = val;
+      unsigned int done = count_ref(*red.device_count).fetch_add(1u);
+      last = (done == num_slots - 1);
+    }
+
+    last = cl::sycl::group_broadcast(unit, last);
+
+    if (last) {
+      cl::sycl::atomic_fence(cl::sycl::memory_order::acquire,
+                             cl::sycl::memory_scope::device);
+
+      T temp = OP::identity();
+      for (size_t s = unit.get_local_linear_id(); s < num_slots;
+           s += unit.get_local_linear_range()) {
+        temp = OP{}(temp, red.device_partials[s]);
+      }
+
+      temp = unit_t::reduce(unit, temp);
+
+      if (leader) {
+        *red.devicetarget = temp;
+      }
+    }
+  }
+
+}  // namespace expt
+}  // namespace impl
+}  // namespace sycl
+
+namespace expt {
+namespace detail {
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_sycl_policy<EXEC_POL> >
+  init(Reducer<OP, T>& red, RAJA::sycl::detail::syclInfo & cs)
+  {
+    cl::sycl::queue* q = &cs.qu;
+    const size_t num_groups = cs.gridDim[0] / cs.blockDim[0];
+
+    // the sub-group path stores a partial per sub-group, allocate for the
+    // smallest sub-group size the device supports
+    size_t slots_per_group = 1;
+    if (!RAJA::sycl::impl::expt::group_op<OP>::value) {
+      size_t min_sg = cs.blockDim[0];
+      for (size_t sg : q->get_device().get_info<cl::sycl::info::device::sub_group_sizes>()) {
+        min_sg = std::min(min_sg, sg);
+      }
+      slots_per_group = (cs.blockDim[0] + min_sg - 1) / min_sg;
+    }
+
+    red.device_queue = q;
+    red.devicetarget = cl::sycl::malloc_shared<T>(1, *q);
+    red.device_partials = cl::sycl::malloc_device<T>(num_groups * slots_per_group, *q);
+    red.device_count = cl::sycl::malloc_device<unsigned int>(1, *q);
+    q->memset(red.device_count, 0, sizeof(unsigned int)).wait();
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< type_traits::is_sycl_policy<EXEC_POL> >
+  combine(Reducer<OP, T>& red) {
+    RAJA::sycl::impl::expt::grid_reduce(red);
+  }
+
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_sycl_policy<EXEC_POL> >
+  resolve(Reducer<OP, T>& red) {
+    cl::sycl::queue* q = static_cast<cl::sycl::queue*>(red.device_queue);
+    q->wait();
+    red.val = *red.devicetarget;
+    *red.target = OP{}(red.val, *red.target);
+    cl::sycl::free(red.devicetarget, *q);
+    cl::sycl::free(red.device_partials, *q);
+    cl::sycl::free(red.device_count, *q);
+  }
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif
+
+#endif //  NEW_REDUCE_SYCL_REDUCE_HPP
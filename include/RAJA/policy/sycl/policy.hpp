@@ -88,6 +88,28 @@ struct sycl_reduce
     : make_policy_pattern_t<RAJA::Policy::sycl, RAJA::Pattern::reduce> {
 };
 
+///
+/// WorkGroup execution policies
+///
+template <size_t BLOCK_SIZE, bool Async = false>
+struct sycl_work : public RAJA::make_policy_pattern_launch_platform_t<
+                       RAJA::Policy::sycl,
+                       RAJA::Pattern::workgroup_exec,
+                       detail::get_launch<Async>::value,
+                       RAJA::Platform::sycl> {
+};
+
+/// execute the enqueued loops in an unordered fashion by mapping loops to
+/// work groups in dimension 0 and loop iterations to work items in
+/// dimension 1 with the size of dimension 1 being the average of the
+/// iteration counts of all the loops
+struct unordered_sycl_loop_y_block_iter_x_threadblock_average
+    : public RAJA::make_policy_pattern_platform_t<
+                       RAJA::Policy::sycl,
+                       RAJA::Pattern::workgroup_order,
+                       RAJA::Platform::sycl> {
+};
+
 //
 // Sycl atomic policy for using sycl atomics on the device and
 // the provided Policy on the host
@@ -101,6 +123,32 @@ struct sycl_atomic_explicit{};
 //
 using sycl_atomic = sycl_atomic_explicit<loop_atomic>;
 
+//
+// Sycl atomic policy for using sycl atomics with the given RAJA::atomic_scope
+// on the device and the provided Policy on the host
+//
+template<typename scope, typename host_policy>
+struct sycl_atomic_scoped_explicit{};
+
+template<typename host_policy>
+using sycl_atomic_block_explicit =
+    sycl_atomic_scoped_explicit<atomic_scope::block, host_policy>;
+
+template<typename host_policy>
+using sycl_atomic_device_explicit =
+    sycl_atomic_scoped_explicit<atomic_scope::device, host_policy>;
+
+template<typename host_policy>
+using sycl_atomic_system_explicit =
+    sycl_atomic_scoped_explicit<atomic_scope::system, host_policy>;
+
+//
+// Default scoped sycl atomic policies use non-atomics on the host
+//
+using sycl_atomic_block = sycl_atomic_block_explicit<loop_atomic>;
+using sycl_atomic_device = sycl_atomic_device_explicit<loop_atomic>;
+using sycl_atomic_system = sycl_atomic_system_explicit<loop_atomic>;
+
 template<typename Mask>
 struct sycl_local_masked_direct {};
 
@@ -113,8 +161,22 @@ struct sycl_local_masked_loop {};
 using policy::sycl::sycl_exec;
 using policy::sycl::sycl_reduce;
 
+using policy::sycl::sycl_work;
+
+template <size_t BLOCK_SIZE>
+using sycl_work_async = policy::sycl::sycl_work<BLOCK_SIZE, true>;
+
+using policy::sycl::unordered_sycl_loop_y_block_iter_x_threadblock_average;
+
 using policy::sycl::sycl_atomic;
 using policy::sycl::sycl_atomic_explicit;
+using policy::sycl::sycl_atomic_scoped_explicit;
+using policy::sycl::sycl_atomic_block_explicit;
+using policy::sycl::sycl_atomic_device_explicit;
+using policy::sycl::sycl_atomic_system_explicit;
+using policy::sycl::sycl_atomic_block;
+using policy::sycl::sycl_atomic_device;
+using policy::sycl::sycl_atomic_system;
 
 using policy::sycl::sycl_local_masked_direct;
 using policy::sycl::sycl_local_masked_loop;
@@ -0,0 +1,188 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+*          The scans use the oneDPL device algorithms, run on the queue of
+*          the RAJA SYCL resource.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_sycl_HPP
+#define RAJA_scan_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/numeric>
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+
+namespace RAJA
+{
+namespace sycl
+{
+namespace detail
+{
+
+//! oneDPL device policy bound to the queue of a RAJA SYCL resource
+RAJA_INLINE
+auto make_dpl_policy(resources::Sycl& sycl_res)
+{
+  cl::sycl::queue* q = ::RAJA::sycl::detail::getQueue();
+  if (!q) {
+    q = sycl_res.get_queue();
+  }
+  return ::oneapi::dpl::execution::make_device_policy(*q);
+}
+
+}  // namespace detail
+}  // namespace sycl
+
+namespace impl
+{
+namespace scan
+{
+
+//
+// The oneDPL algorithms block until the device work is done, so Async
+// has no effect on the SYCL scans.
+//
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE, bool Async, typename InputIter, typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+inclusive_inplace(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    Function binary_op)
+{
+  ::oneapi::dpl::inclusive_scan(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                                begin,
+                                end,
+                                begin,
+                                binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename Function,
+          typename T>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+exclusive_inplace(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    Function binary_op,
+    T init)
+{
+  ::oneapi::dpl::exclusive_scan(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                                begin,
+                                end,
+                                begin,
+                                init,
+                                binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+inclusive(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op)
+{
+  ::oneapi::dpl::inclusive_scan(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                                begin,
+                                end,
+                                out,
+                                binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   and initial value
+*/
+template <size_t BLOCK_SIZE,
+          bool Async,
+          typename InputIter,
+          typename OutputIter,
+          typename Function,
+          typename T>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+exclusive(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    InputIter begin,
+    InputIter end,
+    OutputIter out,
+    Function binary_op,
+    T init)
+{
+  ::oneapi::dpl::exclusive_scan(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                                begin,
+                                end,
+                                out,
+                                init,
+                                binary_op);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
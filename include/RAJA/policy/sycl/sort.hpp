@@ -0,0 +1,147 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+*          The sorts use the oneDPL device algorithms, run on the queue of
+*          the RAJA SYCL resource.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_sycl_HPP
+#define RAJA_sort_sycl_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_SYCL)
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/policy/sycl/MemUtils_SYCL.hpp"
+#include "RAJA/policy/sycl/policy.hpp"
+#include "RAJA/policy/sycl/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+//
+// The oneDPL algorithms block until the device work is done, so Async
+// has no effect on the SYCL sorts. oneDPL picks a radix sort for arithmetic
+// keys compared with less or greater and a merge sort otherwise.
+//
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+stable(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  ::oneapi::dpl::stable_sort(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                             begin,
+                             end,
+                             comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <size_t BLOCK_SIZE, bool Async, typename Iter, typename Compare>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+unstable(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  ::oneapi::dpl::sort(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                      begin,
+                      end,
+                      comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function
+               on keys
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+stable_pairs(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async>,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  ::oneapi::dpl::sort_by_key(RAJA::sycl::detail::make_dpl_policy(sycl_res),
+                             keys_begin,
+                             keys_end,
+                             vals_begin,
+                             comp);
+
+  return resources::EventProxy<resources::Sycl>(sycl_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <size_t BLOCK_SIZE, bool Async,
+          typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+resources::EventProxy<resources::Sycl>
+unstable_pairs(
+    resources::Sycl sycl_res,
+    sycl_exec<BLOCK_SIZE, Async> p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  return stable_pairs(sycl_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_SYCL guard
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <tbb/task_group.h>
+
 #include "RAJA/policy/tbb/policy.hpp"
 
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
@@ -81,6 +83,66 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container out of order with each loop run as a
+ * task in a tbb::task_group
+ */
+template <typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::tbb_work,
+        RAJA::policy::tbb::unordered_tbb_task_group,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallOrdered_base<
+        RAJA::tbb_for_exec,
+        RAJA::tbb_work,
+        RAJA::policy::tbb::unordered_tbb_task_group,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerForallOrdered_base<
+        RAJA::tbb_for_exec,
+        RAJA::tbb_work,
+        RAJA::policy::tbb::unordered_tbb_task_group,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+
+  // run each loop as a task and wait for all of the tasks to finish
+  template < typename WorkContainer >
+  typename base::per_run_storage run(WorkContainer const& storage,
+                                     typename base::resource_type r,
+                                     Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    typename base::per_run_storage run_storage{};
+
+    tbb::task_group group;
+
+    auto end = storage.end();
+    for (auto iter = storage.begin(); iter != end; ++iter) {
+      const value_type* value = &*iter;
+      group.run([=]() {
+        value_type::host_call(value, r, args...);
+      });
+    }
+
+    group.wait();
+
+    return run_storage;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
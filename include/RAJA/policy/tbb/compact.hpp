@@ -0,0 +1,316 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_tbb_HPP
+#define RAJA_compact_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace detail
+{
+
+/*!
+        \brief parallel_scan body that scans the number of items begin[i] for
+   which flag(i) is true, the final scan copies the selected items to the
+   front of out and if Partition the other items to the back of out in
+   reverse order
+*/
+template <bool Partition, typename Iter, typename OutIter, typename Flag>
+struct select_adapter {
+  Index_type count;
+  Iter in;
+  OutIter out;
+  Flag flag;
+  Index_type n;
+
+  select_adapter(Iter in_, OutIter out_, Flag flag_, Index_type n_)
+      : count(0), in(in_), out(out_), flag(flag_), n(n_)
+  {
+  }
+
+  select_adapter(select_adapter& b, tbb::split)
+      : count(0), in(b.in), out(b.out), flag(b.flag), n(b.n)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    Index_type temp = count;
+    for (Index_type i = r.begin(); i < r.end(); ++i) {
+      if (flag(i)) {
+        if (Tag::is_final_scan()) out[temp] = in[i];
+        ++temp;
+      } else if (Partition && Tag::is_final_scan()) {
+        out[n - 1 - (i - temp)] = in[i];
+      }
+    }
+    count = temp;
+  }
+
+  void reverse_join(const select_adapter& a) { count = a.count + count; }
+  void assign(const select_adapter& b) { count = b.count; }
+};
+
+template <bool Partition, typename Iter, typename OutIter, typename Flag>
+RAJA_INLINE
+Index_type
+select(Iter begin, Index_type n, OutIter out, Flag flag)
+{
+  auto adapter =
+      select_adapter<Partition, Iter, OutIter, Flag>{begin, out, flag, n};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0, n}, adapter);
+  return adapter.count;
+}
+
+/*!
+        \brief reduce the values of each run of equal keys with op, writing
+   the key and reduced value of each run to the front of out_keys and
+   out_values, returns the number of runs
+
+   The range is split into a chunk per thread of the arena. A parallel_for
+   counts the run heads of each chunk and the counts are scanned, a second
+   parallel_for reduces the runs that start in each chunk up to the end of
+   the chunk, and the values before its first head into a carry. The carries
+   are folded into the runs they continue in chunk order, so no atomics are
+   used and the order op is applied in is fixed.
+*/
+template <typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename BinaryOp>
+RAJA_INLINE
+Index_type
+reduce_by_key(KeyIter keys,
+              ValueIter values,
+              Index_type n,
+              OutKeyIter out_keys,
+              OutValueIter out_values,
+              BinaryOp op)
+{
+  using RAJA::detail::firstIndex;
+  using ValueT = RAJA::detail::IterVal<ValueIter>;
+  if (n <= 0) {
+    return 0;
+  }
+  auto is_head = [=](Index_type i) {
+    return i == 0 || !(keys[i - 1] == keys[i]);
+  };
+  const Index_type p = std::min(
+      n, static_cast<Index_type>(tbb::this_task_arena::max_concurrency()));
+  std::vector<Index_type> offsets(p + 1, 0);
+  std::vector<ValueT> carry(p);
+  std::vector<char> has_carry(p, 0);
+
+  tbb::parallel_for(Index_type(0), p, [&](Index_type c) {
+    Index_type count = 0;
+    for (Index_type i = firstIndex(n, p, c); i < firstIndex(n, p, c + 1);
+         ++i) {
+      count += is_head(i) ? 1 : 0;
+    }
+    offsets[c + 1] = count;
+  });
+  for (Index_type c = 0; c < p; ++c) {
+    offsets[c + 1] += offsets[c];
+  }
+
+  tbb::parallel_for(Index_type(0), p, [&](Index_type c) {
+    const Index_type idx_end = firstIndex(n, p, c + 1);
+    Index_type i = firstIndex(n, p, c);
+    if (i < idx_end && !is_head(i)) {
+      ValueT sum = values[i];
+      for (++i; i < idx_end && !is_head(i); ++i) {
+        sum = op(sum, values[i]);
+      }
+      carry[c] = sum;
+      has_carry[c] = 1;
+    }
+    Index_type seg = offsets[c] - 1;
+    for (; i < idx_end; ++i) {
+      if (is_head(i)) {
+        ++seg;
+        out_keys[seg] = keys[i];
+        out_values[seg] = values[i];
+      } else {
+        out_values[seg] = op(out_values[seg], values[i]);
+      }
+    }
+  });
+
+  for (Index_type c = 1; c < p; ++c) {
+    if (has_carry[c]) {
+      const Index_type seg = offsets[c] - 1;
+      out_values[seg] = op(out_values[seg], carry[c]);
+    }
+  }
+  return offsets[p];
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit copy if given input range, output, count output, and
+   predicate
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+copy_if(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+
+  *num_selected = static_cast<CountT>(detail::select<false>(
+      begin, std::distance(begin, end), out,
+      [=](Index_type i) { return static_cast<bool>(pred(begin[i])); }));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit partition given input range, output, count output, and
+   predicate
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+partition(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Predicate pred)
+{
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+
+  *num_selected = static_cast<CountT>(detail::select<true>(
+      begin, std::distance(begin, end), out,
+      [=](Index_type i) { return static_cast<bool>(pred(begin[i])); }));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit unique given input range, output, count output, and
+   equality function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename CountIter,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+unique(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    CountIter num_selected,
+    Compare eq)
+{
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+
+  *num_selected = static_cast<CountT>(detail::select<false>(
+      begin, std::distance(begin, end), out,
+      [=](Index_type i) { return i == 0 || !eq(begin[i - 1], begin[i]); }));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit reduce by key given key and value input ranges, key
+   and value outputs, count output, and reduction function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValueIter,
+          typename OutKeyIter,
+          typename OutValueIter,
+          typename CountIter,
+          typename BinaryOp>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const KeyIter keys_begin,
+    const KeyIter keys_end,
+    const ValueIter values,
+    OutKeyIter out_keys,
+    OutValueIter out_values,
+    CountIter num_segments,
+    BinaryOp op)
+{
+  using CountT = typename std::iterator_traits<CountIter>::value_type;
+
+  *num_segments = static_cast<CountT>(detail::reduce_by_key(
+      keys_begin, values, std::distance(keys_begin, keys_end), out_keys,
+      out_values, op));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -52,6 +52,22 @@ namespace policy
 namespace tbb
 {
 
+namespace detail
+{
+
+//! run f in the given arena, or in the arena of the calling thread if null
+template <typename Func>
+RAJA_INLINE void arena_execute(::tbb::task_arena* arena, Func&& f)
+{
+  if (arena) {
+    arena->execute(f);
+  } else {
+    f();
+  }
+}
+
+}  // namespace detail
+
 
 /**
  * @brief TBB dynamic for implementation
@@ -91,25 +107,27 @@ forall_impl(resources::Host host_res,
 
   expt::ParamMultiplexer::init<tbb_for_dynamic>(f_params);
 
-  f_params = ::tbb::parallel_reduce(
-      brange(0, dist, p.grain_size),
-
-      f_params,
-
-      [=](const brange& r, ForallParam fp) {
-        using RAJA::internal::thread_privatize;
-        auto privatizer = thread_privatize(loop_body);
-        auto& body = privatizer.get_priv();
-        for (auto i = r.begin(); i != r.end(); ++i)
-          expt::invoke_body(fp, body, b[i]);
-        return fp;
-      },
-
-      [](ForallParam lhs, ForallParam rhs) -> ForallParam {
-        expt::ParamMultiplexer::combine<tbb_for_dynamic>(lhs, rhs);
-        return lhs;
-      }
-  );
+  detail::arena_execute(p.arena, [&]() {
+    f_params = ::tbb::parallel_reduce(
+        brange(0, dist, p.grain_size),
+
+        f_params,
+
+        [=](const brange& r, ForallParam fp) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(loop_body);
+          auto& body = privatizer.get_priv();
+          for (auto i = r.begin(); i != r.end(); ++i)
+            expt::invoke_body(fp, body, b[i]);
+          return fp;
+        },
+
+        [](ForallParam lhs, ForallParam rhs) -> ForallParam {
+          expt::ParamMultiplexer::combine<tbb_for_dynamic>(lhs, rhs);
+          return lhs;
+        }
+    );
+  });
 
   expt::ParamMultiplexer::resolve<tbb_for_dynamic>(f_params);
 
@@ -135,12 +153,14 @@ forall_impl(resources::Host host_res,
   using brange = ::tbb::blocked_range<size_t>;
   auto b = begin(iter);
   size_t dist = std::abs(distance(begin(iter), end(iter)));
-  ::tbb::parallel_for(brange(0, dist, p.grain_size), [=](const brange& r) {
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(loop_body);
-    auto& body = privatizer.get_priv();
-    for (auto i = r.begin(); i != r.end(); ++i)
-      body(b[i]);
+  detail::arena_execute(p.arena, [&]() {
+    ::tbb::parallel_for(brange(0, dist, p.grain_size), [=](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(loop_body);
+      auto& body = privatizer.get_priv();
+      for (auto i = r.begin(); i != r.end(); ++i)
+        body(b[i]);
+    });
   });
 
   return resources::EventProxy<resources::Host>(host_res);
@@ -249,6 +269,118 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// TBB parallel for affinity policy implementation
+///
+
+/**
+ * @brief TBB affinity for implementation
+ *
+ * @param p tbb_for_affinity tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall implements a TBB parallel_for loop over the specified iterable
+ * using an affinity_partitioner and the grain size specified as a
+ * compile-time constant in the policy argument. The partitioner is a static
+ * of this function, which is instantiated for each loop body type, so it
+ * persists per call site (and per calling thread, as a partitioner may not
+ * be used concurrently). Repeated sweeps over the same range then run each
+ * chunk on the thread that ran it last time, which keeps its data in cache.
+ */
+
+template <typename Iterable, typename Func, size_t ChunkSize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(resources::Host host_res,
+            const tbb_for_affinity<ChunkSize>& p,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+
+  static thread_local ::tbb::affinity_partitioner partitioner;
+
+  expt::ParamMultiplexer::init<tbb_for_dynamic>(f_params);
+
+  detail::arena_execute(p.arena, [&]() {
+    f_params = ::tbb::parallel_reduce(
+        brange(0, dist, ChunkSize),
+
+        f_params,
+
+        [=](const brange& r, ForallParam fp) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(loop_body);
+          auto& body = privatizer.get_priv();
+          for (auto i = r.begin(); i != r.end(); ++i)
+            expt::invoke_body(fp, body, b[i]);
+          return fp;
+        },
+
+        [](ForallParam lhs, ForallParam rhs) -> ForallParam {
+          expt::ParamMultiplexer::combine<tbb_for_dynamic>(lhs, rhs);
+          return lhs;
+        },
+        partitioner
+    );
+  });
+
+  expt::ParamMultiplexer::resolve<tbb_for_dynamic>(f_params);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, size_t ChunkSize, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(resources::Host host_res,
+            const tbb_for_affinity<ChunkSize>& p,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+
+  static thread_local ::tbb::affinity_partitioner partitioner;
+
+  detail::arena_execute(p.arena, [&]() {
+    ::tbb::parallel_for(
+        brange(0, dist, ChunkSize),
+        [=](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(loop_body);
+          auto& body = privatizer.get_priv();
+          for (auto i = r.begin(); i != r.end(); ++i)
+            body(b[i]);
+        },
+        partitioner);
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
@@ -0,0 +1,143 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing constructs used to run kernel
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_collapse_HPP
+#define RAJA_policy_tbb_kernel_collapse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Collapse.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/////////
+// Collapsing two loops
+/////////
+
+template <std::size_t GrainSize,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<tbb_collapse_dynamic<GrainSize>,
+                                             ArgList<Arg0, Arg1>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+
+    using len0_t = camp::decay<decltype(l0)>;
+    using len1_t = camp::decay<decltype(l1)>;
+    using brange = ::tbb::blocked_range2d<len0_t, len1_t>;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    ::tbb::parallel_for(
+        brange(0, l0, GrainSize, 0, l1, GrainSize),
+        [&](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (auto i0 = r.rows().begin(); i0 != r.rows().end(); ++i0) {
+            for (auto i1 = r.cols().begin(); i1 != r.cols().end(); ++i1) {
+              private_data.template assign_offset<Arg0>(i0);
+              private_data.template assign_offset<Arg1>(i1);
+              execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+            }
+          }
+        });
+  }
+};
+
+
+template <std::size_t GrainSize,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<tbb_collapse_dynamic<GrainSize>,
+                                             ArgList<Arg0, Arg1, Arg2>,
+                                             EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    const auto l2 = segment_length<Arg2>(data);
+
+    using len0_t = camp::decay<decltype(l0)>;
+    using len1_t = camp::decay<decltype(l1)>;
+    using len2_t = camp::decay<decltype(l2)>;
+    using brange = ::tbb::blocked_range3d<len0_t, len1_t, len2_t>;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    ::tbb::parallel_for(
+        brange(0, l0, GrainSize, 0, l1, GrainSize, 0, l2, GrainSize),
+        [&](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (auto i0 = r.pages().begin(); i0 != r.pages().end(); ++i0) {
+            for (auto i1 = r.rows().begin(); i1 != r.rows().end(); ++i1) {
+              for (auto i2 = r.cols().begin(); i2 != r.cols().end(); ++i2) {
+                private_data.template assign_offset<Arg0>(i0);
+                private_data.template assign_offset<Arg1>(i1);
+                private_data.template assign_offset<Arg2>(i2);
+                execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+              }
+            }
+          }
+        });
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
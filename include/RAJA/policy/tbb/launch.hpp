@@ -0,0 +1,289 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for RAJA::launch::tbb
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_launch_tbb_HPP
+#define RAJA_pattern_launch_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/launch/launch_core.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+
+namespace RAJA
+{
+
+/*!
+ * The launch body runs once on the calling thread, the parallelism comes
+ * from the RAJA::loop methods in it. Loops with tbb_for_dynamic policies
+ * run as TBB parallel_for loops, so nested parallel loops compose through
+ * TBB work stealing.
+ *
+ * There is one shared memory buffer for the launch, so teams that use
+ * shared memory must run one after the other, e.g. with a loop_exec team
+ * loop and tbb_for_dynamic thread loops. teamSync is not needed as each
+ * parallel loop completes before the next statement runs.
+ */
+template <>
+struct LaunchExecute<RAJA::tbb_launch_t> {
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchParams const &params, const char *RAJA_UNUSED_ARG(kernel_name), BODY const &body)
+  {
+
+    LaunchContext ctx;
+
+    char *kernel_local_mem = new char[params.shared_mem_size];
+    ctx.shared_mem_ptr = kernel_local_mem;
+
+    body(ctx);
+
+    delete[] kernel_local_mem;
+    ctx.shared_mem_ptr = nullptr;
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+
+template <typename SEGMENT>
+struct LoopExecute<tbb_for_dynamic, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range<int>;
+    const int len = segment.end() - segment.begin();
+
+    ::tbb::parallel_for(brange(0, len), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int i = r.begin(); i != r.end(); ++i) {
+        loop_body(*(segment.begin() + i));
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range2d<int>;
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::tbb::parallel_for(brange(0, len1, 0, len0), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+        for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+          loop_body(*(segment0.begin() + i), *(segment1.begin() + j));
+        }
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range3d<int>;
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::tbb::parallel_for(brange(0, len2, 0, len1, 0, len0), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int k = r.pages().begin(); k != r.pages().end(); ++k) {
+        for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+          for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+            loop_body(*(segment0.begin() + i),
+                      *(segment1.begin() + j),
+                      *(segment2.begin() + k));
+          }
+        }
+      }
+    });
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<tbb_for_dynamic, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range<int>;
+    const int len = segment.end() - segment.begin();
+
+    ::tbb::parallel_for(brange(0, len), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int i = r.begin(); i != r.end(); ++i) {
+        loop_body(*(segment.begin() + i), i);
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range2d<int>;
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::tbb::parallel_for(brange(0, len1, 0, len0), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+        for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+          loop_body(*(segment0.begin() + i),
+                    *(segment1.begin() + j),
+                    i,
+                    j);
+        }
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range3d<int>;
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::tbb::parallel_for(brange(0, len2, 0, len1, 0, len0), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int k = r.pages().begin(); k != r.pages().end(); ++k) {
+        for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+          for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+            loop_body(*(segment0.begin() + i),
+                      *(segment1.begin() + j),
+                      *(segment2.begin() + k),
+                      i,
+                      j,
+                      k);
+          }
+        }
+      }
+    });
+  }
+};
+
+
+template <typename SEGMENT>
+struct TileExecute<tbb_for_dynamic, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range<int>;
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+    ::tbb::parallel_for(brange(0, numTiles), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int i = r.begin(); i != r.end(); ++i) {
+        loop_body(segment.slice(i * tile_size, tile_size));
+      }
+    });
+  }
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<tbb_for_dynamic, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    using brange = ::tbb::blocked_range<int>;
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+
+    ::tbb::parallel_for(brange(0, numTiles), [&](const brange& r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto& loop_body = privatizer.get_priv();
+      for (int i = r.begin(); i != r.end(); ++i) {
+        loop_body(segment.slice(i * tile_size, tile_size), i);
+      }
+    });
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
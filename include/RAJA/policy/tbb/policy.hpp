@@ -18,10 +18,16 @@
 #ifndef policy_tbb_HPP
 #define policy_tbb_HPP
 
+#include "RAJA/config.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 
 #include <cstddef>
 
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/task_arena.h>
+#endif
+
 namespace RAJA
 {
 namespace policy
@@ -47,7 +53,27 @@ struct tbb_for_dynamic
                                             Launch::undefined,
                                             Platform::host> {
   std::size_t grain_size;
-  tbb_for_dynamic(std::size_t grain_size_ = 1) : grain_size(grain_size_) {}
+  //! arena to run the loop in, e.g. one pinned to a NUMA node, if not null
+  ::tbb::task_arena* arena;
+  tbb_for_dynamic(std::size_t grain_size_ = 1,
+                  ::tbb::task_arena* arena_ = nullptr)
+      : grain_size(grain_size_), arena(arena_) {}
+};
+
+///
+/// Uses a tbb::affinity_partitioner kept per call site and calling thread,
+/// so repeated sweeps over the same range replay the thread to chunk
+/// assignment of the previous sweep and find their data in cache
+///
+template <std::size_t GrainSize = 1>
+struct tbb_for_affinity
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  //! arena to run the loop in, e.g. one pinned to a NUMA node, if not null
+  ::tbb::task_arena* arena;
+  tbb_for_affinity(::tbb::task_arena* arena_ = nullptr) : arena(arena_) {}
 };
 
 
@@ -65,6 +91,31 @@ using tbb_for_exec = tbb_for_static<>;
 ///
 using tbb_segit = tbb_for_exec;
 
+///
+/// Kernel Collapse policy, the collapsed loops run as one TBB parallel_for
+/// over a blocked_range2d or blocked_range3d with the dynamic loop scheduler
+///
+template <std::size_t GrainSize = 1>
+struct tbb_collapse_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+using tbb_collapse_exec = tbb_collapse_dynamic<>;
+
+///
+/// Launch policy, the launch body runs once on the calling thread and
+/// RAJA::loop methods with tbb_for_dynamic policies run as TBB parallel_for
+/// loops
+///
+struct tbb_launch_t : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                                            Pattern::region,
+                                                            Launch::undefined,
+                                                            Platform::host> {
+};
+
 ///
 /// WorkGroup execution policies
 ///
@@ -74,6 +125,16 @@ struct tbb_work : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                         Platform::host> {
 };
 
+///
+/// WorkGroup order policy that runs each of the loops as a task in a
+/// tbb::task_group so the loops run concurrently
+///
+struct unordered_tbb_task_group
+    : make_policy_pattern_platform_t<Policy::tbb,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -91,12 +152,17 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
 }  // namespace tbb
 }  // namespace policy
 
+using policy::tbb::tbb_collapse_dynamic;
+using policy::tbb::tbb_collapse_exec;
+using policy::tbb::tbb_for_affinity;
 using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
+using policy::tbb::tbb_launch_t;
 using policy::tbb::tbb_reduce;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
+using policy::tbb::unordered_tbb_task_group;
 
 }  // namespace RAJA
 
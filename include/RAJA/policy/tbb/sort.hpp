@@ -211,6 +211,69 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+unstable_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  tbb::parallel_for(
+      tbb::blocked_range<int>{0, num_segments},
+      [&](const tbb::blocked_range<int>& range) {
+        for (int s = range.begin(); s < range.end(); ++s) {
+          if (offsets[s + 1] - offsets[s] > 1) {
+            detail::UnstableSorter{}(begin + offsets[s],
+                                     begin + offsets[s + 1], comp);
+          }
+        }
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+unstable_segmented_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter,
+    ValIter vals_begin,
+    OffsetIter offsets,
+    int num_segments,
+    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  tbb::parallel_for(
+      tbb::blocked_range<int>{0, num_segments},
+      [&](const tbb::blocked_range<int>& range) {
+        for (int s = range.begin(); s < range.end(); ++s) {
+          if (offsets[s + 1] - offsets[s] > 1) {
+            detail::UnstableSorter{}(begin + offsets[s], begin + offsets[s + 1],
+                                     RAJA::compare_first<zip_ref>(comp));
+          }
+        }
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace sort
 
 }  // namespace impl
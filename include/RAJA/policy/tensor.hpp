@@ -22,5 +22,7 @@
 
 #include "RAJA/policy/tensor/arch_impl.hpp"
 #include "RAJA/policy/tensor/policy.hpp"
+#include "RAJA/policy/tensor/forall.hpp"
+#include "RAJA/policy/tensor/reduce.hpp"
 
 #endif  // closing endif for header file include guard
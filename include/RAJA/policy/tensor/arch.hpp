@@ -80,6 +80,28 @@ struct avx_register {};
 #endif
 
 
+/*!
+ * An ARM SVE register, the vector length is fixed at compile time with
+ * -msve-vector-bits=<bits>
+ */
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+struct sve_register {};
+
+#ifndef RAJA_TENSOR_REGISTER_TYPE
+#define RAJA_TENSOR_REGISTER_TYPE RAJA::expt::sve_register
+#endif
+#endif
+
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+struct neon_register {};
+
+#ifndef RAJA_TENSOR_REGISTER_TYPE
+#define RAJA_TENSOR_REGISTER_TYPE RAJA::expt::neon_register
+#endif
+#endif
+
+
 #ifdef RAJA_ENABLE_CUDA
 
 /*!
@@ -135,6 +157,14 @@ struct scalar_register {};
 #include "RAJA/policy/tensor/arch/avx/traits.hpp"
 #endif
 
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+#include "RAJA/policy/tensor/arch/sve/traits.hpp"
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include "RAJA/policy/tensor/arch/neon/traits.hpp"
+#endif
+
 
 #ifdef RAJA_ENABLE_CUDA
 #include "RAJA/policy/tensor/arch/cuda/traits.hpp"
@@ -465,6 +465,32 @@ namespace expt
       {
         return self_type(_mm256_min_pd(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        if(lvl == 0){
+          return self_type(_mm256_unpacklo_pd(m_value, y.m_value));
+        }
+        return self_type(_mm256_permute2f128_pd(m_value, y.m_value, 0x20));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        if(lvl == 0){
+          return self_type(_mm256_unpackhi_pd(m_value, y.m_value));
+        }
+        return self_type(_mm256_permute2f128_pd(m_value, y.m_value, 0x31));
+      }
   };
 
 
@@ -477,6 +477,36 @@ namespace expt
       {
         return self_type(_mm256_min_ps(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        switch(lvl){
+          case 0: return self_type(_mm256_blend_ps(m_value, _mm256_moveldup_ps(y.m_value), 0xAA));
+          case 1: return self_type(_mm256_castpd_ps(_mm256_unpacklo_pd(
+                      _mm256_castps_pd(m_value), _mm256_castps_pd(y.m_value))));
+        }
+        return self_type(_mm256_permute2f128_ps(m_value, y.m_value, 0x20));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        switch(lvl){
+          case 0: return self_type(_mm256_blend_ps(_mm256_movehdup_ps(m_value), y.m_value, 0xAA));
+          case 1: return self_type(_mm256_castpd_ps(_mm256_unpackhi_pd(
+                      _mm256_castps_pd(m_value), _mm256_castps_pd(y.m_value))));
+        }
+        return self_type(_mm256_permute2f128_ps(m_value, y.m_value, 0x31));
+      }
   };
 
 
@@ -757,6 +757,42 @@ namespace expt
         // Stitch back together
         return self_type(_mm256_insertf128_si256(res_low, res_hi, 1));
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        __m256 x = _mm256_castsi256_ps(m_value);
+        __m256 yy = _mm256_castsi256_ps(y.m_value);
+        switch(lvl){
+          case 0: return self_type(_mm256_castps_si256(
+                      _mm256_blend_ps(x, _mm256_moveldup_ps(yy), 0xAA)));
+          case 1: return self_type(_mm256_castpd_si256(_mm256_unpacklo_pd(
+                      _mm256_castps_pd(x), _mm256_castps_pd(yy))));
+        }
+        return self_type(_mm256_castps_si256(_mm256_permute2f128_ps(x, yy, 0x20)));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        __m256 x = _mm256_castsi256_ps(m_value);
+        __m256 yy = _mm256_castsi256_ps(y.m_value);
+        switch(lvl){
+          case 0: return self_type(_mm256_castps_si256(
+                      _mm256_blend_ps(_mm256_movehdup_ps(x), yy, 0xAA)));
+          case 1: return self_type(_mm256_castpd_si256(_mm256_unpackhi_pd(
+                      _mm256_castps_pd(x), _mm256_castps_pd(yy))));
+        }
+        return self_type(_mm256_castps_si256(_mm256_permute2f128_ps(x, yy, 0x31)));
+      }
   };
 
 
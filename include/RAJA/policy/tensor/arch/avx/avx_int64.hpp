@@ -525,6 +525,36 @@ namespace expt
               get(0) < a.get(0) ? get(0) : a.get(0) ));
         
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        __m256d x = _mm256_castsi256_pd(m_value);
+        __m256d yy = _mm256_castsi256_pd(y.m_value);
+        if(lvl == 0){
+          return self_type(_mm256_castpd_si256(_mm256_unpacklo_pd(x, yy)));
+        }
+        return self_type(_mm256_castpd_si256(_mm256_permute2f128_pd(x, yy, 0x20)));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        __m256d x = _mm256_castsi256_pd(m_value);
+        __m256d yy = _mm256_castsi256_pd(y.m_value);
+        if(lvl == 0){
+          return self_type(_mm256_castpd_si256(_mm256_unpackhi_pd(x, yy)));
+        }
+        return self_type(_mm256_castpd_si256(_mm256_permute2f128_pd(x, yy, 0x31)));
+      }
   };
 
 
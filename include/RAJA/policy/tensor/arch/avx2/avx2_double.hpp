@@ -549,6 +549,46 @@ namespace expt
       {
         return self_type(_mm256_min_pd(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        if(lvl == 0){
+          return self_type(_mm256_unpacklo_pd(m_value, y.m_value));
+        }
+        return self_type(_mm256_permute2f128_pd(m_value, y.m_value, 0x20));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        if(lvl == 0){
+          return self_type(_mm256_unpackhi_pd(m_value, y.m_value));
+        }
+        return self_type(_mm256_permute2f128_pd(m_value, y.m_value, 0x31));
+      }
+
+      /*!
+       * @brief Permutes the lanes, lane i of the result is lane idx[i]
+       */
+      RAJA_INLINE
+      self_type permute(int_vector_type const &idx) const
+      {
+        // lane i takes the 32 bit halves 2*idx[i] and 2*idx[i]+1
+        __m256i lo = _mm256_slli_epi64(idx.get_register(), 1);
+        __m256i halves = _mm256_or_si256(lo,
+            _mm256_slli_epi64(_mm256_add_epi64(lo, _mm256_set1_epi64x(1)), 32));
+        return self_type(_mm256_castps_pd(
+            _mm256_permutevar8x32_ps(_mm256_castpd_ps(m_value), halves)));
+      }
   };
 
 
@@ -555,6 +555,51 @@ namespace expt
       {
         return self_type(_mm256_min_epi32(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        __m256 x = _mm256_castsi256_ps(m_value);
+        __m256 yy = _mm256_castsi256_ps(y.m_value);
+        switch(lvl){
+          case 0: return self_type(_mm256_castps_si256(
+                      _mm256_blend_ps(x, _mm256_moveldup_ps(yy), 0xAA)));
+          case 1: return self_type(_mm256_castpd_si256(_mm256_unpacklo_pd(
+                      _mm256_castps_pd(x), _mm256_castps_pd(yy))));
+        }
+        return self_type(_mm256_castps_si256(_mm256_permute2f128_ps(x, yy, 0x20)));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        __m256 x = _mm256_castsi256_ps(m_value);
+        __m256 yy = _mm256_castsi256_ps(y.m_value);
+        switch(lvl){
+          case 0: return self_type(_mm256_castps_si256(
+                      _mm256_blend_ps(_mm256_movehdup_ps(x), yy, 0xAA)));
+          case 1: return self_type(_mm256_castpd_si256(_mm256_unpackhi_pd(
+                      _mm256_castps_pd(x), _mm256_castps_pd(yy))));
+        }
+        return self_type(_mm256_castps_si256(_mm256_permute2f128_ps(x, yy, 0x31)));
+      }
+
+      /*!
+       * @brief Permutes the lanes, lane i of the result is lane idx[i]
+       */
+      RAJA_INLINE
+      self_type permute(int_vector_type const &idx) const
+      {
+        return self_type(_mm256_permutevar8x32_epi32(m_value, idx.get_register()));
+      }
   };
 
 
@@ -464,12 +464,9 @@ namespace expt
       RAJA_INLINE
       self_type vmax(self_type a) const
       {
-          return self_type(_mm256_set_epi64x(
-              get(3) > a.get(3) ? get(3) : a.get(3),
-              get(2) > a.get(2) ? get(2) : a.get(2),
-              get(1) > a.get(1) ? get(1) : a.get(1),
-              get(0) > a.get(0) ? get(0) : a.get(0) ));
-        
+        // AVX2 has no 64-bit integer max, select with a compare instead
+        __m256i gt = _mm256_cmpgt_epi64(m_value, a.m_value);
+        return self_type(_mm256_blendv_epi8(a.m_value, m_value, gt));
       }
 
       /*!
@@ -525,18 +522,58 @@ namespace expt
       }
 
       /*!
-       * @brief Returns element-wise largest values
-       * @return Vector of the element-wise max values
+       * @brief Returns element-wise smallest values
+       * @return Vector of the element-wise min values
        */
       RAJA_INLINE
       self_type vmin(self_type a) const
       {
-          return self_type(_mm256_set_epi64x(
-              get(3) < a.get(3) ? get(3) : a.get(3),
-              get(2) < a.get(2) ? get(2) : a.get(2),
-              get(1) < a.get(1) ? get(1) : a.get(1),
-              get(0) < a.get(0) ? get(0) : a.get(0) ));
-        
+        // AVX2 has no 64-bit integer min, select with a compare instead
+        __m256i gt = _mm256_cmpgt_epi64(m_value, a.m_value);
+        return self_type(_mm256_blendv_epi8(m_value, a.m_value, gt));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        __m256d x = _mm256_castsi256_pd(m_value);
+        __m256d yy = _mm256_castsi256_pd(y.m_value);
+        if(lvl == 0){
+          return self_type(_mm256_castpd_si256(_mm256_unpacklo_pd(x, yy)));
+        }
+        return self_type(_mm256_castpd_si256(_mm256_permute2f128_pd(x, yy, 0x20)));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        __m256d x = _mm256_castsi256_pd(m_value);
+        __m256d yy = _mm256_castsi256_pd(y.m_value);
+        if(lvl == 0){
+          return self_type(_mm256_castpd_si256(_mm256_unpackhi_pd(x, yy)));
+        }
+        return self_type(_mm256_castpd_si256(_mm256_permute2f128_pd(x, yy, 0x31)));
+      }
+
+      /*!
+       * @brief Permutes the lanes, lane i of the result is lane idx[i]
+       */
+      RAJA_INLINE
+      self_type permute(int_vector_type const &idx) const
+      {
+        // lane i takes the 32 bit halves 2*idx[i] and 2*idx[i]+1
+        __m256i lo = _mm256_slli_epi64(idx.get_register(), 1);
+        __m256i halves = _mm256_or_si256(lo,
+            _mm256_slli_epi64(_mm256_add_epi64(lo, _mm256_set1_epi64x(1)), 32));
+        return self_type(_mm256_permutevar8x32_epi32(m_value, halves));
       }
   };
 
@@ -0,0 +1,458 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a SIMD register abstraction.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// 16-bit integer lanes need the AVX512BW instructions
+#ifdef __AVX512BW__
+
+#ifndef RAJA_policy_vector_register_avx512_int16_HPP
+#define RAJA_policy_vector_register_avx512_int16_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+
+// Include SIMD intrinsics header file
+#include <immintrin.h>
+#include <cmath>
+
+
+namespace RAJA
+{
+namespace expt
+{
+  /*!
+   * 32 lanes of int16_t, these are the offsets of gathers and scatters of
+   * the half precision register. There are no 16-bit gathers, scatters or
+   * divides in AVX512, those go through memory one element at a time.
+   */
+  template<>
+  class Register<int16_t, avx512_register> :
+    public internal::expt::RegisterBase<Register<int16_t, avx512_register>>
+  {
+    public:
+      using base_type = internal::expt::RegisterBase<Register<int16_t, avx512_register>>;
+
+      using register_policy = avx512_register;
+      using self_type = Register<int16_t, avx512_register>;
+      using element_type = int16_t;
+      using register_type = __m512i;
+
+      using int_vector_type = Register<int16_t, avx512_register>;
+
+
+    private:
+      register_type m_value;
+
+      RAJA_INLINE
+      __mmask32 createMask(camp::idx_t N) const {
+        // Generate a mask
+        return N >= 32 ? __mmask32(0xFFFFFFFF) :
+               N <= 0  ? __mmask32(0) :
+                         __mmask32((1u << N) - 1u);
+      }
+
+    public:
+
+      static constexpr camp::idx_t s_num_elem = 32;
+
+      /*!
+       * @brief Default constructor, zeros register contents
+       */
+      RAJA_INLINE
+      Register() : base_type(), m_value(_mm512_setzero_si512()) {
+      }
+
+      /*!
+       * @brief Copy constructor from underlying simd register
+       */
+      RAJA_INLINE
+      explicit Register(register_type const &c) : base_type(), m_value(c) {}
+
+
+      /*!
+       * @brief Copy constructor
+       */
+      RAJA_INLINE
+      Register(self_type const &c) : base_type(), m_value(c.m_value) {}
+
+      /*!
+       * @brief Copy assignment constructor
+       */
+      RAJA_INLINE
+      self_type &operator=(self_type const &c){
+        m_value = c.m_value;
+        return *this;
+      }
+
+      /*!
+       * @brief Construct from scalar.
+       * Sets all elements to same value (broadcast).
+       */
+      RAJA_INLINE
+      Register(element_type const &c) : base_type(), m_value(_mm512_set1_epi16(c)) {}
+
+
+      /*!
+       * @brief Load a full register from a stride-one memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+        m_value = _mm512_loadu_si512(ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+				// AVX512BW
+        m_value = _mm512_maskz_loadu_epi16(createMask(N), ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Gather a full register from a strided memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided(element_type const *ptr, camp::idx_t stride){
+        return load_strided_n(ptr, stride, s_num_elem);
+      }
+
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
+        alignas(64) element_type tmp[32] = {0};
+        for(camp::idx_t i = 0;i < N;++ i){
+          tmp[i] = ptr[i*stride];
+        }
+        m_value = _mm512_load_si512(tmp);
+        return *this;
+      }
+
+
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type const &offsets){
+        return gather_n(ptr, offsets, s_num_elem);
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type const &offsets, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        alignas(64) element_type off[32];
+        alignas(64) element_type tmp[32] = {0};
+        offsets.store_packed(off);
+        for(camp::idx_t i = 0;i < N;++ i){
+          tmp[i] = ptr[off[i]];
+        }
+        m_value = _mm512_load_si512(tmp);
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+        _mm512_storeu_si512(ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+				// AVX512BW
+        _mm512_mask_storeu_epi16(ptr, createMask(N), m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
+        return store_strided_n(ptr, stride, s_num_elem);
+      }
+
+
+      /*!
+       * @brief Store partial register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
+        alignas(64) element_type tmp[32];
+        _mm512_store_si512(tmp, m_value);
+        for(camp::idx_t i = 0;i < N;++ i){
+          ptr[i*stride] = tmp[i];
+        }
+        return *this;
+      }
+
+
+      /*!
+       * @brief Generic scatter operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter(element_type *ptr, int_vector_type const &offsets) const {
+        return scatter_n(ptr, offsets, s_num_elem);
+      }
+
+      /*!
+       * @brief Generic scatter operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter_n(element_type *ptr, int_vector_type const &offsets, camp::idx_t N) const {
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided_n ++;
+#endif
+        alignas(64) element_type off[32];
+        alignas(64) element_type tmp[32];
+        offsets.store_packed(off);
+        _mm512_store_si512(tmp, m_value);
+        for(camp::idx_t i = 0;i < N;++ i){
+          ptr[off[i]] = tmp[i];
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Get scalar value from vector register
+       * @param i Offset of scalar to get
+       * @return Returns scalar value at i
+       */
+      RAJA_INLINE
+      element_type get(camp::idx_t i) const
+      {
+        alignas(64) element_type tmp[32];
+        _mm512_store_si512(tmp, m_value);
+        return tmp[i];
+      }
+
+
+      /*!
+       * @brief Set scalar value in vector register
+       * @param i Offset of scalar to set
+       * @param value Value of scalar to set
+       */
+      RAJA_INLINE
+      self_type &set(element_type value, camp::idx_t i)
+      {
+				m_value = _mm512_mask_set1_epi16(m_value, __mmask32(1u << i), value);
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &broadcast(element_type const &value){
+        m_value =  _mm512_set1_epi16(value);
+        return *this;
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &copy(self_type const &src){
+        m_value = src.m_value;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type add(self_type const &b) const {
+        return self_type(_mm512_add_epi16(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type subtract(self_type const &b) const {
+        return self_type(_mm512_sub_epi16(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply(self_type const &b) const {
+        return self_type(_mm512_mullo_epi16(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide(self_type const &b) const {
+        return divide_n(b, s_num_elem);
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide_n(self_type const &b, camp::idx_t N) const {
+        // AVX512 does not supply an integer divide, so do it manually
+        alignas(64) element_type x[32];
+        alignas(64) element_type y[32];
+        _mm512_store_si512(x, m_value);
+        _mm512_store_si512(y, b.m_value);
+        for(camp::idx_t i = 0;i < 32;++ i){
+          x[i] = i < N ? element_type(x[i] / y[i]) : element_type(0);
+        }
+        return self_type(_mm512_load_si512(x));
+      }
+
+
+      /*!
+       * @brief Sum the elements of this vector
+       * @return Sum of the values of the vectors scalar elements
+       */
+      RAJA_INLINE
+      element_type sum() const
+      {
+        // widen to two registers of int32, the truncated sum is the same
+				return element_type(_mm512_reduce_add_epi32(
+            _mm512_add_epi32(lower_epi32(m_value), upper_epi32(m_value))));
+      }
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max() const
+      {
+        return element_type(_mm512_reduce_max_epi32(
+            _mm512_max_epi32(lower_epi32(m_value), upper_epi32(m_value))));
+      }
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max_n(camp::idx_t N) const
+      {
+        auto ident = _mm512_set1_epi16(RAJA::operators::limits<element_type>::min());
+				return self_type(_mm512_mask_blend_epi16(createMask(N), ident, m_value)).max();
+      }
+
+      /*!
+       * @brief Returns element-wise largest values
+       * @return Vector of the element-wise max values
+       */
+      RAJA_INLINE
+      self_type vmax(self_type a) const
+      {
+        return self_type(_mm512_max_epi16(m_value, a.m_value));
+      }
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min() const
+      {
+        return element_type(_mm512_reduce_min_epi32(
+            _mm512_min_epi32(lower_epi32(m_value), upper_epi32(m_value))));
+      }
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min_n(camp::idx_t N) const
+      {
+        auto ident = _mm512_set1_epi16(RAJA::operators::limits<element_type>::max());
+				return self_type(_mm512_mask_blend_epi16(createMask(N), ident, m_value)).min();
+      }
+
+      /*!
+       * @brief Returns element-wise largest values
+       * @return Vector of the element-wise max values
+       */
+      RAJA_INLINE
+      self_type vmin(self_type a) const
+      {
+        return self_type(_mm512_min_epi16(m_value, a.m_value));
+      }
+
+    private:
+
+      //! sign extend lanes 0-15 to int32
+      RAJA_INLINE
+      static __m512i lower_epi32(register_type x){
+        return _mm512_cvtepi16_epi32(_mm512_castsi512_si256(x));
+      }
+
+      //! sign extend lanes 16-31 to int32
+      RAJA_INLINE
+      static __m512i upper_epi32(register_type x){
+        return _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(x, 1));
+      }
+  };
+
+}   // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
+
+#endif //__AVX512BW__
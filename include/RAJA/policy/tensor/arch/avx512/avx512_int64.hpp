@@ -178,6 +178,51 @@ namespace expt
       }
 
 
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type const &offsets){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+				// AVX512F
+        m_value = _mm512_i64gather_epi64(offsets.get_register(),
+                                      ptr,
+                                      sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type const &offsets, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+				// AVX512F
+        m_value = _mm512_mask_i64gather_epi64(_mm512_setzero_epi32(),
+                                      createMask(N),
+                                      offsets.get_register(),
+                                      ptr,
+                                      sizeof(element_type));
+        return *this;
+      }
+
+
       /*!
        * @brief Store entire register to consecutive memory locations
        *
@@ -235,6 +280,52 @@ namespace expt
         return *this;
       }
 
+
+      /*!
+       * @brief Generic scatter operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter(element_type *ptr, int_vector_type const &offsets) const {
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided_n ++;
+#endif
+				// AVX512F
+        _mm512_i64scatter_epi64(ptr,
+                             offsets.get_register(),
+                             m_value,
+                             sizeof(element_type));
+        return *this;
+      }
+
+      /*!
+       * @brief Generic scatter operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be stored relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type const &scatter_n(element_type *ptr, int_vector_type const &offsets, camp::idx_t N) const {
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided_n ++;
+#endif
+				// AVX512F
+        _mm512_mask_i64scatter_epi64(ptr,
+                                  createMask(N),
+                                  offsets.get_register(),
+                                  m_value,
+                                  sizeof(element_type));
+        return *this;
+      }
+
       /*!
        * @brief Get scalar value from vector register
        * @param i Offset of scalar to get
@@ -392,6 +483,44 @@ namespace expt
       {
         return self_type(_mm512_min_epi64(m_value, a.m_value));
       }
+
+      /*!
+       * @brief Permute-and-shuffle left step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_left
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_left(camp::idx_t lvl, self_type const &y) const
+      {
+        // lanes with bit lvl set take lane i-2^lvl of y
+        __m512i iota = _mm512_set_epi64(7,6,5,4,3,2,1,0);
+        __mmask8 from_y = _mm512_test_epi64_mask(iota, _mm512_set1_epi64(1<<lvl));
+        __m512i idx = _mm512_mask_add_epi64(iota, from_y, iota, _mm512_set1_epi64(8-(1<<lvl)));
+        return self_type(_mm512_permutex2var_epi64(m_value, idx, y.m_value));
+      }
+
+      /*!
+       * @brief Permute-and-shuffle right step of the in register matrix
+       * transpose, see RegisterBase::transpose_shuffle_right
+       */
+      RAJA_INLINE
+      self_type transpose_shuffle_right(int lvl, self_type const &y) const
+      {
+        // lanes with bit lvl clear take lane i+2^lvl of x, others lane i of y
+        __m512i iota = _mm512_set_epi64(7,6,5,4,3,2,1,0);
+        __mmask8 from_y = _mm512_test_epi64_mask(iota, _mm512_set1_epi64(1<<lvl));
+        __m512i idx = _mm512_mask_add_epi64(_mm512_add_epi64(iota, _mm512_set1_epi64(1<<lvl)), from_y,
+                                      iota, _mm512_set1_epi64(8));
+        return self_type(_mm512_permutex2var_epi64(m_value, idx, y.m_value));
+      }
+
+      /*!
+       * @brief Permutes the lanes, lane i of the result is lane idx[i]
+       */
+      RAJA_INLINE
+      self_type permute(int_vector_type const &idx) const
+      {
+        return self_type(_mm512_permutexvar_epi64(idx.get_register(), m_value));
+      }
   };
 
 
@@ -62,6 +62,28 @@ namespace expt {
       using int_element_type = int64_t;
   };
 
+#ifdef __AVX512BW__
+  template<>
+  struct RegisterTraits<RAJA::expt::avx512_register, int16_t>{
+      using element_type = int16_t;
+      using register_policy = RAJA::expt::avx512_register;
+      static constexpr camp::idx_t s_num_bits = 512;
+      static constexpr camp::idx_t s_num_elem = 32;
+      using int_element_type = int16_t;
+  };
+#endif
+
+#ifdef __AVX512FP16__
+  template<>
+  struct RegisterTraits<RAJA::expt::avx512_register, _Float16>{
+      using element_type = _Float16;
+      using register_policy = RAJA::expt::avx512_register;
+      static constexpr camp::idx_t s_num_bits = 512;
+      static constexpr camp::idx_t s_num_elem = 32;
+      using int_element_type = int16_t;
+  };
+#endif
+
 } // namespace internal
 } // namespace expt
 } // namespace RAJA
@@ -23,6 +23,7 @@
 
 #include<RAJA/policy/tensor/arch/cuda/traits.hpp>
 #include<RAJA/policy/tensor/arch/cuda/cuda_warp.hpp>
+#include<RAJA/policy/tensor/arch/cuda/cuda_mma.hpp>
 
 
 #endif
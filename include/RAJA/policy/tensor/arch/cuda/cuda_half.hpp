@@ -0,0 +1,151 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the half precision and bfloat16 element
+ *          support of the CUDA warp register.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+
+#ifdef RAJA_ENABLE_CUDA
+
+#ifndef RAJA_policy_tensor_arch_cuda_cuda_half_HPP
+#define RAJA_policy_tensor_arch_cuda_cuda_half_HPP
+
+#include <cuda_fp16.h>
+
+#if defined(__CUDACC_VER_MAJOR__) && (__CUDACC_VER_MAJOR__ >= 11)
+#define RAJA_CUDA_WARP_BFLOAT16
+#include <cuda_bf16.h>
+#endif
+
+/*
+ * The warp register holds one element per lane, so besides double, float,
+ * int32 and int64 it works with __half and __nv_bfloat16 elements. The
+ * packed __half2 and __nv_bfloat162 elements hold two values per lane and
+ * do two operations per instruction; they support the arithmetic and sum
+ * of the register, but not the comparisons (min, max).
+ */
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Zero of a warp register element
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_DEVICE
+  T warp_zero(){
+    return T(0);
+  }
+
+  template<>
+  RAJA_INLINE
+  RAJA_DEVICE
+  __half2 warp_zero<__half2>(){
+    return __float2half2_rn(0.0f);
+  }
+
+  /*!
+   * Fused multiply add of warp register elements
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_DEVICE
+  T warp_fma(T a, T b, T c){
+    return fma(a, b, c);
+  }
+
+  RAJA_INLINE
+  RAJA_DEVICE
+  __half warp_fma(__half a, __half b, __half c){
+    return __hfma(a, b, c);
+  }
+
+  RAJA_INLINE
+  RAJA_DEVICE
+  __half2 warp_fma(__half2 a, __half2 b, __half2 c){
+    return __hfma2(a, b, c);
+  }
+
+#ifdef RAJA_CUDA_WARP_BFLOAT16
+  template<>
+  RAJA_INLINE
+  RAJA_DEVICE
+  __nv_bfloat162 warp_zero<__nv_bfloat162>(){
+    return __float2bfloat162_rn(0.0f);
+  }
+
+  RAJA_INLINE
+  RAJA_DEVICE
+  __nv_bfloat16 warp_fma(__nv_bfloat16 a, __nv_bfloat16 b, __nv_bfloat16 c){
+    return __hfma(a, b, c);
+  }
+
+  RAJA_INLINE
+  RAJA_DEVICE
+  __nv_bfloat162 warp_fma(__nv_bfloat162 a, __nv_bfloat162 b, __nv_bfloat162 c){
+    return __hfma2(a, b, c);
+  }
+#endif
+
+} // namespace expt
+} // namespace internal
+
+
+namespace operators
+{
+
+// largest finite half is 65504
+template <>
+struct limits<__half> {
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr __half min()
+  {
+    return __half(__half_raw{0xFBFF});
+  }
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr __half max()
+  {
+    return __half(__half_raw{0x7BFF});
+  }
+};
+
+#ifdef RAJA_CUDA_WARP_BFLOAT16
+// bfloat16 has the exponent range of float
+template <>
+struct limits<__nv_bfloat16> {
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr __nv_bfloat16 min()
+  {
+    return __nv_bfloat16(__nv_bfloat16_raw{0xFF7F});
+  }
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr __nv_bfloat16 max()
+  {
+    return __nv_bfloat16(__nv_bfloat16_raw{0x7F7F});
+  }
+};
+#endif
+
+} // namespace operators
+
+} // namespace RAJA
+
+#endif // guard
+
+#endif // RAJA_ENABLE_CUDA
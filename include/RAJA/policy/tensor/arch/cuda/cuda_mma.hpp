@@ -0,0 +1,169 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the CUDA tensor core matrix multiply.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/MatrixMultiplyUnit.hpp"
+
+#ifdef RAJA_ENABLE_CUDA
+
+#ifndef RAJA_policy_tensor_arch_cuda_cuda_mma_HPP
+#define RAJA_policy_tensor_arch_cuda_cuda_mma_HPP
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  /**
+   * Double precision tensor core multiply for cuda_warp_register matrices.
+   *
+   * Uses mma.sync.m8n8k4.f64 (sm_80 and newer) on each 8x8x4 tile of the
+   * product. The elements each lane needs for a tile fragment are gathered
+   * from the matrix registers with warp shuffles, and the result fragment is
+   * scattered back the same way.
+   */
+  template<camp::idx_t N_SIZE, camp::idx_t M_SIZE, camp::idx_t O_SIZE>
+  struct MatrixMultiplyUnit<RAJA::expt::cuda_warp_register, double, N_SIZE, M_SIZE, O_SIZE>
+  {
+    using register_type = RAJA::expt::Register<double, RAJA::expt::cuda_warp_register>;
+
+    static constexpr camp::idx_t s_lanes = 32;
+
+    static constexpr bool s_tiles_fit =
+        (N_SIZE % 8 == 0) && (M_SIZE % 4 == 0) && (O_SIZE % 8 == 0);
+
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE>
+    RAJA_HOST_DEVICE
+    static
+    RAJA_INLINE
+    bool multiply_accumulate(A_TYPE const &A, B_TYPE const &B, C_TYPE &C)
+    {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
+      if (s_tiles_fit) {
+
+        const camp::idx_t lane = register_type::get_lane();
+        const camp::idx_t frag_row = lane >> 2; // row of A and C, column of B
+        const camp::idx_t frag_k   = lane & 3;  // column of A, row of B
+
+        RAJA_UNROLL
+        for(camp::idx_t r0 = 0;r0 < N_SIZE;r0 += 8){
+          RAJA_UNROLL
+          for(camp::idx_t c0 = 0;c0 < O_SIZE;c0 += 8){
+
+            double c_frag0 = gather<O_SIZE>(C, r0 + frag_row, c0 + 2*frag_k,     r0, 8, c0, 8);
+            double c_frag1 = gather<O_SIZE>(C, r0 + frag_row, c0 + 2*frag_k + 1, r0, 8, c0, 8);
+
+            RAJA_UNROLL
+            for(camp::idx_t k0 = 0;k0 < M_SIZE;k0 += 4){
+              double a_frag = gather<M_SIZE>(A, r0 + frag_row, k0 + frag_k, r0, 8, k0, 4);
+              double b_frag = gather<O_SIZE>(B, k0 + frag_k, c0 + frag_row, k0, 4, c0, 8);
+
+              asm volatile("mma.sync.aligned.m8n8k4.row.col.f64.f64.f64.f64 "
+                           "{%0, %1}, {%2}, {%3}, {%0, %1};"
+                           : "+d"(c_frag0), "+d"(c_frag1)
+                           : "d"(a_frag), "d"(b_frag));
+            }
+
+            scatter<O_SIZE>(C, c_frag0, c_frag1, r0, c0);
+          }
+        }
+
+        return true;
+      }
+#endif
+      RAJA_UNUSED_VAR(A, B, C);
+      return false;
+    }
+
+  private:
+
+    /*
+     * Get the element at (row, col) of a row-major matrix with COLS columns
+     * in each lane, where the elements requested by the warp are in the
+     * tile of rows [row0, row0+rows) and columns [col0, col0+cols)
+     */
+    template<camp::idx_t COLS, typename MAT>
+    RAJA_DEVICE
+    static
+    RAJA_INLINE
+    double gather(MAT const &mat, camp::idx_t row, camp::idx_t col,
+                  camp::idx_t row0, camp::idx_t rows,
+                  camp::idx_t col0, camp::idx_t cols)
+    {
+      const camp::idx_t elem = row*COLS + col;
+      const camp::idx_t src_reg = elem / s_lanes;
+      const int src_lane = elem % s_lanes;
+
+      const camp::idx_t reg_begin = (row0*COLS + col0) / s_lanes;
+      const camp::idx_t reg_end = ((row0+rows-1)*COLS + col0+cols-1) / s_lanes;
+
+      double value = 0.0;
+      for(camp::idx_t reg = reg_begin;reg <= reg_end;++ reg){
+        double v = __shfl_sync(0xffffffff, mat.get_register(reg).get_raw_value(), src_lane, 32);
+        if(reg == src_reg){
+          value = v;
+        }
+      }
+      return value;
+    }
+
+    /*
+     * Write the 8x8 result fragment (c_frag0, c_frag1) of the tile at
+     * (row0, col0) back into the row-major matrix registers of C
+     */
+    template<camp::idx_t COLS, typename MAT>
+    RAJA_DEVICE
+    static
+    RAJA_INLINE
+    void scatter(MAT &mat, double c_frag0, double c_frag1,
+                 camp::idx_t row0, camp::idx_t col0)
+    {
+      const camp::idx_t lane = register_type::get_lane();
+
+      const camp::idx_t reg_begin = (row0*COLS + col0) / s_lanes;
+      const camp::idx_t reg_end = ((row0+7)*COLS + col0+7) / s_lanes;
+
+      for(camp::idx_t reg = reg_begin;reg <= reg_end;++ reg){
+        const camp::idx_t elem = reg*s_lanes + lane;
+        const camp::idx_t row = elem / COLS - row0;
+        const camp::idx_t col = elem % COLS - col0;
+        const bool in_tile = row >= 0 && row < 8 && col >= 0 && col < 8;
+        const int src_lane = in_tile ? int(row*4 + col/2) : 0;
+
+        double v0 = __shfl_sync(0xffffffff, c_frag0, src_lane, 32);
+        double v1 = __shfl_sync(0xffffffff, c_frag1, src_lane, 32);
+        if(in_tile){
+          mat.get_register(reg).get_raw_value() = (col & 1) ? v1 : v0;
+        }
+      }
+    }
+  };
+
+
+} // namespace expt
+} // namespace internal
+} // namespace RAJA
+
+
+#endif
+
+#endif // RAJA_ENABLE_CUDA
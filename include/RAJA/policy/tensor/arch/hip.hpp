@@ -23,6 +23,7 @@
 
 #include<RAJA/policy/tensor/arch/hip/traits.hpp>
 #include<RAJA/policy/tensor/arch/hip/hip_wave.hpp>
+#include<RAJA/policy/tensor/arch/hip/hip_mfma.hpp>
 
 
 #endif
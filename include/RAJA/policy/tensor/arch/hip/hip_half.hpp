@@ -0,0 +1,113 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the half precision element support of the HIP
+ *          wave register.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+
+#ifdef RAJA_ENABLE_HIP
+
+#ifndef RAJA_policy_tensor_arch_hip_hip_half_HPP
+#define RAJA_policy_tensor_arch_hip_hip_half_HPP
+
+#include <hip/hip_fp16.h>
+
+
+/*
+ * The wave register holds one element per lane, so besides double, float,
+ * int32 and int64 it works with __half elements. The packed __half2
+ * elements hold two values per lane and do two operations per instruction;
+ * they support the arithmetic and sum of the register, but not the
+ * comparisons (min, max).
+ */
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Zero of a wave register element
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_DEVICE
+  T warp_zero(){
+    return T(0);
+  }
+
+  template<>
+  RAJA_INLINE
+  RAJA_DEVICE
+  __half2 warp_zero<__half2>(){
+    return __float2half2_rn(0.0f);
+  }
+
+  /*!
+   * Fused multiply add of wave register elements
+   */
+  template<typename T>
+  RAJA_INLINE
+  RAJA_DEVICE
+  T warp_fma(T a, T b, T c){
+    return fma(a, b, c);
+  }
+
+  RAJA_INLINE
+  RAJA_DEVICE
+  __half warp_fma(__half a, __half b, __half c){
+    return __hfma(a, b, c);
+  }
+
+  RAJA_INLINE
+  RAJA_DEVICE
+  __half2 warp_fma(__half2 a, __half2 b, __half2 c){
+    return __hfma2(a, b, c);
+  }
+
+
+} // namespace expt
+} // namespace internal
+
+
+namespace operators
+{
+
+// largest finite half is 65504
+template <>
+struct limits<__half> {
+  RAJA_INLINE RAJA_HOST_DEVICE static __half min()
+  {
+    return __half(-65504.0f);
+  }
+  RAJA_INLINE RAJA_HOST_DEVICE static __half max()
+  {
+    return __half(65504.0f);
+  }
+};
+
+
+} // namespace operators
+
+} // namespace RAJA
+
+#endif // guard
+
+#endif // RAJA_ENABLE_HIP
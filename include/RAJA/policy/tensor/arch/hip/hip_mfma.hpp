@@ -0,0 +1,177 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the HIP matrix core matrix multiply.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/MatrixMultiplyUnit.hpp"
+
+#ifdef RAJA_ENABLE_HIP
+
+#ifndef RAJA_policy_tensor_arch_hip_hip_mfma_HPP
+#define RAJA_policy_tensor_arch_hip_hip_mfma_HPP
+
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+
+  /**
+   * Double precision matrix core multiply for hip_wave_register matrices.
+   *
+   * Uses mfma_f64_16x16x4f64 (CDNA2 and newer) on each 16x16x4 tile of the
+   * product. The elements each lane needs for a tile fragment are gathered
+   * from the matrix registers with wavefront shuffles, and the result
+   * fragment is scattered back the same way.
+   */
+  template<camp::idx_t N_SIZE, camp::idx_t M_SIZE, camp::idx_t O_SIZE>
+  struct MatrixMultiplyUnit<RAJA::expt::hip_wave_register, double, N_SIZE, M_SIZE, O_SIZE>
+  {
+    using register_type = RAJA::expt::Register<double, RAJA::expt::hip_wave_register>;
+
+    static constexpr camp::idx_t s_lanes = 64;
+
+    static constexpr bool s_tiles_fit =
+        (N_SIZE % 16 == 0) && (M_SIZE % 4 == 0) && (O_SIZE % 16 == 0);
+
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE>
+    RAJA_HOST_DEVICE
+    static
+    RAJA_INLINE
+    bool multiply_accumulate(A_TYPE const &A, B_TYPE const &B, C_TYPE &C)
+    {
+#if defined(__HIP_DEVICE_COMPILE__) && \
+    (defined(__gfx90a__) || defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__))
+      if (s_tiles_fit) {
+
+        using double4_type = double __attribute__((ext_vector_type(4)));
+
+        const camp::idx_t lane = register_type::get_lane();
+        const camp::idx_t frag_i = lane & 15; // row of A, column of B and C
+        const camp::idx_t frag_k = lane >> 4; // column of A, row of B
+
+        RAJA_UNROLL
+        for(camp::idx_t r0 = 0;r0 < N_SIZE;r0 += 16){
+          RAJA_UNROLL
+          for(camp::idx_t c0 = 0;c0 < O_SIZE;c0 += 16){
+
+            double4_type c_frag;
+            c_frag[0] = gather<O_SIZE>(C, r0 + 4*frag_k + 0, c0 + frag_i, r0, 16, c0, 16);
+            c_frag[1] = gather<O_SIZE>(C, r0 + 4*frag_k + 1, c0 + frag_i, r0, 16, c0, 16);
+            c_frag[2] = gather<O_SIZE>(C, r0 + 4*frag_k + 2, c0 + frag_i, r0, 16, c0, 16);
+            c_frag[3] = gather<O_SIZE>(C, r0 + 4*frag_k + 3, c0 + frag_i, r0, 16, c0, 16);
+
+            RAJA_UNROLL
+            for(camp::idx_t k0 = 0;k0 < M_SIZE;k0 += 4){
+              double a_frag = gather<M_SIZE>(A, r0 + frag_i, k0 + frag_k, r0, 16, k0, 4);
+              double b_frag = gather<O_SIZE>(B, k0 + frag_k, c0 + frag_i, k0, 4, c0, 16);
+
+              c_frag = __builtin_amdgcn_mfma_f64_16x16x4f64(a_frag, b_frag, c_frag, 0, 0, 0);
+            }
+
+            scatter<O_SIZE>(C, c_frag[0], c_frag[1], c_frag[2], c_frag[3], r0, c0);
+          }
+        }
+
+        return true;
+      }
+#endif
+      RAJA_UNUSED_VAR(A, B, C);
+      return false;
+    }
+
+  private:
+
+    /*
+     * Get the element at (row, col) of a row-major matrix with COLS columns
+     * in each lane, where the elements requested by the wavefront are in the
+     * tile of rows [row0, row0+rows) and columns [col0, col0+cols)
+     */
+    template<camp::idx_t COLS, typename MAT>
+    RAJA_DEVICE
+    static
+    RAJA_INLINE
+    double gather(MAT const &mat, camp::idx_t row, camp::idx_t col,
+                  camp::idx_t row0, camp::idx_t rows,
+                  camp::idx_t col0, camp::idx_t cols)
+    {
+      const camp::idx_t elem = row*COLS + col;
+      const camp::idx_t src_reg = elem / s_lanes;
+      const int src_lane = elem % s_lanes;
+
+      const camp::idx_t reg_begin = (row0*COLS + col0) / s_lanes;
+      const camp::idx_t reg_end = ((row0+rows-1)*COLS + col0+cols-1) / s_lanes;
+
+      double value = 0.0;
+      for(camp::idx_t reg = reg_begin;reg <= reg_end;++ reg){
+        double v = ::RAJA::hip::impl::shfl_sync(mat.get_register(reg).get_raw_value(), src_lane);
+        if(reg == src_reg){
+          value = v;
+        }
+      }
+      return value;
+    }
+
+    /*
+     * Write the 16x16 result fragment (c_frag0..3) of the tile at
+     * (row0, col0) back into the row-major matrix registers of C
+     */
+    template<camp::idx_t COLS, typename MAT>
+    RAJA_DEVICE
+    static
+    RAJA_INLINE
+    void scatter(MAT &mat, double c_frag0, double c_frag1,
+                 double c_frag2, double c_frag3,
+                 camp::idx_t row0, camp::idx_t col0)
+    {
+      const camp::idx_t lane = register_type::get_lane();
+
+      const camp::idx_t reg_begin = (row0*COLS + col0) / s_lanes;
+      const camp::idx_t reg_end = ((row0+15)*COLS + col0+15) / s_lanes;
+
+      for(camp::idx_t reg = reg_begin;reg <= reg_end;++ reg){
+        const camp::idx_t elem = reg*s_lanes + lane;
+        const camp::idx_t row = elem / COLS - row0;
+        const camp::idx_t col = elem % COLS - col0;
+        const bool in_tile = row >= 0 && row < 16 && col >= 0 && col < 16;
+        const int src_lane = in_tile ? int((row/4)*16 + col) : 0;
+
+        double v0 = ::RAJA::hip::impl::shfl_sync(c_frag0, src_lane);
+        double v1 = ::RAJA::hip::impl::shfl_sync(c_frag1, src_lane);
+        double v2 = ::RAJA::hip::impl::shfl_sync(c_frag2, src_lane);
+        double v3 = ::RAJA::hip::impl::shfl_sync(c_frag3, src_lane);
+        if(in_tile){
+          const camp::idx_t v = row & 3;
+          mat.get_register(reg).get_raw_value() =
+              v == 0 ? v0 : v == 1 ? v1 : v == 2 ? v2 : v3;
+        }
+      }
+    }
+  };
+
+
+} // namespace expt
+} // namespace internal
+} // namespace RAJA
+
+
+#endif
+
+#endif // RAJA_ENABLE_HIP
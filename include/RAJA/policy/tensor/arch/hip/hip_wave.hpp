@@ -25,6 +25,7 @@
 #ifdef RAJA_ENABLE_HIP
 
 #include "RAJA/policy/hip/reduce.hpp"
+#include "RAJA/policy/tensor/arch/hip/hip_half.hpp"
 
 #ifndef RAJA_policy_tensor_arch_hip_hip_wave_register_HPP
 #define RAJA_policy_tensor_arch_hip_hip_wave_register_HPP
@@ -65,7 +66,7 @@ namespace expt
       RAJA_INLINE
       RAJA_DEVICE
       constexpr
-      Register() : base_type(), m_value(0) {
+      Register() : base_type(), m_value(internal::expt::warp_zero<element_type>()) {
 
       }
 
@@ -168,7 +169,7 @@ namespace expt
           m_value = ptr[lane];
         }
         else{
-          m_value = element_type(0);
+          m_value = internal::expt::warp_zero<element_type>();
         }
         return *this;
       }
@@ -203,7 +204,7 @@ namespace expt
           m_value = ptr[stride*lane];
         }
         else{
-          m_value = element_type(0);
+          m_value = internal::expt::warp_zero<element_type>();
         }
         return *this;
       }
@@ -243,7 +244,7 @@ namespace expt
           m_value = ptr[offsets.get_raw_value()];
         }
         else{
-          m_value = element_type(0);
+          m_value = internal::expt::warp_zero<element_type>();
         }
 
         return *this;
@@ -293,7 +294,7 @@ namespace expt
         auto i = lane & ((1<<segbits)-1);
 
         if(seg >= num_outer || i >= num_inner){
-          m_value = element_type(0);
+          m_value = internal::expt::warp_zero<element_type>();
         }
         else{
           m_value = ptr[seg*stride_outer + i*stride_inner];
@@ -538,11 +539,11 @@ namespace expt
       RAJA_DEVICE
       RAJA_INLINE
       self_type divide_n(self_type const &b, int N) const {
-        return get_lane() < N ? self_type(m_value / b.m_value) : self_type(element_type(0));
+        return get_lane() < N ? self_type(m_value / b.m_value) : self_type(internal::expt::warp_zero<element_type>());
       }
 
       /**
-       * floats and doubles use the CUDA instrinsic FMA
+       * floating point types use the CUDA instrinsic FMA (__hfma for half types)
        */
       template<typename RETURN_TYPE = self_type>
       RAJA_DEVICE
@@ -551,7 +552,7 @@ namespace expt
       RETURN_TYPE>::type
       multiply_add(self_type const &b, self_type const &c) const
       {
-        return self_type(fma(m_value, b.m_value, c.m_value));
+        return self_type(internal::expt::warp_fma(m_value, b.m_value, c.m_value));
       }
 
       /**
@@ -568,7 +569,7 @@ namespace expt
       }
 
       /**
-       * floats and doubles use the CUDA instrinsic FMS
+       * floating point types use the CUDA instrinsic FMS (__hfma for half types)
        */
       template<typename RETURN_TYPE = self_type>
       RAJA_DEVICE
@@ -577,7 +578,7 @@ namespace expt
       RETURN_TYPE>::type
       multiply_subtract(self_type const &b, self_type const &c) const
       {
-        return self_type(fma(m_value, b.m_value, -c.m_value));
+        return self_type(internal::expt::warp_fma(m_value, b.m_value, -c.m_value));
       }
 
       /**
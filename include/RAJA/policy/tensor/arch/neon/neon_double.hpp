@@ -0,0 +1,472 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a SIMD register abstraction.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+#ifndef RAJA_policy_vector_register_neon_double_HPP
+#define RAJA_policy_vector_register_neon_double_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+
+// Include SIMD intrinsics header file
+#include <arm_neon.h>
+#include <cmath>
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  template<>
+  class Register<double, neon_register> :
+    public internal::expt::RegisterBase<Register<double, neon_register>>
+  {
+    public:
+      using base_type = internal::expt::RegisterBase<Register<double, neon_register>>;
+
+      using register_policy = neon_register;
+      using self_type = Register<double, neon_register>;
+      using element_type = double;
+      using register_type = float64x2_t;
+
+      using int_vector_type = Register<int64_t, neon_register>;
+
+    private:
+      register_type m_value;
+
+    public:
+
+      static constexpr camp::idx_t s_num_elem = 2;
+
+      /*!
+       * @brief Default constructor, zeros register contents
+       */
+      RAJA_INLINE
+      Register() : m_value(vdupq_n_f64(0.0)) {
+      }
+
+      /*!
+       * @brief Construct register with explicit values
+       */
+      RAJA_INLINE
+      Register(element_type x0,
+                     element_type x1) :
+        m_value(vsetq_lane_f64(x1, vdupq_n_f64(x0), 1))
+      {}
+
+
+      /*!
+       * @brief Copy constructor from underlying simd register
+       */
+      RAJA_INLINE
+      explicit Register(register_type const &c) : m_value(c) {}
+
+
+      /*!
+       * @brief Copy constructor
+       */
+      RAJA_INLINE
+      Register(self_type const &c) : base_type(c), m_value(c.m_value) {}
+
+      /*!
+       * @brief Copy assignment constructor
+       */
+      RAJA_INLINE
+      self_type &operator=(self_type const &c){
+        m_value = c.m_value;
+        return *this;
+      }
+
+      /*!
+       * @brief Construct from scalar.
+       * Sets all elements to same value (broadcast).
+       */
+      RAJA_INLINE
+      Register(element_type const &c) : m_value(vdupq_n_f64(c)) {}
+
+
+      /*!
+       * @brief Returns underlying SIMD register.
+       */
+      RAJA_INLINE
+      constexpr
+      register_type get_register() const {
+        return m_value;
+      }
+
+
+
+      /*!
+       * @brief Load a full register from a stride-one memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_packed ++;
+#endif
+        m_value = vld1q_f64(ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_packed_n ++;
+#endif
+        // NEON has no masked loads, so only touch the first N elements
+        m_value = N >= 2 ? vld1q_f64(ptr) :
+                  N == 1 ? vld1q_lane_f64(ptr, vdupq_n_f64(0.0), 0) :
+                           vdupq_n_f64(0.0);
+        return *this;
+      }
+
+      /*!
+       * @brief Gather a full register from a strided memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided(element_type const *ptr, camp::idx_t stride){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided ++;
+#endif
+        m_value = vld1q_lane_f64(ptr+stride, vld1q_dup_f64(ptr), 1);
+        return *this;
+      }
+
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        m_value = vdupq_n_f64(0.0);
+        if(N >= 1){
+          m_value = vld1q_lane_f64(ptr, m_value, 0);
+        }
+        if(N >= 2){
+          m_value = vld1q_lane_f64(ptr+stride, m_value, 1);
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type offsets){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        m_value = vld1q_lane_f64(ptr+offsets.get(1),
+                                 vld1q_dup_f64(ptr+offsets.get(0)), 1);
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        m_value = vdupq_n_f64(0.0);
+        if(N >= 1){
+          m_value = vld1q_lane_f64(ptr+offsets.get(0), m_value, 0);
+        }
+        if(N >= 2){
+          m_value = vld1q_lane_f64(ptr+offsets.get(1), m_value, 1);
+        }
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_packed ++;
+#endif
+        vst1q_f64(ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_packed_n ++;
+#endif
+        if(N >= 2){
+          vst1q_f64(ptr, m_value);
+        }
+        else if(N == 1){
+          vst1q_lane_f64(ptr, m_value, 0);
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided ++;
+#endif
+        vst1q_lane_f64(ptr, m_value, 0);
+        vst1q_lane_f64(ptr+stride, m_value, 1);
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store partial register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided_n ++;
+#endif
+        if(N >= 1){
+          vst1q_lane_f64(ptr, m_value, 0);
+        }
+        if(N >= 2){
+          vst1q_lane_f64(ptr+stride, m_value, 1);
+        }
+        return *this;
+      }
+
+
+
+      /*!
+       * @brief Get scalar value from vector register
+       * @param i Offset of scalar to get
+       * @return Returns scalar value at i
+       */
+      RAJA_INLINE
+      element_type get(camp::idx_t i) const
+      {return m_value[i];}
+
+
+      /*!
+       * @brief Set scalar value in vector register
+       * @param i Offset of scalar to set
+       * @param value Value of scalar to set
+       */
+      RAJA_INLINE
+      self_type &set(element_type value, camp::idx_t i)
+      {
+        m_value[i] = value;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &broadcast(element_type const &value){
+        m_value = vdupq_n_f64(value);
+        return *this;
+      }
+
+      /*!
+       * @brief Extracts a scalar value and broadcasts to a new register
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type get_and_broadcast(int i) const {
+        switch(i){
+          case 0: return self_type(vdupq_laneq_f64(m_value, 0));
+          case 1: return self_type(vdupq_laneq_f64(m_value, 1));
+        }
+        return *this;
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &copy(self_type const &src){
+        m_value = src.m_value;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type add(self_type const &b) const {
+        return self_type(vaddq_f64(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type subtract(self_type const &b) const {
+        return self_type(vsubq_f64(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply(self_type const &b) const {
+        return self_type(vmulq_f64(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide(self_type const &b) const {
+        return self_type(vdivq_f64(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide_n(self_type const &b, camp::idx_t N) const {
+        // NEON does not supply a masked divide, so do it manually
+        return self_type(
+            N >= 1 ? get(0)/b.get(0) : 0,
+            N >= 2 ? get(1)/b.get(1) : 0);
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type multiply_add(self_type const &b, self_type const &c) const
+      {
+        return self_type(vfmaq_f64(c.m_value, m_value, b.m_value));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type multiply_subtract(self_type const &b, self_type const &c) const
+      {
+        return self_type(vfmaq_f64(vnegq_f64(c.m_value), m_value, b.m_value));
+      }
+
+      /*!
+       * @brief Sum the elements of this vector
+       * @return Sum of the values of the vectors scalar elements
+       */
+      RAJA_INLINE
+      element_type sum(camp::idx_t N = 2) const
+      {
+        if(N >= 2){
+          return vaddvq_f64(m_value);
+        }
+        return N == 1 ? m_value[0] : 0;
+      }
+
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max(camp::idx_t N = 2) const
+      {
+        if(N >= 2){
+          return vmaxvq_f64(m_value);
+        }
+        else if(N == 1){
+          return m_value[0];
+        }
+        return RAJA::operators::limits<double>::min();
+      }
+
+      /*!
+       * @brief Returns element-wise largest values
+       * @return Vector of the element-wise max values
+       */
+      RAJA_INLINE
+      self_type vmax(self_type a) const
+      {
+        return self_type(vmaxq_f64(m_value, a.m_value));
+      }
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min(camp::idx_t N = 2) const
+      {
+        if(N >= 2){
+          return vminvq_f64(m_value);
+        }
+        else if(N == 1){
+          return m_value[0];
+        }
+        return RAJA::operators::limits<double>::max();
+      }
+
+      /*!
+       * @brief Returns the largest element from first N lanes
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min_n(camp::idx_t N) const
+      {
+        return min(N);
+      }
+
+      /*!
+       * @brief Returns element-wise largest values
+       * @return Vector of the element-wise max values
+       */
+      RAJA_INLINE
+      self_type vmin(self_type a) const
+      {
+        return self_type(vminq_f64(m_value, a.m_value));
+      }
+  };
+
+
+}   // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
+
+#endif // __ARM_NEON
@@ -0,0 +1,498 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a SIMD register abstraction.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+#ifndef RAJA_policy_vector_register_neon_float_HPP
+#define RAJA_policy_vector_register_neon_float_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+
+// Include SIMD intrinsics header file
+#include <arm_neon.h>
+#include <cmath>
+
+
+namespace RAJA
+{
+namespace expt
+{
+
+  template<>
+  class Register<float, neon_register> :
+    public internal::expt::RegisterBase<Register<float, neon_register>>
+  {
+    public:
+      using base_type = internal::expt::RegisterBase<Register<float, neon_register>>;
+
+      using register_policy = neon_register;
+      using self_type = Register<float, neon_register>;
+      using element_type = float;
+      using register_type = float32x4_t;
+
+      using int_vector_type = Register<int32_t, neon_register>;
+
+    private:
+      register_type m_value;
+
+    public:
+
+      static constexpr camp::idx_t s_num_elem = 4;
+
+      /*!
+       * @brief Default constructor, zeros register contents
+       */
+      RAJA_INLINE
+      Register() : m_value(vdupq_n_f32(0.0f)) {
+      }
+
+      /*!
+       * @brief Construct register with explicit values
+       */
+      RAJA_INLINE
+      Register(element_type x0,
+                     element_type x1,
+                     element_type x2,
+                     element_type x3) :
+        m_value(vsetq_lane_f32(x3, vsetq_lane_f32(x2,
+                   vsetq_lane_f32(x1, vdupq_n_f32(x0), 1), 2), 3))
+      {}
+
+
+      /*!
+       * @brief Copy constructor from underlying simd register
+       */
+      RAJA_INLINE
+      explicit Register(register_type const &c) : m_value(c) {}
+
+
+      /*!
+       * @brief Copy constructor
+       */
+      RAJA_INLINE
+      Register(self_type const &c) : base_type(c), m_value(c.m_value) {}
+
+      /*!
+       * @brief Copy assignment constructor
+       */
+      RAJA_INLINE
+      self_type &operator=(self_type const &c){
+        m_value = c.m_value;
+        return *this;
+      }
+
+      /*!
+       * @brief Construct from scalar.
+       * Sets all elements to same value (broadcast).
+       */
+      RAJA_INLINE
+      Register(element_type const &c) : m_value(vdupq_n_f32(c)) {}
+
+
+      /*!
+       * @brief Returns underlying SIMD register.
+       */
+      RAJA_INLINE
+      constexpr
+      register_type get_register() const {
+        return m_value;
+      }
+
+
+
+      /*!
+       * @brief Load a full register from a stride-one memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed(element_type const *ptr){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_packed ++;
+#endif
+        m_value = vld1q_f32(ptr);
+        return *this;
+      }
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_packed_n ++;
+#endif
+        if(N >= 4){
+          m_value = vld1q_f32(ptr);
+        }
+        else{
+          // NEON has no masked loads, so only touch the first N elements
+          m_value = vdupq_n_f32(0.0f);
+          for(camp::idx_t i = 0;i < N;++ i){
+            m_value[i] = ptr[i];
+          }
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Gather a full register from a strided memory location
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided(element_type const *ptr, camp::idx_t stride){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided ++;
+#endif
+        for(camp::idx_t i = 0;i < 4;++ i){
+          m_value[i] = ptr[i*stride];
+        }
+        return *this;
+      }
+
+
+      /*!
+       * @brief Partially load a register from a stride-one memory location given
+       *        a run-time number of elements.
+       *
+       */
+      RAJA_INLINE
+      self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        m_value = vdupq_n_f32(0.0f);
+        for(camp::idx_t i = 0;i < N;++ i){
+          m_value[i] = ptr[i*stride];
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for full vector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather(element_type const *ptr, int_vector_type offsets){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        for(camp::idx_t i = 0;i < 4;++ i){
+          m_value[i] = ptr[offsets.get(i)];
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Generic gather operation for n-length subvector.
+       *
+       * Must provide another register containing offsets of all values
+       * to be loaded relative to supplied pointer.
+       *
+       * Offsets are element-wise, not byte-wise.
+       *
+       */
+      RAJA_INLINE
+      self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_load_strided_n ++;
+#endif
+        m_value = vdupq_n_f32(0.0f);
+        for(camp::idx_t i = 0;i < N;++ i){
+          m_value[i] = ptr[offsets.get(i)];
+        }
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed(element_type *ptr) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_packed ++;
+#endif
+        vst1q_f32(ptr, m_value);
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_packed_n ++;
+#endif
+        if(N >= 4){
+          vst1q_f32(ptr, m_value);
+        }
+        else{
+          for(camp::idx_t i = 0;i < N;++ i){
+            ptr[i] = m_value[i];
+          }
+        }
+        return *this;
+      }
+
+      /*!
+       * @brief Store entire register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided ++;
+#endif
+        for(camp::idx_t i = 0;i < 4;++ i){
+          ptr[i*stride] = m_value[i];
+        }
+        return *this;
+      }
+
+
+      /*!
+       * @brief Store partial register to consecutive memory locations
+       *
+       */
+      RAJA_INLINE
+      self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
+#ifdef RAJA_ENABLE_VECTOR_STATS
+          RAJA::tensor_stats::num_vector_store_strided_n ++;
+#endif
+        for(camp::idx_t i = 0;i < N;++ i){
+          ptr[i*stride] = m_value[i];
+        }
+        return *this;
+      }
+
+
+
+      /*!
+       * @brief Get scalar value from vector register
+       * @param i Offset of scalar to get
+       * @return Returns scalar value at i
+       */
+      RAJA_INLINE
+      element_type get(camp::idx_t i) const
+      {return m_value[i];}
+
+
+      /*!
+       * @brief Set scalar value in vector register
+       * @param i Offset of scalar to set
+       * @param value Value of scalar to set
+       */
+      RAJA_INLINE
+      self_type &set(element_type value, camp::idx_t i)
+      {
+        m_value[i] = value;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &broadcast(element_type const &value){
+        m_value = vdupq_n_f32(value);
+        return *this;
+      }
+
+      /*!
+       * @brief Extracts a scalar value and broadcasts to a new register
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type get_and_broadcast(int i) const {
+        switch(i){
+          case 0: return self_type(vdupq_laneq_f32(m_value, 0));
+          case 1: return self_type(vdupq_laneq_f32(m_value, 1));
+          case 2: return self_type(vdupq_laneq_f32(m_value, 2));
+          case 3: return self_type(vdupq_laneq_f32(m_value, 3));
+        }
+        return *this;
+      }
+
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type &copy(self_type const &src){
+        m_value = src.m_value;
+        return *this;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type add(self_type const &b) const {
+        return self_type(vaddq_f32(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type subtract(self_type const &b) const {
+        return self_type(vsubq_f32(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type multiply(self_type const &b) const {
+        return self_type(vmulq_f32(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide(self_type const &b) const {
+        return self_type(vdivq_f32(m_value, b.m_value));
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      self_type divide_n(self_type const &b, camp::idx_t N) const {
+        // NEON does not supply a masked divide, so do it manually
+        self_type q;
+        for(camp::idx_t i = 0;i < N;++ i){
+          q.set(get(i)/b.get(i), i);
+        }
+        return q;
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type multiply_add(self_type const &b, self_type const &c) const
+      {
+        return self_type(vfmaq_f32(c.m_value, m_value, b.m_value));
+      }
+
+      RAJA_INLINE
+      RAJA_HOST_DEVICE
+      self_type multiply_subtract(self_type const &b, self_type const &c) const
+      {
+        return self_type(vfmaq_f32(vnegq_f32(c.m_value), m_value, b.m_value));
+      }
+
+      /*!
+       * @brief Sum the elements of this vector
+       * @return Sum of the values of the vectors scalar elements
+       */
+      RAJA_INLINE
+      element_type sum(camp::idx_t N = 4) const
+      {
+        if(N >= 4){
+          return vaddvq_f32(m_value);
+        }
+        element_type red = 0;
+        for(camp::idx_t i = 0;i < N;++ i){
+          red += m_value[i];
+        }
+        return red;
+      }
+
+
+      /*!
+       * @brief Returns the largest element
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max(camp::idx_t N = 4) const
+      {
+        if(N >= 4){
+          return vmaxvq_f32(m_value);
+        }
+        element_type red = RAJA::operators::limits<float>::min();
+        for(camp::idx_t i = 0;i < N;++ i){
+          red = RAJA::max<element_type>(red, m_value[i]);
+        }
+        return red;
+      }
+
+      /*!
+       * @brief Returns the largest element from first N lanes
+       * @return The largest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type max_n(camp::idx_t N) const
+      {
+        return max(N);
+      }
+
+      /*!
+       * @brief Returns element-wise largest values
+       * @return Vector of the element-wise max values
+       */
+      RAJA_INLINE
+      self_type vmax(self_type a) const
+      {
+        return self_type(vmaxq_f32(m_value, a.m_value));
+      }
+
+      /*!
+       * @brief Returns the smallest element
+       * @return The smallest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min(camp::idx_t N = 4) const
+      {
+        if(N >= 4){
+          return vminvq_f32(m_value);
+        }
+        element_type red = RAJA::operators::limits<float>::max();
+        for(camp::idx_t i = 0;i < N;++ i){
+          red = RAJA::min<element_type>(red, m_value[i]);
+        }
+        return red;
+      }
+
+      /*!
+       * @brief Returns the smallest element from first N lanes
+       * @return The smallest scalar element in the register
+       */
+      RAJA_INLINE
+      element_type min_n(camp::idx_t N) const
+      {
+        return min(N);
+      }
+
+      /*!
+       * @brief Returns element-wise smallest values
+       * @return Vector of the element-wise min values
+       */
+      RAJA_INLINE
+      self_type vmin(self_type a) const
+      {
+        return self_type(vminq_f32(m_value, a.m_value));
+      }
+  };
+
+
+}   // namespace expt
+
+}  // namespace RAJA
+
+
+#endif
+
+#endif // __ARM_NEON
@@ -0,0 +1,27 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing SIMD abstractions for SVE
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+
+#include<RAJA/policy/tensor/arch/sve/traits.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_int32.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_int64.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_float.hpp>
+#include<RAJA/policy/tensor/arch/sve/sve_double.hpp>
+
+
+#endif // __ARM_FEATURE_SVE
@@ -0,0 +1,75 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing SIMD abstractions for SVE
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+
+#ifndef RAJA_policy_tensor_arch_sve_traits_HPP
+#define RAJA_policy_tensor_arch_sve_traits_HPP
+
+
+namespace RAJA {
+namespace internal {
+namespace expt {
+
+
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, int32_t>{
+      using element_type = int32_t;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS/32;
+      using int_element_type = int32_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, int64_t>{
+      using element_type = int64_t;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS/64;
+      using int_element_type = int64_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, float>{
+      using element_type = float;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS/32;
+      using int_element_type = int32_t;
+  };
+
+  template<>
+  struct RegisterTraits<RAJA::expt::sve_register, double>{
+      using element_type = double;
+      using register_policy = RAJA::expt::sve_register;
+      static constexpr camp::idx_t s_num_bits = __ARM_FEATURE_SVE_BITS;
+      static constexpr camp::idx_t s_num_elem = __ARM_FEATURE_SVE_BITS/64;
+      using int_element_type = int64_t;
+  };
+
+} // namespace intenral
+} // namespace expt
+} // namespace RAJA
+
+
+#endif // guard
+
+
+
+#endif // __ARM_FEATURE_SVE
@@ -45,6 +45,14 @@
 #include<RAJA/policy/tensor/arch/avx.hpp>
 #endif
 
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+#include<RAJA/policy/tensor/arch/sve.hpp>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include<RAJA/policy/tensor/arch/neon.hpp>
+#endif
+
 #ifdef RAJA_CUDA_ACTIVE
 #include<RAJA/policy/tensor/arch/cuda.hpp>
 #endif
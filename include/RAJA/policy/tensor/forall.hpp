@@ -0,0 +1,133 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for explicit vector register execution.
+ *
+ *          These methods should work on any platform that supports the
+ *          tensor register types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_tensor_HPP
+#define RAJA_forall_tensor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/tensor/TensorIndex.hpp"
+
+#include "RAJA/policy/tensor/policy.hpp"
+
+#include "RAJA/pattern/params/forall.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace tensor
+{
+
+namespace detail
+{
+
+/*!
+ * Runs a loop body over an iterable with one VectorIndex per iteration,
+ * for iterables whose indices are not known to be contiguous.
+ */
+template <typename TENSOR_TYPE, typename Iterable>
+struct ExplicitSimdIterate {
+
+  template <typename Func>
+  static RAJA_INLINE void exec(Iterable const &iter, Func &&body)
+  {
+    using index_type = camp::decay<decltype(*std::begin(iter))>;
+    using vector_index_type = RAJA::expt::VectorIndex<index_type, TENSOR_TYPE>;
+
+    RAJA_EXTRACT_BED_IT(iter);
+
+    RAJA_NO_SIMD
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      body(vector_index_type(*(begin_it + i), 1));
+    }
+  }
+};
+
+/*!
+ * Range segments are contiguous, so each VectorIndex covers a full
+ * register, and the last one covers the remaining iterations.
+ */
+template <typename TENSOR_TYPE, typename StorageT, typename DiffT>
+struct ExplicitSimdIterate<TENSOR_TYPE, TypedRangeSegment<StorageT, DiffT>> {
+
+  template <typename Func>
+  static RAJA_INLINE void exec(TypedRangeSegment<StorageT, DiffT> const &iter,
+                               Func &&body)
+  {
+    using vector_index_type = RAJA::expt::VectorIndex<StorageT, TENSOR_TYPE>;
+    using value_type = typename vector_index_type::value_type;
+
+    static constexpr value_type s_num_elem = TENSOR_TYPE::s_num_elem;
+
+    RAJA_EXTRACT_BED_IT(iter);
+
+    RAJA_NO_SIMD
+    for (decltype(distance_it) i = 0; i < distance_it; i += s_num_elem) {
+      value_type len = RAJA::min<value_type>(s_num_elem, distance_it - i);
+      body(vector_index_type(*(begin_it + i), len));
+    }
+  }
+};
+
+}  // namespace detail
+
+
+template <typename Iterable, typename Func, typename Resource,
+          typename TENSOR_TYPE, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>
+  >
+forall_impl(Resource res,
+            const explicit_simd_exec<TENSOR_TYPE> &,
+            Iterable &&iter,
+            Func &&body,
+            ForallParam)
+{
+  static_assert(expt::type_traits::is_ForallParamPack_empty<ForallParam>::value,
+                "explicit_simd_exec does not support forall parameters");
+
+  detail::ExplicitSimdIterate<TENSOR_TYPE, camp::decay<Iterable>>::exec(
+      iter, std::forward<Func>(body));
+
+  return resources::EventProxy<Resource>(res);
+}
+
+}  // namespace tensor
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
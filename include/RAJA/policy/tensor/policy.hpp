@@ -21,6 +21,8 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/config.hpp"
 
+#include "RAJA/pattern/tensor.hpp"
+
 
 //
 //////////////////////////////////////////////////////////////////////
@@ -50,6 +52,30 @@ struct tensor_exec : public EXEC_POLICY {
 };
 
 
+/*!
+ * forall policy that passes the loop body a VectorIndex covering up to
+ * TENSOR_TYPE::s_num_elem iterations, instead of a scalar index.
+ */
+template<typename TENSOR_TYPE>
+struct explicit_simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                                  Pattern::forall,
+                                                                  Launch::undefined,
+                                                                  Platform::host> {
+  using tensor_type = TENSOR_TYPE;
+};
+
+
+/*!
+ * Reduction policy that accumulates vector contributions in a register of
+ * REGISTER_POLICY, and combines the lanes into REDUCE_POLICY's reducer.
+ */
+template<typename REGISTER_POLICY, typename REDUCE_POLICY>
+struct simd_reduce : public REDUCE_POLICY {
+  using register_policy = REGISTER_POLICY;
+  using reduce_policy = REDUCE_POLICY;
+};
+
+
 
 }  // end of namespace tensor
 
@@ -67,6 +93,38 @@ using matrix_row_exec = policy::tensor::tensor_exec<seq_exec, TENSOR_TYPE, 0, TI
 template<typename TENSOR_TYPE, camp::idx_t TILE_SIZE = -1>
 using matrix_col_exec = policy::tensor::tensor_exec<seq_exec, TENSOR_TYPE, 1, TILE_SIZE>;
 
+/*!
+ * forall policy that runs the loop body on vector registers of
+ * REGISTER_POLICY holding ELEMENT_TYPE values.
+ *
+ * The body is called with a VectorIndex, so Views indexed with it load,
+ * compute and store whole registers, and the final partial register is
+ * handled with masked loads and stores:
+ *
+ *   RAJA::forall<RAJA::expt::explicit_simd_exec<RAJA::expt::avx2_register>>(
+ *     RAJA::TypedRangeSegment<int>(0, N),
+ *     [=](RAJA::expt::VectorIndex<int, RAJA::expt::VectorRegister<double, RAJA::expt::avx2_register>> i){
+ *       z(i) = a*x(i) + y(i);
+ *     });
+ *
+ * Segments other than range segments are run one iteration per index.
+ */
+template<typename REGISTER_POLICY = default_register, typename ELEMENT_TYPE = double>
+using explicit_simd_exec = policy::tensor::explicit_simd_exec<VectorRegister<ELEMENT_TYPE, REGISTER_POLICY>>;
+
+/*!
+ * Reduction policy for sums, mins and maxes of vector registers.
+ *
+ * Reducers with this policy keep a VectorRegister of REGISTER_POLICY as a
+ * per-lane accumulator, so vector contributions carry no loop dependence
+ * through a scalar.  The lanes are combined with sum(), min() or max()
+ * once, when the reducer copy is destroyed or its value is read, and the
+ * result is combined with REDUCE_POLICY, for example omp_reduce when the
+ * loop is also run in parallel.
+ */
+template<typename REGISTER_POLICY = default_register, typename REDUCE_POLICY = seq_reduce>
+using simd_reduce = policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>;
+
 
 } //  namespace expt
 
@@ -0,0 +1,434 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates that accumulate
+ *          vector register contributions.
+ *
+ *          These methods should work on any platform that supports the
+ *          tensor register types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_tensor_reduce_HPP
+#define RAJA_tensor_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+#include "RAJA/pattern/tensor/VectorRegister.hpp"
+
+#include "RAJA/policy/tensor/policy.hpp"
+
+#include "RAJA/util/CompensatedSum.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! lane-wise and horizontal operations for ReduceSum
+struct ReduceSimdSumOp {
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE VECTOR_TYPE combine(VECTOR_TYPE const &a,
+                                         VECTOR_TYPE const &b)
+  {
+    return a.add(b);
+  }
+
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE typename VECTOR_TYPE::element_type reduce(
+      VECTOR_TYPE const &a)
+  {
+    return a.sum();
+  }
+};
+
+//! lane-wise and horizontal operations for ReduceMin
+struct ReduceSimdMinOp {
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE VECTOR_TYPE combine(VECTOR_TYPE const &a,
+                                         VECTOR_TYPE const &b)
+  {
+    return a.vmin(b);
+  }
+
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE typename VECTOR_TYPE::element_type reduce(
+      VECTOR_TYPE const &a)
+  {
+    return a.min();
+  }
+};
+
+//! lane-wise and horizontal operations for ReduceMax
+struct ReduceSimdMaxOp {
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE VECTOR_TYPE combine(VECTOR_TYPE const &a,
+                                         VECTOR_TYPE const &b)
+  {
+    return a.vmax(b);
+  }
+
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE typename VECTOR_TYPE::element_type reduce(
+      VECTOR_TYPE const &a)
+  {
+    return a.max();
+  }
+};
+
+/*!
+ * Pair of vector registers holding a lane-wise compensated sum, the running
+ * sums and their accumulated rounding errors.
+ */
+template <typename VECTOR_TYPE>
+struct CompensatedVector {
+  using element_type = typename VECTOR_TYPE::element_type;
+
+  VECTOR_TYPE sum;
+  VECTOR_TYPE comp;
+
+  RAJA_INLINE
+  CompensatedVector(VECTOR_TYPE const &sum_, VECTOR_TYPE const &comp_)
+      : sum(sum_), comp(comp_)
+  {
+  }
+
+  //! broadcast a scalar accumulator to every lane
+  RAJA_INLINE
+  explicit CompensatedVector(NeumaierSum<element_type> const &val)
+      : sum(val.sum()), comp(val.compensation())
+  {
+  }
+};
+
+//! lane-wise TwoSum and horizontal operations for compensated ReduceSum
+struct ReduceSimdCompensatedSumOp {
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE CompensatedVector<VECTOR_TYPE> combine(
+      CompensatedVector<VECTOR_TYPE> const &a,
+      VECTOR_TYPE const &b)
+  {
+    VECTOR_TYPE s = a.sum.add(b);
+    VECTOR_TYPE bp = s.subtract(a.sum);
+    VECTOR_TYPE err = a.sum.subtract(s.subtract(bp)).add(b.subtract(bp));
+    return CompensatedVector<VECTOR_TYPE>(s, a.comp.add(err));
+  }
+
+  template <typename VECTOR_TYPE>
+  static RAJA_INLINE NeumaierSum<typename VECTOR_TYPE::element_type> reduce(
+      CompensatedVector<VECTOR_TYPE> const &a)
+  {
+    using element_type = typename VECTOR_TYPE::element_type;
+    NeumaierSum<element_type> val;
+    for (camp::idx_t i = 0; i < VECTOR_TYPE::s_num_elem; ++i) {
+      val += NeumaierSum<element_type>(a.sum.get(i), a.comp.get(i));
+    }
+    return val;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Adds a vector register accumulator to the reducer BASE.
+ *
+ * Vector contributions are combined lane-wise into the accumulator.  The
+ * lanes are reduced to a scalar and combined into BASE when this object
+ * is destroyed, so a copy captured by a loop body pushes its lanes into
+ * its parent's value through BASE's own mechanism (under a critical
+ * section for omp_reduce, for example), or when the value is read.
+ *
+ **************************************************************************
+ */
+template <typename BASE, typename VECTOR_TYPE, typename OP>
+class ReduceSimd : public BASE
+{
+public:
+  using vector_type = VECTOR_TYPE;
+  using value_type = typename BASE::value_type;
+  using reduce_type = typename BASE::reduce_type;
+
+  RAJA_INLINE
+  ReduceSimd() : BASE(), m_acc(reduce_type::identity()) {}
+
+  RAJA_INLINE
+  ReduceSimd(value_type init_val,
+             value_type identity_ = reduce_type::identity())
+      : BASE(init_val, identity_), m_acc(identity_), m_identity(identity_)
+  {
+  }
+
+  //! copies start from an empty accumulator, like BASE's own copies
+  RAJA_INLINE
+  ReduceSimd(ReduceSimd const &copy)
+      : BASE(copy), m_acc(copy.m_identity), m_identity(copy.m_identity)
+  {
+  }
+
+  //! prohibit compiler-generated copy assignment
+  ReduceSimd &operator=(const ReduceSimd &) = delete;
+
+  RAJA_INLINE
+  ~ReduceSimd() { flush(); }
+
+  RAJA_INLINE
+  void reset(value_type val, value_type identity_ = reduce_type::identity())
+  {
+    flush();
+    BASE::reset(val, identity_);
+    m_identity = identity_;
+    m_acc = vector_type(identity_);
+  }
+
+  //! Get the calculated reduced value
+  RAJA_INLINE
+  operator value_type() const { return get(); }
+
+  //! Get the calculated reduced value
+  RAJA_INLINE
+  value_type get() const
+  {
+    flush();
+    return BASE::get();
+  }
+
+protected:
+  template <typename RHS>
+  RAJA_INLINE void combine_vector(RHS const &rhs) const
+  {
+    m_acc = OP::combine(m_acc, rhs);
+  }
+
+  //! reduce the accumulator lanes into BASE and empty the accumulator
+  RAJA_INLINE
+  void flush() const
+  {
+    value_type lanes = OP::reduce(m_acc);
+    if (lanes != m_identity) {
+      BASE::combine(lanes);
+      m_acc = vector_type(m_identity);
+    }
+  }
+
+private:
+  vector_type mutable m_acc;
+  value_type m_identity = reduce_type::identity();
+};
+
+}  // namespace detail
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Vector register reducers.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Sum reducer that also accepts VectorRegister contributions.
+ *
+ * Unused lanes of a partial vector must hold zero, which is what the
+ * load_packed_n and load_strided_n register loads provide.
+ */
+template <typename REGISTER_POLICY, typename REDUCE_POLICY, typename T>
+class ReduceSum<policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>, T>
+    : public detail::ReduceSimd<ReduceSum<REDUCE_POLICY, T>,
+                                expt::VectorRegister<T, REGISTER_POLICY>,
+                                detail::ReduceSimdSumOp>
+{
+public:
+  using Base = detail::ReduceSimd<ReduceSum<REDUCE_POLICY, T>,
+                                  expt::VectorRegister<T, REGISTER_POLICY>,
+                                  detail::ReduceSimdSumOp>;
+  using vector_type = typename Base::vector_type;
+  using Base::Base;
+  using Base::operator+=;
+
+  //! reducer function; adds each lane of rhs
+  RAJA_INLINE
+  const ReduceSum &operator+=(vector_type const &rhs) const
+  {
+    this->combine_vector(rhs);
+    return *this;
+  }
+};
+
+/*!
+ * Compensated sum reducer that also accepts VectorRegister contributions.
+ *
+ * Each lane keeps its own running sum and rounding error, updated with a
+ * lane-wise TwoSum. The lanes are combined as NeumaierSum values into the
+ * REDUCE_POLICY reducer. Unused lanes of a partial vector must hold zero.
+ */
+template <typename REGISTER_POLICY, typename REDUCE_POLICY, typename T>
+class ReduceSum<policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>,
+                NeumaierSum<T>>
+    : public detail::ReduceSimd<
+          ReduceSum<REDUCE_POLICY, NeumaierSum<T>>,
+          detail::CompensatedVector<expt::VectorRegister<T, REGISTER_POLICY>>,
+          detail::ReduceSimdCompensatedSumOp>
+{
+public:
+  using Base = detail::ReduceSimd<
+      ReduceSum<REDUCE_POLICY, NeumaierSum<T>>,
+      detail::CompensatedVector<expt::VectorRegister<T, REGISTER_POLICY>>,
+      detail::ReduceSimdCompensatedSumOp>;
+  using vector_type = expt::VectorRegister<T, REGISTER_POLICY>;
+  using Base::Base;
+  using Base::operator+=;
+
+  //! reducer function; adds each lane of rhs
+  RAJA_INLINE
+  const ReduceSum &operator+=(vector_type const &rhs) const
+  {
+    this->combine_vector(rhs);
+    return *this;
+  }
+};
+
+/*!
+ * Min reducer that also accepts VectorRegister contributions.
+ */
+template <typename REGISTER_POLICY, typename REDUCE_POLICY, typename T>
+class ReduceMin<policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>, T>
+    : public detail::ReduceSimd<ReduceMin<REDUCE_POLICY, T>,
+                                expt::VectorRegister<T, REGISTER_POLICY>,
+                                detail::ReduceSimdMinOp>
+{
+public:
+  using Base = detail::ReduceSimd<ReduceMin<REDUCE_POLICY, T>,
+                                  expt::VectorRegister<T, REGISTER_POLICY>,
+                                  detail::ReduceSimdMinOp>;
+  using vector_type = typename Base::vector_type;
+  using Base::Base;
+  using Base::min;
+
+  //! reducer function; takes the min of each lane of rhs
+  RAJA_INLINE
+  const ReduceMin &min(vector_type const &rhs) const
+  {
+    this->combine_vector(rhs);
+    return *this;
+  }
+
+  //! reducer function; takes the min of the first num_lanes lanes of rhs
+  RAJA_INLINE
+  const ReduceMin &min(vector_type const &rhs, camp::idx_t num_lanes) const
+  {
+    if (num_lanes >= vector_type::s_num_elem) {
+      this->combine_vector(rhs);
+    } else if (num_lanes > 0) {
+      this->combine(rhs.min_n(num_lanes));
+    }
+    return *this;
+  }
+};
+
+/*!
+ * Max reducer that also accepts VectorRegister contributions.
+ */
+template <typename REGISTER_POLICY, typename REDUCE_POLICY, typename T>
+class ReduceMax<policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>, T>
+    : public detail::ReduceSimd<ReduceMax<REDUCE_POLICY, T>,
+                                expt::VectorRegister<T, REGISTER_POLICY>,
+                                detail::ReduceSimdMaxOp>
+{
+public:
+  using Base = detail::ReduceSimd<ReduceMax<REDUCE_POLICY, T>,
+                                  expt::VectorRegister<T, REGISTER_POLICY>,
+                                  detail::ReduceSimdMaxOp>;
+  using vector_type = typename Base::vector_type;
+  using Base::Base;
+  using Base::max;
+
+  //! reducer function; takes the max of each lane of rhs
+  RAJA_INLINE
+  const ReduceMax &max(vector_type const &rhs) const
+  {
+    this->combine_vector(rhs);
+    return *this;
+  }
+
+  //! reducer function; takes the max of the first num_lanes lanes of rhs
+  RAJA_INLINE
+  const ReduceMax &max(vector_type const &rhs, camp::idx_t num_lanes) const
+  {
+    if (num_lanes >= vector_type::s_num_elem) {
+      this->combine_vector(rhs);
+    } else if (num_lanes > 0) {
+      this->combine(rhs.max_n(num_lanes));
+    }
+    return *this;
+  }
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reducers without a vector form use the underlying policy's reducers.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename REGISTER_POLICY, typename REDUCE_POLICY, typename T>
+class ReduceBitOr<policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>,
+                  T> : public ReduceBitOr<REDUCE_POLICY, T>
+{
+public:
+  using Base = ReduceBitOr<REDUCE_POLICY, T>;
+  using Base::Base;
+};
+
+template <typename REGISTER_POLICY, typename REDUCE_POLICY, typename T>
+class ReduceBitAnd<policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>,
+                   T> : public ReduceBitAnd<REDUCE_POLICY, T>
+{
+public:
+  using Base = ReduceBitAnd<REDUCE_POLICY, T>;
+  using Base::Base;
+};
+
+template <typename REGISTER_POLICY,
+          typename REDUCE_POLICY,
+          typename T,
+          typename IndexType>
+class ReduceMinLoc<
+    policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>,
+    T,
+    IndexType> : public ReduceMinLoc<REDUCE_POLICY, T, IndexType>
+{
+public:
+  using Base = ReduceMinLoc<REDUCE_POLICY, T, IndexType>;
+  using Base::Base;
+};
+
+template <typename REGISTER_POLICY,
+          typename REDUCE_POLICY,
+          typename T,
+          typename IndexType>
+class ReduceMaxLoc<
+    policy::tensor::simd_reduce<REGISTER_POLICY, REDUCE_POLICY>,
+    T,
+    IndexType> : public ReduceMaxLoc<REDUCE_POLICY, T, IndexType>
+{
+public:
+  using Base = ReduceMaxLoc<REDUCE_POLICY, T, IndexType>;
+  using Base::Base;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,243 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the registry of tuned policy choices
+ *          used by tuned_forall.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Autotuner_HPP
+#define RAJA_Autotuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Registry of the policy chosen for each tuned kernel.
+ *
+ *         A kernel is identified by its name, the power of two bucket of its
+ *         iteration count, and the number of candidate policies.  Until a
+ *         kernel is tuned, consecutive invocations cycle through the
+ *         candidates, and each candidate keeps its fastest time over
+ *         num_trials invocations.  The fastest candidate is then used for
+ *         every later invocation.
+ *
+ *         The global registry loads the file named by the RAJA_TUNING_FILE
+ *         environment variable on first use, if it exists, and writes its
+ *         tuned choices back to that file at program exit.  The file has one
+ *         line per tuned kernel: bucket, number of policies, chosen policy
+ *         and the kernel name.
+ *
+ ******************************************************************************
+ */
+class Autotuner
+{
+public:
+  Autotuner() = default;
+
+  Autotuner(Autotuner const &) = delete;
+  Autotuner &operator=(Autotuner const &) = delete;
+
+  ~Autotuner()
+  {
+    if (!m_file_name.empty()) {
+      save(m_file_name);
+    }
+  }
+
+  //! the registry used by tuned_forall
+  static Autotuner &get()
+  {
+    static Autotuner tuner(std::getenv("RAJA_TUNING_FILE"));
+    return tuner;
+  }
+
+  //! power of two bucket of an iteration count, so nearby sizes share a choice
+  static int size_bucket(Index_type size)
+  {
+    int bucket = 0;
+    while (size > 1) {
+      size >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  /*!
+   * Policy to run for the next invocation of a kernel.  Sets timing to true
+   * when the invocation is a tuning trial whose time should be passed to
+   * record().
+   */
+  int select(std::string const &name,
+             Index_type size,
+             int num_policies,
+             bool &timing)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry &entry = m_entries[make_key(name, size, num_policies)];
+    if (entry.chosen >= 0) {
+      timing = false;
+      return entry.chosen;
+    }
+    if (entry.best_time.empty()) {
+      entry.best_time.assign(num_policies,
+                             std::numeric_limits<double>::infinity());
+    }
+    timing = true;
+    return (entry.num_started++) % num_policies;
+  }
+
+  //! records the time of a tuning trial started by select()
+  void record(std::string const &name,
+              Index_type size,
+              int num_policies,
+              int policy,
+              double seconds)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry &entry = m_entries[make_key(name, size, num_policies)];
+    if (entry.chosen >= 0 || policy < 0 || policy >= num_policies) {
+      return;
+    }
+    if (entry.best_time.empty()) {
+      entry.best_time.assign(num_policies,
+                             std::numeric_limits<double>::infinity());
+    }
+    if (seconds < entry.best_time[policy]) {
+      entry.best_time[policy] = seconds;
+    }
+    if (++entry.num_recorded >= num_policies * m_num_trials) {
+      int fastest = 0;
+      for (int p = 1; p < num_policies; ++p) {
+        if (entry.best_time[p] < entry.best_time[fastest]) {
+          fastest = p;
+        }
+      }
+      entry.chosen = fastest;
+    }
+  }
+
+  //! tuned policy of a kernel, -1 if it is not tuned yet
+  int tuned_policy(std::string const &name,
+                   Index_type size,
+                   int num_policies) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(make_key(name, size, num_policies));
+    return (it == m_entries.end()) ? -1 : it->second.chosen;
+  }
+
+  //! number of timed invocations of each candidate before choosing
+  void set_num_trials(int num_trials)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_num_trials = (num_trials > 0) ? num_trials : 1;
+  }
+
+  //! forget every choice and trial
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+  }
+
+  //! adds the choices in a file written by save(), false if it can't be read
+  bool load(std::string const &file_name)
+  {
+    std::ifstream in(file_name);
+    if (!in) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int bucket = 0;
+    int num_policies = 0;
+    int chosen = 0;
+    while (in >> bucket >> num_policies >> chosen) {
+      std::string name;
+      std::getline(in >> std::ws, name);
+      if (num_policies > 0 && chosen >= 0 && chosen < num_policies) {
+        m_entries[Key(name, bucket, num_policies)].chosen = chosen;
+      }
+    }
+    return true;
+  }
+
+  //! writes the tuned choices, false if the file can't be written
+  bool save(std::string const &file_name) const
+  {
+    std::ofstream out(file_name);
+    if (!out) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto const &kv : m_entries) {
+      if (kv.second.chosen >= 0) {
+        out << std::get<1>(kv.first) << " " << std::get<2>(kv.first) << " "
+            << kv.second.chosen << " " << std::get<0>(kv.first) << "\n";
+      }
+    }
+    return static_cast<bool>(out);
+  }
+
+private:
+  using Key = std::tuple<std::string, int, int>;
+
+  struct Entry {
+    std::vector<double> best_time;
+    int num_started = 0;
+    int num_recorded = 0;
+    int chosen = -1;
+  };
+
+  explicit Autotuner(const char *file_name)
+  {
+    if (file_name != nullptr) {
+      m_file_name = file_name;
+      load(m_file_name);
+    }
+  }
+
+  static Key make_key(std::string const &name,
+                      Index_type size,
+                      int num_policies)
+  {
+    return Key(name, size_bucket(size), num_policies);
+  }
+
+  std::map<Key, Entry> m_entries;
+  std::string m_file_name;
+  int m_num_trials = 3;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
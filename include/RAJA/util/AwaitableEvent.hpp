@@ -0,0 +1,211 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file making resource events awaitable from C++20
+ *          coroutines, with a reactor thread that resumes the coroutines
+ *          waiting on events once the events complete.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AwaitableEvent_HPP
+#define RAJA_AwaitableEvent_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+namespace resources
+{
+
+/*!
+ * \brief Thread that polls events and resumes the coroutines waiting on
+ *        them once they complete.
+ *
+ * Coroutines are resumed on the reactor thread, so they should hand
+ * longer host work back to their own task system. The thread is started
+ * by the first wait and sleeps while nothing is waiting.
+ */
+class EventReactor
+{
+public:
+  //! the reactor awaited events use
+  static EventReactor& get()
+  {
+    static EventReactor reactor;
+    return reactor;
+  }
+
+  EventReactor() = default;
+  EventReactor(EventReactor const&) = delete;
+  EventReactor& operator=(EventReactor const&) = delete;
+
+  ~EventReactor()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  //! resume h on the reactor thread once e has completed
+  void enqueue(Event e, std::coroutine_handle<> h)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_waiting.emplace_back(std::move(e), h);
+      if (!m_thread.joinable()) {
+        m_thread = std::thread([this] { run(); });
+      }
+    }
+    m_cv.notify_one();
+  }
+
+private:
+  using Waiter = std::pair<Event, std::coroutine_handle<>>;
+
+  void run()
+  {
+    std::vector<Waiter> polling;
+    std::vector<std::coroutine_handle<>> ready;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] {
+          return m_stop || !m_waiting.empty() || !polling.empty();
+        });
+        if (m_stop && m_waiting.empty() && polling.empty()) {
+          return;
+        }
+        for (Waiter& w : m_waiting) {
+          polling.push_back(std::move(w));
+        }
+        m_waiting.clear();
+      }
+
+      // resume outside the lock, a resumed coroutine may await again
+      for (size_t i = 0; i < polling.size();) {
+        if (polling[i].first.check()) {
+          ready.push_back(polling[i].second);
+          polling[i] = std::move(polling.back());
+          polling.pop_back();
+        } else {
+          ++i;
+        }
+      }
+      for (std::coroutine_handle<> h : ready) {
+        h.resume();
+      }
+      if (ready.empty() && !polling.empty()) {
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+      }
+      ready.clear();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<Waiter> m_waiting;
+  std::thread m_thread;
+  bool m_stop = false;
+};
+
+/*!
+ * \brief Awaiter of an event, the coroutine is resumed by the
+ *        EventReactor once the event has completed.
+ *
+ * Awaiting the event proxy returned by a RAJA pattern gives back its
+ * resource, so the coroutine can enqueue more work on it:
+ *
+ * \verbatim
+ *   Task step(RAJA::resources::Cuda res)
+ *   {
+ *     res = co_await RAJA::forall<RAJA::cuda_exec_async<256>>(res, seg, body);
+ *     ...
+ *   }
+ * \endverbatim
+ *
+ * Host resources run patterns synchronously, so their events are ready and
+ * the coroutine does not suspend.
+ */
+template <typename Res>
+struct EventAwaiter {
+  Event event;
+  Res res;
+
+  bool await_ready() const { return event.check(); }
+
+  void await_suspend(std::coroutine_handle<> h) const
+  {
+    EventReactor::get().enqueue(event, h);
+  }
+
+  Res await_resume() const { return res; }
+};
+
+template <>
+struct EventAwaiter<void> {
+  Event event;
+
+  bool await_ready() const { return event.check(); }
+
+  void await_suspend(std::coroutine_handle<> h) const
+  {
+    EventReactor::get().enqueue(event, h);
+  }
+
+  void await_resume() const {}
+};
+
+}  // namespace resources
+}  // namespace RAJA
+
+// operator co_await is found by argument dependent lookup, so it is declared
+// in the namespace of the camp event types.
+namespace camp
+{
+namespace resources
+{
+
+template <typename Res>
+RAJA::resources::EventAwaiter<Res> operator co_await(EventProxy<Res> const& e)
+{
+  return {e.get(), e.resource_};
+}
+
+inline RAJA::resources::EventAwaiter<void> operator co_await(Event const& e)
+{
+  return {e};
+}
+
+}  // namespace resources
+}  // namespace camp
+
+#endif
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Batched_Plugins_HPP
+#define RAJA_Batched_Plugins_HPP
+
+#include <memory>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  //! launches a batched plugin is given
+  struct BatchOptions {
+    //! one in every_nth of the launches that pass min_iterations
+    long long every_nth = 1;
+
+    //! kernels with fewer iterations are skipped, kernels whose number of
+    //! iterations is not known are not
+    long long min_iterations = 0;
+  };
+
+  /*!
+   * \brief Plugin that runs other plugins off the launching threads.
+   *
+   * Plugins added with add() are not in the PluginRegistry. At the end of a
+   * launch, this plugin selects the batched plugins the launch is for with
+   * their BatchOptions, and queues a copy of the context in a lock free
+   * ring buffer. A background thread takes the contexts from the buffer and
+   * calls postLaunch of the selected plugins, so a launch costs one call and
+   * a copy however many batched plugins there are.
+   *
+   * Batched plugins only see postLaunch, after the kernel was launched,
+   * and must not keep kernel_name or policy_name past the call unless they
+   * point to storage that lives as long, e.g. string literals. When the
+   * buffer is full, contexts are dropped rather than waiting, see
+   * dropped(). finalize waits for the queued contexts and then finalizes
+   * the batched plugins.
+   */
+  class BatchedPlugins : public RAJA::util::PluginStrategy
+  {
+  public:
+    //! number of batched plugins that can be added
+    static constexpr int max_plugins = 32;
+
+    //! number of contexts the ring buffer holds
+    static constexpr unsigned long capacity = 4096;
+
+    BatchedPlugins();
+
+    ~BatchedPlugins() override;
+
+    void init(const RAJA::util::PluginOptions& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! run plugin on the background thread for the launches opts selects,
+    //! returns false when max_plugins have been added
+    bool add(std::unique_ptr<PluginStrategy> plugin,
+             BatchOptions opts = BatchOptions());
+
+    //! wait until the plugins were called for every queued context
+    void flush();
+
+    //! contexts dropped as the ring buffer was full
+    long long dropped() const;
+
+    //! the registered batching plugin
+    static BatchedPlugins* instance();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+  };  // end BatchedPlugins class
+
+  void linkBatchedPlugins();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,154 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the sampled bounds checking of RAJA Views and
+ *          Layouts.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_BoundsCheck_HPP
+#define RAJA_util_BoundsCheck_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+
+#include <atomic>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Out of bounds accesses found by sampled bounds checking.
+ *
+ * count is the number of failed checks, an access through an OffsetLayout
+ * is checked against both the offset and the underlying bounds. The other
+ * members describe the first violation: the dimension, or -1 for a linear
+ * index, the index and the bounds [lower, upper] it was checked against.
+ */
+struct BoundsCheckRecord {
+  unsigned long long count;
+  long long dim;
+  long long index;
+  long long lower;
+  long long upper;
+};
+
+namespace detail
+{
+
+//! the record in host memory that devices can write, defined in the library
+RAJASHAREDDLL_API BoundsCheckRecord* host_bounds_check_record();
+
+//! record a violation found on the host
+RAJASHAREDDLL_API void host_bounds_check_report(long long dim,
+                                                long long index,
+                                                long long lower,
+                                                long long upper);
+
+//! true during the host launches that are checked, set by a plugin
+extern RAJASHAREDDLL_API std::atomic<bool> host_bounds_check_sampled;
+
+}  // namespace detail
+
+/*!
+ * Record a layout is constructed with. It is nullptr for layouts made on a
+ * device, those are not checked.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE BoundsCheckRecord* bounds_check_record()
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__) || \
+    defined(__SYCL_DEVICE_ONLY__)
+  return nullptr;
+#else
+  return detail::host_bounds_check_record();
+#endif
+}
+
+/*!
+ * True if this access is checked. Host code is checked in one in
+ * RAJA_BOUNDS_CHECK_SAMPLE_RATE launches, device code in one in
+ * RAJA_BOUNDS_CHECK_SAMPLE_RATE threads of every launch, picked by the
+ * linear thread id so the same threads are checked in each launch.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE bool bounds_check_sampled()
+{
+#if defined(__CUDA_ARCH__)
+  const unsigned long long block =
+      blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+  const unsigned long long thread =
+      threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+  return (block * blockDim.x * blockDim.y * blockDim.z + thread) %
+             RAJA_BOUNDS_CHECK_SAMPLE_RATE ==
+         0;
+#elif defined(__HIP_DEVICE_COMPILE__)
+  const unsigned long long block =
+      hipBlockIdx_x + hipGridDim_x * (hipBlockIdx_y + hipGridDim_y * hipBlockIdx_z);
+  const unsigned long long thread =
+      hipThreadIdx_x +
+      hipBlockDim_x * (hipThreadIdx_y + hipBlockDim_y * hipThreadIdx_z);
+  return (block * hipBlockDim_x * hipBlockDim_y * hipBlockDim_z + thread) %
+             RAJA_BOUNDS_CHECK_SAMPLE_RATE ==
+         0;
+#elif defined(__SYCL_DEVICE_ONLY__)
+  return false;
+#else
+  return detail::host_bounds_check_sampled.load(std::memory_order_relaxed);
+#endif
+}
+
+/*!
+ * Record a violation in record. The count is incremented atomically and
+ * the first violation fills in the details, nothing is aborted.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void bounds_check_report(BoundsCheckRecord* record,
+                                                      long long dim,
+                                                      long long index,
+                                                      long long lower,
+                                                      long long upper)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  if (atomicAdd(&record->count, 1ull) == 0ull) {
+    record->dim = dim;
+    record->index = index;
+    record->lower = lower;
+    record->upper = upper;
+    __threadfence_system();
+  }
+#elif defined(__SYCL_DEVICE_ONLY__)
+  RAJA_UNUSED_VAR(record, dim, index, lower, upper);
+#else
+  RAJA_UNUSED_VAR(record);
+  detail::host_bounds_check_report(dim, index, lower, upper);
+#endif
+}
+
+/*!
+ * \brief The violations recorded so far.
+ *
+ * This does not synchronize, device violations show up once the kernels
+ * that found them have written the record, so it can be polled between
+ * launches or after a synchronize at the end of a time step.
+ */
+RAJASHAREDDLL_API BoundsCheckRecord bounds_check_errors();
+
+//! \brief Clear the recorded violations.
+RAJASHAREDDLL_API void bounds_check_reset();
+
+}  // namespace RAJA
+
+#endif  // RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL
+
+#endif  // closing endif for header file include guard
@@ -18,6 +18,8 @@
 #ifndef RAJA_CombingAdapter_HPP
 #define RAJA_CombingAdapter_HPP
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 
 #include "RAJA/index/RangeSegment.hpp"
@@ -167,6 +169,44 @@ public:
   }
 };
 
+namespace detail
+{
+
+/*!
+ * @brief Creates the offset layout of the index space of range segments,
+ *        with the right-most index stride 1.
+ */
+template <typename... IdxTs>
+RAJA_INLINE
+RAJA::TypedOffsetLayout<
+    typename std::common_type< strip_index_type_t<IdxTs>... >::type,
+    camp::tuple<IdxTs...>>
+make_combining_offset_layout(::RAJA::TypedRangeSegment<IdxTs> const&... segs)
+{
+  using std::begin; using std::end; using std::distance;
+  using IdxLin = typename std::common_type< strip_index_type_t<IdxTs>... >::type;
+  using Layout = RAJA::Layout<sizeof...(IdxTs), IdxLin>;
+  using OffsetLayout = RAJA::TypedOffsetLayout<IdxLin, camp::tuple<IdxTs...>>;
+
+  Layout layout(static_cast<IdxLin>(distance(begin(segs), end(segs)))...);
+  return OffsetLayout::from_layout_and_offsets(
+        {{(distance(begin(segs), end(segs)) ? static_cast<IdxLin>(*begin(segs))
+                                            : static_cast<IdxLin>(0))...}},
+        std::move(layout));
+}
+///
+template <typename... IdxTs, camp::idx_t... RangeInts>
+RAJA_INLINE
+auto make_combining_offset_layout(
+    camp::tuple<::RAJA::TypedRangeSegment<IdxTs>...> const& box,
+    camp::idx_seq<RangeInts...>)
+  -> decltype(make_combining_offset_layout(camp::get<RangeInts>(box)...))
+{
+  return make_combining_offset_layout(camp::get<RangeInts>(box)...);
+}
+
+}  // end namespace detail
+
 /*!
  * @brief Creates a CombiningAdapter class from a lambda and segments.
  * @param lambda functional object
@@ -224,18 +264,9 @@ auto make_CombiningAdapter(Lambda&& lambda, ::RAJA::TypedRangeSegment<IdxTs> con
   //                 typename std::common_type< strip_index_type_t<IdxTs>... >::type,
   //                 IdxTs...>>()))
 {
-  using std::begin; using std::end; using std::distance;
-  using IdxLin = typename std::common_type< strip_index_type_t<IdxTs>... >::type;
-  using Layout = RAJA::Layout<sizeof...(IdxTs), IdxLin>;
-  using OffsetLayout = RAJA::TypedOffsetLayout<IdxLin, camp::tuple<IdxTs...>>;
-
-  Layout layout(static_cast<IdxLin>(distance(begin(segs), end(segs)))...);
-  OffsetLayout offset_layout = OffsetLayout::from_layout_and_offsets(
-        {{(distance(begin(segs), end(segs)) ? static_cast<IdxLin>(*begin(segs))
-                                            : static_cast<IdxLin>(0))...}},
-        std::move(layout));
-  return make_CombiningAdapter_from_layout(std::forward<Lambda>(lambda),
-                                           std::move(offset_layout));
+  return make_CombiningAdapter_from_layout(
+      std::forward<Lambda>(lambda),
+      detail::make_combining_offset_layout(segs...));
 }
 ///
 RAJA_SUPPRESS_HD_WARN
@@ -263,6 +294,211 @@ auto make_PermutedCombiningAdapter(Lambda&& lambda, ::RAJA::TypedRangeSegment<Id
                                            std::move(offset_layout));
 }
 
+/*!
+ * @brief A holder for adapting lambdas meant for multidimensional index spaces
+ *        to allow their use over the concatenation of several such spaces.
+ *
+ * Like CombiningAdapter, but the 1-dimensional index space is the
+ * concatenation of NumBoxes multi-dimensional boxes with the same layout
+ * type, for example the six faces of a 3D halo. Calling the adapter with a
+ * 1-dimensional index finds its box, converts the offset into the box to a
+ * multi-dimensional index with the precomputed fast division of the layout,
+ * and calls the lambda with the 1-dimensional index followed by the
+ * multi-dimensional index. The 1-dimensional index can then address a buffer
+ * packed box after box.
+ *
+ * The adapter is trivially copyable and callable on the device, so with a
+ * device lambda a forall with cuda_exec or hip_exec runs all boxes in one
+ * kernel.
+ *
+ * For example:
+ *
+ *     // pack the low and high x faces of a 3D field into buf
+ *     auto adapter = RAJA::make_MultiCombiningAdapter(
+ *         [=] RAJA_HOST_DEVICE (int n, int i, int j, int k) {
+ *           buf[n] = field(i, j, k);
+ *         },
+ *         RAJA::make_tuple(xlo_range, jrange, krange),
+ *         RAJA::make_tuple(xhi_range, jrange, krange));
+ *
+ *     RAJA::forall<RAJA::cuda_exec<256>>(adapter.getRange(), adapter);
+ *
+ */
+template <typename Lambda, typename Layout_, size_t NumBoxes>
+struct MultiCombiningAdapter
+{
+  static_assert(NumBoxes > 0, "MultiCombiningAdapter needs at least one box");
+
+  using Layout = Layout_;
+
+  using IndexRange = typename Layout::IndexRange;
+  using StrippedIdxLin = typename Layout::StrippedIdxLin;
+  using IndexLinear = typename Layout::IndexLinear;
+  using DimTuple = typename Layout::DimTuple;
+  using DimArr = typename Layout::DimArr;
+
+  using RangeLinear = RAJA::TypedRangeSegment<IndexLinear>;
+
+  static constexpr size_t num_boxes = NumBoxes;
+
+private:
+  Lambda m_lambda;
+  Layout m_layouts[NumBoxes];
+  //! m_offsets[b] is the first 1-dimensional index of box b
+  IndexLinear m_offsets[NumBoxes + 1];
+
+  template < typename C_Lambda, camp::idx_t... BoxInts >
+  MultiCombiningAdapter(C_Lambda&& lambda,
+                        std::array<Layout, NumBoxes> const& layouts,
+                        camp::idx_seq<BoxInts...>)
+      : m_lambda(std::forward<C_Lambda>(lambda))
+      , m_layouts{layouts[BoxInts]...}
+  {
+    m_offsets[0] = static_cast<IndexLinear>(0);
+    for (size_t b = 0; b < NumBoxes; ++b) {
+      m_offsets[b + 1] = m_offsets[b] +
+                         static_cast<IndexLinear>(m_layouts[b].size_noproj());
+    }
+  }
+
+  //! Box containing linear_index, the last box for indices past the end
+  RAJA_HOST_DEVICE RAJA_INLINE size_t find_box(IndexLinear linear_index) const
+  {
+    size_t b = 0;
+    while (b + 1 < NumBoxes && !(linear_index < m_offsets[b + 1])) {
+      ++b;
+    }
+    return b;
+  }
+
+  RAJA_SUPPRESS_HD_WARN
+  template < camp::idx_t... RangeInts >
+  RAJA_HOST_DEVICE inline auto call_helper(IndexLinear linear_index,
+                                           camp::idx_seq<RangeInts...>)
+    -> decltype(m_lambda(linear_index,
+                         camp::val<camp::tuple_element_t<RangeInts, DimTuple>>()...))
+  {
+    size_t b = find_box(linear_index);
+    DimTuple indices;
+    m_layouts[b].toIndices(linear_index - m_offsets[b],
+                           camp::get<RangeInts>(indices)...);
+    return m_lambda(linear_index, camp::get<RangeInts>(indices)...);
+  }
+  ///
+  RAJA_SUPPRESS_HD_WARN
+  template < camp::idx_t... RangeInts >
+  RAJA_HOST_DEVICE inline auto call_helper(IndexLinear linear_index,
+                                           camp::idx_seq<RangeInts...>) const
+    -> decltype(m_lambda(linear_index,
+                         camp::val<camp::tuple_element_t<RangeInts, DimTuple>>()...))
+  {
+    size_t b = find_box(linear_index);
+    DimTuple indices;
+    m_layouts[b].toIndices(linear_index - m_offsets[b],
+                           camp::get<RangeInts>(indices)...);
+    return m_lambda(linear_index, camp::get<RangeInts>(indices)...);
+  }
+
+public:
+
+  /*!
+   * Constructor from lambda and the layouts of the boxes.
+   */
+  template < typename C_Lambda >
+  MultiCombiningAdapter(C_Lambda&& lambda,
+                        std::array<Layout, NumBoxes> const& layouts)
+      : MultiCombiningAdapter(std::forward<C_Lambda>(lambda), layouts,
+                              camp::make_idx_seq_t<NumBoxes>{})
+  {
+  }
+
+  /*!
+   * Call the lambda with the linear index and the multidimensional indices
+   * it converts to in its box.
+   *
+   * @return return value of lambda
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE auto operator()(IndexLinear linear_index)
+    -> decltype(call_helper(linear_index, IndexRange()))
+  {
+    return call_helper(linear_index, IndexRange());
+  }
+  ///
+  RAJA_HOST_DEVICE RAJA_INLINE auto operator()(IndexLinear linear_index) const
+    -> decltype(call_helper(linear_index, IndexRange()))
+  {
+    return call_helper(linear_index, IndexRange());
+  }
+
+  /*!
+   * Computes the total size of the boxes.
+   *
+   * @return Total size of the boxes
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE IndexLinear size() const
+  {
+    return m_offsets[NumBoxes];
+  }
+
+  /*!
+   * Gets the first linear index of box b, where b may be NumBoxes.
+   *
+   * @return Offset of box b in the linear index space
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE IndexLinear getOffset(size_t b) const
+  {
+    return m_offsets[b];
+  }
+
+  /*!
+   * Convenience method to get a 1-dimensional range representing the
+   * total size of the boxes.
+   *
+   * @return Range representing the total size of the boxes
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE RangeLinear getRange() const
+  {
+    return RangeLinear(static_cast<IndexLinear>(0), size());
+  }
+};
+
+template <typename Lambda, typename Layout_, size_t NumBoxes>
+constexpr size_t MultiCombiningAdapter<Lambda, Layout_, NumBoxes>::num_boxes;
+
+/*!
+ * @brief Creates a MultiCombiningAdapter class from a lambda and boxes.
+ * @param lambda functional object taking the linear index and the indices
+ * @param first tuple of range segments defining the first box
+ * @param rest tuples of range segments of the same types defining the
+ *        other boxes
+ * @return Returns a MultiCombiningAdapter for the given lambda and boxes
+ *
+ * NOTE: the stride 1 index of each box is the right-most index
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Lambda, typename... IdxTs, typename... Boxes>
+RAJA_INLINE
+auto make_MultiCombiningAdapter(
+    Lambda&& lambda,
+    camp::tuple<::RAJA::TypedRangeSegment<IdxTs>...> const& first,
+    Boxes const&... rest)
+{
+  using Box = camp::tuple<::RAJA::TypedRangeSegment<IdxTs>...>;
+  using Layout = decltype(detail::make_combining_offset_layout(
+      first, camp::make_idx_seq_t<sizeof...(IdxTs)>{}));
+  static_assert(concepts::all_of<std::is_same<Boxes, Box>...>::value,
+                "all boxes must have the same range segment types");
+
+  std::array<Layout, 1 + sizeof...(Boxes)> layouts{{
+      detail::make_combining_offset_layout(
+          first, camp::make_idx_seq_t<sizeof...(IdxTs)>{}),
+      detail::make_combining_offset_layout(
+          rest, camp::make_idx_seq_t<sizeof...(IdxTs)>{})...}};
+  return MultiCombiningAdapter<camp::decay<Lambda>, Layout,
+                               1 + sizeof...(Boxes)>(
+      std::forward<Lambda>(lambda), layouts);
+}
+
 }  // end namespace RAJA
 
 #endif /* RAJA_CombingAdapter_HPP */
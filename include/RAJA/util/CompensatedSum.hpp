@@ -0,0 +1,150 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for a compensated (Kahan-Babuska-Neumaier) floating
+ *          point sum accumulator.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_CompensatedSum_HPP
+#define RAJA_util_CompensatedSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Sum accumulator that carries the rounding error of its adds.
+ *
+ * Each add computes the exact rounding error of sum + value with the
+ * branch free TwoSum and accumulates it in a separate compensation term,
+ * which is added back when the result is read. Combining two accumulators
+ * adds both the sums (with TwoSum) and the compensations. The error of the
+ * result grows with the condition of the sum rather than with the number
+ * of values, so long sums of doubles keep nearly full double precision.
+ *
+ * Use it as the value type of a sum reducer or of
+ * RAJA::expt::Reduce<RAJA::operators::plus>, e.g.
+ *
+ *   RAJA::ReduceSum<RAJA::cuda_reduce, RAJA::NeumaierSum<double>> s(0.0);
+ *   RAJA::forall<RAJA::cuda_exec<256>>(seg, [=] RAJA_DEVICE (int i) {
+ *     s += a[i];
+ *   });
+ *   double sum = s.get();
+ *
+ * The compensation is lost if the compiler reassociates floating point
+ * operations, so do not build code using it with -ffast-math or similar.
+ * Atomic reducer policies fall back to their tree combine for this type.
+ */
+template <typename T>
+class NeumaierSum
+{
+  static_assert(std::is_floating_point<T>::value,
+                "NeumaierSum requires a floating point type");
+
+public:
+  using value_type = T;
+
+  RAJA_HOST_DEVICE constexpr NeumaierSum() : m_sum{0}, m_comp{0} {}
+
+  RAJA_HOST_DEVICE constexpr NeumaierSum(T val) : m_sum{val}, m_comp{0} {}
+
+  //! accumulator holding a running sum and its rounding error
+  RAJA_HOST_DEVICE constexpr NeumaierSum(T sum, T comp)
+      : m_sum{sum}, m_comp{comp}
+  {
+  }
+
+  //! add one value
+  RAJA_HOST_DEVICE NeumaierSum& operator+=(T val)
+  {
+    T err;
+    m_sum = two_sum(m_sum, val, err);
+    m_comp += err;
+    return *this;
+  }
+
+  //! combine another accumulator into this one
+  RAJA_HOST_DEVICE NeumaierSum& operator+=(NeumaierSum const& other)
+  {
+    T err;
+    m_sum = two_sum(m_sum, other.m_sum, err);
+    m_comp += err + other.m_comp;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE friend NeumaierSum operator+(NeumaierSum lhs,
+                                                NeumaierSum const& rhs)
+  {
+    return lhs += rhs;
+  }
+
+  RAJA_HOST_DEVICE friend NeumaierSum operator+(NeumaierSum lhs, T rhs)
+  {
+    return lhs += rhs;
+  }
+
+  RAJA_HOST_DEVICE friend NeumaierSum operator+(T lhs, NeumaierSum rhs)
+  {
+    return rhs += lhs;
+  }
+
+  RAJA_HOST_DEVICE friend bool operator==(NeumaierSum const& lhs,
+                                          NeumaierSum const& rhs)
+  {
+    return lhs.m_sum == rhs.m_sum && lhs.m_comp == rhs.m_comp;
+  }
+
+  RAJA_HOST_DEVICE friend bool operator!=(NeumaierSum const& lhs,
+                                          NeumaierSum const& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //! the compensated sum
+  RAJA_HOST_DEVICE constexpr T get() const { return m_sum + m_comp; }
+
+  RAJA_HOST_DEVICE constexpr operator T() const { return get(); }
+
+  //! the running sum without the compensation
+  RAJA_HOST_DEVICE constexpr T sum() const { return m_sum; }
+
+  //! the accumulated rounding error
+  RAJA_HOST_DEVICE constexpr T compensation() const { return m_comp; }
+
+private:
+  T m_sum;
+  T m_comp;
+
+  //! a + b rounded, with the rounding error in err (Knuth's TwoSum)
+  RAJA_HOST_DEVICE static T two_sum(T a, T b, T& err)
+  {
+    const T s = a + b;
+    const T bp = s - a;
+    err = (a - (s - bp)) + (b - bp);
+    return s;
+  }
+};
+
+//! Kahan summation, with Neumaier's fix for values larger than the sum
+template <typename T>
+using KahanSum = NeumaierSum<T>;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,255 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for RAJA::ConvertingPointer, a View pointer type that
+ *          stores data in one precision and computes in another.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ConvertingPointer_HPP
+#define RAJA_util_ConvertingPointer_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename To, typename From>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr To precision_cast(From const& val,
+                                                         std::true_type)
+{
+  return static_cast<To>(val);
+}
+
+//! half and bfloat16 class types convert to and from float
+template <typename To, typename From>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr To precision_cast(From const& val,
+                                                         std::false_type)
+{
+  return static_cast<To>(static_cast<float>(val));
+}
+
+/*!
+ * Convert val to type To. Arithmetic types, including _Float16 where the
+ * compiler has it, are cast directly. Other types, e.g. __half and
+ * __nv_bfloat16, are converted through float.
+ */
+template <typename To, typename From>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr To precision_cast(From const& val)
+{
+  return precision_cast<To>(
+      val,
+      std::integral_constant<bool,
+                             std::is_arithmetic<To>::value &&
+                                 std::is_arithmetic<From>::value>{});
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Reference to an element of a ConvertingPointer, reading converts
+ *        the stored value to Compute and assigning converts to Storage.
+ */
+template <typename Storage, typename Compute>
+class ConvertingRef
+{
+public:
+  RAJA_HOST_DEVICE constexpr explicit ConvertingRef(Storage* ptr) : m_ptr{ptr} {}
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator Compute() const
+  {
+    return detail::precision_cast<Compute>(*m_ptr);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const& operator=(
+      Compute const& val) const
+  {
+    *m_ptr = detail::precision_cast<Storage>(val);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const& operator=(
+      ConvertingRef const& other) const
+  {
+    return *this = static_cast<Compute>(other);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const& operator+=(
+      Compute const& val) const
+  {
+    return *this = static_cast<Compute>(*this) + val;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const& operator-=(
+      Compute const& val) const
+  {
+    return *this = static_cast<Compute>(*this) - val;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const& operator*=(
+      Compute const& val) const
+  {
+    return *this = static_cast<Compute>(*this) * val;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const& operator/=(
+      Compute const& val) const
+  {
+    return *this = static_cast<Compute>(*this) / val;
+  }
+
+  //! the address of the stored element
+  RAJA_HOST_DEVICE constexpr Storage* get() const { return m_ptr; }
+
+private:
+  Storage* m_ptr;
+};
+
+/*!
+ * \brief Pointer to data stored as Storage values that is read and written
+ *        as Compute values.
+ *
+ * Indexing returns a ConvertingRef. Storing e.g. fp32, fp16 or bf16 data
+ * while computing in fp64 moves 2 to 4 times fewer bytes in memory bound
+ * loops; the conversions are single instructions (cvtps2pd, vcvtph2ps,
+ * __half2float) that compilers vectorize in contiguous loops.
+ *
+ * Use it through RAJA::ConvertingView.
+ */
+template <typename Storage, typename Compute>
+class ConvertingPointer
+{
+public:
+  using element_type = Storage;
+  using value_type = Compute;
+
+  RAJA_HOST_DEVICE constexpr ConvertingPointer() : m_ptr{nullptr} {}
+
+  RAJA_HOST_DEVICE constexpr ConvertingPointer(Storage* ptr) : m_ptr{ptr} {}
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef<Storage, Compute> operator[](
+      IdxT i) const
+  {
+    return ConvertingRef<Storage, Compute>(m_ptr + i);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef<Storage, Compute> operator*() const
+  {
+    return ConvertingRef<Storage, Compute>(m_ptr);
+  }
+
+  //! the underlying pointer
+  RAJA_HOST_DEVICE constexpr Storage* get() const { return m_ptr; }
+
+  RAJA_HOST_DEVICE constexpr explicit operator bool() const
+  {
+    return m_ptr != nullptr;
+  }
+
+private:
+  Storage* m_ptr;
+};
+
+/*!
+ * \brief Atomic reference to an element of a ConvertingPointer.
+ *
+ * Operands are converted to Storage and the atomic operation is done on the
+ * stored element, so Storage must be a type RAJA atomics support.
+ */
+template <typename Storage, typename Compute, typename Policy>
+class ConvertingAtomicRef
+{
+public:
+  using value_type = Compute;
+
+  RAJA_HOST_DEVICE constexpr explicit ConvertingAtomicRef(Storage* ptr)
+      : m_ref{ptr}
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute load() const
+  {
+    return detail::precision_cast<Compute>(m_ref.load());
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator Compute() const { return load(); }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void store(Compute rhs) const
+  {
+    m_ref.store(detail::precision_cast<Storage>(rhs));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute operator=(Compute rhs) const
+  {
+    store(rhs);
+    return rhs;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute exchange(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref.exchange(detail::precision_cast<Storage>(rhs)));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute fetch_add(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref.fetch_add(detail::precision_cast<Storage>(rhs)));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute operator+=(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref += detail::precision_cast<Storage>(rhs));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute fetch_sub(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref.fetch_sub(detail::precision_cast<Storage>(rhs)));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute operator-=(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref -= detail::precision_cast<Storage>(rhs));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute min(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref.min(detail::precision_cast<Storage>(rhs)));
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE Compute max(Compute rhs) const
+  {
+    return detail::precision_cast<Compute>(
+        m_ref.max(detail::precision_cast<Storage>(rhs)));
+  }
+
+private:
+  AtomicRef<Storage, Policy> m_ref;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Counter_Plugin_HPP
+#define RAJA_Counter_Plugin_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * \brief Plugin that reads hardware counters around each host kernel and
+   *        prints them per kernel at finalize.
+   *
+   * Counters are read with Linux perf_event: cycles, instructions, L1 data
+   * and last level cache read misses, and the floating point events given
+   * in RAJA_COUNTER_FP_EVENTS as a comma separated list of raw event
+   * codes with the flops each instruction does, e.g. for the Intel
+   * FP_ARITH_INST_RETIRED events on doubles
+   *
+   *   RAJA_COUNTER_FP_EVENTS=0x01c7:1,0x04c7:2,0x10c7:4,0x40c7:8
+   *
+   * The counters of a thread are opened with inherit, so the counters of
+   * the thread that starts the program also count the OpenMP threads it
+   * creates later.  Kernels that run at the same time on different threads
+   * count each other's events.
+   *
+   * Setting RAJA_COUNTER_FILE writes the table to that file instead of
+   * stdout.
+   */
+  class CounterPlugin : public RAJA::util::PluginStrategy
+  {
+  public:
+    struct KernelCounters {
+      std::string name;
+      long long count;
+      long long iterations;
+      //! bytes declared with RAJA::expt::BytesMoved, summed over launches
+      long long bytes;
+      long long cycles;
+      long long instructions;
+      long long l1d_misses;
+      long long llc_misses;
+      //! floating point instructions and operations, 0 without
+      //! RAJA_COUNTER_FP_EVENTS
+      long long fp_instructions;
+      long long flops;
+
+      //! flops per floating point instruction
+      double vectorWidth() const;
+
+      //! flops per byte, using the declared bytes when there are some and
+      //! the last level cache misses otherwise
+      double arithmeticIntensity() const;
+    };
+
+    CounterPlugin();
+
+    ~CounterPlugin() override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! whether the counters could be opened on this system
+    bool available() const;
+
+    //! counters of the kernels so far
+    std::vector<KernelCounters> getCounters();
+
+    //! forget the counters so far
+    void reset();
+
+    //! the registered counter plugin
+    static CounterPlugin* instance();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+  };  // end CounterPlugin class
+
+  void linkCounterPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,268 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for a floating point sum accumulator whose result does
+ *          not depend on the order values are added or combined in.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_DeterministicSum_HPP
+#define RAJA_util_DeterministicSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of bits of each bin of a DeterministicSum
+constexpr int deterministic_sum_bin_bits = 30;
+
+//! mask of the bits of one bin
+constexpr uint64_t deterministic_sum_bin_mask =
+    (uint64_t(1) << deterministic_sum_bin_bits) - 1;
+
+//! exponent of the least significant bit of the smallest denormal double
+constexpr int deterministic_sum_min_exponent = -1074;
+
+}  // namespace detail
+
+/*!
+ * \brief Sum accumulator with a bitwise reproducible result.
+ *
+ * The bits of every value are split into fixed bins of 30 bits aligned on
+ * the smallest denormal double, and each bin is summed exactly in a 64 bit
+ * integer. Only the NumBins highest bins touched by any value are kept, the
+ * bits of lower bins are dropped. Which bins are kept depends only on the
+ * values added, and integer addition is associative, so the result is the
+ * same for any order of adds and combines. That makes reductions with
+ * DeterministicSum independent of thread count, block count, schedule and
+ * back-end, including atomic reducer policies which fall back to their
+ * tree combine for this type.
+ *
+ * The result is accurate to about 30 * (NumBins - 1) bits below the most
+ * significant bit of the largest value. Up to 2^33 values may be added in
+ * total before the bin sums can overflow. inf and nan values propagate as
+ * they would in an ordinary sum.
+ *
+ * Use it as the value type of a sum reducer, e.g.
+ *
+ *   RAJA::ReduceSum<RAJA::omp_reduce, RAJA::DeterministicSum<double>> s(0.0);
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(seg, [=](int i) { s += a[i]; });
+ *   double sum = s.get();
+ *
+ * or with RAJA::expt::Reduce<RAJA::operators::plus>(&dsum) params, where
+ * each += deposits directly into the accumulator.
+ */
+template <typename T, int NumBins = 3>
+class DeterministicSum
+{
+  static_assert(std::is_same<T, double>::value ||
+                    std::is_same<T, float>::value,
+                "DeterministicSum supports float and double");
+  static_assert(NumBins >= 2, "DeterministicSum needs at least two bins");
+
+public:
+  using value_type = T;
+
+  RAJA_HOST_DEVICE constexpr DeterministicSum() : m_bins{}, m_top{-1}, m_special{0} {}
+
+  RAJA_HOST_DEVICE DeterministicSum(T val) : DeterministicSum() { deposit(val); }
+
+  //! add one value
+  RAJA_HOST_DEVICE DeterministicSum& operator+=(T val)
+  {
+    deposit(val);
+    return *this;
+  }
+
+  //! combine another accumulator into this one
+  RAJA_HOST_DEVICE DeterministicSum& operator+=(DeterministicSum const& other)
+  {
+    m_special += other.m_special;
+    if (other.m_top < 0) {
+      return *this;
+    }
+    if (other.m_top > m_top) {
+      raise_top(other.m_top);
+    }
+    const int diff = m_top - other.m_top;
+    for (int j = 0; j + diff < NumBins; ++j) {
+      m_bins[j + diff] += other.m_bins[j];
+    }
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE friend DeterministicSum operator+(DeterministicSum lhs,
+                                                     DeterministicSum const& rhs)
+  {
+    return lhs += rhs;
+  }
+
+  RAJA_HOST_DEVICE friend DeterministicSum operator+(DeterministicSum lhs, T rhs)
+  {
+    return lhs += rhs;
+  }
+
+  RAJA_HOST_DEVICE friend DeterministicSum operator+(T lhs, DeterministicSum rhs)
+  {
+    return rhs += lhs;
+  }
+
+  //! accumulators are equal if they hold the same kept bits
+  RAJA_HOST_DEVICE friend bool operator==(DeterministicSum const& lhs,
+                                          DeterministicSum const& rhs)
+  {
+    DeterministicSum l = lhs.normalized();
+    DeterministicSum r = rhs.normalized();
+    if (l.m_top != r.m_top) {
+      return false;
+    }
+    for (int j = 0; j < NumBins; ++j) {
+      if (l.m_bins[j] != r.m_bins[j]) {
+        return false;
+      }
+    }
+    return (l.m_special == r.m_special) ||
+           (l.m_special != l.m_special && r.m_special != r.m_special);
+  }
+
+  RAJA_HOST_DEVICE friend bool operator!=(DeterministicSum const& lhs,
+                                          DeterministicSum const& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //! the sum rounded to T, the same for any order of adds and combines
+  RAJA_HOST_DEVICE T get() const
+  {
+    if (m_special != 0) {
+      return static_cast<T>(m_special);
+    }
+    if (m_top < 0) {
+      return T(0);
+    }
+    DeterministicSum n = normalized();
+    // bins below the top are in [0, 2^30), add them from the lowest up
+    double val = 0.0;
+    for (int j = NumBins - 1; j > 0; --j) {
+      val = (val + static_cast<double>(n.m_bins[j])) *
+            (1.0 / double(uint64_t(1) << detail::deterministic_sum_bin_bits));
+    }
+    val += static_cast<double>(n.m_bins[0]);
+    return static_cast<T>(
+        ldexp(val,
+              detail::deterministic_sum_bin_bits * n.m_top +
+                  detail::deterministic_sum_min_exponent));
+  }
+
+  RAJA_HOST_DEVICE operator T() const { return get(); }
+
+private:
+  //! sum of the bits in bin m_top - j of all values added
+  int64_t m_bins[NumBins];
+  //! highest bin touched by any value, -1 if none
+  int m_top;
+  //! sum of the inf and nan values added
+  double m_special;
+
+  //! move the kept range up so m_top becomes new_top, dropping low bins
+  RAJA_HOST_DEVICE void raise_top(int new_top)
+  {
+    if (m_top >= 0) {
+      const int diff = new_top - m_top;
+      for (int j = NumBins - 1; j >= 0; --j) {
+        m_bins[j] = (j >= diff) ? m_bins[j - diff] : 0;
+      }
+    }
+    m_top = new_top;
+  }
+
+  //! split val into its bins and add the kept ones
+  RAJA_HOST_DEVICE void deposit(T val_in)
+  {
+    const double val = static_cast<double>(val_in);
+
+    uint64_t bits;
+    memcpy(&bits, &val, sizeof(double));
+
+    const bool negative = (bits >> 63) != 0;
+    const int biased_exp = static_cast<int>((bits >> 52) & 0x7ff);
+    uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+
+    if (biased_exp == 0x7ff) {
+      m_special += val;
+      return;
+    }
+    if (biased_exp != 0) {
+      mantissa |= uint64_t(1) << 52;
+    }
+    if (mantissa == 0) {
+      return;
+    }
+
+    // bit position of the least significant mantissa bit above the
+    // smallest denormal
+    const int pos = (biased_exp != 0 ? biased_exp - 1 : 0);
+    const int bin_lo = pos / detail::deterministic_sum_bin_bits;
+    const int shift = pos % detail::deterministic_sum_bin_bits;
+
+    // a 53 bit mantissa spans at most three bins
+    const uint64_t high = mantissa >> (detail::deterministic_sum_bin_bits - shift);
+    const uint64_t digits[3] = {
+        (mantissa << shift) & detail::deterministic_sum_bin_mask,
+        high & detail::deterministic_sum_bin_mask,
+        high >> detail::deterministic_sum_bin_bits};
+
+    const int bin_hi = bin_lo + (digits[2] != 0 ? 2 : (digits[1] != 0 ? 1 : 0));
+    if (bin_hi > m_top) {
+      raise_top(bin_hi);
+    }
+
+    for (int k = 0; k < 3; ++k) {
+      const int j = m_top - (bin_lo + k);
+      if (j >= 0 && j < NumBins) {
+        const int64_t d = static_cast<int64_t>(digits[k]);
+        m_bins[j] += negative ? -d : d;
+      }
+    }
+  }
+
+  //! copy with the carries of the lower bins moved up, bins below the top
+  //! end up in [0, 2^30)
+  RAJA_HOST_DEVICE DeterministicSum normalized() const
+  {
+    DeterministicSum n = *this;
+    for (int j = NumBins - 1; j > 0; --j) {
+      const int64_t low = static_cast<int64_t>(
+          static_cast<uint64_t>(n.m_bins[j]) & detail::deterministic_sum_bin_mask);
+      n.m_bins[j - 1] += (n.m_bins[j] - low) /
+                         int64_t(int64_t(1) << detail::deterministic_sum_bin_bits);
+      n.m_bins[j] = low;
+    }
+    return n;
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,143 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for integer division by a run time invariant divisor
+ *          using a precomputed multiplier and shift.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FastDivmod_HPP
+#define RAJA_util_FastDivmod_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! largest divisor and dividend handled by FastDivmod's multiply and shift
+constexpr uint64_t fast_divmod_max = 0x7fffffff;
+
+//! ceil(log2(d))
+RAJA_HOST_DEVICE
+constexpr uint32_t fast_divmod_shift(uint64_t d)
+{
+  uint32_t s = 0;
+  while ((uint64_t(1) << s) < d) {
+    ++s;
+  }
+  return s;
+}
+
+//! floor(2^32 * (2^s - d) / d) + 1, with s = ceil(log2(d))
+RAJA_HOST_DEVICE
+constexpr uint32_t fast_divmod_multiplier(uint64_t d)
+{
+  return static_cast<uint32_t>(
+      ((uint64_t(1) << 32) * ((uint64_t(1) << fast_divmod_shift(d)) - d)) /
+          d +
+      1);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief  Divides by a fixed divisor with a multiply and a shift.
+ *
+ * The multiplier and shift are computed once, when the object is made, so
+ * that each divmod costs a high multiply, an add and a shift instead of an
+ * integer division, which is slow on GPUs.  This uses the round-up method:
+ * with s = ceil(log2(d)) and m = floor(2^32 * (2^s - d) / d) + 1, the
+ * quotient of n by d is (umulhi(n, m) + n) >> s for every n < 2^31.
+ *
+ * The constructor is constexpr so the object can be built in constexpr
+ * member initializers, like those of Layout.  Divisors and dividends that
+ * are negative or do not fit in 31 bits fall back to integer division.
+ */
+template <typename IndexType>
+struct FastDivmod {
+  IndexType divisor = IndexType(1);
+  //! zero when the multiply and shift can't be used for this divisor
+  uint32_t multiplier = 0;
+  uint32_t shift = 0;
+
+  constexpr RAJA_INLINE FastDivmod() = default;
+
+  RAJA_HOST_DEVICE
+  constexpr RAJA_INLINE FastDivmod(IndexType divisor_)
+      : divisor{divisor_},
+        multiplier{magic(divisor_) ? detail::fast_divmod_multiplier(
+                                         static_cast<uint64_t>(divisor_))
+                                   : uint32_t(0)},
+        shift{magic(divisor_) ? detail::fast_divmod_shift(
+                                    static_cast<uint64_t>(divisor_))
+                              : uint32_t(0)}
+  {
+  }
+
+  //! n / divisor
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  IndexType div(IndexType n) const
+  {
+    if (multiplier != 0 && fits(n)) {
+      uint32_t n32 = static_cast<uint32_t>(n);
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+      uint32_t hi = __umulhi(n32, multiplier);
+#else
+      uint32_t hi = static_cast<uint32_t>(
+          (static_cast<uint64_t>(n32) * multiplier) >> 32);
+#endif
+      return static_cast<IndexType>((hi + n32) >> shift);
+    }
+    return n / divisor;
+  }
+
+  //! n % divisor
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  IndexType mod(IndexType n) const { return n - div(n) * divisor; }
+
+  //! sets quotient and remainder of n / divisor
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  void divmod(IndexType n, IndexType &quotient, IndexType &remainder) const
+  {
+    quotient = div(n);
+    remainder = n - quotient * divisor;
+  }
+
+private:
+  RAJA_HOST_DEVICE
+  static constexpr RAJA_INLINE bool fits(IndexType n)
+  {
+    return !(n < IndexType(0)) &&
+           static_cast<uint64_t>(n) <= detail::fast_divmod_max;
+  }
+
+  RAJA_HOST_DEVICE
+  static constexpr RAJA_INLINE bool magic(IndexType d)
+  {
+    return IndexType(0) < d && fits(d);
+  }
+};
+
+}  // namespace RAJA
+
+#endif
@@ -26,12 +26,26 @@ namespace util {
     typedef void (*post_function)(uint64_t);
     typedef void (*finalize_function)();
 
+    //! Kokkos_Profiling_SpaceHandle
+    struct SpaceHandle {
+      char name[64];
+    };
+    typedef void (*data_function)(const SpaceHandle, const char*, const void*, const uint64_t);
+
     KokkosPluginLoader();
 
     void preLaunch(const RAJA::util::PluginContext& p) override;
 
     void postLaunch(const RAJA::util::PluginContext& p) override;
 
+    void preFence(const RAJA::util::PluginContext& p) override;
+
+    void postFence(const RAJA::util::PluginContext& p) override;
+
+    void allocateData(const RAJA::util::PluginMemoryContext& p) override;
+
+    void deallocateData(const RAJA::util::PluginMemoryContext& p) override;
+
     void finalize() override;
 
   private:
@@ -44,6 +58,16 @@ namespace util {
     std::vector<post_function> post_functions;
     std::vector<finalize_function> finalize_functions;
 
+    // optional callbacks, a tool need not define them
+    std::vector<pre_function> pre_reduce_functions;
+    std::vector<post_function> post_reduce_functions;
+    std::vector<pre_function> pre_scan_functions;
+    std::vector<post_function> post_scan_functions;
+    std::vector<pre_function> pre_fence_functions;
+    std::vector<post_function> post_fence_functions;
+    std::vector<data_function> allocate_functions;
+    std::vector<data_function> deallocate_functions;
+
   };  // end KokkosPluginLoader class
 
   void linkKokkosPluginLoader();
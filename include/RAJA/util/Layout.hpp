@@ -28,6 +28,8 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/BoundsCheck.hpp"
+#include "RAJA/util/FastDivmod.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -80,8 +82,14 @@ public:
 
   IdxLin sizes[n_dims] = {0};
   IdxLin strides[n_dims] = {0};
-  IdxLin inv_strides[n_dims] = {0};
-  IdxLin inv_mods[n_dims] = {0};
+  // divisions by the strides and sizes used by toIndices, with zero
+  // strides and sizes replaced by 1
+  FastDivmod<IdxLin> div_strides[n_dims] = {};
+  FastDivmod<IdxLin> div_mods[n_dims] = {};
+#if defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+  // where sampled bounds checks record violations, nullptr if not checked
+  BoundsCheckRecord* bounds_record = RAJA::bounds_check_record();
+#endif
 
 
   /*!
@@ -104,8 +112,10 @@ public:
         strides{(detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
             sizes[RangeInts] ? IdxLin(1) : IdxLin(0),
             sizes))...},
-        inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
-        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+        div_strides{FastDivmod<IdxLin>(
+            strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
+        div_mods{FastDivmod<IdxLin>(
+            sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
   {
     static_assert(n_dims == sizeof...(Types),
                   "number of dimensions must match");
@@ -120,8 +130,14 @@ public:
           &rhs)
       : sizes{static_cast<IdxLin>(rhs.sizes[RangeInts])...},
         strides{static_cast<IdxLin>(rhs.strides[RangeInts])...},
-        inv_strides{static_cast<IdxLin>(rhs.inv_strides[RangeInts])...},
-        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...}
+        div_strides{FastDivmod<IdxLin>(
+            static_cast<IdxLin>(rhs.div_strides[RangeInts].divisor))...},
+        div_mods{FastDivmod<IdxLin>(
+            static_cast<IdxLin>(rhs.div_mods[RangeInts].divisor))...}
+#if defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+        ,
+        bounds_record{rhs.bounds_record}
+#endif
   {
   }
 
@@ -135,8 +151,10 @@ public:
       const std::array<IdxLin, n_dims> &strides_in)
       : sizes{sizes_in[RangeInts]...},
         strides{strides_in[RangeInts]...},
-        inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
-        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+        div_strides{FastDivmod<IdxLin>(
+            strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
+        div_mods{FastDivmod<IdxLin>(
+            sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
   {
   }
 
@@ -146,9 +164,14 @@ public:
   template<camp::idx_t N, typename Idx>
   RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
   {
+#if defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+    bounds_check_report(bounds_record, N, static_cast<long long>(idx), 0,
+                        static_cast<long long>(sizes[N] - 1));
+#else
     printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
            static_cast<int>(N), static_cast<long int>(idx), static_cast<long int>(sizes[N] - 1));
     RAJA_ABORT_OR_THROW("Out of bounds error \n");
+#endif
   }
 
   template <camp::idx_t N>
@@ -182,6 +205,10 @@ public:
   {
 #if defined (RAJA_BOUNDS_CHECK_INTERNAL)
     BoundsCheck<0>(indices...);
+#elif defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+    if (bounds_record != nullptr && bounds_check_sampled()) {
+      BoundsCheck<0>(indices...);
+    }
 #endif
     // dot product of strides and indices
     return sum<IdxLin>(
@@ -197,7 +224,8 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * The 2n integer divisions are done with multipliers and shifts that are
+   * precomputed when the layout is constructed.
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -214,11 +242,20 @@ public:
              static_cast<long int>(linear_index), static_cast<long int>(totSize-1));
       RAJA_ABORT_OR_THROW("Out of bounds error \n");
      }
+#elif defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+    if (bounds_record != nullptr && bounds_check_sampled()) {
+      IdxLin totSize = size_noproj();
+      if (totSize > 0 && (linear_index < 0 || linear_index >= totSize)) {
+        bounds_check_report(bounds_record, -1,
+                            static_cast<long long>(linear_index), 0,
+                            static_cast<long long>(totSize - 1));
+      }
+    }
 #endif
 
     camp::sink((indices =
-      (camp::decay<Indices>)((linear_index / inv_strides[RangeInts]) %
-                             inv_mods[RangeInts]))...);
+      (camp::decay<Indices>)(div_mods[RangeInts].mod(
+          div_strides[RangeInts].div(linear_index))))...);
   }
 
   /*!
@@ -367,7 +404,8 @@ struct TypedLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * The 2n integer divisions are done with precomputed multipliers and
+   * shifts, see the untyped toIndices.
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -0,0 +1,365 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MortonLayout, a N-dimensional index
+ *          calculator that stores the index space in Morton (Z) order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_MortonLayout_HPP
+#define RAJA_util_MortonLayout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/FastDivmod.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Spreads the bits of an index N bits apart, so bit b moves to bit b*N, and
+ * gathers them back.
+ */
+template <size_t N>
+struct MortonBits {
+  static constexpr int max_bits = 64 / N;
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t spread(uint64_t x)
+  {
+    uint64_t r = 0;
+    for (int b = 0; b < max_bits; ++b) {
+      r |= ((x >> b) & uint64_t(1)) << (b * N);
+    }
+    return r;
+  }
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t compact(uint64_t x)
+  {
+    uint64_t r = 0;
+    for (int b = 0; b < max_bits; ++b) {
+      r |= ((x >> (b * N)) & uint64_t(1)) << b;
+    }
+    return r;
+  }
+};
+
+template <>
+struct MortonBits<1> {
+  static constexpr int max_bits = 64;
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t spread(uint64_t x) { return x; }
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t compact(uint64_t x)
+  {
+    return x;
+  }
+};
+
+template <>
+struct MortonBits<2> {
+  static constexpr int max_bits = 32;
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t spread(uint64_t x)
+  {
+    x &= 0x00000000ffffffffull;
+    x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+    x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+    x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x << 2)) & 0x3333333333333333ull;
+    x = (x | (x << 1)) & 0x5555555555555555ull;
+    return x;
+  }
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t compact(uint64_t x)
+  {
+    x &= 0x5555555555555555ull;
+    x = (x | (x >> 1)) & 0x3333333333333333ull;
+    x = (x | (x >> 2)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x >> 4)) & 0x00ff00ff00ff00ffull;
+    x = (x | (x >> 8)) & 0x0000ffff0000ffffull;
+    x = (x | (x >> 16)) & 0x00000000ffffffffull;
+    return x;
+  }
+};
+
+template <>
+struct MortonBits<3> {
+  static constexpr int max_bits = 21;
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t spread(uint64_t x)
+  {
+    x &= 0x00000000001fffffull;
+    x = (x | (x << 32)) & 0x001f00000000ffffull;
+    x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+    x = (x | (x << 8)) & 0x100f00f00f00f00full;
+    x = (x | (x << 4)) & 0x10c30c30c30c30c3ull;
+    x = (x | (x << 2)) & 0x1249249249249249ull;
+    return x;
+  }
+
+  static RAJA_INLINE RAJA_HOST_DEVICE uint64_t compact(uint64_t x)
+  {
+    x &= 0x1249249249249249ull;
+    x = (x | (x >> 2)) & 0x10c30c30c30c30c3ull;
+    x = (x | (x >> 4)) & 0x100f00f00f00f00full;
+    x = (x | (x >> 8)) & 0x001f0000ff0000ffull;
+    x = (x | (x >> 16)) & 0x001f00000000ffffull;
+    x = (x | (x >> 32)) & 0x00000000001fffffull;
+    return x;
+  }
+};
+
+template <typename Range, typename IdxLin = Index_type>
+struct MortonLayoutBase_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+  using bits_type = MortonBits<sizeof...(RangeInts)>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  // no dimension is contiguous in Morton order
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  IdxLin sizes[n_dims] = {0};
+  //! each tile is 2^tile_bits elements on a side
+  int tile_bits = 0;
+  IdxLin num_tiles[n_dims] = {0};
+  IdxLin tile_strides[n_dims] = {0};
+  // precomputed divisions used by toIndices
+  FastDivmod<IdxLin> div_tile_strides[n_dims] = {};
+  FastDivmod<IdxLin> div_num_tiles[n_dims] = {};
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE MortonLayoutBase_impl() = default;
+  constexpr RAJA_INLINE MortonLayoutBase_impl(MortonLayoutBase_impl const &) =
+      default;
+  constexpr RAJA_INLINE MortonLayoutBase_impl(MortonLayoutBase_impl &&) =
+      default;
+  RAJA_INLINE MortonLayoutBase_impl &operator=(MortonLayoutBase_impl const &) =
+      default;
+  RAJA_INLINE MortonLayoutBase_impl &operator=(MortonLayoutBase_impl &&) =
+      default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MortonLayoutBase_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        tile_bits{compute_tile_bits(sizes)},
+        num_tiles{((RAJA::max<IdxLin>(sizes[RangeInts], IdxLin(1)) +
+                    (IdxLin(1) << tile_bits) - IdxLin(1)) >>
+                   tile_bits)...},
+        tile_strides{(detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
+            IdxLin(1) << (tile_bits * int(n_dims)), num_tiles))...},
+        div_tile_strides{FastDivmod<IdxLin>(tile_strides[RangeInts])...},
+        div_num_tiles{FastDivmod<IdxLin>(num_tiles[RangeInts])...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N), static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This is the offset of the index's tile plus the interleaved bits of its
+   * offsets inside the tile.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin
+  operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(stripIndexType(indices)...);
+#endif
+    // the interleaved bits of different dimensions don't overlap,
+    // so summing them is the same as or-ing them
+    return sum<IdxLin>(
+        ((IdxLin(stripIndexType(indices)) >> tile_bits) *
+             tile_strides[RangeInts] +
+         IdxLin(bits_type::spread(static_cast<uint64_t>(
+                    IdxLin(stripIndexType(indices)) & tile_mask()))
+                << (n_dims - 1 - RangeInts)))...);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    uint64_t inner = static_cast<uint64_t>(
+        linear_index & ((IdxLin(1) << (tile_bits * int(n_dims))) - IdxLin(1)));
+    camp::sink((indices = (camp::decay<Indices>)(
+                    (div_num_tiles[RangeInts].mod(
+                         div_tile_strides[RangeInts].div(linear_index))
+                     << tile_bits) +
+                    IdxLin(bits_type::compact(inner >> (n_dims - 1 - RangeInts)))))...);
+  }
+
+  /*!
+   * Computes the size of the layout's linear space, which includes the
+   * padding of each dimension up to a whole number of tiles.
+   * This is the number of elements that must be allocated for a View.
+   *
+   * @return Total size spanned by the linear indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return tile_strides[0] * num_tiles[0];
+  }
+
+  /*!
+   * Computes a total size of the layout's index space, without padding.
+   * This is the produce of each dimensions size.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size_noproj() const
+  {
+    return foldl(RAJA::operators::multiplies<IdxLin>(), sizes[RangeInts]...);
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_size() const
+  {
+    return sizes[DIM];
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_begin() const
+  {
+    return 0;
+  }
+
+private:
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin tile_mask() const
+  {
+    return (IdxLin(1) << tile_bits) - IdxLin(1);
+  }
+
+  /*!
+   * Largest power of two tile that fits in the smallest dimension, so that
+   * no dimension is padded by more than its own size.
+   */
+  static RAJA_INLINE RAJA_HOST_DEVICE constexpr int compute_tile_bits(
+      IdxLin const (&sizes_in)[n_dims])
+  {
+    IdxLin min_size = RAJA::max<IdxLin>(sizes_in[0], IdxLin(1));
+    for (size_t d = 1; d < n_dims; ++d) {
+      min_size = RAJA::min<IdxLin>(min_size,
+                                   RAJA::max<IdxLin>(sizes_in[d], IdxLin(1)));
+    }
+    int bits = 0;
+    while (bits + 1 < bits_type::max_bits &&
+           bits + 2 < std::numeric_limits<IdxLin>::digits &&
+           (IdxLin(2) << bits) <= min_size) {
+      ++bits;
+    }
+    return bits;
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t
+    MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space in
+ * Morton, or Z, order.
+ *
+ * The linear index interleaves the bits of the indices, with the last
+ * (right-most) index in the lowest bit, so indices that are close in every
+ * dimension are close in memory.  For extents that are not
+ * equal powers of two, the space is split into cubic tiles of 2^k elements on
+ * a side, where 2^k is the largest power of two not above the smallest
+ * dimension.  The tiles are laid out in row-major order and the elements of
+ * each tile are in Morton order, so a cube of power of two extent is in pure
+ * Morton order.
+ *
+ * For example:
+ *
+ *     MortonLayout<2> layout(4, 4);
+ *
+ *     int lin = layout(1, 2);   // bits i=01, j=10 interleave to 0110, lin=6
+ *
+ *     int i, j;
+ *     layout.toIndices(lin, i, j);   // i,j = {1, 2}
+ *
+ * Each dimension is padded up to a whole number of tiles, so size() is the
+ * number of elements to allocate.  Projected dimensions are not supported.
+ * See RAJA::make_morton_view to make a View with this layout.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using MortonLayout =
+    detail::MortonLayoutBase_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+}  // namespace RAJA
+
+#endif
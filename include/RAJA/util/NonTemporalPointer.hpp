@@ -0,0 +1,202 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for RAJA::NonTemporalPointer, a View pointer type that
+ *          writes with streaming (non-temporal) stores.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_NonTemporalPointer_HPP
+#define RAJA_util_NonTemporalPointer_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) && defined(__x86_64__)
+#include <emmintrin.h>
+#define RAJA_HAVE_SSE2_STREAM_STORES
+#endif
+
+#include "RAJA/util/ReadOnlyPointer.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+#if defined(__CUDA_ARCH__)
+template <typename T>
+RAJA_DEVICE RAJA_INLINE void nontemporal_store(T* ptr,
+                                               T const& val,
+                                               std::true_type)
+{
+  // __stcs has overloads for the same types as __ldg
+  __stcs(ptr, val);
+}
+#elif defined(__HIP_DEVICE_COMPILE__)
+template <typename T>
+RAJA_DEVICE RAJA_INLINE void nontemporal_store(T* ptr,
+                                               T const& val,
+                                               std::true_type)
+{
+  __builtin_nontemporal_store(val, ptr);
+}
+#elif defined(RAJA_HAVE_SSE2_STREAM_STORES)
+//! movnti of the bits of 4 and 8 byte values, other sizes store normally
+template <typename T>
+RAJA_INLINE void nontemporal_store(T* ptr, T const& val, std::true_type)
+{
+  if (sizeof(T) == sizeof(int64_t)) {
+    long long bits;
+    memcpy(&bits, &val, sizeof(T));
+    _mm_stream_si64(reinterpret_cast<long long*>(ptr), bits);
+  } else if (sizeof(T) == sizeof(int32_t)) {
+    int bits;
+    memcpy(&bits, &val, sizeof(T));
+    _mm_stream_si32(reinterpret_cast<int*>(ptr), bits);
+  } else {
+    *ptr = val;
+  }
+}
+#else
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void nontemporal_store(T* ptr,
+                                                    T const& val,
+                                                    std::true_type)
+{
+  *ptr = val;
+}
+#endif
+
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void nontemporal_store(T* ptr,
+                                                    T const& val,
+                                                    std::false_type)
+{
+  *ptr = val;
+}
+
+/*!
+ * Store val to *ptr without allocating the line in cache, where the target
+ * and type support it, and with an ordinary store otherwise.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void nontemporal_store(T* ptr, T const& val)
+{
+  nontemporal_store(ptr, val, is_ldg_type<T>{});
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Order the streaming stores of the calling host thread before its
+ *        later stores.
+ *
+ * Streaming stores on x86 are weakly ordered. Call this after a loop that
+ * wrote through a NonTemporalPointer, on the thread that ran it, before
+ * another thread reads the data. It does nothing on other targets and in
+ * device code, where the stores are complete when the kernel is.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void nontemporal_store_fence()
+{
+#if defined(RAJA_HAVE_SSE2_STREAM_STORES) && \
+    !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+  _mm_sfence();
+#endif
+}
+
+/*!
+ * \brief Reference to an element of a NonTemporalPointer, assigning to it
+ *        is a streaming store.
+ */
+template <typename T>
+class NonTemporalRef
+{
+public:
+  RAJA_HOST_DEVICE constexpr explicit NonTemporalRef(T* ptr) : m_ptr{ptr} {}
+
+  RAJA_HOST_DEVICE RAJA_INLINE NonTemporalRef const& operator=(
+      T const& val) const
+  {
+    detail::nontemporal_store(m_ptr, val);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE NonTemporalRef const& operator=(
+      NonTemporalRef const& other) const
+  {
+    return *this = static_cast<T>(other);
+  }
+
+  //! reading the element is an ordinary load
+  RAJA_HOST_DEVICE RAJA_INLINE operator T() const { return *m_ptr; }
+
+private:
+  T* m_ptr;
+};
+
+/*!
+ * \brief Pointer to data that is written once and not read back soon.
+ *
+ * Indexing returns a NonTemporalRef, so assignments store without first
+ * reading the cache line (read for ownership) and without evicting data
+ * that is reused. Device code uses __stcs on CUDA and nontemporal stores
+ * on HIP. x86 hosts with SSE2 use movnti for 4 and 8 byte elements, and
+ * need RAJA::nontemporal_store_fence() once the loop is done. Other targets
+ * and types store normally.
+ *
+ * Use it for write-only outputs of streaming loops, e.g. triad results or
+ * pack buffers, through RAJA::NonTemporalStoreView.
+ */
+template <typename T>
+class NonTemporalPointer
+{
+public:
+  using element_type = T;
+  using value_type = T;
+
+  RAJA_HOST_DEVICE constexpr NonTemporalPointer() : m_ptr{nullptr} {}
+
+  RAJA_HOST_DEVICE constexpr NonTemporalPointer(T* ptr) : m_ptr{ptr} {}
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE NonTemporalRef<T> operator[](IdxT i) const
+  {
+    return NonTemporalRef<T>(m_ptr + i);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE NonTemporalRef<T> operator*() const
+  {
+    return NonTemporalRef<T>(m_ptr);
+  }
+
+  //! the underlying pointer
+  RAJA_HOST_DEVICE constexpr T* get() const { return m_ptr; }
+
+  RAJA_HOST_DEVICE constexpr explicit operator bool() const
+  {
+    return m_ptr != nullptr;
+  }
+
+private:
+  T* m_ptr;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -74,10 +74,16 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   template<camp::idx_t N, typename Idx>
   RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
   {
+#if defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+    bounds_check_report(base_.bounds_record, N, static_cast<long long>(idx),
+                        static_cast<long long>(offsets[N]),
+                        static_cast<long long>(offsets[N] + base_.sizes[N] - 1));
+#else
     printf("Error at index %d, value %ld is not within bounds [%ld, %ld] \n",
            static_cast<int>(N), static_cast<long int>(idx),
            static_cast<long int>(offsets[N]), static_cast<long int>(offsets[N] + base_.sizes[N] - 1));
     RAJA_ABORT_OR_THROW("Out of bounds error \n");
+#endif
   }
 
   template <camp::idx_t N>
@@ -102,6 +108,10 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   {
 #if defined (RAJA_BOUNDS_CHECK_INTERNAL)
     BoundsCheck<0>(indices...);
+#elif defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+    if (base_.bounds_record != nullptr && bounds_check_sampled()) {
+      BoundsCheck<0>(indices...);
+    }
 #endif
     return base_((indices - offsets[RangeInts])...);
   }
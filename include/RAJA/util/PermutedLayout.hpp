@@ -85,8 +85,8 @@ auto make_permuted_layout(std::array<IdxLin, Rank> sizes,
   for (size_t i = 0; i < Rank; ++i) {
     ret.sizes[i] = sizes[i];
     ret.strides[i] = strides[i];
-    ret.inv_strides[i] = strides[i] ? strides[i] : 1;
-    ret.inv_mods[i] = sizes[i] ? sizes[i] : 1;
+    ret.div_strides[i] = FastDivmod<IdxLin>(strides[i] ? strides[i] : 1);
+    ret.div_mods[i] = FastDivmod<IdxLin>(sizes[i] ? sizes[i] : 1);
   }
   return ret;
 }
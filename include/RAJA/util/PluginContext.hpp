@@ -11,11 +11,22 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
+#include <cstddef>
+#include <typeinfo>
+
 namespace RAJA {
 namespace util {
 
 class KokkosPluginLoader;
 
+//! kind of parallel pattern a PluginContext is launched for
+enum class LaunchKind {
+  parallel_for,
+  //! a forall with RAJA::expt::Reduce or ReduceLoc parameters
+  parallel_reduce,
+  parallel_scan
+};
+
 struct PluginContext {
   public:
     PluginContext(const Platform p) :
@@ -23,18 +34,116 @@ struct PluginContext {
 
     Platform platform;
 
+    LaunchKind kind = LaunchKind::parallel_for;
+
+    //! mangled name of the execution policy type, see std::type_info::name
+    const char* policy_name = nullptr;
+
+    //! name of the kernel, from a RAJA::expt::KernelName parameter, or nullptr
+    const char* kernel_name = nullptr;
+
+    //! number of iterations of the kernel, or -1 if it is not known
+    long long num_iterations = -1;
+
+    //! cudaStream_t or hipStream_t the kernel is launched on, or nullptr
+    void* stream = nullptr;
+
+    //! bytes the kernel moves, from a RAJA::expt::BytesMoved parameter, or -1
+    long long bytes = -1;
+
+    //! size of the loop body, which GPU policies copy to every launch, or 0
+    //! if it is not known
+    size_t body_bytes = 0;
+
+    struct Dims {
+      unsigned int x = 0;
+      unsigned int y = 0;
+      unsigned int z = 0;
+    };
+
+    //! launch geometry of the last GPU kernel launched for this context,
+    //! set by the CUDA and HIP back-ends so it is seen in postLaunch
+    mutable Dims grid;
+    mutable Dims block;
+    mutable size_t shmem = 0;
+
   private:
     mutable uint64_t kID;
 
     friend class KokkosPluginLoader;
 };
 
+//! memory allocated or freed by a RAJA memory pool, see
+//! PluginStrategy::allocateData
+struct PluginMemoryContext {
+  //! memory space, "Host", "Cuda", "CudaHostPinned", "HIP", ...
+  const char* space;
+
+  //! name of the allocation
+  const char* name;
+
+  const void* ptr;
+
+  size_t bytes;
+};
+
 template<typename Policy>
 PluginContext make_context()
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  PluginContext context{::RAJA::detail::get_platform<Policy>::value};
+  context.policy_name = typeid(Policy).name();
+  return context;
 }
 
+namespace detail
+{
+
+//! context of the pattern being launched by this thread, or nullptr
+inline const PluginContext*& active_context()
+{
+  static thread_local const PluginContext* context = nullptr;
+  return context;
+}
+
+//! makes a context active for the launch of a pattern, restoring the
+//! context of an enclosing pattern after
+class ActiveContext
+{
+  public:
+    explicit ActiveContext(const PluginContext& context)
+      : m_previous(active_context())
+    {
+      active_context() = &context;
+    }
+
+    ~ActiveContext() { active_context() = m_previous; }
+
+    ActiveContext(const ActiveContext&) = delete;
+    ActiveContext& operator=(const ActiveContext&) = delete;
+
+  private:
+    const PluginContext* m_previous;
+};
+
+//! called by the GPU back-ends when they launch a kernel
+template<typename DimType>
+inline void record_launch_geometry(const DimType& grid, const DimType& block,
+                                   size_t shmem)
+{
+  const PluginContext* context = active_context();
+  if (context != nullptr) {
+    context->grid.x = grid.x;
+    context->grid.y = grid.y;
+    context->grid.z = grid.z;
+    context->block.x = block.x;
+    context->block.y = block.y;
+    context->block.z = block.z;
+    context->shmem = shmem;
+  }
+}
+
+} // closing brace for detail namespace
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
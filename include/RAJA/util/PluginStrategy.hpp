@@ -32,6 +32,17 @@ class PluginStrategy
 
     virtual RAJASHAREDDLL_API void postLaunch(const PluginContext& p);
 
+    //! called around RAJA::synchronize
+    virtual RAJASHAREDDLL_API void preFence(const PluginContext& p);
+
+    virtual RAJASHAREDDLL_API void postFence(const PluginContext& p);
+
+    //! called when a RAJA memory pool allocates memory from its allocator,
+    //! with the pool mutex held, so a plugin must not allocate from RAJA pools
+    virtual RAJASHAREDDLL_API void allocateData(const PluginMemoryContext& p);
+
+    virtual RAJASHAREDDLL_API void deallocateData(const PluginMemoryContext& p);
+
     virtual RAJASHAREDDLL_API void finalize();
 };
 
@@ -0,0 +1,111 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with memory advice metadata for Views of managed
+ *          memory, used by the RAJA::prefetch and RAJA::advise methods of
+ *          the GPU back-ends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_Prefetch_HPP
+#define RAJA_util_Prefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Memory advice for the managed memory of a View, see
+ *        cudaMemAdvise and hipMemAdvise.
+ *
+ * PreferredLocation and AccessedBy refer to the device of the resource the
+ * advice is given with.
+ */
+enum class MemAdvice {
+  None,
+  ReadMostly,
+  PreferredLocation,
+  AccessedBy
+};
+
+/*!
+ * \brief A View of managed memory with the memory advice for its data.
+ *
+ * A ManagedView is used like the View it wraps; RAJA::advise and
+ * RAJA::prefetch apply its advice to the memory of the view.
+ *
+ *     auto v = RAJA::make_managed_view(
+ *         RAJA::View<double, RAJA::Layout<2>>(ptr, N, M),
+ *         RAJA::MemAdvice::ReadMostly);
+ */
+template <typename ViewType>
+struct ManagedView : public ViewType {
+  using view_type = ViewType;
+
+  MemAdvice advice = MemAdvice::None;
+
+  RAJA_HOST_DEVICE constexpr ManagedView(ViewType const& view,
+                                         MemAdvice advice_in)
+      : ViewType(view), advice(advice_in)
+  {
+  }
+};
+
+template <typename ViewType>
+RAJA_INLINE ManagedView<ViewType> make_managed_view(ViewType const& view,
+                                                    MemAdvice advice)
+{
+  return ManagedView<ViewType>(view, advice);
+}
+
+namespace detail
+{
+
+//! advice of a view, None if it is not a ManagedView
+template <typename ViewType>
+RAJA_INLINE constexpr MemAdvice get_mem_advice(ViewType const&)
+{
+  return MemAdvice::None;
+}
+
+template <typename ViewType>
+RAJA_INLINE constexpr MemAdvice get_mem_advice(ManagedView<ViewType> const& view)
+{
+  return view.advice;
+}
+
+//! first byte of the data of a view
+template <typename ViewType>
+RAJA_INLINE const void* view_data(ViewType const& view)
+{
+  return static_cast<const void*>(view.get_data());
+}
+
+//! number of bytes of the data of a view
+template <typename ViewType>
+RAJA_INLINE size_t view_bytes(ViewType const& view)
+{
+  return static_cast<size_t>(view.size()) *
+         sizeof(typename ViewType::value_type);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
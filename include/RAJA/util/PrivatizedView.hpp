@@ -0,0 +1,106 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a View wrapper that accumulates into
+ *          private copies of the View data.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PRIVATIZED_VIEW_HPP
+#define RAJA_PRIVATIZED_VIEW_HPP
+
+#include <utility>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Wrapper of a View for scatter-adds, an alternative to make_atomic_view
+ * for host policies. Each thread of the reduction policy adds into private
+ * copies of the View data with plain += and the copies are added to the
+ * View by merge(), which is also called when the last copy of the wrapper
+ * is destroyed.
+ *
+ * The private copies are allocated lazily in blocks of block_size
+ * elements, so threads that only touch part of the View only allocate
+ * those parts. The View data must be a plain pointer.
+ *
+ * \verbatim
+ *
+ *   auto priv = RAJA::make_privatized_view<RAJA::omp_reduce>(nodal);
+ *
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(elems, [=](int e) {
+ *     for (int n = 0; n < 8; ++n) {
+ *       priv(elem_to_node[8*e + n]) += elem_force[8*e + n];
+ *     }
+ *   });
+ *
+ *   priv.merge();
+ *
+ * \endverbatim
+ *
+ * The reduction policy selects the implementation, seq_reduce adds into the
+ * View directly.
+ */
+template <typename ViewType, typename ReducePolicy>
+struct PrivatizedViewWrapper;
+
+/*!
+ * Specialized PrivatizedViewWrapper for seq_reduce that acts as pass-thru
+ */
+template <typename ViewType>
+struct PrivatizedViewWrapper<ViewType, RAJA::seq_reduce> {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+
+  base_type base_;
+
+  RAJA_INLINE
+  explicit PrivatizedViewWrapper(ViewType const &view,
+                                 Index_type RAJA_UNUSED_ARG(block_size) = 0)
+      : base_{view}
+  {
+  }
+
+  template <typename... ARGS>
+  RAJA_INLINE auto operator()(ARGS &&... args) const
+      -> decltype(base_.operator()(std::forward<ARGS>(args)...))
+  {
+    return base_.operator()(std::forward<ARGS>(args)...);
+  }
+
+  //! nothing to merge, the adds went to the View
+  RAJA_INLINE void merge() const {}
+};
+
+
+template <typename ReducePolicy, typename ViewType>
+RAJA_INLINE PrivatizedViewWrapper<ViewType, ReducePolicy> make_privatized_view(
+    ViewType const &view,
+    Index_type block_size = 4096)
+{
+  return PrivatizedViewWrapper<ViewType, ReducePolicy>(view, block_size);
+}
+
+}  // namespace RAJA
+
+#endif
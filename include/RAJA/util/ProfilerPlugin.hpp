@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Profiler_Plugin_HPP
+#define RAJA_Profiler_Plugin_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * \brief Plugin that times each kernel launch and prints a table of the
+   *        kernels at finalize.
+   *
+   * Kernels are told apart by their RAJA::expt::KernelName parameter and
+   * platform.  Kernels on the host are timed with RAJA::TscTimer.  Kernels on
+   * CUDA and HIP streams are timed with a pair of events recorded on the
+   * stream, taken from a pool; the events are read when they complete, so
+   * timing does not synchronize the kernels.
+   *
+   * Setting RAJA_PROFILER_FILE writes the table to that file instead of
+   * stdout.
+   */
+  class ProfilerPlugin : public RAJA::util::PluginStrategy
+  {
+  public:
+    struct KernelStats {
+      std::string name;
+      Platform platform;
+      long long count;
+      long long iterations;
+      //! bytes declared with RAJA::expt::BytesMoved, summed over launches
+      long long bytes;
+      //! total, min and max time of a launch, in seconds
+      double total_time;
+      double min_time;
+      double max_time;
+    };
+
+    ProfilerPlugin();
+
+    ~ProfilerPlugin() override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! statistics of the kernels so far, waiting for all pending timings
+    std::vector<KernelStats> getStats();
+
+    //! forget the statistics so far
+    void reset();
+
+    //! the registered profiler plugin
+    static ProfilerPlugin* instance();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+  };  // end ProfilerPlugin class
+
+  void linkProfilerPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,126 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for RAJA::ReadOnlyPointer, a View pointer type that
+ *          loads through the GPU read-only data cache.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReadOnlyPointer_HPP
+#define RAJA_util_ReadOnlyPointer_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! the arithmetic types __ldg has overloads for
+template <typename T>
+struct is_ldg_type
+    : std::integral_constant<
+          bool,
+          std::is_same<T, float>::value || std::is_same<T, double>::value ||
+              (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+               !std::is_same<T, wchar_t>::value &&
+               !std::is_same<T, char16_t>::value &&
+               !std::is_same<T, char32_t>::value)> {
+};
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T read_only_load(T const* RAJA_RESTRICT ptr,
+                                         std::true_type)
+{
+  return __ldg(ptr);
+}
+
+template <typename T>
+RAJA_DEVICE RAJA_INLINE T read_only_load(T const* RAJA_RESTRICT ptr,
+                                         std::false_type)
+{
+  return *ptr;
+}
+#endif
+
+/*!
+ * Load *ptr, through the read-only data cache in device code when the type
+ * is supported by __ldg.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE T read_only_load(T const* RAJA_RESTRICT ptr)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return read_only_load(ptr, is_ldg_type<T>{});
+#else
+  return *ptr;
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Pointer to data that is not written while it is read through it.
+ *
+ * Indexing returns the element by value. In CUDA and HIP device code
+ * arithmetic elements are loaded with __ldg, which uses the read-only (or
+ * texture) data cache on GPUs where it is separate from L1, and the pointer
+ * is marked restrict so the compiler may hoist and batch loads. This helps
+ * irregular gathers, e.g. a View indexed by the values of a ListSegment.
+ *
+ * The data must not be modified through any other pointer while a kernel
+ * reads it through a ReadOnlyPointer. Use it through RAJA::ReadOnlyView.
+ */
+template <typename T>
+class ReadOnlyPointer
+{
+public:
+  using element_type = T const;
+  using value_type = typename std::remove_cv<T>::type;
+
+  RAJA_HOST_DEVICE constexpr ReadOnlyPointer() : m_ptr{nullptr} {}
+
+  RAJA_HOST_DEVICE constexpr ReadOnlyPointer(T const* ptr) : m_ptr{ptr} {}
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type operator[](IdxT i) const
+  {
+    return detail::read_only_load(m_ptr + i);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE value_type operator*() const
+  {
+    return detail::read_only_load(m_ptr);
+  }
+
+  //! the underlying pointer
+  RAJA_HOST_DEVICE constexpr T const* get() const { return m_ptr; }
+
+  RAJA_HOST_DEVICE constexpr explicit operator bool() const
+  {
+    return m_ptr != nullptr;
+  }
+
+private:
+  T const* RAJA_RESTRICT m_ptr;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
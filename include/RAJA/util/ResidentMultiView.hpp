@@ -0,0 +1,171 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a MultiView whose pointer table is kept
+ *          in the memory of a camp resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ResidentMultiView_HPP
+#define RAJA_ResidentMultiView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class ResidentMultiView
+ *
+ * \brief  Owner of a MultiView pointer table kept in the memory of a camp
+ *         resource, copied there only when a pointer changes.
+ *
+ * A MultiView indexes an array of pointers that must be readable where the
+ * kernel runs. A ResidentMultiView keeps a host copy of the table and one
+ * allocated with a resource, and copies the host table to the resource only
+ * after set_data changed it, so many kernels over the same arrays never
+ * copy the table again. The MultiViews it returns are cheap to capture, they
+ * hold the layout and the pointer to the resident table.
+ *
+ * Each access through a MultiView loads the array pointer from the table.
+ * When the array is known where the kernel is written, getView returns a
+ * plain View of that array, which avoids the load.
+ *
+ * The arrays must outlive the views. The resident table is rebuilt lazily
+ * and is not thread-safe to rebuild concurrently.
+ *
+ * Usage:
+ *
+ * \verbatim
+ *
+ *   ResidentMultiView<double, Layout<1>> fields(ptrs, num_fields,
+ *                                               Layout<1>(len), cuda_res);
+ *
+ *   auto mv = fields.view();
+ *   forall<cuda_exec<256>>(cuda_res, range, [=] RAJA_DEVICE (int i) {
+ *     for (int f = 0; f < num_fields; ++f) {
+ *       mv(f, i) *= 2.0;
+ *     }
+ *   });
+ *
+ *   auto density = fields.getView(0);
+ *   forall<cuda_exec<256>>(cuda_res, range, [=] RAJA_DEVICE (int i) {
+ *     density(i) += 1.0;
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ValueType, typename LayoutType, RAJA::Index_type P2Pidx = 0>
+class ResidentMultiView
+{
+public:
+  using value_type = ValueType;
+  using layout_type = LayoutType;
+  using multi_view_type = MultiView<ValueType, LayoutType, P2Pidx>;
+  using view_type = View<ValueType, LayoutType>;
+
+  /*!
+   * \brief Track the num_arrays pointers of ptrs, with the resident table
+   *        allocated with resource.
+   */
+  ResidentMultiView(ValueType* const* ptrs,
+                    size_t num_arrays,
+                    LayoutType const& layout,
+                    camp::resources::Resource resource)
+      : m_layout(layout),
+        m_resource(resource),
+        m_host(ptrs, ptrs + num_arrays)
+  {
+  }
+
+  //! The resident table is owned, so copies are not allowed
+  ResidentMultiView(ResidentMultiView const&) = delete;
+  ResidentMultiView& operator=(ResidentMultiView const&) = delete;
+
+  //! Free the resident table
+  ~ResidentMultiView()
+  {
+    if (m_resident != nullptr) {
+      m_resource.deallocate(m_resident);
+    }
+  }
+
+  //! Return the number of arrays
+  size_t getNumArrays() const { return m_host.size(); }
+
+  //! Return the pointer to array i
+  ValueType* getData(size_t i) const { return m_host[i]; }
+
+  //! Set the pointer to array i, the resident table is updated on next use
+  void set_data(size_t i, ValueType* ptr)
+  {
+    if (m_host[i] != ptr) {
+      m_host[i] = ptr;
+      m_dirty = true;
+    }
+  }
+
+  /*!
+   * \brief Get a MultiView over the resident table, first copying the table
+   *        to the resource if a pointer changed since the last copy.
+   */
+  multi_view_type view()
+  {
+    if (m_resident == nullptr && !m_host.empty()) {
+      m_resident = m_resource.allocate<ValueType*>(m_host.size());
+      m_dirty = true;
+    }
+    if (m_dirty && m_resident != nullptr) {
+      m_resource.memcpy(m_resident,
+                        m_host.data(),
+                        m_host.size() * sizeof(ValueType*));
+      // the host table may change again before an async copy ends
+      m_resource.wait();
+      m_dirty = false;
+    }
+    return multi_view_type(m_resident, LayoutType(m_layout));
+  }
+
+  //! Get a View of array i, indexed without the table
+  view_type getView(size_t i) const
+  {
+    return view_type(m_host[i], LayoutType(m_layout));
+  }
+
+private:
+  LayoutType m_layout;
+
+  camp::resources::Resource m_resource;
+
+  std::vector<ValueType*> m_host;
+
+  ValueType** m_resident = nullptr;
+
+  bool m_dirty = true;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
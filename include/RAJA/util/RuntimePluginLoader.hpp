@@ -34,6 +34,14 @@ namespace util {
 
     void postLaunch(const RAJA::util::PluginContext& p) override;
 
+    void preFence(const RAJA::util::PluginContext& p) override;
+
+    void postFence(const RAJA::util::PluginContext& p) override;
+
+    void allocateData(const RAJA::util::PluginMemoryContext& p) override;
+
+    void deallocateData(const RAJA::util::PluginMemoryContext& p) override;
+
     void finalize() override;
 
   private:
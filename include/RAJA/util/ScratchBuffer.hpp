@@ -0,0 +1,222 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with ScratchBuffer, temporary storage bound to the
+ *          stream of a resource that the scans and sorts of the GPU
+ *          back-ends reuse between calls.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ScratchBuffer_HPP
+#define RAJA_util_ScratchBuffer_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "camp/resource.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Device storage of a ScratchBuffer and the temporary storage sizes
+ *        of the calls that used it.
+ */
+class ScratchStorage
+{
+public:
+  //! number of call sizes remembered, the oldest is forgotten first
+  static constexpr size_t max_sizes = 16;
+
+  explicit ScratchStorage(camp::resources::Resource res) : m_res(res) {}
+
+  ScratchStorage(ScratchStorage const&) = delete;
+  ScratchStorage& operator=(ScratchStorage const&) = delete;
+
+  ~ScratchStorage() { release(); }
+
+  //! true and bytes set if a call of type key with sizes n, m ran before
+  bool find(void const* key, size_t n, size_t m, size_t& bytes) const
+  {
+    for (Size const& s : m_sizes) {
+      if (s.key == key && s.n == n && s.m == m) {
+        bytes = s.bytes;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! remember the bytes a call of type key with sizes n, m needs
+  void record(void const* key, size_t n, size_t m, size_t bytes)
+  {
+    if (m_sizes.size() == max_sizes) {
+      m_sizes.erase(m_sizes.begin());
+    }
+    m_sizes.push_back(Size{key, n, m, bytes});
+  }
+
+  //! storage of at least bytes bytes, grown if needed
+  void* reserve(size_t bytes)
+  {
+    if (bytes > m_capacity) {
+      release();
+      m_ptr = m_res.allocate<unsigned char>(bytes);
+      m_capacity = bytes;
+    }
+    return m_ptr;
+  }
+
+  size_t capacity() const { return m_capacity; }
+
+  //! free the storage after the work enqueued on the resource
+  void release()
+  {
+    if (m_ptr != nullptr) {
+      m_res.wait();
+      m_res.deallocate(m_ptr);
+      m_ptr = nullptr;
+      m_capacity = 0;
+    }
+  }
+
+private:
+  struct Size {
+    void const* key;
+    size_t n;
+    size_t m;
+    size_t bytes;
+  };
+
+  camp::resources::Resource m_res;
+  void* m_ptr = nullptr;
+  size_t m_capacity = 0;
+  std::vector<Size> m_sizes;
+};
+
+inline std::mutex& scratch_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
+//! ScratchStorage bound to each stream
+inline std::unordered_map<void const*, ScratchStorage*>& scratch_registry()
+{
+  static std::unordered_map<void const*, ScratchStorage*> registry;
+  return registry;
+}
+
+//! ScratchStorage bound to stream, or nullptr
+inline ScratchStorage* find_scratch(void const* stream)
+{
+  std::lock_guard<std::mutex> lock(scratch_mutex());
+  auto it = scratch_registry().find(stream);
+  return it != scratch_registry().end() ? it->second : nullptr;
+}
+
+//! bind storage to stream, returns the storage bound before
+inline ScratchStorage* bind_scratch(void const* stream, ScratchStorage* storage)
+{
+  std::lock_guard<std::mutex> lock(scratch_mutex());
+  auto& registry = scratch_registry();
+  auto it = registry.find(stream);
+  ScratchStorage* previous = it != registry.end() ? it->second : nullptr;
+  if (storage != nullptr) {
+    registry[stream] = storage;
+  } else if (it != registry.end()) {
+    registry.erase(it);
+  }
+  return previous;
+}
+
+//! address identifying the calls of type Call, whose sizes are remembered
+template <typename Call>
+inline void const* scratch_key()
+{
+  static const char key = 0;
+  return &key;
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Temporary storage for the scans, sorts and compactions of the GPU
+ *        back-ends, bound to the stream of a resource while it lives.
+ *
+ * Calls on a resource with the stream of res take their cub or rocPRIM
+ * temporary storage from the buffer instead of allocating and freeing it,
+ * and the buffer grows to the largest size needed, so it stops allocating
+ * after the first calls. The size each kind of call needed for its lengths
+ * is remembered, so repeating a call skips the size query of cub or rocPRIM
+ * and only launches the kernels.
+ *
+ * Calls that use the buffer are ordered by the stream, so one buffer per
+ * stream is enough. Binding a second buffer to a stream hides the first
+ * until the second is destroyed. Calls must not be made on the stream from
+ * several host threads at once while a buffer is bound.
+ *
+ * \verbatim
+ *
+ *   RAJA::resources::Cuda res;
+ *   RAJA::expt::ScratchBuffer<RAJA::resources::Cuda> scratch(res);
+ *   for (int step = 0; step < num_steps; ++step) {
+ *     RAJA::inclusive_scan<RAJA::cuda_exec<256>>(res, in, out);
+ *   }
+ *
+ * \endverbatim
+ */
+template <typename Res>
+class ScratchBuffer
+{
+public:
+  explicit ScratchBuffer(Res res)
+      : m_stream(res.get_stream()), m_storage(camp::resources::Resource{res})
+  {
+    m_previous = detail::bind_scratch(m_stream, &m_storage);
+  }
+
+  ScratchBuffer(ScratchBuffer const&) = delete;
+  ScratchBuffer& operator=(ScratchBuffer const&) = delete;
+
+  ~ScratchBuffer() { detail::bind_scratch(m_stream, m_previous); }
+
+  //! bytes of device storage the buffer holds
+  size_t capacity() const { return m_storage.capacity(); }
+
+  //! allocate bytes of storage now, before the first call needs it
+  void reserve(size_t bytes) { m_storage.reserve(bytes); }
+
+private:
+  void const* m_stream;
+  detail::ScratchStorage m_storage;
+  detail::ScratchStorage* m_previous = nullptr;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,9 @@
 
 #include "RAJA/config.hpp"
 
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
 // for RAJA::reduce::detail::ValueLoc
 #include "RAJA/pattern/detail/reduce.hpp"
 
@@ -48,6 +51,42 @@ private:
   value_type mem[size];
 };
 
+/*!
+ * @brief Specialization for camp::tuple, with one array per tuple element.
+ */
+template <typename... Ts, size_t size>
+class SoAArray<camp::tuple<Ts...>, size>
+{
+  using value_type = camp::tuple<Ts...>;
+  using index_seq = camp::make_idx_seq_t<sizeof...(Ts)>;
+
+public:
+  RAJA_HOST_DEVICE value_type get(size_t i) const
+  {
+    return get_impl(i, index_seq{});
+  }
+  RAJA_HOST_DEVICE void set(size_t i, value_type val)
+  {
+    set_impl(i, val, index_seq{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE value_type get_impl(size_t i, camp::idx_seq<Is...>) const
+  {
+    return value_type(camp::get<Is>(mem).get(i)...);
+  }
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void set_impl(size_t i,
+                                 value_type const& val,
+                                 camp::idx_seq<Is...>)
+  {
+    camp::sink((camp::get<Is>(mem).set(i, camp::get<Is>(val)), 0)...);
+  }
+
+  camp::tuple<SoAArray<Ts, size>...> mem;
+};
+
 /*!
  * @brief Specialization for RAJA::reduce::detail::ValueLoc.
  */
@@ -61,17 +100,17 @@ class SoAArray< ::RAJA::reduce::detail::ValueLoc<T, IndexType, doing_min>, size>
 public:
   RAJA_HOST_DEVICE value_type get(size_t i) const
   {
-    return value_type(mem[i], mem_idx[i]);
+    return value_type(mem[i], mem_idx.get(i));
   }
   RAJA_HOST_DEVICE void set(size_t i, value_type val)
   {
     mem[i] = val;
-    mem_idx[i] = val.getLoc();
+    mem_idx.set(i, val.getLoc());
   }
 
 private:
   first_type mem[size];
-  second_type mem_idx[size];
+  SoAArray<second_type, size> mem_idx;
 };
 
 }  // namespace detail
@@ -0,0 +1,251 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for RAJA::SoAView, a view of a struct stored as one
+ *          array per field.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_SoAView_HPP
+#define RAJA_util_SoAView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief A field of the struct of a SoAView, given by its member pointer.
+ *
+ * Use the RAJA_SOA_FIELD macro to name a field:
+ *
+ *     RAJA_SOA_FIELD(Particle, x)
+ */
+template <typename MemberPtr, MemberPtr member_ptr>
+struct SoAField;
+
+template <typename Struct, typename T, T Struct::*member_ptr>
+struct SoAField<T Struct::*, member_ptr> {
+  using struct_type = Struct;
+  using value_type = T;
+
+  RAJA_HOST_DEVICE static constexpr T Struct::*member() { return member_ptr; }
+};
+
+#define RAJA_SOA_FIELD(Struct, member) \
+  ::RAJA::SoAField<decltype(&Struct::member), &Struct::member>
+
+template <typename Struct, typename... Fields>
+class SoAView;
+
+/*!
+ * \brief Reference to element i of a SoAView.
+ *
+ * Converting it to the struct loads every field and assigning a struct
+ * stores every field, so a kernel written for an array of structs
+ *
+ *     Particle p = parts[i];
+ *     p.x += dt * p.vx;
+ *     parts[i] = p;
+ *
+ * keeps working on the struct of arrays. Compilers drop the loads of the
+ * fields the kernel does not use. A single field is read or written in
+ * place with operator->* and the member pointer, or with field<I>():
+ *
+ *     parts[i]->*&Particle::x += dt * (parts[i]->*&Particle::vx);
+ */
+template <typename Struct, typename... Fields>
+class SoARef
+{
+  using view_type = SoAView<Struct, Fields...>;
+  using index_seq = camp::make_idx_seq_t<sizeof...(Fields)>;
+
+public:
+  RAJA_HOST_DEVICE constexpr SoARef(view_type const& view, Index_type i)
+      : m_view{view}, m_i{i}
+  {
+  }
+
+  //! load all fields into a struct
+  RAJA_HOST_DEVICE RAJA_INLINE operator Struct() const
+  {
+    Struct s{};
+    load(s, index_seq{});
+    return s;
+  }
+
+  //! store all fields of s
+  RAJA_HOST_DEVICE RAJA_INLINE SoARef const& operator=(Struct const& s) const
+  {
+    store(s, index_seq{});
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE SoARef const& operator=(SoARef const& other) const
+  {
+    return *this = static_cast<Struct>(other);
+  }
+
+  //! reference to field I
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE
+      typename camp::at_v<camp::list<Fields...>, I>::value_type&
+      field() const
+  {
+    return m_view.template get<I>()[m_i];
+  }
+
+  /*!
+   * Reference to the field of member m, which must be one of the fields of
+   * the view. m is compared to the members of the fields of its type, the
+   * compares fold away when m is a constant.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE RAJA_INLINE T& operator->*(T Struct::*m) const
+  {
+    static_assert(
+        concepts::any_of<
+            std::is_same<typename Fields::value_type, T>...>::value,
+        "SoARef::operator->* member type is not the type of a field");
+    T* ptr = nullptr;
+    find(ptr, m, index_seq{});
+    return *ptr;
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void load(Struct& s, camp::idx_seq<Is...>) const
+  {
+    camp::sink((s.*(Fields::member()) = m_view.template get<Is>()[m_i])...);
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void store(Struct const& s,
+                                          camp::idx_seq<Is...>) const
+  {
+    camp::sink((m_view.template get<Is>()[m_i] = s.*(Fields::member()))...);
+  }
+
+  template <typename T, camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void find(T*& ptr,
+                                         T Struct::*m,
+                                         camp::idx_seq<Is...>) const
+  {
+    camp::sink(match(ptr, m, m_view.template get<Is>(), Fields::member())...);
+  }
+
+  template <typename T>
+  RAJA_HOST_DEVICE RAJA_INLINE int match(T*& ptr,
+                                         T Struct::*m,
+                                         T* field_ptr,
+                                         T Struct::*field_member) const
+  {
+    if (m == field_member) {
+      ptr = field_ptr + m_i;
+    }
+    return 0;
+  }
+  ///
+  template <typename T, typename U>
+  RAJA_HOST_DEVICE RAJA_INLINE int match(T*&,
+                                         T Struct::*,
+                                         U*,
+                                         U Struct::*) const
+  {
+    return 0;
+  }
+
+  view_type m_view;
+  Index_type m_i;
+};
+
+/*!
+ * \brief View of a struct stored as a struct of arrays, one array per field.
+ *
+ * The view does not own the arrays, like RAJA::View it is a pointer that is
+ * captured by value in kernels:
+ *
+ *     struct Particle { double x, vx; int id; };
+ *     using ParticleView = RAJA::SoAView<Particle,
+ *                                        RAJA_SOA_FIELD(Particle, x),
+ *                                        RAJA_SOA_FIELD(Particle, vx),
+ *                                        RAJA_SOA_FIELD(Particle, id)>;
+ *     ParticleView parts(x, vx, id);
+ *
+ * parts[i] is a SoARef, consecutive i access consecutive elements of each
+ * array, which coalesces on GPUs and vectorizes on CPUs.
+ */
+template <typename Struct, typename... Fields>
+class SoAView
+{
+  static_assert(sizeof...(Fields) > 0, "SoAView needs at least one field");
+  static_assert(concepts::all_of<
+                    std::is_same<typename Fields::struct_type, Struct>...>::value,
+                "SoAView fields must be members of Struct");
+
+public:
+  using value_type = Struct;
+  using reference = SoARef<Struct, Fields...>;
+
+  RAJA_HOST_DEVICE constexpr SoAView() : m_ptrs{} {}
+
+  RAJA_HOST_DEVICE constexpr SoAView(typename Fields::value_type*... ptrs)
+      : m_ptrs{ptrs...}
+  {
+  }
+
+  static constexpr camp::idx_t num_fields = sizeof...(Fields);
+
+  //! the array of field I
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE
+      typename camp::at_v<camp::list<Fields...>, I>::value_type*
+      get() const
+  {
+    return camp::get<I>(m_ptrs);
+  }
+
+  //! point the view at another array for field I
+  template <camp::idx_t I>
+  RAJA_HOST_DEVICE RAJA_INLINE void set_data(
+      typename camp::at_v<camp::list<Fields...>, I>::value_type* ptr)
+  {
+    camp::get<I>(m_ptrs) = ptr;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE reference operator[](Index_type i) const
+  {
+    return reference(*this, i);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE reference operator()(Index_type i) const
+  {
+    return reference(*this, i);
+  }
+
+private:
+  camp::tuple<typename Fields::value_type*...> m_ptrs;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,146 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with StagingPool, a pool of pinned host buffers for
+ *          asynchronous copies to and from the GPU back-ends, and
+ *          memcpy_async.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_StagingPool_HPP
+#define RAJA_util_StagingPool_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Allocator of the staging buffers for resources of type Res, the
+ *        back-ends with pinned memory specialize it. Others stage through
+ *        malloc'd host memory.
+ */
+template <typename Res>
+struct staging_allocator {
+  using type = basic_mempool::generic_allocator;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Pool of host buffers to stage copies to and from the memory of
+ *        resources of type Res, pinned on the Cuda and Hip back-ends.
+ *
+ * Copies from pinned memory are asynchronous and run at full bandwidth,
+ * while copies from pageable memory block the host and go through a driver
+ * buffer. The buffers come from a basic_mempool::MemPool of their own, so
+ * after the first allocations no pinned memory is allocated or registered
+ * per transfer, and staging does not fragment the pools of the reducers.
+ * Copies of a StagingPool share the same buffers.
+ *
+ * A buffer must not be deallocated while a copy from or to it is running,
+ * wait for the resource of the copy first.
+ *
+ * \verbatim
+ *
+ *   RAJA::expt::StagingPool<RAJA::resources::Cuda> staging;
+ *   double* h = staging.allocate<double>(n);
+ *   fill(h, n);
+ *   RAJA::memcpy_async(res, d, h, n * sizeof(double));
+ *   ...
+ *   res.wait();
+ *   staging.deallocate(h);
+ *
+ * \endverbatim
+ */
+template <typename Res>
+class StagingPool
+{
+public:
+  using allocator_type = typename detail::staging_allocator<Res>::type;
+  using mempool_type = basic_mempool::MemPool<allocator_type>;
+
+  //! alignment of the buffers, enough for the vector copies of the drivers
+  static constexpr size_t alignment = 256;
+
+  //! buffer of nTs items of type T
+  template <typename T>
+  T* allocate(size_t nTs)
+  {
+    return mempool_type::getInstance().template malloc<T>(nTs, alignment);
+  }
+
+  //! return a buffer to the pool, copies using it must have completed
+  void deallocate(const void* ptr) { mempool_type::getInstance().free(ptr); }
+
+  //! make sure nbytes can be allocated without growing the pool
+  bool reserve(size_t nbytes)
+  {
+    return mempool_type::getInstance().reserve(nbytes);
+  }
+
+  //! bytes of pinned memory allocated each time the pool grows
+  size_t arena_size() { return mempool_type::getInstance().arena_size(); }
+
+  size_t arena_size(size_t new_size)
+  {
+    return mempool_type::getInstance().arena_size(new_size);
+  }
+
+  basic_mempool::MemPoolStats stats()
+  {
+    return mempool_type::getInstance().stats();
+  }
+
+  //! free the memory of the pool, no buffer may be in use
+  void release() { mempool_type::getInstance().free_chunks(); }
+};
+
+}  // namespace expt
+
+/*!
+ * \brief Copy bytes from src to dst in the order of the work enqueued on
+ *        res, without waiting for the copy.
+ *
+ * The copy is asynchronous on the GPU back-ends when the host side is
+ * pinned memory, e.g. from an expt::StagingPool. The direction is deduced
+ * from the pointers. Wait on res or on the returned event before reading
+ * dst on the host or reusing src.
+ */
+template <typename Res>
+RAJA_INLINE resources::EventProxy<Res> memcpy_async(Res res,
+                                                    void* dst,
+                                                    const void* src,
+                                                    size_t bytes)
+{
+  if (bytes > 0) {
+    res.memcpy(dst, src, bytes);
+  }
+  return resources::EventProxy<Res>(res);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -247,6 +247,12 @@ struct StaticLayoutBase_impl<IdxLin,
     return InnerLayout::s_oper(stripIndexType(indices)...);
   }
 
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear operator()(
+      DimTypes... indices) const
+  {
+    return s_oper(indices...);
+  }
+
 
   static constexpr IndexLinear s_size = InnerLayout::s_size;
   static constexpr IndexLinear s_size_noproj = InnerLayout::s_size_noproj;
@@ -266,7 +272,7 @@ struct StaticLayoutBase_impl<IdxLin,
   RAJA_HOST_DEVICE
   constexpr
   IndexLinear get_dim_stride() const {
-    return InnerLayout{}.get_dim_stride();
+    return InnerLayout{}.template get_dim_stride<DIM>();
   }
 
   template<camp::idx_t DIM>
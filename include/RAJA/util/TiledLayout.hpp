@@ -0,0 +1,270 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining TiledLayout, a N-dimensional index
+ *          calculator that stores the index space in fixed size tiles.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_TiledLayout_HPP
+#define RAJA_util_TiledLayout_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/FastDivmod.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Range, typename IdxLin, camp::idx_t... TileSizes>
+struct TiledLayoutBase_impl;
+
+/*!
+ * Stride of dimension dim inside a row-major tile, the product of the tile
+ * sizes of the dimensions after dim.
+ */
+template <camp::idx_t... TileSizes>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr camp::idx_t tile_inner_stride(
+    camp::idx_t dim)
+{
+  camp::idx_t const tile_sizes[] = {TileSizes...};
+  camp::idx_t stride = 1;
+  for (camp::idx_t d = camp::idx_t(sizeof...(TileSizes)) - 1; d > dim; --d) {
+    stride *= tile_sizes[d];
+  }
+  return stride;
+}
+
+template <camp::idx_t... RangeInts, typename IdxLin, camp::idx_t... TileSizes>
+struct TiledLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, TileSizes...> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  // tiles are not contiguous in any dimension
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  static_assert(n_dims == sizeof...(TileSizes),
+                "number of tile sizes must match number of dimensions");
+  static_assert(RAJA::min<camp::idx_t>(TileSizes...) > 0,
+                "tile sizes must be positive");
+
+  //! number of elements in a tile
+  static constexpr IdxLin s_tile_volume = RAJA::product<IdxLin>(TileSizes...);
+
+  IdxLin sizes[n_dims] = {0};
+  IdxLin num_tiles[n_dims] = {0};
+  IdxLin tile_strides[n_dims] = {0};
+  // precomputed divisions used by toIndices
+  FastDivmod<IdxLin> div_tile_strides[n_dims] = {};
+  FastDivmod<IdxLin> div_num_tiles[n_dims] = {};
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE TiledLayoutBase_impl() = default;
+  constexpr RAJA_INLINE TiledLayoutBase_impl(TiledLayoutBase_impl const &) =
+      default;
+  constexpr RAJA_INLINE TiledLayoutBase_impl(TiledLayoutBase_impl &&) =
+      default;
+  RAJA_INLINE TiledLayoutBase_impl &operator=(TiledLayoutBase_impl const &) =
+      default;
+  RAJA_INLINE TiledLayoutBase_impl &operator=(TiledLayoutBase_impl &&) =
+      default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   *
+   * Each dimension is padded up to a multiple of its tile size.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayoutBase_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        num_tiles{((RAJA::max<IdxLin>(sizes[RangeInts], IdxLin(1)) +
+                    IdxLin(TileSizes) - IdxLin(1)) /
+                   IdxLin(TileSizes))...},
+        tile_strides{(detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
+            s_tile_volume, num_tiles))...},
+        div_tile_strides{FastDivmod<IdxLin>(tile_strides[RangeInts])...},
+        div_num_tiles{FastDivmod<IdxLin>(num_tiles[RangeInts])...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N), static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This is the offset of the index's tile plus its row-major offset inside
+   * the tile.  The tile sizes are compile time constants, so the divisions
+   * and remainders by them are cheap.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin
+  operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(stripIndexType(indices)...);
+#endif
+    return sum<IdxLin>(
+        (IdxLin(stripIndexType(indices) / TileSizes) * tile_strides[RangeInts] +
+         IdxLin(stripIndexType(indices) % TileSizes) *
+             IdxLin(tile_inner_stride<TileSizes...>(RangeInts)))...);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    IdxLin inner = linear_index % s_tile_volume;
+    camp::sink((indices = (camp::decay<Indices>)(
+                    div_num_tiles[RangeInts].mod(
+                        div_tile_strides[RangeInts].div(linear_index)) *
+                        IdxLin(TileSizes) +
+                    (inner / IdxLin(tile_inner_stride<TileSizes...>(RangeInts))) %
+                        IdxLin(TileSizes)))...);
+  }
+
+  /*!
+   * Computes the size of the layout's linear space, which includes the
+   * padding of each dimension up to a whole number of tiles.
+   * This is the number of elements that must be allocated for a View.
+   *
+   * @return Total size spanned by the linear indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return tile_strides[0] * num_tiles[0];
+  }
+
+  /*!
+   * Computes a total size of the layout's index space, without padding.
+   * This is the produce of each dimensions size.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size_noproj() const
+  {
+    return foldl(RAJA::operators::multiplies<IdxLin>(), sizes[RangeInts]...);
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_size() const
+  {
+    return sizes[DIM];
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_begin() const
+  {
+    return 0;
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin, camp::idx_t... TileSizes>
+constexpr size_t TiledLayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                      IdxLin,
+                                      TileSizes...>::n_dims;
+template <camp::idx_t... RangeInts, typename IdxLin, camp::idx_t... TileSizes>
+constexpr IdxLin TiledLayoutBase_impl<camp::idx_seq<RangeInts...>,
+                                      IdxLin,
+                                      TileSizes...>::s_tile_volume;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space
+ * stored in tiles, or bricks, of TileSizes... elements.
+ *
+ * The tiles are laid out in row-major order, and so are the elements inside
+ * each tile, so all of the elements of a tile are contiguous.  Stencils that
+ * touch a neighborhood of an index then touch far fewer cache lines and
+ * pages than with a strided Layout.
+ *
+ * For example:
+ *
+ *     // 3-d layout of 4x4x4 bricks
+ *     TiledLayout<3, 4, 4, 4> layout(10, 12, 16);
+ *
+ *     // Allocate the padded linear space and use it with a View
+ *     double* data = new double[layout.size()];   // 12*12*16 elements
+ *     View<double, TiledLayout<3, 4, 4, 4>> v(data, layout);
+ *
+ *     v(5, 6, 7) = 1.0;
+ *
+ * Each dimension is padded up to a whole number of tiles, so size() is the
+ * number of elements to allocate.  Projected dimensions are not supported.
+ * See RAJA::make_tiled_view to make both at once.
+ */
+template <size_t n_dims, camp::idx_t... TileSizes>
+using TiledLayout = detail::TiledLayoutBase_impl<camp::make_idx_seq_t<n_dims>,
+                                                 Index_type,
+                                                 TileSizes...>;
+
+template <size_t n_dims, typename IdxLin, camp::idx_t... TileSizes>
+using TiledLayoutT = detail::TiledLayoutBase_impl<camp::make_idx_seq_t<n_dims>,
+                                                  IdxLin,
+                                                  TileSizes...>;
+
+}  // namespace RAJA
+
+#endif
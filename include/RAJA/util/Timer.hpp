@@ -22,10 +22,21 @@
 
 #include "RAJA/config.hpp"
 
+#include <chrono>
+#include <cstdint>
+
 #if defined(RAJA_USE_CALIPER)
 #include <caliper/Annotation.h>
 #endif
 
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
 
 // libstdc++ on BGQ only has gettimeofday for some reason
 #if defined(__bgq__) && (!defined(_LIBCPP_VERSION))
@@ -273,6 +284,109 @@ public:
 #endif
 };
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Timer class that reads the cpu time stamp counter, rdtsc on x86
+ *         and cntvct_el0 on aarch64, without a system call. Other platforms
+ *         use std::chrono::steady_clock.
+ *
+ *         The counter frequency is read on aarch64 and calibrated against
+ *         steady_clock once per process on x86, which assumes an invariant
+ *         time stamp counter, as on current x86 processors.
+ *
+ *         Generates elapsed time in seconds.
+ *
+ ******************************************************************************
+ */
+class TscTimer
+{
+public:
+  using ElapsedType = double;
+
+  TscTimer() : tstart(read_counter()), telapsed(0) {}
+
+  void start() { tstart = read_counter(); }
+
+  void stop()
+  {
+    std::uint64_t tstop = read_counter();
+    telapsed += static_cast<ElapsedType>(tstop - tstart) / ticks_per_second();
+  }
+
+  ElapsedType elapsed() const { return telapsed; }
+
+  void reset() { telapsed = 0; }
+
+  //! Read the counter
+  static std::uint64_t read_counter()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    std::uint64_t ticks;
+    asm volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+  }
+
+  //! Frequency of the counter in ticks per second
+  static ElapsedType ticks_per_second()
+  {
+    static const ElapsedType frequency = calibrate();
+    return frequency;
+  }
+
+private:
+  static ElapsedType calibrate()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    using ClockType = std::chrono::steady_clock;
+    const ClockType::time_point cstart = ClockType::now();
+    const std::uint64_t ticks_start = read_counter();
+    ClockType::time_point cstop = cstart;
+    while (cstop - cstart < std::chrono::milliseconds(10)) {
+      cstop = ClockType::now();
+    }
+    const std::uint64_t ticks_stop = read_counter();
+    return static_cast<ElapsedType>(ticks_stop - ticks_start) /
+           std::chrono::duration<ElapsedType>(cstop - cstart).count();
+#elif defined(__aarch64__)
+    std::uint64_t frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+    return static_cast<ElapsedType>(frequency);
+#else
+    return 1.0e9;
+#endif
+  }
+
+  std::uint64_t tstart;
+  ElapsedType telapsed;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Timer class that records events on the stream of a GPU resource,
+ *         specialized for the Cuda and Hip resources.
+ *
+ *         start() and stop() only record events, so timing a kernel does not
+ *         synchronize the device. The elapsed time of the recorded intervals
+ *         is resolved when elapsed() is called, which waits for the last
+ *         recorded events only, and ready() tells if it would wait.
+ *
+ *         Generates elapsed time in seconds.
+ *
+ ******************************************************************************
+ */
+template <typename Resource>
+class DeviceTimer;
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
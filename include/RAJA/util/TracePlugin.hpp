@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Trace_Plugin_HPP
+#define RAJA_Trace_Plugin_HPP
+
+#include <memory>
+#include <string>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * \brief Plugin that marks every RAJA pattern with a trace range.
+   *
+   * The plugin does nothing unless the environment variable RAJA_TRACE is
+   * set, to a comma separated list of:
+   *
+   *   nvtx    NVTX ranges, when RAJA is built with RAJA_ENABLE_NV_TOOLS_EXT
+   *   roctx   ROCTX ranges, when RAJA is built with RAJA_ENABLE_ROCTX
+   *   chrome  a Chrome trace (JSON) of the launches, readable by Perfetto
+   *           and chrome://tracing, written at finalize to RAJA_TRACE_FILE
+   *           or raja-trace.json
+   *
+   * Ranges are named "kernel_name [policy]" and nest like the patterns
+   * that launch them.  NVTX ranges carry the iteration count as payload;
+   * Chrome trace events have the policy and iteration count as arguments.
+   */
+  class TracePlugin : public RAJA::util::PluginStrategy
+  {
+  public:
+    TracePlugin();
+
+    ~TracePlugin() override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! enable outputs as RAJA_TRACE does, e.g. "nvtx,chrome"; "" disables
+    void setOutputs(const std::string& outputs);
+
+    //! write the Chrome trace recorded so far to path
+    void writeChromeTrace(const std::string& path);
+
+    //! the registered trace plugin
+    static TracePlugin* instance();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+  };  // end TracePlugin class
+
+  void linkTracePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -31,6 +31,9 @@
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/ConvertingPointer.hpp"
+#include "RAJA/util/NonTemporalPointer.hpp"
+#include "RAJA/util/ReadOnlyPointer.hpp"
 
 namespace RAJA
 {
@@ -173,13 +176,42 @@ namespace internal
   struct ViewReturnHelper;
 
 
+  /*
+   * Type of a scalar element access, a reference to the element unless the
+   * pointer type returns elements by value.
+   */
+  template<typename ElementType, typename PointerType>
+  struct ViewScalarReturn
+  {
+      using type = ElementType &;
+  };
+
+  template<typename ElementType, typename T>
+  struct ViewScalarReturn<ElementType, RAJA::ReadOnlyPointer<T>>
+  {
+      using type = typename RAJA::ReadOnlyPointer<T>::value_type;
+  };
+
+  template<typename ElementType, typename T>
+  struct ViewScalarReturn<ElementType, RAJA::NonTemporalPointer<T>>
+  {
+      using type = RAJA::NonTemporalRef<T>;
+  };
+
+  template<typename ElementType, typename Storage, typename Compute>
+  struct ViewScalarReturn<ElementType, RAJA::ConvertingPointer<Storage, Compute>>
+  {
+      using type = RAJA::ConvertingRef<Storage, Compute>;
+  };
+
+
   /*
    * Specialization for Scalar return types
    */
   template<typename ... Args, typename ElementType, typename PointerType, typename LinIdx, typename LayoutType>
   struct ViewReturnHelper<camp::idx_seq<>, camp::list<Args...>, ElementType, PointerType, LinIdx, LayoutType>
   {
-      using return_type = ElementType &;
+      using return_type = typename ViewScalarReturn<ElementType, PointerType>::type;
 
       RAJA_INLINE
       RAJA_HOST_DEVICE
@@ -25,7 +25,9 @@
 #include "RAJA/pattern/atomic.hpp"
 
 #include "RAJA/util/Layout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
 #include "RAJA/util/TypedViewBase.hpp"
 
 namespace RAJA
@@ -54,6 +56,40 @@ using View =
 
 
 
+/*!
+ * A View for data that is only read while the View is used. Elements are
+ * returned by value and loaded through RAJA::ReadOnlyPointer, which uses the
+ * read-only data cache on CUDA and HIP devices.
+ *
+ *     RAJA::ReadOnlyView<double, RAJA::Layout<2>> a(a_ptr, ni, nj);
+ */
+template <typename ValueType, typename LayoutType>
+using ReadOnlyView =
+    View<ValueType const, LayoutType, ReadOnlyPointer<ValueType>>;
+
+/*!
+ * A View for write-once output data. Assignments to its elements are
+ * streaming stores through RAJA::NonTemporalPointer, so they do not read
+ * the cache lines they write. Host loops writing through it should call
+ * RAJA::nontemporal_store_fence() when done.
+ *
+ *     RAJA::NonTemporalStoreView<double, RAJA::Layout<1>> a(a_ptr, n);
+ */
+template <typename ValueType, typename LayoutType>
+using NonTemporalStoreView =
+    View<ValueType, LayoutType, NonTemporalPointer<ValueType>>;
+
+/*!
+ * A View of data stored as Storage values that is read and written as
+ * Compute values through RAJA::ConvertingPointer, e.g. fp32 storage with
+ * fp64 arithmetic. make_atomic_view of it does atomics on the stored type.
+ *
+ *     RAJA::ConvertingView<float, double, RAJA::Layout<2>> a(a_ptr, ni, nj);
+ */
+template <typename Storage, typename Compute, typename LayoutType>
+using ConvertingView =
+    View<Compute, LayoutType, ConvertingPointer<Storage, Compute>>;
+
 template <typename ValueType, typename LayoutType, typename... IndexTypes>
 using TypedView =
     internal::TypedViewBase<ValueType, ValueType *, LayoutType, camp::list<IndexTypes...> >;
@@ -69,6 +105,36 @@ RAJA_INLINE View<ValueType, Layout<1, IndexType, 0> > make_view(
   return View<ValueType, Layout<1, IndexType, 0> >(ptr, 1);
 }
 
+/*!
+ * Makes a View whose data is stored in tiles of TileSizes... elements,
+ * see RAJA::TiledLayout.  ptr must hold view.size() elements, which
+ * includes the padding of each dimension to a whole number of tiles.
+ *
+ *     auto v = make_tiled_view<4, 4, 4>(ptr, ni, nj, nk);
+ */
+template <camp::idx_t... TileSizes, typename ValueType, typename... Sizes>
+RAJA_INLINE View<ValueType, TiledLayout<sizeof...(TileSizes), TileSizes...> >
+make_tiled_view(ValueType *ptr, Sizes... sizes)
+{
+  return View<ValueType, TiledLayout<sizeof...(TileSizes), TileSizes...> >(
+      ptr, sizes...);
+}
+
+/*!
+ * Makes a View whose data is stored in Morton order, see
+ * RAJA::MortonLayout.  ptr must hold view.size() elements, which includes
+ * the padding of each dimension to a whole number of tiles.
+ *
+ *     auto v = make_morton_view(ptr, ni, nj, nk);
+ */
+template <typename ValueType, typename... Sizes>
+RAJA_INLINE View<ValueType, MortonLayout<sizeof...(Sizes)> > make_morton_view(
+    ValueType *ptr,
+    Sizes... sizes)
+{
+  return View<ValueType, MortonLayout<sizeof...(Sizes)> >(ptr, sizes...);
+}
+
 
 // select certain indices from a tuple, given a curated index sequence
 // returns linear index of layout(ar...)
@@ -232,12 +298,48 @@ struct MultiView {
   }
 };
 
+namespace detail
+{
+
+/*
+ * Atomic reference to an element of a View with pointer type PointerType,
+ * made from the element reference the View returns.
+ */
+template <typename ValueType, typename PointerType, typename AtomicPolicy>
+struct AtomicViewRef {
+  using type = RAJA::AtomicRef<ValueType, AtomicPolicy>;
+
+  RAJA_HOST_DEVICE RAJA_INLINE static type make(ValueType &ref)
+  {
+    return type(&ref);
+  }
+};
+
+template <typename ValueType,
+          typename Storage,
+          typename Compute,
+          typename AtomicPolicy>
+struct AtomicViewRef<ValueType,
+                     RAJA::ConvertingPointer<Storage, Compute>,
+                     AtomicPolicy> {
+  using type = RAJA::ConvertingAtomicRef<Storage, Compute, AtomicPolicy>;
+
+  RAJA_HOST_DEVICE RAJA_INLINE static type make(
+      RAJA::ConvertingRef<Storage, Compute> const &ref)
+  {
+    return type(ref.get());
+  }
+};
+
+}  // namespace detail
+
 template <typename ViewType, typename AtomicPolicy = RAJA::auto_atomic>
 struct AtomicViewWrapper {
   using base_type = ViewType;
   using pointer_type = typename base_type::pointer_type;
   using value_type = typename base_type::value_type;
-  using atomic_type = RAJA::AtomicRef<value_type, AtomicPolicy>;
+  using atomic_ref = detail::AtomicViewRef<value_type, pointer_type, AtomicPolicy>;
+  using atomic_type = typename atomic_ref::type;
 
   base_type base_;
 
@@ -249,7 +351,7 @@ struct AtomicViewWrapper {
   template <typename... ARGS>
   RAJA_HOST_DEVICE RAJA_INLINE atomic_type operator()(ARGS &&... args) const
   {
-    return atomic_type(&base_.operator()(std::forward<ARGS>(args)...));
+    return atomic_ref::make(base_.operator()(std::forward<ARGS>(args)...));
   }
 };
 
@@ -273,7 +375,8 @@ struct AtomicViewWrapper<ViewType, RAJA::seq_atomic> {
   RAJA_INLINE void set_data(pointer_type data_ptr) { base_.set_data(data_ptr); }
 
   template <typename... ARGS>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(ARGS &&... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE auto operator()(ARGS &&... args) const
+      -> decltype(base_.operator()(std::forward<ARGS>(args)...))
   {
     return base_.operator()(std::forward<ARGS>(args)...);
   }
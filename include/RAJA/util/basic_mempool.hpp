@@ -18,15 +18,23 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <vector>
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/util/align.hpp"
+#include "RAJA/util/metrics.hpp"
 #include "RAJA/util/mutex.hpp"
+#include "RAJA/util/plugins.hpp"
 
 namespace RAJA
 {
@@ -38,6 +46,21 @@ namespace detail
 {
 
 
+/*!
+ * \brief Memory space of an allocator for plugins, from a static
+ *        space_name() member, or "Host" for allocators without one.
+ */
+template <typename allocator_t, typename = void>
+struct allocator_space {
+  static const char* name() { return "Host"; }
+};
+
+template <typename allocator_t>
+struct allocator_space<allocator_t,
+                       decltype((void)allocator_t::space_name(), void())> {
+  static const char* name() { return allocator_t::space_name(); }
+};
+
 /*! \class MemoryArena
  ******************************************************************************
  *
@@ -62,7 +85,8 @@ public:
   MemoryArena(void* ptr, size_t size)
     : m_allocation{ ptr, static_cast<char*>(ptr)+size },
       m_free_space(),
-      m_used_space()
+      m_used_space(),
+      m_used_bytes(0)
   {
      m_free_space[ptr] = static_cast<char*>(ptr)+size ;
     if (m_allocation.begin == nullptr) {
@@ -85,6 +109,20 @@ public:
 
   bool unused() { return m_used_space.empty(); }
 
+  size_t used_bytes() const { return m_used_bytes; }
+
+  //! size of the largest free chunk
+  size_t largest_free() const
+  {
+    size_t largest = 0;
+    for (free_value_type const& chunk : m_free_space) {
+      largest = std::max(largest,
+                         static_cast<size_t>(static_cast<char*>(chunk.second) -
+                                             static_cast<char*>(chunk.first)));
+    }
+    return largest;
+  }
+
   void* get_allocation() { return m_allocation.begin; }
 
   void* get(size_t nbytes, size_t alignment)
@@ -108,6 +146,7 @@ public:
                             static_cast<char*>(adj_ptr) + nbytes);
 
           add_used_chunk(adj_ptr, static_cast<char*>(adj_ptr) + nbytes);
+          m_used_bytes += nbytes;
 
           break;
         }
@@ -124,6 +163,8 @@ public:
 
       if (found != m_used_space.end()) {
 
+        m_used_bytes -= static_cast<char*>(found->second) -
+                        static_cast<char*>(found->first);
         add_free_chunk(found->first, found->second);
 
         m_used_space.erase(found);
@@ -237,11 +278,62 @@ private:
   memory_chunk m_allocation;
   free_type m_free_space;
   used_type m_used_space;
+  size_t m_used_bytes;
 };
 
 } /* end namespace detail */
 
 
+/*!
+ * \brief  Statistics of a MemPool, returned by MemPool::stats
+ *
+ * Allocation latencies are counted in power of two bins of nanoseconds,
+ * bin 0 holds latencies below 128 ns, bin i latencies in [2^(i+6), 2^(i+7))
+ * ns and the last bin everything slower. They are only measured while
+ * time_allocations is on.
+ */
+struct MemPoolStats {
+  static const int num_latency_bins = 20;
+
+  //! bytes held in arenas from the allocator
+  size_t bytes_reserved = 0;
+  //! bytes handed out by malloc and not yet freed
+  size_t bytes_in_use = 0;
+  //! high water mark of bytes_in_use since the last reset_stats
+  size_t peak_bytes_in_use = 0;
+  //! largest chunk that can be handed out without growing
+  size_t largest_free_bytes = 0;
+  size_t num_arenas = 0;
+  //! arenas allocated from the allocator, i.e. cudaMalloc calls for the
+  //! device pools
+  size_t arena_growths = 0;
+  size_t num_allocations = 0;
+  //! allocations that failed as the allocator returned no memory
+  size_t failed_allocations = 0;
+  size_t latency_bins[num_latency_bins] = {};
+
+  //! fraction of the free bytes that are not in the largest free chunk
+  double fragmentation() const
+  {
+    const size_t free_bytes = bytes_reserved - bytes_in_use;
+    return free_bytes == 0
+               ? 0.0
+               : 1.0 - static_cast<double>(largest_free_bytes) /
+                           static_cast<double>(free_bytes);
+  }
+
+  //! bin of latency_bins counting the given latency
+  static int latency_bin(long long nanoseconds)
+  {
+    int bin = 0;
+    while (bin < num_latency_bins - 1 && (nanoseconds >> (bin + 7)) > 0) {
+      ++bin;
+    }
+    return bin;
+  }
+};
+
+
 /*! \class MemPool
  ******************************************************************************
  *
@@ -294,10 +386,17 @@ public:
     return pool;
   }
 
+  //! create a pool that is never destroyed, like the instance
+  static MemPool<allocator_t>* newInstance() { return new MemPool; }
+
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
   MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+      : m_arenas(),
+        m_default_arena_size(default_default_arena_size),
+        m_alloc(),
+        m_stats(),
+        m_time_allocations(false)
   {
   }
 
@@ -317,11 +416,77 @@ public:
 
     while (!m_arenas.empty()) {
       void* allocation_ptr = m_arenas.front().get_allocation();
+      util::callDeallocateDataPlugins(
+          util::PluginMemoryContext{space_name(),
+                                    "RAJA::basic_mempool",
+                                    allocation_ptr,
+                                    m_arenas.front().capacity()});
+      m_stats.bytes_reserved -= m_arenas.front().capacity();
+      m_stats.bytes_in_use -= m_arenas.front().used_bytes();
       m_alloc.free(allocation_ptr);
       m_arenas.pop_front();
     }
   }
 
+  /*!
+   * \brief Make sure the pool holds at least nbytes of free memory, growing
+   * it by one arena if it does not, so the allocations that follow do not
+   * call the allocator.
+   *
+   * Call it at startup with the memory the first timesteps need to avoid
+   * allocator calls while they run. Returns false if the allocator failed.
+   */
+  bool reserve(size_t nbytes)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    for (detail::MemoryArena& arena : m_arenas) {
+      if (arena.largest_free() >= nbytes) {
+        return true;
+      }
+    }
+    return add_arena(std::max(nbytes, m_default_arena_size)) != nullptr;
+  }
+
+  MemPoolStats stats()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    MemPoolStats stats = m_stats;
+    stats.num_arenas = m_arenas.size();
+    for (detail::MemoryArena& arena : m_arenas) {
+      stats.largest_free_bytes =
+          std::max(stats.largest_free_bytes, arena.largest_free());
+    }
+    return stats;
+  }
+
+  //! reset the counters and set the peak to the bytes in use now
+  void reset_stats()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    MemPoolStats stats;
+    stats.bytes_reserved = m_stats.bytes_reserved;
+    stats.bytes_in_use = m_stats.bytes_in_use;
+    stats.peak_bytes_in_use = m_stats.bytes_in_use;
+    m_stats = stats;
+  }
+
+  bool time_allocations() { return m_time_allocations; }
+
+  //! measure the latency of each malloc, off by default
+  bool time_allocations(bool time)
+  {
+    return m_time_allocations.exchange(time);
+  }
+
   size_t arena_size()
   {
 #if defined(RAJA_ENABLE_OPENMP)
@@ -345,6 +510,10 @@ public:
   template <typename T>
   T* malloc(size_t nTs, size_t alignment = alignof(T))
   {
+    using clock = std::chrono::steady_clock;
+    const bool timed = m_time_allocations;
+    const clock::time_point start = timed ? clock::now() : clock::time_point();
+
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
@@ -356,20 +525,36 @@ public:
          ++iter) {
       ptr = iter->get(size, alignment);
       if (ptr != nullptr) {
+        RAJA_METRICS_ADD("mempool.hits", 1);
         break;
       }
     }
 
     if (ptr == nullptr) {
-      const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
-      void* arena_ptr = m_alloc.malloc(alloc_size);
-      if (arena_ptr != nullptr) {
-        m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
+      RAJA_METRICS_ADD("mempool.misses", 1);
+      detail::MemoryArena* arena =
+          add_arena(std::max(size + alignment, m_default_arena_size));
+      if (arena != nullptr) {
+        ptr = arena->get(size, alignment);
       }
     }
 
+    if (ptr != nullptr) {
+      ++m_stats.num_allocations;
+      m_stats.bytes_in_use += size;
+      m_stats.peak_bytes_in_use =
+          std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    } else {
+      ++m_stats.failed_allocations;
+    }
+    if (timed) {
+      const long long nanoseconds =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                               start)
+              .count();
+      ++m_stats.latency_bins[MemPoolStats::latency_bin(nanoseconds)];
+    }
+
     return static_cast<T*>(ptr);
   }
 
@@ -383,7 +568,9 @@ public:
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
+      const size_t used_bytes = iter->used_bytes();
       if (iter->give(ptr)) {
+        m_stats.bytes_in_use -= used_bytes - iter->used_bytes();
         ptr = nullptr;
         break;
       }
@@ -396,6 +583,29 @@ public:
 private:
   using arena_container_type = std::list<detail::MemoryArena>;
 
+  static const char* space_name()
+  {
+    return detail::allocator_space<allocator_t>::name();
+  }
+
+  //! allocate an arena of nbytes from the allocator, called with the lock
+  detail::MemoryArena* add_arena(size_t nbytes)
+  {
+    void* arena_ptr = m_alloc.malloc(nbytes);
+    if (arena_ptr == nullptr) {
+      return nullptr;
+    }
+    m_arenas.emplace_front(arena_ptr, nbytes);
+    util::callAllocateDataPlugins(
+        util::PluginMemoryContext{space_name(),
+                                  "RAJA::basic_mempool",
+                                  arena_ptr,
+                                  nbytes});
+    ++m_stats.arena_growths;
+    m_stats.bytes_reserved += nbytes;
+    return &m_arenas.front();
+  }
+
 #if defined(RAJA_ENABLE_OPENMP)
   omp::mutex m_mutex;
 #endif
@@ -403,6 +613,538 @@ private:
   arena_container_type m_arenas;
   size_t m_default_arena_size;
   allocator_t m_alloc;
+  MemPoolStats m_stats;
+  std::atomic<bool> m_time_allocations;
+};
+
+/*! \class SlabPool
+ ******************************************************************************
+ *
+ * \brief  SlabPool is a size class segregated pool with the same interface as
+ * MemPool, for workloads that allocate and free many small blocks
+ *
+ * Requests up to max_block_size bytes are rounded up to a power of two size
+ * class. Each size class carves slab_size byte slabs obtained from a backing
+ * MemPool into equal blocks and keeps the free blocks in a list, so get and
+ * give are O(1). Blocks of a size class are aligned to the size class.
+ * Larger requests go to the backing MemPool directly.
+ *
+ * Each thread keeps a small cache of free blocks per size class in front of
+ * the shared free lists, so most small allocations do not take the lock.
+ * When a thread cache overflows, half of it is handed off as a batch to a
+ * lock-free list of the size class, and a thread whose cache is empty takes
+ * a batch from that list before taking the lock. Thread caches are kept for
+ * the instance and pools from newInstance, which are never destroyed, so a
+ * cache never outlives its pool; other pools always take the lock.
+ *
+ * All bookkeeping is kept on the host, the blocks themselves are never
+ * touched, so the pool may manage device memory. Memory is not returned to
+ * the allocator until free_chunks is called.
+ *
+ * The gpu mempool types use SlabPool when RAJA_ENABLE_SLAB_MEMPOOL is
+ * defined, e.g.
+ *
+ * using device_mempool_type = basic_mempool::SlabPool<cuda::DeviceAllocator>;
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class SlabPool
+{
+public:
+  using allocator_type = allocator_t;
+
+  static inline SlabPool<allocator_t>& getInstance()
+  {
+    static SlabPool<allocator_t> pool{thread_cached_tag{}};
+    return pool;
+  }
+
+  //! create a thread cached pool that is never destroyed, like the instance
+  static SlabPool<allocator_t>* newInstance()
+  {
+    return new SlabPool(thread_cached_tag{});
+  }
+
+  static const size_t min_block_size = 16;
+  static const size_t max_block_size = 32ull * 1024ull;
+  static const size_t slab_size = 256ull * 1024ull;
+
+  SlabPool() : m_backing(), m_free_blocks(), m_epoch(0)
+  {
+    for (std::atomic<std::uintptr_t>& entry : m_slabs) {
+      entry.store(0, std::memory_order_relaxed);
+    }
+    for (std::atomic<Batch*>& head : m_handoff) {
+      head.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~SlabPool()
+  {
+    // Like MemPool, memory is not freed here
+  }
+
+  void free_chunks()
+  {
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+      for (std::vector<void*>& blocks : m_free_blocks) {
+        blocks.clear();
+      }
+      for (std::atomic<Batch*>& head : m_handoff) {
+        delete_batches(head.exchange(nullptr, std::memory_order_acquire));
+      }
+      for (std::atomic<std::uintptr_t>& entry : m_slabs) {
+        entry.store(0, std::memory_order_relaxed);
+      }
+      // invalidate the blocks cached by each thread
+      m_epoch.fetch_add(1);
+    }
+
+    m_backing.free_chunks();
+  }
+
+  size_t arena_size() { return m_backing.arena_size(); }
+
+  size_t arena_size(size_t new_size) { return m_backing.arena_size(new_size); }
+
+  bool reserve(size_t nbytes) { return m_backing.reserve(nbytes); }
+
+  //! stats of the backing MemPool, the slabs count as in use
+  MemPoolStats stats() { return m_backing.stats(); }
+
+  void reset_stats() { m_backing.reset_stats(); }
+
+  bool time_allocations() { return m_backing.time_allocations(); }
+
+  bool time_allocations(bool time) { return m_backing.time_allocations(time); }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const int size_class =
+        get_size_class(std::max(nTs * sizeof(T), alignment));
+    if (size_class < 0) {
+      return m_backing.template malloc<T>(nTs, alignment);
+    }
+
+    ThreadCache* cache = get_thread_cache();
+    if (cache && (cache->count[size_class] > 0 ||
+                  take_batch(*cache, size_class))) {
+      RAJA_METRICS_ADD("mempool.hits", 1);
+      --cache->count[size_class];
+      return static_cast<T*>(
+          cache->blocks[size_class][cache->count[size_class]]);
+    }
+
+    void* ptr = nullptr;
+    {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+      std::vector<void*>& blocks = m_free_blocks[size_class];
+      if (blocks.empty()) {
+        RAJA_METRICS_ADD("mempool.misses", 1);
+        add_slab(size_class);
+      } else {
+        RAJA_METRICS_ADD("mempool.hits", 1);
+      }
+      if (!blocks.empty()) {
+        ptr = blocks.back();
+        blocks.pop_back();
+
+        // refill the thread cache with half its capacity
+        if (cache) {
+          while (!blocks.empty() &&
+                 cache->count[size_class] < cache_size / 2) {
+            cache->blocks[size_class][cache->count[size_class]++] =
+                blocks.back();
+            blocks.pop_back();
+          }
+        }
+      }
+    }
+
+    if (ptr == nullptr) {
+      // slab registry is full, fall back to the backing pool
+      ptr = m_backing.template malloc<char>(size_of_class(size_class),
+                                            size_of_class(size_class));
+    }
+
+    return static_cast<T*>(ptr);
+  }
+
+  void free(const void* cptr)
+  {
+    void* ptr = const_cast<void*>(cptr);
+    const int size_class = find_size_class(ptr);
+    if (size_class < 0) {
+      m_backing.free(ptr);
+      return;
+    }
+
+    ThreadCache* cache = get_thread_cache();
+    if (cache) {
+      if (cache->count[size_class] == cache_size) {
+        // hand the older half of the cache off to other threads
+        give_batch(cache->blocks[size_class], size_class);
+        for (size_t i = cache_size / 2; i < cache_size; ++i) {
+          cache->blocks[size_class][i - cache_size / 2] =
+              cache->blocks[size_class][i];
+        }
+        cache->count[size_class] = cache_size / 2;
+      }
+      cache->blocks[size_class][cache->count[size_class]++] = ptr;
+    } else {
+      release_blocks(&ptr, 1, size_class);
+    }
+  }
+
+private:
+  static const int num_size_classes = 12;  // 16 B to 32 KiB
+  static const size_t cache_size = 32;
+  static const size_t num_slab_entries = 1ull << 14;
+  static const int max_thread_caches = 16;
+
+  struct thread_cached_tag {
+  };
+
+  explicit SlabPool(thread_cached_tag) : SlabPool() { m_thread_cached = true; }
+
+  //! free blocks cached by a thread for one pool
+  struct ThreadCache {
+    SlabPool* owner = nullptr;
+    unsigned epoch = 0;
+    size_t count[num_size_classes] = {};
+    void* blocks[num_size_classes][cache_size];
+  };
+
+  //! caches of a thread, one per thread cached pool it used
+  struct ThreadCaches {
+    ThreadCache* caches[max_thread_caches] = {};
+
+    ~ThreadCaches()
+    {
+      for (ThreadCache* cache : caches) {
+        if (cache) {
+          cache->owner->flush_thread_cache(*cache);
+          delete cache;
+        }
+      }
+    }
+  };
+
+  //! half a thread cache of free blocks handed off between threads
+  struct Batch {
+    Batch* next;
+    void* blocks[cache_size / 2];
+  };
+
+  ThreadCache* get_thread_cache()
+  {
+    // a cache must not outlive its pool
+    if (!m_thread_cached) {
+      return nullptr;
+    }
+    static thread_local ThreadCaches thread_caches;
+    ThreadCache* cache = nullptr;
+    for (ThreadCache*& c : thread_caches.caches) {
+      if (c == nullptr) {
+        c = new ThreadCache;
+        c->owner = this;
+        c->epoch = m_epoch.load(std::memory_order_acquire);
+      }
+      if (c->owner == this) {
+        cache = c;
+        break;
+      }
+    }
+    if (cache == nullptr) {
+      return nullptr;
+    }
+    const unsigned epoch = m_epoch.load(std::memory_order_acquire);
+    if (cache->epoch != epoch) {
+      cache->epoch = epoch;
+      for (size_t& count : cache->count) {
+        count = 0;
+      }
+    }
+    return cache;
+  }
+
+  //! push the first half of blocks to the handoff list of size_class
+  void give_batch(void* const* blocks, int size_class)
+  {
+    Batch* batch = new Batch;
+    std::copy(blocks, blocks + cache_size / 2, batch->blocks);
+    push_batches(batch, batch, size_class);
+  }
+
+  //! move a batch from the handoff list of size_class to an empty cache
+  bool take_batch(ThreadCache& cache, int size_class)
+  {
+    std::atomic<Batch*>& head = m_handoff[size_class];
+    if (head.load(std::memory_order_relaxed) == nullptr) {
+      return false;
+    }
+    // take the whole list so no batch is popped while another thread
+    // reuses it, then give back all but the first batch
+    Batch* batch = head.exchange(nullptr, std::memory_order_acquire);
+    if (batch == nullptr) {
+      return false;
+    }
+    if (batch->next != nullptr) {
+      Batch* last = batch->next;
+      while (last->next != nullptr) {
+        last = last->next;
+      }
+      push_batches(batch->next, last, size_class);
+    }
+    std::copy(batch->blocks, batch->blocks + cache_size / 2,
+              cache.blocks[size_class]);
+    cache.count[size_class] = cache_size / 2;
+    delete batch;
+    return true;
+  }
+
+  //! push the list of batches [first, last] to the handoff list
+  void push_batches(Batch* first, Batch* last, int size_class)
+  {
+    std::atomic<Batch*>& head = m_handoff[size_class];
+    Batch* old_head = head.load(std::memory_order_relaxed);
+    do {
+      last->next = old_head;
+    } while (!head.compare_exchange_weak(old_head, first,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  static void delete_batches(Batch* batch)
+  {
+    while (batch != nullptr) {
+      Batch* next = batch->next;
+      delete batch;
+      batch = next;
+    }
+  }
+
+  void flush_thread_cache(ThreadCache& cache)
+  {
+    if (cache.epoch != m_epoch.load(std::memory_order_acquire)) {
+      return;
+    }
+    for (int size_class = 0; size_class < num_size_classes; ++size_class) {
+      release_blocks(cache.blocks[size_class], cache.count[size_class],
+                     size_class);
+      cache.count[size_class] = 0;
+    }
+  }
+
+  void release_blocks(void* const* ptrs, size_t num, int size_class)
+  {
+    if (num == 0) {
+      return;
+    }
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+    m_free_blocks[size_class].insert(m_free_blocks[size_class].end(),
+                                     ptrs, ptrs + num);
+  }
+
+  static size_t size_of_class(int size_class)
+  {
+    return min_block_size << size_class;
+  }
+
+  //! smallest size class holding nbytes, -1 if nbytes is too large
+  static int get_size_class(size_t nbytes)
+  {
+    if (nbytes > max_block_size) {
+      return -1;
+    }
+    int size_class = 0;
+    while (size_of_class(size_class) < nbytes) {
+      ++size_class;
+    }
+    return size_class;
+  }
+
+  //! carve a new slab into free blocks of size_class, called with the lock
+  void add_slab(int size_class)
+  {
+    char* slab = m_backing.template malloc<char>(slab_size, slab_size);
+    if (slab == nullptr) {
+      return;
+    }
+    if (!insert_slab(slab, size_class)) {
+      m_backing.free(slab);
+      return;
+    }
+    const size_t block_size = size_of_class(size_class);
+    std::vector<void*>& blocks = m_free_blocks[size_class];
+    for (size_t offset = slab_size; offset > 0; offset -= block_size) {
+      blocks.push_back(slab + offset - block_size);
+    }
+  }
+
+  // The slab registry is an insert only open addressing table from slab
+  // address to size class, stored together as the slab address is aligned to
+  // slab_size. Entries are inserted with the lock held and read without it.
+  static size_t slab_hash(std::uintptr_t slab)
+  {
+    return static_cast<size_t>((slab / slab_size) * 0x9E3779B97F4A7C15ull) &
+           (num_slab_entries - 1);
+  }
+
+  bool insert_slab(void* slab, int size_class)
+  {
+    const std::uintptr_t key = reinterpret_cast<std::uintptr_t>(slab);
+    for (size_t i = slab_hash(key), n = 0; n < num_slab_entries;
+         i = (i + 1) & (num_slab_entries - 1), ++n) {
+      if (m_slabs[i].load(std::memory_order_relaxed) == 0) {
+        m_slabs[i].store(key | static_cast<std::uintptr_t>(size_class + 1),
+                         std::memory_order_release);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int find_size_class(void* ptr) const
+  {
+    const std::uintptr_t key =
+        reinterpret_cast<std::uintptr_t>(ptr) & ~(slab_size - 1);
+    for (size_t i = slab_hash(key), n = 0; n < num_slab_entries;
+         i = (i + 1) & (num_slab_entries - 1), ++n) {
+      const std::uintptr_t entry = m_slabs[i].load(std::memory_order_acquire);
+      if (entry == 0) {
+        break;
+      }
+      if ((entry & ~(slab_size - 1)) == key) {
+        return static_cast<int>(entry & (slab_size - 1)) - 1;
+      }
+    }
+    return -1;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_mutex;
+#endif
+
+  MemPool<allocator_t> m_backing;
+  std::vector<void*> m_free_blocks[num_size_classes];
+  std::atomic<std::uintptr_t> m_slabs[num_slab_entries];
+  std::atomic<Batch*> m_handoff[num_size_classes];
+  std::atomic<unsigned> m_epoch;
+  bool m_thread_cached = false;
+};
+
+/*! \class StreamCache
+ ******************************************************************************
+ *
+ * \brief  Per thread cache of blocks from a pool, keyed by stream and size.
+ *
+ * A block freed to the cache is only handed out again for the same stream
+ * and size, so work on a stream can reuse the block right after the work
+ * of its previous user was enqueued on that stream. Each thread has its
+ * own cache so malloc and free take no lock. Blocks freed on another
+ * thread and blocks beyond the capacity of the cache go to the pool.
+ *
+ ******************************************************************************
+ */
+template <typename pool_t, typename stream_t>
+class StreamCache
+{
+public:
+  static StreamCache& getInstance()
+  {
+    static thread_local StreamCache cache;
+    return cache;
+  }
+
+  StreamCache() = default;
+  StreamCache(const StreamCache&) = delete;
+
+  ~StreamCache()
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      if (!m_entries[i].in_use) {
+        pool_t::getInstance().free(m_entries[i].ptr);
+      }
+    }
+  }
+
+  template <typename T>
+  T* malloc(stream_t stream, size_t nTs)
+  {
+    const size_t nbytes = nTs * sizeof(T);
+    size_t idle = m_size;
+    for (size_t i = m_size; i > 0; --i) {
+      Entry& e = m_entries[i - 1];
+      if (!e.in_use) {
+        if (e.stream == stream && e.nbytes == nbytes) {
+          RAJA_METRICS_ADD("stream_cache.hits", 1);
+          e.in_use = true;
+          return static_cast<T*>(e.ptr);
+        }
+        idle = i - 1;
+      }
+    }
+
+    RAJA_METRICS_ADD("stream_cache.misses", 1);
+    T* ptr = pool_t::getInstance().template malloc<T>(nTs);
+
+    // forget entries of blocks freed on another thread as the pool may hand
+    // out the same block again
+    for (size_t i = 0; i < m_size; ++i) {
+      if (m_entries[i].ptr == ptr) {
+        m_entries[i] = m_entries[--m_size];
+        if (idle == m_size) {
+          idle = i;
+        }
+        break;
+      }
+    }
+
+    if (m_size < capacity) {
+      m_entries[m_size++] = Entry{ptr, nbytes, stream, true};
+    } else if (idle < m_size) {
+      pool_t::getInstance().free(m_entries[idle].ptr);
+      m_entries[idle] = Entry{ptr, nbytes, stream, true};
+    }
+    return ptr;
+  }
+
+  void free(const void* ptr)
+  {
+    for (size_t i = m_size; i > 0; --i) {
+      Entry& e = m_entries[i - 1];
+      if (e.ptr == ptr && e.in_use) {
+        e.in_use = false;
+        return;
+      }
+    }
+    pool_t::getInstance().free(ptr);
+  }
+
+private:
+  static const size_t capacity = 64;
+
+  struct Entry {
+    void* ptr;
+    size_t nbytes;
+    stream_t stream;
+    bool in_use;
+  };
+
+  Entry m_entries[capacity];
+  size_t m_size = 0;
 };
 
 //! example allocator for basic_mempool using malloc/free
@@ -419,6 +1161,35 @@ struct generic_allocator {
   }
 };
 
+/*!
+ * \brief  Allocator whose blocks are page aligned and first touched in
+ *          parallel with RAJA::first_touch_static, so with a first touch
+ *          page placement policy each block is spread across the NUMA
+ *          domains of the omp threads.
+ *
+ *          using numa_mempool_type =
+ *              basic_mempool::MemPool<basic_mempool::first_touch_allocator>;
+ */
+struct first_touch_allocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    void* ptr = RAJA::allocate_aligned(RAJA::get_page_size(), nbytes);
+    if (ptr) {
+      RAJA::first_touch_static(ptr, nbytes);
+    }
+    return ptr;
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    RAJA::free_aligned(ptr);
+    return true;
+  }
+};
+
 } /* end namespace basic_mempool */
 
 } /* end namespace RAJA */
@@ -0,0 +1,113 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the runtime metrics registry.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_metrics_HPP
+#define RAJA_util_metrics_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#if defined(RAJA_ENABLE_METRICS)
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace RAJA
+{
+namespace metrics
+{
+
+using count_type = long long;
+
+//! name and aggregated value of a counter
+struct Metric {
+  std::string name;
+  count_type value;
+};
+
+/*!
+ * \brief Named counter in the metrics registry.
+ *
+ * Counters with the same name share one slot in the registry.  Each thread
+ * adds into its own block of slots, so add never contends with other
+ * threads; value, snapshot and the JSON dump sum the blocks of all threads
+ * that are alive plus the totals of the threads that exited.
+ */
+class Counter
+{
+public:
+  explicit Counter(const char* name);
+
+  void add(count_type n = 1) const;
+
+  void operator++(int) const { add(1); }
+  void operator++() const { add(1); }
+
+  //! sum over all threads since the last reset
+  count_type value() const;
+
+  void reset() const;
+
+  const std::string& name() const;
+
+private:
+  int m_id;
+};
+
+//! values of all registered counters in registration order
+std::vector<Metric> snapshot();
+
+//! value of the counter with the given name, 0 if it is not registered
+count_type value(const std::string& name);
+
+//! reset all registered counters
+void reset();
+
+//! write all registered counters as a JSON object of name: value
+void writeJSON(std::ostream& os);
+
+//! write the JSON object to a file, returns false if it can not be opened
+bool writeJSON(const std::string& path);
+
+}  // namespace metrics
+}  // namespace RAJA
+
+#endif
+
+/*!
+ * \brief Add n to the counter with the given name from host code.
+ *
+ * Expands to nothing unless RAJA is configured with RAJA_ENABLE_METRICS and
+ * in device compilation passes.  The counter is looked up once per call
+ * site.
+ */
+#if defined(RAJA_ENABLE_METRICS) && \
+    !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+#define RAJA_METRICS_ADD(name, n)                                 \
+  do {                                                            \
+    static const ::RAJA::metrics::Counter raja_metrics_counter{name}; \
+    raja_metrics_counter.add(n);                                  \
+  } while (0)
+#else
+#define RAJA_METRICS_ADD(name, n) \
+  do {                            \
+  } while (0)
+#endif
+
+#endif
@@ -22,6 +22,10 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 #include <omp.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
 #endif
 
 namespace RAJA
@@ -58,6 +62,77 @@ private:
   native_handle_type m_lock;
 };
 
+/*!
+ * \brief Dissemination barrier for the threads of an OpenMP team.
+ *
+ * In round r each thread signals the thread 2^r after it and waits for the
+ * thread 2^r before it, so all threads leave after ceil(log2(p)) rounds
+ * without any thread waiting on a shared counter. Each thread waits on its
+ * own cache line, and the flags hold the number of the barrier episode so
+ * no sense has to be reversed between episodes.
+ */
+class barrier
+{
+public:
+  //! barrier for teams of at most max_threads threads
+  explicit barrier(int max_threads)
+      : m_max_threads(max_threads),
+        m_max_rounds(rounds(max_threads)),
+        m_flags(new padded_counter[max_threads * m_max_rounds]),
+        m_episodes(new padded_counter[max_threads])
+  {
+  }
+
+  barrier(const barrier&) = delete;
+  barrier(barrier&&) = delete;
+  barrier& operator=(const barrier&) = delete;
+  barrier& operator=(barrier&&) = delete;
+
+  //! wait for all threads of the current team to arrive
+  void arrive_and_wait()
+  {
+    const int p = omp_get_num_threads();
+    const int t = omp_get_thread_num();
+    const unsigned long long e =
+        m_episodes[t].value.load(std::memory_order_relaxed) + 1;
+    m_episodes[t].value.store(e, std::memory_order_relaxed);
+
+    for (int r = 0, d = 1; d < p; ++r, d *= 2) {
+      m_flags[((t + d) % p) * m_max_rounds + r].value.store(
+          e, std::memory_order_release);
+      std::atomic<unsigned long long>& flag =
+          m_flags[t * m_max_rounds + r].value;
+      for (int spin = 1; flag.load(std::memory_order_acquire) < e; ++spin) {
+        if (spin % 1024 == 0) {
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+  int max_threads() const { return m_max_threads; }
+
+private:
+  struct alignas(64) padded_counter {
+    std::atomic<unsigned long long> value{0};
+  };
+
+  //! rounds of a team of p threads, ceil(log2(p))
+  static int rounds(int p)
+  {
+    int r = 0;
+    for (int d = 1; d < p; d *= 2) {
+      ++r;
+    }
+    return r;
+  }
+
+  int m_max_threads;
+  int m_max_rounds;
+  std::unique_ptr<padded_counter[]> m_flags;
+  std::unique_ptr<padded_counter[]> m_episodes;
+};
+
 }  // namespace omp
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
 
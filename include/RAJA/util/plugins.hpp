@@ -10,6 +10,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/PluginStrategy.hpp"
@@ -32,50 +36,178 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preCapture(p);
   }
+#endif
 }
 
 RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postCapture(p);
   }
+#endif
 }
 
 RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preLaunch(p);
   }
+#endif
 }
 
 RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postLaunch(p);
   }
+#endif
+}
+
+RAJA_INLINE
+void
+callPreFencePlugins(const PluginContext& p)
+{
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
+  for (auto plugin = PluginRegistry::begin();
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->preFence(p);
+  }
+#endif
+}
+
+RAJA_INLINE
+void
+callPostFencePlugins(const PluginContext& p)
+{
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
+  for (auto plugin = PluginRegistry::begin();
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->postFence(p);
+  }
+#endif
+}
+
+RAJA_INLINE
+void
+callAllocateDataPlugins(const PluginMemoryContext& p)
+{
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
+  for (auto plugin = PluginRegistry::begin();
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->allocateData(p);
+  }
+#endif
 }
 
+RAJA_INLINE
+void
+callDeallocateDataPlugins(const PluginMemoryContext& p)
+{
+#if defined(RAJA_DISABLE_PLUGINS)
+  RAJA_UNUSED_VAR(p);
+#else
+  for (auto plugin = PluginRegistry::begin();
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->deallocateData(p);
+  }
+#endif
+}
+
+namespace detail
+{
+
+//! plugin calls made by a pattern, compiled out when Enabled is false
+template <bool Enabled>
+struct PluginHooks
+{
+  static constexpr bool enabled = true;
+
+  using active_context_type = ActiveContext;
+
+  static void preCapture(const PluginContext& p) { callPreCapturePlugins(p); }
+  static void postCapture(const PluginContext& p) { callPostCapturePlugins(p); }
+  static void preLaunch(const PluginContext& p) { callPreLaunchPlugins(p); }
+  static void postLaunch(const PluginContext& p) { callPostLaunchPlugins(p); }
+
+  //! copy of the loop body that plugins may update
+  template <typename T>
+  static auto capture(T&& item) -> typename std::remove_reference<T>::type
+  {
+    return trigger_updates_before(item);
+  }
+};
+
+template <>
+struct PluginHooks<false>
+{
+  static constexpr bool enabled = false;
+
+  struct active_context_type {
+    explicit active_context_type(const PluginContext&) {}
+  };
+
+  static void preCapture(const PluginContext&) {}
+  static void postCapture(const PluginContext&) {}
+  static void preLaunch(const PluginContext&) {}
+  static void postLaunch(const PluginContext&) {}
+
+  //! the loop body itself, no copy is made
+  template <typename T>
+  static T&& capture(T&& item)
+  {
+    return std::forward<T>(item);
+  }
+};
+
+} // closing brace for detail namespace
+
 RAJA_INLINE
 void
 callInitPlugins(const PluginOptions p)
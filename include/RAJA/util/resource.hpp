@@ -20,19 +20,31 @@
 #ifndef RAJA_resource_HPP
 #define RAJA_resource_HPP
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "camp/resource.hpp"
 #if defined(RAJA_CUDA_ACTIVE)
 #include "RAJA/policy/cuda/policy.hpp"
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
 #endif
 #if defined(RAJA_HIP_ACTIVE)
 #include "RAJA/policy/hip/policy.hpp"
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
 #endif
 #if defined(RAJA_SYCL_ACTIVE)
 #include "RAJA/policy/sycl/policy.hpp"
 #endif
 #include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/MultiDevice.hpp"
 #include "RAJA/policy/openmp_target/policy.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
@@ -51,6 +63,11 @@ namespace RAJA
     using type = camp::resources::Host;
   };
 
+  template<typename DevicePolicy>
+  struct get_resource<multi_device_exec<DevicePolicy>>{
+    using type = typename get_resource<DevicePolicy>::type;
+  };
+
   template<typename ExecPol>
   using resource_from_pol_t = typename get_resource_from_platform<detail::get_platform<ExecPol>::value>::type;
 
@@ -80,6 +97,11 @@ namespace RAJA
     using type = camp::resources::Cuda;
   };
 
+  template <bool Async>
+  struct get_resource<cuda_launch_cooperative_t<Async>>{
+    using type = camp::resources::Cuda;
+  };
+
   template<typename ISetIter, size_t BlockSize, bool Async>
   struct get_resource<ExecPolicy<ISetIter, cuda_exec<BlockSize, Async>>>{
     using type = camp::resources::Cuda;
@@ -94,6 +116,36 @@ namespace RAJA
   struct get_resource<ExecPolicy<ISetIter, cuda_exec_explicit<BlockSize, BlocksPerSM, Async>>>{
     using type = camp::resources::Cuda;
   };
+
+  template<size_t BlockSize, size_t BlocksPerSM, bool Async>
+  struct get_resource<cuda_exec_occ_explicit<BlockSize, BlocksPerSM, Async>>{
+    using type = camp::resources::Cuda;
+  };
+
+  template<typename ISetIter, size_t BlockSize, size_t BlocksPerSM, bool Async>
+  struct get_resource<ExecPolicy<ISetIter, cuda_exec_occ_explicit<BlockSize, BlocksPerSM, Async>>>{
+    using type = camp::resources::Cuda;
+  };
+
+  template<size_t MaxBlockSize, size_t BlocksPerSM, bool Async>
+  struct get_resource<cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, Async>>{
+    using type = camp::resources::Cuda;
+  };
+
+  template<typename ISetIter, size_t MaxBlockSize, size_t BlocksPerSM, bool Async>
+  struct get_resource<ExecPolicy<ISetIter, cuda_exec_rt_explicit<MaxBlockSize, BlocksPerSM, Async>>>{
+    using type = camp::resources::Cuda;
+  };
+
+  template<size_t BlockSize, size_t ItemsPerThread, size_t BlocksPerSM, bool Async>
+  struct get_resource<cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, Async>>{
+    using type = camp::resources::Cuda;
+  };
+
+  template<typename ISetIter, size_t BlockSize, size_t ItemsPerThread, size_t BlocksPerSM, bool Async>
+  struct get_resource<ExecPolicy<ISetIter, cuda_exec_ilp_explicit<BlockSize, ItemsPerThread, BlocksPerSM, Async>>>{
+    using type = camp::resources::Cuda;
+  };
 #endif
 
 #if defined(RAJA_HIP_ACTIVE)
@@ -112,10 +164,25 @@ namespace RAJA
     using type = camp::resources::Hip;
   };
 
+  template <bool Async>
+  struct get_resource<hip_launch_cooperative_t<Async>>{
+    using type = camp::resources::Hip;
+  };
+
   template<typename ISetIter, size_t BlockSize, bool Async>
   struct get_resource<ExecPolicy<ISetIter, hip_exec<BlockSize, Async>>>{
     using type = camp::resources::Hip;
   };
+
+  template<size_t BlockSize, bool Async>
+  struct get_resource<hip_exec_occ<BlockSize, Async>>{
+    using type = camp::resources::Hip;
+  };
+
+  template<typename ISetIter, size_t BlockSize, bool Async>
+  struct get_resource<ExecPolicy<ISetIter, hip_exec_occ<BlockSize, Async>>>{
+    using type = camp::resources::Hip;
+  };
 #endif
 
 #if defined(RAJA_SYCL_ACTIVE)
@@ -156,6 +223,11 @@ namespace RAJA
     using type = camp::resources::Omp;
   };
 
+  template<>
+  struct get_resource<omp_target_launch_t>{
+    using type = camp::resources::Omp;
+  };
+
   template<typename ISetIter>
   struct get_resource<ExecPolicy<ISetIter, omp_target_parallel_for_exec_nt>>{
     using type = camp::resources::Omp;
@@ -167,8 +239,421 @@ namespace RAJA
   };
 #endif
 
+  /*!
+   * \brief Events a RAJA pattern must wait for before it runs, made with
+   *        RAJA::depends_on.
+   *
+   * The pattern's resource waits for each event with wait_for, which for
+   * GPU resources enqueues the wait on the stream (cudaStreamWaitEvent,
+   * hipStreamWaitEvent) instead of blocking the host.  Host resources run
+   * patterns synchronously, so waiting for their events returns at once.
+   */
+  template <size_t N>
+  struct Dependencies
+  {
+    std::array<Event, N> events;
+
+    //! make r wait for the events before the work enqueued after this
+    template <typename Res>
+    void enqueue(Res& r)
+    {
+      for (Event& e : events) {
+        r.wait_for(&e);
+      }
+    }
+  };
+
+  /*!
+   * \brief A fixed set of resources of one type, handed out round-robin.
+   *
+   * Work enqueued on the default resource of a GPU back-end runs on one
+   * stream, so small independent kernels run one after the other.  Taking
+   * a resource from the pool for each kernel spreads them over several
+   * streams, so they can run concurrently; see RAJA::forall_concurrent.
+   *
+   * Each resource of the pool is default constructed, so for CUDA and HIP
+   * they use the streams camp gives out in turn; a pool larger than the
+   * number of camp streams reuses streams.  get() may be called from
+   * several threads.
+   */
+  template <typename Res>
+  class StreamPool
+  {
+  public:
+    explicit StreamPool(size_t num_resources)
+        : m_resources(num_resources > 0 ? num_resources : 1), m_next(0)
+    {
+    }
+
+    StreamPool(StreamPool const&) = delete;
+    StreamPool& operator=(StreamPool const&) = delete;
+
+    //! next resource of the pool, round-robin
+    Res& get()
+    {
+      return m_resources[m_next.fetch_add(1, std::memory_order_relaxed) %
+                         m_resources.size()];
+    }
+
+    Res& operator[](size_t i) { return m_resources[i]; }
+
+    size_t size() const { return m_resources.size(); }
+
+    //! wait for the work enqueued on all the resources of the pool
+    void wait()
+    {
+      for (Res& r : m_resources) {
+        r.wait();
+      }
+    }
+
+  private:
+    std::vector<Res> m_resources;
+    std::atomic<size_t> m_next;
+  };
+
+  /*!
+   * \brief Stream of a resource, as the cudaStream_t or hipStream_t handle,
+   *        or nullptr for resources that have no stream.
+   *
+   * Used to tell plugins where a kernel was launched, see
+   * RAJA::util::PluginContext.
+   */
+  template <typename Res>
+  RAJA_INLINE void* get_native_stream(Res&)
+  {
+    return nullptr;
+  }
+
+#if defined(RAJA_CUDA_ACTIVE)
+  RAJA_INLINE void* get_native_stream(Cuda& res)
+  {
+    return static_cast<void*>(res.get_stream());
+  }
+#endif
+
+#if defined(RAJA_HIP_ACTIVE)
+  RAJA_INLINE void* get_native_stream(Hip& res)
+  {
+    return static_cast<void*>(res.get_stream());
+  }
+#endif
+
+  /*!
+   * \brief Picks the device of GPU resources at run time, specialized by
+   *        the CUDA and HIP back-ends.
+   *
+   * resource(device) returns one of a few streams of a device, created on
+   * first use, so work for different devices is enqueued without setting
+   * the device of the streams each time. device_of(res) returns the device
+   * of a resource from resource(), or -1 for other resources, which may be
+   * used on the current device. Back-ends without devices return their
+   * default resource.
+   */
+  template <typename Res>
+  struct device_select
+  {
+    static int num_devices() { return 0; }
+
+    static int current() { return -1; }
+
+    static void set(int) {}
+
+    static Res resource(int) { return Res::get_default(); }
+
+    static int device_of(Res&) { return -1; }
+  };
+
+#if defined(RAJA_CUDA_ACTIVE)
+  template <>
+  struct device_select<Cuda>
+  {
+    //! number of streams of each device handed out by resource
+    static constexpr size_t streams_per_device = 4;
+
+    static int num_devices()
+    {
+      static const int num = [] {
+        int n = 0;
+        cudaErrchk(cudaGetDeviceCount(&n));
+        return n;
+      }();
+      return num;
+    }
+
+    static int current()
+    {
+      int device = 0;
+      cudaErrchk(cudaGetDevice(&device));
+      return device;
+    }
+
+    static void set(int device) { cudaErrchk(cudaSetDevice(device)); }
+
+    //! next of the streams of device, round-robin
+    static Cuda resource(int device) { return pool(device).get(); }
+
+    //! device of a resource from resource(), -1 for other resources
+    static int device_of(Cuda& res)
+    {
+      cudaStream_t stream = res.get_stream();
+      for (int d = 0; d < num_devices(); ++d) {
+        StreamPool<Cuda>* p = pools()[d].load(std::memory_order_acquire);
+        for (size_t i = 0; p != nullptr && i < p->size(); ++i) {
+          if ((*p)[i].get_stream() == stream) {
+            return d;
+          }
+        }
+      }
+      return -1;
+    }
+
+    //! streams of device, created with device current on first use
+    static StreamPool<Cuda>& pool(int device)
+    {
+      if (device < 0 || device >= num_devices()) {
+        RAJA_ABORT_OR_THROW("RAJA::resources::device_select: invalid device");
+      }
+      StreamPool<Cuda>* p = pools()[device].load(std::memory_order_acquire);
+      if (p == nullptr) {
+        static std::mutex create_mutex;
+        std::lock_guard<std::mutex> lock(create_mutex);
+        p = pools()[device].load(std::memory_order_relaxed);
+        if (p == nullptr) {
+          const int prev = current();
+          set(device);
+          // never freed, like the streams camp hands out
+          p = new StreamPool<Cuda>(streams_per_device);
+          set(prev);
+          pools()[device].store(p, std::memory_order_release);
+        }
+      }
+      return *p;
+    }
+
+  private:
+    static std::atomic<StreamPool<Cuda>*>* pools()
+    {
+      static std::unique_ptr<std::atomic<StreamPool<Cuda>*>[]> p = [] {
+        std::unique_ptr<std::atomic<StreamPool<Cuda>*>[]> a(
+            new std::atomic<StreamPool<Cuda>*>[num_devices()]);
+        for (int d = 0; d < num_devices(); ++d) {
+          a[d].store(nullptr, std::memory_order_relaxed);
+        }
+        return a;
+      }();
+      return p.get();
+    }
+  };
+#endif
+
+#if defined(RAJA_HIP_ACTIVE)
+  template <>
+  struct device_select<Hip>
+  {
+    //! number of streams of each device handed out by resource
+    static constexpr size_t streams_per_device = 4;
+
+    static int num_devices()
+    {
+      static const int num = [] {
+        int n = 0;
+        hipErrchk(hipGetDeviceCount(&n));
+        return n;
+      }();
+      return num;
+    }
+
+    static int current()
+    {
+      int device = 0;
+      hipErrchk(hipGetDevice(&device));
+      return device;
+    }
+
+    static void set(int device) { hipErrchk(hipSetDevice(device)); }
+
+    //! next of the streams of device, round-robin
+    static Hip resource(int device) { return pool(device).get(); }
+
+    //! device of a resource from resource(), -1 for other resources
+    static int device_of(Hip& res)
+    {
+      hipStream_t stream = res.get_stream();
+      for (int d = 0; d < num_devices(); ++d) {
+        StreamPool<Hip>* p = pools()[d].load(std::memory_order_acquire);
+        for (size_t i = 0; p != nullptr && i < p->size(); ++i) {
+          if ((*p)[i].get_stream() == stream) {
+            return d;
+          }
+        }
+      }
+      return -1;
+    }
+
+    //! streams of device, created with device current on first use
+    static StreamPool<Hip>& pool(int device)
+    {
+      if (device < 0 || device >= num_devices()) {
+        RAJA_ABORT_OR_THROW("RAJA::resources::device_select: invalid device");
+      }
+      StreamPool<Hip>* p = pools()[device].load(std::memory_order_acquire);
+      if (p == nullptr) {
+        static std::mutex create_mutex;
+        std::lock_guard<std::mutex> lock(create_mutex);
+        p = pools()[device].load(std::memory_order_relaxed);
+        if (p == nullptr) {
+          const int prev = current();
+          set(device);
+          // never freed, like the streams camp hands out
+          p = new StreamPool<Hip>(streams_per_device);
+          set(prev);
+          pools()[device].store(p, std::memory_order_release);
+        }
+      }
+      return *p;
+    }
+
+  private:
+    static std::atomic<StreamPool<Hip>*>* pools()
+    {
+      static std::unique_ptr<std::atomic<StreamPool<Hip>*>[]> p = [] {
+        std::unique_ptr<std::atomic<StreamPool<Hip>*>[]> a(
+            new std::atomic<StreamPool<Hip>*>[num_devices()]);
+        for (int d = 0; d < num_devices(); ++d) {
+          a[d].store(nullptr, std::memory_order_relaxed);
+        }
+        return a;
+      }();
+      return p.get();
+    }
+  };
+#endif
+
+  //! device that must be current to use res, -1 if any device will do
+  template <typename Res>
+  RAJA_INLINE int device_of(Res& res)
+  {
+    return device_select<Res>::device_of(res);
+  }
+
+  RAJA_INLINE int device_of(Resource& res)
+  {
+    switch (res.get_platform()) {
+#if defined(RAJA_CUDA_ACTIVE)
+      case Platform::cuda: {
+        Cuda typed = res.get<Cuda>();
+        return device_select<Cuda>::device_of(typed);
+      }
+#endif
+#if defined(RAJA_HIP_ACTIVE)
+      case Platform::hip: {
+        Hip typed = res.get<Hip>();
+        return device_select<Hip>::device_of(typed);
+      }
+#endif
+      default:
+        return -1;
+    }
+  }
+
+  /*!
+   * \brief Makes the device of a resource from device_select current while
+   *        it lives, and then the previous device again.
+   *
+   * The device is only set when it is not current already, and resources
+   * that are not bound to a device leave the current device alone, so
+   * scoping every launch costs nothing in single device runs.
+   */
+  class DeviceScope
+  {
+  public:
+    template <typename Res>
+    explicit DeviceScope(Res& res)
+        : m_platform(res.get_platform()), m_prev(-1)
+    {
+      const int device = device_of(res);
+      if (device >= 0) {
+        const int current = current_device(m_platform);
+        if (current != device) {
+          set_device(m_platform, device);
+          m_prev = current;
+        }
+      }
+    }
+
+    DeviceScope(DeviceScope const&) = delete;
+    DeviceScope& operator=(DeviceScope const&) = delete;
+
+    ~DeviceScope()
+    {
+      if (m_prev >= 0) {
+        set_device(m_platform, m_prev);
+      }
+    }
+
+  private:
+    static int current_device(Platform platform)
+    {
+      switch (platform) {
+#if defined(RAJA_CUDA_ACTIVE)
+        case Platform::cuda:
+          return device_select<Cuda>::current();
+#endif
+#if defined(RAJA_HIP_ACTIVE)
+        case Platform::hip:
+          return device_select<Hip>::current();
+#endif
+        default:
+          return -1;
+      }
+    }
+
+    static void set_device(Platform platform, int device)
+    {
+      switch (platform) {
+#if defined(RAJA_CUDA_ACTIVE)
+        case Platform::cuda:
+          device_select<Cuda>::set(device);
+          break;
+#endif
+#if defined(RAJA_HIP_ACTIVE)
+        case Platform::hip:
+          device_select<Hip>::set(device);
+          break;
+#endif
+        default:
+          break;
+      }
+    }
+
+    Platform m_platform;
+    int m_prev;
+  };
+
   } // end namespace resources
 
+  /*!
+   * \brief Events that a pattern taking a resource must wait for.
+   *
+   * The events may be camp events or the event proxies returned by RAJA
+   * patterns, e.g.
+   *
+   * \verbatim
+   *   auto e1 = RAJA::forall<RAJA::cuda_exec_async<256>>(res1, seg, body1);
+   *   auto e2 = RAJA::forall<RAJA::cuda_exec_async<256>>(res2, seg, body2);
+   *
+   *   resources::Event e3 = RAJA::forall<RAJA::cuda_exec_async<256>>(
+   *       res3, RAJA::depends_on(e1, e2), seg, body3);
+   * \endverbatim
+   */
+  template <typename... Events>
+  resources::Dependencies<sizeof...(Events)> depends_on(Events&&... events)
+  {
+    return resources::Dependencies<sizeof...(Events)>{
+        {{resources::Event(std::forward<Events>(events))...}}};
+  }
+
   namespace type_traits
   {
     template <typename T> struct is_resource : std::false_type {};
@@ -0,0 +1,398 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA SIMD sort templates for the host.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_simd_sort_HPP
+#define RAJA_util_simd_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/util/sort.hpp"
+
+#if defined(RAJA_ENABLE_VECTORIZATION) && defined(__AVX2__)
+#define RAJA_HAVE_SIMD_SORT
+#include "RAJA/pattern/tensor/stats.hpp"
+#include "RAJA/pattern/tensor/internal/RegisterBase.hpp"
+#include "RAJA/policy/tensor/arch_impl.hpp"
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+    \brief checks if the range can be sorted with the SIMD sort, which
+    supports pointers to the element types of the host SIMD registers with
+    RAJA::operators::less or RAJA::operators::greater
+*/
+template <typename Iter, typename Compare,
+          typename T = typename std::remove_cv<IterVal<Iter>>::type>
+struct can_simd_sort
+    : std::integral_constant<bool,
+#if defined(RAJA_HAVE_SIMD_SORT)
+          std::is_pointer<Iter>::value &&
+          (std::is_same<T, float>::value ||
+           std::is_same<T, double>::value ||
+           std::is_same<T, std::int32_t>::value ||
+           std::is_same<T, std::int64_t>::value) &&
+          (std::is_same<Compare, operators::less<T>>::value ||
+           std::is_same<Compare, operators::greater<T>>::value)
+#else
+          false
+#endif
+          >
+{
+};
+
+#if defined(RAJA_HAVE_SIMD_SORT)
+
+/*!
+    \brief sorting network that sorts small ranges in SIMD registers
+
+    The range is loaded into num_registers registers and padded with the
+    largest value in the sort order. An odd-even merge sort network of
+    register min and max sorts each register lane. The registers are then
+    stored transposed, which makes each lane a contiguous sorted run, and
+    the runs are merged with branchless scalar merges.
+*/
+template <typename T, bool Descending>
+struct simd_sort_network
+{
+  using register_type = RAJA::expt::Register<T, RAJA::expt::default_register>;
+
+  static constexpr camp::idx_t num_lanes = register_type::s_num_elem;
+
+  static constexpr camp::idx_t num_registers = 16;
+
+  static constexpr camp::idx_t max_size = num_lanes * num_registers;
+
+  RAJA_INLINE
+  static bool comp(T const& lhs, T const& rhs)
+  {
+    return Descending ? (rhs < lhs) : (lhs < rhs);
+  }
+
+  RAJA_INLINE
+  static T padding()
+  {
+    return Descending
+        ? (std::numeric_limits<T>::has_infinity
+              ? -std::numeric_limits<T>::infinity()
+              : std::numeric_limits<T>::lowest())
+        : (std::numeric_limits<T>::has_infinity
+              ? std::numeric_limits<T>::infinity()
+              : std::numeric_limits<T>::max());
+  }
+
+  RAJA_INLINE
+  static void compare_exchange(register_type& a, register_type& b)
+  {
+    register_type lo = a.vmin(b);
+    register_type hi = a.vmax(b);
+    a = Descending ? hi : lo;
+    b = Descending ? lo : hi;
+  }
+
+  /*!
+      \brief merge sorted runs [a, a+len) and [b, b+len) into out,
+      merging from the front and the back at the same time
+  */
+  RAJA_INLINE
+  static void merge(T const* a, T const* b, camp::idx_t len, T* out)
+  {
+    T const* a_back = a + len - 1;
+    T const* b_back = b + len - 1;
+    T* out_back = out + 2*len - 1;
+    for (camp::idx_t i = 0; i < len; ++i) {
+      const bool front_b = comp(*b, *a);
+      *out++ = front_b ? *b : *a;
+      b += front_b;
+      a += !front_b;
+
+      const bool back_a = comp(*b_back, *a_back);
+      *out_back-- = back_a ? *a_back : *b_back;
+      a_back -= back_a;
+      b_back -= !back_a;
+    }
+  }
+
+  /*!
+      \brief register indices of the c-th compare exchange of Batcher's
+      odd-even merge sort network, returns the number of compare exchanges
+      if there is no c-th one
+  */
+  static constexpr camp::idx_t network_comparator(camp::idx_t c, bool rhs)
+  {
+    camp::idx_t count = 0;
+    for (camp::idx_t p = 1; p < num_registers; p *= 2) {
+      for (camp::idx_t k = p; k >= 1; k /= 2) {
+        for (camp::idx_t j = k % p; j + k < num_registers; j += 2*k) {
+          for (camp::idx_t i = 0; i < k && i + j + k < num_registers; ++i) {
+            if ((i + j) / (2*p) == (i + j + k) / (2*p)) {
+              if (count == c) {
+                return rhs ? i + j + k : i + j;
+              }
+              ++count;
+            }
+          }
+        }
+      }
+    }
+    return count;
+  }
+
+  static constexpr camp::idx_t num_comparators()
+  {
+    return network_comparator(-1, false);
+  }
+
+  /*!
+      \brief apply the network with compile time register indices so the
+      registers are not spilled to memory
+  */
+  template <camp::idx_t... Cs>
+  RAJA_INLINE
+  static void apply_network(register_type* regs, camp::idx_seq<Cs...>)
+  {
+    int unused[] = {0, (compare_exchange(
+        regs[std::integral_constant<camp::idx_t, network_comparator(Cs, false)>::value],
+        regs[std::integral_constant<camp::idx_t, network_comparator(Cs, true)>::value]), 0)...};
+    RAJA_UNUSED_VAR(unused);
+  }
+
+  /*!
+      \brief sort range of at most max_size elements
+  */
+  RAJA_INLINE
+  static void sort(T* begin, T* end)
+  {
+    const camp::idx_t n = end - begin;
+
+    alignas(64) T buf[max_size];
+    alignas(64) T tmp[max_size];
+
+    for (camp::idx_t i = 0; i < n; ++i) {
+      buf[i] = begin[i];
+    }
+    for (camp::idx_t i = n; i < max_size; ++i) {
+      buf[i] = padding();
+    }
+
+    register_type regs[num_registers];
+    for (camp::idx_t r = 0; r < num_registers; ++r) {
+      regs[r].load_packed(buf + r*num_lanes);
+    }
+
+    // sort each lane across the registers
+    apply_network(regs, camp::make_idx_seq_t<num_comparators()>{});
+
+    // transpose, lane l becomes the sorted run [l*num_registers, (l+1)*num_registers)
+    for (camp::idx_t r = 0; r < num_registers; ++r) {
+      regs[r].store_strided(buf + r, num_registers);
+    }
+
+    // merge the runs
+    T* src = buf;
+    T* dst = tmp;
+    for (camp::idx_t run = num_registers; run < max_size; run *= 2) {
+      for (camp::idx_t b = 0; b < max_size; b += 2*run) {
+        merge(src + b, src + b + run, run, dst + b);
+      }
+      T* t = src; src = dst; dst = t;
+    }
+
+    for (camp::idx_t i = 0; i < n; ++i) {
+      begin[i] = src[i];
+    }
+  }
+};
+
+/*!
+    \brief unstable intro sort given range inplace using the SIMD sorting
+    network for small partitions, with limited depth.
+*/
+template <bool Descending, typename T>
+inline
+void
+simd_intro_sort_depth(T* begin,
+                      T* end,
+                      unsigned depth)
+{
+  using RAJA::safe_iter_swap;
+  using network = simd_sort_network<T, Descending>;
+  using diff_type = ::RAJA::detail::IterDiff<T*>;
+
+  auto comp = [](T const& lhs, T const& rhs) {
+    return network::comp(lhs, rhs);
+  };
+
+  diff_type N = end - begin;
+
+  // cutoff to use insertion sort, padding costs more than it saves
+  constexpr diff_type insertion_sort_cutoff = network::num_lanes;
+
+  if (N < 2) {
+
+    // already sorted
+
+  } else if (N <= insertion_sort_cutoff) {
+
+    detail::insertion_sort(begin, end, comp);
+
+  } else if (N <= network::max_size) {
+
+    // use sorting network for small inputs
+    network::sort(begin, end);
+
+  } else if (depth == 0) {
+
+    // use heap sort if recurse too deep
+    detail::heap_sort(begin, end, comp);
+
+  } else {
+
+    // use quick sort
+    // choose pivot with median of 3
+    T* mid = begin + N/2;
+    T* last = end-1;
+    T* pivot = comp(*begin, *mid)
+                  ? ( comp(*mid, *last)
+                         ? mid
+                         : ( comp(*begin, *last)
+                                ? last
+                                : begin ) )
+                  : ( comp(*mid, *last)
+                         ? ( comp(*begin, *last)
+                                ? begin
+                                : last )
+                         : mid );
+
+    // swap pivot to last
+    if (pivot != last) {
+      safe_iter_swap(pivot, last);
+      pivot = last;
+    }
+
+    // branchless partition, the pivot value stays in last
+    const T pivot_value = *pivot;
+    mid = begin;
+    for (T* it = begin; it != last; ++it) {
+      const T value = *it;
+      const bool before = comp(value, pivot_value);
+      *it = *mid;
+      *mid = value;
+      mid += before;
+    }
+
+    // swap pivot to sorted position
+    if (mid != pivot) {
+      safe_iter_swap(mid, pivot);
+      pivot = mid;
+    }
+
+    // recurse to sort first and second parts, ignoring already sorted pivot
+    detail::simd_intro_sort_depth<Descending>(begin, pivot, depth-1);
+    detail::simd_intro_sort_depth<Descending>(pivot+1, end, depth-1);
+  }
+}
+
+#endif
+
+/*!
+    \brief unstable intro sort given range inplace using comparison function,
+    uses the SIMD sorting network for small partitions if possible
+*/
+template <typename Iter, typename Compare>
+inline
+concepts::enable_if<can_simd_sort<Iter, Compare>>
+simd_intro_sort(Iter begin,
+                Iter end,
+                Compare)
+{
+#if defined(RAJA_HAVE_SIMD_SORT)
+  using T = typename std::remove_cv<IterVal<Iter>>::type;
+
+  // set max depth to 2*lg(N)
+  unsigned max_depth = 2*detail::ulog2(end - begin);
+
+  detail::simd_intro_sort_depth<
+      std::is_same<Compare, operators::greater<T>>::value>(
+          begin, end, max_depth);
+#else
+  RAJA_UNUSED_VAR(begin, end);
+#endif
+}
+///
+template <typename Iter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<can_simd_sort<Iter, Compare>>>
+simd_intro_sort(Iter begin,
+                Iter end,
+                Compare comp)
+{
+  detail::intro_sort(begin, end, comp);
+}
+
+}  // namespace detail
+
+/*!
+    \brief unstable intro sort given range inplace using comparison function,
+    uses SIMD sorting networks for small partitions of arithmetic keys
+    compared with RAJA::operators::less or RAJA::operators::greater when host
+    SIMD registers are available and falls back to intro_sort otherwise
+*/
+template <typename Container,
+          typename Compare = operators::less<detail::ContainerVal<Container>>>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_range<Container>>
+simd_sort(Container&& c,
+          Compare comp = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+
+  if (begin_it != end_it) {
+    auto next = begin_it;
+    if (++next != end_it) {
+      detail::simd_intro_sort(begin_it, end_it, comp);
+    }
+  }
+}
+
+}  // namespace RAJA
+
+#endif
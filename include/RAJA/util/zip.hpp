@@ -195,6 +195,12 @@ struct ZipIterator
     detail::zip_for_each(lhs.m_iterators, rhs.m_iterators, detail::IterSwap{});
   }
 
+  //! the zipped iterators
+  RAJA_HOST_DEVICE inline zip_val<camp::decay<Iters>...> const& get_iterators() const
+  {
+    return m_iterators;
+  }
+
 private:
   zip_val<camp::decay<Iters>...> m_iterators;
 
@@ -218,6 +224,22 @@ auto zip(Args&&... args)
   return {std::forward<Args>(args)...};
 }
 
+namespace detail
+{
+
+/*!
+    \brief True for a ZipIterator of pointers, whose arrays device sorts
+    reorder directly.
+*/
+template < typename T >
+struct is_pointer_zip_iterator : std::false_type { };
+///
+template < typename... Iters >
+struct is_pointer_zip_iterator<ZipIterator<Iters...>>
+  : concepts::all_of<std::is_pointer<Iters>...> { };
+
+}  // end namespace detail
+
 /*!
     \brief Zip multiple containers together to iterate them simultaneously with
     ZipIterator objects.
@@ -268,6 +290,44 @@ auto compare_first(Compare comp)
   return {comp};
 }
 
+/*!
+    \brief Binary operator on zip values that applies Ops to the members,
+    the first to the first members and so on.
+
+    Scanning zipped ranges with it scans several arrays in one pass:
+
+      RAJA::inclusive_scan_inplace<RAJA::cuda_exec<256>>(
+          RAJA::zip_span(counts, sums),
+          RAJA::ZipOp<RAJA::operators::plus<int>,
+                      RAJA::operators::maximum<double>>{});
+
+    identity() is the zip of the identities of Ops.
+*/
+template < typename... Ops >
+struct ZipOp
+{
+  using value_type = zip_val<typename Ops::result_type...>;
+
+  template < typename Lhs, typename Rhs >
+  RAJA_HOST_DEVICE inline value_type operator()(Lhs const& lhs, Rhs const& rhs) const
+  {
+    return apply(lhs, rhs, camp::make_idx_seq_t<sizeof...(Ops)>{});
+  }
+
+  RAJA_HOST_DEVICE static inline value_type identity()
+  {
+    return value_type(Ops::identity()...);
+  }
+
+private:
+  template < typename Lhs, typename Rhs, camp::idx_t... Is >
+  RAJA_HOST_DEVICE inline value_type apply(Lhs const& lhs, Rhs const& rhs,
+                                           camp::idx_seq<Is...>) const
+  {
+    return value_type(Ops{}(RAJA::get<Is>(lhs), RAJA::get<Is>(rhs))...);
+  }
+};
+
 }  // end namespace RAJA
 
 #endif
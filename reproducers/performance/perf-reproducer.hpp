@@ -0,0 +1,288 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Shared parts of the performance reproducers.
+///
+/// Each reproducer times a minimal kernel on the first enabled of the CUDA,
+/// HIP, OpenMP and sequential back-ends and compares the best time of
+/// several runs against its entry in a baseline JSON file, a flat object of
+/// reproducer names and times in seconds:
+///
+///   {
+///     "reproducer-perf-sort": 0.8125,
+///     "reproducer-perf-workgroup": 0.0031
+///   }
+///
+/// Arguments:
+///
+///   --baseline <file>   compare against the entry of the reproducer in file
+///   --threshold <x>     fail when slower than x times the baseline (1.2)
+///   --record <file>     set the entry of the reproducer in file to this run
+///   --size <n>          problem size, for machines too small for the default
+///   --reps <n>          number of timed runs (5)
+///
+/// A reproducer without a baseline entry reports its time and passes.
+///
+
+#ifndef RAJA_REPRODUCERS_PERF_REPRODUCER_HPP
+#define RAJA_REPRODUCERS_PERF_REPRODUCER_HPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+
+#include "RAJA/RAJA.hpp"
+
+namespace perf
+{
+
+//
+// Policies of the back-end the reproducers run on.
+//
+#if defined(RAJA_ENABLE_CUDA)
+
+constexpr int block_size = 256;
+constexpr const char* backend_name = "CUDA";
+
+using resource = camp::resources::Cuda;
+using exec_policy = RAJA::cuda_exec<block_size>;
+using reduce_policy = RAJA::cuda_reduce;
+using segit_policy = RAJA::ExecPolicy<RAJA::seq_segit, exec_policy>;
+using workgroup_policy = RAJA::WorkGroupPolicy<
+                             RAJA::cuda_work<block_size>,
+                             RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+                             RAJA::constant_stride_array_of_objects,
+                             RAJA::indirect_function_call_dispatch>;
+
+#elif defined(RAJA_ENABLE_HIP)
+
+constexpr int block_size = 256;
+constexpr const char* backend_name = "HIP";
+
+using resource = camp::resources::Hip;
+using exec_policy = RAJA::hip_exec<block_size>;
+using reduce_policy = RAJA::hip_reduce;
+using segit_policy = RAJA::ExecPolicy<RAJA::seq_segit, exec_policy>;
+using workgroup_policy = RAJA::WorkGroupPolicy<
+                             RAJA::hip_work<block_size>,
+                             RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average,
+                             RAJA::constant_stride_array_of_objects,
+                             RAJA::indirect_function_call_dispatch>;
+
+#elif defined(RAJA_ENABLE_OPENMP)
+
+constexpr const char* backend_name = "OpenMP";
+
+using resource = camp::resources::Host;
+using exec_policy = RAJA::omp_parallel_for_exec;
+using reduce_policy = RAJA::omp_reduce;
+using segit_policy = RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>;
+using workgroup_policy = RAJA::WorkGroupPolicy<
+                             RAJA::omp_work,
+                             RAJA::ordered,
+                             RAJA::ragged_array_of_objects,
+                             RAJA::indirect_function_call_dispatch>;
+
+#else
+
+constexpr const char* backend_name = "sequential";
+
+using resource = camp::resources::Host;
+using exec_policy = RAJA::seq_exec;
+using reduce_policy = RAJA::seq_reduce;
+using segit_policy = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>;
+using workgroup_policy = RAJA::WorkGroupPolicy<
+                             RAJA::seq_work,
+                             RAJA::ordered,
+                             RAJA::ragged_array_of_objects,
+                             RAJA::indirect_function_call_dispatch>;
+
+#endif
+
+//
+// Memory reachable from the host and the back-end, freed at the end of the
+// reproducer.
+//
+template <typename T>
+struct Array {
+  explicit Array(long len)
+      : res(resource::get_default()),
+        ptr(res.template allocate<T>(len, camp::resources::MemoryAccess::Managed))
+  {
+  }
+
+  ~Array() { res.deallocate(ptr, camp::resources::MemoryAccess::Managed); }
+
+  Array(Array const&) = delete;
+  Array& operator=(Array const&) = delete;
+
+  resource res;
+  T* ptr;
+};
+
+//
+// Reads the flat baseline object of file into entries, returns false if
+// the file can not be read.
+//
+inline bool read_baseline(std::string const& file,
+                          std::map<std::string, double>& entries)
+{
+  std::ifstream in(file);
+  if (!in) {
+    return false;
+  }
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+
+  size_t pos = 0;
+  while ((pos = text.find('"', pos)) != std::string::npos) {
+    size_t name_end = text.find('"', pos + 1);
+    size_t colon = text.find(':', name_end);
+    if (name_end == std::string::npos || colon == std::string::npos) {
+      break;
+    }
+    entries[text.substr(pos + 1, name_end - pos - 1)] =
+        std::strtod(text.c_str() + colon + 1, nullptr);
+    pos = text.find_first_of(",}", colon);
+  }
+  return true;
+}
+
+inline bool write_baseline(std::string const& file,
+                           std::map<std::string, double> const& entries)
+{
+  std::ofstream out(file);
+  out << "{\n";
+  size_t n = 0;
+  for (auto const& entry : entries) {
+    char seconds[32];
+    std::snprintf(seconds, sizeof(seconds), "%.6g", entry.second);
+    out << "  \"" << entry.first << "\": " << seconds
+        << (++n < entries.size() ? ",\n" : "\n");
+  }
+  out << "}\n";
+  return static_cast<bool>(out);
+}
+
+//
+// Arguments, timing and the baseline comparison of a reproducer.
+//
+class Reproducer
+{
+public:
+  Reproducer(const char* name, int argc, char** argv, long default_size)
+      : m_name(name), m_size(default_size)
+  {
+    for (int i = 1; i + 1 < argc; i += 2) {
+      if (std::strcmp(argv[i], "--baseline") == 0) {
+        m_baseline = argv[i + 1];
+      } else if (std::strcmp(argv[i], "--threshold") == 0) {
+        m_threshold = std::strtod(argv[i + 1], nullptr);
+      } else if (std::strcmp(argv[i], "--record") == 0) {
+        m_record = argv[i + 1];
+      } else if (std::strcmp(argv[i], "--size") == 0) {
+        m_size = std::strtol(argv[i + 1], nullptr, 10);
+      } else if (std::strcmp(argv[i], "--reps") == 0) {
+        m_reps = static_cast<int>(std::strtol(argv[i + 1], nullptr, 10));
+      } else {
+        std::fprintf(stderr, "%s: unknown argument %s\n", name, argv[i]);
+      }
+    }
+    std::printf("%s: %s back-end, size %ld\n", name, backend_name, m_size);
+  }
+
+  long size() const { return m_size; }
+
+  //! Best time in seconds of the runs of kernel, which must wait for the
+  //! work it starts
+  template <typename Kernel>
+  double time(Kernel&& kernel) const
+  {
+    return time([]() {}, kernel);
+  }
+
+  //! Best time in seconds of the runs of kernel, each after an untimed call
+  //! of setup
+  template <typename Setup, typename Kernel>
+  double time(Setup&& setup, Kernel&& kernel) const
+  {
+    double best = 0.0;
+    for (int r = 0; r < m_reps; ++r) {
+      setup();
+      RAJA::Timer timer;
+      timer.start();
+      kernel();
+      timer.stop();
+      double seconds = static_cast<double>(timer.elapsed());
+      if (r == 0 || seconds < best) {
+        best = seconds;
+      }
+    }
+    return best;
+  }
+
+  //! Reports seconds, records it and compares it against the baseline,
+  //! returns the exit code of the reproducer
+  int finish(double seconds, bool correct) const
+  {
+    std::printf("%s: %.6g s\n", m_name, seconds);
+    if (!correct) {
+      std::printf("%s: FAILED, wrong result\n", m_name);
+      return EXIT_FAILURE;
+    }
+
+    if (!m_record.empty()) {
+      std::map<std::string, double> entries;
+      read_baseline(m_record, entries);
+      entries[m_name] = seconds;
+      if (!write_baseline(m_record, entries)) {
+        std::printf("%s: FAILED, can not write %s\n", m_name, m_record.c_str());
+        return EXIT_FAILURE;
+      }
+    }
+
+    if (m_baseline.empty()) {
+      return EXIT_SUCCESS;
+    }
+    std::map<std::string, double> entries;
+    if (!read_baseline(m_baseline, entries)) {
+      std::printf("%s: FAILED, can not read %s\n", m_name, m_baseline.c_str());
+      return EXIT_FAILURE;
+    }
+    auto entry = entries.find(m_name);
+    if (entry == entries.end() || !(entry->second > 0.0)) {
+      std::printf("%s: no baseline in %s\n", m_name, m_baseline.c_str());
+      return EXIT_SUCCESS;
+    }
+
+    double ratio = seconds / entry->second;
+    std::printf("%s: %.3g x baseline of %.6g s, threshold %.3g\n",
+                m_name, ratio, entry->second, m_threshold);
+    if (ratio > m_threshold) {
+      std::printf("%s: FAILED, slower than the baseline\n", m_name);
+      return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+  }
+
+private:
+  const char* m_name;
+  long m_size;
+  int m_reps = 5;
+  double m_threshold = 1.2;
+  std::string m_baseline;
+  std::string m_record;
+};
+
+}  // namespace perf
+
+#endif  // RAJA_REPRODUCERS_PERF_REPRODUCER_HPP
@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "perf-reproducer.hpp"
+
+/*
+ *  Performance reproducer for building an IndexSet of many small
+ *  ListSegments and running a forall over it. Each ListSegment copies its
+ *  indices to the back-end and each segment is a separate loop, so the
+ *  time is mostly per segment overhead.
+ *
+ *  The size is the number of segments.
+ */
+
+int main(int argc, char** argv)
+{
+  perf::Reproducer rep("reproducer-perf-listsegment-indexset", argc, argv, 10000);
+
+  const int num_segments = static_cast<int>(rep.size());
+  const int seg_len = 16;
+  const int len = num_segments * seg_len;
+
+  // each segment is a block of indices in reverse, so it is not a range
+  std::vector<int> indices(len);
+  for (int i = 0; i < len; ++i) {
+    indices[i] = (i / seg_len) * seg_len + seg_len - 1 - i % seg_len;
+  }
+
+  perf::Array<int> x(len);
+  int* px = x.ptr;
+  camp::resources::Resource res{perf::resource::get_default()};
+
+  double seconds = rep.time([&]() {
+    RAJA::TypedIndexSet<RAJA::TypedListSegment<int>> iset;
+    for (int s = 0; s < num_segments; ++s) {
+      iset.push_back(
+          RAJA::TypedListSegment<int>(&indices[s * seg_len], seg_len, res));
+    }
+    RAJA::forall<perf::segit_policy>(iset,
+      [=] RAJA_HOST_DEVICE (int i) { px[i] = i; });
+    res.wait();
+  });
+
+  bool correct = true;
+  for (int i = 0; i < len; ++i) {
+    correct = correct && px[i] == i;
+  }
+
+  return rep.finish(seconds, correct);
+}
@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "perf-reproducer.hpp"
+
+/*
+ *  Performance reproducer for a forall with several expt::MultiReduce
+ *  params of many bins each, which privatize and combine every bin of
+ *  every param.
+ *
+ *  The size is the length of the loop.
+ */
+
+int main(int argc, char** argv)
+{
+  perf::Reproducer rep("reproducer-perf-multireduce", argc, argv, 10000000);
+
+  const int num_bins = 64;
+  const RAJA::Index_type len = rep.size() / num_bins * num_bins;
+
+  perf::Array<double> a(len);
+  double* pa = a.ptr;
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    pa[i] = static_cast<double>(i);
+  }
+
+  std::vector<double> sums(num_bins);
+  std::vector<double> maxs(num_bins);
+  std::vector<double> mins(num_bins);
+
+  using sum_bins = RAJA::expt::MultiReduceBins<RAJA::operators::plus, double>;
+  using max_bins = RAJA::expt::MultiReduceBins<RAJA::operators::maximum, double>;
+  using min_bins = RAJA::expt::MultiReduceBins<RAJA::operators::minimum, double>;
+
+  double seconds = rep.time(
+    [&]() {
+      for (int b = 0; b < num_bins; ++b) {
+        sums[b] = 0.0;
+        maxs[b] = -1.0;
+        mins[b] = static_cast<double>(len);
+      }
+    },
+    [&]() {
+      RAJA::forall<perf::exec_policy>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+        RAJA::expt::MultiReduce<RAJA::operators::plus>(sums.data(), num_bins),
+        RAJA::expt::MultiReduce<RAJA::operators::maximum>(maxs.data(), num_bins),
+        RAJA::expt::MultiReduce<RAJA::operators::minimum>(mins.data(), num_bins),
+        [=] RAJA_HOST_DEVICE (RAJA::Index_type i,
+                              sum_bins& s, max_bins& mx, min_bins& mn) {
+          int b = static_cast<int>(i % num_bins);
+          s[b] += 1.0;
+          mx[b].max(pa[i]);
+          mn[b].min(pa[i]);
+        });
+    });
+
+  bool correct = true;
+  for (int b = 0; b < num_bins; ++b) {
+    correct = correct && sums[b] == static_cast<double>(len / num_bins) &&
+              maxs[b] == static_cast<double>(len - num_bins + b) &&
+              mins[b] == static_cast<double>(b);
+  }
+
+  return rep.finish(seconds, correct);
+}
@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "perf-reproducer.hpp"
+
+/*
+ *  Performance reproducer for a loop that does little besides updating
+ *  many reducer objects, which makes the cost of the reducers themselves
+ *  visible: their copies into the loop body, their per thread storage and
+ *  the final combine.
+ *
+ *  The size is the length of the loop.
+ */
+
+int main(int argc, char** argv)
+{
+  perf::Reproducer rep("reproducer-perf-reducers", argc, argv, 10000000);
+
+  // the values repeat every 1000 indices and sum to 0 over each repeat
+  const RAJA::Index_type len = rep.size() / 1000 * 1000;
+
+  perf::Array<double> a(len);
+  double* pa = a.ptr;
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    pa[i] = static_cast<double>(i % 1000) - 499.5;
+  }
+
+  double sum_val = 1.0;
+  double min_val = 0.0;
+  double max_val = 0.0;
+  RAJA::Index_type min_loc = -1;
+  RAJA::Index_type max_loc = -1;
+  RAJA::Index_type num_pos = 0;
+
+  double seconds = rep.time([&]() {
+    RAJA::ReduceSum<perf::reduce_policy, double> sum(0.0);
+    RAJA::ReduceMin<perf::reduce_policy, double> min(1.0e100);
+    RAJA::ReduceMax<perf::reduce_policy, double> max(-1.0e100);
+    RAJA::ReduceMinLoc<perf::reduce_policy, double> minloc(1.0e100, -1);
+    RAJA::ReduceMaxLoc<perf::reduce_policy, double> maxloc(-1.0e100, -1);
+    RAJA::ReduceSum<perf::reduce_policy, RAJA::Index_type> pos(0);
+
+    RAJA::forall<perf::exec_policy>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+      [=] RAJA_HOST_DEVICE (RAJA::Index_type i) {
+        sum += pa[i];
+        min.min(pa[i]);
+        max.max(pa[i]);
+        minloc.minloc(pa[i], i);
+        maxloc.maxloc(pa[i], i);
+        if (pa[i] > 0.0) {
+          pos += 1;
+        }
+      });
+
+    sum_val = sum.get();
+    min_val = min.get();
+    max_val = max.get();
+    min_loc = minloc.getLoc();
+    max_loc = maxloc.getLoc();
+    num_pos = pos.get();
+  });
+
+  bool correct = sum_val == 0.0 && min_val == -499.5 && max_val == 499.5 &&
+                 min_loc >= 0 && min_loc < len && pa[min_loc] == min_val &&
+                 max_loc >= 0 && max_loc < len && pa[max_loc] == max_val &&
+                 num_pos == len / 2;
+
+  return rep.finish(seconds, correct);
+}
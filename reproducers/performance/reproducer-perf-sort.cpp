@@ -0,0 +1,45 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "perf-reproducer.hpp"
+
+/*
+ *  Performance reproducer for RAJA::sort of 1e8 unsigned keys in
+ *  pseudo-random order.
+ *
+ *  The size is the number of keys.
+ */
+
+int main(int argc, char** argv)
+{
+  perf::Reproducer rep("reproducer-perf-sort", argc, argv, 100000000);
+
+  const RAJA::Index_type len = rep.size();
+
+  perf::Array<unsigned> keys(len);
+  unsigned* pk = keys.ptr;
+
+  double seconds = rep.time(
+    [&]() {
+      RAJA::forall<perf::exec_policy>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+        [=] RAJA_HOST_DEVICE (RAJA::Index_type i) {
+          pk[i] = static_cast<unsigned>(i) * 2654435761u;
+        });
+      perf::resource::get_default().wait();
+    },
+    [&]() {
+      RAJA::sort<perf::exec_policy>(RAJA::make_span(pk, len));
+      perf::resource::get_default().wait();
+    });
+
+  bool correct = true;
+  for (RAJA::Index_type i = 1; i < len; ++i) {
+    correct = correct && pk[i - 1] <= pk[i];
+  }
+
+  return rep.finish(seconds, correct);
+}
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <limits>
+#include <new>
+
+#include "perf-reproducer.hpp"
+
+/*
+ *  Performance reproducer for a WorkGroup of thousands of small loops:
+ *  enqueueing them, instantiating the group and running it.
+ *
+ *  The size is the number of loops.
+ */
+
+//
+// Allocator of the WorkGroup storage, which the back-end reads.
+//
+template <typename T>
+struct ManagedAllocator {
+  using value_type = T;
+
+  ManagedAllocator() = default;
+
+  template <typename U>
+  ManagedAllocator(ManagedAllocator<U> const&) noexcept
+  {
+  }
+
+  value_type* allocate(size_t num)
+  {
+    if (num > std::numeric_limits<size_t>::max() / sizeof(value_type)) {
+      throw std::bad_alloc();
+    }
+    value_type* ptr = perf::resource::get_default().template allocate<value_type>(
+        num, camp::resources::MemoryAccess::Managed);
+    if (!ptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void deallocate(value_type* ptr, size_t) noexcept
+  {
+    perf::resource::get_default().deallocate(
+        ptr, camp::resources::MemoryAccess::Managed);
+  }
+
+  template <typename U>
+  friend inline bool operator==(ManagedAllocator const&,
+                                ManagedAllocator<U> const&)
+  {
+    return true;
+  }
+
+  template <typename U>
+  friend inline bool operator!=(ManagedAllocator const&,
+                                ManagedAllocator<U> const&)
+  {
+    return false;
+  }
+};
+
+int main(int argc, char** argv)
+{
+  perf::Reproducer rep("reproducer-perf-workgroup", argc, argv, 4096);
+
+  const int num_loops = static_cast<int>(rep.size());
+  const int loop_len = 64;
+
+  perf::Array<int> x(num_loops * loop_len);
+  int* px = x.ptr;
+
+  using allocator = ManagedAllocator<char>;
+  using workpool = RAJA::WorkPool<perf::workgroup_policy,
+                                  int,
+                                  RAJA::xargs<>,
+                                  allocator>;
+
+  workpool pool(allocator{});
+
+  double seconds = rep.time([&]() {
+    for (int l = 0; l < num_loops; ++l) {
+      int* pl = px + l * loop_len;
+      pool.enqueue(RAJA::TypedRangeSegment<int>(0, loop_len),
+        [=] RAJA_HOST_DEVICE (int i) { pl[i] = l + i; });
+    }
+    auto group = pool.instantiate();
+    auto site = group.run();
+    perf::resource::get_default().wait();
+  });
+
+  bool correct = true;
+  for (int l = 0; l < num_loops; ++l) {
+    for (int i = 0; i < loop_len; ++i) {
+      correct = correct && px[l * loop_len + i] == l + i;
+    }
+  }
+
+  return rep.finish(seconds, correct);
+}
@@ -0,0 +1,251 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/BatchedPlugins.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+BatchedPlugins* registered_batcher = nullptr;
+
+}  // end anonymous namespace
+
+struct BatchedPlugins::Impl {
+  struct Entry {
+    std::unique_ptr<PluginStrategy> plugin;
+    BatchOptions opts;
+    std::atomic<long long> count{0};
+  };
+
+  //! a context in the ring buffer, seq tells who may use the slot next
+  struct Slot {
+    Slot() : context(Platform::undefined) {}
+
+    std::atomic<unsigned long> seq{0};
+    PluginContext context;
+    std::uint32_t plugins = 0;
+  };
+
+  static_assert(max_plugins <= 32, "plugin masks are 32 bits");
+  static_assert((capacity & (capacity - 1)) == 0,
+                "capacity must be a power of 2");
+
+  // entries are written before num_entries is increased past them and never
+  // change after, so launching threads read them without a lock
+  Entry entries[max_plugins];
+  std::atomic<int> num_entries{0};
+  std::mutex add_mutex;
+
+  Slot slots[capacity];
+  std::atomic<unsigned long> enqueue_pos{0};
+  unsigned long dequeue_pos = 0;
+
+  std::atomic<long long> queued{0};
+  std::atomic<long long> processed{0};
+  std::atomic<long long> dropped{0};
+
+  std::mutex consumer_mutex;
+  std::thread consumer;
+  std::atomic<bool> running{false};
+
+  Impl()
+  {
+    for (unsigned long i = 0; i < capacity; ++i) {
+      slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  //! called by the launching threads, never waits
+  void push(const PluginContext& p, std::uint32_t plugins)
+  {
+    unsigned long pos = enqueue_pos.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+      slot = &slots[pos & (capacity - 1)];
+      const unsigned long seq = slot->seq.load(std::memory_order_acquire);
+      const long diff = static_cast<long>(seq) - static_cast<long>(pos);
+      if (diff == 0) {
+        if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                              std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    queued.fetch_add(1, std::memory_order_relaxed);
+    slot->context = p;
+    slot->plugins = plugins;
+    slot->seq.store(pos + 1, std::memory_order_release);
+  }
+
+  //! hand the queued contexts to the plugins, with consumer_mutex held
+  bool drain()
+  {
+    bool any = false;
+    for (;;) {
+      Slot& slot = slots[dequeue_pos & (capacity - 1)];
+      if (slot.seq.load(std::memory_order_acquire) != dequeue_pos + 1) {
+        return any;
+      }
+      const PluginContext context = slot.context;
+      const std::uint32_t plugins = slot.plugins;
+      slot.seq.store(dequeue_pos + capacity, std::memory_order_release);
+      ++dequeue_pos;
+
+      for (int i = 0; i < max_plugins; ++i) {
+        if (plugins & (std::uint32_t(1) << i)) {
+          entries[i].plugin->postLaunch(context);
+        }
+      }
+      processed.fetch_add(1, std::memory_order_release);
+      any = true;
+    }
+  }
+
+  void run()
+  {
+    const std::chrono::microseconds max_sleep(1000);
+    std::chrono::microseconds sleep(10);
+    while (running.load(std::memory_order_acquire)) {
+      bool any;
+      {
+        std::lock_guard<std::mutex> lock(consumer_mutex);
+        any = drain();
+      }
+      if (any) {
+        sleep = std::chrono::microseconds(10);
+      } else {
+        std::this_thread::sleep_for(sleep);
+        sleep = std::min(2 * sleep, max_sleep);
+      }
+    }
+  }
+
+  void start()
+  {
+    if (!running.exchange(true)) {
+      consumer = std::thread([this]() { run(); });
+    }
+  }
+
+  void stop()
+  {
+    if (running.exchange(false)) {
+      consumer.join();
+    }
+    std::lock_guard<std::mutex> lock(consumer_mutex);
+    drain();
+  }
+};
+
+BatchedPlugins::BatchedPlugins() : m_impl(new Impl)
+{
+  registered_batcher = this;
+}
+
+BatchedPlugins::~BatchedPlugins()
+{
+  m_impl->stop();
+  if (registered_batcher == this) registered_batcher = nullptr;
+}
+
+BatchedPlugins* BatchedPlugins::instance() { return registered_batcher; }
+
+void BatchedPlugins::init(const RAJA::util::PluginOptions& p)
+{
+  const int n = m_impl->num_entries.load(std::memory_order_acquire);
+  for (int i = 0; i < n; ++i) {
+    m_impl->entries[i].plugin->init(p);
+  }
+}
+
+void BatchedPlugins::postLaunch(const RAJA::util::PluginContext& p)
+{
+  const int n = m_impl->num_entries.load(std::memory_order_acquire);
+  if (n == 0) return;
+
+  std::uint32_t plugins = 0;
+  for (int i = 0; i < n; ++i) {
+    Impl::Entry& entry = m_impl->entries[i];
+    if (p.num_iterations >= 0 &&
+        p.num_iterations < entry.opts.min_iterations) {
+      continue;
+    }
+    if (entry.opts.every_nth > 1 &&
+        entry.count.fetch_add(1, std::memory_order_relaxed) %
+                entry.opts.every_nth != 0) {
+      continue;
+    }
+    plugins |= std::uint32_t(1) << i;
+  }
+
+  if (plugins != 0) m_impl->push(p, plugins);
+}
+
+void BatchedPlugins::finalize()
+{
+  m_impl->stop();
+  const int n = m_impl->num_entries.load(std::memory_order_acquire);
+  for (int i = 0; i < n; ++i) {
+    m_impl->entries[i].plugin->finalize();
+  }
+}
+
+bool BatchedPlugins::add(std::unique_ptr<PluginStrategy> plugin,
+                         BatchOptions opts)
+{
+  std::lock_guard<std::mutex> lock(m_impl->add_mutex);
+  const int n = m_impl->num_entries.load(std::memory_order_relaxed);
+  if (n == max_plugins || !plugin) return false;
+
+  m_impl->entries[n].plugin = std::move(plugin);
+  m_impl->entries[n].opts = opts;
+  m_impl->num_entries.store(n + 1, std::memory_order_release);
+  m_impl->start();
+  return true;
+}
+
+void BatchedPlugins::flush()
+{
+  const long long target = m_impl->queued.load(std::memory_order_acquire);
+  while (m_impl->processed.load(std::memory_order_acquire) < target) {
+    if (!m_impl->running.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> lock(m_impl->consumer_mutex);
+      m_impl->drain();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+long long BatchedPlugins::dropped() const
+{
+  return m_impl->dropped.load(std::memory_order_relaxed);
+}
+
+void linkBatchedPlugins() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::BatchedPlugins> P("BatchedPlugins", "Run batched RAJA plugins on a background thread.");
@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/BoundsCheck.hpp"
+
+#if defined(RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL)
+
+#include <mutex>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include <cuda_runtime.h>
+#elif defined(RAJA_ENABLE_HIP)
+#include <hip/hip_runtime.h>
+#endif
+
+namespace RAJA {
+
+namespace detail {
+
+namespace {
+
+std::mutex& host_bounds_check_mutex()
+{
+  static std::mutex m;
+  return m;
+}
+
+//! pinned so kernels write it directly and it is read without a copy
+BoundsCheckRecord* allocate_record()
+{
+  void* ptr = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+  if (cudaMallocHost(&ptr, sizeof(BoundsCheckRecord)) != cudaSuccess) {
+    ptr = nullptr;
+  }
+#elif defined(RAJA_ENABLE_HIP)
+  if (hipHostMalloc(&ptr, sizeof(BoundsCheckRecord)) != hipSuccess) {
+    ptr = nullptr;
+  }
+#endif
+  BoundsCheckRecord* record = ptr ? static_cast<BoundsCheckRecord*>(ptr)
+                                  : new BoundsCheckRecord;
+  *record = BoundsCheckRecord{0, 0, 0, 0, 0};
+  return record;
+}
+
+}  // namespace
+
+std::atomic<bool> host_bounds_check_sampled{false};
+
+BoundsCheckRecord* host_bounds_check_record()
+{
+  static BoundsCheckRecord* record = allocate_record();
+  return record;
+}
+
+void host_bounds_check_report(long long dim,
+                              long long index,
+                              long long lower,
+                              long long upper)
+{
+  std::lock_guard<std::mutex> lock(host_bounds_check_mutex());
+  BoundsCheckRecord* record = host_bounds_check_record();
+  if (record->count++ == 0) {
+    record->dim = dim;
+    record->index = index;
+    record->lower = lower;
+    record->upper = upper;
+  }
+}
+
+}  // namespace detail
+
+BoundsCheckRecord bounds_check_errors()
+{
+  std::lock_guard<std::mutex> lock(detail::host_bounds_check_mutex());
+  BoundsCheckRecord const volatile* record = detail::host_bounds_check_record();
+  return BoundsCheckRecord{record->count,
+                           record->dim,
+                           record->index,
+                           record->lower,
+                           record->upper};
+}
+
+void bounds_check_reset()
+{
+  std::lock_guard<std::mutex> lock(detail::host_bounds_check_mutex());
+  *detail::host_bounds_check_record() = BoundsCheckRecord{0, 0, 0, 0, 0};
+}
+
+namespace util {
+
+  /*!
+   * \brief Plugin that turns on the host bounds checks for one in
+   *        RAJA_BOUNDS_CHECK_SAMPLE_RATE launches.
+   */
+  class BoundsCheckPlugin : public PluginStrategy
+  {
+  public:
+    void preLaunch(const PluginContext& p) override
+    {
+      detail::host_bounds_check_sampled.store(
+          p.platform == Platform::host &&
+              m_launches++ % RAJA_BOUNDS_CHECK_SAMPLE_RATE == 0,
+          std::memory_order_relaxed);
+    }
+
+    void postLaunch(const PluginContext&) override
+    {
+      detail::host_bounds_check_sampled.store(false, std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<unsigned long long> m_launches{0};
+  };
+
+}  // end namespace util
+
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::BoundsCheckPlugin> P("BoundsCheckPlugin", "Turn on sampled bounds checks of RAJA Views in one of a number of host launches.");
+
+#endif  // RAJA_BOUNDS_CHECK_SAMPLED_INTERNAL
@@ -0,0 +1,361 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/CounterPlugin.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "RAJA/util/macros.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+const char* unnamed_kernel = "<unnamed>";
+
+//! bytes moved from memory for each last level cache miss
+constexpr long long cache_line_bytes = 64;
+
+//! a hardware event and the flops it stands for, 0 if it is not a flop
+struct Event {
+  uint32_t type;
+  uint64_t config;
+  long long flops;
+};
+
+enum FixedEvent {
+  cycles_event = 0,
+  instructions_event,
+  l1d_miss_event,
+  llc_miss_event,
+  num_fixed_events
+};
+
+#if defined(__linux__)
+
+uint64_t cacheReadMiss(uint64_t cache)
+{
+  return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+std::vector<Event> fixedEvents()
+{
+  return {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 0},
+          {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, 0},
+          {PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_L1D), 0},
+          {PERF_TYPE_HW_CACHE, cacheReadMiss(PERF_COUNT_HW_CACHE_LL), 0}};
+}
+
+//! parse RAJA_COUNTER_FP_EVENTS, "code:flops,code:flops,..."
+void addFpEvents(std::vector<Event>& events, const char* env)
+{
+  const char* pos = env;
+  while (pos != nullptr && *pos != '\0') {
+    char* end = nullptr;
+    unsigned long long code = strtoull(pos, &end, 0);
+    long long flops = 1;
+    if (end != pos && *end == ':') {
+      flops = strtoll(end + 1, &end, 0);
+    }
+    if (end == pos || flops <= 0) {
+      printf("[CounterPlugin]: can not parse RAJA_COUNTER_FP_EVENTS at %s\n",
+             pos);
+      return;
+    }
+    events.push_back(Event{PERF_TYPE_RAW, code, flops});
+    pos = (*end == ',') ? end + 1 : nullptr;
+  }
+}
+
+int openEvent(Event const& event)
+{
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = 0;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+//! count of an event, scaled up if the event was multiplexed
+long long readEvent(int fd)
+{
+  uint64_t values[3] = {0, 0, 0};
+  if (fd < 0 || read(fd, values, sizeof(values)) != sizeof(values)) {
+    return 0;
+  }
+  if (values[2] == 0) return 0;
+  if (values[2] < values[1]) {
+    return static_cast<long long>(static_cast<double>(values[0]) *
+                                  static_cast<double>(values[1]) /
+                                  static_cast<double>(values[2]));
+  }
+  return static_cast<long long>(values[0]);
+}
+
+void closeEvent(int fd)
+{
+  if (fd >= 0) close(fd);
+}
+
+#else
+
+std::vector<Event> fixedEvents() { return {}; }
+
+void addFpEvents(std::vector<Event>&, const char*) {}
+
+int openEvent(Event const&) { return -1; }
+
+long long readEvent(int) { return 0; }
+
+void closeEvent(int) {}
+
+#endif
+
+//! the counters of a thread, opened the first time it launches a kernel
+struct ThreadCounters {
+  bool opened = false;
+  std::vector<int> fds;
+  //! readings at preLaunch of the launches in flight, kernels may be
+  //! nested in the loop bodies of host kernels
+  std::vector<std::vector<long long>> launches;
+
+  ~ThreadCounters()
+  {
+    for (int fd : fds) closeEvent(fd);
+  }
+
+  void open(std::vector<Event> const& events)
+  {
+    opened = true;
+    for (Event const& event : events) {
+      fds.push_back(openEvent(event));
+    }
+  }
+
+  std::vector<long long> read() const
+  {
+    std::vector<long long> values(fds.size());
+    for (size_t i = 0; i < fds.size(); ++i) {
+      values[i] = readEvent(fds[i]);
+    }
+    return values;
+  }
+};
+
+thread_local ThreadCounters thread_counters;
+
+CounterPlugin* registered_counter = nullptr;
+
+}  // end anonymous namespace
+
+double CounterPlugin::KernelCounters::vectorWidth() const
+{
+  return fp_instructions > 0
+             ? static_cast<double>(flops) / static_cast<double>(fp_instructions)
+             : 0.0;
+}
+
+double CounterPlugin::KernelCounters::arithmeticIntensity() const
+{
+  const long long traffic = bytes > 0 ? bytes : llc_misses * cache_line_bytes;
+  return traffic > 0 ? static_cast<double>(flops) / static_cast<double>(traffic)
+                     : 0.0;
+}
+
+struct CounterPlugin::Impl {
+  std::vector<Event> events;
+  bool available = false;
+
+  std::mutex mutex;
+
+  // kernels are looked up by the address of their name, which is usually
+  // a string literal, and merged by name in getCounters
+  std::unordered_map<const char*, size_t> index;
+  std::vector<KernelCounters> counters;
+
+  KernelCounters& find(const char* name)
+  {
+    auto it = index.find(name);
+    if (it != index.end()) return counters[it->second];
+
+    counters.push_back(KernelCounters{name, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+    index.emplace(name, counters.size() - 1);
+    return counters.back();
+  }
+};
+
+CounterPlugin::CounterPlugin() : m_impl(new Impl)
+{
+  registered_counter = this;
+
+  m_impl->events = fixedEvents();
+  addFpEvents(m_impl->events, getenv("RAJA_COUNTER_FP_EVENTS"));
+
+  // the counters of the thread that starts the program are opened now, so
+  // they are inherited by the threads it creates
+  thread_counters.open(m_impl->events);
+  m_impl->available = !thread_counters.fds.empty() &&
+                      thread_counters.fds[cycles_event] >= 0;
+  if (!m_impl->available) {
+    printf("[CounterPlugin]: hardware counters are not available\n");
+  }
+}
+
+CounterPlugin::~CounterPlugin()
+{
+  if (registered_counter == this) registered_counter = nullptr;
+}
+
+CounterPlugin* CounterPlugin::instance() { return registered_counter; }
+
+bool CounterPlugin::available() const { return m_impl->available; }
+
+void CounterPlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  // counters of the host do not see the work of GPU kernels
+  if (p.platform != Platform::host) return;
+
+  if (!thread_counters.opened) thread_counters.open(m_impl->events);
+  thread_counters.launches.push_back(thread_counters.read());
+}
+
+void CounterPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (p.platform != Platform::host || thread_counters.launches.empty()) {
+    return;
+  }
+
+  std::vector<long long> values = thread_counters.read();
+  std::vector<long long> const& start = thread_counters.launches.back();
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] -= start[i];
+  }
+  thread_counters.launches.pop_back();
+
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+
+  KernelCounters& c =
+      m_impl->find(p.kernel_name ? p.kernel_name : unnamed_kernel);
+  c.count += 1;
+  if (p.num_iterations > 0) c.iterations += p.num_iterations;
+  if (p.bytes > 0) c.bytes += p.bytes;
+  if (values.size() >= num_fixed_events) {
+    c.cycles += values[cycles_event];
+    c.instructions += values[instructions_event];
+    c.l1d_misses += values[l1d_miss_event];
+    c.llc_misses += values[llc_miss_event];
+  }
+  for (size_t i = num_fixed_events; i < values.size(); ++i) {
+    c.fp_instructions += values[i];
+    c.flops += values[i] * m_impl->events[i].flops;
+  }
+}
+
+std::vector<CounterPlugin::KernelCounters> CounterPlugin::getCounters()
+{
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+
+  std::map<std::string, KernelCounters> merged;
+  for (KernelCounters const& c : m_impl->counters) {
+    auto it = merged.find(c.name);
+    if (it == merged.end()) {
+      merged.emplace(c.name, c);
+    } else {
+      KernelCounters& m = it->second;
+      m.count += c.count;
+      m.iterations += c.iterations;
+      m.bytes += c.bytes;
+      m.cycles += c.cycles;
+      m.instructions += c.instructions;
+      m.l1d_misses += c.l1d_misses;
+      m.llc_misses += c.llc_misses;
+      m.fp_instructions += c.fp_instructions;
+      m.flops += c.flops;
+    }
+  }
+
+  std::vector<KernelCounters> result;
+  result.reserve(merged.size());
+  for (auto const& entry : merged) {
+    result.push_back(entry.second);
+  }
+  std::sort(result.begin(), result.end(),
+            [](KernelCounters const& a, KernelCounters const& b) {
+              return a.cycles > b.cycles;
+            });
+  return result;
+}
+
+void CounterPlugin::reset()
+{
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+  m_impl->index.clear();
+  m_impl->counters.clear();
+}
+
+void CounterPlugin::finalize()
+{
+  std::vector<KernelCounters> counters = getCounters();
+
+  FILE* out = stdout;
+  const char* path = getenv("RAJA_COUNTER_FILE");
+  if (path != nullptr && path[0] != '\0') {
+    out = fopen(path, "w");
+    if (out == nullptr) {
+      printf("[CounterPlugin]: can not open %s, writing to stdout\n", path);
+      out = stdout;
+    }
+  }
+
+  fprintf(out, "[CounterPlugin]: kernel hardware counters%s\n",
+          m_impl->available ? "" : " (not available)");
+  fprintf(out, "%-40s %10s %14s %16s %8s %14s %14s %16s %8s %10s\n",
+          "kernel", "count", "iterations", "cycles", "IPC",
+          "L1D misses", "LLC misses", "flops", "width", "flop/byte");
+  for (KernelCounters const& c : counters) {
+    const double ipc = c.cycles > 0 ? static_cast<double>(c.instructions) /
+                                          static_cast<double>(c.cycles)
+                                    : 0.0;
+    fprintf(out, "%-40s %10lld %14lld %16lld %8.2f %14lld %14lld %16lld %8.2f %10.3f\n",
+            c.name.c_str(), c.count, c.iterations, c.cycles, ipc,
+            c.l1d_misses, c.llc_misses, c.flops, c.vectorWidth(),
+            c.arithmeticIntensity());
+  }
+
+  if (out != stdout) fclose(out);
+}
+
+void linkCounterPlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::CounterPlugin> P("CounterPlugin", "Read hardware counters around RAJA kernels and print them at finalize.");
@@ -0,0 +1,160 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for hybrid range/list index set builder
+ *          methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with Range, RangeStride, and List segments, as
+ * needed, from given array of indices.
+ *
+ * A "run" is a maximal stretch of the input with one difference between
+ * consecutive indices. The only pass over all the indices finds where runs
+ * start, in parallel chunks. The segments are then made by walking the
+ * runs; the last index of a run is also the first of the next one, so it
+ * goes to whichever of the two becomes a range first.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetHybrid(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length)
+{
+  if (length <= 0) return;
+
+  if (range_min_length < 2) range_min_length = 2;
+
+  if (length < range_min_length) {
+    iset.push_back(ListSegment(indices_in, length, work_res));
+    return;
+  }
+
+  /* difference k is indices_in[k+1] - indices_in[k] */
+  const RAJA::Index_type num_diffs = length - 1;
+
+  auto isRunStart = [=](RAJA::Index_type k) {
+    return k == 0 || (indices_in[k + 1] - indices_in[k]) !=
+                         (indices_in[k] - indices_in[k - 1]);
+  };
+
+  /******************************************************/
+  /* first, count and then record run starts in chunks  */
+  /******************************************************/
+
+  const int num_chunks = getMaxOMPThreadsCPU();
+
+  auto chunkBegin = [=](int chunk) {
+    return (num_diffs * chunk) / num_chunks;
+  };
+
+  std::vector<RAJA::Index_type> chunk_offsets(num_chunks + 1, 0);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    RAJA::Index_type count = 0;
+    for (RAJA::Index_type k = chunkBegin(chunk); k < chunkBegin(chunk + 1);
+         ++k) {
+      if (isRunStart(k)) ++count;
+    }
+    chunk_offsets[chunk + 1] = count;
+  }
+
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    chunk_offsets[chunk + 1] += chunk_offsets[chunk];
+  }
+
+  /* run_starts[r] is the position of the first index of run r */
+  std::vector<RAJA::Index_type> run_starts(chunk_offsets[num_chunks] + 1);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    RAJA::Index_type r = chunk_offsets[chunk];
+    for (RAJA::Index_type k = chunkBegin(chunk); k < chunkBegin(chunk + 1);
+         ++k) {
+      if (isRunStart(k)) run_starts[r++] = k;
+    }
+  }
+  run_starts.back() = num_diffs;
+
+  /**************************************************/
+  /* now, walk the runs and build the segments      */
+  /**************************************************/
+
+  /* first index not yet in a segment */
+  RAJA::Index_type list_begin = 0;
+
+  const RAJA::Index_type num_runs =
+      static_cast<RAJA::Index_type>(run_starts.size()) - 1;
+  for (RAJA::Index_type r = 0; r < num_runs; ++r) {
+    RAJA::Index_type first =
+        (run_starts[r] > list_begin) ? run_starts[r] : list_begin;
+    RAJA::Index_type last = run_starts[r + 1];
+    RAJA::Index_type stride = indices_in[last] - indices_in[last - 1];
+
+    if (stride == 0 || last - first + 1 < range_min_length) {
+      continue;
+    }
+
+    if (first > list_begin) {
+      iset.push_back(ListSegment(&indices_in[list_begin],
+                                 first - list_begin,
+                                 work_res));
+    }
+
+    if (stride == 1) {
+      iset.push_back(RangeSegment(indices_in[first], indices_in[last] + 1));
+    } else {
+      iset.push_back(RangeStrideSegment(indices_in[first],
+                                        indices_in[last] + stride,
+                                        stride));
+    }
+
+    list_begin = last + 1;
+  }
+
+  if (list_begin < length) {
+    iset.push_back(ListSegment(&indices_in[list_begin],
+                               length - list_begin,
+                               work_res));
+  }
+}
+
+}  // namespace RAJA
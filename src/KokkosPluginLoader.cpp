@@ -7,6 +7,8 @@
 
 #include "RAJA/util/KokkosPluginLoader.hpp"
 
+#include <cstring>
+
 #ifndef _WIN32
 #include <dlfcn.h>
 #include <dirent.h>
@@ -39,9 +41,47 @@ getFunction(void* plugin, std::vector<function>& functions, const char* fname)
   #endif
 }
 
+// Like getFunction, for callbacks a tool need not define.
+template<typename function>
+RAJA_INLINE
+void
+getOptionalFunction(void* plugin, std::vector<function>& functions, const char* fname)
+{
+  #ifndef _WIN32
+  function func = (function) dlsym(plugin, fname);
+  if (func)
+    functions.push_back(func);
+  #else
+  RAJA_UNUSED_ARG(plugin);
+  RAJA_UNUSED_ARG(functions);
+  RAJA_UNUSED_ARG(fname);
+  #endif
+}
+
 namespace RAJA {
 namespace util {
 
+namespace {
+
+// Kokkos tools get a name for each kernel, use the policy when the kernel
+// has none.
+const char* kernelName(const RAJA::util::PluginContext& p)
+{
+  if (p.kernel_name != nullptr) return p.kernel_name;
+  if (p.policy_name != nullptr) return p.policy_name;
+  return "";
+}
+
+KokkosPluginLoader::SpaceHandle spaceHandle(const char* space)
+{
+  KokkosPluginLoader::SpaceHandle handle;
+  strncpy(handle.name, space, sizeof(handle.name) - 1);
+  handle.name[sizeof(handle.name) - 1] = '\0';
+  return handle;
+}
+
+} // end anonymous namespace
+
 KokkosPluginLoader::KokkosPluginLoader()
 {
   char *env = getenv("KOKKOS_PLUGINS");
@@ -59,20 +99,64 @@ KokkosPluginLoader::KokkosPluginLoader()
 
 void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
-  for (auto &func : pre_functions)
+  const std::vector<pre_function>& functions =
+      (p.kind == LaunchKind::parallel_reduce) ? pre_reduce_functions :
+      (p.kind == LaunchKind::parallel_scan) ? pre_scan_functions :
+      pre_functions;
+  for (auto &func : functions)
   {
-    func("", 0, &(p.kID));
+    func(kernelName(p), 0, &(p.kID));
   }
 }
 
 void KokkosPluginLoader::postLaunch(const RAJA::util::PluginContext& p)
 {
-  for (auto &func : post_functions)
+  const std::vector<post_function>& functions =
+      (p.kind == LaunchKind::parallel_reduce) ? post_reduce_functions :
+      (p.kind == LaunchKind::parallel_scan) ? post_scan_functions :
+      post_functions;
+  for (auto &func : functions)
   {
     func(p.kID);
   }
 }
 
+void KokkosPluginLoader::preFence(const RAJA::util::PluginContext& p)
+{
+  for (auto &func : pre_fence_functions)
+  {
+    func(kernelName(p), 0, &(p.kID));
+  }
+}
+
+void KokkosPluginLoader::postFence(const RAJA::util::PluginContext& p)
+{
+  for (auto &func : post_fence_functions)
+  {
+    func(p.kID);
+  }
+}
+
+void KokkosPluginLoader::allocateData(const RAJA::util::PluginMemoryContext& p)
+{
+  if (allocate_functions.empty()) return;
+  const SpaceHandle handle = spaceHandle(p.space);
+  for (auto &func : allocate_functions)
+  {
+    func(handle, p.name, p.ptr, p.bytes);
+  }
+}
+
+void KokkosPluginLoader::deallocateData(const RAJA::util::PluginMemoryContext& p)
+{
+  if (deallocate_functions.empty()) return;
+  const SpaceHandle handle = spaceHandle(p.space);
+  for (auto &func : deallocate_functions)
+  {
+    func(handle, p.name, p.ptr, p.bytes);
+  }
+}
+
 void KokkosPluginLoader::finalize()
 {
   for (auto &func : finalize_functions)
@@ -83,6 +167,14 @@ void KokkosPluginLoader::finalize()
   pre_functions.clear();
   post_functions.clear();
   finalize_functions.clear();
+  pre_reduce_functions.clear();
+  post_reduce_functions.clear();
+  pre_scan_functions.clear();
+  post_scan_functions.clear();
+  pre_fence_functions.clear();
+  post_fence_functions.clear();
+  allocate_functions.clear();
+  deallocate_functions.clear();
 }
 
 // Initialize plugin from a shared object file specified by 'path'.
@@ -103,6 +195,22 @@ void KokkosPluginLoader::initPlugin(const std::string &path)
   getFunction<post_function>(plugin, post_functions, "kokkosp_end_parallel_for");
 
   getFunction<finalize_function>(plugin, finalize_functions, "kokkosp_finalize_library");
+
+  getOptionalFunction<pre_function>(plugin, pre_reduce_functions, "kokkosp_begin_parallel_reduce");
+
+  getOptionalFunction<post_function>(plugin, post_reduce_functions, "kokkosp_end_parallel_reduce");
+
+  getOptionalFunction<pre_function>(plugin, pre_scan_functions, "kokkosp_begin_parallel_scan");
+
+  getOptionalFunction<post_function>(plugin, post_scan_functions, "kokkosp_end_parallel_scan");
+
+  getOptionalFunction<pre_function>(plugin, pre_fence_functions, "kokkosp_begin_fence");
+
+  getOptionalFunction<post_function>(plugin, post_fence_functions, "kokkosp_end_fence");
+
+  getOptionalFunction<data_function>(plugin, allocate_functions, "kokkosp_allocate_data");
+
+  getOptionalFunction<data_function>(plugin, deallocate_functions, "kokkosp_deallocate_data");
   #else
   RAJA_UNUSED_ARG(path);
   #endif
@@ -19,7 +19,10 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 
 #include "RAJA/index/IndexSetBuilders.hpp"
 
@@ -192,6 +195,69 @@ void buildLockFreeBlockIndexset(
   // iset.print(std::cout);
 }
 
+/*
+ ******************************************************************************
+ *
+ * Push the segments of a coloring onto an index set: entities
+ * workset[worksetDelim[i-1], worksetDelim[i]) have color i.
+ *
+ ******************************************************************************
+ */
+static void pushColorSegments(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* workset,
+    const RAJA::Index_type* worksetDelim,
+    RAJA::Index_type numWorkset,
+    int numEntity,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation)
+{
+  /* we may want to create a permutation array here */
+  if (elemPermutation != 0l) {
+    /* send back permutaion array, and corresponding range segments */
+
+    memcpy(elemPermutation,
+           &workset[0],
+           numEntity * sizeof(RAJA::Index_type));
+    if (ielemPermutation != 0l) {
+      for (int i = 0; i < numEntity; ++i) {
+        ielemPermutation[elemPermutation[i]] = i;
+      }
+    }
+    RAJA::Index_type end = 0;
+    for (int i = 0; i < numWorkset; ++i) {
+      RAJA::Index_type begin = end;
+      end = worksetDelim[i];
+      iset.push_back(RAJA::RangeSegment(begin, end));
+    }
+  } else {
+    RAJA::Index_type end = 0;
+    for (int i = 0; i < numWorkset; ++i) {
+      RAJA::Index_type begin = end;
+      end = worksetDelim[i];
+      bool isRange = true;
+      for (int j = begin + 1; j < end; ++j) {
+        if (workset[j - 1] + 1 != workset[j]) {
+          isRange = false;
+          break;
+        }
+      }
+      if (isRange) {
+        iset.push_back(
+            RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
+      } else {
+        iset.push_back(RAJA::ListSegment(&workset[begin], end - begin,
+                                         work_res));
+        // printf("segment %d\n", i) ;
+        // for (int j=begin; j<end; ++j) {
+        //    printf("%d\n", workset[j]) ;
+        // }
+      }
+    }
+  }
+}
+
 /*
  ******************************************************************************
  *
@@ -283,51 +349,275 @@ void buildLockFreeColorIndexset(
     exit(-1);
   }
 
-  /* we may want to create a permutation array here */
-  if (elemPermutation != 0l) {
-    /* send back permutaion array, and corresponding range segments */
+  pushColorSegments(iset,
+                    work_res,
+                    workset,
+                    worksetDelim,
+                    numWorkset,
+                    numEntity,
+                    elemPermutation,
+                    ielemPermutation);
 
-    memcpy(elemPermutation, &workset[0], numEntity * sizeof(int));
-    if (ielemPermutation != 0l) {
-      for (int i = 0; i < numEntity; ++i) {
-        ielemPermutation[elemPermutation[i]] = i;
-      }
+  delete[] isMarked;
+  delete[] worksetDelim;
+  delete[] workset;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Priority of an entity in the parallel coloring. This is a hash of its id,
+ * so that priorities do not follow the order of neighboring ids.
+ *
+ ******************************************************************************
+ */
+static uint64_t colorPriority(RAJA::Index_type i)
+{
+  uint64_t x = static_cast<uint64_t>(i);
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ull;
+  x ^= x >> 33;
+  return x;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Color the entities in parallel, so that entities sharing a range entity
+ * get different colors. On return, workset[worksetDelim[c-1],
+ * worksetDelim[c]) are the entities of color c, in increasing order, and
+ * the number of colors is returned.
+ *
+ * Each round colors every uncolored entity whose priority is higher than
+ * that of all of its uncolored neighbors, with the smallest color none of
+ * its neighbors has (Jones-Plassmann). Entities are neighbors if they share
+ * a range entity.
+ *
+ ******************************************************************************
+ */
+static int colorEntitiesParallel(
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    std::vector<RAJA::Index_type>& workset,
+    std::vector<RAJA::Index_type>& worksetDelim)
+{
+  if (numEntity <= 0) return 0;
+
+  const RAJA::Index_type numMap =
+      static_cast<RAJA::Index_type>(numEntity) * numRangePerDomain;
+
+  for (RAJA::Index_type m = 0; m < numMap; ++m) {
+    if (domainToRange[m] < 0 || domainToRange[m] >= numEntityRange) {
+      printf("foiled!\n");
+      exit(-1);
     }
-    RAJA::Index_type end = 0;
-    for (int i = 0; i < numWorkset; ++i) {
-      RAJA::Index_type begin = end;
-      end = worksetDelim[i];
-      iset.push_back(RAJA::RangeSegment(begin, end));
+  }
+
+  /* create an inverse mapping, rangeToDomain[rangeOffset[id]...] */
+  std::vector<RAJA::Index_type> rangeOffset(numEntityRange + 1, 0);
+  std::vector<RAJA::Index_type> rangeToDomain(numMap);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (RAJA::Index_type m = 0; m < numMap; ++m) {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic
+#endif
+    ++rangeOffset[domainToRange[m] + 1];
+  }
+
+  for (int id = 0; id < numEntityRange; ++id) {
+    rangeOffset[id + 1] += rangeOffset[id];
+  }
+
+  {
+    std::vector<RAJA::Index_type> rangeFill(rangeOffset.begin(),
+                                            rangeOffset.end() - 1);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+    for (RAJA::Index_type m = 0; m < numMap; ++m) {
+      RAJA::Index_type pos;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic capture
+#endif
+      pos = rangeFill[domainToRange[m]]++;
+      rangeToDomain[pos] = m / numRangePerDomain;
     }
-  } else {
-    RAJA::Index_type end = 0;
-    for (int i = 0; i < numWorkset; ++i) {
-      RAJA::Index_type begin = end;
-      end = worksetDelim[i];
-      bool isRange = true;
-      for (int j = begin + 1; j < end; ++j) {
-        if (workset[j - 1] + 1 != workset[j]) {
-          isRange = false;
-          break;
+  }
+
+  /* color the entities, one independent set per round */
+  std::vector<int> color(numEntity, -1);
+  std::vector<char> isSelected(numEntity, 0);
+
+  int numColor = 0;
+  RAJA::Index_type numColored = 0;
+  while (numColored < numEntity) {
+    RAJA::Index_type numSelected = 0;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for reduction(+ : numSelected)
+#endif
+    for (int i = 0; i < numEntity; ++i) {
+      isSelected[i] = 0;
+      if (color[i] != -1) continue;
+
+      const uint64_t priority = colorPriority(i);
+      bool isMax = true;
+      for (int j = 0; j < numRangePerDomain && isMax; ++j) {
+        RAJA::Index_type id = domainToRange[i * numRangePerDomain + j];
+        for (RAJA::Index_type k = rangeOffset[id]; k < rangeOffset[id + 1];
+             ++k) {
+          RAJA::Index_type other = rangeToDomain[k];
+          if (other == i || color[other] != -1) continue;
+          uint64_t otherPriority = colorPriority(other);
+          if (otherPriority > priority ||
+              (otherPriority == priority && other > i)) {
+            isMax = false;
+            break;
+          }
         }
       }
-      if (isRange) {
-        iset.push_back(
-            RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
-      } else {
-        iset.push_back(RAJA::ListSegment(&workset[begin], end - begin,
-                                         work_res));
-        // printf("segment %d\n", i) ;
-        // for (int j=begin; j<end; ++j) {
-        //    printf("%d\n", workset[j]) ;
-        // }
+
+      if (isMax) {
+        isSelected[i] = 1;
+        ++numSelected;
+      }
+    }
+
+    /* selected entities are not neighbors, so their colors are independent */
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for reduction(max : numColor)
+#endif
+    for (int i = 0; i < numEntity; ++i) {
+      if (!isSelected[i]) continue;
+
+      std::vector<int> neighborColors;
+      for (int j = 0; j < numRangePerDomain; ++j) {
+        RAJA::Index_type id = domainToRange[i * numRangePerDomain + j];
+        for (RAJA::Index_type k = rangeOffset[id]; k < rangeOffset[id + 1];
+             ++k) {
+          RAJA::Index_type other = rangeToDomain[k];
+          if (other != i && color[other] != -1) {
+            neighborColors.push_back(color[other]);
+          }
+        }
+      }
+      std::sort(neighborColors.begin(), neighborColors.end());
+
+      int c = 0;
+      for (int neighborColor : neighborColors) {
+        if (neighborColor == c) {
+          ++c;
+        } else if (neighborColor > c) {
+          break;
+        }
       }
+      color[i] = c;
+      numColor = (c + 1 > numColor) ? c + 1 : numColor;
     }
+
+    numColored += numSelected;
   }
 
-  delete[] isMarked;
-  delete[] worksetDelim;
-  delete[] workset;
+  /* order the entities by color, each color in increasing order */
+  worksetDelim.assign(numColor, 0);
+  for (int i = 0; i < numEntity; ++i) {
+    ++worksetDelim[color[i]];
+  }
+  for (int c = 1; c < numColor; ++c) {
+    worksetDelim[c] += worksetDelim[c - 1];
+  }
+
+  workset.resize(numEntity);
+  {
+    std::vector<RAJA::Index_type> colorFill(numColor, 0);
+    for (int c = 1; c < numColor; ++c) {
+      colorFill[c] = worksetDelim[c - 1];
+    }
+    for (int i = 0; i < numEntity; ++i) {
+      workset[colorFill[color[i]]++] = i;
+    }
+  }
+
+  return numColor;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Generate a lock-free "color" index set containing range and list segments,
+ * coloring the entities in parallel.
+ *
+ ******************************************************************************
+ */
+void buildLockFreeColorIndexsetParallel(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    RAJA::Index_type* elemPermutation,
+    RAJA::Index_type* ielemPermutation)
+{
+  std::vector<RAJA::Index_type> workset;
+  std::vector<RAJA::Index_type> worksetDelim;
+  const int numColor = colorEntitiesParallel(domainToRange,
+                                             numEntity,
+                                             numRangePerDomain,
+                                             numEntityRange,
+                                             workset,
+                                             worksetDelim);
+  if (numColor == 0) return;
+
+  pushColorSegments(iset,
+                    work_res,
+                    workset.data(),
+                    worksetDelim.data(),
+                    numColor,
+                    numEntity,
+                    elemPermutation,
+                    ielemPermutation);
+}
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with one list segment per color, coloring the
+ * entities in parallel.
+ *
+ ******************************************************************************
+ */
+void buildColoredIndexSet(
+    RAJA::TypedIndexSet<RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange)
+{
+  std::vector<RAJA::Index_type> workset;
+  std::vector<RAJA::Index_type> worksetDelim;
+  const int numColor = colorEntitiesParallel(domainToRange,
+                                             numEntity,
+                                             numRangePerDomain,
+                                             numEntityRange,
+                                             workset,
+                                             worksetDelim);
+
+  RAJA::Index_type end = 0;
+  for (int c = 0; c < numColor; ++c) {
+    RAJA::Index_type begin = end;
+    end = worksetDelim[c];
+    iset.push_back(RAJA::ListSegment(&workset[begin], end - begin, work_res));
+  }
 }
 
 }  // namespace RAJA
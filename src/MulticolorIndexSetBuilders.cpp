@@ -0,0 +1,106 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the multicolor box index set builder.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/BoxStrideSegment.hpp"
+#include "RAJA/index/IndexSet.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+//! a mod b in [0, b) for any sign of a
+RAJA::Index_type positive_mod(RAJA::Index_type a, RAJA::Index_type b)
+{
+  RAJA::Index_type r = a % b;
+  return r < 0 ? r + b : r;
+}
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set of strided box segments coloring a box.
+ *
+ * The cells of a color whose coordinates have given residues mod
+ * num_colors in all dimensions but the last have one residue in the last
+ * dimension, so they are a box with stride num_colors in every dimension.
+ * Each color is the union of these boxes over the residues of the other
+ * dimensions.
+ *
+ ******************************************************************************
+ */
+RAJA::Index_type buildMulticolorIndexSet(
+    RAJA::TypedIndexSet<RAJA::BoxStrideSegment>& iset,
+    int num_colors,
+    int num_dims,
+    const RAJA::Index_type* begin,
+    const RAJA::Index_type* end,
+    const RAJA::Index_type* extent)
+{
+  if (num_colors < 1 || num_dims < 1 ||
+      num_dims > RAJA::BoxStrideSegment::max_dims) {
+    return 0;
+  }
+
+  RAJA::Index_type array_stride[RAJA::BoxStrideSegment::max_dims];
+  RAJA::Index_type stride[RAJA::BoxStrideSegment::max_dims];
+  array_stride[num_dims - 1] = 1;
+  for (int d = num_dims - 1; d > 0; --d) {
+    array_stride[d - 1] = array_stride[d] * extent[d];
+  }
+  for (int d = 0; d < num_dims; ++d) {
+    stride[d] = num_colors;
+  }
+
+  RAJA::Index_type num_segments = 1;
+  for (int d = 1; d < num_dims; ++d) {
+    num_segments *= num_colors;
+  }
+
+  for (int color = 0; color < num_colors; ++color) {
+    for (RAJA::Index_type seg = 0; seg < num_segments; ++seg) {
+
+      // residues of all dimensions but the last are the digits of seg
+      RAJA::Index_type first[RAJA::BoxStrideSegment::max_dims];
+      RAJA::Index_type residue_sum = 0;
+      RAJA::Index_type digits = seg;
+      for (int d = num_dims - 2; d >= 0; --d) {
+        RAJA::Index_type residue = digits % num_colors;
+        digits /= num_colors;
+        residue_sum += residue;
+        first[d] = begin[d] + positive_mod(residue - begin[d], num_colors);
+      }
+
+      int last = num_dims - 1;
+      RAJA::Index_type residue = positive_mod(color - residue_sum, num_colors);
+      first[last] =
+          begin[last] + positive_mod(residue - begin[last], num_colors);
+
+      iset.push_back(RAJA::BoxStrideSegment(
+          num_dims, first, end, stride, array_stride));
+    }
+  }
+
+  return num_segments;
+}
+
+}  // namespace RAJA
@@ -24,6 +24,14 @@ void PluginStrategy::preLaunch(const PluginContext&) { }
 
 void PluginStrategy::postLaunch(const PluginContext&) { }
 
+void PluginStrategy::preFence(const PluginContext&) { }
+
+void PluginStrategy::postFence(const PluginContext&) { }
+
+void PluginStrategy::allocateData(const PluginMemoryContext&) { }
+
+void PluginStrategy::deallocateData(const PluginMemoryContext&) { }
+
 void PluginStrategy::finalize() { }
 
 }
@@ -0,0 +1,419 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ProfilerPlugin.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "RAJA/util/Timer.hpp"
+#include "RAJA/util/macros.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+#include "RAJA/policy/cuda/raja_cudaerrchk.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+#include "RAJA/policy/hip/raja_hiperrchk.hpp"
+#endif
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+const char* unnamed_kernel = "<unnamed>";
+
+const char* platformName(Platform platform)
+{
+  switch (platform) {
+    case Platform::host: return "host";
+    case Platform::cuda: return "cuda";
+    case Platform::omp_target: return "omp_target";
+    case Platform::hip: return "hip";
+    case Platform::sycl: return "sycl";
+    default: return "undefined";
+  }
+}
+
+bool hasEvents(Platform platform)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  if (platform == Platform::cuda) return true;
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (platform == Platform::hip) return true;
+#endif
+  RAJA_UNUSED_ARG(platform);
+  return false;
+}
+
+//
+// Thin wrappers of the event calls of the GPU back-ends; events are kept as
+// void* since cudaEvent_t and hipEvent_t are pointers.
+//
+void* createEvent(Platform platform)
+{
+  void* event = nullptr;
+#if defined(RAJA_ENABLE_CUDA)
+  if (platform == Platform::cuda) {
+    cudaEvent_t e;
+    cudaErrchk(cudaEventCreate(&e));
+    event = static_cast<void*>(e);
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (platform == Platform::hip) {
+    hipEvent_t e;
+    hipErrchk(hipEventCreate(&e));
+    event = static_cast<void*>(e);
+  }
+#endif
+  RAJA_UNUSED_ARG(platform);
+  return event;
+}
+
+void destroyEvent(Platform platform, void* event)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  if (platform == Platform::cuda) {
+    cudaErrchk(cudaEventDestroy(static_cast<cudaEvent_t>(event)));
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (platform == Platform::hip) {
+    hipErrchk(hipEventDestroy(static_cast<hipEvent_t>(event)));
+  }
+#endif
+  RAJA_UNUSED_ARG(platform);
+  RAJA_UNUSED_ARG(event);
+}
+
+void recordEvent(Platform platform, void* event, void* stream)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  if (platform == Platform::cuda) {
+    cudaErrchk(cudaEventRecord(static_cast<cudaEvent_t>(event),
+                               static_cast<cudaStream_t>(stream)));
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (platform == Platform::hip) {
+    hipErrchk(hipEventRecord(static_cast<hipEvent_t>(event),
+                             static_cast<hipStream_t>(stream)));
+  }
+#endif
+  RAJA_UNUSED_ARG(platform);
+  RAJA_UNUSED_ARG(event);
+  RAJA_UNUSED_ARG(stream);
+}
+
+bool eventDone(Platform platform, void* event)
+{
+#if defined(RAJA_ENABLE_CUDA)
+  if (platform == Platform::cuda) {
+    cudaError_t status = cudaEventQuery(static_cast<cudaEvent_t>(event));
+    if (status == cudaErrorNotReady) return false;
+    cudaErrchk(status);
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (platform == Platform::hip) {
+    hipError_t status = hipEventQuery(static_cast<hipEvent_t>(event));
+    if (status == hipErrorNotReady) return false;
+    hipErrchk(status);
+  }
+#endif
+  RAJA_UNUSED_ARG(platform);
+  RAJA_UNUSED_ARG(event);
+  return true;
+}
+
+//! seconds between two completed events, waiting for stop
+double eventSeconds(Platform platform, void* start, void* stop)
+{
+  float ms = 0.0f;
+#if defined(RAJA_ENABLE_CUDA)
+  if (platform == Platform::cuda) {
+    cudaErrchk(cudaEventSynchronize(static_cast<cudaEvent_t>(stop)));
+    cudaErrchk(cudaEventElapsedTime(&ms,
+                                    static_cast<cudaEvent_t>(start),
+                                    static_cast<cudaEvent_t>(stop)));
+  }
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  if (platform == Platform::hip) {
+    hipErrchk(hipEventSynchronize(static_cast<hipEvent_t>(stop)));
+    hipErrchk(hipEventElapsedTime(&ms,
+                                  static_cast<hipEvent_t>(start),
+                                  static_cast<hipEvent_t>(stop)));
+  }
+#endif
+  RAJA_UNUSED_ARG(platform);
+  RAJA_UNUSED_ARG(start);
+  RAJA_UNUSED_ARG(stop);
+  return static_cast<double>(ms) * 1.0e-3;
+}
+
+//! a launch between preLaunch and postLaunch
+struct Launch {
+  Platform platform;
+  void* stream;
+  void* start_event;
+  RAJA::TscTimer timer;
+};
+
+// foralls may be nested in the loop bodies of host foralls and launched
+// from several threads, so each thread keeps a stack of its launches
+thread_local std::vector<Launch> launches;
+
+ProfilerPlugin* registered_profiler = nullptr;
+
+}  // end anonymous namespace
+
+struct ProfilerPlugin::Impl {
+  //! a GPU launch whose events have not been read yet
+  struct Pending {
+    size_t stat;
+    Platform platform;
+    void* start_event;
+    void* stop_event;
+  };
+
+  using Key = std::pair<const char*, int>;
+
+  struct KeyHash {
+    size_t operator()(Key const& key) const
+    {
+      return std::hash<const char*>()(key.first) ^
+             (std::hash<int>()(key.second) << 1);
+    }
+  };
+
+  std::mutex mutex;
+
+  // kernels are looked up by the address of their name, which is usually
+  // a string literal, and merged by name in getStats
+  std::unordered_map<Key, size_t, KeyHash> index;
+  std::vector<KernelStats> stats;
+
+  std::deque<Pending> pending;
+  std::map<int, std::vector<void*>> free_events;
+
+  size_t findStat(const PluginContext& p)
+  {
+    const char* name = p.kernel_name ? p.kernel_name : unnamed_kernel;
+    Key key{name, static_cast<int>(p.platform)};
+    auto it = index.find(key);
+    if (it != index.end()) return it->second;
+
+    stats.push_back(KernelStats{name,
+                                p.platform,
+                                0,
+                                0,
+                                0,
+                                0.0,
+                                std::numeric_limits<double>::max(),
+                                0.0});
+    index.emplace(key, stats.size() - 1);
+    return stats.size() - 1;
+  }
+
+  void addTime(size_t stat, double seconds)
+  {
+    KernelStats& s = stats[stat];
+    s.total_time += seconds;
+    s.min_time = std::min(s.min_time, seconds);
+    s.max_time = std::max(s.max_time, seconds);
+  }
+
+  void* acquireEvent(Platform platform)
+  {
+    std::vector<void*>& events = free_events[static_cast<int>(platform)];
+    if (events.empty()) return createEvent(platform);
+    void* event = events.back();
+    events.pop_back();
+    return event;
+  }
+
+  void releaseEvent(Platform platform, void* event)
+  {
+    free_events[static_cast<int>(platform)].push_back(event);
+  }
+
+  //! read the completed pending timings, or all of them if wait
+  void drain(bool wait)
+  {
+    while (!pending.empty()) {
+      Pending& front = pending.front();
+      if (!wait && !eventDone(front.platform, front.stop_event)) break;
+
+      addTime(front.stat,
+              eventSeconds(front.platform, front.start_event, front.stop_event));
+      releaseEvent(front.platform, front.start_event);
+      releaseEvent(front.platform, front.stop_event);
+      pending.pop_front();
+    }
+  }
+};
+
+ProfilerPlugin::ProfilerPlugin() : m_impl(new Impl)
+{
+  registered_profiler = this;
+}
+
+ProfilerPlugin::~ProfilerPlugin()
+{
+  // the GPU runtime may be shut down already, so the events are not freed
+  if (registered_profiler == this) registered_profiler = nullptr;
+}
+
+ProfilerPlugin* ProfilerPlugin::instance() { return registered_profiler; }
+
+void ProfilerPlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  launches.push_back(Launch{p.platform, p.stream, nullptr, RAJA::TscTimer()});
+  Launch& launch = launches.back();
+
+  if (p.stream != nullptr && hasEvents(p.platform)) {
+    {
+      std::lock_guard<std::mutex> lock(m_impl->mutex);
+      launch.start_event = m_impl->acquireEvent(p.platform);
+    }
+    recordEvent(p.platform, launch.start_event, p.stream);
+  } else {
+    launch.timer.start();
+  }
+}
+
+void ProfilerPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (launches.empty()) return;
+
+  Launch launch = launches.back();
+  launches.pop_back();
+
+  if (launch.start_event == nullptr) {
+    launch.timer.stop();
+  }
+
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+
+  size_t stat = m_impl->findStat(p);
+  KernelStats& s = m_impl->stats[stat];
+  s.count += 1;
+  if (p.num_iterations > 0) s.iterations += p.num_iterations;
+  if (p.bytes > 0) s.bytes += p.bytes;
+
+  if (launch.start_event != nullptr) {
+    void* stop_event = m_impl->acquireEvent(launch.platform);
+    recordEvent(launch.platform, stop_event, launch.stream);
+    m_impl->pending.push_back(
+        Impl::Pending{stat, launch.platform, launch.start_event, stop_event});
+    m_impl->drain(false);
+  } else {
+    m_impl->addTime(stat, launch.timer.elapsed());
+  }
+}
+
+std::vector<ProfilerPlugin::KernelStats> ProfilerPlugin::getStats()
+{
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+  m_impl->drain(true);
+
+  std::map<std::pair<std::string, int>, KernelStats> merged;
+  for (KernelStats const& s : m_impl->stats) {
+    auto key = std::make_pair(s.name, static_cast<int>(s.platform));
+    auto it = merged.find(key);
+    if (it == merged.end()) {
+      merged.emplace(key, s);
+    } else {
+      KernelStats& m = it->second;
+      m.count += s.count;
+      m.iterations += s.iterations;
+      m.bytes += s.bytes;
+      m.total_time += s.total_time;
+      m.min_time = std::min(m.min_time, s.min_time);
+      m.max_time = std::max(m.max_time, s.max_time);
+    }
+  }
+
+  std::vector<KernelStats> result;
+  result.reserve(merged.size());
+  for (auto const& entry : merged) {
+    result.push_back(entry.second);
+  }
+  std::sort(result.begin(), result.end(),
+            [](KernelStats const& a, KernelStats const& b) {
+              return a.total_time > b.total_time;
+            });
+  return result;
+}
+
+void ProfilerPlugin::reset()
+{
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+  m_impl->drain(true);
+  m_impl->index.clear();
+  m_impl->stats.clear();
+}
+
+void ProfilerPlugin::finalize()
+{
+  std::vector<KernelStats> stats = getStats();
+
+  FILE* out = stdout;
+  const char* path = getenv("RAJA_PROFILER_FILE");
+  if (path != nullptr && path[0] != '\0') {
+    out = fopen(path, "w");
+    if (out == nullptr) {
+      printf("[ProfilerPlugin]: can not open %s, writing to stdout\n", path);
+      out = stdout;
+    }
+  }
+
+  fprintf(out, "[ProfilerPlugin]: kernel timings\n");
+  fprintf(out, "%-40s %-10s %10s %14s %12s %12s %12s %12s %10s\n",
+          "kernel", "platform", "count", "iterations",
+          "total (s)", "mean (us)", "min (us)", "max (us)", "GB/s");
+  for (KernelStats const& s : stats) {
+    const double mean = s.count > 0 ? s.total_time / s.count : 0.0;
+    const double gbs = (s.bytes > 0 && s.total_time > 0.0)
+                           ? static_cast<double>(s.bytes) / s.total_time * 1.0e-9
+                           : 0.0;
+    fprintf(out, "%-40s %-10s %10lld %14lld %12.6f %12.3f %12.3f %12.3f %10.2f\n",
+            s.name.c_str(), platformName(s.platform), s.count, s.iterations,
+            s.total_time, mean * 1.0e6,
+            (s.count > 0 ? s.min_time : 0.0) * 1.0e6, s.max_time * 1.0e6,
+            gbs);
+  }
+
+  if (out != stdout) fclose(out);
+
+  // the events are freed here, while the GPU runtime is still up
+  std::lock_guard<std::mutex> lock(m_impl->mutex);
+  for (auto& entry : m_impl->free_events) {
+    for (void* event : entry.second) {
+      destroyEvent(static_cast<Platform>(entry.first), event);
+    }
+    entry.second.clear();
+  }
+}
+
+void linkProfilerPlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ProfilerPlugin> P("ProfilerPlugin", "Time RAJA kernels and print a table of them at finalize.");
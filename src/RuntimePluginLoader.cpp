@@ -7,6 +7,10 @@
 
 #include "RAJA/util/RuntimePluginLoader.hpp"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #ifndef _WIN32
 #include <dlfcn.h>
 #include <dirent.h>
@@ -73,6 +77,38 @@ void RuntimePluginLoader::postLaunch(const RAJA::util::PluginContext& p)
   }
 }
 
+void RuntimePluginLoader::preFence(const RAJA::util::PluginContext& p)
+{
+  for (auto &plugin : plugins)
+  {
+    plugin->preFence(p);
+  }
+}
+
+void RuntimePluginLoader::postFence(const RAJA::util::PluginContext& p)
+{
+  for (auto &plugin : plugins)
+  {
+    plugin->postFence(p);
+  }
+}
+
+void RuntimePluginLoader::allocateData(const RAJA::util::PluginMemoryContext& p)
+{
+  for (auto &plugin : plugins)
+  {
+    plugin->allocateData(p);
+  }
+}
+
+void RuntimePluginLoader::deallocateData(const RAJA::util::PluginMemoryContext& p)
+{
+  for (auto &plugin : plugins)
+  {
+    plugin->deallocateData(p);
+  }
+}
+
 void RuntimePluginLoader::finalize()
 {
   for (auto &plugin : plugins)
@@ -122,14 +158,23 @@ void RuntimePluginLoader::initDirectory(const std::string &path)
 
   if ((dir = opendir(path.c_str())) != NULL)
   {
+    // dlopen holds the loader lock, so the plugins are loaded one at a time,
+    // in name order so they are called in the same order on every run
+    std::vector<std::string> names;
     while ((file = readdir(dir)) != NULL)
     {
       if (isSharedObject(std::string(file->d_name)))
       {
-        initPlugin(path + "/" + file->d_name);
+        names.push_back(file->d_name);
       }
     }
     closedir(dir);
+
+    std::sort(names.begin(), names.end());
+    for (const std::string &name : names)
+    {
+      initPlugin(path + "/" + name);
+    }
   }
   else
   {
@@ -10,85 +10,87 @@
 
 int RAJA::tensor_stats::indent = 0;
 
-camp::idx_t RAJA::tensor_stats::num_vector_copy = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_copy_ctor = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast_ctor = 0;
+std::atomic<bool> RAJA::tensor_stats::s_enabled{true};
 
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided_n = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_copy{"tensor.vector_copy"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_copy_ctor{"tensor.vector_copy_ctor"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_broadcast_ctor{"tensor.vector_broadcast_ctor"};
 
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided_n = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_load_packed{"tensor.vector_load_packed"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_load_packed_n{"tensor.vector_load_packed_n"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_load_strided{"tensor.vector_load_strided"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_load_strided_n{"tensor.vector_load_strided_n"};
 
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_store_packed{"tensor.vector_store_packed"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_store_packed_n{"tensor.vector_store_packed_n"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_store_strided{"tensor.vector_store_strided"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_store_strided_n{"tensor.vector_store_strided_n"};
 
-camp::idx_t RAJA::tensor_stats::num_vector_get = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_set = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_broadcast{"tensor.vector_broadcast"};
 
-camp::idx_t RAJA::tensor_stats::num_vector_add = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_subtract = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_multiply = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_divide = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_get{"tensor.vector_get"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_set{"tensor.vector_set"};
 
-camp::idx_t RAJA::tensor_stats::num_vector_fma = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_fms = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_add{"tensor.vector_add"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_subtract{"tensor.vector_subtract"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_multiply{"tensor.vector_multiply"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_divide{"tensor.vector_divide"};
 
-camp::idx_t RAJA::tensor_stats::num_vector_sum = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_max = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_min = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmax = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmin = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_dot = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_fma{"tensor.vector_fma"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_fms{"tensor.vector_fms"};
 
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_col_col = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_col_col = 0;
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_sum{"tensor.vector_sum"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_max{"tensor.vector_max"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_min{"tensor.vector_min"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_vmax{"tensor.vector_vmax"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_vmin{"tensor.vector_vmin"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_vector_dot{"tensor.vector_dot"};
+
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_matrix_mm_mult_row_row{"tensor.matrix_mm_mult_row_row"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_matrix_mm_multacc_row_row{"tensor.matrix_mm_multacc_row_row"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_matrix_mm_mult_col_col{"tensor.matrix_mm_mult_col_col"};
+const RAJA::tensor_stats::Stat RAJA::tensor_stats::num_matrix_mm_multacc_col_col{"tensor.matrix_mm_multacc_col_col"};
 
 void RAJA::tensor_stats::resetVectorStats(){
-  num_vector_copy = 0;
-  num_vector_copy_ctor = 0;
-  num_vector_broadcast_ctor = 0;
-
-  num_vector_load_packed = 0;
-  num_vector_load_packed_n = 0;
-  num_vector_load_strided = 0;
-  num_vector_load_strided_n = 0;
-  num_vector_store_packed = 0;
-  num_vector_store_packed_n = 0;
-  num_vector_store_strided = 0;
-  num_vector_store_strided_n = 0;
-
-  num_vector_broadcast = 0;
-
-  num_vector_get = 0;
-  num_vector_set = 0;
-
-  num_vector_add = 0;
-  num_vector_subtract = 0;
-  num_vector_multiply = 0;
-  num_vector_divide = 0;
-
-  num_vector_fma = 0;
-  num_vector_fms = 0;
-  num_vector_sum = 0;
-  num_vector_max = 0;
-  num_vector_min = 0;
-  num_vector_vmax = 0;
-  num_vector_vmin = 0;
-  num_vector_dot = 0;
-
-  num_matrix_mm_mult_row_row = 0;
-  num_matrix_mm_multacc_row_row = 0;
-  num_matrix_mm_mult_col_col = 0;
-  num_matrix_mm_multacc_col_col = 0;
+  num_vector_copy.reset();
+  num_vector_copy_ctor.reset();
+  num_vector_broadcast_ctor.reset();
+
+  num_vector_load_packed.reset();
+  num_vector_load_packed_n.reset();
+  num_vector_load_strided.reset();
+  num_vector_load_strided_n.reset();
+  num_vector_store_packed.reset();
+  num_vector_store_packed_n.reset();
+  num_vector_store_strided.reset();
+  num_vector_store_strided_n.reset();
+
+  num_vector_broadcast.reset();
+
+  num_vector_get.reset();
+  num_vector_set.reset();
+
+  num_vector_add.reset();
+  num_vector_subtract.reset();
+  num_vector_multiply.reset();
+  num_vector_divide.reset();
+
+  num_vector_fma.reset();
+  num_vector_fms.reset();
+  num_vector_sum.reset();
+  num_vector_max.reset();
+  num_vector_min.reset();
+  num_vector_vmax.reset();
+  num_vector_vmin.reset();
+  num_vector_dot.reset();
+
+  num_matrix_mm_mult_row_row.reset();
+  num_matrix_mm_multacc_row_row.reset();
+  num_matrix_mm_mult_col_col.reset();
+  num_matrix_mm_multacc_col_col.reset();
 }
 
-#define PRINT_STAT(STAT) if(STAT){printf("  %-32s   %ld\n", #STAT, STAT);}
+#define PRINT_STAT(STAT) if(STAT.value()){printf("  %-32s   %lld\n", #STAT, STAT.value());}
 
 void RAJA::tensor_stats::printVectorStats(){
 
@@ -0,0 +1,324 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+
+#if defined(RAJA_ENABLE_CUDA) && defined(RAJA_ENABLE_NV_TOOLS_EXT)
+#include "nvToolsExt.h"
+#define RAJA_TRACE_PLUGIN_NVTX
+#endif
+
+#if defined(RAJA_ENABLE_HIP) && defined(RAJA_ENABLE_ROCTX)
+#include "roctx.h"
+#define RAJA_TRACE_PLUGIN_ROCTX
+#endif
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+const char* unnamed_kernel = "<unnamed>";
+
+const char* platformName(Platform platform)
+{
+  switch (platform) {
+    case Platform::host: return "host";
+    case Platform::cuda: return "cuda";
+    case Platform::omp_target: return "omp_target";
+    case Platform::hip: return "hip";
+    case Platform::sycl: return "sycl";
+    default: return "undefined";
+  }
+}
+
+//! readable name of a policy from its mangled name
+std::string demangle(const char* mangled)
+{
+  if (mangled == nullptr) return "";
+#if defined(__GNUG__)
+  int status = 0;
+  char* name = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+  if (status == 0 && name != nullptr) {
+    std::string result(name);
+    free(name);
+    return result;
+  }
+#endif
+  return mangled;
+}
+
+void appendJsonString(std::string& out, const std::string& str)
+{
+  out += '"';
+  for (char c : str) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          snprintf(buf, sizeof(buf), "\\u%04x", c);
+          out += buf;
+        } else {
+          out += c;
+        }
+    }
+  }
+  out += '"';
+}
+
+//! a launch between preLaunch and postLaunch
+struct Launch {
+  clock_type::time_point start;
+  bool ranged;
+};
+
+// patterns may be nested in the loop bodies of host patterns and launched
+// from several threads, so each thread keeps a stack of its launches
+thread_local std::vector<Launch> launches;
+
+std::atomic<int> next_thread_id{0};
+
+int threadId()
+{
+  thread_local int id = next_thread_id++;
+  return id;
+}
+
+TracePlugin* registered_tracer = nullptr;
+
+}  // end anonymous namespace
+
+struct TracePlugin::Impl {
+  //! a completed launch for the Chrome trace
+  struct Event {
+    std::string name;
+    const std::string* policy;
+    Platform platform;
+    long long iterations;
+    int thread;
+    double start_us;
+    double duration_us;
+  };
+
+  bool nvtx = false;
+  bool roctx = false;
+  bool chrome = false;
+
+  clock_type::time_point origin = clock_type::now();
+
+  std::mutex mutex;
+
+  // policies are looked up by the address of their mangled name, which is
+  // the same for every launch of a policy
+  std::unordered_map<const char*, std::string> policies;
+
+  std::vector<Event> events;
+
+  bool enabled() const { return nvtx || roctx || chrome; }
+
+  const std::string& policyName(const char* mangled)
+  {
+    auto it = policies.find(mangled);
+    if (it == policies.end()) {
+      it = policies.emplace(mangled, demangle(mangled)).first;
+    }
+    return it->second;
+  }
+
+  std::string rangeName(const PluginContext& p)
+  {
+    std::string name = p.kernel_name ? p.kernel_name : unnamed_kernel;
+    std::lock_guard<std::mutex> lock(mutex);
+    name += " [";
+    name += policyName(p.policy_name);
+    name += "]";
+    return name;
+  }
+};
+
+TracePlugin::TracePlugin() : m_impl(new Impl)
+{
+  registered_tracer = this;
+
+  const char* env = getenv("RAJA_TRACE");
+  if (env != nullptr) setOutputs(env);
+}
+
+TracePlugin::~TracePlugin()
+{
+  if (registered_tracer == this) registered_tracer = nullptr;
+}
+
+TracePlugin* TracePlugin::instance() { return registered_tracer; }
+
+void TracePlugin::setOutputs(const std::string& outputs)
+{
+  m_impl->nvtx = false;
+  m_impl->roctx = false;
+  m_impl->chrome = false;
+
+  size_t begin = 0;
+  while (begin <= outputs.size()) {
+    size_t end = outputs.find(',', begin);
+    if (end == std::string::npos) end = outputs.size();
+    std::string output = outputs.substr(begin, end - begin);
+    if (output == "nvtx") {
+#if defined(RAJA_TRACE_PLUGIN_NVTX)
+      m_impl->nvtx = true;
+#else
+      printf("[TracePlugin]: RAJA is built without NVTX, ignoring nvtx\n");
+#endif
+    } else if (output == "roctx") {
+#if defined(RAJA_TRACE_PLUGIN_ROCTX)
+      m_impl->roctx = true;
+#else
+      printf("[TracePlugin]: RAJA is built without ROCTX, ignoring roctx\n");
+#endif
+    } else if (output == "chrome") {
+      m_impl->chrome = true;
+    } else if (!output.empty()) {
+      printf("[TracePlugin]: unknown trace output %s\n", output.c_str());
+    }
+    begin = end + 1;
+  }
+}
+
+void TracePlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  if (!m_impl->enabled()) return;
+
+  const bool ranged = m_impl->nvtx || m_impl->roctx;
+  if (ranged) {
+    std::string name = m_impl->rangeName(p);
+#if defined(RAJA_TRACE_PLUGIN_NVTX)
+    if (m_impl->nvtx) {
+      nvtxEventAttributes_t attributes = {};
+      attributes.version = NVTX_VERSION;
+      attributes.size = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+      attributes.messageType = NVTX_MESSAGE_TYPE_ASCII;
+      attributes.message.ascii = name.c_str();
+      if (p.num_iterations >= 0) {
+        attributes.payloadType = NVTX_PAYLOAD_TYPE_INT64;
+        attributes.payload.llValue = p.num_iterations;
+      }
+      nvtxRangePushEx(&attributes);
+    }
+#endif
+#if defined(RAJA_TRACE_PLUGIN_ROCTX)
+    if (m_impl->roctx) {
+      // ROCTX ranges have no payload, so the count is put in the message
+      if (p.num_iterations >= 0) {
+        name += " n=" + std::to_string(p.num_iterations);
+      }
+      roctxRangePushA(name.c_str());
+    }
+#endif
+  }
+
+  launches.push_back(Launch{clock_type::now(), ranged});
+}
+
+void TracePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (launches.empty()) return;
+
+  const clock_type::time_point stop = clock_type::now();
+  Launch launch = launches.back();
+  launches.pop_back();
+
+  if (launch.ranged) {
+#if defined(RAJA_TRACE_PLUGIN_NVTX)
+    if (m_impl->nvtx) nvtxRangePop();
+#endif
+#if defined(RAJA_TRACE_PLUGIN_ROCTX)
+    if (m_impl->roctx) roctxRangePop();
+#endif
+  }
+
+  if (m_impl->chrome) {
+    using us = std::chrono::duration<double, std::micro>;
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->events.push_back(Impl::Event{
+        p.kernel_name ? p.kernel_name : unnamed_kernel,
+        &m_impl->policyName(p.policy_name),
+        p.platform,
+        p.num_iterations,
+        threadId(),
+        us(launch.start - m_impl->origin).count(),
+        us(stop - launch.start).count()});
+  }
+}
+
+void TracePlugin::writeChromeTrace(const std::string& path)
+{
+  std::string json = "{\"traceEvents\":[\n";
+  {
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    bool first = true;
+    char buf[128];
+    for (Impl::Event const& e : m_impl->events) {
+      if (!first) json += ",\n";
+      first = false;
+      json += "{\"name\":";
+      appendJsonString(json, e.name);
+      json += ",\"cat\":\"RAJA\",\"ph\":\"X\"";
+      snprintf(buf, sizeof(buf), ",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d",
+               e.start_us, e.duration_us, e.thread);
+      json += buf;
+      json += ",\"args\":{\"policy\":";
+      appendJsonString(json, *e.policy);
+      snprintf(buf, sizeof(buf), ",\"platform\":\"%s\",\"iterations\":%lld}}",
+               platformName(e.platform), e.iterations);
+      json += buf;
+    }
+  }
+  json += "\n]}\n";
+
+  FILE* out = fopen(path.c_str(), "w");
+  if (out == nullptr) {
+    printf("[TracePlugin]: can not open %s\n", path.c_str());
+    return;
+  }
+  fputs(json.c_str(), out);
+  fclose(out);
+}
+
+void TracePlugin::finalize()
+{
+  if (!m_impl->chrome) return;
+
+  const char* path = getenv("RAJA_TRACE_FILE");
+  writeChromeTrace((path != nullptr && path[0] != '\0') ? path
+                                                        : "raja-trace.json");
+}
+
+void linkTracePlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::TracePlugin> P("TracePlugin", "Mark RAJA patterns with NVTX or ROCTX ranges or a Chrome trace.");
@@ -0,0 +1,208 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/metrics.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+namespace RAJA {
+namespace metrics {
+
+namespace {
+
+constexpr int max_counters = 512;
+constexpr size_t cache_line_bytes = 64;
+
+// Slots of one thread, padded on both sides so no other allocation shares
+// a cache line with them.  Only the owning thread writes its slots, the
+// atomics let readers on other threads load them while it does.
+struct ThreadBlock {
+  char pad0[cache_line_bytes];
+  std::atomic<count_type> slots[max_counters];
+  char pad1[cache_line_bytes];
+};
+
+struct Registry {
+  std::mutex mutex;
+  // a deque so the names Counter::name hands out stay valid
+  std::deque<std::string> names;
+  std::unordered_map<std::string, int> ids;
+  std::vector<ThreadBlock*> live;
+  // totals of threads that exited and the totals at the last reset
+  count_type retired[max_counters] = {};
+  count_type base[max_counters] = {};
+
+  count_type sum(int id) const
+  {
+    count_type total = retired[id];
+    for (ThreadBlock* block : live) {
+      total += block->slots[id].load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+};
+
+// never destroyed so threads exiting during static destruction can still
+// fold their counts into it
+Registry& registry()
+{
+  static Registry* r = new Registry;
+  return *r;
+}
+
+struct ThreadHandle {
+  ThreadBlock* block;
+
+  ThreadHandle() : block(new ThreadBlock)
+  {
+    for (auto& slot : block->slots) {
+      slot.store(0, std::memory_order_relaxed);
+    }
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.live.push_back(block);
+  }
+
+  ~ThreadHandle()
+  {
+    Registry& r = registry();
+    {
+      std::lock_guard<std::mutex> lock(r.mutex);
+      for (int id = 0; id < max_counters; ++id) {
+        r.retired[id] += block->slots[id].load(std::memory_order_relaxed);
+      }
+      r.live.erase(std::find(r.live.begin(), r.live.end(), block));
+    }
+    delete block;
+  }
+};
+
+std::atomic<count_type>* thread_slots()
+{
+  static thread_local ThreadHandle handle;
+  return handle.block->slots;
+}
+
+void write_string(std::ostream& os, const std::string& str)
+{
+  os << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') os << '\\';
+    os << c;
+  }
+  os << '"';
+}
+
+}  // namespace
+
+Counter::Counter(const char* name)
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto found = r.ids.find(name);
+  if (found != r.ids.end()) {
+    m_id = found->second;
+    return;
+  }
+  if (static_cast<int>(r.names.size()) == max_counters) {
+    RAJA_ABORT_OR_THROW("RAJA::metrics: too many counters registered");
+  }
+  m_id = static_cast<int>(r.names.size());
+  r.names.emplace_back(name);
+  r.ids.emplace(r.names.back(), m_id);
+}
+
+void Counter::add(count_type n) const
+{
+  std::atomic<count_type>& slot = thread_slots()[m_id];
+  slot.store(slot.load(std::memory_order_relaxed) + n,
+             std::memory_order_relaxed);
+}
+
+count_type Counter::value() const
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  return r.sum(m_id) - r.base[m_id];
+}
+
+void Counter::reset() const
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.base[m_id] = r.sum(m_id);
+}
+
+const std::string& Counter::name() const
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  return r.names[m_id];
+}
+
+std::vector<Metric> snapshot()
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  std::vector<Metric> metrics;
+  metrics.reserve(r.names.size());
+  for (int id = 0; id < static_cast<int>(r.names.size()); ++id) {
+    metrics.push_back(Metric{r.names[id], r.sum(id) - r.base[id]});
+  }
+  return metrics;
+}
+
+count_type value(const std::string& name)
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  auto found = r.ids.find(name);
+  if (found == r.ids.end()) {
+    return 0;
+  }
+  return r.sum(found->second) - r.base[found->second];
+}
+
+void reset()
+{
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (int id = 0; id < static_cast<int>(r.names.size()); ++id) {
+    r.base[id] = r.sum(id);
+  }
+}
+
+void writeJSON(std::ostream& os)
+{
+  std::vector<Metric> metrics = snapshot();
+  os << "{";
+  for (size_t i = 0; i < metrics.size(); ++i) {
+    os << (i ? ",\n  " : "\n  ");
+    write_string(os, metrics[i].name);
+    os << ": " << metrics[i].value;
+  }
+  os << "\n}\n";
+}
+
+bool writeJSON(const std::string& path)
+{
+  std::ofstream file(path);
+  if (!file) {
+    return false;
+  }
+  writeJSON(file);
+  return static_cast<bool>(file);
+}
+
+}  // namespace metrics
+}  // namespace RAJA
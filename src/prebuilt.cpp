@@ -0,0 +1,148 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file with the reducers, memory pools, scans and
+ *          sorts declared in RAJA/policy/prebuilt.hpp.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_PREBUILT)
+
+#include "RAJA/RAJA.hpp"
+
+//
+// The overloads call the templates of the back-ends with explicit template
+// arguments, so they do not call themselves.
+//
+#define RAJA_PREBUILT_DEFINE_ALGORITHMS(RES, POL, POL_ARGS, BLOCK_SIZE, ASYNC, T) \
+  namespace scan                                                              \
+  {                                                                           \
+  resources::EventProxy<RES> inclusive_inplace(RES res,                       \
+                                               POL<BLOCK_SIZE, ASYNC> p,      \
+                                               T* begin,                      \
+                                               T* end,                        \
+                                               operators::plus<T> op)         \
+  {                                                                           \
+    return inclusive_inplace<POL_ARGS(BLOCK_SIZE, ASYNC), T*,                 \
+                             operators::plus<T>>(res, p, begin, end, op);     \
+  }                                                                           \
+  resources::EventProxy<RES> exclusive_inplace(RES res,                       \
+                                               POL<BLOCK_SIZE, ASYNC> p,      \
+                                               T* begin,                      \
+                                               T* end,                        \
+                                               operators::plus<T> op,         \
+                                               T init)                        \
+  {                                                                           \
+    return exclusive_inplace<POL_ARGS(BLOCK_SIZE, ASYNC), T*,                 \
+                             operators::plus<T>, T>(                          \
+        res, p, begin, end, op, init);                                        \
+  }                                                                           \
+  }                                                                           \
+  namespace sort                                                              \
+  {                                                                           \
+  resources::EventProxy<RES> unstable(RES res,                                \
+                                      POL<BLOCK_SIZE, ASYNC> p,               \
+                                      T* begin,                               \
+                                      T* end,                                 \
+                                      operators::less<T> comp)                \
+  {                                                                           \
+    return unstable<POL_ARGS(BLOCK_SIZE, ASYNC), T*>(                         \
+        res, p, begin, end, comp);                                            \
+  }                                                                           \
+  resources::EventProxy<RES> stable(RES res,                                  \
+                                    POL<BLOCK_SIZE, ASYNC> p,                 \
+                                    T* begin,                                 \
+                                    T* end,                                   \
+                                    operators::less<T> comp)                  \
+  {                                                                           \
+    return stable<POL_ARGS(BLOCK_SIZE, ASYNC), T*>(res, p, begin, end, comp); \
+  }                                                                           \
+  }
+
+namespace RAJA
+{
+
+template class ReduceSum<seq_reduce, double>;
+template class ReduceSum<seq_reduce, int>;
+
+#if defined(RAJA_ENABLE_OPENMP)
+template class ReduceSum<omp_reduce, double>;
+template class ReduceSum<omp_reduce, int>;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+template class ReduceSum<cuda_reduce, double>;
+template class ReduceSum<cuda_reduce, int>;
+template class ReduceSum<cuda_reduce_atomic, double>;
+template class ReduceSum<cuda_reduce_atomic, int>;
+
+template class basic_mempool::MemPool<cuda::DeviceAllocator>;
+template class basic_mempool::MemPool<cuda::DeviceZeroedAllocator>;
+template class basic_mempool::MemPool<cuda::PinnedAllocator>;
+#if defined(RAJA_ENABLE_SLAB_MEMPOOL)
+template class basic_mempool::SlabPool<cuda::DeviceAllocator>;
+template class basic_mempool::SlabPool<cuda::DeviceZeroedAllocator>;
+template class basic_mempool::SlabPool<cuda::PinnedAllocator>;
+#endif
+
+namespace impl
+{
+#define RAJA_PREBUILT_CUDA_ARGS(BLOCK_SIZE, ASYNC) \
+  BLOCK_SIZE, policy::cuda::MIN_BLOCKS_PER_SM, ASYNC
+#define RAJA_PREBUILT_DEFINE_CUDA(BLOCK_SIZE, ASYNC, T)    \
+  RAJA_PREBUILT_DEFINE_ALGORITHMS(resources::Cuda,         \
+                                  cuda_exec,               \
+                                  RAJA_PREBUILT_CUDA_ARGS, \
+                                  BLOCK_SIZE,              \
+                                  ASYNC,                   \
+                                  T)
+RAJA_PREBUILT_ALGORITHM_POLICIES(RAJA_PREBUILT_DEFINE_CUDA)
+#undef RAJA_PREBUILT_DEFINE_CUDA
+#undef RAJA_PREBUILT_CUDA_ARGS
+}  // namespace impl
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template class ReduceSum<hip_reduce, double>;
+template class ReduceSum<hip_reduce, int>;
+
+template class basic_mempool::MemPool<hip::DeviceAllocator>;
+template class basic_mempool::MemPool<hip::DeviceZeroedAllocator>;
+template class basic_mempool::MemPool<hip::PinnedAllocator>;
+#if defined(RAJA_ENABLE_SLAB_MEMPOOL)
+template class basic_mempool::SlabPool<hip::DeviceAllocator>;
+template class basic_mempool::SlabPool<hip::DeviceZeroedAllocator>;
+template class basic_mempool::SlabPool<hip::PinnedAllocator>;
+#endif
+
+namespace impl
+{
+#define RAJA_PREBUILT_HIP_ARGS(BLOCK_SIZE, ASYNC) BLOCK_SIZE, ASYNC
+#define RAJA_PREBUILT_DEFINE_HIP(BLOCK_SIZE, ASYNC, T)    \
+  RAJA_PREBUILT_DEFINE_ALGORITHMS(resources::Hip,         \
+                                  hip_exec,               \
+                                  RAJA_PREBUILT_HIP_ARGS, \
+                                  BLOCK_SIZE,             \
+                                  ASYNC,                  \
+                                  T)
+RAJA_PREBUILT_ALGORITHM_POLICIES(RAJA_PREBUILT_DEFINE_HIP)
+#undef RAJA_PREBUILT_DEFINE_HIP
+#undef RAJA_PREBUILT_HIP_ARGS
+}  // namespace impl
+#endif
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_PREBUILT
@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_PARTITION_HPP__
+#define __TEST_COMPACT_PARTITION_HPP__
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+template <typename T>
+::testing::AssertionResult check_partition(
+  const T* actual,
+  int actual_count,
+  const T* original,
+  int N)
+{
+  // selected items in order followed by the rejected items in reverse order
+  std::vector<T> expected;
+  std::copy_if(original, original + N, std::back_inserter(expected),
+               CompactTestPredicate<T>{});
+  const int expected_count = static_cast<int>(expected.size());
+  for (int i = N - 1; i >= 0; --i) {
+    if (!CompactTestPredicate<T>{}(original[i])) {
+      expected.push_back(original[i]);
+    }
+  }
+
+  if (actual_count != expected_count) {
+    return ::testing::AssertionFailure()
+           << actual_count << " != " << expected_count << " (count)";
+  }
+  for (int i = 0; i < N; ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactPartitionTestImpl(int N)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  T* work_in;
+  T* work_out;
+  int* work_count;
+  T* host_in;
+  T* host_out;
+  int* host_count;
+
+  allocCompactTestData(N,
+                       working_res,
+                       &work_in, &work_out, &work_count,
+                       &host_in, &host_out, &host_count);
+
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = static_cast<T>((i * 7) % 101);
+  }
+
+  // test interface without resource
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.wait();
+
+  RAJA::partition<EXEC_POLICY>(RAJA::make_span(static_cast<const T*>(work_in), N),
+                               RAJA::make_span(work_out, N),
+                               work_count,
+                               CompactTestPredicate<T>{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_TRUE(check_partition(host_out, *host_count, host_in, N));
+
+  // test interface with resource
+  RAJA::partition<EXEC_POLICY>(res,
+                               RAJA::make_span(static_cast<const T*>(work_in), N),
+                               RAJA::make_span(work_out, N),
+                               work_count,
+                               CompactTestPredicate<T>{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_TRUE(check_partition(host_out, *host_count, host_in, N));
+
+  deallocCompactTestData(working_res,
+                         work_in, work_out, work_count,
+                         host_in, host_out, host_count);
+}
+
+
+TYPED_TEST_SUITE_P(CompactPartitionTest);
+template <typename T>
+class CompactPartitionTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactPartitionTest, CompactPartition)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  CompactPartitionTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(0);
+  CompactPartitionTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(1);
+  CompactPartitionTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(357);
+  CompactPartitionTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactPartitionTest,
+                            CompactPartition);
+
+#endif // __TEST_COMPACT_PARTITION_HPP__
@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_REDUCEBYKEY_HPP__
+#define __TEST_COMPACT_REDUCEBYKEY_HPP__
+
+#include <vector>
+
+template <typename T>
+::testing::AssertionResult check_reduce_by_key(
+  const int* actual_keys,
+  const T* actual_values,
+  int actual_count,
+  const int* keys,
+  const T* values,
+  int N)
+{
+  std::vector<int> expected_keys;
+  std::vector<T> expected_values;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i - 1] != keys[i]) {
+      expected_keys.push_back(keys[i]);
+      expected_values.push_back(values[i]);
+    } else {
+      expected_values.back() += values[i];
+    }
+  }
+  if (actual_count != static_cast<int>(expected_keys.size())) {
+    return ::testing::AssertionFailure()
+           << actual_count << " != " << expected_keys.size() << " (count)";
+  }
+  for (int i = 0; i < actual_count; ++i) {
+    if (actual_keys[i] != expected_keys[i]) {
+      return ::testing::AssertionFailure()
+             << actual_keys[i] << " != " << expected_keys[i]
+             << " (key at index " << i << ")";
+    }
+    if (actual_values[i] != expected_values[i]) {
+      return ::testing::AssertionFailure()
+             << actual_values[i] << " != " << expected_values[i]
+             << " (value at index " << i << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactReduceByKeyTestImpl(int N)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in;
+  T* work_out;
+  int* work_count;
+  T* host_in;
+  T* host_out;
+  int* host_count;
+
+  allocCompactTestData(N,
+                       working_res,
+                       &work_in, &work_out, &work_count,
+                       &host_in, &host_out, &host_count);
+
+  int* work_keys     = working_res.allocate<int>(N);
+  int* work_out_keys = working_res.allocate<int>(N);
+  int* host_keys     = host_res.allocate<int>(N);
+  int* host_out_keys = host_res.allocate<int>(N);
+
+  // short runs in the first half and one run over the second half, which
+  // spans the chunks of several threads
+  for (int i = 0; i < N; ++i) {
+    host_keys[i] = i < N / 2 ? (i / (1 + i % 4)) % 5 : -1;
+    host_in[i] = static_cast<T>(i % 10);
+  }
+
+  // test interface without resource
+  res.memcpy(work_keys, host_keys, sizeof(int) * N);
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.wait();
+
+  RAJA::reduce_by_key<EXEC_POLICY>(
+      RAJA::make_span(static_cast<const int*>(work_keys), N),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out_keys, N),
+      RAJA::make_span(work_out, N),
+      work_count);
+
+  res.memcpy(host_out_keys, work_out_keys, sizeof(int) * N);
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_TRUE(check_reduce_by_key(host_out_keys, host_out, *host_count,
+                                  host_keys, host_in, N));
+
+  // test interface with resource
+  RAJA::reduce_by_key<EXEC_POLICY>(
+      res,
+      RAJA::make_span(static_cast<const int*>(work_keys), N),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out_keys, N),
+      RAJA::make_span(work_out, N),
+      work_count,
+      RAJA::operators::plus<T>{});
+
+  res.memcpy(host_out_keys, work_out_keys, sizeof(int) * N);
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_TRUE(check_reduce_by_key(host_out_keys, host_out, *host_count,
+                                  host_keys, host_in, N));
+
+  working_res.deallocate(work_keys);
+  working_res.deallocate(work_out_keys);
+  host_res.deallocate(host_keys);
+  host_res.deallocate(host_out_keys);
+
+  deallocCompactTestData(working_res,
+                         work_in, work_out, work_count,
+                         host_in, host_out, host_count);
+}
+
+
+TYPED_TEST_SUITE_P(CompactReduceByKeyTest);
+template <typename T>
+class CompactReduceByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactReduceByKeyTest, CompactReduceByKey)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  CompactReduceByKeyTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(0);
+  CompactReduceByKeyTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(1);
+  CompactReduceByKeyTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(357);
+  CompactReduceByKeyTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactReduceByKeyTest,
+                            CompactReduceByKey);
+
+#endif // __TEST_COMPACT_REDUCEBYKEY_HPP__
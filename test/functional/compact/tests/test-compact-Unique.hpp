@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_UNIQUE_HPP__
+#define __TEST_COMPACT_UNIQUE_HPP__
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+template <typename T>
+::testing::AssertionResult check_unique(
+  const T* actual,
+  int actual_count,
+  const T* original,
+  int N)
+{
+  std::vector<T> expected;
+  std::unique_copy(original, original + N, std::back_inserter(expected));
+  if (actual_count != static_cast<int>(expected.size())) {
+    return ::testing::AssertionFailure()
+           << actual_count << " != " << expected.size() << " (count)";
+  }
+  for (int i = 0; i < actual_count; ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename T>
+void CompactUniqueTestImpl(int N)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  T* work_in;
+  T* work_out;
+  int* work_count;
+  T* host_in;
+  T* host_out;
+  int* host_count;
+
+  allocCompactTestData(N,
+                       working_res,
+                       &work_in, &work_out, &work_count,
+                       &host_in, &host_out, &host_count);
+
+  for (int i = 0; i < N; ++i) {
+    host_in[i] = static_cast<T>((i / (1 + i % 4)) % 5);
+  }
+
+  // test interface without resource
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.wait();
+
+  RAJA::unique<EXEC_POLICY>(RAJA::make_span(static_cast<const T*>(work_in), N),
+                            RAJA::make_span(work_out, N),
+                            work_count);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_TRUE(check_unique(host_out, *host_count, host_in, N));
+
+  // test interface with resource
+  RAJA::unique<EXEC_POLICY>(res,
+                            RAJA::make_span(static_cast<const T*>(work_in), N),
+                            RAJA::make_span(work_out, N),
+                            work_count);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_count, work_count, sizeof(int));
+  res.wait();
+
+  ASSERT_TRUE(check_unique(host_out, *host_count, host_in, N));
+
+  deallocCompactTestData(working_res,
+                         work_in, work_out, work_count,
+                         host_in, host_out, host_count);
+}
+
+
+TYPED_TEST_SUITE_P(CompactUniqueTest);
+template <typename T>
+class CompactUniqueTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactUniqueTest, CompactUnique)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using DATA_TYPE        = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  CompactUniqueTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(0);
+  CompactUniqueTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(1);
+  CompactUniqueTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(357);
+  CompactUniqueTestImpl<EXEC_POLICY, WORKING_RESOURCE, DATA_TYPE>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactUniqueTest,
+                            CompactUnique);
+
+#endif // __TEST_COMPACT_UNIQUE_HPP__
@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_DATA_HPP__
+#define __TEST_COMPACT_DATA_HPP__
+
+//
+// Predicate used to select items in compaction tests.
+//
+template <typename T>
+struct CompactTestPredicate
+{
+  RAJA_HOST_DEVICE bool operator()(const T& v) const
+  {
+    return static_cast<int>(v) % 3 == 0;
+  }
+};
+
+//
+// Methods to allocate/deallocate compaction test data.
+//
+
+template <typename T>
+void allocCompactTestData(int N,
+                          camp::resources::Resource work_res,
+                          T** work_in, T** work_out, int** work_count,
+                          T** host_in, T** host_out, int** host_count)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_in    = work_res.allocate<T>(N);
+  *work_out   = work_res.allocate<T>(N);
+  *work_count = work_res.allocate<int>(1);
+
+  *host_in    = host_res.allocate<T>(N);
+  *host_out   = host_res.allocate<T>(N);
+  *host_count = host_res.allocate<int>(1);
+}
+
+template <typename T>
+void deallocCompactTestData(camp::resources::Resource work_res,
+                            T* work_in, T* work_out, int* work_count,
+                            T* host_in, T* host_out, int* host_count)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_in);
+  work_res.deallocate(work_out);
+  work_res.deallocate(work_count);
+  host_res.deallocate(host_in);
+  host_res.deallocate(host_out);
+  host_res.deallocate(host_count);
+}
+
+#endif // __TEST_COMPACT_DATA_HPP__
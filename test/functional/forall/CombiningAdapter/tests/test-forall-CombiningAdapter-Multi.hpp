@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_CombiningAdapter_Multi_HPP__
+#define __TEST_FORALL_CombiningAdapter_Multi_HPP__
+
+#include <numeric>
+#include <cstring>
+
+#include "RAJA/util/CombiningAdapter.hpp"
+
+//
+// Pack the ids of the cells on the six faces of an nx by ny by nz box into
+// one buffer, face after face, with one forall.
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallCombiningAdapterMultiTestImpl(INDEX_TYPE nx, INDEX_TYPE ny,
+                                         INDEX_TYPE nz)
+{
+  using Range = RAJA::TypedRangeSegment<INDEX_TYPE>;
+  Range rx(0, RAJA::stripIndexType(nx));
+  Range ry(0, RAJA::stripIndexType(ny));
+  Range rz(0, RAJA::stripIndexType(nz));
+  Range xlo(0, 1), xhi(RAJA::stripIndexType(nx) - 1, RAJA::stripIndexType(nx));
+  Range ylo(0, 1), yhi(RAJA::stripIndexType(ny) - 1, RAJA::stripIndexType(ny));
+  Range zlo(0, 1), zhi(RAJA::stripIndexType(nz) - 1, RAJA::stripIndexType(nz));
+
+  auto boxes = {RAJA::make_tuple(xlo, ry, rz), RAJA::make_tuple(xhi, ry, rz),
+                RAJA::make_tuple(rx, ylo, rz), RAJA::make_tuple(rx, yhi, rz),
+                RAJA::make_tuple(rx, ry, zlo), RAJA::make_tuple(rx, ry, zhi)};
+
+  INDEX_TYPE N = INDEX_TYPE(2) * (ny * nz + nx * nz + nx * ny);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  {
+    INDEX_TYPE n = INDEX_TYPE(0);
+    for (auto const& box : boxes) {
+      for (INDEX_TYPE i : camp::get<0>(box)) {
+        for (INDEX_TYPE j : camp::get<1>(box)) {
+          for (INDEX_TYPE k : camp::get<2>(box)) {
+            test_array[RAJA::stripIndexType(n++)] = (i * ny + j) * nz + k;
+          }
+        }
+      }
+    }
+
+    working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+
+    auto adapter = RAJA::make_MultiCombiningAdapter(
+        [=] RAJA_HOST_DEVICE(INDEX_TYPE idx, INDEX_TYPE i, INDEX_TYPE j,
+                             INDEX_TYPE k) {
+          working_array[RAJA::stripIndexType(idx)] += (i * ny + j) * nz + k;
+        },
+        RAJA::make_tuple(xlo, ry, rz), RAJA::make_tuple(xhi, ry, rz),
+        RAJA::make_tuple(rx, ylo, rz), RAJA::make_tuple(rx, yhi, rz),
+        RAJA::make_tuple(rx, ry, zlo), RAJA::make_tuple(rx, ry, zhi));
+
+    ASSERT_EQ(N, adapter.size());
+    ASSERT_EQ(INDEX_TYPE(2) * ny * nz, adapter.getOffset(2));
+
+    RAJA::forall<EXEC_POLICY>(adapter.getRange(), adapter);
+
+  }
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallCombiningAdapterMultiTest);
+template <typename T>
+class ForallCombiningAdapterMultiTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallCombiningAdapterMultiTest, ForallMulti)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallCombiningAdapterMultiTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(1), INDEX_TYPE(1), INDEX_TYPE(1));
+  ForallCombiningAdapterMultiTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(4), INDEX_TYPE(5), INDEX_TYPE(6));
+  ForallCombiningAdapterMultiTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(17), INDEX_TYPE(9), INDEX_TYPE(33));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallCombiningAdapterMultiTest,
+                            ForallMulti);
+
+#endif  // __TEST_FORALL_CombiningAdapter_Multi_HPP__
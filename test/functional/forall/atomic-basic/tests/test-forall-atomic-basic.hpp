@@ -132,6 +132,54 @@ void ForallAtomicBasicTestImpl( IdxType seglimit )
   EXPECT_LT((T)0, check_array[7]);
   EXPECT_GE((T)seglimit, check_array[7]);
 
+  deallocateForallTestData<T>(  work_res,
+                                work_array,
+                                check_array,
+                                test_array );
+
+  // use atomic reserve to give each index its own pair of slots
+  const IdxType slots_len = 2 * seglimit + 1;
+
+  allocateForallTestData<T>(  slots_len,
+                              work_res,
+                              &work_array,
+                              &check_array,
+                              &test_array );
+
+  for (IdxType s = 0; s < slots_len; ++s) {
+    test_array[s] = (T)0;
+  }
+
+  work_res.memcpy( work_array, test_array, sizeof(T) * slots_len );
+
+  RAJA::forall<ExecPolicy>(seg, [=] RAJA_HOST_DEVICE(IdxType i) {
+    IdxType offset = (IdxType)RAJA::atomicReserve<AtomicPolicy>(work_array, (T)2);
+    work_array[1 + offset] += (T)1;
+    work_array[2 + offset] += (T)(i + 1);
+  });
+
+  work_res.memcpy( check_array, work_array, sizeof(T) * slots_len );
+
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk(cudaDeviceSynchronize());
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+  hipErrchk(hipDeviceSynchronize());
+#endif
+
+  EXPECT_EQ((T)(2 * seglimit), check_array[0]);
+
+  std::vector<bool> reserved(seglimit, false);
+  for (IdxType s = 0; s < seglimit; ++s) {
+    ASSERT_EQ((T)1, check_array[1 + 2 * s]);
+    IdxType i = (IdxType)check_array[2 + 2 * s] - 1;
+    ASSERT_LE((IdxType)0, i);
+    ASSERT_GT(seglimit, i);
+    ASSERT_FALSE(reserved[i]);
+    reserved[i] = true;
+  }
+
   deallocateForallTestData<T>(  work_res,
                                 work_array,
                                 check_array,
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_FUSED_HPP__
+#define __TEST_FORALL_FUSED_HPP__
+
+#include <numeric>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallFusedTestImpl(INDEX_TYPE N0, INDEX_TYPE N1, INDEX_TYPE N2)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r0(INDEX_TYPE(0), N0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(N0, N0 + N1);
+  RAJA::TypedRangeSegment<INDEX_TYPE> empty(INDEX_TYPE(0), INDEX_TYPE(0));
+  RAJA::TypedRangeStrideSegment<INDEX_TYPE> r2(INDEX_TYPE(0), N2, INDEX_TYPE(1));
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  const INDEX_TYPE N = N0 + N1 + N2;
+  size_t data_len = static_cast<size_t>(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  // each loop writes its own part of the array
+  std::iota(test_array, test_array + data_len, INDEX_TYPE(1));
+
+  RAJA::forall_fused<EXEC_POLICY>(
+      r0, [=] RAJA_HOST_DEVICE(INDEX_TYPE i) {
+        working_array[i] = i + INDEX_TYPE(1);
+      },
+      r1, [=] RAJA_HOST_DEVICE(INDEX_TYPE i) {
+        working_array[i] = i + INDEX_TYPE(1);
+      },
+      empty, [=] RAJA_HOST_DEVICE(INDEX_TYPE) {
+        working_array[0] = INDEX_TYPE(0);
+      },
+      r2, [=] RAJA_HOST_DEVICE(INDEX_TYPE i) {
+        working_array[N0 + N1 + i] = N0 + N1 + i + INDEX_TYPE(1);
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallFusedTest);
+template <typename T>
+class ForallFusedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallFusedTest, FusedForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(1), INDEX_TYPE(1), INDEX_TYPE(1));
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(27), INDEX_TYPE(100), INDEX_TYPE(3));
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(1000), INDEX_TYPE(257), INDEX_TYPE(120));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallFusedTest,
+                            FusedForall);
+
+#endif  // __TEST_FORALL_FUSED_HPP__
@@ -0,0 +1,155 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_MULTI_DEVICE_HPP__
+#define __TEST_FORALL_MULTI_DEVICE_HPP__
+
+#include <limits>
+#include <stdexcept>
+
+//
+// Reducer object policy of the back-end of each resource, used to check
+// that multi_device_exec rejects reducer objects
+//
+template <typename WORKING_RES>
+struct MultiDeviceReducePolicy;
+
+#if defined(RAJA_ENABLE_CUDA)
+template <>
+struct MultiDeviceReducePolicy<camp::resources::Cuda> {
+  using type = RAJA::cuda_reduce;
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template <>
+struct MultiDeviceReducePolicy<camp::resources::Hip> {
+  using type = RAJA::hip_reduce;
+};
+#endif
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ForallMultiDeviceTestImpl(RAJA::Index_type N)
+{
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+
+  // every device reads and writes the arrays, so they are managed
+  size_t data_len = static_cast<size_t>(N > 0 ? N : 1);
+  double* x = working_res.allocate<double>(
+      data_len, camp::resources::MemoryAccess::Managed);
+  double* y = working_res.allocate<double>(
+      data_len, camp::resources::MemoryAccess::Managed);
+
+  double ref_sum = 0.0;
+  double ref_min = std::numeric_limits<double>::max();
+  double ref_max = std::numeric_limits<double>::lowest();
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    x[i] = static_cast<double>((i * 7) % 101) - 50.0;
+    y[i] = 0.0;
+    ref_sum += x[i];
+    ref_min = RAJA_MIN(ref_min, x[i]);
+    ref_max = RAJA_MAX(ref_max, x[i]);
+  }
+
+  double sum = 0.0;
+  double xmin = std::numeric_limits<double>::max();
+  double xmax = std::numeric_limits<double>::lowest();
+
+  RAJA::forall<EXEC_POLICY>(
+      res,
+      RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      RAJA::expt::Reduce<RAJA::operators::minimum>(&xmin),
+      RAJA::expt::Reduce<RAJA::operators::maximum>(&xmax),
+      [=] RAJA_HOST_DEVICE(RAJA::Index_type i, double& s, double& mn,
+                           double& mx) {
+        y[i] = 2.0 * x[i];
+        s += x[i];
+        mn = RAJA_MIN(mn, x[i]);
+        mx = RAJA_MAX(mx, x[i]);
+      });
+
+  res.wait();
+
+  // the values are whole numbers, so the sum is exact in any order
+  ASSERT_EQ(ref_sum, sum);
+  ASSERT_EQ(ref_min, xmin);
+  ASSERT_EQ(ref_max, xmax);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(2.0 * x[i], y[i]);
+  }
+
+  working_res.deallocate(x, camp::resources::MemoryAccess::Managed);
+  working_res.deallocate(y, camp::resources::MemoryAccess::Managed);
+}
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ForallMultiDeviceReducerObjectTestImpl()
+{
+  using REDUCE_POLICY = typename MultiDeviceReducePolicy<WORKING_RES>::type;
+
+  WORKING_RES res = WORKING_RES::get_default();
+
+  int orig_dev = -1;
+  int dev = -1;
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk(cudaGetDevice(&orig_dev));
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk(hipGetDevice(&orig_dev));
+#endif
+
+  // each device would combine only its own part into the reducer object
+  RAJA::ReduceSum<REDUCE_POLICY, int> count(0);
+
+  EXPECT_THROW(
+      (RAJA::forall<EXEC_POLICY>(
+          res,
+          RAJA::TypedRangeSegment<int>(0, 1000),
+          [=] RAJA_HOST_DEVICE(int) { count += 1; })),
+      std::runtime_error);
+
+#if defined(RAJA_ENABLE_CUDA)
+  cudaErrchk(cudaGetDevice(&dev));
+#elif defined(RAJA_ENABLE_HIP)
+  hipErrchk(hipGetDevice(&dev));
+#endif
+  ASSERT_EQ(orig_dev, dev);
+  ASSERT_EQ(0, count.get());
+}
+
+
+TYPED_TEST_SUITE_P(ForallMultiDeviceTest);
+template <typename T>
+class ForallMultiDeviceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallMultiDeviceTest, MultiDeviceForallReduce)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ForallMultiDeviceTestImpl<WORKING_RES, EXEC_POLICY>(0);
+  ForallMultiDeviceTestImpl<WORKING_RES, EXEC_POLICY>(1);
+  ForallMultiDeviceTestImpl<WORKING_RES, EXEC_POLICY>(1000);
+  ForallMultiDeviceTestImpl<WORKING_RES, EXEC_POLICY>((1 << 20) + 3);
+}
+
+TYPED_TEST_P(ForallMultiDeviceTest, MultiDeviceForallRejectsReducerObjects)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ForallMultiDeviceReducerObjectTestImpl<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallMultiDeviceTest,
+                            MultiDeviceForallReduce,
+                            MultiDeviceForallRejectsReducerObjects);
+
+#endif  // __TEST_FORALL_MULTI_DEVICE_HPP__
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_OVERLAP_HPP__
+#define __TEST_FORALL_OVERLAP_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallOverlapTestImpl(INDEX_TYPE nx, INDEX_TYPE ny, INDEX_TYPE width)
+{
+  // the layout includes a halo of width points on each side
+  RAJA::OffsetLayout<2, INDEX_TYPE> layout =
+      RAJA::make_offset_layout<2, INDEX_TYPE>({{-width, -width}},
+                                              {{nx + width, ny + width}});
+
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  const INDEX_TYPE N = layout.size();
+  size_t data_len = static_cast<size_t>(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  auto segs = RAJA::make_overlap_segments(layout, width, working_res);
+
+  // owned points within width of the halo are on the boundary
+  INDEX_TYPE num_boundary = 0;
+  for (INDEX_TYPE i = -width; i < nx + width; ++i) {
+    for (INDEX_TYPE j = -width; j < ny + width; ++j) {
+      bool owned = i >= 0 && i < nx && j >= 0 && j < ny;
+      bool boundary = owned && (i < width || i >= nx - width ||
+                                j < width || j >= ny - width);
+      test_array[layout(i, j)] = owned ? (boundary ? 2 : 1) : 0;
+      num_boundary += boundary ? 1 : 0;
+    }
+  }
+
+  ASSERT_EQ(static_cast<INDEX_TYPE>(segs.boundary.size()), num_boundary);
+  ASSERT_EQ(static_cast<INDEX_TYPE>(segs.interior.size() + segs.boundary.size()),
+            nx * ny);
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+
+  // the boundary runs after the wait, it sees the value set by the wait
+  INDEX_TYPE* flag = working_res.allocate<INDEX_TYPE>(1);
+  working_res.memset(flag, 0, sizeof(INDEX_TYPE));
+
+  int num_waits = 0;
+
+  RAJA::forall_overlap<EXEC_POLICY>(
+      res, segs.interior, segs.boundary,
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE i) {
+        working_array[i] = flag[0] + INDEX_TYPE(1);
+      },
+      [&]() {
+        ++num_waits;
+        INDEX_TYPE one(1);
+        res.memcpy(flag, &one, sizeof(INDEX_TYPE));
+        res.wait();
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.wait();
+
+  ASSERT_EQ(num_waits, 1);
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  working_res.deallocate(flag);
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallOverlapTest);
+template <typename T>
+class ForallOverlapTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallOverlapTest, OverlapForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallOverlapTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(1), INDEX_TYPE(1), INDEX_TYPE(1));
+  ForallOverlapTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(17), INDEX_TYPE(9), INDEX_TYPE(1));
+  ForallOverlapTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(40), INDEX_TYPE(33), INDEX_TYPE(2));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallOverlapTest,
+                            OverlapForall);
+
+#endif  // __TEST_FORALL_OVERLAP_HPP__
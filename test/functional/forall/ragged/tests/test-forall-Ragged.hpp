@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_RAGGED_HPP__
+#define __TEST_FORALL_RAGGED_HPP__
+
+#include <vector>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallRaggedTestImpl(INDEX_TYPE num_outer, INDEX_TYPE long_len)
+{
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  // inner lengths with empty outer items and one long outer item
+  std::vector<INDEX_TYPE> host_offsets(num_outer + 1);
+  host_offsets[0] = 0;
+  for (INDEX_TYPE o = 0; o < num_outer; ++o) {
+    INDEX_TYPE len = (o == num_outer / 2) ? long_len : (o * 7) % 13;
+    host_offsets[o + 1] = host_offsets[o] + len;
+  }
+  const INDEX_TYPE N = host_offsets[num_outer];
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = static_cast<size_t>(N > 0 ? N : 1);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  INDEX_TYPE* offsets = working_res.allocate<INDEX_TYPE>(num_outer + 1);
+  working_res.memcpy(offsets, host_offsets.data(),
+                     sizeof(INDEX_TYPE) * (num_outer + 1));
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+
+  for (INDEX_TYPE o = 0; o < num_outer; ++o) {
+    for (INDEX_TYPE c = host_offsets[o]; c < host_offsets[o + 1]; ++c) {
+      test_array[c] = o + 1;
+    }
+  }
+
+  RAJA::forall_ragged<EXEC_POLICY>(
+      res,
+      RAJA::make_span(offsets, num_outer + 1),
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE o, INDEX_TYPE c) {
+        working_array[offsets[o] + c] = o + 1;
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.wait();
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  // test interface without resource
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+  working_res.wait();
+
+  RAJA::forall_ragged<EXEC_POLICY>(
+      RAJA::make_span(offsets, num_outer + 1),
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE o, INDEX_TYPE c) {
+        working_array[offsets[o] + c] = o + 1;
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.wait();
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  working_res.deallocate(offsets);
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallRaggedTest);
+template <typename T>
+class ForallRaggedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallRaggedTest, RaggedForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallRaggedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(1), INDEX_TYPE(0));
+  ForallRaggedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(1), INDEX_TYPE(5));
+  ForallRaggedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(37), INDEX_TYPE(3));
+  ForallRaggedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(500), INDEX_TYPE(10000));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallRaggedTest,
+                            RaggedForall);
+
+#endif  // __TEST_FORALL_RAGGED_HPP__
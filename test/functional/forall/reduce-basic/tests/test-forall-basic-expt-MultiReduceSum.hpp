@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BASIC_MULTIREDUCESUM_HPP__
+#define __TEST_FORALL_BASIC_MULTIREDUCESUM_HPP__
+
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallMultiReduceSumBasicTestImpl(const SEG_TYPE& seg,
+                                       const std::vector<IDX_TYPE>& seg_idx,
+                                       camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  const size_t num_bins = 7;
+
+  std::vector<DATA_TYPE> ref_bins(num_bins, 0);
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    ref_bins[ seg_idx[i] % num_bins ] += test_array[ seg_idx[i] ];
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  std::vector<DATA_TYPE> bins(num_bins, 2);
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(seg,
+      RAJA::expt::MultiReduce<RAJA::operators::plus>(bins.data(), num_bins),
+      [=] RAJA_HOST_DEVICE(IDX_TYPE idx,
+                           RAJA::expt::MultiReduceBins<RAJA::operators::plus, DATA_TYPE> &b) {
+        b[idx % num_bins] += working_array[idx];
+    });
+  }
+
+  for (size_t bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(static_cast<DATA_TYPE>(bins[bin]), nloops * ref_bins[bin] + 2);
+  }
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallMultiReduceSumBasicTest);
+template <typename T>
+class ForallMultiReduceSumBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallMultiReduceSumBasicTest, MultiReduceSumBasicForall)
+{
+  using IDX_TYPE      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<3>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallMultiReduceSumBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 2057 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallMultiReduceSumBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r2, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r3( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallMultiReduceSumBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                    RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                    EXEC_POLICY, REDUCE_POLICY>(
+                                      r3, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallMultiReduceSumBasicTest,
+                            MultiReduceSumBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_MULTIREDUCESUM_HPP__
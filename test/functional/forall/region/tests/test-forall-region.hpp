@@ -67,6 +67,159 @@ void ForallRegionTestImpl(INDEX_TYPE first, INDEX_TYPE last)
                                        test_array);
 }
 
+//
+// Parallel loop and reduction policies that run on the team of a region
+//
+template <typename REG_POLICY>
+struct RegionParallelPolicies {
+  using exec_policy = RAJA::seq_exec;
+  using reduce_policy = RAJA::seq_reduce;
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <>
+struct RegionParallelPolicies<RAJA::omp_parallel_region> {
+  using exec_policy = RAJA::omp_parallel_for_exec;
+  using reduce_policy = RAJA::omp_reduce;
+};
+#endif
+
+//
+// Reductions, expt::Reduce params and scans in a region, each done before
+// the next statement of the region starts
+//
+template <typename INDEX_TYPE, typename WORKING_RES, typename REG_POLICY>
+void ForallRegionComposeTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  using PAR_POLICY = typename RegionParallelPolicies<REG_POLICY>::exec_policy;
+  using REDUCE_POLICY =
+      typename RegionParallelPolicies<REG_POLICY>::reduce_policy;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE N = last - first;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  RAJA::ReduceSum<REDUCE_POLICY, INDEX_TYPE> old_sum(0);
+  INDEX_TYPE param_sum = 0;
+  INDEX_TYPE* param_sum_ptr = &param_sum;
+
+  RAJA::region<REG_POLICY>([=]() {
+
+    RAJA::forall<PAR_POLICY>(rseg, [=] (INDEX_TYPE idx) {
+      working_array[idx - first] = 1;
+    });
+
+    // scans the array of ones the loops of the team wrote
+    RAJA::inclusive_scan_inplace<PAR_POLICY>(
+        RAJA::make_span(working_array, N));
+
+    RAJA::forall<PAR_POLICY>(rseg,
+      RAJA::expt::Reduce<RAJA::operators::plus>(param_sum_ptr),
+      [=] (INDEX_TYPE idx, INDEX_TYPE& sum) {
+        sum += working_array[idx - first];
+    });
+
+    RAJA::forall<PAR_POLICY>(rseg, [=] (INDEX_TYPE idx) {
+      old_sum += working_array[idx - first];
+    });
+
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = 0; i < N; i++) {
+    ASSERT_EQ(check_array[i], i + 1);
+  }
+  ASSERT_EQ(param_sum, N * (N + 1) / 2);
+  ASSERT_EQ(old_sum.get(), N * (N + 1) / 2);
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+//
+// region_barrier orders nowait loops, and region_reduce gives every thread
+// of the team the combined value
+//
+template <typename INDEX_TYPE, typename WORKING_RES,
+          typename REG_POLICY, typename EXEC_POLICY>
+void ForallRegionBarrierReduceTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  using REDUCE_POLICY =
+      typename RegionParallelPolicies<REG_POLICY>::reduce_policy;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  const INDEX_TYPE N = last - first;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> rseg(first, last);
+
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  RAJA::ReduceSum<REDUCE_POLICY, int> errors(0);
+  RAJA::ReduceSum<REDUCE_POLICY, int> threads(0);
+  RAJA::ReduceSum<REDUCE_POLICY, int> counted(0);
+
+  RAJA::region<REG_POLICY>([=]() {
+
+    RAJA::forall<EXEC_POLICY>(rseg, [=] (INDEX_TYPE idx) {
+      working_array[idx - first] = 1;
+    });
+
+    RAJA::region_barrier();
+
+    // every thread reads the whole array written by the team
+    INDEX_TYPE total = 0;
+    for (INDEX_TYPE i = 0; i < N; ++i) {
+      total += working_array[i];
+    }
+    if (total != N) {
+      errors += 1;
+    }
+
+    int count = RAJA::region_reduce(1);
+    threads += 1;
+    counted += count;
+
+    INDEX_TYPE max_total =
+        RAJA::region_reduce(total, RAJA::operators::maximum<INDEX_TYPE>{});
+    if (max_total != N) {
+      errors += 1;
+    }
+
+  });
+
+  ASSERT_EQ(errors.get(), 0);
+  ASSERT_EQ(counted.get(), threads.get() * threads.get());
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
 
 TYPED_TEST_SUITE_P(ForallRegionTest);
 template <typename T>
@@ -86,7 +239,31 @@ TYPED_TEST_P(ForallRegionTest, RegionForall)
   ForallRegionTestImpl<INDEX_TYPE, WORKING_RES, REG_POLICY, EXEC_POLICY>(3, 2556);
 }
 
+TYPED_TEST_P(ForallRegionTest, RegionCompose)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using REG_POLICY  = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallRegionComposeTestImpl<INDEX_TYPE, WORKING_RES, REG_POLICY>(0, 25);
+  ForallRegionComposeTestImpl<INDEX_TYPE, WORKING_RES, REG_POLICY>(1, 153);
+  ForallRegionComposeTestImpl<INDEX_TYPE, WORKING_RES, REG_POLICY>(3, 2556);
+}
+
+TYPED_TEST_P(ForallRegionTest, RegionBarrierReduce)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using REG_POLICY  = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallRegionBarrierReduceTestImpl<INDEX_TYPE, WORKING_RES, REG_POLICY, EXEC_POLICY>(0, 25);
+  ForallRegionBarrierReduceTestImpl<INDEX_TYPE, WORKING_RES, REG_POLICY, EXEC_POLICY>(3, 2556);
+}
+
 REGISTER_TYPED_TEST_SUITE_P(ForallRegionTest,
-                            RegionForall);
+                            RegionForall,
+                            RegionCompose,
+                            RegionBarrierReduce);
 
 #endif  // __TEST_FORALL_REGION_HPP__
@@ -0,0 +1,155 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_STENCIL_HPP__
+#define __TEST_FORALL_STENCIL_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallStencil2DTestImpl(INDEX_TYPE nx, INDEX_TYPE ny, INDEX_TYPE width)
+{
+  RAJA::OffsetLayout<2, INDEX_TYPE> layout =
+      RAJA::make_offset_layout<2, INDEX_TYPE>({{-1, 2}}, {{nx - 1, ny + 2}});
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = static_cast<size_t>(layout.size());
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  // points within width of a side of the layout are on the boundary
+  for (INDEX_TYPE i = -1; i < nx - 1; ++i) {
+    for (INDEX_TYPE j = 2; j < ny + 2; ++j) {
+      bool boundary = i < width - 1 || i >= nx - 1 - width ||
+                      j < width + 2 || j >= ny + 2 - width;
+      test_array[layout(i, j)] = boundary ? 2 : 1;
+    }
+  }
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+
+  RAJA::expt::stencil_forall<EXEC_POLICY>(
+      layout, width,
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE i, INDEX_TYPE j) {
+        working_array[layout(i, j)] += INDEX_TYPE(1);
+      },
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE i, INDEX_TYPE j) {
+        working_array[layout(i, j)] += INDEX_TYPE(2);
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.wait();
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallStencil3DTestImpl(INDEX_TYPE n, INDEX_TYPE width)
+{
+  RAJA::OffsetLayout<3, INDEX_TYPE> layout =
+      RAJA::make_offset_layout<3, INDEX_TYPE>({{0, -2, 1}},
+                                              {{n, n - 1, n + 3}});
+
+  auto boxes = RAJA::expt::make_stencil_boxes(layout, width);
+
+  // the interior and the slabs cover each point of the layout once
+  RAJA::Index_type num_points = boxes.interior.size();
+  for (auto const& slab : boxes.boundary) {
+    num_points += slab.size();
+  }
+  ASSERT_EQ(num_points, static_cast<RAJA::Index_type>(layout.size()));
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = static_cast<size_t>(layout.size());
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  for (size_t i = 0; i < data_len; i++) {
+    test_array[i] = INDEX_TYPE(0);
+  }
+  for (INDEX_TYPE i = width; i < n - width; ++i) {
+    for (INDEX_TYPE j = width - 2; j < n - 1 - width; ++j) {
+      for (INDEX_TYPE k = width + 1; k < n + 3 - width; ++k) {
+        test_array[layout(i, j, k)] = INDEX_TYPE(1);
+      }
+    }
+  }
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+
+  RAJA::expt::stencil_forall<EXEC_POLICY>(
+      layout, width,
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE i, INDEX_TYPE j, INDEX_TYPE k) {
+        working_array[layout(i, j, k)] += INDEX_TYPE(1);
+      },
+      [=] RAJA_HOST_DEVICE(INDEX_TYPE, INDEX_TYPE, INDEX_TYPE) {});
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.wait();
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallStencilTest);
+template <typename T>
+class ForallStencilTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallStencilTest, StencilForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallStencil2DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(17), INDEX_TYPE(9), INDEX_TYPE(1));
+  ForallStencil2DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(40), INDEX_TYPE(33), INDEX_TYPE(2));
+  // the halo covers the layout, all points are on the boundary
+  ForallStencil2DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(3), INDEX_TYPE(5), INDEX_TYPE(2));
+
+  ForallStencil3DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(12), INDEX_TYPE(1));
+  ForallStencil3DTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(
+      INDEX_TYPE(20), INDEX_TYPE(3));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallStencilTest,
+                            StencilForall);
+
+#endif  // __TEST_FORALL_STENCIL_HPP__
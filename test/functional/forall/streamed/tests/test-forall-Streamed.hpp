@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_STREAMED_HPP__
+#define __TEST_FORALL_STREAMED_HPP__
+
+#include <vector>
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ForallStreamedTestImpl(RAJA::Index_type N,
+                            RAJA::Index_type chunk,
+                            size_t depth,
+                            RAJA::StreamedHost host)
+{
+  std::vector<WORKING_RES> pool(depth, WORKING_RES::get_default());
+  for (size_t s = 1; s < depth; ++s) {
+    pool[s] = WORKING_RES{};
+  }
+  camp::resources::Resource working_res{pool[0]};
+
+  // the data stays on the host, the pool only holds chunks of it
+  size_t data_len = static_cast<size_t>(N > 0 ? N : 1);
+  double* data = working_res.allocate<double>(
+      data_len, camp::resources::MemoryAccess::Pinned);
+  std::vector<double> pageable(data_len);
+  double* host_data =
+      (host == RAJA::StreamedHost::Pinned) ? data : pageable.data();
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    host_data[i] = static_cast<double>(i % 17);
+  }
+
+  RAJA::forall_streamed<EXEC_POLICY>(
+      pool, host_data, N, chunk,
+      [=] RAJA_HOST_DEVICE(RAJA::Index_type i, double& x) {
+        x = 2.0 * x + static_cast<double>(i);
+      },
+      host);
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(host_data[i],
+              2.0 * static_cast<double>(i % 17) + static_cast<double>(i));
+  }
+
+  working_res.deallocate(data, camp::resources::MemoryAccess::Pinned);
+}
+
+
+TYPED_TEST_SUITE_P(ForallStreamedTest);
+template <typename T>
+class ForallStreamedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallStreamedTest, StreamedForall)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  for (RAJA::StreamedHost host :
+       {RAJA::StreamedHost::Pageable, RAJA::StreamedHost::Pinned}) {
+    ForallStreamedTestImpl<WORKING_RES, EXEC_POLICY>(0, 16, 2, host);
+    ForallStreamedTestImpl<WORKING_RES, EXEC_POLICY>(1000, 0, 1, host);
+    ForallStreamedTestImpl<WORKING_RES, EXEC_POLICY>(1000, 64, 1, host);
+    ForallStreamedTestImpl<WORKING_RES, EXEC_POLICY>(1000, 64, 2, host);
+    ForallStreamedTestImpl<WORKING_RES, EXEC_POLICY>(100000, 4099, 3, host);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallStreamedTest,
+                            StreamedForall);
+
+#endif  // __TEST_FORALL_STREAMED_HPP__
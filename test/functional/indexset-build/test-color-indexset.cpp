@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the color index set builders.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <set>
+#include <vector>
+
+//
+// Checks that each zone is in exactly one segment, and that the zones of
+// a segment share no nodes.
+//
+template <typename ISET>
+void checkColoring(
+    ISET& iset,
+    const std::vector<RAJA::Index_type>& zoneToNode,
+    int numZone,
+    int numNodePerZone)
+{
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(numZone));
+
+  std::vector<int> count(numZone, 0);
+  for (int s = 0; s < static_cast<int>(iset.getNumSegments()); ++s) {
+    std::vector<RAJA::Index_type> zones;
+    RAJA::getIndices(zones, iset.createSlice(s, s + 1));
+
+    std::set<RAJA::Index_type> nodes;
+    for (RAJA::Index_type z : zones) {
+      ++count[z];
+      for (int n = 0; n < numNodePerZone; ++n) {
+        ASSERT_TRUE(nodes.insert(zoneToNode[z * numNodePerZone + n]).second);
+      }
+    }
+  }
+
+  for (int c : count) {
+    ASSERT_EQ(c, 1);
+  }
+}
+
+//
+// 2D mesh of nx x ny zones with 4 nodes each.
+//
+std::vector<RAJA::Index_type> makeZoneToNode(int nx, int ny)
+{
+  std::vector<RAJA::Index_type> zoneToNode;
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      zoneToNode.push_back(j * (nx + 1) + i);
+      zoneToNode.push_back(j * (nx + 1) + i + 1);
+      zoneToNode.push_back((j + 1) * (nx + 1) + i);
+      zoneToNode.push_back((j + 1) * (nx + 1) + i + 1);
+    }
+  }
+  return zoneToNode;
+}
+
+TEST(IndexSetBuild, LockFreeColor)
+{
+  const int nx = 12;
+  const int ny = 9;
+  const int numZone = nx * ny;
+  const int numNode = (nx + 1) * (ny + 1);
+
+  std::vector<RAJA::Index_type> zoneToNode = makeZoneToNode(nx, ny);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> serial;
+  RAJA::buildLockFreeColorIndexset(
+      serial, res, &zoneToNode[0], numZone, 4, numNode);
+  checkColoring(serial, zoneToNode, numZone, 4);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> parallel;
+  RAJA::buildLockFreeColorIndexsetParallel(
+      parallel, res, &zoneToNode[0], numZone, 4, numNode);
+  checkColoring(parallel, zoneToNode, numZone, 4);
+}
+
+TEST(IndexSetBuild, ColoredListSegments)
+{
+  const int nx = 12;
+  const int ny = 9;
+  const int numZone = nx * ny;
+  const int numNode = (nx + 1) * (ny + 1);
+
+  std::vector<RAJA::Index_type> zoneToNode = makeZoneToNode(nx, ny);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::ListSegment> iset;
+  RAJA::buildColoredIndexSet(iset, res, &zoneToNode[0], numZone, 4, numNode);
+  checkColoring(iset, zoneToNode, numZone, 4);
+
+  //
+  // Scatter to the nodes one color at a time, with no atomics.
+  //
+  std::vector<int> nodeCount(numNode, 0);
+  int* count = &nodeCount[0];
+  const RAJA::Index_type* z2n = &zoneToNode[0];
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>>(
+      iset, [=](RAJA::Index_type z) {
+        for (int n = 0; n < 4; ++n) {
+          count[z2n[z * 4 + n]] += 1;
+        }
+      });
+
+  for (int j = 0; j <= ny; ++j) {
+    for (int i = 0; i <= nx; ++i) {
+      int expected = (i > 0 && i < nx ? 2 : 1) * (j > 0 && j < ny ? 2 : 1);
+      ASSERT_EQ(nodeCount[j * (nx + 1) + i], expected);
+    }
+  }
+}
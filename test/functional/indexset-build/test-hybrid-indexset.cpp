@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the hybrid index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <numeric>
+#include <vector>
+
+TEST(IndexSetBuild, Hybrid)
+{
+  const RAJA::Index_type range_min_length = 8;
+
+  using RSType = RAJA::RangeSegment;
+  using RSSType = RAJA::RangeStrideSegment;
+  using LSType = RAJA::ListSegment;
+
+  //
+  // Create index vector containing indices:
+  // {0, 1, ..., 99,  500, 7,  200, 203, ..., 347,  40, 41, 42}
+  //
+  std::vector<RAJA::Index_type> indices(100);
+  std::iota(indices.begin(), indices.end(), 0);
+
+  indices.push_back(500);
+  indices.push_back(7);
+
+  for (RAJA::Index_type i = 0; i < 50; ++i) {
+    indices.push_back(200 + 3 * i);
+  }
+
+  indices.push_back(40);
+  indices.push_back(41);
+  indices.push_back(42);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RSType, RSSType, LSType> iset;
+
+  RAJA::buildIndexSetHybrid(iset,
+                            res,
+                            &indices[0],
+                            static_cast<RAJA::Index_type>(indices.size()),
+                            range_min_length);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+
+  ASSERT_EQ(iset.size(), 4);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 100);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_EQ(s1.size(), 2);
+  ASSERT_EQ(*s1.begin(), 500);
+
+  const RSSType& s2 = iset.getSegment<const RSSType>(2);
+  ASSERT_EQ(s2.size(), 50);
+  ASSERT_EQ(*s2.begin(), 200);
+  ASSERT_EQ(*(s2.end() - 1), 347);
+
+  const LSType& s3 = iset.getSegment<const LSType>(3);
+  ASSERT_EQ(s3.size(), 3);
+  ASSERT_EQ(*s3.begin(), 40);
+
+  //
+  // Visiting the index set gives back the input indices, in order.
+  //
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type i) { visited.push_back(i); });
+
+  ASSERT_EQ(visited, indices);
+}
+
+TEST(IndexSetBuild, HybridShort)
+{
+  std::vector<RAJA::Index_type> indices{4, 5, 6, 12};
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment,
+                      RAJA::RangeStrideSegment,
+                      RAJA::ListSegment> iset;
+
+  RAJA::buildIndexSetHybrid(iset,
+                            res,
+                            &indices[0],
+                            static_cast<RAJA::Index_type>(indices.size()),
+                            8);
+
+  ASSERT_EQ(iset.size(), 1);
+  ASSERT_EQ(iset.getLength(), 4);
+}
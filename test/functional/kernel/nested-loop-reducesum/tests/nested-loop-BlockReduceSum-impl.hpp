@@ -147,4 +147,104 @@ struct BlockNestedLoopExec<DEVICE_DEPTH_1_REDUCESUM, REDUCE_POL, POLICY_DATA> {
 
 #endif  // RAJA_ENABLE_CUDA or RAJA_ENABLE_HIP
 
+//
+//
+// Multi param test, the sum and the count of the values are reduced by
+// one Reduce statement.
+//
+//
+template <typename WORKING_RES, typename EXEC_POLICY, typename REDUCE_POL>
+void KernelNestedLoopMultiParamTest(const int N){
+
+  WORKING_RES work_res{WORKING_RES::get_default()};
+  camp::resources::Resource erased_work_res{work_res};
+
+  // Allocate Tests Data
+  int * work_array;
+  int * check_array;
+  int * test_array;
+
+  allocateForallTestData<int>(N,
+                              erased_work_res,
+                              &work_array,
+                              &check_array,
+                              &test_array);
+
+  // Initialize Data
+  std::iota(test_array, test_array + RAJA::stripIndexType(N), 0);
+
+  erased_work_res.memcpy(work_array, test_array, sizeof(int) * RAJA::stripIndexType(N));
+
+  RAJA::ReduceSum<REDUCE_POL, int> worksum(0);
+  RAJA::ReduceSum<REDUCE_POL, int> workcount(0);
+
+  RAJA::kernel_param<EXEC_POLICY>(
+    RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+    RAJA::make_tuple<int, int>(0, 0),
+
+    // lambda 0, only runs for sequential
+    [=] RAJA_HOST_DEVICE (RAJA::Index_type i, int & value, int & count) {
+       value = work_array[i];
+       count = 1;
+    },
+
+    // lambda 1, only runs for device
+    [=] RAJA_HOST_DEVICE (RAJA::Index_type i, int & value, int & count) {
+       value += work_array[i];
+       count += 1;
+    },
+
+    // lambda 2, (reduction) runs for both sequential and device
+    // Device: This only gets executed on the "root" thread which received
+    // both reduced values.
+    [=] RAJA_HOST_DEVICE (int & value, int & count) {
+       worksum += value;
+       workcount += count;
+    }
+
+  );
+
+  ASSERT_EQ(worksum.get(), N*(N-1)/2);
+  ASSERT_EQ(workcount.get(), N);
+
+  deallocateForallTestData<int>(erased_work_res,
+                                work_array,
+                                check_array,
+                                test_array);
+}
+
+template<typename POLICY_TYPE, typename REDUCE_POL, typename POLICY_DATA>
+struct BlockNestedLoopMultiParamExec;
+
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockNestedLoopMultiParamExec<DEPTH_1_REDUCESUM, REDUCE_POL, POLICY_DATA> {
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<0>>::type,
+        RAJA::statement::Lambda<0, RAJA::Segs<0>, RAJA::Params<0, 1>>,
+        RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::operators::plus, RAJA::ParamList<0, 1>,
+          RAJA::statement::Lambda<2, RAJA::Params<0, 1>>
+        >
+      >
+    >;
+};
+
+#if defined(RAJA_ENABLE_CUDA) or defined(RAJA_ENABLE_HIP)
+
+template<typename REDUCE_POL, typename POLICY_DATA>
+struct BlockNestedLoopMultiParamExec<DEVICE_DEPTH_1_REDUCESUM, REDUCE_POL, POLICY_DATA> {
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::DEVICE_KERNEL<
+      RAJA::statement::For<0, typename camp::at<POLICY_DATA, camp::num<0>>::type,
+        RAJA::statement::Lambda<1, RAJA::Segs<0>, RAJA::Params<0, 1>>>,
+        RAJA::statement::Reduce<typename camp::at<POLICY_DATA, camp::num<1>>::type, RAJA::operators::plus, RAJA::ParamList<0, 1>,
+          RAJA::statement::Lambda<2, RAJA::Params<0, 1>>
+        >
+      > // end DEVICE_KERNEL
+    >;
+};
+
+#endif  // RAJA_ENABLE_CUDA or RAJA_ENABLE_HIP
+
 #endif  // __NESTED_LOOP_MULTI_LAMBDA_PARAM_REDUCE_SUM_IMPL_HPP__
@@ -40,7 +40,23 @@ TYPED_TEST_P(KernelNestedLoopBlockReduceSumTest, NestedLoopBlockKernel) {
   KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, REDUCE_POL, USE_RES>(LOOP_TYPE(), 2345);
 }
 
+TYPED_TEST_P(KernelNestedLoopBlockReduceSumTest, NestedLoopBlockKernelMultiParam) {
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using REDUCE_POL = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POL_DATA = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  using LOOP_TYPE = typename EXEC_POL_DATA::LoopType;
+
+  using LOOP_POLS = typename EXEC_POL_DATA::type;
+
+  using EXEC_POLICY = typename BlockNestedLoopMultiParamExec<LOOP_TYPE, REDUCE_POL, LOOP_POLS>::type;
+
+  KernelNestedLoopMultiParamTest<WORKING_RES, EXEC_POLICY, REDUCE_POL>(1023);
+  KernelNestedLoopMultiParamTest<WORKING_RES, EXEC_POLICY, REDUCE_POL>(2345);
+}
+
 REGISTER_TYPED_TEST_SUITE_P(KernelNestedLoopBlockReduceSumTest,
-                            NestedLoopBlockKernel);
+                            NestedLoopBlockKernel,
+                            NestedLoopBlockKernelMultiParam);
 
 #endif  // __TEST_KERNEL_NESTED_LOOP_MULTI_LAMBDA_PARAM_REDUCE_SUM_HPP__
@@ -38,7 +38,9 @@ using BasicSupportedLoopTypeList = camp::list<
   DEPTH_3_COLLAPSE,
   DEPTH_3_COLLAPSE_SEQ_INNER,
   DEPTH_3_COLLAPSE_SEQ_OUTER,
-  DEVICE_DEPTH_2>;
+  DEVICE_DEPTH_2,
+  DEVICE_DEPTH_2_COLLAPSE,
+  DEVICE_DEPTH_3_COLLAPSE>;
 
 //
 //
@@ -89,7 +91,8 @@ void KernelNestedLoopTest(const DEPTH_2&,
                                        test_array);
 }
 
-// DEPTH_2_COLLAPSE and DEVICE_DEPTH_2 execution policies use the above DEPTH_2 test.
+// DEPTH_2_COLLAPSE, DEVICE_DEPTH_2 and DEVICE_DEPTH_2_COLLAPSE execution
+// policies use the above DEPTH_2 test.
 template <typename WORKING_RES, typename EXEC_POLICY, bool USE_RESOURCE, typename... Args>
 void KernelNestedLoopTest(const DEPTH_2_COLLAPSE&, Args... args){
   KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, USE_RESOURCE>(DEPTH_2(), args...);
@@ -100,6 +103,11 @@ void KernelNestedLoopTest(const DEVICE_DEPTH_2&, Args... args){
   KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, USE_RESOURCE>(DEPTH_2(), args...);
 }
 
+template <typename WORKING_RES, typename EXEC_POLICY, bool USE_RESOURCE, typename... Args>
+void KernelNestedLoopTest(const DEVICE_DEPTH_2_COLLAPSE&, Args... args){
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, USE_RESOURCE>(DEPTH_2(), args...);
+}
+
 //
 //
 // Basic 3D Matrix index calculation per element.
@@ -166,6 +174,11 @@ void KernelNestedLoopTest(const DEPTH_3_COLLAPSE_SEQ_INNER&, Args... args){
   KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, USE_RESOURCE>(DEPTH_3(), args...);
 }
 
+template <typename WORKING_RES, typename EXEC_POLICY, bool USE_RESOURCE, typename... Args>
+void KernelNestedLoopTest(const DEVICE_DEPTH_3_COLLAPSE&, Args... args){
+  KernelNestedLoopTest<WORKING_RES, EXEC_POLICY, USE_RESOURCE>(DEPTH_3(), args...);
+}
+
 //
 //
 // Defining the Kernel Loop structure for Basic Nested Loop Tests.
@@ -264,6 +277,32 @@ struct BasicNestedLoopExec<DEVICE_DEPTH_2, POLICY_DATA> {
     >;
 };
 
+template<typename POLICY_DATA>
+struct BasicNestedLoopExec<DEVICE_DEPTH_2_COLLAPSE, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::DEVICE_KERNEL<
+        RAJA::statement::Collapse< typename camp::at<POLICY_DATA, camp::num<0>>::type,
+          RAJA::ArgList<1,0>,
+          RAJA::statement::Lambda<0>
+        >
+      > // end CudaKernel
+    >;
+};
+
+template<typename POLICY_DATA>
+struct BasicNestedLoopExec<DEVICE_DEPTH_3_COLLAPSE, POLICY_DATA> {
+  using type = 
+    RAJA::KernelPolicy<
+      RAJA::statement::DEVICE_KERNEL<
+        RAJA::statement::Collapse< typename camp::at<POLICY_DATA, camp::num<0>>::type,
+          RAJA::ArgList<2,1,0>,
+          RAJA::statement::Lambda<0>
+        >
+      > // end CudaKernel
+    >;
+};
+
 #endif  // RAJA_ENABLE_CUDA or RAJA_ENABLE_HIP
 
 #endif  // __NESTED_LOOP_BASIC_IMPL_HPP__
@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_ASYNC_COPY_HPP__
+#define __TEST_LAUNCH_ASYNC_COPY_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchAsyncCopyTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range, INDEX_TYPE num_tiles)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  double* src_array;
+  double* check_src;
+  double* test_src;
+  double* working_array;
+  double* check_array;
+  double* test_array;
+
+  const INDEX_TYPE tile_len = thread_range;
+  const INDEX_TYPE team_len = tile_len * num_tiles;
+  const size_t src_len = static_cast<size_t>(block_range * team_len);
+  const size_t out_len = static_cast<size_t>(block_range * tile_len);
+
+  allocateForallTestData<double>(src_len,
+                                 working_res,
+                                 &src_array,
+                                 &check_src,
+                                 &test_src);
+
+  allocateForallTestData<double>(out_len,
+                                 working_res,
+                                 &working_array,
+                                 &check_array,
+                                 &test_array);
+
+  for (size_t i = 0; i < src_len; ++i) {
+    test_src[i] = static_cast<double>(i % 17);
+  }
+
+  working_res.memcpy(src_array, test_src, sizeof(double) * src_len);
+
+  //
+  // Each team sums its tiles, loading the next tile into the other half of
+  // a double buffer while adding the current one
+  //
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range)),
+                        2 * static_cast<size_t>(tile_len) * sizeof(double)),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+
+          double* buffer = ctx.getSharedMemory<double>(2 * tile_len);
+          const double* team_src = src_array + t * team_len;
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              RAJA::expt::async_copy(ctx, buffer[i], team_src[i]);
+          });
+          RAJA::expt::async_copy_commit(ctx);
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              working_array[t * tile_len + i] = 0.0;
+          });
+
+          for (INDEX_TYPE k = 0; k < num_tiles; ++k) {
+
+            double* cur = buffer + (k % 2) * tile_len;
+            double* next = buffer + ((k + 1) % 2) * tile_len;
+
+            if (k + 1 < num_tiles) {
+              RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+                  RAJA::expt::async_copy(ctx, next[i], team_src[(k + 1) * tile_len + i]);
+              });
+              RAJA::expt::async_copy_commit(ctx);
+              RAJA::expt::async_copy_wait<1>(ctx);
+            } else {
+              RAJA::expt::async_copy_wait<0>(ctx);
+            }
+            ctx.teamSync();
+
+            RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+                working_array[t * tile_len + i] += cur[(i + 1) % tile_len];
+            });
+            ctx.teamSync();
+          }
+
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(double) * out_len);
+
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    for (INDEX_TYPE i = 0; i < tile_len; ++i) {
+      double sum = 0.0;
+      for (INDEX_TYPE k = 0; k < num_tiles; ++k) {
+        sum += test_src[t * team_len + k * tile_len + (i + 1) % tile_len];
+      }
+      ASSERT_DOUBLE_EQ(check_array[t * tile_len + i], sum);
+    }
+  }
+
+  deallocateForallTestData<double>(working_res,
+                                   working_array,
+                                   check_array,
+                                   test_array);
+  deallocateForallTestData<double>(working_res,
+                                   src_array,
+                                   check_src,
+                                   test_src);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchAsyncCopyTest);
+template <typename T>
+class LaunchAsyncCopyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchAsyncCopyTest, AsyncCopyLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  LaunchAsyncCopyTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(4), INDEX_TYPE(32), INDEX_TYPE(1));
+
+  LaunchAsyncCopyTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(13), INDEX_TYPE(64), INDEX_TYPE(6));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchAsyncCopyTest,
+                            AsyncCopyLaunch);
+
+#endif  // __TEST_LAUNCH_ASYNC_COPY_HPP__
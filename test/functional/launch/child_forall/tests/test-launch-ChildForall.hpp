@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_CHILD_FORALL_HPP__
+#define __TEST_LAUNCH_CHILD_FORALL_HPP__
+
+//
+// Child loops run on the device of the working resource, inline elsewhere
+//
+template <typename WORKING_RES>
+struct LaunchChildForallPolicy {
+  using type = RAJA::seq_exec;
+};
+
+#if defined(RAJA_ENABLE_CUDA)
+template <>
+struct LaunchChildForallPolicy<camp::resources::Cuda> {
+  using type = RAJA::cuda_exec<128>;
+};
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+template <>
+struct LaunchChildForallPolicy<camp::resources::Hip> {
+  using type = RAJA::hip_exec<128>;
+};
+#endif
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchChildForallTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
+{
+
+  using CHILD_POLICY = typename LaunchChildForallPolicy<WORKING_RES>::type;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  // team t starts a child loop of length t + 1 at offset t * (t + 1) / 2
+  size_t data_len = static_cast<size_t>(block_range * (block_range + 1) / 2);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * data_len);
+
+  auto child_body = [=] RAJA_HOST_DEVICE (INDEX_TYPE t, RAJA::Index_type i) {
+    working_array[t * (t + 1) / 2 + static_cast<INDEX_TYPE>(i)] = t + static_cast<INDEX_TYPE>(i);
+  };
+
+  RAJA::expt::ChildForall<CHILD_POLICY, INDEX_TYPE, decltype(child_body)>
+      children(child_body, static_cast<size_t>(block_range));
+
+  RAJA::launch<LAUNCH_POLICY>
+    (res,
+     RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range))),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              if (i == INDEX_TYPE(0)) {
+                children.forall(t, static_cast<RAJA::Index_type>(t + 1));
+              }
+          });
+        });
+
+    });
+
+  children.run(res);
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    for (INDEX_TYPE i = 0; i <= t; ++i) {
+      ASSERT_EQ(check_array[t * (t + 1) / 2 + i], t + i);
+    }
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchChildForallTest);
+template <typename T>
+class LaunchChildForallTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchChildForallTest, ChildForallLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  LaunchChildForallTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(4), INDEX_TYPE(8));
+
+  LaunchChildForallTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(20), INDEX_TYPE(32));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchChildForallTest,
+                            ChildForallLaunch);
+
+#endif  // __TEST_LAUNCH_CHILD_FORALL_HPP__
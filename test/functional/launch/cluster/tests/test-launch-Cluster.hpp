@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_CLUSTER_HPP__
+#define __TEST_LAUNCH_CLUSTER_HPP__
+
+//
+// Teams form clusters of two only on CUDA devices of compute capability 9.0
+// or newer, elsewhere every team is a cluster of one
+//
+template <typename WORKING_RES>
+int LaunchClusterTestSize()
+{
+#if defined(RAJA_ENABLE_CUDA)
+  if (std::is_same<WORKING_RES, camp::resources::Cuda>::value) {
+    int device = 0;
+    int major = 0;
+    cudaErrchk(cudaGetDevice(&device));
+    cudaErrchk(cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device));
+    return major >= 9 ? 2 : 1;
+  }
+#endif
+  return 1;
+}
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchClusterTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+
+  const int cluster_size = LaunchClusterTestSize<WORKING_RES>();
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = static_cast<size_t>(block_range * thread_range);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  int* sizes = nullptr;
+  int* check_sizes = nullptr;
+  int* test_sizes = nullptr;
+  allocateForallTestData<int>(static_cast<size_t>(block_range),
+                              working_res,
+                              &sizes,
+                              &check_sizes,
+                              &test_sizes);
+
+  const size_t shared_mem_size = static_cast<size_t>(thread_range) * sizeof(INDEX_TYPE);
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range)),
+                        RAJA::Clusters(cluster_size),
+                        shared_mem_size),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+
+          INDEX_TYPE* tile = ctx.getSharedMemory<INDEX_TYPE>(thread_range);
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              tile[i] = t * thread_range + i;
+          });
+
+          ctx.clusterSync();
+
+          const int rank = ctx.clusterRank();
+          const int size = ctx.clusterSize();
+          INDEX_TYPE* neighbor = ctx.getClusterSharedMemory(tile, (rank + 1) % size);
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              working_array[t * thread_range + i] = neighbor[i];
+              if (i == INDEX_TYPE(0)) {
+                sizes[t] = size;
+              }
+          });
+
+          // keep shared memory alive until the neighbors are done reading
+          ctx.clusterSync();
+
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+  working_res.memcpy(check_sizes, sizes, sizeof(int) * static_cast<size_t>(block_range));
+
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    const int size = check_sizes[t];
+    ASSERT_TRUE(size == 1 || size == cluster_size);
+    const INDEX_TYPE first = t - t % INDEX_TYPE(size);
+    const INDEX_TYPE neighbor = first + (t - first + INDEX_TYPE(1)) % INDEX_TYPE(size);
+    for (INDEX_TYPE i = 0; i < thread_range; ++i) {
+      ASSERT_EQ(check_array[t * thread_range + i], neighbor * thread_range + i);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                                sizes,
+                                check_sizes,
+                                test_sizes);
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchClusterTest);
+template <typename T>
+class LaunchClusterTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchClusterTest, ClusterLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  LaunchClusterTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(2), INDEX_TYPE(32));
+
+  LaunchClusterTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(16), INDEX_TYPE(64));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchClusterTest,
+                            ClusterLaunch);
+
+#endif  // __TEST_LAUNCH_CLUSTER_HPP__
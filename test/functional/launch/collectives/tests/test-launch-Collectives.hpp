@@ -0,0 +1,275 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_COLLECTIVES_HPP__
+#define __TEST_LAUNCH_COLLECTIVES_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchCollectivesTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range, INDEX_TYPE scan_len)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> scan_range(INDEX_TYPE(0), scan_len);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  // per thread: warp size, warp sum, warp scan, ballot count, team sum
+  const size_t num_fields = 5;
+  const size_t data_len = static_cast<size_t>(block_range * thread_range) * num_fields;
+  const size_t scan_data_len = static_cast<size_t>(block_range * scan_len);
+
+  long long* working_array;
+  long long* check_array;
+  long long* test_array;
+  allocateForallTestData<long long>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  long long* scan_array;
+  long long* check_scan;
+  long long* test_scan;
+  allocateForallTestData<long long>(scan_data_len,
+                                    working_res,
+                                    &scan_array,
+                                    &check_scan,
+                                    &test_scan);
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range)),
+                        2 * static_cast<size_t>(scan_len) * sizeof(long long)),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              long long* out = working_array + (t * thread_range + i) * num_fields;
+              out[0] = RAJA::expt::warp_size(ctx);
+              out[1] = RAJA::expt::warp_reduce(ctx, RAJA::operators::plus<long long>{}, 1ll);
+              out[2] = RAJA::expt::warp_scan(ctx, RAJA::operators::plus<long long>{}, 1ll);
+              unsigned long long mask = RAJA::expt::warp_ballot(ctx, true);
+              long long count = 0;
+              for (; mask != 0ull; mask &= mask - 1ull) {
+                ++count;
+              }
+              out[3] = count;
+          });
+
+          long long sum = RAJA::expt::team_reduce<THREAD_POLICY>(
+              ctx, inner_range, RAJA::operators::plus<long long>{}, 0ll,
+              [&](INDEX_TYPE i) { return static_cast<long long>(i + t); });
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              working_array[(t * thread_range + i) * num_fields + 4] = sum;
+          });
+
+          long long* data = ctx.getSharedMemory<long long>(scan_len);
+          long long* scratch = ctx.getSharedMemory<long long>(scan_len);
+
+          RAJA::loop<THREAD_POLICY>(ctx, scan_range, [&](INDEX_TYPE i) {
+              data[i] = static_cast<long long>(i % 7);
+          });
+          ctx.teamSync();
+
+          RAJA::expt::team_scan<THREAD_POLICY>(
+              ctx, scan_range, RAJA::operators::plus<long long>{}, data, scratch);
+
+          RAJA::loop<THREAD_POLICY>(ctx, scan_range, [&](INDEX_TYPE i) {
+              scan_array[t * scan_len + i] = data[i];
+          });
+
+          ctx.teamSync();
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(long long) * data_len);
+  working_res.memcpy(check_scan, scan_array, sizeof(long long) * scan_data_len);
+
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    long long team_sum = 0;
+    for (INDEX_TYPE i = 0; i < thread_range; ++i) {
+      team_sum += static_cast<long long>(i + t);
+    }
+    for (INDEX_TYPE i = 0; i < thread_range; ++i) {
+      const long long* out = check_array + (t * thread_range + i) * num_fields;
+      const long long warp = out[0];
+      ASSERT_GE(warp, 1);
+      ASSERT_EQ(out[1], warp);
+      ASSERT_EQ(out[2], static_cast<long long>(i) % warp + 1);
+      ASSERT_EQ(out[3], warp);
+      ASSERT_EQ(out[4], team_sum);
+    }
+    long long prefix = 0;
+    for (INDEX_TYPE i = 0; i < scan_len; ++i) {
+      prefix += static_cast<long long>(i % 7);
+      ASSERT_EQ(check_scan[t * scan_len + i], prefix);
+    }
+  }
+
+  deallocateForallTestData<long long>(working_res,
+                                      scan_array,
+                                      check_scan,
+                                      test_scan);
+  deallocateForallTestData<long long>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchSortScanTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range, INDEX_TYPE len)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> key_range(INDEX_TYPE(0), len);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  const size_t data_len = static_cast<size_t>(block_range * len);
+
+  int* sort_array;
+  int* check_sort;
+  int* test_sort;
+  allocateForallTestData<int>(data_len,
+                              working_res,
+                              &sort_array,
+                              &check_sort,
+                              &test_sort);
+
+  int* scan_array;
+  int* check_scan;
+  int* test_scan;
+  allocateForallTestData<int>(data_len,
+                              working_res,
+                              &scan_array,
+                              &check_scan,
+                              &test_scan);
+
+  for (size_t i = 0; i < data_len; ++i) {
+    test_sort[i] = static_cast<int>((i * 7919) % 101);
+  }
+  working_res.memcpy(sort_array, test_sort, sizeof(int) * data_len);
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range)),
+                        3 * static_cast<size_t>(len) * sizeof(int)),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+
+          int* keys = ctx.getSharedMemory<int>(len);
+          int* counts = ctx.getSharedMemory<int>(len);
+          int* scratch = ctx.getSharedMemory<int>(len);
+
+          RAJA::loop<THREAD_POLICY>(ctx, key_range, [&](INDEX_TYPE i) {
+              keys[i] = sort_array[t * len + i];
+              counts[i] = keys[i] % 3;
+          });
+          ctx.teamSync();
+
+          RAJA::expt::team_sort<THREAD_POLICY>(ctx, key_range, keys);
+
+          RAJA::expt::team_exclusive_scan<THREAD_POLICY>(
+              ctx, key_range, RAJA::operators::plus<int>{}, 0, counts, scratch);
+
+          RAJA::loop<THREAD_POLICY>(ctx, key_range, [&](INDEX_TYPE i) {
+              sort_array[t * len + i] = keys[i];
+              scan_array[t * len + i] = counts[i];
+          });
+
+          ctx.teamSync();
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_sort, sort_array, sizeof(int) * data_len);
+  working_res.memcpy(check_scan, scan_array, sizeof(int) * data_len);
+
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    std::vector<int> expected(test_sort + t * len, test_sort + (t + 1) * len);
+    int prefix = 0;
+    for (INDEX_TYPE i = 0; i < len; ++i) {
+      ASSERT_EQ(check_scan[t * len + i], prefix);
+      prefix += expected[i] % 3;
+    }
+    std::sort(expected.begin(), expected.end());
+    for (INDEX_TYPE i = 0; i < len; ++i) {
+      ASSERT_EQ(check_sort[t * len + i], expected[i]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                                scan_array,
+                                check_scan,
+                                test_scan);
+  deallocateForallTestData<int>(working_res,
+                                sort_array,
+                                check_sort,
+                                test_sort);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchCollectivesTest);
+template <typename T>
+class LaunchCollectivesTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchCollectivesTest, CollectivesLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  // thread counts are multiples of the warp size so warps are full
+  LaunchCollectivesTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(3), INDEX_TYPE(64), INDEX_TYPE(37));
+
+  LaunchCollectivesTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(9), INDEX_TYPE(256), INDEX_TYPE(200));
+
+}
+
+TYPED_TEST_P(LaunchCollectivesTest, SortScanLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  LaunchSortScanTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(2), INDEX_TYPE(64), INDEX_TYPE(1));
+
+  LaunchSortScanTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(5), INDEX_TYPE(128), INDEX_TYPE(100));
+
+  LaunchSortScanTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(3), INDEX_TYPE(256), INDEX_TYPE(256));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchCollectivesTest,
+                            CollectivesLaunch,
+                            SortScanLaunch);
+
+#endif  // __TEST_LAUNCH_COLLECTIVES_HPP__
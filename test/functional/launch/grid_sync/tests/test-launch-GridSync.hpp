@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_GRID_SYNC_HPP__
+#define __TEST_LAUNCH_GRID_SYNC_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename GLOBAL_THREAD_POLICY>
+void LaunchGridSyncTestImpl(int blocks, int threads, int sweeps)
+{
+
+  const INDEX_TYPE N = static_cast<INDEX_TYPE>(blocks * threads);
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(INDEX_TYPE(0), N);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = 2 * static_cast<size_t>(N);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  //
+  // Each sweep reads the neighbor written by another team in the previous
+  // sweep, which is only correct if the whole grid synchronizes in between
+  //
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    test_array[i] = i;
+    test_array[i + N] = INDEX_TYPE(0);
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(INDEX_TYPE) * data_len);
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(blocks), RAJA::Threads(threads)),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      INDEX_TYPE* src = working_array;
+      INDEX_TYPE* dst = working_array + N;
+
+      for (int s = 0; s < sweeps; ++s) {
+
+        RAJA::loop<GLOBAL_THREAD_POLICY>(ctx, r1, [&](INDEX_TYPE i) {
+            INDEX_TYPE j = (i + INDEX_TYPE(threads)) % N;
+            dst[i] = src[j];
+        });
+
+        ctx.grid_sync();
+
+        INDEX_TYPE* tmp = src;
+        src = dst;
+        dst = tmp;
+      }
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  const INDEX_TYPE* result = (sweeps % 2 == 0) ? check_array : check_array + N;
+  const INDEX_TYPE shift = static_cast<INDEX_TYPE>(
+      (static_cast<long long>(sweeps) * threads) % (blocks * threads));
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; ++i) {
+    ASSERT_EQ(result[i], (i + shift) % N);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchGridSyncTest);
+template <typename T>
+class LaunchGridSyncTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchGridSyncTest, GridSyncLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using GLOBAL_THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+
+  LaunchGridSyncTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, GLOBAL_THREAD_POLICY>
+    (1, 32, 3);
+
+  LaunchGridSyncTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, GLOBAL_THREAD_POLICY>
+    (4, 64, 8);
+
+  LaunchGridSyncTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, GLOBAL_THREAD_POLICY>
+    (8, 128, 5);
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchGridSyncTest,
+                            GridSyncLaunch);
+
+#endif  // __TEST_LAUNCH_GRID_SYNC_HPP__
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_HISTOGRAM_HPP__
+#define __TEST_LAUNCH_HISTOGRAM_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchHistogramTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range, INDEX_TYPE num_bins)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t bins_len = num_bins;
+
+  allocateForallTestData<INDEX_TYPE>(bins_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  for (size_t b = 0; b < bins_len; ++b) {
+    test_array[b] = INDEX_TYPE(0);
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(INDEX_TYPE) * bins_len);
+
+  // skewed bins, low bins get most of the values
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    for (INDEX_TYPE i = 0; i < thread_range; ++i) {
+      INDEX_TYPE bin = ((i * i + t) % num_bins) / ((i % 3) + 1);
+      test_array[bin] += INDEX_TYPE(1) + (i % 2);
+    }
+  }
+
+  using histogram_type = RAJA::expt::histogram<THREAD_POLICY, INDEX_TYPE, INDEX_TYPE>;
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range)),
+                        histogram_type::shared_mem_size(num_bins)),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+
+          histogram_type hist(ctx, working_array, num_bins);
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              INDEX_TYPE bin = ((i * i + t) % num_bins) / ((i % 3) + 1);
+              if (i % 2 == 0) {
+                hist.increment(bin);
+              } else {
+                hist.add(bin, INDEX_TYPE(2));
+              }
+          });
+
+          hist.flush();
+
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * bins_len);
+
+  for (size_t b = 0; b < bins_len; ++b) {
+    ASSERT_EQ(test_array[b], check_array[b]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchHistogramTest);
+template <typename T>
+class LaunchHistogramTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchHistogramTest, HistogramLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  // the thread policies are direct so the bins must not exceed the threads
+  LaunchHistogramTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(4), INDEX_TYPE(8), INDEX_TYPE(1));
+
+  LaunchHistogramTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(5), INDEX_TYPE(64), INDEX_TYPE(13));
+
+  LaunchHistogramTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(37), INDEX_TYPE(128), INDEX_TYPE(128));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchHistogramTest,
+                            HistogramLaunch);
+
+#endif  // __TEST_LAUNCH_HISTOGRAM_HPP__
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_LAUNCH_BATCH_HPP__
+#define __TEST_LAUNCH_LAUNCH_BATCH_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchBatchTestImpl(INDEX_TYPE teams0, INDEX_TYPE threads0,
+                         INDEX_TYPE teams1, INDEX_TYPE threads1)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer0(INDEX_TYPE(0), teams0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner0(INDEX_TYPE(0), threads0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer1(INDEX_TYPE(0), teams1);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner1(INDEX_TYPE(0), threads1);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  const size_t len0 = static_cast<size_t>(teams0 * threads0);
+  const size_t len1 = static_cast<size_t>(teams1 * threads1);
+
+  INDEX_TYPE* working0;
+  INDEX_TYPE* check0;
+  INDEX_TYPE* test0;
+  INDEX_TYPE* working1;
+  INDEX_TYPE* check1;
+  INDEX_TYPE* test1;
+
+  allocateForallTestData<INDEX_TYPE>(len0, working_res,
+                                     &working0, &check0, &test0);
+  allocateForallTestData<INDEX_TYPE>(len1, working_res,
+                                     &working1, &check1, &test1);
+
+  working_res.memset(working0, 0, sizeof(INDEX_TYPE) * len0);
+  working_res.memset(working1, 0, sizeof(INDEX_TYPE) * len1);
+
+  RAJA::expt::launch_batch<LAUNCH_POLICY>(working_res,
+    RAJA::expt::batch_item(
+      RAJA::LaunchParams(RAJA::Teams(static_cast<int>(teams0)),
+                         RAJA::Threads(static_cast<int>(threads0))),
+      [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+        RAJA::loop<TEAM_POLICY>(ctx, outer0, [&](INDEX_TYPE t) {
+          RAJA::loop<THREAD_POLICY>(ctx, inner0, [&](INDEX_TYPE i) {
+            working0[t * threads0 + i] += t * threads0 + i + INDEX_TYPE(1);
+          });
+        });
+      }),
+    RAJA::expt::batch_item(
+      RAJA::LaunchParams(RAJA::Teams(static_cast<int>(teams1)),
+                         RAJA::Threads(static_cast<int>(threads1))),
+      [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+        RAJA::loop<TEAM_POLICY>(ctx, outer1, [&](INDEX_TYPE t) {
+          RAJA::loop<THREAD_POLICY>(ctx, inner1, [&](INDEX_TYPE i) {
+            working1[t * threads1 + i] += INDEX_TYPE(2) * (t * threads1 + i);
+          });
+        });
+      }));
+
+  working_res.memcpy(check0, working0, sizeof(INDEX_TYPE) * len0);
+  working_res.memcpy(check1, working1, sizeof(INDEX_TYPE) * len1);
+
+  for (size_t i = 0; i < len0; ++i) {
+    ASSERT_EQ(check0[i], static_cast<INDEX_TYPE>(i + 1));
+  }
+  for (size_t i = 0; i < len1; ++i) {
+    ASSERT_EQ(check1[i], static_cast<INDEX_TYPE>(2 * i));
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res, working0, check0, test0);
+  deallocateForallTestData<INDEX_TYPE>(working_res, working1, check1, test1);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchBatchTest);
+template <typename T>
+class LaunchBatchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchBatchTest, LaunchBatch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  // kernels with fewer and with more teams and threads than the other
+  LaunchBatchTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(4), INDEX_TYPE(8), INDEX_TYPE(3), INDEX_TYPE(16));
+
+  LaunchBatchTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(37), INDEX_TYPE(64), INDEX_TYPE(1), INDEX_TYPE(1));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchBatchTest,
+                            LaunchBatch);
+
+#endif  // __TEST_LAUNCH_LAUNCH_BATCH_HPP__
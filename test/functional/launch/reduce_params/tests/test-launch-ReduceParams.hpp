@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_REDUCE_PARAMS_HPP__
+#define __TEST_LAUNCH_REDUCE_PARAMS_HPP__
+
+#include <algorithm>
+#include <limits>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchReduceParamsTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(block_range * thread_range);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  INDEX_TYPE ref_sum = 0;
+  INDEX_TYPE ref_min = std::numeric_limits<INDEX_TYPE>::max();
+  INDEX_TYPE ref_max = std::numeric_limits<INDEX_TYPE>::lowest();
+
+  for (size_t i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<INDEX_TYPE>((i * 37) % 101);
+    ref_sum += test_array[i];
+    ref_min = std::min(ref_min, test_array[i]);
+    ref_max = std::max(ref_max, test_array[i]);
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(INDEX_TYPE) * data_len);
+
+  INDEX_TYPE sum = 0;
+  INDEX_TYPE min = std::numeric_limits<INDEX_TYPE>::max();
+  INDEX_TYPE max = std::numeric_limits<INDEX_TYPE>::lowest();
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range))),
+     RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+     RAJA::expt::Reduce<RAJA::operators::minimum>(&min),
+     RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx,
+                          INDEX_TYPE &s, INDEX_TYPE &mn, INDEX_TYPE &mx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+        RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+          INDEX_TYPE val = working_array[t * thread_range + i];
+          s += val;
+          mn = RAJA_MIN(mn, val);
+          mx = RAJA_MAX(mx, val);
+        });
+      });
+
+    });
+
+  ASSERT_EQ(sum, ref_sum);
+  ASSERT_EQ(min, ref_min);
+  ASSERT_EQ(max, ref_max);
+
+  // reducers accumulate into the values they point at
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range))),
+     RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx, INDEX_TYPE &s) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+        RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+          s += working_array[t * thread_range + i];
+        });
+      });
+
+    });
+
+  ASSERT_EQ(sum, INDEX_TYPE(2) * ref_sum);
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchReduceParamsTest);
+template <typename T>
+class LaunchReduceParamsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchReduceParamsTest, ReduceParamsLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  LaunchReduceParamsTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(1), INDEX_TYPE(8));
+
+  LaunchReduceParamsTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(5), INDEX_TYPE(64));
+
+  LaunchReduceParamsTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(37), INDEX_TYPE(128));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchReduceParamsTest,
+                            ReduceParamsLaunch);
+
+#endif  // __TEST_LAUNCH_REDUCE_PARAMS_HPP__
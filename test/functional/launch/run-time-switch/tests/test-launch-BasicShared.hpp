@@ -11,7 +11,7 @@
 #include <numeric>
 
 template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
-void LaunchBasicSharedTestImpl()
+void LaunchBasicSharedTestImpl(bool pick_device)
 {
 
   int N = 1000;
@@ -38,9 +38,7 @@ void LaunchBasicSharedTestImpl()
   }
 
 
-  RAJA::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
-    RAJA::LaunchParams(RAJA::Teams(N), RAJA::Threads(N)),
-        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+  auto body = [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
 
           RAJA::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
 
@@ -60,8 +58,16 @@ void LaunchBasicSharedTestImpl()
                 });  // loop j
 
               });  // loop r
-        });  // outer lambda
-
+        };  // outer lambda
+
+  if (pick_device) {
+    // device 0 exists whenever a device does, ignored on the host
+    RAJA::launch<LAUNCH_POLICY>(select_cpu_or_gpu, 0,
+      RAJA::LaunchParams(RAJA::Teams(N), RAJA::Threads(N)), body);
+  } else {
+    RAJA::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+      RAJA::LaunchParams(RAJA::Teams(N), RAJA::Threads(N)), body);
+  }
 
 
   working_res.memcpy(check_array, working_array, sizeof(int) * N*N);
@@ -93,12 +99,26 @@ TYPED_TEST_P(LaunchBasicSharedTest, BasicSharedTeams)
   using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
   using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
 
-  LaunchBasicSharedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+  LaunchBasicSharedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(false);
+
+
+}
+
+TYPED_TEST_P(LaunchBasicSharedTest, BasicSharedTeamsPickDevice)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  LaunchBasicSharedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>(true);
 
 
 }
 
 REGISTER_TYPED_TEST_SUITE_P(LaunchBasicSharedTest,
-                            BasicSharedTeams);
+                            BasicSharedTeams,
+                            BasicSharedTeamsPickDevice);
 
 #endif  // __TEST_BASIC_SHARED_HPP__
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_HOST_ONLY_HPP__
+#define __TEST_LAUNCH_HOST_ONLY_HPP__
+
+//
+// Kernels launched with HostLaunchPolicy are never compiled for the device,
+// they run on the host through both run time launch interfaces
+//
+template <typename WORKING_RES, typename LAUNCH_POLICY>
+void LaunchHostOnlyTestImpl()
+{
+
+  constexpr int N = 100;
+
+  using host_launch = RAJA::HostLaunchPolicy<typename LAUNCH_POLICY::host_policy_t>;
+  using loop_pol = RAJA::LoopPolicy<RAJA::loop_exec>;
+
+  camp::resources::Resource host_res{camp::resources::Host::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*N,
+                             host_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  RAJA::launch<host_launch>(RAJA::ExecPlace::HOST,
+    RAJA::LaunchParams(RAJA::Teams(N), RAJA::Threads(N)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<loop_pol>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+            RAJA::loop<loop_pol>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                working_array[c + N*r] = r;
+            });
+          });
+        });
+
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(r, working_array[c + r*N]);
+    }
+  }
+
+  RAJA::launch<host_launch>(host_res,
+    RAJA::LaunchParams(RAJA::Teams(N), RAJA::Threads(N)),
+        [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+          RAJA::loop<loop_pol>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+            RAJA::loop<loop_pol>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                working_array[c + N*r] = r + c;
+            });
+          });
+        });
+
+  host_res.memcpy(check_array, working_array, sizeof(int) * N*N);
+
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(r + c, check_array[c + r*N]);
+    }
+  }
+
+  deallocateForallTestData<int>(host_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchHostOnlyTest);
+template <typename T>
+class LaunchHostOnlyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchHostOnlyTest, HostOnlyTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+
+  LaunchHostOnlyTestImpl<WORKING_RES, LAUNCH_POLICY>();
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchHostOnlyTest,
+                            HostOnlyTeams);
+
+#endif  // __TEST_LAUNCH_HOST_ONLY_HPP__
@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_SHARED_ARRAY_HPP__
+#define __TEST_LAUNCH_SHARED_ARRAY_HPP__
+
+#include <cstdint>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchSharedArrayTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(RAJA::stripIndexType(INDEX_TYPE(0)), RAJA::stripIndexType(block_range));
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(RAJA::stripIndexType(INDEX_TYPE(0)), RAJA::stripIndexType(thread_range));
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(block_range)*RAJA::stripIndexType(thread_range);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  //determine the underlying type of block_range
+  using s_type = decltype(RAJA::stripIndexType(block_range));
+  const s_type nth = RAJA::stripIndexType(thread_range);
+
+  for(s_type b=0; b<RAJA::stripIndexType(block_range); ++b) {
+    for(s_type c=0; c<nth; ++c) {
+      s_type idx = c + nth*b;
+      test_array[idx] = INDEX_TYPE(idx);
+    }
+  }
+
+  // an odd sized char array first so the double array must be aligned
+  size_t shared_mem_size =
+      RAJA::expt::shared_array_size<char, 1>({s_type(3)}) +
+      RAJA::expt::shared_array_size<double, 2>({s_type(2), nth});
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(RAJA::stripIndexType(block_range)),
+                        RAJA::Threads(RAJA::stripIndexType(thread_range)), shared_mem_size),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE bid) {
+
+          RAJA::expt::shared_array<char, 1>(ctx, {s_type(3)});
+          auto Tile = RAJA::expt::shared_array<double, 2>(ctx, {s_type(2), nth});
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE tid) {
+              const s_type t = RAJA::stripIndexType(tid);
+              const s_type b = RAJA::stripIndexType(bid);
+              Tile(0, nth-t-1) = static_cast<double>(nth-t-1 + nth*b);
+              Tile(1, t) = static_cast<double>(t + nth*b);
+            });
+
+          ctx.teamSync();
+
+          const bool aligned =
+              reinterpret_cast<std::uintptr_t>(&Tile(0, 0)) % alignof(double) == 0;
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE tid) {
+              const s_type t = RAJA::stripIndexType(tid);
+              INDEX_TYPE idx = tid + thread_range * bid;
+              working_array[RAJA::stripIndexType(idx)] =
+                  (aligned && Tile(0, t) == Tile(1, t))
+                      ? INDEX_TYPE(static_cast<s_type>(Tile(0, t)))
+                      : INDEX_TYPE(-1);
+          });
+
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchSharedArrayTest);
+template <typename T>
+class LaunchSharedArrayTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchSharedArrayTest, SharedArrayLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  // rows start an odd number of banks apart
+  ASSERT_EQ(RAJA::expt::detail::bank_padded_extent<float>(32), 33);
+  ASSERT_EQ(RAJA::expt::detail::bank_padded_extent<float>(17), 17);
+  ASSERT_EQ(RAJA::expt::detail::bank_padded_extent<double>(32), 33);
+  ASSERT_EQ(RAJA::expt::detail::bank_padded_extent<char>(32), 36);
+  ASSERT_EQ((RAJA::expt::detail::padded_extent<float, 1>(32, RAJA::expt::shared_pad_auto)), 32);
+  ASSERT_EQ((RAJA::expt::detail::padded_extent<float, 2>(32, 0)), 32);
+
+  LaunchSharedArrayTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(4), INDEX_TYPE(2));
+
+  LaunchSharedArrayTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(5), INDEX_TYPE(32));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchSharedArrayTest,
+                            SharedArrayLaunch);
+
+#endif  // __TEST_LAUNCH_SHARED_ARRAY_HPP__
@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_TEAM_SHARED_HPP__
+#define __TEST_LAUNCH_TEAM_SHARED_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY,
+int THREAD_RANGE>
+void LaunchTeamSharedTestImpl(INDEX_TYPE block_range)
+{
+
+  INDEX_TYPE thread_range(THREAD_RANGE);
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(RAJA::stripIndexType(INDEX_TYPE(0)), RAJA::stripIndexType(block_range));
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(RAJA::stripIndexType(INDEX_TYPE(0)), RAJA::stripIndexType(thread_range));
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(block_range)*RAJA::stripIndexType(thread_range);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  //determine the underlying type of block_range
+  using s_type = decltype(RAJA::stripIndexType(block_range));
+
+  for(s_type b=0; b<RAJA::stripIndexType(block_range); ++b) {
+    for(s_type c=0; c<RAJA::stripIndexType(thread_range); ++c) {
+      s_type idx = c + RAJA::stripIndexType(thread_range)*b;
+      test_array[idx] = INDEX_TYPE(idx);
+    }
+  }
+
+  using tile_type = RAJA::expt::TeamShared<INDEX_TYPE, 2, THREAD_RANGE>;
+  static_assert(tile_type::size == 2 * THREAD_RANGE, "TeamShared size");
+  static_assert(tile_type::bytes == 2 * THREAD_RANGE * sizeof(INDEX_TYPE), "TeamShared bytes");
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(RAJA::stripIndexType(block_range)),
+                        RAJA::Threads(RAJA::stripIndexType(thread_range))),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE bid) {
+
+          //Strongly typed values need no char workaround as the
+          //storage of TeamShared is raw bytes
+          RAJA_TEAM_SHARED tile_type Tile;
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE tid) {
+              Tile(0, thread_range-tid-1) = thread_range-tid-1 + thread_range*bid;
+              Tile[thread_range+tid] = tid + thread_range*bid;
+            });
+
+          ctx.teamSync();
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE tid) {
+              INDEX_TYPE idx = tid + thread_range * bid;
+              working_array[RAJA::stripIndexType(idx)] =
+                  Tile(0, tid) == Tile(1, tid) ? Tile(0, tid) : INDEX_TYPE(-1);
+          });
+
+          ctx.releaseSharedMemory();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+  for (size_t i = 0; i < data_len; i++) {
+    ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchTeamSharedTest);
+template <typename T>
+class LaunchTeamSharedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchTeamSharedTest, TeamSharedLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+
+  LaunchTeamSharedTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY, 2>
+    (INDEX_TYPE(4));
+
+  LaunchTeamSharedTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY, 32>
+    (INDEX_TYPE(5));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchTeamSharedTest,
+                            TeamSharedLaunch);
+
+#endif  // __TEST_LAUNCH_TEAM_SHARED_HPP__
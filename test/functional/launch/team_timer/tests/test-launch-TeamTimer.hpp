@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_LAUNCH_TEAM_TIMER_HPP__
+#define __TEST_LAUNCH_TEAM_TIMER_HPP__
+
+#include <sstream>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void LaunchTeamTimerTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
+{
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> outer_range(INDEX_TYPE(0), block_range);
+  RAJA::TypedRangeSegment<INDEX_TYPE> inner_range(INDEX_TYPE(0), thread_range);
+
+  using timer_type = RAJA::expt::team_timer<INDEX_TYPE>;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  long long* working_array;
+  long long* check_array;
+  long long* test_array;
+
+  size_t records_len = timer_type::records_size(block_range);
+
+  allocateForallTestData<long long>(records_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  for (size_t r = 0; r < records_len; ++r) {
+    test_array[r] = -1;
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(long long) * records_len);
+
+  INDEX_TYPE* sums = nullptr;
+  INDEX_TYPE* check_sums = nullptr;
+  INDEX_TYPE* test_sums = nullptr;
+  allocateForallTestData<INDEX_TYPE>(static_cast<size_t>(block_range),
+                                     working_res,
+                                     &sums,
+                                     &check_sums,
+                                     &test_sums);
+
+  RAJA::launch<LAUNCH_POLICY>
+    (RAJA::LaunchParams(RAJA::Teams(static_cast<int>(block_range)),
+                        RAJA::Threads(static_cast<int>(thread_range))),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext ctx) {
+
+      RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE t) {
+
+          timer_type timer(ctx, working_array, t);
+
+          RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE i) {
+              if (i == INDEX_TYPE(0)) {
+                sums[t] = t;
+              }
+          });
+
+          timer.stop();
+        });
+
+    });
+
+  working_res.memcpy(check_array, working_array, sizeof(long long) * records_len);
+  working_res.memcpy(check_sums, sums, sizeof(INDEX_TYPE) * static_cast<size_t>(block_range));
+
+  for (INDEX_TYPE t = 0; t < block_range; ++t) {
+    ASSERT_EQ(check_sums[t], t);
+    ASSERT_NE(check_array[2 * t], -1);
+    ASSERT_NE(check_array[2 * t + 1], -1);
+    ASSERT_GE(check_array[2 * t + 1], check_array[2 * t]);
+  }
+
+  RAJA::expt::team_timing timing =
+      RAJA::expt::summarize_team_timing(check_array, block_range);
+  ASSERT_EQ(timing.num_teams, static_cast<long long>(block_range));
+  ASSERT_LE(timing.min_cycles, timing.max_cycles);
+  ASSERT_LE(static_cast<double>(timing.min_cycles), timing.mean_cycles);
+  ASSERT_GE(static_cast<double>(timing.max_cycles), timing.mean_cycles);
+
+  std::ostringstream os;
+  RAJA::expt::print_team_heatmap(os, check_array, block_range);
+  ASSERT_FALSE(os.str().empty());
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       sums,
+                                       check_sums,
+                                       test_sums);
+  deallocateForallTestData<long long>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(LaunchTeamTimerTest);
+template <typename T>
+class LaunchTeamTimerTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(LaunchTeamTimerTest, TeamTimerLaunch)
+{
+
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<2>>::type, camp::num<2>>::type;
+
+  LaunchTeamTimerTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(4), INDEX_TYPE(8));
+
+  LaunchTeamTimerTestImpl<INDEX_TYPE, WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>
+    (INDEX_TYPE(37), INDEX_TYPE(64));
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LaunchTeamTimerTest,
+                            TeamTimerLaunch);
+
+#endif  // __TEST_LAUNCH_TEAM_TIMER_HPP__
@@ -0,0 +1,138 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_EXCLUSIVESEGMENTED_HPP__
+#define __TEST_SCAN_EXCLUSIVESEGMENTED_HPP__
+
+#include <numeric>
+#include <vector>
+
+template <typename OP, typename T>
+::testing::AssertionResult check_exclusive_segmented(
+  const T* actual,
+  const T* original,
+  const int* offsets,
+  int num_segments,
+  T init)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    T agg = init;
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      if (actual[i] != agg) {
+        return ::testing::AssertionFailure()
+               << actual[i] << " != " << agg << " (at index " << i
+               << " in segment " << s << ")";
+      }
+      agg = OP()(agg, original[i]);
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanExclusiveSegmentedTestImpl(int num_segments,
+                                    typename OP_TYPE::result_type offset =
+                                    OP_TYPE::identity())
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  // segments of varying length, including empty segments
+  std::vector<int> offsets(num_segments + 1, 0);
+  for (int s = 0; s < num_segments; ++s) {
+    offsets[s + 1] = offsets[s] + (s * 7) % 13;
+  }
+  const int N = offsets[num_segments];
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  int* work_offsets = working_res.allocate<int>(num_segments + 1);
+
+  std::iota(host_in, host_in + N, 1);
+
+  res.memcpy(work_offsets, offsets.data(), sizeof(int) * (num_segments + 1));
+
+  // test interface without resource
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.wait();
+
+  RAJA::exclusive_segmented_scan<EXEC_POLICY>(RAJA::make_span(static_cast<const T*>(work_in), N),
+                                                RAJA::make_span(work_out, N),
+                                                RAJA::make_span(static_cast<const int*>(work_offsets), num_segments + 1),
+                                                OP_TYPE{},
+                                                offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_exclusive_segmented<OP_TYPE>(host_out, host_in,
+                                                offsets.data(), num_segments, offset));
+
+  // test interface with resource
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  RAJA::exclusive_segmented_scan<EXEC_POLICY>(res,
+                                                RAJA::make_span(static_cast<const T*>(work_in), N),
+                                                RAJA::make_span(work_out, N),
+                                                RAJA::make_span(static_cast<const int*>(work_offsets), num_segments + 1),
+                                                OP_TYPE{},
+                                                offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_exclusive_segmented<OP_TYPE>(host_out, host_in,
+                                                offsets.data(), num_segments, offset));
+
+  working_res.deallocate(work_offsets);
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanExclusiveSegmentedTest);
+template <typename T>
+class ScanExclusiveSegmentedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanExclusiveSegmentedTest, ScanExclusiveSegmented)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(1);
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(57);
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(5000);
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(57, 3);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanExclusiveSegmentedTest,
+                            ScanExclusiveSegmented);
+
+#endif // __TEST_SCAN_EXCLUSIVESEGMENTED_HPP__
@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_INCLUSIVESCRATCH_HPP__
+#define __TEST_SCAN_INCLUSIVESCRATCH_HPP__
+
+#include <numeric>
+
+#include "test-scan-Inclusive.hpp"
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanInclusiveScratchTestImpl(int N)
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  std::iota(host_in, host_in + N, 1);
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  RAJA::expt::ScratchBuffer<WORKING_RES> scratch(res);
+
+  // repeated scans of a length reuse the storage of the first
+  size_t capacity = 0;
+  for (int rep = 0; rep < 3; ++rep) {
+    res.memset(work_out, 0, sizeof(T) * N);
+
+    RAJA::inclusive_scan<EXEC_POLICY>(res,
+                                      RAJA::make_span(static_cast<const T*>(work_in), N),
+                                      RAJA::make_span(work_out, N),
+                                      OP_TYPE{});
+
+    res.memcpy(host_out, work_out, sizeof(T) * N);
+    res.wait();
+
+    ASSERT_TRUE(check_inclusive<OP_TYPE>(host_out, host_in, N));
+
+    if (rep == 0) {
+      capacity = scratch.capacity();
+    } else {
+      ASSERT_EQ(capacity, scratch.capacity());
+    }
+  }
+
+  // a shorter scan fits in the storage
+  const int M = N / 2;
+  RAJA::inclusive_scan<EXEC_POLICY>(res,
+                                    RAJA::make_span(static_cast<const T*>(work_in), M),
+                                    RAJA::make_span(work_out, M),
+                                    OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * M);
+  res.wait();
+
+  ASSERT_TRUE(check_inclusive<OP_TYPE>(host_out, host_in, M));
+  ASSERT_EQ(capacity, scratch.capacity());
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanInclusiveScratchTest);
+template <typename T>
+class ScanInclusiveScratchTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanInclusiveScratchTest, ScanInclusiveScratch)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanInclusiveScratchTestImpl<EXEC_POLICY,
+                               WORKING_RESOURCE,
+                               OP_TYPE>(357);
+  ScanInclusiveScratchTestImpl<EXEC_POLICY,
+                               WORKING_RESOURCE,
+                               OP_TYPE>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanInclusiveScratchTest,
+                            ScanInclusiveScratch);
+
+#endif // __TEST_SCAN_INCLUSIVESCRATCH_HPP__
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SPMV_CSR_HPP__
+#define __TEST_SPMV_CSR_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES>
+void SpmvCSRTestImpl(int rows, int cols, int max_row_len, int long_row_len)
+{
+  SpmvTestMatrix M(rows, cols, max_row_len, long_row_len);
+  std::vector<double> x = spmvTestVector(cols);
+  std::vector<double> expected = M.multiply(x);
+
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+
+  const int nnz = M.nnz();
+  int* row_ptr = working_res.allocate<int>(rows + 1);
+  int* col_idx = working_res.allocate<int>(nnz > 0 ? nnz : 1);
+  double* values = working_res.allocate<double>(nnz > 0 ? nnz : 1);
+  double* d_x = working_res.allocate<double>(cols);
+  double* d_y = working_res.allocate<double>(rows);
+
+  working_res.memcpy(row_ptr, M.row_ptr.data(), sizeof(int) * (rows + 1));
+  if (nnz > 0) {
+    working_res.memcpy(col_idx, M.col_idx.data(), sizeof(int) * nnz);
+    working_res.memcpy(values, M.values.data(), sizeof(double) * nnz);
+  }
+  working_res.memcpy(d_x, x.data(), sizeof(double) * cols);
+
+  RAJA::expt::CSRView<double, int> A{rows, cols, nnz, row_ptr, col_idx, values};
+
+  RAJA::expt::spmv<EXEC_POLICY>(res, A, static_cast<double const*>(d_x), d_y);
+
+  std::vector<double> actual(rows);
+  working_res.memcpy(actual.data(), d_y, sizeof(double) * rows);
+  working_res.wait();
+
+  for (int r = 0; r < rows; ++r) {
+    ASSERT_EQ(actual[r], expected[r]) << "row " << r;
+  }
+
+  working_res.deallocate(d_y);
+  working_res.deallocate(d_x);
+  working_res.deallocate(values);
+  working_res.deallocate(col_idx);
+  working_res.deallocate(row_ptr);
+}
+
+
+TYPED_TEST_SUITE_P(SpmvCSRTest);
+template <typename T>
+class SpmvCSRTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SpmvCSRTest, SpmvCSR)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  // short rows, merge path on GPUs
+  SpmvCSRTestImpl<EXEC_POLICY, WORKING_RES>(1, 1, 0, 0);
+  SpmvCSRTestImpl<EXEC_POLICY, WORKING_RES>(1000, 700, 6, 5000);
+  // long rows, a warp per row on GPUs
+  SpmvCSRTestImpl<EXEC_POLICY, WORKING_RES>(500, 900, 80, 3000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SpmvCSRTest,
+                            SpmvCSR);
+
+#endif  // __TEST_SPMV_CSR_HPP__
@@ -0,0 +1,58 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SPMV_SELL_HPP__
+#define __TEST_SPMV_SELL_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES>
+void SpmvSellTestImpl(int rows, int cols, int max_row_len, int long_row_len,
+                      int sigma)
+{
+  SpmvTestMatrix M(rows, cols, max_row_len, long_row_len);
+  std::vector<double> x = spmvTestVector(cols);
+  std::vector<double> expected = M.multiply(x);
+
+  WORKING_RES res = WORKING_RES::get_default();
+
+  RAJA::expt::CSRView<double, int> A{rows, cols, M.nnz(),
+                                     M.row_ptr.data(), M.col_idx.data(),
+                                     M.values.data()};
+  RAJA::expt::SellMatrix<double, int> S(A, sigma);
+
+  ASSERT_EQ(S.num_rows(), rows);
+  ASSERT_GE(S.storage_size(), static_cast<size_t>(M.nnz()));
+
+  std::vector<double> actual(rows, -1.0);
+  RAJA::expt::spmv<EXEC_POLICY>(res, S, x.data(), actual.data());
+
+  for (int r = 0; r < rows; ++r) {
+    ASSERT_EQ(actual[r], expected[r]) << "row " << r;
+  }
+}
+
+
+TYPED_TEST_SUITE_P(SpmvSellTest);
+template <typename T>
+class SpmvSellTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SpmvSellTest, SpmvSell)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SpmvSellTestImpl<EXEC_POLICY, WORKING_RES>(1, 1, 0, 0, 1);
+  SpmvSellTestImpl<EXEC_POLICY, WORKING_RES>(1003, 700, 12, 200, 1);
+  SpmvSellTestImpl<EXEC_POLICY, WORKING_RES>(1003, 700, 12, 200, 64);
+  SpmvSellTestImpl<EXEC_POLICY, WORKING_RES>(1003, 700, 12, 200, 2000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SpmvSellTest,
+                            SpmvSell);
+
+#endif  // __TEST_SPMV_SELL_HPP__
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SPMV_DATA_HPP__
+#define __TEST_SPMV_DATA_HPP__
+
+#include <random>
+#include <vector>
+
+//
+// The host spmv takes sequential and OpenMP policies, loop_exec is neither
+//
+using SequentialSpmvExecPols = camp::list< RAJA::seq_exec,
+                                           RAJA::simd_exec >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPSpmvExecPols = OpenMPForallExecPols;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaSpmvExecPols = CudaForallExecPols;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipSpmvExecPols = HipForallExecPols;
+#endif
+
+//
+// Host CSR matrix with rows of random length up to max_row_len, some empty,
+// and one row of long_row_len nonzeros. Values and x are small integers so
+// the products are exact.
+//
+struct SpmvTestMatrix {
+  int num_rows;
+  int num_cols;
+  std::vector<int> row_ptr;
+  std::vector<int> col_idx;
+  std::vector<double> values;
+
+  SpmvTestMatrix(int rows, int cols, int max_row_len, int long_row_len)
+      : num_rows(rows), num_cols(cols), row_ptr(rows + 1, 0)
+  {
+    std::mt19937 gen(rows + 13 * max_row_len);
+    std::uniform_int_distribution<int> len_dist(0, max_row_len);
+    std::uniform_int_distribution<int> col_dist(0, cols - 1);
+    std::uniform_int_distribution<int> val_dist(-4, 4);
+
+    for (int r = 0; r < rows; ++r) {
+      int len = (r == rows / 2) ? long_row_len : len_dist(gen);
+      row_ptr[r + 1] = row_ptr[r] + len;
+      for (int k = 0; k < len; ++k) {
+        col_idx.push_back(col_dist(gen));
+        values.push_back(static_cast<double>(val_dist(gen)));
+      }
+    }
+  }
+
+  int nnz() const { return row_ptr[num_rows]; }
+
+  std::vector<double> multiply(std::vector<double> const& x) const
+  {
+    std::vector<double> y(num_rows, 0.0);
+    for (int r = 0; r < num_rows; ++r) {
+      for (int k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+        y[r] += values[k] * x[col_idx[k]];
+      }
+    }
+    return y;
+  }
+};
+
+inline std::vector<double> spmvTestVector(int n)
+{
+  std::vector<double> x(n);
+  for (int i = 0; i < n; ++i) {
+    x[i] = static_cast<double>(i % 7 - 3);
+  }
+  return x;
+}
+
+#endif // __TEST_SPMV_DATA_HPP__
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SWEEP_TEMPORAL1D_HPP__
+#define __TEST_SWEEP_TEMPORAL1D_HPP__
+
+//
+// Value of cell i at the next step of a stencil of the given radius, cells
+// past the boundary read as 0.
+//
+inline long temporalTestValue1D(const long* u,
+                                RAJA::Index_type n,
+                                RAJA::Index_type radius,
+                                RAJA::Index_type t,
+                                RAJA::Index_type i)
+{
+  long sum = t;
+  for (RAJA::Index_type d = -radius; d <= radius; ++d) {
+    RAJA::Index_type c = i + d;
+    if (c >= 0 && c < n) {
+      sum += (2 * (d + radius) + 1) * u[c];
+    }
+  }
+  return sum % 1000003;
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES>
+void SweepTemporal1DTestImpl(RAJA::Index_type nx,
+                             RAJA::Index_type tx,
+                             RAJA::Index_type depth,
+                             RAJA::Index_type radius,
+                             RAJA::Index_type num_steps)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+
+  std::vector<long> init(nx > 0 ? nx : 1);
+  for (RAJA::Index_type i = 0; i < nx; ++i) {
+    init[i] = (37 * i + 11) % 101;
+  }
+
+  // sequential reference, step by step
+  std::vector<long> ref[2] = {init, init};
+  for (RAJA::Index_type t = 0; t < num_steps; ++t) {
+    for (RAJA::Index_type i = 0; i < nx; ++i) {
+      ref[(t + 1) % 2][i] =
+          temporalTestValue1D(ref[t % 2].data(), nx, radius, t, i);
+    }
+  }
+  std::vector<long> expected(ref[num_steps % 2].begin(),
+                             ref[num_steps % 2].begin() + nx);
+
+  std::vector<long> buf[2] = {init, init};
+  long* buf0 = buf[0].data();
+  long* buf1 = buf[1].data();
+
+  auto body = [=](RAJA::Index_type t, RAJA::Index_type i) {
+    const long* u = (t % 2 == 0) ? buf0 : buf1;
+    long* u_new = (t % 2 == 0) ? buf1 : buf0;
+    u_new[i] = temporalTestValue1D(u, nx, radius, t, i);
+  };
+
+  RAJA::expt::TemporalTiles<1> tiles{{nx}, {tx}, depth, radius};
+
+  // test interface without resource
+  RAJA::expt::temporal_block<EXEC_POLICY>(tiles, num_steps, body);
+
+  std::vector<long> actual(buf[num_steps % 2].begin(),
+                           buf[num_steps % 2].begin() + nx);
+  ASSERT_TRUE(check_sweep(actual.data(), expected));
+
+  // test interface with resource
+  buf[0] = init;
+  buf[1] = init;
+  RAJA::expt::temporal_block<EXEC_POLICY>(res, tiles, num_steps, body);
+
+  actual.assign(buf[num_steps % 2].begin(), buf[num_steps % 2].begin() + nx);
+  ASSERT_TRUE(check_sweep(actual.data(), expected));
+}
+
+
+TYPED_TEST_SUITE_P(SweepTemporal1DTest);
+template <typename T>
+class SweepTemporal1DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SweepTemporal1DTest, SweepTemporal1D)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SweepTemporal1DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(0, 8, 4, 1, 10);
+  SweepTemporal1DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(17, 8, 4, 1, 0);
+  SweepTemporal1DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(1, 8, 4, 1, 7);
+  SweepTemporal1DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(100, 16, 4, 1, 13);
+  SweepTemporal1DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(100, 3, 5, 2, 12);
+  SweepTemporal1DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(257, 32, 8, 1, 40);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SweepTemporal1DTest,
+                            SweepTemporal1D);
+
+#endif // __TEST_SWEEP_TEMPORAL1D_HPP__
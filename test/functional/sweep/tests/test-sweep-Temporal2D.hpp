@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SWEEP_TEMPORAL2D_HPP__
+#define __TEST_SWEEP_TEMPORAL2D_HPP__
+
+//
+// Value of cell (i, j) at the next step of a 5 point stencil, cells past
+// the boundary read as 0.
+//
+inline long temporalTestValue2D(const long* u,
+                                RAJA::Index_type nx,
+                                RAJA::Index_type ny,
+                                RAJA::Index_type t,
+                                RAJA::Index_type i,
+                                RAJA::Index_type j)
+{
+  long w = (i > 0) ? u[(i - 1) * ny + j] : 0;
+  long e = (i + 1 < nx) ? u[(i + 1) * ny + j] : 0;
+  long s = (j > 0) ? u[i * ny + j - 1] : 0;
+  long n = (j + 1 < ny) ? u[i * ny + j + 1] : 0;
+  return (w + 3 * e + 5 * s + 7 * n + 11 * u[i * ny + j] + t) % 1000003;
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES>
+void SweepTemporal2DTestImpl(RAJA::Index_type nx,
+                             RAJA::Index_type ny,
+                             RAJA::Index_type tx,
+                             RAJA::Index_type ty,
+                             RAJA::Index_type depth,
+                             RAJA::Index_type num_steps)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+
+  const RAJA::Index_type N = nx * ny;
+
+  std::vector<long> init(N > 0 ? N : 1);
+  for (RAJA::Index_type k = 0; k < N; ++k) {
+    init[k] = (37 * k + 11) % 101;
+  }
+
+  // sequential reference, step by step
+  std::vector<long> ref[2] = {init, init};
+  for (RAJA::Index_type t = 0; t < num_steps; ++t) {
+    for (RAJA::Index_type i = 0; i < nx; ++i) {
+      for (RAJA::Index_type j = 0; j < ny; ++j) {
+        ref[(t + 1) % 2][i * ny + j] =
+            temporalTestValue2D(ref[t % 2].data(), nx, ny, t, i, j);
+      }
+    }
+  }
+  std::vector<long> expected(ref[num_steps % 2].begin(),
+                             ref[num_steps % 2].begin() + N);
+
+  std::vector<long> buf[2] = {init, init};
+  long* buf0 = buf[0].data();
+  long* buf1 = buf[1].data();
+
+  auto body = [=](RAJA::Index_type t, RAJA::Index_type i, RAJA::Index_type j) {
+    const long* u = (t % 2 == 0) ? buf0 : buf1;
+    long* u_new = (t % 2 == 0) ? buf1 : buf0;
+    u_new[i * ny + j] = temporalTestValue2D(u, nx, ny, t, i, j);
+  };
+
+  RAJA::expt::TemporalTiles<2> tiles{{nx, ny}, {tx, ty}, depth, 1};
+
+  // test interface without resource
+  RAJA::expt::temporal_block<EXEC_POLICY>(tiles, num_steps, body);
+
+  std::vector<long> actual(buf[num_steps % 2].begin(),
+                           buf[num_steps % 2].begin() + N);
+  ASSERT_TRUE(check_sweep(actual.data(), expected));
+
+  // test interface with resource
+  buf[0] = init;
+  buf[1] = init;
+  RAJA::expt::temporal_block<EXEC_POLICY>(res, tiles, num_steps, body);
+
+  actual.assign(buf[num_steps % 2].begin(), buf[num_steps % 2].begin() + N);
+  ASSERT_TRUE(check_sweep(actual.data(), expected));
+}
+
+
+TYPED_TEST_SUITE_P(SweepTemporal2DTest);
+template <typename T>
+class SweepTemporal2DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SweepTemporal2DTest, SweepTemporal2D)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SweepTemporal2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(0, 5, 4, 4, 2, 3);
+  SweepTemporal2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(1, 1, 4, 4, 2, 5);
+  SweepTemporal2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(37, 23, 8, 4, 3, 10);
+  SweepTemporal2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(37, 23, 1, 1, 4, 7);
+  SweepTemporal2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(64, 64, 16, 16, 8, 17);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SweepTemporal2DTest,
+                            SweepTemporal2D);
+
+#endif // __TEST_SWEEP_TEMPORAL2D_HPP__
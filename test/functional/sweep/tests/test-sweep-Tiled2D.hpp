@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SWEEP_TILED2D_HPP__
+#define __TEST_SWEEP_TILED2D_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES>
+void SweepTiled2DTestImpl(RAJA::Index_type nx,
+                          RAJA::Index_type ny,
+                          RAJA::Index_type tx,
+                          RAJA::Index_type ty,
+                          int dx,
+                          int dy)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  const RAJA::Index_type N = nx * ny;
+
+  long* work_x = working_res.allocate<long>(N > 0 ? N : 1);
+  long* host_x = host_res.allocate<long>(N > 0 ? N : 1);
+
+  std::vector<long> expected(N);
+  for (RAJA::Index_type ii = 0; ii < nx; ++ii) {
+    RAJA::Index_type i = dx > 0 ? ii : nx - 1 - ii;
+    for (RAJA::Index_type jj = 0; jj < ny; ++jj) {
+      RAJA::Index_type j = dy > 0 ? jj : ny - 1 - jj;
+      RAJA::Index_type ui = sweepTestUpstream(i, nx, dx);
+      RAJA::Index_type uj = sweepTestUpstream(j, ny, dy);
+      expected[i * ny + j] =
+          sweepTestValue(ui >= 0 ? expected[ui * ny + j] : 0,
+                         uj >= 0 ? expected[i * ny + uj] : 0,
+                         0);
+    }
+  }
+
+  auto body = [=] RAJA_HOST_DEVICE (RAJA::Index_type i, RAJA::Index_type j) {
+    RAJA::Index_type ui = sweepTestUpstream(i, nx, dx);
+    RAJA::Index_type uj = sweepTestUpstream(j, ny, dy);
+    work_x[i * ny + j] =
+        sweepTestValue(ui >= 0 ? work_x[ui * ny + j] : 0,
+                       uj >= 0 ? work_x[i * ny + uj] : 0,
+                       0);
+  };
+
+  RAJA::expt::SweepTiles<2> tiles{{nx, ny}, {tx, ty}};
+  RAJA::expt::SweepDirection<2> dirs{{dx, dy}};
+
+  // test interface without resource
+  RAJA::expt::sweep<EXEC_POLICY>(tiles, dirs, body);
+
+  res.memcpy(host_x, work_x, sizeof(long) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sweep(host_x, expected));
+
+  // test interface with resource
+  res.memset(work_x, 0, sizeof(long) * N);
+  RAJA::expt::sweep<EXEC_POLICY>(res, tiles, dirs, body);
+
+  res.memcpy(host_x, work_x, sizeof(long) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sweep(host_x, expected));
+
+  working_res.deallocate(work_x);
+  host_res.deallocate(host_x);
+}
+
+
+TYPED_TEST_SUITE_P(SweepTiled2DTest);
+template <typename T>
+class SweepTiled2DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SweepTiled2DTest, SweepTiled2D)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SweepTiled2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(0, 5, 4, 4, 1, 1);
+  SweepTiled2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(1, 1, 4, 4, 1, 1);
+  SweepTiled2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(37, 23, 8, 4, 1, 1);
+  SweepTiled2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(37, 23, 8, 4, -1, 1);
+  SweepTiled2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(37, 23, 5, 7, 1, -1);
+  SweepTiled2DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(100, 64, 16, 16, -1, -1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SweepTiled2DTest,
+                            SweepTiled2D);
+
+#endif // __TEST_SWEEP_TILED2D_HPP__
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SWEEP_TILED3D_HPP__
+#define __TEST_SWEEP_TILED3D_HPP__
+
+template <typename EXEC_POLICY, typename WORKING_RES>
+void SweepTiled3DTestImpl(RAJA::Index_type nx,
+                          RAJA::Index_type ny,
+                          RAJA::Index_type nz,
+                          RAJA::Index_type tile,
+                          int dx,
+                          int dy,
+                          int dz)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  const RAJA::Index_type N = nx * ny * nz;
+
+  long* work_x = working_res.allocate<long>(N > 0 ? N : 1);
+  long* host_x = host_res.allocate<long>(N > 0 ? N : 1);
+
+  std::vector<long> expected(N);
+  for (RAJA::Index_type ii = 0; ii < nx; ++ii) {
+    RAJA::Index_type i = dx > 0 ? ii : nx - 1 - ii;
+    for (RAJA::Index_type jj = 0; jj < ny; ++jj) {
+      RAJA::Index_type j = dy > 0 ? jj : ny - 1 - jj;
+      for (RAJA::Index_type kk = 0; kk < nz; ++kk) {
+        RAJA::Index_type k = dz > 0 ? kk : nz - 1 - kk;
+        RAJA::Index_type ui = sweepTestUpstream(i, nx, dx);
+        RAJA::Index_type uj = sweepTestUpstream(j, ny, dy);
+        RAJA::Index_type uk = sweepTestUpstream(k, nz, dz);
+        expected[(i * ny + j) * nz + k] =
+            sweepTestValue(ui >= 0 ? expected[(ui * ny + j) * nz + k] : 0,
+                           uj >= 0 ? expected[(i * ny + uj) * nz + k] : 0,
+                           uk >= 0 ? expected[(i * ny + j) * nz + uk] : 0);
+      }
+    }
+  }
+
+  auto body = [=] RAJA_HOST_DEVICE (RAJA::Index_type i,
+                                    RAJA::Index_type j,
+                                    RAJA::Index_type k) {
+    RAJA::Index_type ui = sweepTestUpstream(i, nx, dx);
+    RAJA::Index_type uj = sweepTestUpstream(j, ny, dy);
+    RAJA::Index_type uk = sweepTestUpstream(k, nz, dz);
+    work_x[(i * ny + j) * nz + k] =
+        sweepTestValue(ui >= 0 ? work_x[(ui * ny + j) * nz + k] : 0,
+                       uj >= 0 ? work_x[(i * ny + uj) * nz + k] : 0,
+                       uk >= 0 ? work_x[(i * ny + j) * nz + uk] : 0);
+  };
+
+  RAJA::expt::SweepTiles<3> tiles{{nx, ny, nz}, {tile, tile, tile}};
+  RAJA::expt::SweepDirection<3> dirs{{dx, dy, dz}};
+
+  // test interface without resource
+  RAJA::expt::sweep<EXEC_POLICY>(tiles, dirs, body);
+
+  res.memcpy(host_x, work_x, sizeof(long) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sweep(host_x, expected));
+
+  // test interface with resource
+  res.memset(work_x, 0, sizeof(long) * N);
+  RAJA::expt::sweep<EXEC_POLICY>(res, tiles, dirs, body);
+
+  res.memcpy(host_x, work_x, sizeof(long) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_sweep(host_x, expected));
+
+  working_res.deallocate(work_x);
+  host_res.deallocate(host_x);
+}
+
+
+TYPED_TEST_SUITE_P(SweepTiled3DTest);
+template <typename T>
+class SweepTiled3DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SweepTiled3DTest, SweepTiled3D)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SweepTiled3DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(4, 0, 4, 2, 1, 1, 1);
+  SweepTiled3DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(1, 1, 1, 2, 1, 1, 1);
+  SweepTiled3DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(13, 9, 11, 4, 1, 1, 1);
+  SweepTiled3DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(13, 9, 11, 4, -1, 1, -1);
+  SweepTiled3DTestImpl<EXEC_POLICY, WORKING_RESOURCE>(24, 16, 20, 8, 1, -1, -1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SweepTiled3DTest,
+                            SweepTiled3D);
+
+#endif // __TEST_SWEEP_TILED3D_HPP__
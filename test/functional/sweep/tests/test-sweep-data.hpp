@@ -0,0 +1,50 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SWEEP_DATA_HPP__
+#define __TEST_SWEEP_DATA_HPP__
+
+#include <vector>
+
+//
+// Value of a cell computed from the values of its upstream neighbors, a
+// cell that runs before one of them gets a different value.
+//
+RAJA_HOST_DEVICE inline long sweepTestValue(long up0, long up1, long up2)
+{
+  return (up0 + 3 * up1 + 7 * up2 + 1) % 1000003;
+}
+
+//
+// Index of the upstream neighbor of cell i in a dimension of size n swept
+// in direction dir, or -1 if the cell is on the upstream boundary.
+//
+RAJA_HOST_DEVICE inline RAJA::Index_type sweepTestUpstream(RAJA::Index_type i,
+                                                           RAJA::Index_type n,
+                                                           int dir)
+{
+  RAJA::Index_type up = i - dir;
+  return (up >= 0 && up < n) ? up : -1;
+}
+
+//
+// Compare the results of a sweep with a sequential reference.
+//
+inline ::testing::AssertionResult check_sweep(const long* actual,
+                                              const std::vector<long>& expected)
+{
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected[i] << " (at index " << i
+             << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+#endif // __TEST_SWEEP_DATA_HPP__
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_REGISTER_TransposeShuffle_HPP__
+#define __TEST_TENSOR_REGISTER_TransposeShuffle_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename REGISTER_TYPE>
+void TransposeShuffleImpl()
+{
+  using register_t = REGISTER_TYPE;
+  using element_t = typename register_t::element_type;
+  using policy_t = typename register_t::register_policy;
+  using int_vector_t = typename register_t::int_vector_type;
+  using int_element_t = typename int_vector_t::element_type;
+
+  static constexpr camp::idx_t num_elem = register_t::s_num_elem;
+
+  // Allocate
+
+  std::vector<element_t> input0_vec(num_elem);
+  element_t *input0_hptr = input0_vec.data();
+  element_t *input0_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> input1_vec(num_elem);
+  element_t *input1_hptr = input1_vec.data();
+  element_t *input1_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<int_element_t> idx_vec(num_elem);
+  int_element_t *idx_dptr = tensor_malloc<policy_t, int_element_t>(num_elem);
+
+  std::vector<element_t> output0_vec(num_elem);
+  element_t *output0_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+  std::vector<element_t> output1_vec(num_elem);
+  element_t *output1_dptr = tensor_malloc<policy_t, element_t>(num_elem);
+
+
+  // Initialize input data, with distinct values so lanes can be told apart
+  for(camp::idx_t i = 0;i < num_elem; ++ i){
+    input0_hptr[i] = (element_t)(i+1);
+    input1_hptr[i] = (element_t)(-i-1);
+    idx_vec[i] = (int_element_t)((i*3+1) % num_elem);
+  }
+
+  tensor_copy_to_device<policy_t>(input0_dptr, input0_vec);
+  tensor_copy_to_device<policy_t>(input1_dptr, input1_vec);
+  tensor_copy_to_device<policy_t>(idx_dptr, idx_vec);
+
+
+  //
+  //  Check the shuffles at each level
+  //
+  for(camp::idx_t lvl = 0;(1<<lvl) < num_elem;++ lvl){
+
+    tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+      register_t x;
+      x.load_packed(input0_dptr);
+
+      register_t y;
+      y.load_packed(input1_dptr);
+
+      x.transpose_shuffle_left(lvl, y).store_packed(output0_dptr);
+      x.transpose_shuffle_right(lvl, y).store_packed(output1_dptr);
+    });
+
+    tensor_copy_to_host<policy_t>(output0_vec, output0_dptr);
+    tensor_copy_to_host<policy_t>(output1_vec, output1_dptr);
+
+    for(camp::idx_t i = 0;i < num_elem;++i){
+      camp::idx_t w = 1<<lvl;
+      camp::idx_t base = i & ~(2*w-1);
+      camp::idx_t lane = i & (w-1);
+      bool from_y = (i & w) != 0;
+
+      element_t left = from_y ? input1_vec[base + lane] : input0_vec[base + lane];
+      element_t right = from_y ? input1_vec[base + w + lane] : input0_vec[base + w + lane];
+
+      ASSERT_SCALAR_EQ(left, output0_vec[i]);
+      ASSERT_SCALAR_EQ(right, output1_vec[i]);
+    }
+  }
+
+
+  //
+  //  Check permute
+  //
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    register_t x;
+    x.load_packed(input0_dptr);
+
+    int_vector_t idx;
+    idx.load_packed(idx_dptr);
+
+    x.permute(idx).store_packed(output0_dptr);
+  });
+
+  tensor_copy_to_host<policy_t>(output0_vec, output0_dptr);
+
+  for(camp::idx_t i = 0;i < num_elem;++i){
+    ASSERT_SCALAR_EQ(input0_vec[idx_vec[i]], output0_vec[i]);
+  }
+
+
+  // Cleanup
+  tensor_free<policy_t>(input0_dptr);
+  tensor_free<policy_t>(input1_dptr);
+  tensor_free<policy_t>(idx_dptr);
+  tensor_free<policy_t>(output0_dptr);
+  tensor_free<policy_t>(output1_dptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorRegister, TransposeShuffle)
+{
+  TransposeShuffleImpl<TypeParam>();
+}
+
+
+#endif
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_VECTOR_ForallExplicitSimd_HPP__
+#define __TEST_TENSOR_VECTOR_ForallExplicitSimd_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename VECTOR_TYPE>
+void ForallExplicitSimdImpl(std::true_type)
+{
+  // explicit_simd_exec is a host policy
+}
+
+template <typename VECTOR_TYPE>
+void ForallExplicitSimdImpl(std::false_type)
+{
+
+  using vector_t = VECTOR_TYPE;
+  using element_t = typename vector_t::element_type;
+  using exec_t = RAJA::policy::tensor::explicit_simd_exec<vector_t>;
+  using idx_t = RAJA::expt::VectorIndex<int, vector_t>;
+
+  int N = 10*vector_t::s_num_elem+3;
+
+  std::vector<element_t> A(N);
+  std::vector<element_t> B(N);
+  std::vector<element_t> C(N);
+
+  for(int i = 0;i < N; ++ i){
+    A[i] = (element_t)(NO_OPT_RAND*1000.0);
+    B[i] = (element_t)(NO_OPT_RAND*1000.0);
+  }
+
+  RAJA::View<element_t, RAJA::Layout<1>> X(A.data(), N);
+  RAJA::View<element_t, RAJA::Layout<1>> Y(B.data(), N);
+  RAJA::View<element_t, RAJA::Layout<1>> Z(C.data(), N);
+
+
+  // range segments, with a partial final register
+  for(int begin = 0;begin < 3;++ begin){
+
+    for(int i = 0;i < N; ++ i){
+      C[i] = 0;
+    }
+
+    RAJA::forall<exec_t>(RAJA::TypedRangeSegment<int>(begin, N),
+      [=](idx_t i){
+        Z(i) = 3 + X(i)*Y(i);
+      });
+
+    for(int i = 0;i < begin;i ++){
+      ASSERT_SCALAR_EQ(element_t(0), C[i]);
+    }
+    for(int i = begin;i < N;i ++){
+      ASSERT_SCALAR_EQ(element_t(3+A[i]*B[i]), C[i]);
+    }
+  }
+
+
+  // segments without contiguous indices run one index at a time
+  for(int i = 0;i < N; ++ i){
+    C[i] = 0;
+  }
+
+  RAJA::forall<exec_t>(RAJA::TypedRangeStrideSegment<int>(1, N, 3),
+    [=](idx_t i){
+      Z(i) = 3 + X(i)*Y(i);
+    });
+
+  for(int i = 0;i < N;i ++){
+    if(i % 3 == 1){
+      ASSERT_SCALAR_EQ(element_t(3+A[i]*B[i]), C[i]);
+    }
+    else{
+      ASSERT_SCALAR_EQ(element_t(0), C[i]);
+    }
+  }
+
+}
+
+
+
+TYPED_TEST_P(TestTensorVector, ForallExplicitSimd)
+{
+  using policy_t = typename TypeParam::register_policy;
+
+  ForallExplicitSimdImpl<TypeParam>(
+      std::integral_constant<bool, TensorTestHelper<policy_t>::is_device>());
+}
+
+
+#endif
@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_VECTOR_GatherScatter_HPP__
+#define __TEST_TENSOR_VECTOR_GatherScatter_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename VECTOR_TYPE>
+void GatherScatterImpl()
+{
+
+  using vector_t = VECTOR_TYPE;
+  using policy_t = typename vector_t::register_policy;
+  using element_t = typename vector_t::element_type;
+
+  static constexpr camp::idx_t num_elem = vector_t::s_num_elem;
+
+  // Data to be read and written (3x larger than the vector)
+  std::vector<element_t> A(3*num_elem);
+  std::vector<element_t> B(3*num_elem);
+
+  // Indices as they would come from a ListSegment
+  std::vector<int> idx(num_elem);
+
+  element_t * A_ptr = tensor_malloc<policy_t>(A);
+  element_t * B_ptr = tensor_malloc<policy_t>(B);
+  int * idx_ptr = tensor_malloc<policy_t>(idx);
+
+  for(camp::idx_t i = 0;i < 3*num_elem;++ i){
+    A[i] = (element_t)(i+1+NO_OPT_RAND);
+  }
+  for(camp::idx_t i = 0;i < num_elem;++ i){
+    idx[i] = (int)((3*i+2) % (3*num_elem));
+  }
+
+  tensor_copy_to_device<policy_t>(A_ptr, A);
+  tensor_copy_to_device<policy_t>(idx_ptr, idx);
+
+
+  for(camp::idx_t N = 0;N <= num_elem;++ N){
+
+    for(camp::idx_t i = 0;i < 3*num_elem;++ i){
+      B[i] = (element_t)0;
+    }
+    tensor_copy_to_device<policy_t>(B_ptr, B);
+
+    // B[idx[i]] = 2*A[idx[i]]
+    tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+      vector_t vec;
+      if(N == num_elem){
+        vec.gather_indexed(A_ptr, idx_ptr);
+        vec = vec.add(vec);
+        vec.scatter_indexed(B_ptr, idx_ptr);
+      }
+      else{
+        vec.gather_indexed_n(A_ptr, idx_ptr, N);
+        vec = vec.add(vec);
+        vec.scatter_indexed_n(B_ptr, idx_ptr, N);
+      }
+    });
+
+    tensor_copy_to_host<policy_t>(B, B_ptr);
+
+    std::vector<element_t> expected(3*num_elem, (element_t)0);
+    for(camp::idx_t i = 0;i < N;++ i){
+      expected[idx[i]] = A[idx[i]] + A[idx[i]];
+    }
+    for(camp::idx_t i = 0;i < 3*num_elem;++ i){
+      ASSERT_SCALAR_EQ(expected[i], B[i]);
+    }
+
+  }
+
+  tensor_free<policy_t>(A_ptr);
+  tensor_free<policy_t>(B_ptr);
+  tensor_free<policy_t>(idx_ptr);
+}
+
+
+
+TYPED_TEST_P(TestTensorVector, GatherScatter)
+{
+  GatherScatterImpl<TypeParam>();
+}
+
+
+#endif
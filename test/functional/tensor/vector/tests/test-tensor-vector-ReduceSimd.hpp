@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_VECTOR_ReduceSimd_HPP__
+#define __TEST_TENSOR_VECTOR_ReduceSimd_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+template <typename VECTOR_TYPE>
+void ReduceSimdImpl(std::true_type)
+{
+  // simd_reduce is a host policy
+}
+
+template <typename VECTOR_TYPE>
+void ReduceSimdImpl(std::false_type)
+{
+
+  using element_t = typename VECTOR_TYPE::element_type;
+  using register_t = typename VECTOR_TYPE::register_policy;
+  using reduce_t = RAJA::expt::simd_reduce<register_t, RAJA::seq_reduce>;
+  using vector_t = typename RAJA::ReduceSum<reduce_t, element_t>::vector_type;
+  using exec_t = RAJA::policy::tensor::explicit_simd_exec<vector_t>;
+  using idx_t = RAJA::expt::VectorIndex<int, vector_t>;
+
+  int N = 10*vector_t::s_num_elem+3;
+
+  // small integer values, so the sums are exact in any order
+  std::vector<element_t> A(N);
+  for(int i = 0;i < N; ++ i){
+    A[i] = (element_t)((int)(NO_OPT_RAND*100.0) - 50);
+  }
+  element_t const *a_ptr = A.data();
+
+  // range segments, with a partial final register
+  for(int begin = 0;begin < 3;++ begin){
+
+    RAJA::ReduceSum<reduce_t, element_t> sum(1);
+    RAJA::ReduceMin<reduce_t, element_t> min(100);
+    RAJA::ReduceMax<reduce_t, element_t> max(-100);
+
+    RAJA::forall<exec_t>(RAJA::TypedRangeSegment<int>(begin, N),
+      [=](idx_t i){
+        vector_t x;
+        x.load_packed_n(a_ptr + *i, i.size());
+
+        sum += x;
+        min.min(x, i.size());
+        max.max(x, i.size());
+      });
+
+    element_t expected_sum = 1;
+    element_t expected_min = 100;
+    element_t expected_max = -100;
+    for(int i = begin;i < N;i ++){
+      expected_sum += A[i];
+      expected_min = RAJA::min<element_t>(expected_min, A[i]);
+      expected_max = RAJA::max<element_t>(expected_max, A[i]);
+    }
+
+    ASSERT_SCALAR_EQ(expected_sum, sum.get());
+    ASSERT_SCALAR_EQ(expected_min, min.get());
+    ASSERT_SCALAR_EQ(expected_max, max.get());
+
+
+    // scalar contributions mix with vector contributions
+    sum.reset(0);
+    RAJA::forall<exec_t>(RAJA::TypedRangeSegment<int>(begin, N),
+      [=](idx_t i){
+        vector_t x;
+        x.load_packed_n(a_ptr + *i, i.size());
+
+        sum += x;
+        sum += element_t(1);
+      });
+
+    int num_chunks = (N-begin+vector_t::s_num_elem-1) / vector_t::s_num_elem;
+    ASSERT_SCALAR_EQ(element_t(expected_sum - 1 + num_chunks), sum.get());
+  }
+
+}
+
+
+template <typename VECTOR_TYPE>
+void ReduceSimdCompensatedImpl(std::false_type)
+{
+  // compensated sums need floating point elements on the host
+}
+
+template <typename VECTOR_TYPE>
+void ReduceSimdCompensatedImpl(std::true_type)
+{
+
+  using element_t = typename VECTOR_TYPE::element_type;
+  using register_t = typename VECTOR_TYPE::register_policy;
+  using reduce_t = RAJA::expt::simd_reduce<register_t, RAJA::seq_reduce>;
+  using sum_t = RAJA::NeumaierSum<element_t>;
+  using vector_t = typename RAJA::ReduceSum<reduce_t, sum_t>::vector_type;
+  using exec_t = RAJA::policy::tensor::explicit_simd_exec<vector_t>;
+  using idx_t = RAJA::expt::VectorIndex<int, vector_t>;
+
+  int N = 10*vector_t::s_num_elem+3;
+
+  // one large value followed by values below its rounding error
+  element_t eps = std::numeric_limits<element_t>::epsilon();
+  std::vector<element_t> A(N, eps/4);
+  A[0] = element_t(1);
+  element_t const *a_ptr = A.data();
+
+  RAJA::ReduceSum<reduce_t, sum_t> sum(element_t(0));
+
+  RAJA::forall<exec_t>(RAJA::TypedRangeSegment<int>(0, N),
+    [=](idx_t i){
+      vector_t x;
+      x.load_packed_n(a_ptr + *i, i.size());
+
+      sum += x;
+    });
+
+  element_t expected = element_t(1) + element_t(N-1)*(eps/4);
+  element_t result = sum.get().get();
+  ASSERT_LE(std::abs(result - expected), eps);
+}
+
+
+TYPED_TEST_P(TestTensorVector, ReduceSimd)
+{
+  using policy_t = typename TypeParam::register_policy;
+  using element_t = typename TypeParam::element_type;
+
+  ReduceSimdImpl<TypeParam>(
+      std::integral_constant<bool, TensorTestHelper<policy_t>::is_device>());
+
+  ReduceSimdCompensatedImpl<TypeParam>(
+      std::integral_constant<bool,
+                             !TensorTestHelper<policy_t>::is_device &&
+                             std::is_floating_point<element_t>::value>());
+}
+
+
+#endif
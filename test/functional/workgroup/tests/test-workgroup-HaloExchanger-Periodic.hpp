@@ -0,0 +1,170 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA HaloExchanger periodic exchanges.
+///
+
+#ifndef __TEST_WORKGROUP_HALOEXCHANGER_PERIODIC__
+#define __TEST_WORKGROUP_HALOEXCHANGER_PERIODIC__
+
+#include "RAJA_test-workgroup.hpp"
+
+#include <vector>
+
+
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename StoragePolicy,
+          typename DispatchTyper,
+          typename IndexType,
+          typename Allocator,
+          typename WORKING_RES
+          >
+struct testWorkGroupHaloExchangerPeriodic {
+void operator()(IndexType nx, IndexType ny, int num_vars) const
+{
+  // a 2D grid with a halo of width one, exchanged periodically with itself
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  const IndexType sx = nx + 2;
+  const IndexType N = sx * (ny + 2);
+  auto idx = [=](IndexType i, IndexType j) { return j * sx + i; };
+
+  using range_segment = RAJA::TypedRangeSegment<IndexType>;
+  using pack_body = RAJA::expt::HaloPacker<double, IndexType>;
+  using unpack_body = RAJA::expt::HaloUnpacker<double, IndexType>;
+
+  using DispatchPolicy = typename DispatchTyper::template type<
+      camp::list<range_segment, pack_body>,
+      camp::list<range_segment, unpack_body> >;
+
+  using HaloExchanger_type = RAJA::expt::HaloExchanger<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy, DispatchPolicy>,
+                  double,
+                  IndexType,
+                  Allocator
+                >;
+
+  static_assert(std::is_same<WORKING_RES,
+                             typename HaloExchanger_type::resource_type>::value,
+                "Expected same resource types");
+
+  // neighbors left, right, bottom, top, the columns are strided and sent
+  // through index lists, the rows are contiguous and sent as runs
+  std::vector<IndexType> pack_lists[4];
+  std::vector<IndexType> unpack_lists[4];
+  for (IndexType j = 1; j <= ny; ++j) {
+    pack_lists[0].push_back(idx(1, j));
+    unpack_lists[0].push_back(idx(0, j));
+    pack_lists[1].push_back(idx(nx, j));
+    unpack_lists[1].push_back(idx(nx + 1, j));
+  }
+  for (IndexType i = 1; i <= nx; ++i) {
+    pack_lists[2].push_back(idx(i, 1));
+    unpack_lists[2].push_back(idx(i, 0));
+    pack_lists[3].push_back(idx(i, ny));
+    unpack_lists[3].push_back(idx(i, ny + 1));
+  }
+  const int opposite[4] = {1, 0, 3, 2};
+
+  std::vector<double*> vars(num_vars);
+  double* host_var = host_res.allocate<double>(N);
+
+  HaloExchanger_type halo(res, Allocator{});
+
+  for (int v = 0; v < num_vars; ++v) {
+    for (IndexType k = 0; k < N; ++k) {
+      host_var[k] = -1.0;
+    }
+    for (IndexType j = 1; j <= ny; ++j) {
+      for (IndexType i = 1; i <= nx; ++i) {
+        host_var[idx(i, j)] = 1000.0 * v + idx(i, j);
+      }
+    }
+    vars[v] = working_res.allocate<double>(N);
+    res.memcpy(vars[v], host_var, sizeof(double) * N);
+
+    ASSERT_EQ(halo.add_variable(vars[v]), v);
+  }
+  res.wait();
+
+  for (int n = 0; n < 4; ++n) {
+    ASSERT_EQ(halo.add_neighbor(pack_lists[n], unpack_lists[n]), n);
+  }
+
+  ASSERT_EQ(halo.num_neighbors(), size_t(4));
+  ASSERT_EQ(halo.num_variables(), size_t(num_vars));
+
+  // run twice to check the loops and buffers are reused
+  for (int rep = 0; rep < 2; ++rep) {
+
+    halo.pack(res);
+
+    // stands in for the messages sent and received through MPI
+    for (int n = 0; n < 4; ++n) {
+      ASSERT_EQ(halo.send_size(n), num_vars * pack_lists[n].size());
+      ASSERT_EQ(halo.recv_size(n), halo.send_size(opposite[n]));
+      res.memcpy(halo.recv_buffer(n), halo.send_buffer(opposite[n]),
+                 sizeof(double) * halo.recv_size(n));
+    }
+
+    halo.unpack(res);
+    res.wait();
+
+    for (int v = 0; v < num_vars; ++v) {
+      res.memcpy(host_var, vars[v], sizeof(double) * N);
+      res.wait();
+
+      auto val = [&](IndexType i, IndexType j) { return 1000.0 * v + idx(i, j); };
+
+      for (IndexType j = 1; j <= ny; ++j) {
+        ASSERT_EQ(host_var[idx(0, j)], val(nx, j));
+        ASSERT_EQ(host_var[idx(nx + 1, j)], val(1, j));
+      }
+      for (IndexType i = 1; i <= nx; ++i) {
+        ASSERT_EQ(host_var[idx(i, 0)], val(i, ny));
+        ASSERT_EQ(host_var[idx(i, ny + 1)], val(i, 1));
+      }
+      ASSERT_EQ(host_var[idx(0, 0)], -1.0);
+      ASSERT_EQ(host_var[idx(nx + 1, ny + 1)], -1.0);
+    }
+  }
+
+  for (int v = 0; v < num_vars; ++v) {
+    working_res.deallocate(vars[v]);
+  }
+  host_res.deallocate(host_var);
+}
+};
+
+
+template <typename T>
+class WorkGroupBasicHaloExchangerPeriodicFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupBasicHaloExchangerPeriodicFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupBasicHaloExchangerPeriodicFunctionalTest, BasicWorkGroupHaloExchangerPeriodic)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using StoragePolicy = typename camp::at<TypeParam, camp::num<2>>::type;
+  using DispatchTyper = typename camp::at<TypeParam, camp::num<3>>::type;
+  using IndexType = typename camp::at<TypeParam, camp::num<4>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<5>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<6>>::type;
+
+  testWorkGroupHaloExchangerPeriodic< ExecPolicy, OrderPolicy, StoragePolicy, DispatchTyper, IndexType, Allocator, WORKING_RESOURCE >{}(IndexType(40), IndexType(7), 1);
+  testWorkGroupHaloExchangerPeriodic< ExecPolicy, OrderPolicy, StoragePolicy, DispatchTyper, IndexType, Allocator, WORKING_RESOURCE >{}(IndexType(64), IndexType(33), 3);
+}
+
+#endif  //__TEST_WORKGROUP_HALOEXCHANGER_PERIODIC__
@@ -402,6 +402,47 @@ void operator()(
 { }
 };
 
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKING_RES
+          >
+struct testWorkGroupOrderedMultiple<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                    RAJA::unordered_hip_loop_x_block_balanced,
+                                    StoragePolicy,
+                                    detail::indirect_function_call_dispatch_typer,
+                                    IndexType,
+                                    Allocator,
+                                    WORKING_RES> {
+void operator()(
+    std::mt19937&, IndexType, IndexType,
+    IndexType, IndexType, IndexType,
+    IndexType, IndexType) const
+{ }
+};
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKING_RES
+          >
+struct testWorkGroupOrderedMultiple<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                    RAJA::unordered_hip_loop_x_block_balanced,
+                                    StoragePolicy,
+                                    detail::indirect_virtual_function_dispatch_typer,
+                                    IndexType,
+                                    Allocator,
+                                    WORKING_RES> {
+void operator()(
+    std::mt19937&, IndexType, IndexType,
+    IndexType, IndexType, IndexType,
+    IndexType, IndexType) const
+{ }
+};
+
 #endif
 
 
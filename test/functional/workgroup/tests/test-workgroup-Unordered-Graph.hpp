@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA workgroup unordered graph replays.
+///
+
+#ifndef __TEST_WORKGROUP_UNORDERED_GRAPH__
+#define __TEST_WORKGROUP_UNORDERED_GRAPH__
+
+#include "RAJA_test-workgroup.hpp"
+#include "RAJA_test-forall-data.hpp"
+
+#include <random>
+
+
+template <typename ExecPolicy,
+          typename OrderPolicy,
+          typename StoragePolicy,
+          typename DispatchTyper,
+          typename IndexType,
+          typename Allocator,
+          typename WORKING_RES
+          >
+struct testWorkGroupUnorderedGraph {
+void operator()(IndexType begin, IndexType end, IndexType num_replays) const
+{
+
+  ASSERT_GE(begin, (IndexType)0);
+  ASSERT_GE(end, begin);
+  IndexType N = end + begin;
+
+  // graph capture requires a stream other than the legacy default stream
+  WORKING_RES res{};
+  camp::resources::Resource working_res{res};
+
+  IndexType* working_array;
+  IndexType* check_array;
+  IndexType* test_array;
+
+  allocateForallTestData<IndexType>(N,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  IndexType const test_val(5);
+
+  using range_segment = RAJA::TypedRangeSegment<IndexType>;
+
+  auto callable = [=] RAJA_HOST_DEVICE (IndexType i) {
+        working_array[i] += i + test_val;
+      };
+
+  using DispatchPolicy = typename DispatchTyper::template type<
+      camp::list<range_segment, decltype(callable)> >;
+
+  using WorkPool_type = RAJA::WorkPool<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy, DispatchPolicy>,
+                  IndexType,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  using WorkGroup_type = RAJA::WorkGroup<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy, DispatchPolicy>,
+                  IndexType,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  using WorkSite_type = RAJA::WorkSite<
+                  RAJA::WorkGroupPolicy<ExecPolicy, OrderPolicy, StoragePolicy, DispatchPolicy>,
+                  IndexType,
+                  RAJA::xargs<>,
+                  Allocator
+                >;
+
+  using resource_type = typename WorkSite_type::resource_type;
+  static_assert(std::is_same<WORKING_RES, resource_type>::value,
+                "Expected same resource types");
+
+  {
+    for (IndexType i = IndexType(0); i < N; i++) {
+      test_array[i] = IndexType(0);
+    }
+
+    res.memcpy(working_array, test_array, sizeof(IndexType) * N);
+    res.wait();
+  }
+
+  WorkPool_type pool(Allocator{});
+
+  {
+    pool.enqueue(range_segment{ begin, end }, callable);
+  }
+
+  WorkGroup_type group = pool.instantiate();
+
+  // capturing does not execute the loops
+  WorkSite_type site = group.instantiate_graph(res);
+
+  for (IndexType r = IndexType(0); r < num_replays; ++r) {
+    site.replay();
+  }
+
+  auto e = site.get_resource().get_event();
+  e.wait();
+
+  {
+    for (IndexType i = begin; i < end; ++i) {
+      test_array[ i ] = num_replays * (i + test_val);
+    }
+
+    res.memcpy(check_array, working_array, sizeof(IndexType) * N);
+    res.wait();
+
+    for (IndexType i = IndexType(0); i < N; i++) {
+      ASSERT_EQ(test_array[i], check_array[i]);
+    }
+  }
+
+
+  deallocateForallTestData<IndexType>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+};
+
+
+template <typename T>
+class WorkGroupBasicUnorderedGraphFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(WorkGroupBasicUnorderedGraphFunctionalTest);
+
+
+TYPED_TEST_P(WorkGroupBasicUnorderedGraphFunctionalTest, BasicWorkGroupUnorderedGraph)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OrderPolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+  using StoragePolicy = typename camp::at<TypeParam, camp::num<2>>::type;
+  using DispatchTyper = typename camp::at<TypeParam, camp::num<3>>::type;
+  using IndexType = typename camp::at<TypeParam, camp::num<4>>::type;
+  using Allocator = typename camp::at<TypeParam, camp::num<5>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<6>>::type;
+
+  std::mt19937 rng(std::random_device{}());
+  using dist_type = std::uniform_int_distribution<IndexType>;
+
+  IndexType b1 = dist_type(IndexType(0), IndexType(15))(rng);
+  IndexType e1 = dist_type(b1, IndexType(16))(rng);
+
+  IndexType b2 = dist_type(e1, IndexType(1023))(rng);
+  IndexType e2 = dist_type(b2, IndexType(1024))(rng);
+
+  testWorkGroupUnorderedGraph< ExecPolicy, OrderPolicy, StoragePolicy, DispatchTyper, IndexType, Allocator, WORKING_RESOURCE >{}(b1, e1, IndexType(1));
+  testWorkGroupUnorderedGraph< ExecPolicy, OrderPolicy, StoragePolicy, DispatchTyper, IndexType, Allocator, WORKING_RESOURCE >{}(b2, e2, IndexType(3));
+}
+
+#endif  //__TEST_WORKGROUP_UNORDERED_GRAPH__
@@ -170,6 +170,43 @@ void operator()(
 { }
 };
 
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKING_RES
+          >
+struct testWorkGroupUnorderedSingle<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                    RAJA::unordered_hip_loop_x_block_balanced,
+                                    StoragePolicy,
+                                    detail::indirect_function_call_dispatch_typer,
+                                    IndexType,
+                                    Allocator,
+                                    WORKING_RES> {
+void operator()(
+    IndexType, IndexType) const
+{ }
+};
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKING_RES
+          >
+struct testWorkGroupUnorderedSingle<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                    RAJA::unordered_hip_loop_x_block_balanced,
+                                    StoragePolicy,
+                                    detail::indirect_virtual_function_dispatch_typer,
+                                    IndexType,
+                                    Allocator,
+                                    WORKING_RES> {
+void operator()(
+    IndexType, IndexType) const
+{ }
+};
+
 #endif
 
 
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for RAJA WorkQueue, whose items push more
+/// items of another type.
+///
+
+#ifndef __TEST_WORKGROUP_WORKQUEUE__
+#define __TEST_WORKGROUP_WORKQUEUE__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-platform.hpp"
+
+using SequentialWorkQueuePolicyList = camp::list<RAJA::seq_exec>;
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaWorkQueuePolicyList = camp::list<RAJA::cuda_exec<128>,
+                                           RAJA::cuda_exec_async<256>>;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipWorkQueuePolicyList = camp::list<RAJA::hip_exec<128>,
+                                          RAJA::hip_exec_async<256>>;
+#endif
+
+// counts the leaves reached by the splits
+struct WorkQueueTestLeaf {
+  int* count;
+
+  template <typename Context>
+  RAJA_HOST_DEVICE void operator()(Context const& ctx) const
+  {
+    if (ctx.thread() == 0) {
+      RAJA::atomicAdd<RAJA::auto_atomic>(count, 1);
+    }
+  }
+};
+
+// pushes two splits until depth is zero, then a leaf
+struct WorkQueueTestSplit {
+  int depth;
+  int* count;
+
+  template <typename Context>
+  RAJA_HOST_DEVICE void operator()(Context const& ctx) const
+  {
+    if (ctx.thread() != 0) {
+      return;
+    }
+    if (depth > 0) {
+      ctx.push(WorkQueueTestSplit{depth - 1, count});
+      ctx.push(WorkQueueTestSplit{depth - 1, count});
+    } else {
+      ctx.push(WorkQueueTestLeaf{count});
+    }
+  }
+};
+
+template <typename ExecPolicy, typename WORKING_RES>
+void testWorkQueueSplit(int num_roots, int depth)
+{
+  WORKING_RES res = WORKING_RES::get_default();
+  camp::resources::Resource working_res{res};
+
+  int* count = working_res.allocate<int>(1);
+  working_res.memset(count, 0, sizeof(int));
+
+  const int num_leaves = num_roots * (1 << depth);
+  const size_t capacity =
+      static_cast<size_t>(num_roots * ((1 << (depth + 1)) - 1) + num_leaves);
+
+  RAJA::expt::WorkQueue<ExecPolicy, WorkQueueTestSplit, WorkQueueTestLeaf>
+      queue(capacity);
+
+  // run twice to check the queue is reset by each run
+  for (int r = 0; r < 2; ++r) {
+    for (int i = 0; i < num_roots; ++i) {
+      queue.enqueue(WorkQueueTestSplit{depth, count});
+    }
+    ASSERT_EQ(queue.size(), static_cast<size_t>(num_roots));
+
+    queue.run(res).wait();
+
+    ASSERT_EQ(queue.size(), static_cast<size_t>(0));
+  }
+
+  int check = 0;
+  working_res.memcpy(&check, count, sizeof(int));
+  working_res.wait();
+
+  ASSERT_EQ(check, 2 * num_leaves);
+
+  working_res.deallocate(count);
+}
+
+
+TYPED_TEST_SUITE_P(WorkQueueFunctionalTest);
+template <typename T>
+class WorkQueueFunctionalTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(WorkQueueFunctionalTest, WorkQueueSplit)
+{
+  using ExecPolicy  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  testWorkQueueSplit<ExecPolicy, WORKING_RES>(1, 0);
+  testWorkQueueSplit<ExecPolicy, WORKING_RES>(3, 4);
+  testWorkQueueSplit<ExecPolicy, WORKING_RES>(64, 8);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(WorkQueueFunctionalTest,
+                            WorkQueueSplit);
+
+#endif  //__TEST_WORKGROUP_WORKQUEUE__
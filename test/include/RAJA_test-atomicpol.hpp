@@ -83,6 +83,9 @@ using CudaAtomicPols =
               RAJA::cuda_atomic_explicit<RAJA::omp_atomic>,
 #endif
 #endif
+              RAJA::cuda_atomic_aggregated,
+              RAJA::cuda_atomic_device,
+              RAJA::cuda_atomic_system,
               RAJA::cuda_atomic
             >;
 #endif  // RAJA_ENABLE_CUDA
@@ -99,6 +102,9 @@ using HipAtomicPols =
                RAJA::hip_atomic_explicit<RAJA::omp_atomic>,
 #endif
 #endif
+               RAJA::hip_atomic_aggregated,
+               RAJA::hip_atomic_device,
+               RAJA::hip_atomic_system,
                RAJA::hip_atomic
             >;
 #endif  // RAJA_ENABLE_HIP
@@ -115,6 +121,8 @@ using SyclAtomicPols =
                RAJA::sycl_atomic_explicit<RAJA::omp_atomic>,
 #endif
 #endif
+               RAJA::sycl_atomic_device,
+               RAJA::sycl_atomic_system,
                RAJA::sycl_atomic
             >;
 #endif  // RAJA_ENABLE_SYCL
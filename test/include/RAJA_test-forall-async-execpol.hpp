@@ -47,7 +47,8 @@ using OpenMPTargetAsyncForallAtomicExecPols = OpenMPTargetForallAtomicExecPols;
 #if defined(RAJA_ENABLE_CUDA)
 using CudaAsyncForallExecPols = camp::list< RAJA::cuda_exec<128, true>,
                                        RAJA::cuda_exec<256, true>,
-                                       RAJA::cuda_exec_explicit<256,2, true> >;
+                                       RAJA::cuda_exec_explicit<256,2, true>,
+                                       RAJA::cuda_exec_occ<256, true> >;
 
 using CudaAsyncForallReduceExecPols = CudaForallExecPols;
 
@@ -57,7 +58,8 @@ using CudaAsyncForallAtomicExecPols = CudaForallExecPols;
 
 #if defined(RAJA_ENABLE_HIP)
 using HipAsyncForallExecPols = camp::list< RAJA::hip_exec<128, true>,
-                                      RAJA::hip_exec<256, true>  >;
+                                      RAJA::hip_exec<256, true>,
+                                      RAJA::hip_exec_occ<256, true>  >;
 
 using HipAsyncForallReduceExecPols = HipForallExecPols;
 
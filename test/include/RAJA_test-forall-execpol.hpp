@@ -38,7 +38,11 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_taskloop_exec< >
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
+              , RAJA::omp_taskloop_exec<16>
+
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
 
@@ -102,7 +106,8 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_static< 2 >,
                                       RAJA::tbb_for_static< 4 >,
                                       RAJA::tbb_for_static< 8 >,
-                                      RAJA::tbb_for_dynamic >;
+                                      RAJA::tbb_for_dynamic,
+                                      RAJA::tbb_for_affinity< 4 > >;
 
 using TBBForallReduceExecPols = TBBForallExecPols;
 
@@ -124,22 +129,34 @@ using OpenMPTargetForallAtomicExecPols = OpenMPTargetForallExecPols;
 #if defined(RAJA_ENABLE_CUDA)
 using CudaForallExecPols = camp::list< RAJA::cuda_exec<128>,
                                        RAJA::cuda_exec<256>,
-                                       RAJA::cuda_exec_explicit<256,2> >;
+                                       RAJA::cuda_exec_explicit<256,2>,
+                                       RAJA::cuda_exec_occ<256>,
+                                       RAJA::cuda_exec_rt<1024>,
+                                       RAJA::cuda_exec_ilp<256, 4> >;
 
 using CudaForallReduceExecPols = CudaForallExecPols;
 
 using CudaForallAtomicExecPols = CudaForallExecPols;
 
+using CudaForallMultiDeviceExecPols =
+  camp::list< RAJA::multi_device_exec<RAJA::cuda_exec<256>>,
+              RAJA::multi_device_exec<RAJA::cuda_exec_async<128>> >;
+
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
 using HipForallExecPols = camp::list< RAJA::hip_exec<128>,
-                                      RAJA::hip_exec<256>  >;
+                                      RAJA::hip_exec<256>,
+                                      RAJA::hip_exec_occ<256>  >;
 
 using HipForallReduceExecPols = HipForallExecPols;
 
 using HipForallAtomicExecPols = HipForallExecPols;
 
+using HipForallMultiDeviceExecPols =
+  camp::list< RAJA::multi_device_exec<RAJA::hip_exec<256>>,
+              RAJA::multi_device_exec<RAJA::hip_exec_async<128>> >;
+
 #endif
 
 #if defined(RAJA_ENABLE_SYCL)
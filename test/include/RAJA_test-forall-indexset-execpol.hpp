@@ -81,7 +81,10 @@ using OpenMPTargetForallIndexSetReduceExecPols =
 #if defined(RAJA_ENABLE_CUDA)
 using CudaForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec<128>>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec<256>> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec<256>>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec_occ<256>>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec_rt<1024>>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::cuda_exec_ilp<256, 4>> >;
 
 using CudaForallIndexSetReduceExecPols = CudaForallIndexSetExecPols;
 #endif
@@ -89,7 +92,8 @@ using CudaForallIndexSetReduceExecPols = CudaForallIndexSetExecPols;
 #if defined(RAJA_ENABLE_HIP)
 using HipForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec<128>>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec<256>> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec<256>>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::hip_exec_occ<256>> >;
 
 using HipForallIndexSetReduceExecPols = HipForallIndexSetExecPols;
 #endif
@@ -31,11 +31,13 @@ struct DEVICE_DEPTH_1_REDUCESUM_WARP {};
 struct DEVICE_DEPTH_1_REDUCESUM_WARPDIRECT_TILE {};
 struct DEVICE_DEPTH_1_REDUCESUM_WARPREDUCE {};
 struct DEVICE_DEPTH_2 {};
+struct DEVICE_DEPTH_2_COLLAPSE {};
 struct DEVICE_DEPTH_2_REDUCESUM_WARP {};
 struct DEVICE_DEPTH_2_REDUCESUM_WARPMASK {};
 struct DEVICE_DEPTH_2_REDUCESUM_WARPMASK_FORI {};
 struct DEVICE_DEPTH_2_REDUCESUM_WARPREDUCE {};
 struct DEVICE_DEPTH_3 {};
+struct DEVICE_DEPTH_3_COLLAPSE {};
 struct DEVICE_DEPTH_3_REDUCESUM {};
 struct DEVICE_DEPTH_3_REDUCESUM_SEQ_INNER {};
 struct DEVICE_DEPTH_3_REDUCESUM_SEQ_OUTER {};
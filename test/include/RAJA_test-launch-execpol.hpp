@@ -25,6 +25,8 @@ using Sequential_launch_policies = camp::list<
   seq_policies
   >;
 
+using Sequential_cooperative_launch_policies = Sequential_launch_policies;
+
 #if defined(RAJA_ENABLE_OPENMP)
 using omp_policies = camp::list<
          RAJA::LaunchPolicy<RAJA::omp_launch_t>,
@@ -35,6 +37,8 @@ using OpenMP_launch_policies = camp::list<
   omp_policies
   >;
 
+using OpenMP_cooperative_launch_policies = OpenMP_launch_policies;
+
 #endif  // RAJA_ENABLE_OPENMP
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -51,6 +55,12 @@ using Cuda_launch_policies = camp::list<
         cuda_policies,
         cuda_explicit_policies
          >;
+
+using Cuda_cooperative_launch_policies = camp::list<
+  camp::list<
+    RAJA::LaunchPolicy<RAJA::cuda_launch_cooperative_t<false>>,
+    RAJA::LoopPolicy<RAJA::cuda_global_thread_x>>
+  >;
 #endif  // RAJA_ENABLE_CUDA
 
 #if defined(RAJA_ENABLE_HIP)
@@ -62,7 +72,25 @@ using hip_policies = camp::list<
 using Hip_launch_policies = camp::list<
       hip_policies
        >;
+
+using Hip_cooperative_launch_policies = camp::list<
+  camp::list<
+    RAJA::LaunchPolicy<RAJA::hip_launch_cooperative_t<false>>,
+    RAJA::LoopPolicy<RAJA::hip_global_thread_x>>
+  >;
 #endif // RAJA_ENABLE_HIP
 
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+// the teams stride over the segment, so each index runs once in the launch
+using omp_target_policies = camp::list<
+  RAJA::LaunchPolicy<RAJA::omp_target_launch_t>,
+  RAJA::LoopPolicy<RAJA::omp_target_team_loop>>;
+
+using OpenMPTarget_launch_policies = camp::list<
+      omp_target_policies
+       >;
+#endif // RAJA_ENABLE_TARGET_OPENMP
+
 
 #endif  // __RAJA_test_launch_execpol_HPP__
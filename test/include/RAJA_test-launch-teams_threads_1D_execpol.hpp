@@ -73,5 +73,18 @@ using Hip_launch_policies = camp::list<
        >;
 #endif // RAJA_ENABLE_HIP
 
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+using omp_target_policies = camp::list<
+  RAJA::LaunchPolicy<RAJA::omp_target_launch_t>,
+  RAJA::LoopPolicy<RAJA::omp_target_team_loop>,
+  RAJA::LoopPolicy<RAJA::omp_target_thread_loop>
+  >;
+
+using OpenMPTarget_launch_policies = camp::list<
+      omp_target_policies
+       >;
+#endif // RAJA_ENABLE_TARGET_OPENMP
+
 
 #endif  // __RAJA_test_launch_teams_threads_1D_execpol_HPP__
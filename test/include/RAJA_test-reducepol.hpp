@@ -34,11 +34,13 @@ using TBBReducePols = camp::list< RAJA::tbb_reduce >;
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetReducePols =
-  camp::list< RAJA::omp_target_reduce >;
+  camp::list< RAJA::omp_target_reduce,
+              RAJA::omp_target_reduce_device >;
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
-using CudaReducePols = camp::list< RAJA::cuda_reduce >;
+using CudaReducePols = camp::list< RAJA::cuda_reduce,
+                                   RAJA::cuda_reduce_auto >;
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
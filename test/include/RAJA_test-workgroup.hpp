@@ -340,7 +340,8 @@ using SequentialStoragePolicyList =
     camp::list<
                 RAJA::array_of_pointers,
                 RAJA::ragged_array_of_objects,
-                RAJA::constant_stride_array_of_objects
+                RAJA::constant_stride_array_of_objects,
+                RAJA::persistent_ragged_array_of_objects
               >;
 
 #if defined(RAJA_ENABLE_TBB)
@@ -349,7 +350,12 @@ using TBBExecPolicyList =
                 RAJA::tbb_work
               >;
 using TBBOrderedPolicyList = SequentialOrderedPolicyList;
-using TBBOrderPolicyList   = SequentialOrderPolicyList;
+using TBBOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_tbb_task_group
+              >;
 using TBBStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
@@ -359,7 +365,12 @@ using OpenMPExecPolicyList =
                 RAJA::omp_work
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_for_nowait
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
@@ -389,7 +400,8 @@ using CudaOrderPolicyList   =
     camp::list<
                 RAJA::ordered,
                 RAJA::reverse_ordered,
-                RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average
+                RAJA::unordered_cuda_loop_y_block_iter_x_threadblock_average,
+                RAJA::unordered_cuda_loop_x_block_balanced
               >;
 using CudaStoragePolicyList = SequentialStoragePolicyList;
 #endif
@@ -408,10 +420,26 @@ using HipOrderPolicyList   =
                 RAJA::ordered,
                 RAJA::reverse_ordered
               , RAJA::unordered_hip_loop_y_block_iter_x_threadblock_average
+              , RAJA::unordered_hip_loop_x_block_balanced
               >;
 using HipStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclExecPolicyList =
+    camp::list<
+                RAJA::sycl_work<256>
+              >;
+using SyclOrderedPolicyList = SequentialOrderedPolicyList;
+using SyclOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_sycl_loop_y_block_iter_x_threadblock_average
+              >;
+using SyclStoragePolicyList = SequentialStoragePolicyList;
+#endif
+
 
 //
 // Dispatch policy type lists, broken up for compile time reasons
@@ -444,6 +472,10 @@ using CudaAllocatorList = camp::list<typename detail::ResourceAllocator<camp::re
 using HipAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Hip>::template std_allocator<char>>;
 #endif
 
+#if defined(RAJA_ENABLE_SYCL)
+using SyclAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Sycl>::template std_allocator<char>>;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Omp>::template std_allocator<char>>;
 #endif
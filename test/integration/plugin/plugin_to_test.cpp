@@ -54,6 +54,7 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, RAJA::Platform::undefined);
     data.launch_counter_pre++;
     data.launch_platform_active = p.platform;
+    data.launch_kind = p.kind;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
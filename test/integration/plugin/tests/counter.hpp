@@ -16,6 +16,7 @@ struct CounterData
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  RAJA::util::LaunchKind launch_kind   = RAJA::util::LaunchKind::parallel_for;
 };
 
 // note the use of a pointer here to allow different types of memory
@@ -192,6 +192,81 @@ void PluginForAllIcountIdxSetTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// test with forall given a NoPlugins parameter
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform>
+void PluginForAllNoPluginsTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  for (int i = 0; i < 10; i++) {
+
+    RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(i,i+1),
+      RAJA::expt::NoPlugins(),
+      PluginTestCallable{data}
+    );
+
+    CounterData loop_data;
+    plugin_test_resource->memcpy(&loop_data, &data[i], sizeof(CounterData));
+    ASSERT_EQ(loop_data.capture_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(loop_data.capture_counter_pre,     -1);
+    ASSERT_EQ(loop_data.capture_counter_post,    -1);
+    ASSERT_EQ(loop_data.launch_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(loop_data.launch_counter_pre,     0);
+    ASSERT_EQ(loop_data.launch_counter_post,    0);
+  }
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.capture_counter_pre,     0);
+  ASSERT_EQ(plugin_data.capture_counter_post,    0);
+  ASSERT_EQ(plugin_data.launch_counter_pre,     0);
+  ASSERT_EQ(plugin_data.launch_counter_post,    0);
+
+  plugin_test_resource->deallocate(data);
+}
+
+// test that a forall with a reducer parameter is launched as a reduction
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginForAllReduceTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  int sum = 0;
+  RAJA::forall<ExecPolicy>(
+    RAJA::RangeSegment(0, 10),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+    [=] RAJA_HOST_DEVICE (int, int& s) { s += 1; }
+  );
+  ASSERT_EQ(sum, 10);
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+  ASSERT_EQ(plugin_data.launch_counter_pre,     1);
+  ASSERT_EQ(plugin_data.launch_counter_post,    1);
+  ASSERT_EQ(plugin_data.launch_kind, RAJA::util::LaunchKind::parallel_reduce);
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(1);
+
+  RAJA::forall<ExecPolicy>(
+    RAJA::RangeSegment(0,1),
+    PluginTestCallable{data}
+  );
+
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_counter_pre,     2);
+  ASSERT_EQ(plugin_data.launch_kind, RAJA::util::LaunchKind::parallel_for);
+
+  plugin_test_resource->deallocate(data);
+}
+
 TYPED_TEST_SUITE_P(PluginForallTest);
 template <typename T>
 class PluginForallTest : public ::testing::Test
@@ -234,10 +309,30 @@ TYPED_TEST_P(PluginForallTest, PluginForAllIcountIdxSet)
   PluginForAllIcountIdxSetTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginForallTest, PluginForAllNoPlugins)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForAllNoPluginsTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
+TYPED_TEST_P(PluginForallTest, PluginForAllReduce)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForAllReduceTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginForallTest,
                             PluginForall,
                             PluginForAllICount,
                             PluginForAllIdxSet,
-                            PluginForAllIcountIdxSet);
+                            PluginForAllIcountIdxSet,
+                            PluginForAllNoPlugins,
+                            PluginForAllReduce);
 
 #endif  //__TEST_PLUGIN_FORALL_HPP__
@@ -206,6 +206,45 @@ void operator()() const
 { }
 };
 
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKINGRES,
+          RAJA::Platform PLATFORM
+          >
+struct PluginWorkGroupTestImpl<RAJA::hip_work<BLOCK_SIZE, Async>,
+                               RAJA::unordered_hip_loop_x_block_balanced,
+                               StoragePolicy,
+                               detail::indirect_function_call_dispatch_typer,
+                               IndexType,
+                               Allocator,
+                               WORKINGRES,
+                               PLATFORM> {
+void operator()() const
+{ }
+};
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator,
+          typename WORKINGRES,
+          RAJA::Platform PLATFORM
+          >
+struct PluginWorkGroupTestImpl<RAJA::hip_work<BLOCK_SIZE, Async>,
+                               RAJA::unordered_hip_loop_x_block_balanced,
+                               StoragePolicy,
+                               detail::indirect_virtual_function_dispatch_typer,
+                               IndexType,
+                               Allocator,
+                               WORKINGRES,
+                               PLATFORM> {
+void operator()() const
+{ }
+};
+
 #endif
 
 
@@ -2528,6 +2528,54 @@ GPU_TEST(Kernel, Hyperplane_cuda_3d_tiled)
   cudaErrchk(cudaFree(x));
 }
 
+GPU_TEST(Kernel, Hyperplane_cuda_wavefront_2d)
+{
+  using namespace RAJA;
+
+  // more points per hyperplane than one block has threads, so the blocks
+  // have to wait for each other between hyperplanes
+  using Pol =
+      RAJA::KernelPolicy<
+        Hyperplane<0, cuda_wavefront_exec<64>, ArgList<1>,
+                   cuda_wavefront_exec<64>, Lambda<0>>>;
+
+  constexpr long N = (long)97;
+  constexpr long M = (long)301;
+
+  long *x = nullptr;
+  cudaErrchk(cudaMallocManaged(&x, N * M * sizeof(long)));
+
+  using myview = View<long, Layout<2, RAJA::Index_type>>;
+  myview xv{x, N, M};
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, M)),
+                    [=] __device__(Index_type i, Index_type j) {
+                      long left = 1;
+                      if (i > 0) {
+                        left = xv(i - 1, j);
+                      }
+
+                      long up = 1;
+                      if (j > 0) {
+                        up = xv(i, j - 1);
+                      }
+
+                      xv(i, j) = (left + up) % 1000003;
+                    });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      long left = i > 0 ? xv(i - 1, j) : 1;
+      long up = j > 0 ? xv(i, j - 1) : 1;
+      ASSERT_EQ(xv(i, j), (left + up) % 1000003);
+    }
+  }
+
+  cudaErrchk(cudaFree(x));
+}
+
+
 
 
 GPU_TEST(Kernel, CudaExec_1threadexec)
@@ -3611,6 +3659,59 @@ GPU_TEST(Kernel_gpu, Hyperplane_hip_3d_tiled)
   hipErrchk(hipFree(d_x));
 }
 
+GPU_TEST(Kernel_gpu, Hyperplane_hip_wavefront_2d)
+{
+  using namespace RAJA;
+
+  // more points per hyperplane than one block has threads, so the blocks
+  // have to wait for each other between hyperplanes
+  using Pol =
+      RAJA::KernelPolicy<
+        Hyperplane<0, hip_wavefront_exec<64>, ArgList<1>,
+                   hip_wavefront_exec<64>, Lambda<0>>>;
+
+  constexpr long N = (long)97;
+  constexpr long M = (long)301;
+
+  long *x = (long*) malloc(N*M*sizeof(long));
+  long *d_x = nullptr;
+  hipErrchk(hipMalloc(&d_x, N*M*sizeof(long)));
+
+  using myview = View<long, Layout<2, RAJA::Index_type>>;
+  myview xv{x, N, M};
+  myview d_xv{d_x, N, M};
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, M)),
+                    [=] __device__(Index_type i, Index_type j) {
+                      long left = 1;
+                      if (i > 0) {
+                        left = d_xv(i - 1, j);
+                      }
+
+                      long up = 1;
+                      if (j > 0) {
+                        up = d_xv(i, j - 1);
+                      }
+
+                      d_xv(i, j) = (left + up) % 1000003;
+                    });
+
+  hipErrchk(hipMemcpy(x, d_x, N*M*sizeof(long), hipMemcpyDeviceToHost));
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      long left = i > 0 ? xv(i - 1, j) : 1;
+      long up = j > 0 ? xv(i, j - 1) : 1;
+      ASSERT_EQ(xv(i, j), (left + up) % 1000003);
+    }
+  }
+
+  free(x);
+  hipErrchk(hipFree(d_x));
+}
+
+
 
 
 GPU_TEST(Kernel_gpu, HipExec_1threadexec)
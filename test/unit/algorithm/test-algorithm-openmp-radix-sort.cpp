@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the radix sort of the OpenMP
+/// sort and sort_pairs, used for pointer ranges of arithmetic keys with at
+/// least get_min_iterates_per_radix_sort keys and more than one thread
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+using OmpRadixPolicy = RAJA::omp_parallel_for_exec;
+
+// enough keys for the radix sort, not a multiple of the number of threads
+constexpr int radix_sort_n =
+    RAJA::impl::sort::detail::openmp::get_min_iterates_per_radix_sort() + 123;
+
+// the radix sort is only used with more than one thread
+inline void use_radix_sort_threads()
+{
+  if (omp_get_max_threads() < 4) {
+    omp_set_num_threads(4);
+  }
+}
+
+// random keys spread over all digits
+template <typename T>
+std::vector<T> random_keys(int n)
+{
+  std::mt19937 gen(12345);
+  std::vector<T> keys(n);
+  std::uniform_int_distribution<int> dist(-1000000, 1000000);
+  for (T& key : keys) {
+    key = static_cast<T>(dist(gen));
+    if (std::is_floating_point<T>::value) {
+      key /= T(7);
+    }
+  }
+  return keys;
+}
+
+// keys where all but one digit is the same in every key, so the radix sort
+// skips every other pass, with -0.0 and 0.0 among floating point keys
+template <typename T>
+std::vector<T> shared_digit_keys(int n)
+{
+  std::mt19937 gen(54321);
+  std::vector<T> keys(n);
+  std::uniform_int_distribution<int> dist(0, 255);
+  for (int i = 0; i < n; ++i) {
+    if (std::is_floating_point<T>::value) {
+      // small whole numbers leave the low mantissa digits zero
+      const int v = dist(gen) - 128;
+      keys[i] = (v == 0 && i % 2 == 0) ? -T(0) : static_cast<T>(v);
+    } else {
+      keys[i] = static_cast<T>(0x5a0000 | (dist(gen) << 8) | 0x3c);
+    }
+  }
+  return keys;
+}
+
+template <typename T, typename Compare>
+void check_sort(std::vector<T> keys, Compare comp, bool stable)
+{
+  std::vector<T> expected = keys;
+  std::stable_sort(expected.begin(), expected.end(), comp);
+
+  if (stable) {
+    RAJA::stable_sort<OmpRadixPolicy>(RAJA::make_span(keys.data(), keys.size()),
+                                      comp);
+  } else {
+    RAJA::sort<OmpRadixPolicy>(RAJA::make_span(keys.data(), keys.size()),
+                               comp);
+  }
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ASSERT_EQ(expected[i], keys[i]) << "at " << i;
+  }
+}
+
+template <typename T, typename Compare>
+void check_sort_pairs(std::vector<T> keys, Compare comp, bool stable)
+{
+  const std::vector<T> orig = keys;
+  const int n = static_cast<int>(keys.size());
+
+  std::vector<int> vals(n);
+  std::iota(vals.begin(), vals.end(), 0);
+
+  std::vector<int> expected_vals = vals;
+  std::stable_sort(expected_vals.begin(), expected_vals.end(),
+                   [&](int a, int b) { return comp(orig[a], orig[b]); });
+
+  if (stable) {
+    RAJA::stable_sort_pairs<OmpRadixPolicy>(
+        RAJA::make_span(keys.data(), n), RAJA::make_span(vals.data(), n), comp);
+  } else {
+    RAJA::sort_pairs<OmpRadixPolicy>(
+        RAJA::make_span(keys.data(), n), RAJA::make_span(vals.data(), n), comp);
+  }
+
+  std::vector<bool> seen(n, false);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(orig[expected_vals[i]], keys[i]) << "at " << i;
+    ASSERT_GE(vals[i], 0);
+    ASSERT_LT(vals[i], n);
+    ASSERT_FALSE(seen[vals[i]]);
+    seen[vals[i]] = true;
+    // each value stays with its key
+    ASSERT_EQ(orig[vals[i]], keys[i]) << "at " << i;
+    if (stable) {
+      ASSERT_EQ(expected_vals[i], vals[i]) << "at " << i;
+    }
+  }
+}
+
+template <typename T>
+class OmpRadixSortUnitTest : public ::testing::Test
+{
+};
+
+using OmpRadixSortKeyTypes = ::testing::Types<int, float, double>;
+
+TYPED_TEST_SUITE(OmpRadixSortUnitTest, OmpRadixSortKeyTypes);
+
+TYPED_TEST(OmpRadixSortUnitTest, Sort)
+{
+  using T = TypeParam;
+  use_radix_sort_threads();
+
+  for (bool stable : {false, true}) {
+    check_sort(random_keys<T>(radix_sort_n), RAJA::operators::less<T>{}, stable);
+    check_sort(random_keys<T>(radix_sort_n), RAJA::operators::greater<T>{}, stable);
+    check_sort(shared_digit_keys<T>(radix_sort_n), RAJA::operators::less<T>{}, stable);
+    check_sort(shared_digit_keys<T>(radix_sort_n), RAJA::operators::greater<T>{}, stable);
+  }
+}
+
+TYPED_TEST(OmpRadixSortUnitTest, SortPairs)
+{
+  using T = TypeParam;
+  use_radix_sort_threads();
+
+  for (bool stable : {false, true}) {
+    check_sort_pairs(random_keys<T>(radix_sort_n), RAJA::operators::less<T>{}, stable);
+    check_sort_pairs(random_keys<T>(radix_sort_n), RAJA::operators::greater<T>{}, stable);
+    check_sort_pairs(shared_digit_keys<T>(radix_sort_n), RAJA::operators::less<T>{}, stable);
+    check_sort_pairs(shared_digit_keys<T>(radix_sort_n), RAJA::operators::greater<T>{}, stable);
+  }
+}
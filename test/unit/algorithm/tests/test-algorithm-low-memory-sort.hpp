@@ -0,0 +1,172 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for sorts with bounded extra memory
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_LOW_MEMORY_SORT_HPP__
+#define __TEST_UNIT_ALGORITHM_LOW_MEMORY_SORT_HPP__
+
+#include "test-algorithm-sort-utils.hpp"
+
+#include <utility>
+#include <vector>
+
+template < typename policy >
+struct PolicySortLowMemory
+  : PolicySynchronize<policy>
+{
+  using sort_interface = sort_interface_tag;
+
+  const char* name()
+  {
+    return "RAJA::sort_low_memory";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::sort_low_memory<policy>(std::forward<Args>(args)...);
+  }
+};
+
+
+// check the keys are sorted and are a permutation of the original keys
+template <typename Res, typename K, typename V, typename Compare>
+bool checkLowMemorySort(SortData<Res, sort_interface_tag, K, V>& data,
+                        RAJA::Index_type N,
+                        Compare comp)
+{
+  std::vector<K> expected(data.orig_keys, data.orig_keys + N);
+  std::sort(expected.begin(), expected.end(), comp);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    if (data.sorted_keys[i] != expected[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename K,
+          typename Sorter,
+          typename Res>
+void testLowMemorySorterInterfaces(unsigned seed, RAJA::Index_type MaxN,
+                                   size_t chunk, Sorter sorter, Res res)
+{
+  std::mt19937 rng(seed);
+  RAJA::Index_type N = std::uniform_int_distribution<RAJA::Index_type>((MaxN+1)/2, MaxN)(rng);
+  // few distinct keys so runs of equal keys cross chunk boundaries
+  std::uniform_int_distribution<RAJA::Index_type> dist(-N/4, N/4);
+
+  SortData<Res, sort_interface_tag, K> data(N, res, [&](){ return dist(rng); });
+
+  data.copy_data(N);
+  data.resource().wait();
+  sorter(res, RAJA::make_span(data.sorted_keys, N), chunk,
+         RAJA::operators::less<K>{});
+  sorter.synchronize();
+  ASSERT_TRUE(checkLowMemorySort(data, N, RAJA::operators::less<K>{}))
+      << sorter.name() << " ascending seed " << seed << " N " << N
+      << " chunk " << chunk;
+
+  data.copy_data(N);
+  data.resource().wait();
+  sorter(res, RAJA::make_span(data.sorted_keys, N), chunk,
+         RAJA::operators::greater<K>{});
+  sorter.synchronize();
+  ASSERT_TRUE(checkLowMemorySort(data, N, RAJA::operators::greater<K>{}))
+      << sorter.name() << " descending seed " << seed << " N " << N
+      << " chunk " << chunk;
+}
+
+template <typename K,
+          typename Sorter,
+          typename Res>
+void testLowMemorySorter(unsigned seed, RAJA::Index_type MaxN,
+                         Sorter sorter, Res res)
+{
+  testLowMemorySorterInterfaces<K>(seed, 0, 1, sorter, res);
+  for (RAJA::Index_type n = 1; n <= MaxN; n *= 10) {
+    // chunk 0 sorts everything at once, the others merge several chunks
+    testLowMemorySorterInterfaces<K>(seed, n, 0, sorter, res);
+    testLowMemorySorterInterfaces<K>(seed, n, n/8 + 1, sorter, res);
+    testLowMemorySorterInterfaces<K>(seed, n, n/3 + 1, sorter, res);
+    if (n <= 100) {
+      testLowMemorySorterInterfaces<K>(seed, n, 1, sorter, res);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(LowMemorySortUnitTest);
+
+template < typename T >
+class LowMemorySortUnitTest : public ::testing::Test
+{ };
+
+TYPED_TEST_P(LowMemorySortUnitTest, UnitLowMemorySort)
+{
+  using Sorter   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType  = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KeyType  = typename camp::at<TypeParam, camp::num<2>>::type;
+  using MaxNType = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  unsigned seed = get_random_seed();
+  RAJA::Index_type MaxN = MaxNType::value;
+  Sorter sorter{};
+  ResType res = ResType::get_default();
+
+  testLowMemorySorter<KeyType>(seed, MaxN, sorter, res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(LowMemorySortUnitTest, UnitLowMemorySort);
+
+
+using SequentialLowMemorySortSorters =
+  camp::list<
+              PolicySortLowMemory<RAJA::loop_exec>,
+              PolicySortLowMemory<RAJA::seq_exec>
+            >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPLowMemorySortSorters =
+  camp::list<
+              PolicySortLowMemory<RAJA::omp_parallel_for_exec>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+using TBBLowMemorySortSorters =
+  camp::list<
+              PolicySortLowMemory<RAJA::tbb_for_exec>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+
+using CudaLowMemorySortSorters =
+  camp::list<
+              PolicySortLowMemory<RAJA::cuda_exec<128>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+
+using HipLowMemorySortSorters =
+  camp::list<
+              PolicySortLowMemory<RAJA::hip_exec<128>>
+            >;
+
+#endif
+
+#endif //__TEST_UNIT_ALGORITHM_LOW_MEMORY_SORT_HPP__
@@ -0,0 +1,269 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for segmented sorts
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_SEGMENTED_SORT_HPP__
+#define __TEST_UNIT_ALGORITHM_SEGMENTED_SORT_HPP__
+
+#include "test-algorithm-sort-utils.hpp"
+
+#include <utility>
+#include <vector>
+
+template < typename policy >
+struct PolicySegmentedSort
+  : PolicySynchronize<policy>
+{
+  using sort_interface = sort_interface_tag;
+
+  const char* name()
+  {
+    return "RAJA::segmented_sort";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::segmented_sort<policy>(std::forward<Args>(args)...);
+  }
+};
+
+template < typename policy >
+struct PolicySegmentedSortPairs
+  : PolicySynchronize<policy>
+{
+  using sort_interface = sort_pairs_interface_tag;
+
+  const char* name()
+  {
+    return "RAJA::segmented_sort_pairs";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::segmented_sort_pairs<policy>(std::forward<Args>(args)...);
+  }
+};
+
+
+template <typename Res, typename K, typename V, typename Compare,
+          typename Sorter>
+void doSegmentedSort(SortData<Res, sort_interface_tag, K, V>& data,
+                     RAJA::Index_type N,
+                     RAJA::Index_type const* offsets,
+                     int num_segments,
+                     Compare comp,
+                     Sorter sorter)
+{
+  data.copy_data(N);
+  data.resource().wait();
+  sorter(RAJA::make_span(data.sorted_keys, N),
+         RAJA::make_span(offsets, num_segments+1),
+         comp);
+  sorter.synchronize();
+}
+
+template <typename Res, typename K, typename V, typename Compare,
+          typename Sorter>
+void doSegmentedSort(SortData<Res, sort_pairs_interface_tag, K, V>& data,
+                     RAJA::Index_type N,
+                     RAJA::Index_type const* offsets,
+                     int num_segments,
+                     Compare comp,
+                     Sorter sorter)
+{
+  data.copy_data(N);
+  data.resource().wait();
+  sorter(RAJA::make_span(data.sorted_keys, N),
+         RAJA::make_span(data.sorted_vals, N),
+         RAJA::make_span(offsets, num_segments+1),
+         comp);
+  sorter.synchronize();
+}
+
+// check the keys of each segment are sorted and are a permutation of the
+// original keys of that segment
+template <typename Res, typename K, typename V, typename Compare>
+bool checkSegmentedSort(SortData<Res, sort_interface_tag, K, V>& data,
+                        RAJA::Index_type const* offsets,
+                        int num_segments,
+                        Compare comp)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    std::vector<K> expected(data.orig_keys + offsets[s],
+                            data.orig_keys + offsets[s+1]);
+    std::sort(expected.begin(), expected.end(), comp);
+    for (RAJA::Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+      if (data.sorted_keys[i] != expected[i - offsets[s]]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// check the keys of each segment are sorted and the pairs of each segment
+// are a permutation of the original pairs of that segment
+template <typename Res, typename K, typename V, typename Compare>
+bool checkSegmentedSort(SortData<Res, sort_pairs_interface_tag, K, V>& data,
+                        RAJA::Index_type const* offsets,
+                        int num_segments,
+                        Compare comp)
+{
+  for (int s = 0; s < num_segments; ++s) {
+    std::vector<std::pair<K, V>> expected;
+    std::vector<std::pair<K, V>> actual;
+    for (RAJA::Index_type i = offsets[s]; i < offsets[s+1]; ++i) {
+      if (i > offsets[s] &&
+          comp(data.sorted_keys[i], data.sorted_keys[i-1])) {
+        return false;
+      }
+      expected.emplace_back(data.orig_keys[i], data.orig_vals[i]);
+      actual.emplace_back(data.sorted_keys[i], data.sorted_vals[i]);
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    if (expected != actual) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename K,
+          typename Sorter,
+          typename Res>
+void testSegmentedSorterInterfaces(unsigned seed, RAJA::Index_type MaxN,
+                                   Sorter sorter, Res res)
+{
+  using pairs_category = typename Sorter::sort_interface;
+
+  std::mt19937 rng(seed);
+  RAJA::Index_type N = std::uniform_int_distribution<RAJA::Index_type>((MaxN+1)/2, MaxN)(rng);
+  std::uniform_int_distribution<RAJA::Index_type> dist(-N, N);
+
+  SortData<Res, pairs_category, K> data(N, res, [&](){ return dist(rng); });
+
+  // random segment lengths from 0 to 32, including empty segments
+  std::uniform_int_distribution<RAJA::Index_type> seg_dist(0, 32);
+  std::vector<RAJA::Index_type> host_offsets{0};
+  while (host_offsets.back() < N) {
+    host_offsets.push_back(std::min(N, host_offsets.back() + seg_dist(rng)));
+  }
+  int num_segments = static_cast<int>(host_offsets.size()) - 1;
+
+  RAJA::Index_type* offsets = res.template allocate<RAJA::Index_type>(
+      num_segments+1, camp::resources::MemoryAccess::Managed);
+  res.memcpy(offsets, host_offsets.data(),
+             (num_segments+1)*sizeof(RAJA::Index_type));
+  res.wait();
+
+  doSegmentedSort(data, N, offsets, num_segments,
+                  RAJA::operators::less<K>{}, sorter);
+  ASSERT_TRUE(checkSegmentedSort(data, host_offsets.data(), num_segments,
+                                 RAJA::operators::less<K>{}))
+      << sorter.name() << " ascending seed " << seed << " N " << N;
+
+  doSegmentedSort(data, N, offsets, num_segments,
+                  RAJA::operators::greater<K>{}, sorter);
+  ASSERT_TRUE(checkSegmentedSort(data, host_offsets.data(), num_segments,
+                                 RAJA::operators::greater<K>{}))
+      << sorter.name() << " descending seed " << seed << " N " << N;
+
+  res.deallocate(offsets, camp::resources::MemoryAccess::Managed);
+}
+
+template <typename K,
+          typename Sorter,
+          typename Res>
+void testSegmentedSorter(unsigned seed, RAJA::Index_type MaxN,
+                         Sorter sorter, Res res)
+{
+  testSegmentedSorterInterfaces<K>(seed, 0, sorter, res);
+  for (RAJA::Index_type n = 1; n <= MaxN; n *= 10) {
+    testSegmentedSorterInterfaces<K>(seed, n, sorter, res);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(SegmentedSortUnitTest);
+
+template < typename T >
+class SegmentedSortUnitTest : public ::testing::Test
+{ };
+
+TYPED_TEST_P(SegmentedSortUnitTest, UnitSegmentedSort)
+{
+  using Sorter   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType  = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KeyType  = typename camp::at<TypeParam, camp::num<2>>::type;
+  using MaxNType = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  unsigned seed = get_random_seed();
+  RAJA::Index_type MaxN = MaxNType::value;
+  Sorter sorter{};
+  ResType res = ResType::get_default();
+
+  testSegmentedSorter<KeyType>(seed, MaxN, sorter, res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedSortUnitTest, UnitSegmentedSort);
+
+
+using SequentialSegmentedSortSorters =
+  camp::list<
+              PolicySegmentedSort<RAJA::loop_exec>,
+              PolicySegmentedSortPairs<RAJA::loop_exec>,
+              PolicySegmentedSort<RAJA::seq_exec>,
+              PolicySegmentedSortPairs<RAJA::seq_exec>
+            >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPSegmentedSortSorters =
+  camp::list<
+              PolicySegmentedSort<RAJA::omp_parallel_for_exec>,
+              PolicySegmentedSortPairs<RAJA::omp_parallel_for_exec>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+using TBBSegmentedSortSorters =
+  camp::list<
+              PolicySegmentedSort<RAJA::tbb_for_exec>,
+              PolicySegmentedSortPairs<RAJA::tbb_for_exec>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+
+using CudaSegmentedSortSorters =
+  camp::list<
+              PolicySegmentedSort<RAJA::cuda_exec<128>>,
+              PolicySegmentedSortPairs<RAJA::cuda_exec<128>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+
+using HipSegmentedSortSorters =
+  camp::list<
+              PolicySegmentedSort<RAJA::hip_exec<128>>,
+              PolicySegmentedSortPairs<RAJA::hip_exec<128>>
+            >;
+
+#endif
+
+#endif //__TEST_UNIT_ALGORITHM_SEGMENTED_SORT_HPP__
@@ -84,6 +84,77 @@ struct PolicySynchronize<RAJA::hip_exec<BLOCK_SIZE, Async>>
 #endif
 
 
+// comparator that sorts can not recognize as a RAJA operator, used to test
+// the general comparator paths of back-ends that special case RAJA operators
+template < typename Compare >
+struct CustomCompare
+{
+  Compare comp;
+
+  template < typename T >
+  RAJA_HOST_DEVICE bool operator()(T const& lhs, T const& rhs) const
+  {
+    return comp(lhs, rhs);
+  }
+};
+
+// sorter adapter that replaces RAJA comparison operators by CustomCompare
+template < typename Sorter >
+struct CustomCompareSorter
+  : Sorter
+{
+  using supports_resource = std::false_type;
+
+  std::string m_name;
+
+  CustomCompareSorter()
+    : m_name(std::string(Sorter{}.name()) + std::string("[custom compare]"))
+  { }
+
+  const char* name()
+  {
+    return m_name.c_str();
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    Sorter::operator()(std::forward<Args>(args)...);
+  }
+
+  template < typename Container, typename T >
+  void operator()(Container&& c, RAJA::operators::less<T> comp)
+  {
+    Sorter::operator()(std::forward<Container>(c),
+                       CustomCompare<RAJA::operators::less<T>>{comp});
+  }
+
+  template < typename Container, typename T >
+  void operator()(Container&& c, RAJA::operators::greater<T> comp)
+  {
+    Sorter::operator()(std::forward<Container>(c),
+                       CustomCompare<RAJA::operators::greater<T>>{comp});
+  }
+
+  template < typename KeyContainer, typename ValContainer, typename T >
+  void operator()(KeyContainer&& keys, ValContainer&& vals,
+                  RAJA::operators::less<T> comp)
+  {
+    Sorter::operator()(std::forward<KeyContainer>(keys),
+                       std::forward<ValContainer>(vals),
+                       CustomCompare<RAJA::operators::less<T>>{comp});
+  }
+
+  template < typename KeyContainer, typename ValContainer, typename T >
+  void operator()(KeyContainer&& keys, ValContainer&& vals,
+                  RAJA::operators::greater<T> comp)
+  {
+    Sorter::operator()(std::forward<KeyContainer>(keys),
+                       std::forward<ValContainer>(vals),
+                       CustomCompare<RAJA::operators::greater<T>>{comp});
+  }
+};
+
 template <typename Res,
           typename pairs_category,
           typename K,
@@ -115,6 +115,10 @@ using TBBSortSorters =
 
 using CudaSortSorters =
   camp::list<
+#if defined(CUB_VERSION) && (CUB_VERSION >= 101500)
+              CustomCompareSorter<PolicySort<RAJA::cuda_exec<128>>>,
+              CustomCompareSorter<PolicySortPairs<RAJA::cuda_exec<128>>>,
+#endif
               PolicySort<RAJA::cuda_exec<128>>,
               PolicySortPairs<RAJA::cuda_exec<128>>,
               PolicySort<RAJA::cuda_exec_explicit<128, 2>>
@@ -127,7 +131,33 @@ using CudaSortSorters =
 using HipSortSorters =
   camp::list<
               PolicySort<RAJA::hip_exec<128>>,
-              PolicySortPairs<RAJA::hip_exec<128>>
+              PolicySortPairs<RAJA::hip_exec<128>>,
+              CustomCompareSorter<PolicySort<RAJA::hip_exec<128>>>,
+              CustomCompareSorter<PolicySortPairs<RAJA::hip_exec<128>>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+
+using SyclSortSorters =
+  camp::list<
+              PolicySort<RAJA::sycl_exec<128, false>>,
+              PolicySortPairs<RAJA::sycl_exec<128, false>>,
+              CustomCompareSorter<PolicySort<RAJA::sycl_exec<128, false>>>,
+              CustomCompareSorter<PolicySortPairs<RAJA::sycl_exec<128, false>>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+using OpenMPTargetSortSorters =
+  camp::list<
+              PolicySort<RAJA::omp_target_parallel_for_exec<128>>,
+              PolicySortPairs<RAJA::omp_target_parallel_for_exec<128>>,
+              CustomCompareSorter<PolicySort<RAJA::omp_target_parallel_for_exec<128>>>,
+              CustomCompareSorter<PolicySortPairs<RAJA::omp_target_parallel_for_exec<128>>>
             >;
 
 #endif
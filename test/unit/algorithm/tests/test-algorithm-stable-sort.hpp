@@ -115,6 +115,10 @@ using TBBStableSortSorters =
 
 using CudaStableSortSorters =
   camp::list<
+#if defined(CUB_VERSION) && (CUB_VERSION >= 101500)
+              CustomCompareSorter<PolicyStableSort<RAJA::cuda_exec<128>>>,
+              CustomCompareSorter<PolicyStableSortPairs<RAJA::cuda_exec<128>>>,
+#endif
               PolicyStableSort<RAJA::cuda_exec<128>>,
               PolicyStableSortPairs<RAJA::cuda_exec<128>>,
               PolicyStableSort<RAJA::cuda_exec_explicit<128, 2>>
@@ -127,7 +131,33 @@ using CudaStableSortSorters =
 using HipStableSortSorters =
   camp::list<
               PolicyStableSort<RAJA::hip_exec<128>>,
-              PolicyStableSortPairs<RAJA::hip_exec<128>>
+              PolicyStableSortPairs<RAJA::hip_exec<128>>,
+              CustomCompareSorter<PolicyStableSort<RAJA::hip_exec<128>>>,
+              CustomCompareSorter<PolicyStableSortPairs<RAJA::hip_exec<128>>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_SYCL)
+
+using SyclStableSortSorters =
+  camp::list<
+              PolicyStableSort<RAJA::sycl_exec<128, false>>,
+              PolicyStableSortPairs<RAJA::sycl_exec<128, false>>,
+              CustomCompareSorter<PolicyStableSort<RAJA::sycl_exec<128, false>>>,
+              CustomCompareSorter<PolicyStableSortPairs<RAJA::sycl_exec<128, false>>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+using OpenMPTargetStableSortSorters =
+  camp::list<
+              PolicyStableSort<RAJA::omp_target_parallel_for_exec<128>>,
+              PolicyStableSortPairs<RAJA::omp_target_parallel_for_exec<128>>,
+              CustomCompareSorter<PolicyStableSort<RAJA::omp_target_parallel_for_exec<128>>>,
+              CustomCompareSorter<PolicyStableSortPairs<RAJA::omp_target_parallel_for_exec<128>>>
             >;
 
 #endif
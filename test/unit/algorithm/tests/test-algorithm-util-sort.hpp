@@ -51,6 +51,12 @@ struct IntroSort;
 template < typename forone_policy, typename platform = forone_platform<forone_policy> >
 struct IntroSortPairs;
 
+template < typename forone_policy, typename platform = forone_platform<forone_policy> >
+struct SimdSort;
+
+template < typename forone_policy, typename platform = forone_platform<forone_policy> >
+struct SimdSortPairs;
+
 template < typename forone_policy, typename platform = forone_platform<forone_policy> >
 struct MergeSort;
 
@@ -238,6 +244,51 @@ struct IntroSortPairs<forone_policy, RunOnHost>
   }
 };
 
+template < typename forone_policy >
+struct SimdSort<forone_policy, RunOnHost>
+  : ForoneSynchronize<forone_policy>
+{
+  using sort_category = unstable_sort_tag;
+  using sort_interface = sort_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::simd_sort";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::simd_sort(std::forward<Args>(args)...);
+  }
+};
+
+template < typename forone_policy >
+struct SimdSortPairs<forone_policy, RunOnHost>
+  : ForoneSynchronize<forone_policy>
+{
+  using sort_category = unstable_sort_tag;
+  using sort_interface = sort_pairs_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::simd_sort[pairs]";
+  }
+
+  template < typename KeyContainer, typename ValContainer,
+             typename Compare = RAJA::operators::less<RAJA::detail::ContainerRef<KeyContainer>>>
+  void operator()(KeyContainer&& keys,
+                  ValContainer&& vals,
+                  Compare comp = Compare{})
+  {
+    auto c = RAJA::zip_span(keys, vals);
+    using zip_ref = RAJA::detail::ContainerRef<camp::decay<decltype(c)>>;
+    RAJA::simd_sort(c, RAJA::compare_first<zip_ref>(comp));
+  }
+};
+
 template < typename forone_policy >
 struct MergeSort<forone_policy, RunOnHost>
   : ForoneSynchronize<forone_policy>
@@ -657,6 +708,12 @@ using SequentialIntroSortSorters =
               IntroSortPairs<forone_seq>
             >;
 
+using SequentialSimdSortSorters =
+  camp::list<
+              SimdSort<forone_seq>,
+              SimdSortPairs<forone_seq>
+            >;
+
 using SequentialMergeSortSorters =
   camp::list<
               MergeSort<forone_seq>,
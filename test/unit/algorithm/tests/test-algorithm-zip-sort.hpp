@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for sorting pairs with zipped values
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_ZIP_SORT_HPP__
+#define __TEST_UNIT_ALGORITHM_ZIP_SORT_HPP__
+
+#include "test-algorithm-sort-utils.hpp"
+
+#include <utility>
+#include <vector>
+
+template < typename policy >
+struct PolicyZipSortPairs
+  : PolicySynchronize<policy>
+{
+  const char* name()
+  {
+    return "RAJA::sort_pairs";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::sort_pairs<policy>(std::forward<Args>(args)...);
+  }
+};
+
+template < typename policy >
+struct PolicyZipStableSortPairs
+  : PolicySynchronize<policy>
+{
+  const char* name()
+  {
+    return "RAJA::stable_sort_pairs";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::stable_sort_pairs<policy>(std::forward<Args>(args)...);
+  }
+};
+
+// sort keys carrying the original index and a double computed from it,
+// then check every value array followed its key
+template <typename K,
+          typename Compare,
+          typename Sorter,
+          typename Res>
+void testZipSorterCompare(std::vector<K> const& host_keys,
+                          Compare comp,
+                          Sorter sorter,
+                          Res res)
+{
+  RAJA::Index_type N = static_cast<RAJA::Index_type>(host_keys.size());
+  const auto access = camp::resources::MemoryAccess::Managed;
+
+  K* keys = res.template allocate<K>(N, access);
+  int* idx = res.template allocate<int>(N, access);
+  double* dbl = res.template allocate<double>(N, access);
+  res.wait();
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    keys[i] = host_keys[i];
+    idx[i] = static_cast<int>(i);
+    dbl[i] = 0.5 * i;
+  }
+
+  sorter(RAJA::make_span(keys, N), RAJA::zip_span(idx, dbl), comp);
+  sorter.synchronize();
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(keys[i], host_keys[idx[i]]) << sorter.name() << " N " << N;
+    ASSERT_EQ(dbl[i], 0.5 * idx[i]) << sorter.name() << " N " << N;
+    if (i > 0) {
+      ASSERT_FALSE(comp(keys[i], keys[i-1])) << sorter.name() << " N " << N;
+    }
+  }
+  std::vector<int> perm(idx, idx + N);
+  std::sort(perm.begin(), perm.end());
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(perm[i], i) << sorter.name() << " N " << N;
+  }
+
+  res.deallocate(dbl, access);
+  res.deallocate(idx, access);
+  res.deallocate(keys, access);
+}
+
+template <typename K,
+          typename Sorter,
+          typename Res>
+void testZipSorter(unsigned seed, RAJA::Index_type MaxN,
+                   Sorter sorter, Res res)
+{
+  std::mt19937 rng(seed);
+  for (RAJA::Index_type n = 0; n <= MaxN; n = (n == 0) ? 1 : n * 10) {
+    RAJA::Index_type N = std::uniform_int_distribution<RAJA::Index_type>((n+1)/2, n)(rng);
+    std::uniform_int_distribution<RAJA::Index_type> dist(-N, N);
+    std::vector<K> host_keys(N);
+    for (K& k : host_keys) {
+      k = static_cast<K>(dist(rng));
+    }
+
+    testZipSorterCompare(host_keys, RAJA::operators::less<K>{}, sorter, res);
+    testZipSorterCompare(host_keys, RAJA::operators::greater<K>{}, sorter, res);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(ZipSortUnitTest);
+
+template < typename T >
+class ZipSortUnitTest : public ::testing::Test
+{ };
+
+TYPED_TEST_P(ZipSortUnitTest, UnitZipSort)
+{
+  using Sorter   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType  = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KeyType  = typename camp::at<TypeParam, camp::num<2>>::type;
+  using MaxNType = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  unsigned seed = get_random_seed();
+  RAJA::Index_type MaxN = MaxNType::value;
+  Sorter sorter{};
+  ResType res = ResType::get_default();
+
+  testZipSorter<KeyType>(seed, MaxN, sorter, res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ZipSortUnitTest, UnitZipSort);
+
+
+#if defined(RAJA_ENABLE_CUDA)
+
+using CudaZipSortSorters =
+  camp::list<
+              PolicyZipSortPairs<RAJA::cuda_exec<128>>,
+              PolicyZipStableSortPairs<RAJA::cuda_exec<128>>
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+
+using HipZipSortSorters =
+  camp::list<
+              PolicyZipSortPairs<RAJA::hip_exec<128>>,
+              PolicyZipStableSortPairs<RAJA::hip_exec<128>>
+            >;
+
+#endif
+
+#endif //__TEST_UNIT_ALGORITHM_ZIP_SORT_HPP__
@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BoxSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(BoxSegmentUnitTest, Constructors)
+{
+  RAJA::BoxSegment<3> box(RAJA::RangeSegment(1, 4),
+                          RAJA::RangeSegment(0, 5),
+                          RAJA::RangeSegment(2, 9));
+  ASSERT_EQ(3 * 5 * 7, box.size());
+  ASSERT_EQ(1, box.getBegin(0));
+  ASSERT_EQ(7, box.getExtent(2));
+  ASSERT_EQ(RAJA::BoxSegment<3>::default_tile_size, box.getTileSize(0));
+  ASSERT_EQ(7, box.getTileSize(2));
+
+  RAJA::BoxSegment<3> copied(box);
+  ASSERT_EQ(box, copied);
+
+  RAJA::BoxSegment<3> empty(RAJA::RangeSegment(1, 4),
+                            RAJA::RangeSegment(5, 5),
+                            RAJA::RangeSegment(2, 9));
+  ASSERT_EQ(0, empty.size());
+  ASSERT_NE(box, empty);
+}
+
+//
+// Every point of the box is visited once, and the points of a tile with
+// the last dimension fastest.
+//
+template <typename POLICY>
+void checkBoxForall(RAJA::Index_type tile)
+{
+  constexpr int ni = 5, nj = 6, nk = 7;
+  RAJA::BoxSegment<3> box(RAJA::RangeSegment(1, 1 + ni),
+                          RAJA::RangeSegment(2, 2 + nj),
+                          RAJA::RangeSegment(0, nk));
+  box.setTileSize(0, tile);
+  box.setTileSize(1, tile);
+
+  std::vector<int> count(ni * nj * nk, 0);
+  int* counts = count.data();
+  RAJA::ReduceSum<RAJA::seq_reduce, long> sum(0);
+
+  RAJA::forall<POLICY>(box,
+                       [=](RAJA::Index_type i,
+                           RAJA::Index_type j,
+                           RAJA::Index_type k) {
+                         counts[((i - 1) * nj + (j - 2)) * nk + k] += 1;
+                         sum += i * j * k;
+                       });
+
+  long expected = 0;
+  for (int i = 1; i < 1 + ni; ++i) {
+    for (int j = 2; j < 2 + nj; ++j) {
+      for (int k = 0; k < nk; ++k) {
+        expected += i * j * k;
+      }
+    }
+  }
+  ASSERT_EQ(expected, sum.get());
+  for (int c : count) {
+    ASSERT_EQ(1, c);
+  }
+}
+
+TEST(BoxSegmentUnitTest, ForallTiled)
+{
+  checkBoxForall<RAJA::seq_exec>(2);
+  checkBoxForall<RAJA::loop_exec>(4);
+  checkBoxForall<RAJA::seq_exec>(RAJA::BoxSegment<3>::default_tile_size);
+}
+
+TEST(BoxSegmentUnitTest, ForallOrder)
+{
+  RAJA::BoxSegment<2> box(RAJA::RangeSegment(0, 5), RAJA::RangeSegment(0, 3));
+  box.setTileSize(0, 2);
+
+  std::vector<std::pair<RAJA::Index_type, RAJA::Index_type>> visits;
+  RAJA::forall<RAJA::seq_exec>(box, [&](RAJA::Index_type i, RAJA::Index_type j) {
+    visits.emplace_back(i, j);
+  });
+
+  // tiles of 2 rows, the whole last dimension in each
+  std::vector<std::pair<RAJA::Index_type, RAJA::Index_type>> expected;
+  for (int t = 0; t < 5; t += 2) {
+    for (int i = t; i < t + 2 && i < 5; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        expected.emplace_back(i, j);
+      }
+    }
+  }
+  ASSERT_EQ(expected, visits);
+}
+
+TEST(BoxSegmentUnitTest, ForallFlattened)
+{
+  constexpr int ni = 4, nj = 9;
+  RAJA::BoxSegment<2> box(RAJA::RangeSegment(3, 3 + ni),
+                          RAJA::RangeSegment(-2, -2 + nj));
+
+#if defined(RAJA_ENABLE_OPENMP)
+  using FlatPolicy = RAJA::omp_parallel_for_exec;
+  using FlatReduce = RAJA::omp_reduce;
+#else
+  using FlatPolicy = RAJA::seq_exec;
+  using FlatReduce = RAJA::seq_reduce;
+#endif
+
+  RAJA::ReduceSum<FlatReduce, long> sum(0);
+  RAJA::ReduceSum<FlatReduce, long> points(0);
+  RAJA::forall<FlatPolicy>(box, [=](RAJA::Index_type i, RAJA::Index_type j) {
+    sum += i * 100 + j;
+    points += 1;
+  });
+
+  long expected = 0;
+  for (int i = 3; i < 3 + ni; ++i) {
+    for (int j = -2; j < -2 + nj; ++j) {
+      expected += i * 100 + j;
+    }
+  }
+  ASSERT_EQ(expected, sum.get());
+  ASSERT_EQ(ni * nj, points.get());
+}
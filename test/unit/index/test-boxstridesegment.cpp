@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BoxStrideSegment and
+/// buildMulticolorIndexSet
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include <array>
+#include <vector>
+
+template<typename T>
+class BoxStrideSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BoxStrideSegmentUnitTest, UnitIndexTypes);
+
+TYPED_TEST(BoxStrideSegmentUnitTest, Constructors)
+{
+  RAJA::TypedBoxStrideSegment<TypeParam> box(
+      std::array<RAJA::Index_type, 2>{{1, 2}},
+      std::array<RAJA::Index_type, 2>{{6, 9}},
+      std::array<RAJA::Index_type, 2>{{2, 3}},
+      std::array<RAJA::Index_type, 2>{{10, 1}});
+  ASSERT_EQ(box.size(), 3 * 3);
+  ASSERT_EQ(box.getNumDims(), 2);
+
+  RAJA::TypedBoxStrideSegment<TypeParam> copied(box);
+  ASSERT_EQ(box, copied);
+
+  RAJA::TypedBoxStrideSegment<TypeParam> empty(
+      std::array<RAJA::Index_type, 2>{{1, 5}},
+      std::array<RAJA::Index_type, 2>{{6, 5}},
+      std::array<RAJA::Index_type, 2>{{2, 3}},
+      std::array<RAJA::Index_type, 2>{{10, 1}});
+  ASSERT_EQ(empty.size(), 0);
+  ASSERT_NE(box, empty);
+}
+
+TYPED_TEST(BoxStrideSegmentUnitTest, Iterators)
+{
+  RAJA::TypedBoxStrideSegment<TypeParam> box(
+      std::array<RAJA::Index_type, 3>{{0, 1, 2}},
+      std::array<RAJA::Index_type, 3>{{3, 4, 7}},
+      std::array<RAJA::Index_type, 3>{{2, 1, 2}},
+      std::array<RAJA::Index_type, 3>{{40, 8, 1}});
+
+  std::vector<TypeParam> expected;
+  for (int k = 0; k < 3; k += 2) {
+    for (int j = 1; j < 4; ++j) {
+      for (int i = 2; i < 7; i += 2) {
+        expected.push_back(static_cast<TypeParam>(k * 40 + j * 8 + i));
+      }
+    }
+  }
+
+  ASSERT_EQ((RAJA::Index_type)expected.size(), box.end() - box.begin());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i], box.begin()[i]);
+  }
+
+  std::vector<TypeParam> visited;
+  RAJA::forall<RAJA::seq_exec>(box, [&](TypeParam i) {
+    visited.push_back(i);
+  });
+  ASSERT_EQ(expected, visited);
+}
+
+TEST(BoxStrideSegmentUnitTest, Multicolor)
+{
+  constexpr RAJA::Index_type nx = 7, ny = 6, nz = 5;
+
+  for (int num_colors = 1; num_colors <= 3; ++num_colors) {
+    for (int num_dims = 1; num_dims <= 3; ++num_dims) {
+      RAJA::Index_type begin[] = {1, 1, 1};
+      RAJA::Index_type end[] = {nz - 1, ny - 1, nx - 1};
+      RAJA::Index_type extent[] = {nz, ny, nx};
+
+      RAJA::TypedIndexSet<RAJA::BoxStrideSegment> iset;
+      RAJA::Index_type per_color = RAJA::buildMulticolorIndexSet(
+          iset, num_colors, num_dims, begin, end, extent);
+
+      RAJA::Index_type expected_segments = 1;
+      for (int d = 1; d < num_dims; ++d) expected_segments *= num_colors;
+      ASSERT_EQ(expected_segments, per_color);
+      ASSERT_EQ(size_t(per_color * num_colors), iset.getNumSegments());
+
+      // every interior cell is visited once, by the segments of its color
+      std::vector<int> color(nx * ny * nz, -1);
+      for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+        int c = static_cast<int>(s / per_color);
+        RAJA::BoxStrideSegment const& seg =
+            iset.getSegment<RAJA::BoxStrideSegment>(s);
+        for (RAJA::Index_type id : seg) {
+          ASSERT_EQ(-1, color[id]);
+          color[id] = c;
+        }
+      }
+
+      RAJA::Index_type strides[] = {1, 1, 1};
+      for (int d = num_dims - 1; d > 0; --d) {
+        strides[d - 1] = strides[d] * extent[d];
+      }
+      RAJA::Index_type cells = 1;
+      for (int d = 0; d < num_dims; ++d) cells *= end[d] - begin[d];
+      RAJA::Index_type visited = 0;
+      for (RAJA::Index_type id = 0; id < nx * ny * nz; ++id) {
+        if (color[id] < 0) continue;
+        ++visited;
+        RAJA::Index_type rest = id;
+        RAJA::Index_type coord_sum = 0;
+        for (int d = 0; d < num_dims; ++d) {
+          RAJA::Index_type x = rest / strides[d];
+          rest %= strides[d];
+          ASSERT_GE(x, begin[d]);
+          ASSERT_LT(x, end[d]);
+          coord_sum += x;
+        }
+        ASSERT_EQ(coord_sum % num_colors, color[id]);
+      }
+      ASSERT_EQ(cells, visited);
+    }
+  }
+}
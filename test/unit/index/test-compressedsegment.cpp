@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for BitmaskSegment and RunLengthSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include "camp/resource.hpp"
+
+#include <set>
+#include <vector>
+
+template<typename T>
+class CompressedSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(CompressedSegmentUnitTest, UnitIndexTypes);
+
+//
+// Resource object used to construct segment objects with indices
+// living in host (CPU) memory. Used in all tests in this file.
+//
+camp::resources::Resource host_res{camp::resources::Host()};
+
+//
+// Unsorted indices with repeats, long runs and gaps wider than a word.
+//
+template<typename T>
+std::vector<T> makeIndices()
+{
+  std::vector<T> idx;
+  for (int i = 3; i < 80; ++i) {
+    if (i % 3 != 0) idx.push_back(static_cast<T>(i));
+  }
+  for (int i = 90; i < 100; ++i) {
+    idx.push_back(static_cast<T>(i));
+  }
+  idx.push_back(static_cast<T>(42));
+  idx.push_back(static_cast<T>(120));
+  idx.push_back(static_cast<T>(0));
+  return idx;
+}
+
+TYPED_TEST(CompressedSegmentUnitTest, BitmaskConstructors)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+  std::set<TypeParam> unique(idx.begin(), idx.end());
+
+  RAJA::TypedBitmaskSegment<TypeParam> mask1(&idx[0], idx.size(), host_res);
+  ASSERT_EQ(mask1.size(), (RAJA::Index_type)unique.size());
+  ASSERT_EQ(mask1.getIndexOwnership(), RAJA::Owned);
+
+  RAJA::TypedBitmaskSegment<TypeParam> copied(mask1);
+  ASSERT_EQ(mask1, copied);
+  ASSERT_EQ(copied.getIndexOwnership(), RAJA::Unowned);
+
+  RAJA::TypedBitmaskSegment<TypeParam> moved(std::move(mask1));
+  ASSERT_EQ(mask1.size(), 0);
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedBitmaskSegment<TypeParam> container(idx, host_res);
+  ASSERT_EQ(container.getIndexOwnership(), RAJA::Owned);
+  ASSERT_EQ(moved, container);
+}
+
+TYPED_TEST(CompressedSegmentUnitTest, BitmaskIterators)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+  std::set<TypeParam> unique(idx.begin(), idx.end());
+  std::vector<TypeParam> sorted(unique.begin(), unique.end());
+
+  RAJA::TypedBitmaskSegment<TypeParam> mask(idx, host_res);
+
+  ASSERT_EQ(TypeParam(0), *mask.begin());
+  ASSERT_EQ(TypeParam(120), *(mask.end()-1));
+  ASSERT_EQ((RAJA::Index_type)sorted.size(), mask.end() - mask.begin());
+
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    ASSERT_EQ(sorted[i], mask.begin()[i]);
+  }
+}
+
+TYPED_TEST(CompressedSegmentUnitTest, RunLengthConstructors)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+
+  RAJA::TypedRunLengthSegment<TypeParam> runs1(&idx[0], idx.size(), host_res);
+  ASSERT_EQ(runs1.size(), (RAJA::Index_type)idx.size());
+  ASSERT_EQ(runs1.getNumRuns(), 30);
+  ASSERT_EQ(runs1.getIndexOwnership(), RAJA::Owned);
+
+  RAJA::TypedRunLengthSegment<TypeParam> copied(runs1);
+  ASSERT_EQ(runs1, copied);
+  ASSERT_EQ(copied.getIndexOwnership(), RAJA::Unowned);
+
+  RAJA::TypedRunLengthSegment<TypeParam> moved(std::move(runs1));
+  ASSERT_EQ(runs1.size(), 0);
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedRunLengthSegment<TypeParam> container(idx, host_res);
+  ASSERT_EQ(container.getIndexOwnership(), RAJA::Owned);
+  ASSERT_EQ(moved, container);
+}
+
+TYPED_TEST(CompressedSegmentUnitTest, RunLengthIterators)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+
+  RAJA::TypedRunLengthSegment<TypeParam> runs(idx, host_res);
+
+  ASSERT_EQ(TypeParam(4), *runs.begin());
+  ASSERT_EQ(TypeParam(0), *(runs.end()-1));
+
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], runs.begin()[i]);
+  }
+}
+
+TYPED_TEST(CompressedSegmentUnitTest, Forall)
+{
+  std::vector<TypeParam> idx = makeIndices<TypeParam>();
+  std::set<TypeParam> unique(idx.begin(), idx.end());
+  std::vector<TypeParam> sorted(unique.begin(), unique.end());
+
+  RAJA::TypedBitmaskSegment<TypeParam> mask(idx, host_res);
+  RAJA::TypedRunLengthSegment<TypeParam> runs(idx, host_res);
+
+  std::vector<TypeParam> seq_mask;
+  RAJA::forall<RAJA::seq_exec>(mask, [&](TypeParam i) {
+    seq_mask.push_back(i);
+  });
+  ASSERT_EQ(sorted, seq_mask);
+
+  std::vector<TypeParam> loop_runs;
+  RAJA::forall<RAJA::loop_exec>(runs, [&](TypeParam i) {
+    loop_runs.push_back(i);
+  });
+  ASSERT_EQ(idx, loop_runs);
+
+  using SegTypes = RAJA::TypedIndexSet<RAJA::TypedBitmaskSegment<TypeParam>,
+                                       RAJA::TypedRunLengthSegment<TypeParam>>;
+  SegTypes iset;
+  iset.push_back(mask);
+  iset.push_back(runs);
+
+  int sum = 0;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](TypeParam i) { sum += static_cast<int>(i); });
+
+  int expected = 0;
+  for (TypeParam i : sorted) expected += static_cast<int>(i);
+  for (TypeParam i : idx) expected += static_cast<int>(i);
+  ASSERT_EQ(expected, sum);
+}
@@ -163,6 +163,85 @@ TEST(IndexSetUnitTest, Slice)
   ASSERT_EQ(6, *rs41.end());
 }
 
+TEST(IndexSetUnitTest, Move)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+
+  // one set held inline, one spilled to the heap
+  for (int num : {3, int(RAJA::IndexSetInlineSegments) + 5}) {
+    RIndexSetType iset1;
+    for (int i = 0; i < num; ++i) {
+      iset1.push_back(RangeSegType(2 * i, 2 * i + 2));
+    }
+
+    RIndexSetType iset2(std::move(iset1));
+    ASSERT_EQ(num, iset2.size());
+    ASSERT_EQ(size_t(2 * num), iset2.getLength());
+    ASSERT_EQ(0, iset1.size());
+
+    RIndexSetType iset3;
+    iset3 = std::move(iset2);
+    ASSERT_EQ(num, iset3.size());
+    ASSERT_EQ(0, iset2.size());
+    const RangeSegType last = iset3.getSegment<const RangeSegType>(num - 1);
+    ASSERT_EQ(2 * num - 2, *last.begin());
+
+    RIndexSetType slice = iset3.createSlice(1, num);
+    ASSERT_EQ(num - 1, slice.size());
+    ASSERT_EQ(size_t(2 * num - 2), slice.getLength());
+  }
+}
+
+TEST(IndexSetUnitTest, View)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using ListSegType = RAJA::TypedListSegment<int>;
+  using RLIndexSetType = RAJA::TypedIndexSet<RangeSegType, ListSegType>;
+  using ViewType = RAJA::TypedIndexSetView<RangeSegType, ListSegType>;
+
+  ASSERT_TRUE(std::is_trivially_copyable<ViewType>::value);
+
+  int idx[] = {10, 12, 14, 16, 18};
+  ListSegType lseg(idx, 5, host_res);
+
+  RLIndexSetType iset;
+  iset.push_back(RangeSegType(0, 4));
+  iset.push_back(lseg.slice(1, 3));
+  iset.push_back(RangeSegType(20, 22));
+  iset.push_back(lseg.slice(4, 10));
+
+  // slices of a list segment view its indices
+  ListSegType const& sub = iset.getSegment<ListSegType>(1);
+  ASSERT_EQ(3, sub.size());
+  ASSERT_EQ(RAJA::Unowned, sub.getIndexOwnership());
+  ASSERT_EQ(lseg.begin() + 1, sub.begin());
+
+  ViewType view = RAJA::make_index_set_view(iset, 1, 3);
+  ASSERT_EQ(size_t(2), view.getNumSegments());
+  ASSERT_EQ(size_t(5), view.getLength());
+  ASSERT_EQ(0, view.getStartingIcount(0));
+  ASSERT_EQ(3, view.getStartingIcount(1));
+
+  std::vector<int> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      view, [&](int i) { visited.push_back(i); });
+  ASSERT_EQ((std::vector<int>{12, 14, 16, 20, 21}), visited);
+
+  std::vector<int> icounts;
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      view.slice(1, 5), [&](int icount, int) { icounts.push_back(icount); });
+  ASSERT_EQ((std::vector<int>{0, 1}), icounts);
+
+  ViewType all(iset);
+  ASSERT_EQ(iset.getNumSegments(), all.getNumSegments());
+  ASSERT_EQ(iset.getLength(), all.getLength());
+
+  ViewType empty = RAJA::make_index_set_view(iset, 3, 1);
+  ASSERT_EQ(size_t(0), empty.getNumSegments());
+  ASSERT_EQ(size_t(0), empty.getLength());
+}
+
 TEST(IndexSetUnitTest, ConditionalEvenIndices)
 {
   using RangeSegType = RAJA::TypedRangeSegment<int>;
@@ -15,6 +15,7 @@
 
 #include "camp/resource.hpp"
 
+#include <cmath>
 #include <vector>
 
 template<typename T>
@@ -103,3 +104,76 @@ TYPED_TEST(ListSegmentUnitTest, Iterators)
   ASSERT_EQ(4, list.size());
 }
 
+
+TYPED_TEST(ListSegmentUnitTest, BuildIf)
+{
+  auto list = RAJA::make_list_segment_if<RAJA::seq_exec>(
+      RAJA::TypedRangeSegment<TypeParam>(0, 20),
+      [](TypeParam i) { return i % 3 == 0; });
+
+  ASSERT_EQ(7, list.size());
+  ASSERT_EQ(list.getIndexOwnership(), RAJA::Owned);
+
+  std::vector<TypeParam> idx{0, 3, 6, 9, 12, 15, 18};
+  ASSERT_EQ(list.indicesEqual( &idx[0], idx.size() ), true);
+
+  auto none = RAJA::make_list_segment_if<RAJA::seq_exec>(
+      RAJA::TypedRangeSegment<TypeParam>(0, 20),
+      [](TypeParam i) { return i > 100; });
+
+  ASSERT_EQ(0, none.size());
+}
+
+TYPED_TEST(ListSegmentUnitTest, Reorder)
+{
+  camp::resources::Host res;
+
+  std::vector<TypeParam> idx{5, 3, 1, 2, 0, 4};
+  RAJA::TypedListSegment<TypeParam> list( idx, host_res );
+
+  std::vector<RAJA::Index_type> perm(idx.size());
+
+  auto sorted = RAJA::reorder_by_key<RAJA::seq_exec>(
+      res, list, [](TypeParam i) { return static_cast<uint64_t>(i); },
+      &perm[0]);
+  std::vector<TypeParam> sorted_idx{0, 1, 2, 3, 4, 5};
+  ASSERT_EQ(sorted.indicesEqual( &sorted_idx[0], sorted_idx.size() ), true);
+  ASSERT_EQ(sorted.getIndexOwnership(), RAJA::Owned);
+  for (size_t k = 0; k < idx.size(); ++k) {
+    ASSERT_EQ(idx[perm[k]], sorted_idx[k]);
+  }
+
+  //
+  // Corners of a square; a Hilbert curve visits neighbors one after the
+  // other.
+  //
+  std::vector<TypeParam> corners_idx{3, 0, 2, 1};
+  RAJA::TypedListSegment<TypeParam> corners( corners_idx, host_res );
+  std::vector<double> x{0.0, 1.0, 1.0, 0.0};
+  std::vector<double> y{0.0, 0.0, 1.0, 1.0};
+  auto curve = RAJA::reorder_hilbert<RAJA::seq_exec>(
+      res, corners, &x[0], &y[0], static_cast<const double*>(nullptr),
+      &perm[0]);
+  ASSERT_EQ(curve.size(), corners.size());
+  for (size_t k = 0; k < corners_idx.size(); ++k) {
+    ASSERT_EQ(corners_idx[perm[k]], *(curve.begin() + k));
+  }
+  for (size_t k = 1; k < corners_idx.size(); ++k) {
+    TypeParam a = *(curve.begin() + k - 1);
+    TypeParam b = *(curve.begin() + k);
+    ASSERT_EQ(std::abs(x[a] - x[b]) + std::abs(y[a] - y[b]), 1.0);
+  }
+
+  //
+  // Path graph 0 - 1 - 2 - 3 - 4 - 5
+  //
+  std::vector<RAJA::Index_type> adj_offsets{0, 1, 3, 5, 7, 9, 10};
+  std::vector<RAJA::Index_type> adj{1, 0, 2, 1, 3, 2, 4, 3, 5, 4};
+  auto rcm = RAJA::reorder_rcm<RAJA::seq_exec>(
+      res, list, &adj_offsets[0], &adj[0], &perm[0]);
+  ASSERT_EQ(rcm.indicesEqual( &sorted_idx[0], sorted_idx.size() ), true);
+  for (size_t k = 0; k < idx.size(); ++k) {
+    ASSERT_EQ(idx[perm[k]], sorted_idx[k]);
+  }
+}
+
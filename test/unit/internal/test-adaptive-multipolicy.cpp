@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the size-adaptive MultiPolicy
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using AdaptiveSelector =
+    RAJA::AdaptivePolicySelector<RAJA::seq_exec, RAJA::loop_exec>;
+
+TEST(AdaptiveMultiPolicyUnitTest, calibration)
+{
+  AdaptiveSelector s(1 << 12);
+  s.calibrate();
+
+  // every size selects one of the policies, and sizes at or above the
+  // threshold of the policy selected for 1 iterate start from 1
+  for (RAJA::Index_type n = 0; n <= (1 << 14); n = 2 * n + 1) {
+    int p = s.policy_for(n);
+    ASSERT_GE(p, 0);
+    ASSERT_LT(p, 2);
+  }
+  ASSERT_EQ(1, s.threshold(s.policy_for(1)));
+
+  // copies share the calibration
+  AdaptiveSelector copy = s;
+  for (RAJA::Index_type n = 1; n <= (1 << 14); n *= 2) {
+    ASSERT_EQ(s.policy_for(n), copy.policy_for(n));
+  }
+}
+
+TEST(AdaptiveMultiPolicyUnitTest, forall)
+{
+  auto p = RAJA::make_adaptive_multi_policy<RAJA::seq_exec, RAJA::loop_exec>(
+      1 << 10);
+
+  for (int n : {0, 1, 17, 1000, 5000}) {
+    std::vector<int> a(n, 0);
+    int* data = a.data();
+    RAJA::forall(p, RAJA::TypedRangeSegment<int>(0, n), [=](int i) {
+      data[i] += i;
+    });
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(i, a[i]);
+    }
+  }
+}
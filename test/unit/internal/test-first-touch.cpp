@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for first touch allocation
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+TEST(FirstTouchUnitTest, allocate_test)
+{
+  const size_t len = 100000;
+  RAJA::FirstTouchMap map;
+  double* ptr = RAJA::allocate_first_touch<double>(len, &map);
+
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % RAJA::get_page_size(),
+            0u);
+
+  // the chunks cover [0, len) in order
+  ASSERT_GE(map.num_chunks(), 1);
+  RAJA::Index_type next = 0;
+  for (int t = 0; t < map.num_chunks(); ++t) {
+    if (map.chunk_begin[t] < map.chunk_end[t]) {
+      ASSERT_EQ(next, map.chunk_begin[t]);
+      next = map.chunk_end[t];
+    }
+    ASSERT_GE(map.domain[t], 0);
+  }
+  ASSERT_EQ(static_cast<RAJA::Index_type>(len), next);
+
+  ASSERT_EQ(-1, map.chunk_of(-1));
+  ASSERT_EQ(-1, map.chunk_of(len));
+  for (size_t i = 0; i < len; i += 997) {
+    int t = map.chunk_of(i);
+    ASSERT_GE(t, 0);
+    ASSERT_EQ(map.domain[t], map.domain_of(i));
+    ptr[i] = 1.0;
+  }
+
+  RAJA::free_aligned(ptr);
+}
+
+TEST(FirstTouchUnitTest, unaligned_test)
+{
+  const size_t nbytes = 3 * RAJA::get_page_size() + 7;
+  char* ptr = static_cast<char*>(std::malloc(nbytes + 1)) + 1;
+  std::memset(ptr, 1, nbytes);
+
+  RAJA::first_touch_static(ptr, nbytes, 24);
+
+  // the first byte, the first byte of each page, and the trailing partial
+  // element are touched
+  const std::uintptr_t page = RAJA::get_page_size();
+  const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(ptr);
+  ASSERT_EQ(0, ptr[0]);
+  for (std::uintptr_t p = (base + page - 1) / page * page; p < base + nbytes;
+       p += page) {
+    ASSERT_EQ(0, ptr[p - base]);
+  }
+  ASSERT_EQ(0, ptr[nbytes - 1]);
+  ASSERT_EQ(1, ptr[1]);
+
+  std::free(ptr - 1);
+}
+
+TEST(FirstTouchUnitTest, mempool_test)
+{
+  using pool_type = RAJA::basic_mempool::MemPool<
+      RAJA::basic_mempool::first_touch_allocator>;
+
+  int* ptr = pool_type::getInstance().malloc<int>(1000);
+  ASSERT_NE(ptr, nullptr);
+  for (int i = 0; i < 1000; ++i) {
+    ptr[i] = i;
+  }
+  ASSERT_EQ(999, ptr[999]);
+  pool_type::getInstance().free(ptr);
+}
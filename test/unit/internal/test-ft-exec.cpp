@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(FtExecUnitTest, NoFault)
+{
+  constexpr int N = 1000;
+  std::vector<double> y(N, 1.0);
+  double* y_ptr = y.data();
+
+  RAJA::forall<RAJA::ft_exec<RAJA::seq_exec, 64>>(
+      RAJA::TypedRangeSegment<int>(0, N),
+      RAJA::expt::Checkpoint(y_ptr),
+      [=](int i) { y_ptr[i] += i; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], 1.0 + i);
+  }
+}
+
+TEST(FtExecUnitTest, ReExecutesFaultedChunk)
+{
+  constexpr int N = 1000;
+  constexpr int fault_at = 900;
+  std::vector<double> y(N, 1.0);
+  std::vector<int> runs(N, 0);
+  double* y_ptr = y.data();
+  int* runs_ptr = runs.data();
+
+  RAJA::View<double, RAJA::Layout<1>> y_view(y_ptr, N);
+
+  // the read-modify-write of y is not idempotent, so y is only right if
+  // the faulted chunk is restored before it runs again
+  RAJA::forall<RAJA::ft_exec<RAJA::seq_exec, 64>>(
+      RAJA::TypedRangeSegment<int>(0, N),
+      RAJA::expt::Checkpoint(y_view),
+      [=](int i) {
+        y_view(i) *= 2.0;
+        if (i == fault_at && runs_ptr[i] == 0) {
+          RAJA::ft::fault_status() = 1;
+        }
+        ++runs_ptr[i];
+      });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], 2.0);
+    // only the chunk [896, 960) holding fault_at ran twice
+    ASSERT_EQ(runs[i], (i / 64 == fault_at / 64) ? 2 : 1);
+  }
+  ASSERT_EQ(RAJA::ft::fault_status(), 0);
+}
+
+TEST(FtExecUnitTest, PartialLastChunk)
+{
+  constexpr int N = 100;
+  std::vector<int> y(N, 0);
+  int* y_ptr = y.data();
+
+  RAJA::forall<RAJA::ft_exec<RAJA::seq_exec, 64>>(
+      RAJA::TypedRangeSegment<int>(10, N),
+      RAJA::expt::Checkpoint(y_ptr),
+      [=](int i) {
+        y_ptr[i] += 1;
+        if (i == N - 1 && y_ptr[i] == 1 && y_ptr[0] == 0) {
+          y_ptr[0] = 1;
+          RAJA::ft::fault_status() = 1;
+        }
+      });
+
+  for (int i = 10; i < N; ++i) {
+    ASSERT_EQ(y[i], 1);
+  }
+}
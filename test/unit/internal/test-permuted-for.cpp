@@ -0,0 +1,75 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for statement::PermutedFor
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using PermutedPolicy = RAJA::KernelPolicy<
+    RAJA::statement::PermutedFor<0, RAJA::ArgList<0, 1, 2>, RAJA::seq_exec,
+      RAJA::statement::Lambda<0, RAJA::Segs<0, 1, 2>>>>;
+
+TEST(PermutedForUnitTest, rank_test)
+{
+  std::array<camp::idx_t, 3> ijk{{0, 1, 2}};
+  std::array<camp::idx_t, 3> kji{{2, 1, 0}};
+  std::array<camp::idx_t, 3> jki{{1, 2, 0}};
+  ASSERT_EQ(0, RAJA::permutation_rank(ijk));
+  ASSERT_EQ(5, RAJA::permutation_rank(kji));
+  ASSERT_EQ(3, RAJA::permutation_rank(jki));
+
+  // the rank of a layout runs its stride one dimension innermost
+  RAJA::Layout<3> layout_ijk =
+      RAJA::make_permuted_layout({{2, 3, 4}}, RAJA::PERM_IJK::value);
+  RAJA::Layout<3> layout_kji =
+      RAJA::make_permuted_layout({{2, 3, 4}}, RAJA::PERM_KJI::value);
+  RAJA::Layout<3> layout_jki =
+      RAJA::make_permuted_layout({{2, 3, 4}}, RAJA::PERM_JKI::value);
+  ASSERT_EQ(0, RAJA::layout_loop_rank(layout_ijk));
+  ASSERT_EQ(5, RAJA::layout_loop_rank(layout_kji));
+  ASSERT_EQ(3, RAJA::layout_loop_rank(layout_jki));
+}
+
+TEST(PermutedForUnitTest, order_test)
+{
+  constexpr int ni = 2, nj = 3, nk = 4;
+
+  for (camp::idx_t rank = 0; rank < 6; ++rank) {
+    std::vector<std::array<int, 3>> visits;
+
+    RAJA::kernel_param<PermutedPolicy>(
+        RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                         RAJA::RangeSegment(0, nj),
+                         RAJA::RangeSegment(0, nk)),
+        RAJA::make_tuple(rank),
+        [&](int i, int j, int k) { visits.push_back({{i, j, k}}); });
+
+    ASSERT_EQ(size_t(ni * nj * nk), visits.size());
+
+    // the visits are in lexicographic order of the indices in loop order
+    std::array<camp::idx_t, 3> order{{0, 1, 2}};
+    for (camp::idx_t r = 0; r < rank; ++r) {
+      std::next_permutation(order.begin(), order.end());
+    }
+    for (size_t v = 1; v < visits.size(); ++v) {
+      std::array<int, 3> prev, cur;
+      for (int d = 0; d < 3; ++d) {
+        prev[d] = visits[v - 1][order[d]];
+        cur[d] = visits[v][order[d]];
+      }
+      ASSERT_LT(prev, cur);
+    }
+  }
+}
@@ -63,3 +63,44 @@ TEST(RAJAVecUnitTest, basic_test)
   ASSERT_EQ(c.data() + c.size(), c.end());
   ASSERT_EQ(c.data(), c.begin());
 }
+
+TEST(RAJAVecUnitTest, inline_test)
+{
+  using InlineVec = RAJA::RAJAVec<int, std::allocator<int>, 4>;
+  InlineVec a;
+  ASSERT_EQ(4lu, a.capacity());
+
+  for (int i = 0; i < 3; ++i)
+    a.push_back(i);
+  ASSERT_EQ(4lu, a.capacity());
+
+  InlineVec b;
+  for (int i = 0; i < 10; ++i)
+    b.push_front(i);
+  ASSERT_LT(4lu, b.capacity());
+
+  a.swap(b);
+  ASSERT_EQ(10lu, a.size());
+  ASSERT_EQ(3lu, b.size());
+  ASSERT_EQ(9, a[0]);
+  ASSERT_EQ(2, b[2]);
+
+  InlineVec c(std::move(b));
+  ASSERT_EQ(3lu, c.size());
+  ASSERT_EQ(0lu, b.size());
+  ASSERT_EQ(1, c[1]);
+
+  InlineVec d(std::move(a));
+  ASSERT_EQ(10lu, d.size());
+  ASSERT_EQ(0lu, a.size());
+
+  d.resize(2);
+  d.shrink_to_fit();
+  ASSERT_EQ(4lu, d.capacity());
+  ASSERT_EQ(8, d[1]);
+
+  c = std::move(d);
+  ASSERT_EQ(2lu, c.size());
+  ASSERT_EQ(9, c[0]);
+  ASSERT_EQ(c.data(), c.begin());
+}
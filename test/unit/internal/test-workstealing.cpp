@@ -0,0 +1,189 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for WorkStealingDeque and
+/// dependency graph index set traversal
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/internal/WorkStealingDeque.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(WorkStealingDequeUnitTest, basic_test)
+{
+  RAJA::WorkStealingDeque<int> d(5);
+
+  ASSERT_EQ(8, d.capacity());
+  ASSERT_EQ(0, d.size());
+
+  int val = -1;
+  ASSERT_FALSE(d.pop(val));
+  ASSERT_FALSE(d.steal(val));
+
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_TRUE(d.push(i));
+  }
+  ASSERT_FALSE(d.push(8));
+  ASSERT_EQ(8, d.size());
+
+  // owner pops from the bottom, thieves steal from the top
+  ASSERT_TRUE(d.pop(val));
+  ASSERT_EQ(7, val);
+  ASSERT_TRUE(d.steal(val));
+  ASSERT_EQ(0, val);
+  ASSERT_EQ(6, d.size());
+
+  ASSERT_TRUE(d.push(8));
+  ASSERT_TRUE(d.pop(val));
+  ASSERT_EQ(8, val);
+}
+
+TEST(WorkStealingDequeUnitTest, concurrent_steal_test)
+{
+  const int num_items = 10000;
+  const int num_thieves = 3;
+
+  RAJA::WorkStealingDeque<int> d(num_items);
+  std::vector<std::atomic<int>> seen(num_items);
+  for (auto& s : seen) {
+    s.store(0);
+  }
+
+  std::atomic<int> taken(0);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < num_thieves; ++t) {
+    thieves.emplace_back([&]() {
+      int val;
+      while (taken.load() < num_items) {
+        if (d.steal(val)) {
+          ++seen[val];
+          ++taken;
+        }
+      }
+    });
+  }
+
+  int val;
+  for (int i = 0; i < num_items; ++i) {
+    d.push(i);
+    if (i % 3 == 0 && d.pop(val)) {
+      ++seen[val];
+      ++taken;
+    }
+  }
+  while (d.pop(val)) {
+    ++seen[val];
+    ++taken;
+  }
+
+  for (auto& t : thieves) {
+    t.join();
+  }
+
+  ASSERT_EQ(num_items, taken.load());
+  for (int i = 0; i < num_items; ++i) {
+    ASSERT_EQ(1, seen[i].load());
+  }
+}
+
+TEST(DepGraphNodeUnitTest, satisfy_test)
+{
+  RAJA::DepGraphNode node;
+  node.semaphoreReloadValue() = 2;
+  node.reset();
+
+  ASSERT_FALSE(node.satisfyOne());
+  ASSERT_TRUE(node.satisfyOne());
+  ASSERT_FALSE(node.satisfyOne());
+  ASSERT_EQ(0, node.semaphoreValue().load());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(TaskGraphUnitTest, omp_steal_chain_test)
+{
+  // segments form a chain, each depends on the one before it
+  const int num_seg = 16;
+  const int seg_len = 10;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  std::vector<RAJA::DepGraphNode> graph(num_seg);
+  for (int s = 0; s < num_seg; ++s) {
+    graph[s].semaphoreReloadValue() = (s == 0) ? 0 : 1;
+    graph[s].reset();
+    if (s != num_seg - 1) {
+      graph[s].numDepTasks() = 1;
+      graph[s].depTaskNum(0) = s + 1;
+    }
+  }
+
+  std::vector<int> order(num_seg * seg_len, -1);
+  std::atomic<int> counter(0);
+  int* order_ptr = order.data();
+
+  using POLICY = RAJA::ExecPolicy<RAJA::omp_taskgraph_steal_segit,
+                                  RAJA::seq_exec>;
+
+  for (int rep = 0; rep < 2; ++rep) {
+    counter.store(0);
+    RAJA::forall_taskgraph<POLICY>(iset, graph.data(), [&](int i) {
+      order_ptr[i] = counter++;
+    });
+
+    for (int i = 0; i < num_seg * seg_len; ++i) {
+      ASSERT_EQ(i, order[i]);
+    }
+  }
+}
+
+TEST(TaskGraphUnitTest, omp_steal_cycle_test)
+{
+  // segments 1 and 2 wait on each other, so they could never run
+  const int num_seg = 3;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s, s + 1));
+  }
+
+  std::vector<RAJA::DepGraphNode> graph(num_seg);
+  for (int s = 0; s < num_seg; ++s) {
+    graph[s].semaphoreReloadValue() = (s == 0) ? 0 : 1;
+    graph[s].reset();
+  }
+  graph[1].numDepTasks() = 1;
+  graph[1].depTaskNum(0) = 2;
+  graph[2].numDepTasks() = 1;
+  graph[2].depTaskNum(0) = 1;
+
+  using POLICY = RAJA::ExecPolicy<RAJA::omp_taskgraph_steal_segit,
+                                  RAJA::seq_exec>;
+
+  ASSERT_ANY_THROW({
+    RAJA::forall_taskgraph<POLICY>(iset, graph.data(), [](int) {});
+  });
+
+  // without a segment free of dependencies nothing could start
+  graph[0].semaphoreReloadValue() = 1;
+  graph[0].reset();
+  graph[1].numDepTasks() = 0;
+  graph[2].numDepTasks() = 0;
+
+  ASSERT_ANY_THROW({
+    RAJA::forall_taskgraph<POLICY>(iset, graph.data(), [](int) {});
+  });
+}
+#endif
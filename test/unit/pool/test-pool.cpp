@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the thread pool policies
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <numeric>
+#include <vector>
+
+TEST(PoolUnitTest, ThreadPoolRun)
+{
+  RAJA::policy::pool::ThreadPool& pool =
+      RAJA::policy::pool::ThreadPool::getInstance();
+
+  const int num_threads = pool.numThreads();
+  ASSERT_GE(num_threads, 1);
+
+  std::vector<int> ran(num_threads, 0);
+  for (int rep = 0; rep < 100; ++rep) {
+    pool.run([&](int tid, int nthreads) {
+      ASSERT_EQ(num_threads, nthreads);
+      ran[tid] += 1;
+    });
+  }
+
+  for (int tid = 0; tid < num_threads; ++tid) {
+    ASSERT_EQ(100, ran[tid]);
+  }
+}
+
+template <typename POLICY>
+void PoolForallTestImpl(int len)
+{
+  std::vector<int> a(len, 0);
+  int* a_ptr = a.data();
+
+  RAJA::forall<POLICY>(RAJA::RangeSegment(0, len), [=](int i) {
+    a_ptr[i] += i;
+  });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(i, a[i]);
+  }
+
+  int sum = 0;
+  int max = -1;
+  RAJA::forall<POLICY>(RAJA::RangeSegment(0, len),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+    RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+    [=](int i, int& s, int& m) {
+      s += a_ptr[i];
+      m = RAJA_MAX(m, a_ptr[i]);
+  });
+
+  ASSERT_EQ(len * (len - 1) / 2, sum);
+  ASSERT_EQ(len - 1, max);
+}
+
+TEST(PoolUnitTest, Forall)
+{
+  PoolForallTestImpl<RAJA::pool_exec>(1);
+  PoolForallTestImpl<RAJA::pool_exec>(1000);
+  PoolForallTestImpl<RAJA::pool_for_static<7>>(1000);
+}
+
+TEST(PoolUnitTest, Kernel)
+{
+  const int N = 50;
+  std::vector<int> a(N * N, 0);
+  int* a_ptr = a.data();
+
+  using POLICY = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::pool_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  RAJA::kernel<POLICY>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, N)),
+      [=](int i, int j) { a_ptr[i + N * j] = i + N * j; });
+
+  for (int i = 0; i < N * N; ++i) {
+    ASSERT_EQ(i, a[i]);
+  }
+}
+
+TEST(PoolUnitTest, Launch)
+{
+  const int N = 1000;
+  std::vector<int> a(N, 0);
+  std::vector<int> b(N, 0);
+  int* a_ptr = a.data();
+  int* b_ptr = b.data();
+
+  using launch_policy = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using loop_policy = RAJA::LoopPolicy<RAJA::pool_exec>;
+
+  RAJA::launch<launch_policy>(
+      RAJA::LaunchParams(), [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<loop_policy>(ctx, RAJA::RangeSegment(0, N), [&](int i) {
+          a_ptr[i] = i;
+        });
+        RAJA::loop_icount<loop_policy>(ctx, RAJA::RangeSegment(5, N + 5),
+                                       [&](int i, int icount) {
+          b_ptr[icount] = i;
+        });
+      });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(i, a[i]);
+    ASSERT_EQ(i + 5, b[i]);
+  }
+}
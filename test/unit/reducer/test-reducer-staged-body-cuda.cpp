@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for reducers captured by CUDA forall loop
+/// bodies that are staged in device memory. CMake builds this file with
+/// RAJA_CUDA_STAGED_BODY_BYTES set to 1, so every body is staged.
+///
+
+#include "RAJA_test-base.hpp"
+
+template <typename EXEC_POLICY>
+void StagedBodyReduceTestImpl()
+{
+  constexpr int N = (1 << 16) + 37;
+
+  int* data = nullptr;
+  cudaErrchk(cudaMallocManaged(&data, sizeof(int) * N));
+  long ref_sum = 0;
+  for (int i = 0; i < N; ++i) {
+    data[i] = (i * 7) % 101 - 50;
+    ref_sum += data[i];
+  }
+
+  // the same lambda type each time, so the staged copy is reused and
+  // rewritten with the new reducers
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::ReduceSum<RAJA::cuda_reduce, long> sum(rep);
+    RAJA::ReduceMin<RAJA::cuda_reduce, int> xmin(1000);
+    RAJA::ReduceMax<RAJA::cuda_reduce, int> xmax(-1000);
+
+    auto body = [=] RAJA_DEVICE (int i) {
+      sum += data[i];
+      xmin.min(data[i]);
+      xmax.max(data[i]);
+    };
+    static_assert(RAJA::cuda::is_staged_body<decltype(body)>::value,
+                  "the loop body must be staged");
+
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, N), body);
+
+    ASSERT_EQ(ref_sum + rep, sum.get());
+    ASSERT_EQ(-50, xmin.get());
+    ASSERT_EQ(50, xmax.get());
+  }
+
+  cudaErrchk(cudaFree(data));
+}
+
+GPU_TEST(ReducerStagedBodyUnitTest, CudaExec)
+{
+  StagedBodyReduceTestImpl<RAJA::cuda_exec<256>>();
+}
+
+GPU_TEST(ReducerStagedBodyUnitTest, CudaExecOcc)
+{
+  StagedBodyReduceTestImpl<RAJA::cuda_exec_occ<256>>();
+}
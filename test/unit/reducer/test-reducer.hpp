@@ -32,7 +32,8 @@ using OpenMPReducerPolicyList = camp::list< RAJA::omp_reduce,
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
-using OpenMPTargetReducerPolicyList = camp::list< RAJA::omp_target_reduce >;
+using OpenMPTargetReducerPolicyList = camp::list< RAJA::omp_target_reduce,
+                                                  RAJA::omp_target_reduce_device >;
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_RESOURCE_CONCURRENT_HPP__
+#define __TEST_RESOURCE_CONCURRENT_HPP__
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ResourceConcurrentTestImpl()
+{
+  constexpr int NUM_SEG{10};
+  constexpr int SEG_SIZE{1000};
+  constexpr int ARRAY_SIZE{NUM_SEG * SEG_SIZE};
+  using namespace RAJA;
+
+  WORKING_RES dev;
+  resources::Host host;
+  resources::StreamPool<WORKING_RES> pool(4);
+
+  ASSERT_EQ(pool.size(), 4u);
+
+  int* d_array = resources::Resource{dev}.allocate<int>(ARRAY_SIZE);
+  int* h_array = host.allocate<int>(ARRAY_SIZE);
+
+  forall<EXEC_POLICY>(dev, RangeSegment(0, ARRAY_SIZE),
+    [=] RAJA_HOST_DEVICE (int i) {
+      d_array[i] = i;
+    }
+  );
+
+  std::vector<RangeSegment> segments;
+  for (int s = 0; s < NUM_SEG; ++s) {
+    segments.push_back(RangeSegment(s * SEG_SIZE, (s + 1) * SEG_SIZE));
+  }
+
+  resources::Event e = forall_concurrent<EXEC_POLICY>(pool, dev, segments,
+    [=] RAJA_HOST_DEVICE (int i) {
+      d_array[i] *= -1;
+    }
+  );
+
+  e.wait();
+
+  dev.memcpy(h_array, d_array, sizeof(int) * ARRAY_SIZE);
+
+  dev.wait();
+
+  forall<policy::sequential::seq_exec>(host, RangeSegment(0, ARRAY_SIZE),
+    [=] (int i) {
+      ASSERT_EQ(h_array[i], -i);
+    }
+  );
+
+  dev.deallocate(d_array);
+  host.deallocate(h_array);
+}
+
+TYPED_TEST_SUITE_P(ResourceConcurrentTest);
+template <typename T>
+class ResourceConcurrentTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ResourceConcurrentTest, ResourceConcurrent)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ResourceConcurrentTestImpl<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourceConcurrentTest,
+                            ResourceConcurrent);
+
+#endif  // __TEST_RESOURCE_CONCURRENT_HPP__
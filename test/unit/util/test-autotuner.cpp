@@ -0,0 +1,109 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for Autotuner class and tuned_forall
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+TEST(AutotunerUnitTest, ChoosesFastest)
+{
+  RAJA::expt::Autotuner tuner;
+  tuner.set_num_trials(2);
+
+  // candidate 1 is the fastest
+  const double times[3] = {3.0, 1.0, 2.0};
+
+  for (int i = 0; i < 6; ++i) {
+    bool timing = false;
+    int pol = tuner.select("kernel", 100, 3, timing);
+    ASSERT_TRUE(timing);
+    ASSERT_EQ(pol, i % 3);
+    ASSERT_EQ(tuner.tuned_policy("kernel", 100, 3), -1);
+    tuner.record("kernel", 100, 3, pol, times[pol]);
+  }
+
+  ASSERT_EQ(tuner.tuned_policy("kernel", 100, 3), 1);
+
+  bool timing = true;
+  ASSERT_EQ(tuner.select("kernel", 100, 3, timing), 1);
+  ASSERT_FALSE(timing);
+
+  // sizes in the same power of two bucket share the choice
+  ASSERT_EQ(tuner.tuned_policy("kernel", 127, 3), 1);
+  ASSERT_EQ(tuner.tuned_policy("kernel", 128, 3), -1);
+  ASSERT_EQ(tuner.tuned_policy("other", 100, 3), -1);
+  ASSERT_EQ(tuner.tuned_policy("kernel", 100, 2), -1);
+}
+
+TEST(AutotunerUnitTest, SaveLoad)
+{
+  std::string file_name = "test-autotuner-choices.txt";
+
+  {
+    RAJA::expt::Autotuner tuner;
+    tuner.set_num_trials(1);
+    for (int pol = 0; pol < 2; ++pol) {
+      bool timing = false;
+      tuner.select("a kernel", 1000, 2, timing);
+      tuner.record("a kernel", 1000, 2, pol, pol == 0 ? 2.0 : 1.0);
+    }
+    ASSERT_EQ(tuner.tuned_policy("a kernel", 1000, 2), 1);
+    ASSERT_TRUE(tuner.save(file_name));
+  }
+
+  RAJA::expt::Autotuner tuner;
+  ASSERT_TRUE(tuner.load(file_name));
+  ASSERT_EQ(tuner.tuned_policy("a kernel", 1000, 2), 1);
+
+  bool timing = true;
+  ASSERT_EQ(tuner.select("a kernel", 1000, 2, timing), 1);
+  ASSERT_FALSE(timing);
+
+  ASSERT_FALSE(tuner.load("test-autotuner-missing-file.txt"));
+
+  std::remove(file_name.c_str());
+}
+
+TEST(AutotunerUnitTest, TunedForall)
+{
+  using policy_list = camp::list<RAJA::seq_exec, RAJA::loop_exec, RAJA::simd_exec>;
+  constexpr int num_policies = camp::size<policy_list>::value;
+
+  RAJA::expt::Autotuner &tuner = RAJA::expt::Autotuner::get();
+  tuner.clear();
+  tuner.set_num_trials(3);
+
+  const int N = 1000;
+  std::vector<int> a(N, 0);
+  int *a_ptr = a.data();
+
+  for (int iter = 0; iter < 3*num_policies + 2; ++iter) {
+    RAJA::expt::tuned_forall<policy_list>("TunedForall",
+      RAJA::TypedRangeSegment<int>(0, N), [=](int i) {
+        a_ptr[i] += i;
+      });
+  }
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], (3*num_policies + 2)*i);
+  }
+
+  int pol = tuner.tuned_policy("TunedForall", N, num_policies);
+  ASSERT_GE(pol, 0);
+  ASSERT_LT(pol, num_policies);
+
+  tuner.clear();
+}
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <atomic>
+#include <coroutine>
+#include <thread>
+#include <vector>
+
+// coroutine that starts suspended and is destroyed when it finishes
+struct Task {
+  struct promise_type {
+    Task get_return_object()
+    {
+      return {std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+Task forallStep(camp::resources::Host res, int* y, int n, std::atomic<int>* done)
+{
+  res = co_await RAJA::forall<RAJA::seq_exec>(
+      res, RAJA::TypedRangeSegment<int>(0, n), [=](int i) { y[i] = i; });
+  done->store(1);
+}
+
+TEST(AwaitableEventUnitTest, HostForall)
+{
+  constexpr int N = 100;
+  std::vector<int> y(N, -1);
+  std::atomic<int> done{0};
+
+  Task t = forallStep(camp::resources::Host::get_default(), y.data(), N, &done);
+  t.handle.resume();
+
+  // host events are complete, so the coroutine ran to the end
+  ASSERT_EQ(done.load(), 1);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], i);
+  }
+}
+
+Task markResumed(std::atomic<std::thread::id>* resumed_on)
+{
+  resumed_on->store(std::this_thread::get_id());
+  co_return;
+}
+
+TEST(AwaitableEventUnitTest, ReactorResumes)
+{
+  std::atomic<std::thread::id> resumed_on{std::thread::id{}};
+
+  Task t = markResumed(&resumed_on);
+  camp::resources::Host res = camp::resources::Host::get_default();
+  RAJA::resources::EventReactor::get().enqueue(res.get_event(), t.handle);
+
+  while (resumed_on.load() == std::thread::id{}) {
+    std::this_thread::yield();
+  }
+  ASSERT_NE(resumed_on.load(), std::this_thread::get_id());
+}
+
+#endif
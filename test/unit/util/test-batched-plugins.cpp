@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/BatchedPlugins.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//! counts the launches it is given, and the thread it is called on
+class CountingPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  void postLaunch(const RAJA::util::PluginContext& p) override
+  {
+    ++launches;
+    iterations += p.num_iterations;
+    if (std::this_thread::get_id() == caller) ++on_caller;
+  }
+
+  std::atomic<long long> launches{0};
+  std::atomic<long long> iterations{0};
+  std::atomic<long long> on_caller{0};
+  std::thread::id caller = std::this_thread::get_id();
+};
+
+}  // end anonymous namespace
+
+TEST(BatchedPluginsTest, SelectsLaunchesOffThread)
+{
+  RAJA::util::BatchedPlugins* batcher = RAJA::util::BatchedPlugins::instance();
+  ASSERT_NE(batcher, nullptr);
+
+  CountingPlugin* all = new CountingPlugin;
+  CountingPlugin* every_4th = new CountingPlugin;
+  CountingPlugin* large = new CountingPlugin;
+
+  RAJA::util::BatchOptions nth;
+  nth.every_nth = 4;
+  RAJA::util::BatchOptions min;
+  min.min_iterations = 1000;
+
+  ASSERT_TRUE(batcher->add(std::unique_ptr<RAJA::util::PluginStrategy>(all)));
+  ASSERT_TRUE(batcher->add(
+      std::unique_ptr<RAJA::util::PluginStrategy>(every_4th), nth));
+  ASSERT_TRUE(
+      batcher->add(std::unique_ptr<RAJA::util::PluginStrategy>(large), min));
+
+  constexpr int N = 2000;
+  std::vector<double> x(N, 1.0);
+  double* px = x.data();
+
+  for (int rep = 0; rep < 8; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                                 [=](int i) { px[i] *= 2.0; });
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                                 [=](int i) { px[i] += 1.0; });
+  }
+
+  batcher->flush();
+  const long long dropped = batcher->dropped();
+  ASSERT_EQ(dropped, 0);
+
+  ASSERT_EQ(all->launches, 16);
+  ASSERT_EQ(all->iterations, 8 * (N + 10));
+  ASSERT_EQ(every_4th->launches, 4);
+  ASSERT_EQ(large->launches, 8);
+  ASSERT_EQ(large->iterations, 8 * N);
+
+  ASSERT_EQ(all->on_caller, 0);
+  ASSERT_EQ(every_4th->on_caller, 0);
+  ASSERT_EQ(large->on_caller, 0);
+}
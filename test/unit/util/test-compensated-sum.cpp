@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for NeumaierSum
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <limits>
+#include <vector>
+
+TEST(CompensatedSumUnitTest, SmallTerms)
+{
+  const double eps = std::numeric_limits<double>::epsilon();
+  const int len = 1000;
+
+  // every small term is lost in a plain sum started from the large value
+  RAJA::NeumaierSum<double> csum(1.0);
+  double plain = 1.0;
+  for (int i = 0; i < len; ++i) {
+    csum += eps / 4;
+    plain += eps / 4;
+  }
+
+  ASSERT_EQ(1.0, plain);
+  ASSERT_EQ(1.0 + len * (eps / 4), csum.get());
+}
+
+TEST(CompensatedSumUnitTest, Cancellation)
+{
+  RAJA::NeumaierSum<double> csum;
+  csum += 1.0;
+  csum += 1.0e100;
+  csum += 1.0;
+  csum += -1.0e100;
+
+  ASSERT_EQ(2.0, csum.get());
+}
+
+TEST(CompensatedSumUnitTest, Combine)
+{
+  const float eps = std::numeric_limits<float>::epsilon();
+
+  RAJA::NeumaierSum<float> a(1.0f);
+  RAJA::NeumaierSum<float> b;
+  for (int i = 0; i < 8; ++i) {
+    a += eps / 4;
+    b += eps / 4;
+  }
+
+  RAJA::NeumaierSum<float> c = a + b;
+  ASSERT_EQ(1.0f + 4 * eps, c.get());
+  ASSERT_EQ(c.get(), (b + a).get());
+}
+
+TEST(CompensatedSumUnitTest, ReduceSum)
+{
+  const double eps = std::numeric_limits<double>::epsilon();
+  const int len = 10000;
+
+  std::vector<double> vals(len, eps / 4);
+  vals[0] = 1.0;
+  const double* data = vals.data();
+  const double expected = 1.0 + (len - 1) * (eps / 4);
+
+  RAJA::ReduceSum<RAJA::seq_reduce, RAJA::KahanSum<double>> seq_sum(0.0);
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len),
+                               [=](int i) { seq_sum += data[i]; });
+  ASSERT_EQ(expected, seq_sum.get().get());
+
+  RAJA::NeumaierSum<double> param_sum;
+  RAJA::forall<RAJA::seq_exec>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&param_sum),
+      [=](int i, RAJA::NeumaierSum<double>& s) { s += data[i]; });
+  ASSERT_EQ(expected, param_sum.get());
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::ReduceSum<RAJA::omp_reduce, RAJA::NeumaierSum<double>> omp_sum(0.0);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      [=](int i) { omp_sum += data[i]; });
+  ASSERT_EQ(expected, omp_sum.get().get());
+#endif
+}
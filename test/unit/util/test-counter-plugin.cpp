@@ -0,0 +1,53 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/CounterPlugin.hpp"
+
+#include <string>
+#include <vector>
+
+TEST(CounterPluginTest, CountsNamedKernels)
+{
+  RAJA::util::CounterPlugin* counter = RAJA::util::CounterPlugin::instance();
+  ASSERT_NE(counter, nullptr);
+  counter->reset();
+
+  constexpr int N = 100000;
+  std::vector<double> x(N, 1.0);
+  double* px = x.data();
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                                 RAJA::expt::KernelName("scale"),
+                                 RAJA::expt::BytesMoved(2 * N * sizeof(double)),
+                                 [=](int i) { px[i] *= 2.0; });
+  }
+
+  std::vector<RAJA::util::CounterPlugin::KernelCounters> counters =
+      counter->getCounters();
+  ASSERT_EQ(counters.size(), 1u);
+
+  auto const& c = counters[0];
+  ASSERT_EQ(c.name, "scale");
+  ASSERT_EQ(c.count, 3);
+  ASSERT_EQ(c.iterations, 3 * N);
+  ASSERT_EQ(c.bytes, 3 * 2 * N * static_cast<long long>(sizeof(double)));
+
+  // counters may not be allowed where the test runs
+  if (counter->available()) {
+    ASSERT_GT(c.cycles, 0);
+    ASSERT_GT(c.instructions, 0);
+  } else {
+    ASSERT_EQ(c.cycles, 0);
+  }
+  ASSERT_GE(c.arithmeticIntensity(), 0.0);
+
+  counter->reset();
+  ASSERT_TRUE(counter->getCounters().empty());
+}
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for DeterministicSum
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using DSum = RAJA::DeterministicSum<double>;
+
+static std::vector<double> makeValues(size_t n)
+{
+  std::mt19937_64 gen(2023);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> vals(n);
+  for (double& v : vals) {
+    v = dist(gen) * std::pow(10.0, static_cast<int>(gen() % 16) - 8);
+  }
+  return vals;
+}
+
+static bool sameBits(double a, double b)
+{
+  return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+TEST(DeterministicSumUnitTest, OrderIndependent)
+{
+  std::vector<double> vals = makeValues(100000);
+
+  DSum ref;
+  for (double v : vals) {
+    ref += v;
+  }
+
+  std::mt19937_64 gen(7);
+  for (int nparts : {1, 3, 64, 1000}) {
+    std::shuffle(vals.begin(), vals.end(), gen);
+
+    std::vector<DSum> parts(nparts);
+    for (size_t i = 0; i < vals.size(); ++i) {
+      parts[i % nparts] += vals[i];
+    }
+
+    DSum total;
+    for (int p = nparts - 1; p >= 0; --p) {
+      total = total + parts[p];
+    }
+
+    ASSERT_TRUE(sameBits(ref.get(), total.get()));
+  }
+}
+
+TEST(DeterministicSumUnitTest, Accuracy)
+{
+  std::vector<double> vals = makeValues(100000);
+
+  DSum dsum;
+  long double lsum = 0.0L;
+  double maxabs = 0.0;
+  for (double v : vals) {
+    dsum += v;
+    lsum += v;
+    maxabs = std::max(maxabs, std::abs(v));
+  }
+
+  ASSERT_NEAR(static_cast<double>(lsum), dsum.get(), maxabs * 1.0e-12);
+
+  DSum small(-2.5);
+  small += 0.5;
+  ASSERT_EQ(-2.0, small.get());
+  ASSERT_EQ(0.0, DSum().get());
+}
+
+TEST(DeterministicSumUnitTest, NonFinite)
+{
+  DSum dsum(1.0);
+  dsum += std::numeric_limits<double>::infinity();
+  ASSERT_EQ(std::numeric_limits<double>::infinity(), dsum.get());
+
+  dsum += -std::numeric_limits<double>::infinity();
+  ASSERT_TRUE(std::isnan(dsum.get()));
+}
+
+TEST(DeterministicSumUnitTest, ReduceSum)
+{
+  std::vector<double> vals = makeValues(100000);
+  const double* data = vals.data();
+  const int len = static_cast<int>(vals.size());
+
+  RAJA::ReduceSum<RAJA::seq_reduce, DSum> seq_sum(0.0);
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len),
+                               [=](int i) { seq_sum += data[i]; });
+
+  DSum ref;
+  for (int i = len - 1; i >= 0; --i) {
+    ref += data[i];
+  }
+  ASSERT_TRUE(sameBits(ref.get(), seq_sum.get().get()));
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::ReduceSum<RAJA::omp_reduce, DSum> omp_sum(0.0);
+  RAJA::forall<RAJA::omp_parallel_for_dynamic_exec<7>>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      [=](int i) { omp_sum += data[i]; });
+  ASSERT_TRUE(sameBits(ref.get(), omp_sum.get().get()));
+
+  DSum param_sum;
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&param_sum),
+      [=](int i, DSum& s) { s += data[i]; });
+  ASSERT_TRUE(sameBits(ref.get(), param_sum.get()));
+#endif
+}
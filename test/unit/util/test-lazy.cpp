@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for lazy array expressions
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST(LazyUnitTest, FusedChain)
+{
+  const int len = 100;
+  std::vector<double> b(len), c(len), e(len), f(len, -1.0);
+  for (int i = 0; i < len; ++i) {
+    b[i] = i;
+    c[i] = 0.5 * i + 1.0;
+    e[i] = 3.0;
+  }
+
+  RAJA::View<double, RAJA::Layout<1>> bv(b.data(), len);
+  RAJA::View<double, RAJA::Layout<1>> fv(f.data(), len);
+
+  auto a = RAJA::expt::lazy(bv) * RAJA::expt::lazy(c.data());
+  auto d = a + RAJA::expt::lazy(e.data());
+
+  // only the elements of the segment are written
+  RAJA::expt::lazy_target<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(1, len),
+                                          fv) = RAJA::expt::sqrt(d);
+
+  ASSERT_EQ(-1.0, f[0]);
+  for (int i = 1; i < len; ++i) {
+    ASSERT_DOUBLE_EQ(std::sqrt(b[i] * c[i] + e[i]), f[i]);
+  }
+}
+
+TEST(LazyUnitTest, ScalarsAndFunctions)
+{
+  const int len = 16;
+  std::vector<int> k(len);
+  std::vector<double> x(len), y(len, 1.0);
+  for (int i = 0; i < len; ++i) {
+    k[i] = i - len / 2;
+    x[i] = 0.25 * i;
+  }
+
+  auto kk = RAJA::expt::lazy(k.data());
+  auto xx = RAJA::expt::lazy(x.data());
+
+  auto target = RAJA::expt::lazy_target<RAJA::seq_exec>(
+      RAJA::TypedRangeSegment<int>(0, len), y.data());
+
+  // int operands promote to double as in ordinary expressions
+  target = -kk / 2.0 + 1 + RAJA::expt::max(RAJA::expt::abs(kk), 2) -
+           RAJA::expt::pow(xx, 2.0);
+
+  for (int i = 0; i < len; ++i) {
+    double ref = -k[i] / 2.0 + 1 + std::max(std::abs(k[i]), 2) -
+                 std::pow(x[i], 2.0);
+    ASSERT_DOUBLE_EQ(ref, y[i]);
+  }
+
+  target += RAJA::expt::min(xx, 1.0);
+  target *= 2 * target();
+
+  for (int i = 0; i < len; ++i) {
+    double ref = -k[i] / 2.0 + 1 + std::max(std::abs(k[i]), 2) -
+                 std::pow(x[i], 2.0) + std::min(x[i], 1.0);
+    ASSERT_DOUBLE_EQ(2 * ref * ref, y[i]);
+  }
+}
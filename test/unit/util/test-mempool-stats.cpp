@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool::MemPool stats
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+using pool_type =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+TEST(MemPoolStatsUnitTest, bytes_test)
+{
+  pool_type pool;
+  pool.arena_size(1 << 16);
+
+  char* a = pool.malloc<char>(1000);
+  char* b = pool.malloc<char>(3000);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+
+  RAJA::basic_mempool::MemPoolStats stats = pool.stats();
+  ASSERT_EQ(stats.bytes_reserved, size_t(1 << 16));
+  ASSERT_EQ(stats.bytes_in_use, 4000u);
+  ASSERT_EQ(stats.peak_bytes_in_use, 4000u);
+  ASSERT_EQ(stats.num_arenas, 1u);
+  ASSERT_EQ(stats.arena_growths, 1u);
+  ASSERT_EQ(stats.num_allocations, 2u);
+
+  pool.free(a);
+  stats = pool.stats();
+  ASSERT_EQ(stats.bytes_in_use, 3000u);
+  ASSERT_EQ(stats.peak_bytes_in_use, 4000u);
+  // the free chunk before b is split from the one after it
+  ASSERT_GT(stats.fragmentation(), 0.0);
+
+  pool.reset_stats();
+  stats = pool.stats();
+  ASSERT_EQ(stats.peak_bytes_in_use, 3000u);
+  ASSERT_EQ(stats.num_allocations, 0u);
+
+  pool.free(b);
+  ASSERT_EQ(pool.stats().bytes_in_use, 0u);
+  ASSERT_EQ(pool.stats().fragmentation(), 0.0);
+
+  pool.free_chunks();
+  ASSERT_EQ(pool.stats().bytes_reserved, 0u);
+}
+
+TEST(MemPoolStatsUnitTest, reserve_test)
+{
+  pool_type pool;
+  pool.arena_size(1 << 12);
+
+  ASSERT_TRUE(pool.reserve(1 << 20));
+  ASSERT_EQ(pool.stats().arena_growths, 1u);
+
+  // fits in the reserved arena, so the pool does not grow
+  ASSERT_TRUE(pool.reserve(1 << 19));
+  double* ptr = pool.malloc<double>(1 << 16);
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(pool.stats().arena_growths, 1u);
+
+  pool.free(ptr);
+  pool.free_chunks();
+}
+
+TEST(MemPoolStatsUnitTest, latency_test)
+{
+  pool_type pool;
+
+  pool.malloc<char>(8);
+  size_t timed = 0;
+  for (size_t count : pool.stats().latency_bins) {
+    timed += count;
+  }
+  ASSERT_EQ(timed, 0u);
+
+  ASSERT_FALSE(pool.time_allocations(true));
+  for (int i = 0; i < 10; ++i) {
+    pool.malloc<char>(8);
+  }
+  for (size_t count : pool.stats().latency_bins) {
+    timed += count;
+  }
+  ASSERT_EQ(timed, 10u);
+
+  ASSERT_EQ(RAJA::basic_mempool::MemPoolStats::latency_bin(0), 0);
+  ASSERT_EQ(RAJA::basic_mempool::MemPoolStats::latency_bin(127), 0);
+  ASSERT_EQ(RAJA::basic_mempool::MemPoolStats::latency_bin(128), 1);
+  ASSERT_EQ(RAJA::basic_mempool::MemPoolStats::latency_bin(1ll << 40),
+            RAJA::basic_mempool::MemPoolStats::num_latency_bins - 1);
+
+  pool.free_chunks();
+}
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/metrics.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(MetricsTest, CountersAggregateThreads)
+{
+  const RAJA::metrics::Counter counter("test.threads");
+  const RAJA::metrics::Counter same("test.threads");
+  counter.reset();
+
+  constexpr int num_threads = 4;
+  constexpr int num_adds = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < num_adds; ++i) {
+        counter++;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  same.add(5);
+
+  ASSERT_EQ(counter.value(), num_threads * num_adds + 5);
+  ASSERT_EQ(RAJA::metrics::value("test.threads"), counter.value());
+  ASSERT_EQ(RAJA::metrics::value("test.unregistered"), 0);
+
+  counter.reset();
+  ASSERT_EQ(same.value(), 0);
+}
+
+TEST(MetricsTest, SnapshotAndJSON)
+{
+  const RAJA::metrics::Counter counter("test.json");
+  RAJA::metrics::reset();
+  counter.add(3);
+
+  bool found = false;
+  for (auto const& metric : RAJA::metrics::snapshot()) {
+    if (metric.name == "test.json") {
+      found = true;
+      ASSERT_EQ(metric.value, 3);
+    }
+  }
+  ASSERT_TRUE(found);
+
+  std::ostringstream os;
+  RAJA::metrics::writeJSON(os);
+  ASSERT_NE(os.str().find("\"test.json\": 3"), std::string::npos);
+}
+
+TEST(MetricsTest, InternalCounters)
+{
+  RAJA::metrics::reset();
+
+  using pool_type = RAJA::basic_mempool::MemPool<
+      RAJA::basic_mempool::generic_allocator>;
+  pool_type pool;
+  pool.arena_size(1 << 16);
+  int* a = pool.malloc<int>(16);
+  int* b = pool.malloc<int>(16);
+  pool.free(b);
+  pool.free(a);
+
+  ASSERT_EQ(RAJA::metrics::value("mempool.misses"), 1);
+  ASSERT_EQ(RAJA::metrics::value("mempool.hits"), 1);
+
+  RAJA::ReduceSum<RAJA::seq_reduce, int> sum(0);
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                               [=](int i) { sum += i; });
+  ASSERT_EQ(sum.get(), 45);
+  ASSERT_EQ(RAJA::metrics::value("reduce.reducers"), 1);
+}
+
+TEST(MetricsTest, TensorStatsToggle)
+{
+  auto const& stat = RAJA::tensor_stats::num_vector_add;
+  RAJA::tensor_stats::resetVectorStats();
+
+  stat++;
+  ASSERT_EQ(stat.value(), 1);
+  ASSERT_EQ(RAJA::metrics::value("tensor.vector_add"), 1);
+
+  RAJA::tensor_stats::disable();
+  ASSERT_FALSE(RAJA::tensor_stats::isEnabled());
+  stat++;
+  ++stat;
+  ASSERT_EQ(stat.value(), 1);
+
+  RAJA::tensor_stats::enable();
+  ++stat;
+  ASSERT_EQ(stat.value(), 2);
+
+  RAJA::tensor_stats::resetVectorStats();
+  ASSERT_EQ(stat.value(), 0);
+}
@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/ProfilerPlugin.hpp"
+
+#include <string>
+#include <vector>
+
+TEST(ProfilerPluginTest, CountsNamedKernels)
+{
+  RAJA::util::ProfilerPlugin* profiler = RAJA::util::ProfilerPlugin::instance();
+  ASSERT_NE(profiler, nullptr);
+  profiler->reset();
+
+  constexpr int N = 1000;
+  std::vector<double> x(N, 1.0);
+  double* px = x.data();
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                                 RAJA::expt::KernelName("scale"),
+                                 RAJA::expt::BytesMoved(2 * N * sizeof(double)),
+                                 [=](int i) { px[i] *= 2.0; });
+  }
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                               [=](int i) { px[i] += 1.0; });
+
+  std::vector<RAJA::util::ProfilerPlugin::KernelStats> stats =
+      profiler->getStats();
+  ASSERT_EQ(stats.size(), 2u);
+
+  for (auto const& s : stats) {
+    ASSERT_EQ(s.platform, RAJA::Platform::host);
+    ASSERT_GE(s.total_time, 0.0);
+    ASSERT_LE(s.min_time, s.max_time);
+    if (s.name == "scale") {
+      ASSERT_EQ(s.count, 3);
+      ASSERT_EQ(s.iterations, 3 * N);
+      ASSERT_EQ(s.bytes, 3 * 2 * N * static_cast<long long>(sizeof(double)));
+    } else {
+      ASSERT_EQ(s.name, "<unnamed>");
+      ASSERT_EQ(s.count, 1);
+      ASSERT_EQ(s.iterations, 10);
+      ASSERT_EQ(s.bytes, 0);
+    }
+  }
+
+  profiler->reset();
+  ASSERT_TRUE(profiler->getStats().empty());
+}
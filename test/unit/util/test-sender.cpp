@@ -0,0 +1,55 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(SenderUnitTest, ForallChain)
+{
+  constexpr int N = 100;
+  std::vector<int> y(N, 0);
+  std::vector<int> z(N, 0);
+  int* y_ptr = y.data();
+  int* z_ptr = z.data();
+
+  camp::resources::Host res = camp::resources::Host::get_default();
+
+  auto s = RAJA::exec::forall<RAJA::seq_exec>(
+               res, RAJA::TypedRangeSegment<int>(0, N),
+               [=](int i) { y_ptr[i] = i; })
+         | RAJA::exec::then_forall<RAJA::seq_exec>(
+               RAJA::TypedRangeSegment<int>(0, N),
+               [=](int i) { z_ptr[i] = 2 * y_ptr[i]; })
+         | RAJA::exec::synchronize();
+
+  // nothing runs until the sender is started
+  ASSERT_EQ(y[N - 1], 0);
+
+  auto result = stdexec::sync_wait(std::move(s));
+  ASSERT_TRUE(result.has_value());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], i);
+    ASSERT_EQ(z[i], 2 * i);
+  }
+}
+
+TEST(SenderUnitTest, ForallReduce)
+{
+  constexpr int N = 100;
+  int sum = 0;
+
+  auto s = RAJA::exec::forall<RAJA::seq_exec>(
+      RAJA::TypedRangeSegment<int>(0, N),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, int& s) { s += i; });
+
+  stdexec::sync_wait(std::move(s));
+
+  ASSERT_EQ(sum, N * (N - 1) / 2);
+}
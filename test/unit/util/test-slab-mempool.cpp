@@ -0,0 +1,172 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool::SlabPool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using slab_pool_type =
+    RAJA::basic_mempool::SlabPool<RAJA::basic_mempool::generic_allocator>;
+
+TEST(SlabPoolUnitTest, small_blocks_test)
+{
+  slab_pool_type& pool = slab_pool_type::getInstance();
+
+  std::set<double*> ptrs;
+  for (int i = 0; i < 1000; ++i) {
+    double* ptr = pool.malloc<double>(3);
+    ASSERT_NE(ptr, nullptr);
+    // size class of 24 bytes is 32 bytes
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 32, 0u);
+    ptr[0] = ptr[1] = ptr[2] = i;
+    ASSERT_TRUE(ptrs.insert(ptr).second);
+  }
+  for (double* ptr : ptrs) {
+    pool.free(ptr);
+  }
+
+  // freed blocks are reused
+  double* ptr = pool.malloc<double>(3);
+  ASSERT_TRUE(ptrs.count(ptr) == 1);
+  pool.free(ptr);
+}
+
+TEST(SlabPoolUnitTest, alignment_test)
+{
+  slab_pool_type& pool = slab_pool_type::getInstance();
+
+  char* ptr = pool.malloc<char>(1, 256);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 256, 0u);
+  pool.free(ptr);
+}
+
+TEST(SlabPoolUnitTest, large_blocks_test)
+{
+  slab_pool_type& pool = slab_pool_type::getInstance();
+
+  const size_t len = slab_pool_type::max_block_size;
+  char* ptr0 = pool.malloc<char>(len + 1);
+  char* ptr1 = pool.malloc<char>(len + 1);
+  ASSERT_NE(ptr0, nullptr);
+  ASSERT_NE(ptr1, nullptr);
+  ASSERT_NE(ptr0, ptr1);
+  ptr0[len] = ptr1[len] = 1;
+  pool.free(ptr0);
+  pool.free(ptr1);
+}
+
+TEST(SlabPoolUnitTest, threads_test)
+{
+  slab_pool_type& pool = slab_pool_type::getInstance();
+
+  // blocks allocated on one thread may be freed on another
+  std::vector<int*> ptrs(500, nullptr);
+  std::thread alloc_thread([&]() {
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+      ptrs[i] = pool.malloc<int>(1 + i % 64);
+      ptrs[i][0] = static_cast<int>(i);
+    }
+  });
+  alloc_thread.join();
+
+  std::thread free_thread([&]() {
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+      ASSERT_EQ(static_cast<int>(i), ptrs[i][0]);
+      pool.free(ptrs[i]);
+    }
+  });
+  free_thread.join();
+
+  int* ptr = pool.malloc<int>(1);
+  ASSERT_NE(ptr, nullptr);
+  pool.free(ptr);
+}
+
+TEST(SlabPoolUnitTest, free_chunks_test)
+{
+  RAJA::basic_mempool::SlabPool<RAJA::basic_mempool::generic_allocator> pool;
+
+  int* ptr = pool.malloc<int>(8);
+  ASSERT_NE(ptr, nullptr);
+  pool.free(ptr);
+  pool.free_chunks();
+
+  ptr = pool.malloc<int>(8);
+  ASSERT_NE(ptr, nullptr);
+  pool.free(ptr);
+  pool.free_chunks();
+}
+
+TEST(SlabPoolUnitTest, handoff_test)
+{
+  slab_pool_type& pool = *slab_pool_type::newInstance();
+
+  // blocks overflowing the cache of one thread are handed off to another
+  std::set<int*> freed;
+  std::thread free_thread([&]() {
+    std::vector<int*> ptrs;
+    for (int i = 0; i < 200; ++i) {
+      ptrs.push_back(pool.malloc<int>(4));
+    }
+    for (int* ptr : ptrs) {
+      freed.insert(ptr);
+      pool.free(ptr);
+    }
+  });
+  free_thread.join();
+
+  std::thread alloc_thread([&]() {
+    std::vector<int*> ptrs;
+    for (int i = 0; i < 100; ++i) {
+      ptrs.push_back(pool.malloc<int>(4));
+      ASSERT_TRUE(freed.count(ptrs.back()) == 1);
+    }
+    for (int* ptr : ptrs) {
+      pool.free(ptr);
+    }
+  });
+  alloc_thread.join();
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // concurrent threads never get the same block, the pool only locks with
+  // openmp enabled
+  std::vector<std::vector<int*>> live(4);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < live.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 100; ++i) {
+          live[t].push_back(pool.malloc<int>(4));
+        }
+        for (int i = 0; i < 50; ++i) {
+          pool.free(live[t].back());
+          live[t].pop_back();
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  std::set<int*> ptrs;
+  for (std::vector<int*>& ptrs_t : live) {
+    for (int* ptr : ptrs_t) {
+      ASSERT_TRUE(ptrs.insert(ptr).second);
+      pool.free(ptr);
+    }
+  }
+#endif
+}
@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for expt::StagingPool and memcpy_async
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdint>
+
+template <typename Res>
+void StagingPoolRoundTrip(Res res)
+{
+  RAJA::expt::StagingPool<Res> staging;
+  camp::resources::Resource mem{res};
+  const size_t n = 1000;
+
+  double* host = staging.template allocate<double>(n);
+  ASSERT_NE(host, nullptr);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(host) %
+                RAJA::expt::StagingPool<Res>::alignment,
+            0u);
+  for (size_t i = 0; i < n; ++i) {
+    host[i] = static_cast<double>(i);
+  }
+
+  double* dev = mem.allocate<double>(n);
+  RAJA::memcpy_async(res, dev, host, n * sizeof(double)).wait();
+  for (size_t i = 0; i < n; ++i) {
+    host[i] = 0.0;
+  }
+  RAJA::memcpy_async(res, host, dev, n * sizeof(double)).wait();
+
+  for (size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(host[i], static_cast<double>(i));
+  }
+
+  mem.deallocate(dev);
+  staging.deallocate(host);
+}
+
+TEST(StagingPoolUnitTest, HostRoundTrip)
+{
+  StagingPoolRoundTrip(RAJA::resources::Host::get_default());
+}
+
+#if defined(RAJA_ENABLE_CUDA)
+TEST(StagingPoolUnitTest, CudaRoundTrip)
+{
+  StagingPoolRoundTrip(RAJA::resources::Cuda::get_default());
+}
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+TEST(StagingPoolUnitTest, HipRoundTrip)
+{
+  StagingPoolRoundTrip(RAJA::resources::Hip::get_default());
+}
+#endif
+
+TEST(StagingPoolUnitTest, ReuseTest)
+{
+  using pool_type = RAJA::expt::StagingPool<RAJA::resources::Host>;
+  pool_type staging;
+  ASSERT_TRUE(staging.reserve(1 << 20));
+  const size_t growths = staging.stats().arena_growths;
+
+  // buffers within the reserved memory do not grow the pool
+  for (int i = 0; i < 100; ++i) {
+    char* a = staging.allocate<char>(1 << 16);
+    char* b = staging.allocate<char>(1 << 18);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    staging.deallocate(b);
+    staging.deallocate(a);
+  }
+  ASSERT_EQ(staging.stats().arena_growths, growths);
+  ASSERT_EQ(staging.stats().bytes_in_use, 0u);
+
+  // copies share the buffers
+  pool_type other;
+  char* c = other.allocate<char>(1);
+  ASSERT_EQ(staging.stats().bytes_in_use, 1u);
+  staging.deallocate(c);
+}
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool::StreamCache
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <thread>
+
+using pool_type =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+using cache_type = RAJA::basic_mempool::StreamCache<pool_type, int>;
+
+TEST(StreamCacheUnitTest, reuse_test)
+{
+  cache_type& cache = cache_type::getInstance();
+
+  double* a = cache.malloc<double>(1, 16);
+  double* b = cache.malloc<double>(2, 16);
+  ASSERT_NE(a, b);
+  cache.free(a);
+  cache.free(b);
+
+  // blocks are reused for the same stream and size only
+  ASSERT_EQ(cache.malloc<double>(1, 16), a);
+  ASSERT_EQ(cache.malloc<double>(2, 16), b);
+  double* c = cache.malloc<double>(1, 16);
+  ASSERT_NE(c, a);
+  double* d = cache.malloc<double>(2, 8);
+  ASSERT_NE(d, b);
+
+  cache.free(a);
+  cache.free(b);
+  cache.free(c);
+  cache.free(d);
+}
+
+TEST(StreamCacheUnitTest, capacity_test)
+{
+  cache_type& cache = cache_type::getInstance();
+
+  // more blocks in use than the cache holds
+  const int num = 200;
+  char* ptrs[num];
+  for (int i = 0; i < num; ++i) {
+    ptrs[i] = cache.malloc<char>(3, 32);
+    ptrs[i][31] = static_cast<char>(i);
+  }
+  for (int i = 0; i < num; ++i) {
+    ASSERT_EQ(ptrs[i][31], static_cast<char>(i));
+    cache.free(ptrs[i]);
+  }
+
+  char* ptr = cache.malloc<char>(3, 32);
+  ASSERT_NE(ptr, nullptr);
+  cache.free(ptr);
+}
+
+TEST(StreamCacheUnitTest, other_thread_free_test)
+{
+  int* ptr = cache_type::getInstance().malloc<int>(4, 10);
+
+  // a block freed on another thread goes back to the pool
+  std::thread t([=]() { cache_type::getInstance().free(ptr); });
+  t.join();
+
+  int* a = cache_type::getInstance().malloc<int>(4, 10);
+  int* b = cache_type::getInstance().malloc<int>(4, 10);
+  ASSERT_NE(a, b);
+  cache_type::getInstance().free(a);
+  cache_type::getInstance().free(b);
+
+  int* c = cache_type::getInstance().malloc<int>(4, 10);
+  ASSERT_TRUE(c == a || c == b);
+  cache_type::getInstance().free(c);
+}
@@ -97,3 +97,25 @@ TEST(TimerUnitTest, No3)
   elapsed = timer.elapsed();
   EXPECT_GT(elapsed, 0.01); 
 }
+
+
+TEST(TimerUnitTest, Tsc)
+{
+  RAJA::TscTimer timer;
+
+  EXPECT_GT(RAJA::TscTimer::ticks_per_second(), 0.0);
+
+  timer.start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  timer.stop();
+
+  RAJA::TscTimer::ElapsedType elapsed = timer.elapsed();
+
+  EXPECT_GT(elapsed, 0.009);
+#if !defined(__APPLE__)
+  EXPECT_LT(elapsed, 0.05);
+#endif
+
+  timer.reset();
+  ASSERT_EQ(0, timer.elapsed());
+}
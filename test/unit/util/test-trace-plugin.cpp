@@ -0,0 +1,52 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(TracePluginTest, WritesChromeTrace)
+{
+  RAJA::util::TracePlugin* tracer = RAJA::util::TracePlugin::instance();
+  ASSERT_NE(tracer, nullptr);
+  tracer->setOutputs("chrome");
+
+  constexpr int N = 1000;
+  std::vector<double> x(N, 1.0);
+  double* px = x.data();
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                               RAJA::expt::KernelName("scale"),
+                               [=](int i) { px[i] *= 2.0; });
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                               [=](int i) { px[i] += 1.0; });
+
+  const std::string path = "test-trace-plugin.json";
+  tracer->writeChromeTrace(path);
+  tracer->setOutputs("");
+
+  std::ifstream in(path);
+  ASSERT_TRUE(in.good());
+  std::stringstream buf;
+  buf << in.rdbuf();
+  const std::string json = buf.str();
+  in.close();
+  std::remove(path.c_str());
+
+  ASSERT_EQ(json.find("{\"traceEvents\":["), 0u);
+  ASSERT_NE(json.find("\"name\":\"scale\""), std::string::npos);
+  ASSERT_NE(json.find("\"iterations\":1000"), std::string::npos);
+  ASSERT_NE(json.find("\"name\":\"<unnamed>\""), std::string::npos);
+  ASSERT_NE(json.find("\"iterations\":10}"), std::string::npos);
+  ASSERT_NE(json.find("\"platform\":\"host\""), std::string::npos);
+}
@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for loc reductions with tuple locations
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+using Loc3 = camp::tuple<int, int, int>;
+
+TEST(TupleLocUnitTest, SoAArray)
+{
+  RAJA::detail::SoAArray<camp::tuple<int, long, double>, 8> arr;
+  for (int i = 0; i < 8; ++i) {
+    arr.set(i, camp::make_tuple(i, 10L * i, 0.5 * i));
+  }
+  for (int i = 0; i < 8; ++i) {
+    auto t = arr.get(i);
+    ASSERT_EQ(camp::get<0>(t), i);
+    ASSERT_EQ(camp::get<1>(t), 10L * i);
+    ASSERT_EQ(camp::get<2>(t), 0.5 * i);
+  }
+
+  RAJA::detail::SoAArray<RAJA::expt::ValLoc<double, Loc3>, 4> vl;
+  vl.set(2, RAJA::expt::ValLoc<double, Loc3>(1.5, Loc3(1, 2, 3)));
+  ASSERT_EQ(vl.get(2).getVal(), 1.5);
+  ASSERT_EQ(camp::get<2>(vl.get(2).getLoc()), 3);
+}
+
+TEST(TupleLocUnitTest, SoAPtr)
+{
+  RAJA::detail::SoAPtr<RAJA::reduce::detail::ValueLoc<double, Loc3>> ptr;
+  ASSERT_FALSE(ptr.allocated());
+  ptr.allocate(16);
+  ASSERT_TRUE(ptr.allocated());
+  for (int i = 0; i < 16; ++i) {
+    ptr.set(i, RAJA::reduce::detail::ValueLoc<double, Loc3>(i, Loc3(i, -i, 2 * i)));
+  }
+  for (int i = 0; i < 16; ++i) {
+    auto v = ptr.get(i);
+    ASSERT_EQ(static_cast<double>(v), double(i));
+    ASSERT_EQ(camp::get<1>(v.getLoc()), -i);
+    ASSERT_EQ(camp::get<2>(v.getLoc()), 2 * i);
+  }
+  ptr.deallocate();
+  ASSERT_FALSE(ptr.allocated());
+}
+
+TEST(TupleLocUnitTest, ReduceMinLoc)
+{
+  const int N = 6;
+  std::vector<double> a(N * N * N);
+  for (int k = 0; k < N; ++k) {
+    for (int j = 0; j < N; ++j) {
+      for (int i = 0; i < N; ++i) {
+        a[i + N * (j + N * k)] = (i - 2) * (i - 2) + (j - 4) * (j - 4) +
+                                 (k - 1) * (k - 1) + 1.0;
+      }
+    }
+  }
+  RAJA::View<double, RAJA::Layout<3>> view(a.data(), N, N, N);
+
+  RAJA::ReduceMinLoc<RAJA::seq_reduce, double, Loc3> minloc(1.0e10,
+                                                           Loc3(-1, -1, -1));
+  using POL = RAJA::KernelPolicy<RAJA::statement::For<
+      2, RAJA::seq_exec,
+      RAJA::statement::For<
+          1, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec, RAJA::statement::Lambda<0>>>>>;
+  RAJA::kernel<POL>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, N)),
+      [=](int i, int j, int k) { minloc.minloc(view(k, j, i), Loc3(i, j, k)); });
+
+  ASSERT_EQ(minloc.get(), 1.0);
+  Loc3 loc = minloc.getLoc();
+  ASSERT_EQ(camp::get<0>(loc), 2);
+  ASSERT_EQ(camp::get<1>(loc), 4);
+  ASSERT_EQ(camp::get<2>(loc), 1);
+
+  using VL = RAJA::expt::ValLoc<double, Loc3>;
+  VL vl;
+  RAJA::forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, N * N * N),
+      RAJA::expt::Reduce<RAJA::operators::minimum>(&vl),
+      [=](int idx, VL& m) {
+        m.min(a[idx], Loc3(idx % N, (idx / N) % N, idx / (N * N)));
+      });
+  ASSERT_EQ(vl.getVal(), 1.0);
+  ASSERT_EQ(camp::get<0>(vl.getLoc()), 2);
+  ASSERT_EQ(camp::get<1>(vl.getLoc()), 4);
+  ASSERT_EQ(camp::get<2>(vl.getLoc()), 1);
+}
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for sampled bounds checking, which
+/// records out of range View accesses in host launches instead of aborting
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+// Runs RAJA_BOUNDS_CHECK_SAMPLE_RATE host launches, the bounds are checked
+// in exactly one of them, so each violation of body is recorded once
+template <typename BODY>
+void run_sampled_launches(int len, BODY body)
+{
+  for (int r = 0; r < RAJA_BOUNDS_CHECK_SAMPLE_RATE; ++r) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len), body);
+  }
+}
+
+TEST(BoundsCheckSampledUnitTest, ViewInRange)
+{
+  RAJA::bounds_check_reset();
+
+  std::vector<double> data(4 * 5, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> view(data.data(), 4, 5);
+
+  run_sampled_launches(4, [=](int i) {
+    for (int j = 0; j < 5; ++j) {
+      view(i, j) = 1.0;
+    }
+  });
+
+  RAJA::BoundsCheckRecord errors = RAJA::bounds_check_errors();
+  ASSERT_EQ(0ull, errors.count);
+}
+
+TEST(BoundsCheckSampledUnitTest, ViewOutOfRange)
+{
+  RAJA::bounds_check_reset();
+
+  std::vector<double> data(4 * 5, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> view(data.data(), 4, 5);
+
+  // j = 5 and 6 are past the end of dimension 1, the linear indices 5 and
+  // 6 are still inside data
+  run_sampled_launches(2, [=](int i) { view(0, 5 + i) = 2.0; });
+
+  RAJA::BoundsCheckRecord errors = RAJA::bounds_check_errors();
+  ASSERT_EQ(2ull, errors.count);
+  // the details are those of the first violation
+  ASSERT_EQ(1, errors.dim);
+  ASSERT_EQ(5, errors.index);
+  ASSERT_EQ(0, errors.lower);
+  ASSERT_EQ(4, errors.upper);
+
+  RAJA::bounds_check_reset();
+
+  errors = RAJA::bounds_check_errors();
+  ASSERT_EQ(0ull, errors.count);
+  ASSERT_EQ(0, errors.dim);
+  ASSERT_EQ(0, errors.index);
+  ASSERT_EQ(0, errors.lower);
+  ASSERT_EQ(0, errors.upper);
+}
+
+TEST(BoundsCheckSampledUnitTest, OffsetViewOutOfRange)
+{
+  RAJA::bounds_check_reset();
+
+  // one padding element in front so index -3 stays inside data
+  std::vector<double> data(1 + 5, 0.0);
+  RAJA::View<double, RAJA::OffsetLayout<1>> view(
+      data.data() + 1, RAJA::make_offset_layout<1>({{-2}}, {{3}}));
+
+  run_sampled_launches(1, [=](int) { view(-3) = 3.0; });
+
+  // the access is checked against the offset bounds, then the underlying
+  // layout checks the shifted index
+  RAJA::BoundsCheckRecord errors = RAJA::bounds_check_errors();
+  ASSERT_EQ(2ull, errors.count);
+  ASSERT_EQ(0, errors.dim);
+  ASSERT_EQ(-3, errors.index);
+  ASSERT_EQ(-2, errors.lower);
+  ASSERT_EQ(2, errors.upper);
+
+  RAJA::bounds_check_reset();
+  ASSERT_EQ(0ull, RAJA::bounds_check_errors().count);
+}
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ConvertingViewUnitTest, FloatStorageDoubleCompute)
+{
+  const int ni = 5;
+  const int nj = 7;
+  std::vector<float> a(ni * nj, 0.0f);
+
+  RAJA::ConvertingView<float, double, RAJA::Layout<2>> view(a.data(), ni, nj);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      view(i, j) = 0.1 * i + 1.0 / (j + 1);
+    }
+  }
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      // stored values are rounded to float, reads are widened to double
+      float stored = static_cast<float>(0.1 * i + 1.0 / (j + 1));
+      ASSERT_EQ(a[i * nj + j], stored);
+      double loaded = view(i, j);
+      ASSERT_EQ(loaded, static_cast<double>(stored));
+    }
+  }
+
+  view(1, 2) += 2.0;
+  view(1, 3) = view(1, 2);
+  ASSERT_EQ(a[1 * nj + 2], static_cast<float>(static_cast<double>(
+                               static_cast<float>(0.1 + 1.0 / 3)) + 2.0));
+  ASSERT_EQ(a[1 * nj + 3], a[1 * nj + 2]);
+}
+
+TEST(ConvertingViewUnitTest, Forall)
+{
+  const int len = 1000;
+  std::vector<float> x(len);
+  std::vector<float> y(len);
+  for (int i = 0; i < len; ++i) {
+    x[i] = static_cast<float>(i);
+    y[i] = 1.0f;
+  }
+
+  RAJA::ConvertingView<float, double, RAJA::Layout<1>> xv(x.data(), len);
+  RAJA::ConvertingView<float, double, RAJA::Layout<1>> yv(y.data(), len);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len),
+                               [=](int i) { yv(i) = 2.0 * xv(i) + yv(i); });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(y[i], 2.0f * i + 1.0f);
+  }
+}
+
+TEST(ConvertingViewUnitTest, AtomicView)
+{
+  const int len = 8;
+  std::vector<float> sum(len, 0.0f);
+
+  RAJA::ConvertingView<float, double, RAJA::Layout<1>> view(sum.data(), len);
+
+  auto seq_view = RAJA::make_atomic_view<RAJA::seq_atomic>(view);
+  auto auto_view = RAJA::make_atomic_view<RAJA::auto_atomic>(view);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10 * len),
+                               [=](int i) {
+                                 seq_view(i % len) += 0.5;
+                                 auto_view(i % len) += 1.0;
+                               });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(sum[i], 15.0f);
+  }
+
+  double old = auto_view(3).fetch_add(1.0);
+  ASSERT_EQ(old, 15.0);
+  ASSERT_EQ(auto_view(3).max(20.0), 20.0);
+  ASSERT_EQ(sum[3], 20.0f);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ConvertingViewUnitTest, AtomicViewOpenMP)
+{
+  const int len = 4;
+  std::vector<float> sum(len, 0.0f);
+
+  RAJA::ConvertingView<float, double, RAJA::Layout<1>> view(sum.data(), len);
+  auto atomic_view = RAJA::make_atomic_view<RAJA::omp_atomic>(view);
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::TypedRangeSegment<int>(0, 1000 * len),
+      [=](int i) { atomic_view(i % len) += 1.0; });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(sum[i], 1000.0f);
+  }
+}
+#endif
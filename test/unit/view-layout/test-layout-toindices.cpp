@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for Layout::toIndices, which divides
+/// by the strides and sizes of the layout with FastDivmod
+///
+
+#include "RAJA_test-base.hpp"
+
+TEST(LayoutToIndicesUnitTest, 3D_Small)
+{
+  const RAJA::Layout<3> layout(3, 5, 7);
+
+  int idx = 0;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        ASSERT_EQ(idx, layout(i, j, k));
+
+        int ii = -1, jj = -1, kk = -1;
+        layout.toIndices(idx, ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+
+        ++idx;
+      }
+    }
+  }
+}
+
+TEST(LayoutToIndicesUnitTest, 3D_LargeStrides)
+{
+  using Idx = RAJA::Index_type;
+
+  /*
+   * The stride of I is 2^32 and the linear indices reach 2^34, beyond what
+   * the multiply and shift of FastDivmod handle, so these divisions fall
+   * back to integer division.
+   */
+  const Idx nj = Idx(1) << 16;
+  const Idx nk = Idx(1) << 16;
+  const RAJA::Layout<3, Idx> layout(4, nj, nk);
+
+  ASSERT_EQ(nj * nk, layout.strides[0]);
+
+  const Idx is[] = {0, 1, 3};
+  const Idx js[] = {0, 1, 12345, nj - 1};
+  const Idx ks[] = {0, 1, 54321, nk - 1};
+
+  for (Idx i : is) {
+    for (Idx j : js) {
+      for (Idx k : ks) {
+        const Idx lin = layout(i, j, k);
+        ASSERT_EQ(i * nj * nk + j * nk + k, lin);
+
+        Idx ii = -1, jj = -1, kk = -1;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+}
+
+TEST(LayoutToIndicesUnitTest, 3D_ZeroSizeDim)
+{
+  /*
+   * J has size zero, so it is projected out: its stride is zero and
+   * toIndices always gives it index 0.
+   */
+  const RAJA::Layout<3> layout(3, 0, 5);
+
+  ASSERT_EQ(0, layout.strides[1]);
+  ASSERT_EQ(15, layout.size());
+
+  for (int i = 0; i < 3; ++i) {
+    for (int k = 0; k < 5; ++k) {
+      const int lin = layout(i, 0, k);
+      ASSERT_EQ(i * 5 + k, lin);
+
+      int ii = -1, jj = -1, kk = -1;
+      layout.toIndices(lin, ii, jj, kk);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(0, jj);
+      ASSERT_EQ(k, kk);
+    }
+  }
+
+  // the copy keeps the divisors of the zero-size dimension
+  const RAJA::Layout<3, int> copy(layout);
+  int ii = -1, jj = -1, kk = -1;
+  copy.toIndices(14, ii, jj, kk);
+  ASSERT_EQ(2, ii);
+  ASSERT_EQ(0, jj);
+  ASSERT_EQ(4, kk);
+}
+
+template <typename Perm>
+void check_permuted_toIndices()
+{
+  const auto layout = RAJA::make_permuted_layout({{3, 5, 7}},
+                                                 RAJA::as_array<Perm>::get());
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 7; ++k) {
+        const auto lin = layout(i, j, k);
+
+        int ii = -1, jj = -1, kk = -1;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+}
+
+TEST(LayoutToIndicesUnitTest, 3D_Permuted)
+{
+  check_permuted_toIndices<RAJA::PERM_IJK>();
+  check_permuted_toIndices<RAJA::PERM_IKJ>();
+  check_permuted_toIndices<RAJA::PERM_JIK>();
+  check_permuted_toIndices<RAJA::PERM_JKI>();
+  check_permuted_toIndices<RAJA::PERM_KIJ>();
+  check_permuted_toIndices<RAJA::PERM_KJI>();
+}
+
+TEST(LayoutToIndicesUnitTest, 2D_Offset)
+{
+  /*
+   * Indices run over [-1, 2) x [-2, 2), toIndices adds the offsets back.
+   */
+  const auto layout = RAJA::make_offset_layout<2>({{-1, -2}}, {{2, 2}});
+  const auto permuted = RAJA::make_permuted_offset_layout(
+      {{-1, -2}}, {{2, 2}}, RAJA::as_array<RAJA::PERM_JI>::get());
+
+  for (int i = -1; i < 2; ++i) {
+    for (int j = -2; j < 2; ++j) {
+      int ii = -100, jj = -100;
+      layout.toIndices(layout(i, j), ii, jj);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(j, jj);
+
+      ii = -100;
+      jj = -100;
+      permuted.toIndices(permuted(i, j), ii, jj);
+      ASSERT_EQ(i, ii);
+      ASSERT_EQ(j, jj);
+    }
+  }
+}
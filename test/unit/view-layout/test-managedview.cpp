@@ -0,0 +1,49 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ManagedViewUnitTest, BehavesAsView)
+{
+  std::vector<double> data(12, 0.0);
+
+  auto v = RAJA::make_managed_view(
+      RAJA::View<double, RAJA::Layout<2>>(data.data(), 3, 4),
+      RAJA::MemAdvice::ReadMostly);
+
+  ASSERT_EQ(RAJA::MemAdvice::ReadMostly, v.advice);
+  ASSERT_EQ(RAJA::MemAdvice::ReadMostly, RAJA::detail::get_mem_advice(v));
+  ASSERT_EQ(12, v.size());
+  ASSERT_EQ(static_cast<const void*>(data.data()), RAJA::detail::view_data(v));
+  ASSERT_EQ(12 * sizeof(double), RAJA::detail::view_bytes(v));
+
+  v(1, 2) = 3.0;
+  ASSERT_EQ(3.0, data[1 * 4 + 2]);
+
+  RAJA::View<double, RAJA::Layout<2>> plain(data.data(), 3, 4);
+  ASSERT_EQ(RAJA::MemAdvice::None, RAJA::detail::get_mem_advice(plain));
+}
+
+TEST(ManagedViewUnitTest, PrefetchParamOnHost)
+{
+  constexpr int N = 16;
+  std::vector<int> data(N, 0);
+
+  RAJA::View<int, RAJA::Layout<1>> v(data.data(), N);
+  auto mv = RAJA::make_managed_view(v, RAJA::MemAdvice::PreferredLocation);
+
+  // host policies leave the views alone
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                               RAJA::expt::Prefetch(v, mv),
+                               [=](int i) { mv(i) = i; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(i, data[i]);
+  }
+}
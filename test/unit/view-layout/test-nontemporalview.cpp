@@ -0,0 +1,64 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename T>
+void checkTriad()
+{
+  const int len = 257;
+  std::vector<T> a(len), b(len), c(len);
+  for (int i = 0; i < len; ++i) {
+    b[i] = static_cast<T>(i);
+    c[i] = static_cast<T>(len - i);
+  }
+
+  RAJA::NonTemporalStoreView<T, RAJA::Layout<1>> av(a.data(), len);
+  T* bp = b.data();
+  T* cp = c.data();
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len),
+                               [=](int i) { av(i) = bp[i] + T(3) * cp[i]; });
+  RAJA::nontemporal_store_fence();
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(a[i], b[i] + T(3) * c[i]);
+    ASSERT_EQ(static_cast<T>(av(i)), a[i]);
+  }
+}
+
+TEST(NonTemporalStoreViewUnitTest, Triad)
+{
+  checkTriad<double>();
+  checkTriad<float>();
+  checkTriad<int>();
+  checkTriad<short>();
+}
+
+TEST(NonTemporalStoreViewUnitTest, Layout2D)
+{
+  const int ni = 4;
+  const int nj = 6;
+  std::vector<double> out(ni * nj, 0.0);
+
+  RAJA::NonTemporalStoreView<double, RAJA::Layout<2>> view(out.data(), ni, nj);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      view(i, j) = 10.0 * i + j;
+    }
+  }
+  RAJA::nontemporal_store_fence();
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      ASSERT_EQ(out[i * nj + j], 10.0 * i + j);
+    }
+  }
+}
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(PrefetchExecUnitTest, ElementAddress)
+{
+  std::vector<double> data(10, 0.0);
+
+  RAJA::View<double, RAJA::Layout<1>> v(data.data(), 10);
+  RAJA::ReadOnlyView<double, RAJA::Layout<1>> rv(data.data(), 10);
+
+  ASSERT_EQ(&data[3], RAJA::expt::detail::element_address(v, 3));
+  ASSERT_EQ(&data[7], RAJA::expt::detail::element_address(rv, 7));
+  ASSERT_EQ(&data[5], RAJA::expt::detail::element_address(data.data(), 5));
+}
+
+template <typename POLICY>
+void PrefetchGatherTest()
+{
+  constexpr int N = 1000;
+
+  std::vector<double> x(N);
+  std::vector<double> y(N, 0.0);
+  std::vector<int> idx;
+  for (int i = 0; i < N; ++i) {
+    x[i] = 0.5 * i;
+  }
+  for (int i = 0; i < N; ++i) {
+    idx.push_back((i * 7) % N);
+  }
+
+  RAJA::TypedListSegment<int> list(idx.data(), idx.size(),
+                                   camp::resources::Host::get_default());
+
+  RAJA::ReadOnlyView<double, RAJA::Layout<1>> xv(x.data(), N);
+  double* yp = y.data();
+
+  double sum = 0.0;
+  RAJA::forall<POLICY>(list,
+                       RAJA::expt::Prefetch(xv, yp),
+                       RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+                       [=](int i, double& s) {
+                         yp[i] += xv(i);
+                         s += xv(i);
+                       });
+
+  double ref_sum = 0.0;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(x[i], y[i]);
+    ref_sum += x[i];
+  }
+  ASSERT_EQ(ref_sum, sum);
+
+  // without other params it runs as the plain policy
+  RAJA::forall<POLICY>(list,
+                       RAJA::expt::Prefetch(xv),
+                       [=](int i) { yp[i] += xv(i); });
+
+  RAJA::forall<POLICY>(list, [=](int i) { yp[i] -= xv(i); });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(x[i], y[i]);
+  }
+}
+
+TEST(PrefetchExecUnitTest, SeqGather)
+{
+  PrefetchGatherTest<RAJA::seq_exec_prefetch<8>>();
+  PrefetchGatherTest<RAJA::seq_exec_prefetch<2000>>();
+}
+
+TEST(PrefetchExecUnitTest, SimdGather)
+{
+  PrefetchGatherTest<RAJA::simd_exec_prefetch<16>>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(PrefetchExecUnitTest, OpenMPGather)
+{
+  PrefetchGatherTest<RAJA::omp_parallel_for_exec_prefetch<16>>();
+}
+#endif
@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+//
+// Scatter-add every element to the nodes e, e+1 and e+2 of a periodic mesh,
+// so each node gets 3 adds from different elements.
+//
+template <typename EXEC_POL, typename REDUCE_POL>
+void checkScatter(RAJA::Index_type block_size)
+{
+  const int len = 1000;
+  std::vector<double> nodal(len, 1.0);
+  RAJA::View<double, RAJA::Layout<1>> view(nodal.data(), len);
+
+  {
+    auto priv = RAJA::make_privatized_view<REDUCE_POL>(view, block_size);
+
+    RAJA::forall<EXEC_POL>(RAJA::TypedRangeSegment<int>(0, len), [=](int e) {
+      for (int n = 0; n < 3; ++n) {
+        priv((e + n) % len) += 0.5 * e;
+      }
+    });
+
+    priv.merge();
+  }
+
+  for (int i = 0; i < len; ++i) {
+    double expected = 1.0;
+    for (int n = 0; n < 3; ++n) {
+      expected += 0.5 * ((i - n + len) % len);
+    }
+    ASSERT_EQ(expected, nodal[i]);
+  }
+}
+
+TEST(PrivatizedViewUnitTest, Sequential)
+{
+  checkScatter<RAJA::seq_exec, RAJA::seq_reduce>(0);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(PrivatizedViewUnitTest, OpenMP)
+{
+  checkScatter<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(4096);
+  checkScatter<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(64);
+  checkScatter<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(1);
+}
+
+TEST(PrivatizedViewUnitTest, MergeOnDestruction)
+{
+  std::vector<int> counts(100, 0);
+  RAJA::View<int, RAJA::Layout<2>> view(counts.data(), 10, 10);
+
+  {
+    auto priv = RAJA::make_privatized_view<RAJA::omp_reduce>(view, 16);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::TypedRangeSegment<int>(0, 1000), [=](int i) {
+          // only the first row is touched
+          priv(0, i % 10) += 1;
+        });
+  }
+
+  for (int j = 0; j < 10; ++j) {
+    ASSERT_EQ(100, counts[j]);
+  }
+  for (int i = 10; i < 100; ++i) {
+    ASSERT_EQ(0, counts[i]);
+  }
+}
+#endif
@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <type_traits>
+#include <vector>
+
+TEST(ReadOnlyViewUnitTest, Access)
+{
+  const int ni = 3;
+  const int nj = 5;
+  std::vector<double> data(ni * nj);
+  for (int i = 0; i < ni * nj; ++i) {
+    data[i] = 0.5 * i;
+  }
+
+  RAJA::ReadOnlyView<double, RAJA::Layout<2>> view(data.data(), ni, nj);
+
+  // elements are returned by value
+  static_assert(std::is_same<decltype(view(0, 0)), double>::value,
+                "ReadOnlyView returns elements by value");
+
+  ASSERT_EQ(view.size(), ni * nj);
+  ASSERT_EQ(view.get_data().get(), data.data());
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      ASSERT_EQ(view(i, j), data[i * nj + j]);
+    }
+  }
+}
+
+TEST(ReadOnlyViewUnitTest, Gather)
+{
+  const int len = 64;
+  std::vector<int> src(len);
+  for (int i = 0; i < len; ++i) {
+    src[i] = len - i;
+  }
+
+  std::vector<int> idx;
+  for (int i = 0; i < len; i += 3) {
+    idx.push_back((i * 7) % len);
+  }
+
+  camp::resources::Resource host_res{camp::resources::Host::get_default()};
+  RAJA::TypedListSegment<int> seg(idx.data(), idx.size(), host_res);
+
+  RAJA::ReadOnlyView<int, RAJA::Layout<1>> in(src.data(), len);
+  std::vector<int> out(len, 0);
+  int* out_ptr = out.data();
+
+  RAJA::forall<RAJA::seq_exec>(seg, [=](int i) { out_ptr[i] = 2 * in(i); });
+
+  std::vector<int> ref(len, 0);
+  for (int i : idx) {
+    ref[i] = 2 * src[i];
+  }
+  ASSERT_EQ(ref, out);
+}
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ResidentMultiViewUnitTest, HostResource)
+{
+  using layout = RAJA::Layout<1>;
+
+  std::vector<int> a(10, 1), b(10, 2), c(10, 3);
+  int* ptrs[] = {a.data(), b.data()};
+
+  RAJA::ResidentMultiView<int, layout> fields(
+      ptrs, 2, layout(10), camp::resources::Host::get_default());
+  ASSERT_EQ(2u, fields.getNumArrays());
+
+  auto mv = fields.view();
+  ASSERT_EQ(1, mv(0, 3));
+  ASSERT_EQ(2, mv(1, 3));
+
+  // unchanged pointers reuse the resident table
+  auto mv2 = fields.view();
+  ASSERT_EQ(mv.data, mv2.data);
+
+  fields.set_data(1, c.data());
+  auto mv3 = fields.view();
+  ASSERT_EQ(mv.data, mv3.data);
+  ASSERT_EQ(3, mv3(1, 3));
+
+  mv3(1, 4) = 7;
+  ASSERT_EQ(7, c[4]);
+
+  auto first = fields.getView(0);
+  first(5) = 9;
+  ASSERT_EQ(9, mv3(0, 5));
+}
+
+TEST(ResidentMultiViewUnitTest, Forall)
+{
+  using layout = RAJA::Layout<2>;
+
+  const int num_fields = 3;
+  std::vector<std::vector<double>> data(num_fields,
+                                        std::vector<double>(4 * 5, 1.0));
+  std::vector<double*> ptrs;
+  for (auto& d : data) {
+    ptrs.push_back(d.data());
+  }
+
+  RAJA::ResidentMultiView<double, layout, 2> fields(
+      ptrs.data(), num_fields, layout(4, 5),
+      camp::resources::Host::get_default());
+
+  auto mv = fields.view();
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 4), [=](int i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int f = 0; f < num_fields; ++f) {
+        mv(i, j, f) += f * 10 + i;
+      }
+    }
+  });
+
+  for (int f = 0; f < num_fields; ++f) {
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 5; ++j) {
+        ASSERT_EQ(1.0 + f * 10 + i, data[f][i * 5 + j]);
+      }
+    }
+  }
+}
@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(RestrictExecUnitTest, ViewTriad)
+{
+  // a length that is not a multiple of the unrolling
+  constexpr int N = 1003;
+
+  std::vector<double> a(N, 0.0);
+  std::vector<double> b(N);
+  std::vector<double> c(N);
+  for (int i = 0; i < N; ++i) {
+    b[i] = 0.5 * i;
+    c[i] = 3.0 - i;
+  }
+
+  RAJA::View<double, RAJA::Layout<1>> av(a.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> bv(b.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> cv(c.data(), N);
+
+  RAJA::forall<RAJA::seq_exec_restrict>(RAJA::RangeSegment(0, N),
+                                        [=](int i) {
+                                          av(i) = bv(i) + 2.0 * cv(i);
+                                        });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(b[i] + 2.0 * c[i], a[i]);
+  }
+
+  double sum = 0.0;
+  RAJA::forall<RAJA::seq_exec_restrict>(
+      RAJA::RangeStrideSegment(1, N, 2),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, double& s) {
+        av(i) -= bv(i);
+        s += cv(i);
+      });
+
+  double ref_sum = 0.0;
+  for (int i = 0; i < N; ++i) {
+    if (i % 2 == 1) {
+      ASSERT_EQ(2.0 * c[i], a[i]);
+      ref_sum += c[i];
+    } else {
+      ASSERT_EQ(b[i] + 2.0 * c[i], a[i]);
+    }
+  }
+  ASSERT_EQ(ref_sum, sum);
+}
+
+TEST(RestrictExecUnitTest, ListSegment)
+{
+  constexpr int N = 100;
+
+  std::vector<int> x(N, 0);
+  std::vector<int> idx;
+  for (int i = 0; i < N; ++i) {
+    idx.push_back((i * 7) % N);
+  }
+
+  RAJA::TypedListSegment<int> list(idx.data(), idx.size(),
+                                   camp::resources::Host::get_default());
+
+  int* xp = x.data();
+  RAJA::forall<RAJA::seq_exec_restrict>(list, [=](int i) { xp[i] += i; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(i, x[i]);
+  }
+}
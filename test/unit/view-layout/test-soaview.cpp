@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+struct SoATestParticle {
+  double x, y, z;
+  double vx, vy, vz;
+  int id;
+};
+
+using SoATestParticleView =
+    RAJA::SoAView<SoATestParticle,
+                  RAJA_SOA_FIELD(SoATestParticle, x),
+                  RAJA_SOA_FIELD(SoATestParticle, y),
+                  RAJA_SOA_FIELD(SoATestParticle, z),
+                  RAJA_SOA_FIELD(SoATestParticle, vx),
+                  RAJA_SOA_FIELD(SoATestParticle, vy),
+                  RAJA_SOA_FIELD(SoATestParticle, vz),
+                  RAJA_SOA_FIELD(SoATestParticle, id)>;
+
+TEST(SoAViewUnitTest, StructLoadStore)
+{
+  const int n = 11;
+  std::vector<double> x(n), y(n), z(n), vx(n), vy(n), vz(n);
+  std::vector<int> id(n);
+
+  SoATestParticleView parts(x.data(), y.data(), z.data(),
+                            vx.data(), vy.data(), vz.data(), id.data());
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, n), [=](int i) {
+    parts[i] = SoATestParticle{1.0 * i, 2.0 * i, 3.0 * i, 0.5, -0.5, 1.5, i};
+  });
+
+  // fields land in separate arrays
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(x[i], 1.0 * i);
+    ASSERT_EQ(y[i], 2.0 * i);
+    ASSERT_EQ(z[i], 3.0 * i);
+    ASSERT_EQ(vx[i], 0.5);
+    ASSERT_EQ(vy[i], -0.5);
+    ASSERT_EQ(vz[i], 1.5);
+    ASSERT_EQ(id[i], i);
+  }
+
+  // kernel written against the struct
+  const double dt = 2.0;
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, n), [=](int i) {
+    SoATestParticle p = parts[i];
+    p.x += dt * p.vx;
+    p.y += dt * p.vy;
+    p.z += dt * p.vz;
+    parts[i] = p;
+  });
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(x[i], 1.0 * i + 1.0);
+    ASSERT_EQ(y[i], 2.0 * i - 1.0);
+    ASSERT_EQ(z[i], 3.0 * i + 3.0);
+    ASSERT_EQ(id[i], i);
+  }
+
+  parts[0] = parts[n - 1];
+  ASSERT_EQ(x[0], x[n - 1]);
+  ASSERT_EQ(id[0], n - 1);
+}
+
+TEST(SoAViewUnitTest, FieldAccess)
+{
+  const int n = 7;
+  std::vector<double> x(n, 1.0), y(n, 2.0), z(n, 3.0);
+  std::vector<double> vx(n, 4.0), vy(n, 5.0), vz(n, 6.0);
+  std::vector<int> id(n, 0);
+
+  SoATestParticleView parts(x.data(), y.data(), z.data(),
+                            vx.data(), vy.data(), vz.data(), id.data());
+
+  for (int i = 0; i < n; ++i) {
+    parts[i]->*&SoATestParticle::y += parts[i]->*&SoATestParticle::vy;
+    parts[i]->*&SoATestParticle::id = 10 * i;
+    parts[i].field<2>() *= 2.0;
+  }
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(x[i], 1.0);
+    ASSERT_EQ(y[i], 7.0);
+    ASSERT_EQ(z[i], 6.0);
+    ASSERT_EQ(vy[i], 5.0);
+    ASSERT_EQ(id[i], 10 * i);
+  }
+
+  ASSERT_EQ(parts.get<3>(), vx.data());
+  std::vector<double> other(n, 9.0);
+  parts.set_data<3>(other.data());
+  ASSERT_EQ(parts[4]->*&SoATestParticle::vx, 9.0);
+}
@@ -0,0 +1,157 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+/*
+ * Checks that a 3D layout maps its index space one to one into
+ * [0, size()) and that toIndices inverts it.
+ */
+template <typename LAYOUT>
+void checkLayout3D(LAYOUT const &layout, int ni, int nj, int nk)
+{
+  std::vector<int> hits(layout.size(), 0);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      for (int k = 0; k < nk; ++k) {
+        RAJA::Index_type lin = layout(i, j, k);
+        ASSERT_GE(lin, 0);
+        ASSERT_LT(lin, layout.size());
+        ++hits[lin];
+
+        int ii = -1, jj = -1, kk = -1;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(ii, i);
+        ASSERT_EQ(jj, j);
+        ASSERT_EQ(kk, k);
+      }
+    }
+  }
+
+  for (int h : hits) {
+    ASSERT_LE(h, 1);
+  }
+}
+
+TEST(TiledLayoutUnitTest, 2D_Tiles)
+{
+  /*
+   * 8x8 space in 4x4 tiles:
+   *
+   * tile (0,0) holds [0, 16), tile (0,1) holds [16, 32), ...
+   */
+  const RAJA::TiledLayout<2, 4, 4> layout(8, 8);
+
+  ASSERT_EQ(64, layout.size());
+
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(4, layout(1, 0));
+  ASSERT_EQ(15, layout(3, 3));
+  ASSERT_EQ(16, layout(0, 4));
+  ASSERT_EQ(32, layout(4, 0));
+  ASSERT_EQ(63, layout(7, 7));
+}
+
+TEST(TiledLayoutUnitTest, 3D_Padded)
+{
+  /*
+   * Each dimension is padded to a whole number of tiles.
+   */
+  const RAJA::TiledLayout<3, 4, 4, 4> layout(10, 12, 16);
+
+  ASSERT_EQ(12 * 12 * 16, layout.size());
+  ASSERT_EQ(10 * 12 * 16, layout.size_noproj());
+
+  checkLayout3D(layout, 10, 12, 16);
+
+  const RAJA::TiledLayout<3, 2, 3, 5> odd_layout(7, 5, 11);
+
+  checkLayout3D(odd_layout, 7, 5, 11);
+}
+
+TEST(MortonLayoutUnitTest, 2D_ZOrder)
+{
+  /*
+   * A power of two square is in pure Morton order:
+   *
+   *  0  1  4  5
+   *  2  3  6  7
+   *  8  9 12 13
+   * 10 11 14 15
+   */
+  const RAJA::MortonLayout<2> layout(4, 4);
+
+  ASSERT_EQ(16, layout.size());
+
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 0));
+  ASSERT_EQ(3, layout(1, 1));
+  ASSERT_EQ(4, layout(0, 2));
+  ASSERT_EQ(6, layout(1, 2));
+  ASSERT_EQ(9, layout(2, 1));
+  ASSERT_EQ(15, layout(3, 3));
+
+  int i = -1, j = -1;
+  layout.toIndices(13, i, j);
+  ASSERT_EQ(2, i);
+  ASSERT_EQ(3, j);
+}
+
+TEST(MortonLayoutUnitTest, 3D_Padded)
+{
+  const RAJA::MortonLayout<3> cube(8, 8, 8);
+
+  ASSERT_EQ(512, cube.size());
+
+  checkLayout3D(cube, 8, 8, 8);
+
+  /*
+   * Uneven extents use 2x2x2 Morton tiles, since 2 is the largest power
+   * of two not above the smallest extent.
+   */
+  const RAJA::MortonLayout<3> layout(8, 8, 3);
+
+  ASSERT_EQ(8 * 8 * 4, layout.size());
+
+  checkLayout3D(layout, 8, 8, 3);
+  checkLayout3D(RAJA::MortonLayout<3>(10, 5, 7), 10, 5, 7);
+}
+
+TEST(TiledLayoutUnitTest, Views)
+{
+  std::vector<int> tiled_data(4 * 8, 0);
+  std::vector<int> morton_data(4 * 8, 0);
+
+  auto tiled = RAJA::make_tiled_view<2, 4>(tiled_data.data(), 3, 8);
+  auto morton = RAJA::make_morton_view(morton_data.data(), 4, 8);
+
+  ASSERT_EQ(4 * 8, tiled.size());
+  ASSERT_EQ(4 * 8, morton.size());
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      tiled(i, j) = 10 * i + j;
+      morton(i, j) = 10 * i + j;
+    }
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      ASSERT_EQ(10 * i + j, tiled(i, j));
+      ASSERT_EQ(10 * i + j, morton(i, j));
+    }
+  }
+
+  // the first 2x4 tile is contiguous
+  ASSERT_EQ(13, tiled_data[7]);
+  ASSERT_EQ(4, tiled_data[8]);
+}
@@ -151,6 +151,27 @@ TYPED_TEST(TypedLayoutUnitTest, 2D_StaticLayout)
 
 }
 
+TYPED_TEST(TypedLayoutUnitTest, 2D_StaticLayoutConstexpr)
+{
+  using static_layout = RAJA::TypedStaticLayout<RAJA::PERM_JI,
+                                                TypeParam,
+                                                RAJA::list<TypeParam,TypeParam>, 7,5>;
+
+  // offsets and strides are compile time constants
+  static_assert(static_layout{}(TypeParam(2), TypeParam(3)) == 2 + 3*7,
+                "static layout offset is not a constant");
+  static_assert(static_layout{}.template get_dim_stride<0>() == 1,
+                "static layout stride is not a constant");
+  static_assert(static_layout{}.template get_dim_stride<1>() == 7,
+                "static layout stride is not a constant");
+
+  for (TypeParam i = 0; i < 7; ++i) {
+    for (TypeParam j = 0; j < 5; ++j) {
+      ASSERT_EQ(static_layout{}(i, j), static_layout::s_oper(i,j));
+    }
+  }
+}
+
 TYPED_TEST(TypedLayoutUnitTest, 2D_PermutedStaticLayout)
 {
   auto dynamic_layout =
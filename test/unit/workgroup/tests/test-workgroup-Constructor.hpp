@@ -118,6 +118,39 @@ void operator()(RAJA::xargs<Xargs...>) const
 { }
 };
 
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator
+          >
+struct testWorkGroupConstructorSingle<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                      RAJA::unordered_hip_loop_x_block_balanced,
+                                      StoragePolicy,
+                                      detail::indirect_function_call_dispatch_typer,
+                                      IndexType,
+                                      Allocator> {
+template < typename ... Xargs >
+void operator()(RAJA::xargs<Xargs...>) const
+{ }
+};
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator
+          >
+struct testWorkGroupConstructorSingle<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                      RAJA::unordered_hip_loop_x_block_balanced,
+                                      StoragePolicy,
+                                      detail::indirect_virtual_function_dispatch_typer,
+                                      IndexType,
+                                      Allocator> {
+template < typename ... Xargs >
+void operator()(RAJA::xargs<Xargs...>) const
+{ }
+};
+
 #endif
 
 
@@ -123,6 +123,41 @@ void operator()(
 { }
 };
 
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator
+          >
+struct testWorkGroupEnqueueMultiple<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                    RAJA::unordered_hip_loop_x_block_balanced,
+                                    StoragePolicy,
+                                    detail::indirect_function_call_dispatch_typer,
+                                    IndexType,
+                                    Allocator> {
+template < typename ... Args >
+void operator()(
+    RAJA::xargs<Args...>, bool, size_t, size_t) const
+{ }
+};
+///
+template <size_t BLOCK_SIZE, bool Async,
+          typename StoragePolicy,
+          typename IndexType,
+          typename Allocator
+          >
+struct testWorkGroupEnqueueMultiple<RAJA::hip_work<BLOCK_SIZE, Async>,
+                                    RAJA::unordered_hip_loop_x_block_balanced,
+                                    StoragePolicy,
+                                    detail::indirect_virtual_function_dispatch_typer,
+                                    IndexType,
+                                    Allocator> {
+template < typename ... Args >
+void operator()(
+    RAJA::xargs<Args...>, bool, size_t, size_t) const
+{ }
+};
+
 #endif
 
 